@@ -11,5 +11,7 @@ import ArrowLean.CSV
 import ArrowLean.BuilderFFI
 import ArrowLean.TypedBuilders
 import ArrowLean.ToArrow
+import ArrowLean.Deriving
 import ArrowLean.Compute
 import ArrowLean.ChunkedArray
+import ArrowLean.Expression
@@ -17,6 +17,8 @@ opaque UInt64BuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
 opaque Float32BuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
 opaque Float64BuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
 opaque StringBuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
+opaque LargeStringBuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
+opaque StringViewBuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
 opaque TimestampBuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
 opaque BoolBuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
 opaque Date32BuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
@@ -25,6 +27,7 @@ opaque Time32BuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
 opaque Time64BuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
 opaque DurationBuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
 opaque BinaryBuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
+opaque LargeBinaryBuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
 opaque SchemaBuilderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
 opaque RecordBatchPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
 
@@ -45,6 +48,8 @@ instance : Nonempty UInt64BuilderPtr.type := UInt64BuilderPtr.property
 instance : Nonempty Float32BuilderPtr.type := Float32BuilderPtr.property
 instance : Nonempty Float64BuilderPtr.type := Float64BuilderPtr.property
 instance : Nonempty StringBuilderPtr.type := StringBuilderPtr.property
+instance : Nonempty LargeStringBuilderPtr.type := LargeStringBuilderPtr.property
+instance : Nonempty StringViewBuilderPtr.type := StringViewBuilderPtr.property
 instance : Nonempty TimestampBuilderPtr.type := TimestampBuilderPtr.property
 instance : Nonempty BoolBuilderPtr.type := BoolBuilderPtr.property
 instance : Nonempty Date32BuilderPtr.type := Date32BuilderPtr.property
@@ -53,6 +58,7 @@ instance : Nonempty Time32BuilderPtr.type := Time32BuilderPtr.property
 instance : Nonempty Time64BuilderPtr.type := Time64BuilderPtr.property
 instance : Nonempty DurationBuilderPtr.type := DurationBuilderPtr.property
 instance : Nonempty BinaryBuilderPtr.type := BinaryBuilderPtr.property
+instance : Nonempty LargeBinaryBuilderPtr.type := LargeBinaryBuilderPtr.property
 instance : Nonempty SchemaBuilderPtr.type := SchemaBuilderPtr.property
 instance : Nonempty RecordBatchPtr.type := RecordBatchPtr.property
 instance : Nonempty ListBuilderPtr.type := ListBuilderPtr.property
@@ -192,6 +198,50 @@ opaque string_builder_free_impl (builder : @& StringBuilderPtr.type) : IO Unit
 @[extern "lean_string_builder_length"]
 opaque string_builder_length_impl (builder : @& StringBuilderPtr.type) : IO USize
 
+-- ============================================================================
+-- Large String Builder FFI
+-- ============================================================================
+
+@[extern "lean_large_string_builder_create"]
+opaque large_string_builder_create_impl (capacity : USize) (dataCapacity : USize) : IO (Option LargeStringBuilderPtr.type)
+
+@[extern "lean_large_string_builder_append"]
+opaque large_string_builder_append_impl (builder : @& LargeStringBuilderPtr.type) (value : @& String) : IO Bool
+
+@[extern "lean_large_string_builder_append_null"]
+opaque large_string_builder_append_null_impl (builder : @& LargeStringBuilderPtr.type) : IO Bool
+
+@[extern "lean_large_string_builder_finish"]
+opaque large_string_builder_finish_impl (builder : @& LargeStringBuilderPtr.type) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_large_string_builder_free"]
+opaque large_string_builder_free_impl (builder : @& LargeStringBuilderPtr.type) : IO Unit
+
+@[extern "lean_large_string_builder_length"]
+opaque large_string_builder_length_impl (builder : @& LargeStringBuilderPtr.type) : IO USize
+
+-- ============================================================================
+-- String View Builder FFI
+-- ============================================================================
+
+@[extern "lean_string_view_builder_create"]
+opaque string_view_builder_create_impl (capacity : USize) (blockSize : USize) : IO (Option StringViewBuilderPtr.type)
+
+@[extern "lean_string_view_builder_append"]
+opaque string_view_builder_append_impl (builder : @& StringViewBuilderPtr.type) (value : @& String) : IO Bool
+
+@[extern "lean_string_view_builder_append_null"]
+opaque string_view_builder_append_null_impl (builder : @& StringViewBuilderPtr.type) : IO Bool
+
+@[extern "lean_string_view_builder_finish"]
+opaque string_view_builder_finish_impl (builder : @& StringViewBuilderPtr.type) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_string_view_builder_free"]
+opaque string_view_builder_free_impl (builder : @& StringViewBuilderPtr.type) : IO Unit
+
+@[extern "lean_string_view_builder_length"]
+opaque string_view_builder_length_impl (builder : @& StringViewBuilderPtr.type) : IO USize
+
 -- ============================================================================
 -- Timestamp Builder FFI
 -- ============================================================================
@@ -481,6 +531,28 @@ opaque binary_builder_free_impl (builder : @& BinaryBuilderPtr.type) : IO Unit
 @[extern "lean_binary_builder_length"]
 opaque binary_builder_length_impl (builder : @& BinaryBuilderPtr.type) : IO USize
 
+-- ============================================================================
+-- Large Binary Builder FFI
+-- ============================================================================
+
+@[extern "lean_large_binary_builder_create"]
+opaque large_binary_builder_create_impl (capacity : USize) (dataCapacity : USize) : IO (Option LargeBinaryBuilderPtr.type)
+
+@[extern "lean_large_binary_builder_append"]
+opaque large_binary_builder_append_impl (builder : @& LargeBinaryBuilderPtr.type) (data : @& ByteArray) : IO Bool
+
+@[extern "lean_large_binary_builder_append_null"]
+opaque large_binary_builder_append_null_impl (builder : @& LargeBinaryBuilderPtr.type) : IO Bool
+
+@[extern "lean_large_binary_builder_finish"]
+opaque large_binary_builder_finish_impl (builder : @& LargeBinaryBuilderPtr.type) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_large_binary_builder_free"]
+opaque large_binary_builder_free_impl (builder : @& LargeBinaryBuilderPtr.type) : IO Unit
+
+@[extern "lean_large_binary_builder_length"]
+opaque large_binary_builder_length_impl (builder : @& LargeBinaryBuilderPtr.type) : IO USize
+
 -- ============================================================================
 -- Schema Builder FFI
 -- ============================================================================
@@ -545,6 +617,15 @@ opaque schema_builder_add_duration_impl (builder : @& SchemaBuilderPtr.type) (na
 @[extern "lean_schema_builder_add_binary"]
 opaque schema_builder_add_binary_impl (builder : @& SchemaBuilderPtr.type) (name : @& String) (nullable : UInt8) : IO Bool
 
+@[extern "lean_schema_builder_add_large_string"]
+opaque schema_builder_add_large_string_impl (builder : @& SchemaBuilderPtr.type) (name : @& String) (nullable : UInt8) : IO Bool
+
+@[extern "lean_schema_builder_add_large_binary"]
+opaque schema_builder_add_large_binary_impl (builder : @& SchemaBuilderPtr.type) (name : @& String) (nullable : UInt8) : IO Bool
+
+@[extern "lean_schema_builder_add_string_view"]
+opaque schema_builder_add_string_view_impl (builder : @& SchemaBuilderPtr.type) (name : @& String) (nullable : UInt8) : IO Bool
+
 @[extern "lean_schema_builder_finish"]
 opaque schema_builder_finish_impl (builder : @& SchemaBuilderPtr.type) : IO (Option ArrowSchemaPtr.type)
 
@@ -757,3 +838,69 @@ opaque dictionary_builder_length_impl (builder : @& DictionaryBuilderPtr.type) :
 
 @[extern "lean_dictionary_builder_dict_size"]
 opaque dictionary_builder_dict_size_impl (builder : @& DictionaryBuilderPtr.type) : IO USize
+
+-- ============================================================================
+-- Column Construction FFI
+-- ============================================================================
+-- One call per column. `validity` holds one byte per value (0 = null), or is
+-- empty when every value is valid.
+
+@[extern "lean_build_int8_column"]
+opaque build_int8_column_impl (values : @& Array Int8) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_int16_column"]
+opaque build_int16_column_impl (values : @& Array Int16) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_int32_column"]
+opaque build_int32_column_impl (values : @& Array Int32) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_int64_column"]
+opaque build_int64_column_impl (values : @& Array Int64) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_uint8_column"]
+opaque build_uint8_column_impl (values : @& Array UInt8) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_uint16_column"]
+opaque build_uint16_column_impl (values : @& Array UInt16) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_uint32_column"]
+opaque build_uint32_column_impl (values : @& Array UInt32) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_uint64_column"]
+opaque build_uint64_column_impl (values : @& Array UInt64) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_float64_column"]
+opaque build_float64_column_impl (values : @& Array Float) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_timestamp_column"]
+opaque build_timestamp_column_impl (values : @& Array Int64) (timezone : @& String) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_float64_column_of_float_array"]
+opaque build_float64_column_of_float_array_impl (values : @& FloatArray) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_uint8_column_of_byte_array"]
+opaque build_uint8_column_of_byte_array_impl (values : @& ByteArray) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_bool_column"]
+opaque build_bool_column_impl (values : @& Array Bool) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_string_column"]
+opaque build_string_column_impl (values : @& Array String) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_binary_column"]
+opaque build_binary_column_impl (values : @& Array ByteArray) (validity : @& ByteArray) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_opt_int64_column"]
+opaque build_opt_int64_column_impl (values : @& Array (Option Int64)) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_opt_float64_column"]
+opaque build_opt_float64_column_impl (values : @& Array (Option Float)) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_opt_timestamp_column"]
+opaque build_opt_timestamp_column_impl (values : @& Array (Option Int64)) (timezone : @& String) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_opt_bool_column"]
+opaque build_opt_bool_column_impl (values : @& Array (Option Bool)) : IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_build_opt_string_column"]
+opaque build_opt_string_column_impl (values : @& Array (Option String)) : IO (Option ArrowArrayPtr.type)
@@ -85,6 +85,43 @@ opaque table_column_name_impl : @& TablePtr.type → UInt64 → IO (Option Strin
 @[extern "lean_table_slice"]
 opaque table_slice_impl : TablePtr.type → Int64 → Int64 → IO (Option TablePtr.type)
 
+-- ============================================================================
+-- Chunked aggregation FFI declarations
+-- ============================================================================
+
+@[extern "lean_chunked_min_int64"]
+opaque chunked_min_int64_impl : @& ChunkedArrayPtr.type → Int32 → IO (Option Int)
+
+@[extern "lean_chunked_max_int64"]
+opaque chunked_max_int64_impl : @& ChunkedArrayPtr.type → Int32 → IO (Option Int)
+
+@[extern "lean_chunked_sum_int64"]
+opaque chunked_sum_int64_impl : @& ChunkedArrayPtr.type → Int32 → IO (Option Int)
+
+@[extern "lean_chunked_min_float64"]
+opaque chunked_min_float64_impl : @& ChunkedArrayPtr.type → Int32 → IO (Option Float)
+
+@[extern "lean_chunked_max_float64"]
+opaque chunked_max_float64_impl : @& ChunkedArrayPtr.type → Int32 → IO (Option Float)
+
+@[extern "lean_chunked_sum_float64"]
+opaque chunked_sum_float64_impl : @& ChunkedArrayPtr.type → Int32 → IO (Option Float)
+
+@[extern "lean_chunked_mean_int64"]
+opaque chunked_mean_int64_impl : @& ChunkedArrayPtr.type → Int32 → IO (Option Float)
+
+@[extern "lean_chunked_mean_float64"]
+opaque chunked_mean_float64_impl : @& ChunkedArrayPtr.type → Int32 → IO (Option Float)
+
+@[extern "lean_chunked_variance_float64"]
+opaque chunked_variance_float64_impl : @& ChunkedArrayPtr.type → Int32 → IO (Option Float)
+
+@[extern "lean_chunked_stddev_float64"]
+opaque chunked_stddev_float64_impl : @& ChunkedArrayPtr.type → Int32 → IO (Option Float)
+
+@[extern "lean_chunked_count"]
+opaque chunked_count_impl : @& ChunkedArrayPtr.type → IO UInt64
+
 -- ============================================================================
 -- ChunkedArray high-level API
 -- ============================================================================
@@ -158,6 +195,56 @@ def getChunks (ca : ChunkedArray) : IO (Array ArrowArray) := do
       chunks := chunks.push chunk
   return chunks
 
+
+/-! Aggregates run chunk by chunk and combine partial results, so the column
+    is never concatenated. With `threads` other than 0 or 1 they run on the
+    shared thread pool (see `Compute.setThreads`); results do not depend on
+    it. -/
+
+/-- Minimum of an Int64 column -/
+def minInt64 (ca : ChunkedArray) (threads : Int32 := 1) : IO (Option Int) :=
+  chunked_min_int64_impl ca.ptr threads
+
+/-- Maximum of an Int64 column -/
+def maxInt64 (ca : ChunkedArray) (threads : Int32 := 1) : IO (Option Int) :=
+  chunked_max_int64_impl ca.ptr threads
+
+/-- Sum of an Int64 column -/
+def sumInt64 (ca : ChunkedArray) (threads : Int32 := 1) : IO (Option Int) :=
+  chunked_sum_int64_impl ca.ptr threads
+
+/-- Minimum of a Float64 column -/
+def minFloat64 (ca : ChunkedArray) (threads : Int32 := 1) : IO (Option Float) :=
+  chunked_min_float64_impl ca.ptr threads
+
+/-- Maximum of a Float64 column -/
+def maxFloat64 (ca : ChunkedArray) (threads : Int32 := 1) : IO (Option Float) :=
+  chunked_max_float64_impl ca.ptr threads
+
+/-- Sum of a Float64 column -/
+def sumFloat64 (ca : ChunkedArray) (threads : Int32 := 1) : IO (Option Float) :=
+  chunked_sum_float64_impl ca.ptr threads
+
+/-- Mean of an Int64 column -/
+def meanInt64 (ca : ChunkedArray) (threads : Int32 := 1) : IO (Option Float) :=
+  chunked_mean_int64_impl ca.ptr threads
+
+/-- Mean of a Float64 column -/
+def meanFloat64 (ca : ChunkedArray) (threads : Int32 := 1) : IO (Option Float) :=
+  chunked_mean_float64_impl ca.ptr threads
+
+/-- Sample variance of a Float64 column -/
+def varianceFloat64 (ca : ChunkedArray) (threads : Int32 := 1) : IO (Option Float) :=
+  chunked_variance_float64_impl ca.ptr threads
+
+/-- Sample standard deviation of a Float64 column -/
+def stddevFloat64 (ca : ChunkedArray) (threads : Int32 := 1) : IO (Option Float) :=
+  chunked_stddev_float64_impl ca.ptr threads
+
+/-- Number of non-null values -/
+def count (ca : ChunkedArray) : IO UInt64 :=
+  chunked_count_impl ca.ptr
+
 end ChunkedArray
 
 -- ============================================================================
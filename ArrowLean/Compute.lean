@@ -74,6 +74,12 @@ opaque eq_float64_impl : @& ArrowArrayPtr.type → @& ArrowArrayPtr.type → IO
 @[extern "lean_arrow_eq_string"]
 opaque eq_string_impl : @& ArrowArrayPtr.type → @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
 
+@[extern "lean_arrow_eq_large_string"]
+opaque eq_large_string_impl : @& ArrowArrayPtr.type → @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_arrow_eq_string_view"]
+opaque eq_string_view_impl : @& ArrowArrayPtr.type → @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
+
 @[extern "lean_arrow_ne_int64"]
 opaque ne_int64_impl : @& ArrowArrayPtr.type → @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
 
@@ -179,6 +185,12 @@ opaque count_distinct_int64_impl : @& ArrowArrayPtr.type → IO Int
 @[extern "lean_arrow_count_distinct_string"]
 opaque count_distinct_string_impl : @& ArrowArrayPtr.type → IO Int
 
+@[extern "lean_arrow_count_distinct_large_string"]
+opaque count_distinct_large_string_impl : @& ArrowArrayPtr.type → IO Int
+
+@[extern "lean_arrow_count_distinct_string_view"]
+opaque count_distinct_string_view_impl : @& ArrowArrayPtr.type → IO Int
+
 @[extern "lean_arrow_any"]
 opaque any_impl : @& ArrowArrayPtr.type → IO Bool
 
@@ -189,18 +201,42 @@ opaque all_impl : @& ArrowArrayPtr.type → IO Bool
 @[extern "lean_arrow_string_length"]
 opaque string_length_impl : @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
 
+@[extern "lean_arrow_large_string_length"]
+opaque large_string_length_impl : @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_arrow_string_view_length"]
+opaque string_view_length_impl : @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
+
 @[extern "lean_arrow_substring"]
 opaque substring_impl : @& ArrowArrayPtr.type → Int32 → Int32 → IO (Option ArrowArrayPtr.type)
 
 @[extern "lean_arrow_string_contains"]
 opaque string_contains_impl : @& ArrowArrayPtr.type → @& String → IO (Option ArrowArrayPtr.type)
 
+@[extern "lean_arrow_large_string_contains"]
+opaque large_string_contains_impl : @& ArrowArrayPtr.type → @& String → IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_arrow_string_view_contains"]
+opaque string_view_contains_impl : @& ArrowArrayPtr.type → @& String → IO (Option ArrowArrayPtr.type)
+
 @[extern "lean_arrow_string_starts_with"]
 opaque string_starts_with_impl : @& ArrowArrayPtr.type → @& String → IO (Option ArrowArrayPtr.type)
 
+@[extern "lean_arrow_large_string_starts_with"]
+opaque large_string_starts_with_impl : @& ArrowArrayPtr.type → @& String → IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_arrow_string_view_starts_with"]
+opaque string_view_starts_with_impl : @& ArrowArrayPtr.type → @& String → IO (Option ArrowArrayPtr.type)
+
 @[extern "lean_arrow_string_ends_with"]
 opaque string_ends_with_impl : @& ArrowArrayPtr.type → @& String → IO (Option ArrowArrayPtr.type)
 
+@[extern "lean_arrow_large_string_ends_with"]
+opaque large_string_ends_with_impl : @& ArrowArrayPtr.type → @& String → IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_arrow_string_view_ends_with"]
+opaque string_view_ends_with_impl : @& ArrowArrayPtr.type → @& String → IO (Option ArrowArrayPtr.type)
+
 @[extern "lean_arrow_string_upper"]
 opaque string_upper_impl : @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
 
@@ -257,6 +293,12 @@ opaque filter_float64_impl : @& ArrowArrayPtr.type → @& ArrowArrayPtr.type →
 @[extern "lean_arrow_filter_string"]
 opaque filter_string_impl : @& ArrowArrayPtr.type → @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
 
+@[extern "lean_arrow_filter_large_string"]
+opaque filter_large_string_impl : @& ArrowArrayPtr.type → @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_arrow_filter_string_view"]
+opaque filter_string_view_impl : @& ArrowArrayPtr.type → @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
+
 @[extern "lean_arrow_filter_bool"]
 opaque filter_bool_impl : @& ArrowArrayPtr.type → @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
 
@@ -278,6 +320,46 @@ opaque sort_indices_float64_impl : @& ArrowArrayPtr.type → UInt8 → IO (Optio
 @[extern "lean_arrow_sort_indices_string"]
 opaque sort_indices_string_impl : @& ArrowArrayPtr.type → UInt8 → IO (Option ArrowArrayPtr.type)
 
+-- Parallel execution on the work-stealing thread pool
+@[extern "lean_arrow_thread_pool_set_threads"]
+opaque thread_pool_set_threads_impl : UInt32 → IO Bool
+
+@[extern "lean_arrow_thread_pool_threads"]
+opaque thread_pool_threads_impl : IO UInt32
+
+@[extern "lean_arrow_parallel_io"]
+opaque parallel_io_impl : @& Array (IO α) → IO (Array α)
+
+@[extern "lean_arrow_parallel_min_int64"]
+opaque parallel_min_int64_impl : @& ArrowArrayPtr.type → IO (Option Int)
+
+@[extern "lean_arrow_parallel_max_int64"]
+opaque parallel_max_int64_impl : @& ArrowArrayPtr.type → IO (Option Int)
+
+@[extern "lean_arrow_parallel_sum_int64"]
+opaque parallel_sum_int64_impl : @& ArrowArrayPtr.type → IO (Option Int)
+
+@[extern "lean_arrow_parallel_min_float64"]
+opaque parallel_min_float64_impl : @& ArrowArrayPtr.type → IO (Option Float)
+
+@[extern "lean_arrow_parallel_max_float64"]
+opaque parallel_max_float64_impl : @& ArrowArrayPtr.type → IO (Option Float)
+
+@[extern "lean_arrow_parallel_sum_float64"]
+opaque parallel_sum_float64_impl : @& ArrowArrayPtr.type → IO (Option Float)
+
+@[extern "lean_arrow_parallel_mean_int64"]
+opaque parallel_mean_int64_impl : @& ArrowArrayPtr.type → IO (Option Float)
+
+@[extern "lean_arrow_parallel_mean_float64"]
+opaque parallel_mean_float64_impl : @& ArrowArrayPtr.type → IO (Option Float)
+
+@[extern "lean_arrow_parallel_variance_float64"]
+opaque parallel_variance_float64_impl : @& ArrowArrayPtr.type → IO (Option Float)
+
+@[extern "lean_arrow_parallel_stddev_float64"]
+opaque parallel_stddev_float64_impl : @& ArrowArrayPtr.type → IO (Option Float)
+
 -- Null Handling
 @[extern "lean_arrow_is_null"]
 opaque is_null_impl : @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
@@ -407,6 +489,16 @@ def eqString (a b : ArrowArray) : ArrayResult := do
   let result ← eq_string_impl a.ptr b.ptr
   return wrapResult result
 
+/-- Element-wise equality comparison of two large string arrays -/
+def eqLargeString (a b : ArrowArray) : ArrayResult := do
+  let result ← eq_large_string_impl a.ptr b.ptr
+  return wrapResult result
+
+/-- Element-wise equality comparison of two string view arrays -/
+def eqStringView (a b : ArrowArray) : ArrayResult := do
+  let result ← eq_string_view_impl a.ptr b.ptr
+  return wrapResult result
+
 /-- Element-wise not-equal comparison of two Int64 arrays -/
 def neInt64 (a b : ArrowArray) : ArrayResult := do
   let result ← ne_int64_impl a.ptr b.ptr
@@ -567,6 +659,14 @@ def countDistinctInt64 (a : ArrowArray) : IO Int :=
 def countDistinctString (a : ArrowArray) : IO Int :=
   count_distinct_string_impl a.ptr
 
+/-- Count distinct values in a large string array -/
+def countDistinctLargeString (a : ArrowArray) : IO Int :=
+  count_distinct_large_string_impl a.ptr
+
+/-- Count distinct values in a string view array -/
+def countDistinctStringView (a : ArrowArray) : IO Int :=
+  count_distinct_string_view_impl a.ptr
+
 /-- Check if any value in a boolean array is true -/
 def any (a : ArrowArray) : IO Bool :=
   any_impl a.ptr
@@ -582,6 +682,16 @@ def stringLength (a : ArrowArray) : ArrayResult := do
   let result ← string_length_impl a.ptr
   return wrapResult result
 
+/-- Get the length of each string in a large string array -/
+def largeStringLength (a : ArrowArray) : ArrayResult := do
+  let result ← large_string_length_impl a.ptr
+  return wrapResult result
+
+/-- Get the length of each string in a string view array -/
+def stringViewLength (a : ArrowArray) : ArrayResult := do
+  let result ← string_view_length_impl a.ptr
+  return wrapResult result
+
 /-- Extract substring from each string in an array -/
 def substring (a : ArrowArray) (start : Int32) (len : Int32) : ArrayResult := do
   let result ← substring_impl a.ptr start len
@@ -592,16 +702,46 @@ def stringContains (a : ArrowArray) (pattern : String) : ArrayResult := do
   let result ← string_contains_impl a.ptr pattern
   return wrapResult result
 
+/-- Check if each large string contains a pattern -/
+def largeStringContains (a : ArrowArray) (pattern : String) : ArrayResult := do
+  let result ← large_string_contains_impl a.ptr pattern
+  return wrapResult result
+
+/-- Check if each string view contains a pattern -/
+def stringViewContains (a : ArrowArray) (pattern : String) : ArrayResult := do
+  let result ← string_view_contains_impl a.ptr pattern
+  return wrapResult result
+
 /-- Check if each string starts with a prefix -/
 def stringStartsWith (a : ArrowArray) (pfx : String) : ArrayResult := do
   let result ← string_starts_with_impl a.ptr pfx
   return wrapResult result
 
+/-- Check if each large string starts with a prefix -/
+def largeStringStartsWith (a : ArrowArray) (pfx : String) : ArrayResult := do
+  let result ← large_string_starts_with_impl a.ptr pfx
+  return wrapResult result
+
+/-- Check if each string view starts with a prefix -/
+def stringViewStartsWith (a : ArrowArray) (pfx : String) : ArrayResult := do
+  let result ← string_view_starts_with_impl a.ptr pfx
+  return wrapResult result
+
 /-- Check if each string ends with a suffix -/
 def stringEndsWith (a : ArrowArray) (sfx : String) : ArrayResult := do
   let result ← string_ends_with_impl a.ptr sfx
   return wrapResult result
 
+/-- Check if each large string ends with a suffix -/
+def largeStringEndsWith (a : ArrowArray) (sfx : String) : ArrayResult := do
+  let result ← large_string_ends_with_impl a.ptr sfx
+  return wrapResult result
+
+/-- Check if each string view ends with a suffix -/
+def stringViewEndsWith (a : ArrowArray) (sfx : String) : ArrayResult := do
+  let result ← string_view_ends_with_impl a.ptr sfx
+  return wrapResult result
+
 /-- Convert each string to uppercase -/
 def stringUpper (a : ArrowArray) : ArrayResult := do
   let result ← string_upper_impl a.ptr
@@ -696,6 +836,16 @@ def filterString (values mask : ArrowArray) : ArrayResult := do
   let result ← filter_string_impl values.ptr mask.ptr
   return wrapResult result
 
+/-- Filter large string array by boolean mask -/
+def filterLargeString (values mask : ArrowArray) : ArrayResult := do
+  let result ← filter_large_string_impl values.ptr mask.ptr
+  return wrapResult result
+
+/-- Filter string view array by boolean mask -/
+def filterStringView (values mask : ArrowArray) : ArrayResult := do
+  let result ← filter_string_view_impl values.ptr mask.ptr
+  return wrapResult result
+
 /-- Filter boolean array by boolean mask -/
 def filterBool (values mask : ArrowArray) : ArrayResult := do
   let result ← filter_bool_impl values.ptr mask.ptr
@@ -716,12 +866,12 @@ def takeString (values indices : ArrowArray) : ArrayResult := do
   let result ← take_string_impl values.ptr indices.ptr
   return wrapResult result
 
-/-- Get sort indices for Int64 array -/
+/-- Get sort indices for Int64 array (stable, on the thread pool; nulls sort as 0) -/
 def sortIndicesInt64 (values : ArrowArray) (ascending : Bool := true) : ArrayResult := do
   let result ← sort_indices_int64_impl values.ptr (if ascending then 1 else 0)
   return wrapResult result
 
-/-- Get sort indices for Float64 array -/
+/-- Get sort indices for Float64 array (stable, on the thread pool; nulls sort as 0, NaN last) -/
 def sortIndicesFloat64 (values : ArrowArray) (ascending : Bool := true) : ArrayResult := do
   let result ← sort_indices_float64_impl values.ptr (if ascending then 1 else 0)
   return wrapResult result
@@ -731,6 +881,67 @@ def sortIndicesString (values : ArrowArray) (ascending : Bool := true) : ArrayRe
   let result ← sort_indices_string_impl values.ptr (if ascending then 1 else 0)
   return wrapResult result
 
+-- Parallel Execution
+
+/-- Set the number of threads running parallel kernels, the caller included
+    (0: one per CPU, 1: sequential). No parallel operation may be running. -/
+def setThreads (threads : Nat) : IO Unit := do
+  unless ← thread_pool_set_threads_impl threads.toUInt32 do
+    throw (IO.userError s!"invalid thread count {threads}")
+
+/-- Number of threads running parallel kernels -/
+def threads : IO Nat := do
+  return (← thread_pool_threads_impl).toNat
+
+/-- Run IO actions on the thread pool. All actions run; the results come
+    back in order, or the error of the first action that failed. -/
+def parallelIO (actions : Array (IO α)) : IO (Array α) :=
+  parallel_io_impl actions
+
+/-! The `parallel*` aggregates split an array into fixed-size morsels, run
+    them on the thread pool and combine the partial results in order, so
+    they do not depend on the thread count. -/
+
+/-- Minimum of an Int64 array, on the thread pool -/
+def parallelMinInt64 (a : ArrowArray) : IO (Option Int) :=
+  parallel_min_int64_impl a.ptr
+
+/-- Maximum of an Int64 array, on the thread pool -/
+def parallelMaxInt64 (a : ArrowArray) : IO (Option Int) :=
+  parallel_max_int64_impl a.ptr
+
+/-- Sum of an Int64 array, on the thread pool -/
+def parallelSumInt64 (a : ArrowArray) : IO (Option Int) :=
+  parallel_sum_int64_impl a.ptr
+
+/-- Minimum of a Float64 array, on the thread pool -/
+def parallelMinFloat64 (a : ArrowArray) : IO (Option Float) :=
+  parallel_min_float64_impl a.ptr
+
+/-- Maximum of a Float64 array, on the thread pool -/
+def parallelMaxFloat64 (a : ArrowArray) : IO (Option Float) :=
+  parallel_max_float64_impl a.ptr
+
+/-- Sum of a Float64 array, on the thread pool -/
+def parallelSumFloat64 (a : ArrowArray) : IO (Option Float) :=
+  parallel_sum_float64_impl a.ptr
+
+/-- Mean of an Int64 array, on the thread pool -/
+def parallelMeanInt64 (a : ArrowArray) : IO (Option Float) :=
+  parallel_mean_int64_impl a.ptr
+
+/-- Mean of a Float64 array, on the thread pool -/
+def parallelMeanFloat64 (a : ArrowArray) : IO (Option Float) :=
+  parallel_mean_float64_impl a.ptr
+
+/-- Sample variance of a Float64 array, on the thread pool -/
+def parallelVarianceFloat64 (a : ArrowArray) : IO (Option Float) :=
+  parallel_variance_float64_impl a.ptr
+
+/-- Sample standard deviation of a Float64 array, on the thread pool -/
+def parallelStddevFloat64 (a : ArrowArray) : IO (Option Float) :=
+  parallel_stddev_float64_impl a.ptr
+
 -- Null Handling
 
 /-- Check which values are null (returns boolean array) -/
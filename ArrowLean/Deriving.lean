@@ -0,0 +1,37 @@
+/-
+  ArrowLean/Deriving.lean - `deriving ToArrowBatch` for structures
+
+  Generates `ToArrowBatch.ofFields` with one `FieldColumn` per structure
+  field, so records are transposed into columns in a single pass.
+-/
+
+import Lean
+import ArrowLean.ToArrow
+
+open Lean Elab Command
+
+namespace ArrowLean.Deriving
+
+def mkToArrowBatchInstance (declName : Name) : CommandElabM Bool := do
+  let env ← getEnv
+  unless isStructure env declName do return false
+  -- Parameterized structures would need the instance to quantify over them
+  let info ← getConstInfoInduct declName
+  unless info.numParams == 0 do return false
+  let fields := getStructureFieldsFlattened env declName (includeSubobjectFields := false)
+  if fields.isEmpty then return false
+  let structId := mkCIdent declName
+  let record := mkIdent `record
+  let columns ← fields.mapM fun field =>
+    `(FieldColumn.of $(quote field.toString) (fun ($record : $structId) => $(mkIdent (`record ++ field))))
+  let cmd ← `(instance : ToArrowBatch $structId := ToArrowBatch.ofFields #[$columns,*])
+  elabCommand cmd
+  return true
+
+def mkToArrowBatchInstanceHandler (declNames : Array Name) : CommandElabM Bool := do
+  if declNames.size != 1 then return false
+  mkToArrowBatchInstance declNames[0]!
+
+initialize registerDerivingHandler ``ToArrowBatch mkToArrowBatchInstanceHandler
+
+end ArrowLean.Deriving
@@ -0,0 +1,220 @@
+/-
+  ArrowLean.Expression - Fused expression evaluation over record batches
+
+  Expressions over the columns of a record batch (arithmetic, comparisons,
+  boolean logic, casts and string predicates) are evaluated in one pass,
+  a cache-sized block of rows at a time, so only the final column is
+  materialized. Chaining the kernels of ArrowLean.Compute instead builds
+  one full-length array per operator.
+-/
+
+import ArrowLean.Ops
+import ArrowLean.FFI
+import ArrowLean.TypedBuilders
+
+namespace ArrowLean
+
+-- ============================================================================
+-- Opaque pointer types
+-- ============================================================================
+
+/-- Opaque pointer to a C expression tree -/
+opaque ExprPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
+
+instance : Nonempty ExprPtr.type := ExprPtr.property
+
+-- ============================================================================
+-- FFI Declarations
+-- ============================================================================
+
+-- Constructors; operators take ownership of their operands
+@[extern "lean_arrow_expr_column"]
+opaque expr_column_impl : UInt64 → IO ExprPtr.type
+
+@[extern "lean_arrow_expr_column_named"]
+opaque expr_column_named_impl : @& String → IO ExprPtr.type
+
+@[extern "lean_arrow_expr_literal_int64"]
+opaque expr_literal_int64_impl : Int64 → IO ExprPtr.type
+
+@[extern "lean_arrow_expr_literal_float64"]
+opaque expr_literal_float64_impl : Float → IO ExprPtr.type
+
+@[extern "lean_arrow_expr_literal_bool"]
+opaque expr_literal_bool_impl : Bool → IO ExprPtr.type
+
+@[extern "lean_arrow_expr_literal_string"]
+opaque expr_literal_string_impl : @& String → IO ExprPtr.type
+
+@[extern "lean_arrow_expr_unary"]
+opaque expr_unary_impl : UInt8 → @& ExprPtr.type → IO ExprPtr.type
+
+@[extern "lean_arrow_expr_binary"]
+opaque expr_binary_impl : UInt8 → @& ExprPtr.type → @& ExprPtr.type → IO ExprPtr.type
+
+@[extern "lean_arrow_expr_cast"]
+opaque expr_cast_impl : @& ExprPtr.type → UInt8 → IO ExprPtr.type
+
+@[extern "lean_arrow_expr_string_predicate"]
+opaque expr_string_predicate_impl : UInt8 → @& ExprPtr.type → @& String → IO ExprPtr.type
+
+@[extern "lean_arrow_expr_free"]
+opaque expr_free_impl : @& ExprPtr.type → IO Unit
+
+-- Evaluation
+@[extern "lean_arrow_expr_evaluate"]
+opaque expr_evaluate_impl : @& ExprPtr.type → @& ArrowSchemaPtr.type → @& ArrowArrayPtr.type → IO (Option ArrowArrayPtr.type)
+
+@[extern "lean_arrow_expr_evaluate_batch"]
+opaque expr_evaluate_batch_impl : @& ExprPtr.type → @& RecordBatchPtr.type → IO (Option ArrowArrayPtr.type)
+
+-- ============================================================================
+-- Expressions
+-- ============================================================================
+
+inductive UnaryOp
+| neg
+| abs
+| not
+| isNull
+| isValid
+deriving Nonempty
+
+-- Codes match ArrowExprOp in arrow_expression.h
+def UnaryOp.toUInt8 : UnaryOp → UInt8
+| .neg => 0
+| .abs => 1
+| .not => 2
+| .isNull => 3
+| .isValid => 4
+
+inductive BinaryOp
+| add | sub | mul | div
+| eq | ne | lt | le | gt | ge
+| and | or | xor
+deriving Nonempty
+
+def BinaryOp.toUInt8 : BinaryOp → UInt8
+| .add => 5
+| .sub => 6
+| .mul => 7
+| .div => 8
+| .eq => 9
+| .ne => 10
+| .lt => 11
+| .le => 12
+| .gt => 13
+| .ge => 14
+| .and => 15
+| .or => 16
+| .xor => 17
+
+inductive StringOp
+| contains
+| startsWith
+| endsWith
+deriving Nonempty
+
+def StringOp.toUInt8 : StringOp → UInt8
+| .contains => 18
+| .startsWith => 19
+| .endsWith => 20
+
+/-- Result types of expressions and cast targets -/
+inductive ValueType
+| int64
+| float64
+| bool
+deriving Nonempty
+
+def ValueType.toUInt8 : ValueType → UInt8
+| .int64 => 0
+| .float64 => 1
+| .bool => 2
+
+/-- An expression over the columns of a record batch.
+
+    Int32 and float32 columns are widened as they are read, and mixed
+    int64/float64 operands promote to float64. A null operand gives a null
+    result, except that `and`/`or` follow Kleene logic and `isNull`/`isValid`
+    are never null. Integer division by zero is null. String columns may
+    only be compared with `eq`/`ne` or tested with `strPred`. -/
+inductive Expr
+| column (index : Nat)
+| columnNamed (name : String)
+| int64 (value : Int64)
+| float64 (value : Float)
+| bool (value : Bool)
+| string (value : String)
+| unary (op : UnaryOp) (operand : Expr)
+| binary (op : BinaryOp) (left right : Expr)
+| cast (operand : Expr) (type : ValueType)
+| strPred (op : StringOp) (operand : Expr) (pattern : String)
+deriving Nonempty
+
+namespace Expr
+
+instance : Add Expr := ⟨.binary .add⟩
+instance : Sub Expr := ⟨.binary .sub⟩
+instance : Mul Expr := ⟨.binary .mul⟩
+instance : Div Expr := ⟨.binary .div⟩
+instance : Neg Expr := ⟨.unary .neg⟩
+
+def eq (a b : Expr) : Expr := .binary .eq a b
+def ne (a b : Expr) : Expr := .binary .ne a b
+def lt (a b : Expr) : Expr := .binary .lt a b
+def le (a b : Expr) : Expr := .binary .le a b
+def gt (a b : Expr) : Expr := .binary .gt a b
+def ge (a b : Expr) : Expr := .binary .ge a b
+def and (a b : Expr) : Expr := .binary .and a b
+def or (a b : Expr) : Expr := .binary .or a b
+def not (a : Expr) : Expr := .unary .not a
+def isNull (a : Expr) : Expr := .unary .isNull a
+def contains (a : Expr) (pattern : String) : Expr := .strPred .contains a pattern
+def startsWith (a : Expr) (pattern : String) : Expr := .strPred .startsWith a pattern
+def endsWith (a : Expr) (pattern : String) : Expr := .strPred .endsWith a pattern
+
+/-- Build the C expression tree. A failed node makes the whole tree fail at
+    evaluation, so no intermediate checks are needed. -/
+private def build : Expr → IO ExprPtr.type
+| .column index => expr_column_impl index.toUInt64
+| .columnNamed name => expr_column_named_impl name
+| .int64 value => expr_literal_int64_impl value
+| .float64 value => expr_literal_float64_impl value
+| .bool value => expr_literal_bool_impl value
+| .string value => expr_literal_string_impl value
+| .unary op operand => do expr_unary_impl op.toUInt8 (← build operand)
+| .binary op left right => do
+  let l ← build left
+  let r ← build right
+  expr_binary_impl op.toUInt8 l r
+| .cast operand type => do expr_cast_impl (← build operand) type.toUInt8
+| .strPred op operand pattern => do expr_string_predicate_impl op.toUInt8 (← build operand) pattern
+
+private def wrapResult (result : Option ArrowArrayPtr.type) : IO (Option ArrowArray) := do
+  match result with
+  | some ptr =>
+    let length ← arrow_array_get_length_impl ptr
+    let nullCount ← arrow_array_get_null_count_impl ptr
+    return some { ptr, length, null_count := nullCount, offset := 0 }
+  | none => return none
+
+/-- Evaluate over a struct array whose children are the columns described by
+    `schema`. Returns an int64, float64 or bool array, or `none` if the
+    expression does not type-check against the schema. -/
+def evaluate (expr : Expr) (schema : ArrowSchema) (batch : ArrowArray) : IO (Option ArrowArray) := do
+  let ptr ← build expr
+  let result ← expr_evaluate_impl ptr schema.ptr batch.ptr
+  expr_free_impl ptr
+  wrapResult result
+
+/-- Evaluate over the columns of a record batch -/
+def evaluateBatch (expr : Expr) (batch : RecordBatch) : IO (Option ArrowArray) := do
+  let ptr ← build expr
+  let result ← expr_evaluate_batch_impl ptr batch.ptr
+  expr_free_impl ptr
+  wrapResult result
+
+end Expr
+
+end ArrowLean
@@ -260,6 +260,12 @@ opaque arrow_get_string_value_impl (array: @& ArrowArrayPtr.type) (index: USize)
 @[extern "lean_arrow_is_string_null"]
 opaque arrow_is_string_null_impl (array: @& ArrowArrayPtr.type) (index: USize) : IO Bool
 
+@[extern "lean_arrow_get_large_string_value"]
+opaque arrow_get_large_string_value_impl (array: @& ArrowArrayPtr.type) (index: USize) : IO String
+
+@[extern "lean_arrow_get_string_view_value"]
+opaque arrow_get_string_view_value_impl (array: @& ArrowArrayPtr.type) (index: USize) : IO String
+
 -- High-level Data Access Functions
 def ArrowArray.getBool (array: ArrowArray) (index: USize) : IO (Option Bool) := do
   let is_null ← arrow_is_bool_null_impl array.ptr index
@@ -285,6 +291,77 @@ def ArrowArray.getString (array: ArrowArray) (index: USize) : IO (Option String)
     let value ← arrow_get_string_value_impl array.ptr index
     return some value
 
+def ArrowArray.getLargeString (array: ArrowArray) (index: USize) : IO (Option String) := do
+  let is_null ← arrow_is_string_null_impl array.ptr index
+  if is_null then
+    return none
+  else
+    let value ← arrow_get_large_string_value_impl array.ptr index
+    return some value
+
+def ArrowArray.getStringView (array: ArrowArray) (index: USize) : IO (Option String) := do
+  let is_null ← arrow_is_string_null_impl array.ptr index
+  if is_null then
+    return none
+  else
+    let value ← arrow_get_string_view_value_impl array.ptr index
+    return some value
+
+-- External Bulk Extraction C functions (rows [start, start + count))
+@[extern "lean_arrow_export_validity"]
+opaque arrow_export_validity_impl (array: @& ArrowArrayPtr.type) (start count: USize) : IO ByteArray
+
+@[extern "lean_arrow_export_float64_values"]
+opaque arrow_export_float64_values_impl (array: @& ArrowArrayPtr.type) (start count: USize) : IO FloatArray
+
+@[extern "lean_arrow_export_uint8_values"]
+opaque arrow_export_uint8_values_impl (array: @& ArrowArrayPtr.type) (start count: USize) : IO ByteArray
+
+@[extern "lean_arrow_export_int64_options"]
+opaque arrow_export_int64_options_impl (array: @& ArrowArrayPtr.type) (start count: USize) : IO (Array (Option Int64))
+
+@[extern "lean_arrow_export_float64_options"]
+opaque arrow_export_float64_options_impl (array: @& ArrowArrayPtr.type) (start count: USize) : IO (Array (Option Float))
+
+@[extern "lean_arrow_export_strings"]
+opaque arrow_export_strings_impl (array: @& ArrowArrayPtr.type) (layout: UInt32) (start count: USize) : IO (Array (Option String))
+
+-- High-level Bulk Extraction: a whole column (or a range of it) per call.
+-- `count` defaults to the rest of the array.
+
+private def ArrowArray.exportCount (array: ArrowArray) (start: USize) (count: Option USize) : USize :=
+  count.getD (array.length.toUSize - start)
+
+/-- Validity as one byte per value (1 = valid, 0 = null) -/
+def ArrowArray.validityBytes (array: ArrowArray) (start: USize := 0) (count: Option USize := none) : IO ByteArray :=
+  arrow_export_validity_impl array.ptr start (array.exportCount start count)
+
+/-- Float64 values copied with one memcpy; null slots hold whatever the buffer stores -/
+def ArrowArray.toFloatArray (array: ArrowArray) (start: USize := 0) (count: Option USize := none) : IO FloatArray :=
+  arrow_export_float64_values_impl array.ptr start (array.exportCount start count)
+
+/-- UInt8/Int8 values copied with one memcpy; null slots hold whatever the buffer stores -/
+def ArrowArray.toByteArray (array: ArrowArray) (start: USize := 0) (count: Option USize := none) : IO ByteArray :=
+  arrow_export_uint8_values_impl array.ptr start (array.exportCount start count)
+
+def ArrowArray.toInt64Options (array: ArrowArray) (start: USize := 0) (count: Option USize := none) : IO (Array (Option Int64)) :=
+  arrow_export_int64_options_impl array.ptr start (array.exportCount start count)
+
+def ArrowArray.toFloat64Options (array: ArrowArray) (start: USize := 0) (count: Option USize := none) : IO (Array (Option Float)) :=
+  arrow_export_float64_options_impl array.ptr start (array.exportCount start count)
+
+/-- Decode a `u` column in one pass -/
+def ArrowArray.toStrings (array: ArrowArray) (start: USize := 0) (count: Option USize := none) : IO (Array (Option String)) :=
+  arrow_export_strings_impl array.ptr 'u'.val start (array.exportCount start count)
+
+/-- Decode a `U` column in one pass -/
+def ArrowArray.toLargeStrings (array: ArrowArray) (start: USize := 0) (count: Option USize := none) : IO (Array (Option String)) :=
+  arrow_export_strings_impl array.ptr 'U'.val start (array.exportCount start count)
+
+/-- Decode a `vu` column in one pass -/
+def ArrowArray.toStringViews (array: ArrowArray) (start: USize := 0) (count: Option USize := none) : IO (Array (Option String)) :=
+  arrow_export_strings_impl array.ptr 'v'.val start (array.exportCount start count)
+
 -- External Buffer Management C functions
 @[extern "lean_arrow_allocate_buffer"]
 opaque arrow_allocate_buffer_impl (size: USize) : IO ArrowBufferPtr.type
@@ -311,4 +388,44 @@ def ArrowBuffer.resize (buffer: ArrowBuffer) (new_size: USize) : IO Unit :=
   arrow_buffer_resize_impl buffer.ptr new_size
 
 def ArrowBuffer.free (buffer: ArrowBuffer) : IO Unit :=
-  arrow_buffer_free_impl buffer.ptr
\ No newline at end of file
+  arrow_buffer_free_impl buffer.ptr
+-- Memory Statistics
+-- Buffer counters from the C memory pools (bytes include 64-byte padding)
+
+/-- Allocations made by one subsystem -/
+structure MemorySubsystemStats where
+  allocations : UInt64
+  bytesLive : UInt64
+  deriving Repr, Inhabited
+
+structure MemoryStats where
+  bytesAllocated : UInt64
+  bytesLive : UInt64
+  peakBytesLive : UInt64
+  allocations : UInt64
+  liveAllocations : UInt64
+  builders : MemorySubsystemStats
+  compute : MemorySubsystemStats
+  parquet : MemorySubsystemStats
+  ipc : MemorySubsystemStats
+  other : MemorySubsystemStats
+  deriving Repr, Inhabited
+
+@[extern "lean_arrow_memory_stats"]
+opaque arrow_memory_stats_impl (scope: UInt8) : IO (Array UInt64)
+
+private def MemoryStats.ofCounters (c: Array UInt64) : MemoryStats :=
+  let subsystem (i : Nat) : MemorySubsystemStats :=
+    { allocations := c[5 + 2 * i]!, bytesLive := c[6 + 2 * i]! }
+  { bytesAllocated := c[0]!, bytesLive := c[1]!, peakBytesLive := c[2]!,
+    allocations := c[3]!, liveAllocations := c[4]!,
+    builders := subsystem 0, compute := subsystem 1, parquet := subsystem 2,
+    ipc := subsystem 3, other := subsystem 4 }
+
+/-- Counters across all memory pools -/
+def MemoryStats.global : IO MemoryStats :=
+  MemoryStats.ofCounters <$> arrow_memory_stats_impl 0
+
+/-- Counters for the pool new buffers on this thread come from -/
+def MemoryStats.currentPool : IO MemoryStats :=
+  MemoryStats.ofCounters <$> arrow_memory_stats_impl 1
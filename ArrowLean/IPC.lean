@@ -67,16 +67,115 @@ opaque deserializeArrayRaw : @& ByteArray → @& ArrowSchemaPtr.type → IO (Opt
 @[extern "lean_arrow_ipc_serialize_batch"]
 opaque serializeBatchRaw : @& ArrowSchemaPtr.type → @& ArrowArrayPtr.type → IO ByteArray
 
+/-- Serialize a record batch, compressing each buffer with the given codec -/
+@[extern "lean_arrow_ipc_serialize_batch_compressed"]
+opaque serializeBatchCompressedRaw : @& ArrowSchemaPtr.type → @& ArrowArrayPtr.type → UInt8 → UInt64 → IO ByteArray
+
 /-- Deserialize binary data to a record batch -/
 @[extern "lean_arrow_ipc_deserialize_batch"]
 opaque deserializeBatchRaw : @& ByteArray → IO (Option (ArrowSchemaPtr.type × ArrowArrayPtr.type))
 
+/-- Deserialize binary data to a record batch whose buffers alias the ByteArray -/
+@[extern "lean_arrow_ipc_deserialize_batch_zero_copy"]
+opaque deserializeBatchZeroCopyRaw : @& ByteArray → IO (Option (ArrowSchemaPtr.type × ArrowArrayPtr.type))
+
 /-- Get the serialized size of a batch without full serialization -/
 @[extern "lean_arrow_ipc_batch_size"]
 opaque batchSerializedSizeRaw : @& ArrowSchemaPtr.type → @& ArrowArrayPtr.type → IO UInt64
 
+/-- Fingerprint of a schema, referenced by schema-elided batches -/
+@[extern "lean_arrow_ipc_schema_fingerprint"]
+opaque schemaFingerprintRaw : @& ArrowSchemaPtr.type → IO UInt64
+
+/-- Serialize a record batch without its schema, referencing it by fingerprint -/
+@[extern "lean_arrow_ipc_serialize_batch_ref"]
+opaque serializeBatchRefRaw : @& ArrowSchemaPtr.type → @& ArrowArrayPtr.type → UInt8 → IO ByteArray
+
+/-- Schema fingerprint of a schema-elided batch -/
+@[extern "lean_arrow_ipc_batch_ref_fingerprint"]
+opaque batchRefFingerprintRaw : @& ByteArray → IO (Option UInt64)
+
+/-- Deserialize a schema-elided batch against its schema (copying, or aliasing the ByteArray) -/
+@[extern "lean_arrow_ipc_deserialize_batch_ref"]
+opaque deserializeBatchRefRaw : @& ByteArray → @& ArrowSchemaPtr.type → UInt8 → IO (Option ArrowArrayPtr.type)
+
+/-- Write a stream's batches in Arrow IPC stream (0) or file (1) format -/
+@[extern "lean_arrow_ipc_write_stream"]
+opaque writeStreamRaw : @& ArrowArrayStreamPtr.type → UInt8 → UInt8 → IO ByteArray
+
+/-- Write a stream's batches to an Arrow IPC stream or file on disk -/
+@[extern "lean_arrow_ipc_write_stream_path"]
+opaque writeStreamPathRaw : @& ArrowArrayStreamPtr.type → UInt8 → UInt8 → @& String → IO Unit
+
+/-- Open Arrow IPC stream or file bytes as a stream aliasing the ByteArray -/
+@[extern "lean_arrow_ipc_read_stream"]
+opaque readStreamRaw : @& ByteArray → IO (Option ArrowArrayStreamPtr.type)
+
+/-- Open an Arrow IPC stream or file on disk -/
+@[extern "lean_arrow_ipc_read_stream_path"]
+opaque readStreamPathRaw : @& String → IO (Option ArrowArrayStreamPtr.type)
+
+/-- Write a stream's batches to a file descriptor or pipe -/
+@[extern "lean_arrow_ipc_write_stream_fd"]
+opaque writeStreamFdRaw : @& ArrowArrayStreamPtr.type → UInt8 → UInt8 → UInt32 → IO Unit
+
+/-- Read Arrow IPC messages incrementally from a file descriptor or pipe -/
+@[extern "lean_arrow_ipc_read_stream_fd"]
+opaque readStreamFdRaw : UInt32 → IO (Option ArrowArrayStreamPtr.type)
+
+/-- Opaque handles for the memory-mapped batch file -/
+opaque IPCBatchFileWriterPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
+opaque IPCBatchFileReaderPtr : NonemptyType := ⟨Unit, ⟨()⟩⟩
+
+instance : Nonempty IPCBatchFileWriterPtr.type := IPCBatchFileWriterPtr.property
+instance : Nonempty IPCBatchFileReaderPtr.type := IPCBatchFileReaderPtr.property
+
+/-- Create a batch file, compressing buffers with the given codec -/
+@[extern "lean_arrow_ipc_batch_file_writer_open"]
+opaque batchFileWriterOpenRaw : @& String → UInt8 → IO (Option IPCBatchFileWriterPtr.type)
+
+/-- Append a record batch to a batch file -/
+@[extern "lean_arrow_ipc_batch_file_writer_append"]
+opaque batchFileWriterAppendRaw : @& IPCBatchFileWriterPtr.type → @& ArrowSchemaPtr.type → @& ArrowArrayPtr.type → IO Unit
+
+/-- Write the batch index and close the file -/
+@[extern "lean_arrow_ipc_batch_file_writer_close"]
+opaque batchFileWriterCloseRaw : @& IPCBatchFileWriterPtr.type → IO Unit
+
+/-- Memory-map a batch file -/
+@[extern "lean_arrow_ipc_batch_file_reader_open"]
+opaque batchFileReaderOpenRaw : @& String → IO (Option IPCBatchFileReaderPtr.type)
+
+/-- Number of batches in a batch file -/
+@[extern "lean_arrow_ipc_batch_file_reader_num_batches"]
+opaque batchFileReaderNumBatchesRaw : @& IPCBatchFileReaderPtr.type → IO UInt64
+
+/-- Row count of one batch, from the index -/
+@[extern "lean_arrow_ipc_batch_file_reader_batch_rows"]
+opaque batchFileReaderBatchRowsRaw : @& IPCBatchFileReaderPtr.type → UInt64 → IO UInt64
+
+/-- Read one batch without copying its buffers -/
+@[extern "lean_arrow_ipc_batch_file_reader_read"]
+opaque batchFileReaderReadRaw : @& IPCBatchFileReaderPtr.type → UInt64 → IO (Option (ArrowSchemaPtr.type × ArrowArrayPtr.type))
+
+/-- Unmap a batch file (batches already read stay valid) -/
+@[extern "lean_arrow_ipc_batch_file_reader_close"]
+opaque batchFileReaderCloseRaw : @& IPCBatchFileReaderPtr.type → IO Unit
+
 /-! ## High-Level API -/
 
+/-- Per-buffer compression codec -/
+inductive IPCCompression
+| none
+| lz4Frame  -- Fast
+| zstd      -- Better ratio
+deriving Nonempty
+
+def IPCCompression.toUInt8 : IPCCompression → UInt8
+| .none => 0
+| .lz4Frame => 1
+| .zstd => 2
+
 /-- Serialize an ArrowSchema to binary format -/
 def serializeSchema (schema : ArrowSchema) : IO ByteArray :=
   serializeSchemaRaw schema.ptr
@@ -120,36 +219,208 @@ def deserializeArray (data : ByteArray) (schema : ArrowSchema) : IO (Option Arro
 def serialize (batch : RecordBatch) : IO ByteArray :=
   serializeBatchRaw batch.schema.ptr batch.array.ptr
 
+/-- Serialize a RecordBatch with per-buffer compression. Buffers under
+    `minSize` bytes, or that do not shrink, are stored uncompressed.
+    `deserialize` reads the result like any other blob. -/
+def serializeCompressed (batch : RecordBatch) (codec : IPCCompression := .zstd)
+    (minSize : UInt64 := 1024) : IO ByteArray :=
+  serializeBatchCompressedRaw batch.schema.ptr batch.array.ptr codec.toUInt8 minSize
+
+/-- Wrap raw schema/array pointers returned by the deserializers -/
+private def mkBatch (schemaPtr : ArrowSchemaPtr.type) (arrayPtr : ArrowArrayPtr.type) : IO RecordBatch := do
+  -- Build schema
+  let format ← arrow_schema_get_format_impl schemaPtr
+  let name ← arrow_schema_get_name_impl schemaPtr
+  let flags ← arrow_schema_get_flags_impl schemaPtr
+  let schema : ArrowSchema := {
+    ptr := schemaPtr
+    format := format
+    name := name
+    flags := flags
+  }
+  -- Build array
+  let length ← arrow_array_get_length_impl arrayPtr
+  let nullCount ← arrow_array_get_null_count_impl arrayPtr
+  let offset ← arrow_array_get_offset_impl arrayPtr
+  let array : ArrowArray := {
+    ptr := arrayPtr
+    length := length
+    null_count := nullCount
+    offset := offset
+  }
+  return { schema := schema, array := array }
+
 /-- Deserialize binary data to a RecordBatch -/
 def deserialize (data : ByteArray) : IO (Option RecordBatch) := do
   match ← deserializeBatchRaw data with
   | none => return none
-  | some (schemaPtr, arrayPtr) =>
-    -- Build schema
-    let format ← arrow_schema_get_format_impl schemaPtr
-    let name ← arrow_schema_get_name_impl schemaPtr
-    let flags ← arrow_schema_get_flags_impl schemaPtr
-    let schema : ArrowSchema := {
-      ptr := schemaPtr
-      format := format
-      name := name
-      flags := flags
-    }
-    -- Build array
-    let length ← arrow_array_get_length_impl arrayPtr
-    let nullCount ← arrow_array_get_null_count_impl arrayPtr
-    let offset ← arrow_array_get_offset_impl arrayPtr
-    let array : ArrowArray := {
-      ptr := arrayPtr
+  | some (schemaPtr, arrayPtr) => return some (← mkBatch schemaPtr arrayPtr)
+
+/-- Deserialize binary data to a RecordBatch without copying buffer data.
+    The batch keeps `data` alive until it is released; cost is O(#buffers). -/
+def deserializeZeroCopy (data : ByteArray) : IO (Option RecordBatch) := do
+  match ← deserializeBatchZeroCopyRaw data with
+  | none => return none
+  | some (schemaPtr, arrayPtr) => return some (← mkBatch schemaPtr arrayPtr)
+
+/-- Get the serialized size of a RecordBatch -/
+def serializedSize (batch : RecordBatch) : IO UInt64 :=
+  batchSerializedSizeRaw batch.schema.ptr batch.array.ptr
+
+/-! ## Schema References
+
+Batches that share a schema do not need to carry it. `serializeRef` writes
+only the data and a 64-bit schema fingerprint; the application stores the
+schema once (e.g. `serializeSchema` under its fingerprint) and passes it
+back to `deserializeRef`.
+-/
+
+/-- Fingerprint of a schema: equal schemas have equal fingerprints -/
+def schemaFingerprint (schema : ArrowSchema) : IO UInt64 :=
+  schemaFingerprintRaw schema.ptr
+
+/-- Serialize a RecordBatch without its schema -/
+def serializeRef (batch : RecordBatch) (codec : IPCCompression := .none) : IO ByteArray :=
+  serializeBatchRefRaw batch.schema.ptr batch.array.ptr codec.toUInt8
+
+/-- Fingerprint of the schema a `serializeRef` blob was written with -/
+def refFingerprint (data : ByteArray) : IO (Option UInt64) :=
+  batchRefFingerprintRaw data
+
+/-- Deserialize a `serializeRef` blob. Returns `none` if `schema` is not the
+    schema it was written with. With `zeroCopy` the array aliases `data`. -/
+def deserializeRef (data : ByteArray) (schema : ArrowSchema) (zeroCopy : Bool := true) :
+    IO (Option ArrowArray) := do
+  match ← deserializeBatchRefRaw data schema.ptr (if zeroCopy then 1 else 0) with
+  | none => return none
+  | some ptr =>
+    let length ← arrow_array_get_length_impl ptr
+    let nullCount ← arrow_array_get_null_count_impl ptr
+    let offset ← arrow_array_get_offset_impl ptr
+    return some {
+      ptr := ptr
       length := length
       null_count := nullCount
       offset := offset
     }
-    return some { schema := schema, array := array }
 
-/-- Get the serialized size of a RecordBatch -/
-def serializedSize (batch : RecordBatch) : IO UInt64 :=
-  batchSerializedSizeRaw batch.schema.ptr batch.array.ptr
+/-! ## Standard Arrow IPC Format
+
+Unlike the compact format above, these read and write the Arrow IPC
+streaming and file formats, so data can be exchanged with pyarrow, DuckDB
+and other Arrow implementations.
+-/
+
+/-- Arrow IPC framing: a message stream, or the random-access file format -/
+inductive IPCFormat
+| stream
+| file
+deriving Nonempty
+
+def IPCFormat.toUInt8 : IPCFormat → UInt8
+| .stream => 0
+| .file => 1
+
+/-- Write every batch of `stream` as Arrow IPC bytes. The stream is consumed. -/
+def writeStream (stream : ArrowArrayStream) (format : IPCFormat := .stream)
+    (codec : IPCCompression := .none) : IO ByteArray :=
+  writeStreamRaw stream.ptr format.toUInt8 codec.toUInt8
+
+/-- Write every batch of `stream` to an Arrow IPC file (`.arrow`) or stream (`.arrows`) -/
+def writeStreamToFile (stream : ArrowArrayStream) (path : String) (format : IPCFormat := .file)
+    (codec : IPCCompression := .none) : IO Unit :=
+  writeStreamPathRaw stream.ptr format.toUInt8 codec.toUInt8 path
+
+/-- Read Arrow IPC bytes (either format) as a stream. Batches alias `data`. -/
+def readStream (data : ByteArray) : IO (Option ArrowArrayStream) := do
+  match ← readStreamRaw data with
+  | none => return none
+  | some ptr => return some { ptr := ptr }
+
+/-- Read an Arrow IPC file or stream from disk -/
+def readStreamFromFile (path : String) : IO (Option ArrowArrayStream) := do
+  match ← readStreamPathRaw path with
+  | none => return none
+  | some ptr => return some { ptr := ptr }
+
+/-- Write every batch of `stream` to a file descriptor or pipe (e.g. 1 for
+    stdout). Each message is written with one `writev`; the descriptor is
+    not closed. -/
+def writeStreamToFd (stream : ArrowArrayStream) (fd : UInt32) (format : IPCFormat := .stream)
+    (codec : IPCCompression := .none) : IO Unit :=
+  writeStreamFdRaw stream.ptr format.toUInt8 codec.toUInt8 fd
+
+/-- Read Arrow IPC data from a file descriptor or pipe (e.g. 0 for stdin).
+    Batches are read as the stream is consumed, so memory stays bounded by
+    the batches still alive. The descriptor must stay open until the stream
+    is released. -/
+def readStreamFromFd (fd : UInt32) : IO (Option ArrowArrayStream) := do
+  match ← readStreamFdRaw fd with
+  | none => return none
+  | some ptr => return some { ptr := ptr }
+
+/-! ## Memory-Mapped Batch File
+
+A local spill/cache format: record batches appended to one file, followed by
+an index of batch offsets and row counts. Opening maps the file and reads
+only the trailer, and every batch is then available in O(1) with its
+buffers aliasing the mapping.
+-/
+
+/-- Appends record batches to a batch file -/
+structure BatchFileWriter where
+  ptr : IPCBatchFileWriterPtr.type
+
+/-- Random access to the batches of a mapped batch file -/
+structure BatchFileReader where
+  ptr : IPCBatchFileReaderPtr.type
+
+namespace BatchFileWriter
+
+/-- Create (or truncate) a batch file -/
+def «open» (path : String) (codec : IPCCompression := .none) : IO (Option BatchFileWriter) := do
+  match ← batchFileWriterOpenRaw path codec.toUInt8 with
+  | none => return none
+  | some ptr => return some { ptr := ptr }
+
+/-- Append a record batch -/
+def append (writer : BatchFileWriter) (batch : RecordBatch) : IO Unit :=
+  batchFileWriterAppendRaw writer.ptr batch.schema.ptr batch.array.ptr
+
+/-- Write the index and close the file. The writer cannot be used afterwards. -/
+def close (writer : BatchFileWriter) : IO Unit :=
+  batchFileWriterCloseRaw writer.ptr
+
+end BatchFileWriter
+
+namespace BatchFileReader
+
+/-- Map a batch file written by `BatchFileWriter` -/
+def «open» (path : String) : IO (Option BatchFileReader) := do
+  match ← batchFileReaderOpenRaw path with
+  | none => return none
+  | some ptr => return some { ptr := ptr }
+
+/-- Number of batches in the file -/
+def numBatches (reader : BatchFileReader) : IO UInt64 :=
+  batchFileReaderNumBatchesRaw reader.ptr
+
+/-- Row count of batch `i`, without reading it -/
+def batchRows (reader : BatchFileReader) (i : UInt64) : IO UInt64 :=
+  batchFileReaderBatchRowsRaw reader.ptr i
+
+/-- Read batch `i`. Its buffers alias the mapping, which stays alive until
+    the batch is released, even after the reader is closed. -/
+def read (reader : BatchFileReader) (i : UInt64) : IO (Option RecordBatch) := do
+  match ← batchFileReaderReadRaw reader.ptr i with
+  | none => return none
+  | some (schemaPtr, arrayPtr) => return some (← mkBatch schemaPtr arrayPtr)
+
+/-- Unmap the file. The reader cannot be used afterwards. -/
+def close (reader : BatchFileReader) : IO Unit :=
+  batchFileReaderCloseRaw reader.ptr
+
+end BatchFileReader
 
 /-! ## Convenience Functions -/
 
@@ -169,7 +440,7 @@ The IPC format uses the following structure:
 **RecordBatch:**
 ```
 [4 bytes] Magic: "ARRB" (0x42525241)
-[4 bytes] Version: 1
+[4 bytes] Version: 2 (version 1 blobs are still readable)
 [... schema data ...]
 [... array data ...]
 ```
@@ -189,12 +460,37 @@ The IPC format uses the following structure:
 ```
 [8 bytes] Length
 [8 bytes] Null count
-[8 bytes] Offset
+[8 bytes] Offset (always 0: slices are written as their referenced range)
 [8 bytes] Number of buffers
 [8 bytes] Number of children
-[... for each buffer: size + data ...]
+[... for each buffer: size + padding + data ...]
 [... child arrays recursively ...]
 ```
+
+Each non-empty buffer is preceded by zero padding so that its data starts on
+a 64-byte boundary relative to the start of the blob. `serialize` computes
+the exact size up front and writes directly into the result `ByteArray`.
+
+`serializeCompressed` writes version 3: the version is followed by a 4-byte
+codec id (1 = LZ4 frame, 2 = ZSTD), and every non-empty buffer's size is
+followed by its uncompressed length (-1 when stored as is) before the
+padding.
+
+`serializeRef` writes version 4: the version is followed by a 4-byte codec
+id (0 = uncompressed) and the 8-byte schema fingerprint instead of the
+schema data; buffers are laid out as in version 2 or 3.
+
+**Batch file** (`BatchFileWriter` / `BatchFileReader`):
+```
+[8 bytes]  Magic: "ARRBFILE"
+[4 bytes]  Version: 1
+[52 bytes] Padding
+[... RecordBatch blobs, each 64-byte aligned in the file ...]
+[24 bytes per batch] Offset, size, row count
+[8 bytes]  Index offset
+[8 bytes]  Number of batches
+[8 bytes]  Magic: "ARRBFILE"
+```
 -/
 
 end ArrowLean.IPC
@@ -7,6 +7,7 @@
 
 import ArrowLean.Ops
 import ArrowLean.FFI
+import ArrowLean.Compute
 import ArrowLean.Utils
 import ArrowLean.Error
 import Std.Data.HashMap
@@ -117,6 +118,26 @@ def getBoolAt (row : Nat) : ArrowM (Option Bool) := do
     throw (Error.indexOutOfBounds row len)
   liftIOExcept (ctx.array.getBool row.toUSize) Error.fromIOError
 
+/-! ## Bulk Column Access
+
+Whole-column reads in a single FFI call, for loops that would otherwise
+call a `get*At` per row. -/
+
+/-- All Int64 values of the column -/
+def int64Column : ArrowM (Array (Option Int64)) := do
+  let ctx ← read
+  liftIOExcept ctx.array.toInt64Options Error.fromIOError
+
+/-- All Float64 values of the column -/
+def float64Column : ArrowM (Array (Option Float)) := do
+  let ctx ← read
+  liftIOExcept ctx.array.toFloat64Options Error.fromIOError
+
+/-- All string values of a `u` column -/
+def stringColumn : ArrowM (Array (Option String)) := do
+  let ctx ← read
+  liftIOExcept ctx.array.toStrings Error.fromIOError
+
 /-! ## Iteration -/
 
 /-- Iterate over all rows, collecting results -/
@@ -157,17 +178,11 @@ def filterRowIndices (pred : Nat → ArrowM Bool) : ArrowM (Array Nat) := do
 
 /-- Sum all non-null Int64 values -/
 def sumInt64 : ArrowM Int64 := do
-  foldRows 0 fun acc i => do
-    match ← getInt64At i with
-    | some v => return acc + v
-    | none => return acc
+  return (← int64Column).foldl (fun acc v => acc + v.getD 0) 0
 
 /-- Sum all non-null Float64 values -/
 def sumFloat64 : ArrowM Float := do
-  foldRows 0.0 fun acc i => do
-    match ← getFloat64At i with
-    | some v => return acc + v
-    | none => return acc
+  return (← float64Column).foldl (fun acc v => acc + v.getD 0.0) 0.0
 
 /-- Count non-null values -/
 def countNonNull (getValue : Nat → ArrowM (Option α)) : ArrowM Nat := do
@@ -178,10 +193,10 @@ def countNonNull (getValue : Nat → ArrowM (Option α)) : ArrowM Nat := do
 
 /-- Average of non-null Float64 values -/
 def avgFloat64 : ArrowM (Option Float) := do
-  let (sum, count) ← foldRows (0.0, 0) fun (s, c) i => do
-    match ← getFloat64At i with
-    | some v => return (s + v, c + 1)
-    | none => return (s, c)
+  let (sum, count) := (← float64Column).foldl (init := (0.0, 0)) fun (s, c) v =>
+    match v with
+    | some x => (s + x, c + 1)
+    | none => (s, c)
   if count == 0 then
     return none
   else
@@ -315,8 +330,12 @@ def ArrowIO.firstSuccess (actions : Array (ArrowIO α)) : ArrowIO α := do
     | .error e => lastError := e
   throw lastError
 
-/-- Run actions in parallel (simplified - actually runs sequentially) -/
-def ArrowIO.parallel (actions : Array (ArrowIO α)) : ArrowIO (Array α) :=
-  ArrowIO.sequence actions
+/-- Run actions in parallel on the thread pool. Unlike `sequence`, every
+    action runs; the first error in array order is rethrown. -/
+def ArrowIO.parallel (actions : Array (ArrowIO α)) : ArrowIO (Array α) := do
+  let results ← ArrowIO.liftIO (Compute.parallelIO (actions.map ExceptT.run))
+  results.mapM fun
+    | .ok a => pure a
+    | .error e => throw e
 
 end ArrowLean
@@ -14,22 +14,24 @@ class ToArrowColumn (α : Type) where
   arrowFormat : String
   /-- Convert an array of values to an Arrow array -/
   toColumn : Array α → IO (Option ArrowArray)
+  /-- Whether the column can hold nulls -/
+  nullable : Bool := false
 
 instance : ToArrowColumn Int64 where
   arrowFormat := "l"  -- int64
-  toColumn := buildInt64Column
+  toColumn values := buildInt64Column values
 
 instance : ToArrowColumn Float where
   arrowFormat := "g"  -- float64
-  toColumn := buildFloat64Column
+  toColumn values := buildFloat64Column values
 
 instance : ToArrowColumn String where
   arrowFormat := "u"  -- utf8 string
-  toColumn := buildStringColumn
+  toColumn values := buildStringColumn values
 
 instance : ToArrowColumn Bool where
   arrowFormat := "b"  -- boolean
-  toColumn := buildBoolColumn
+  toColumn values := buildBoolColumn values
 
 -- Nat as Int64
 instance : ToArrowColumn Nat where
@@ -39,42 +41,42 @@ instance : ToArrowColumn Nat where
 -- UInt64 (native support)
 instance : ToArrowColumn UInt64 where
   arrowFormat := "L"  -- uint64
-  toColumn := buildUInt64Column
+  toColumn values := buildUInt64Column values
 
 -- Int8
 instance : ToArrowColumn Int8 where
   arrowFormat := "c"  -- int8
-  toColumn := buildInt8Column
+  toColumn values := buildInt8Column values
 
 -- Int16
 instance : ToArrowColumn Int16 where
   arrowFormat := "s"  -- int16
-  toColumn := buildInt16Column
+  toColumn values := buildInt16Column values
 
 -- Int32
 instance : ToArrowColumn Int32 where
   arrowFormat := "i"  -- int32
-  toColumn := buildInt32Column
+  toColumn values := buildInt32Column values
 
 -- UInt8
 instance : ToArrowColumn UInt8 where
   arrowFormat := "C"  -- uint8
-  toColumn := buildUInt8Column
+  toColumn values := buildUInt8Column values
 
 -- UInt16
 instance : ToArrowColumn UInt16 where
   arrowFormat := "S"  -- uint16
-  toColumn := buildUInt16Column
+  toColumn values := buildUInt16Column values
 
 -- UInt32
 instance : ToArrowColumn UInt32 where
   arrowFormat := "I"  -- uint32
-  toColumn := buildUInt32Column
+  toColumn values := buildUInt32Column values
 
 -- ByteArray as Binary
 instance : ToArrowColumn ByteArray where
   arrowFormat := "z"  -- binary
-  toColumn := buildBinaryColumn
+  toColumn values := buildBinaryColumn values
 
 -- ============================================================================
 -- ColumnSpec: Describe a column in a schema
@@ -235,6 +237,52 @@ def buildSchemaFromSpecs (specs : Array ColumnSpec) : IO (Option ArrowSchema) :=
     sb.finish
   | none => return none
 
+-- ============================================================================
+-- One-pass record transposition
+-- ============================================================================
+
+/-- A column being filled from records, one row at a time -/
+structure FieldSink (α : Type) where
+  push : α → IO Unit
+  finish : IO (Option ArrowArray)
+
+/-- A record field that becomes one column of the batch -/
+structure FieldColumn (α : Type) where
+  spec : ColumnSpec
+  /-- Start an empty column with room for `n` rows -/
+  sink : Nat → IO (FieldSink α)
+
+/-- Column for the field read by `get`, typed by its `ToArrowColumn` instance -/
+def FieldColumn.of [ToArrowColumn β] (name : String) (get : α → β) : FieldColumn α where
+  spec := { name, format := ToArrowColumn.arrowFormat (α := β), nullable := ToArrowColumn.nullable (α := β) }
+  sink n := do
+    let values ← IO.mkRef (Array.mkEmpty (α := β) n)
+    return {
+      push := fun record => values.modify (·.push (get record))
+      finish := do ToArrowColumn.toColumn (← values.get)
+    }
+
+/-- Transpose records into columns in a single pass: every column buffer is
+    sized for `records.size` up front, each record is visited once, and each
+    column is then built with one FFI call -/
+def transposeRecords (fields : Array (FieldColumn α)) (records : Array α) : IO (Option (Array ArrowArray)) := do
+  let sinks ← fields.mapM (·.sink records.size)
+  for record in records do
+    for sink in sinks do
+      sink.push record
+  let mut columns := Array.mkEmpty sinks.size
+  for sink in sinks do
+    match ← sink.finish with
+    | some column => columns := columns.push column
+    | none => return none
+  return some columns
+
+/-- `ToArrowBatch` instance from a list of field columns
+    (`deriving ToArrowBatch` generates one per structure field) -/
+def ToArrowBatch.ofFields (fields : Array (FieldColumn α)) : ToArrowBatch α where
+  columnSpecs := fields.map (·.spec)
+  buildColumns := transposeRecords fields
+
 /-- Convert an array of records to a RecordBatch -/
 def toRecordBatch [ToArrowBatch α] (records : Array α) : IO (Option RecordBatch) := do
   -- Build schema
@@ -322,54 +370,61 @@ def projectOptColumn (α β : Type) (records : Array α) (f : α → Option β)
 
 /-- Build an Int64 column with optional values -/
 def buildOptInt64Column (values : Array (Option Int64)) : IO (Option ArrowArray) := do
-  match ← Int64Builder.create values.size.toUSize with
-  | some builder =>
-    for v in values do
-      let _ ← builder.appendOption v
-    builder.finish
-  | none => return none
+  columnOfPtr (← build_opt_int64_column_impl values)
 
 /-- Build a Float64 column with optional values -/
 def buildOptFloat64Column (values : Array (Option Float)) : IO (Option ArrowArray) := do
-  match ← Float64Builder.create values.size.toUSize with
-  | some builder =>
-    for v in values do
-      let _ ← builder.appendOption v
-    builder.finish
-  | none => return none
+  columnOfPtr (← build_opt_float64_column_impl values)
 
 /-- Build a String column with optional values -/
 def buildOptStringColumn (values : Array (Option String)) : IO (Option ArrowArray) := do
-  match ← StringBuilder.create values.size.toUSize with
-  | some builder =>
-    for v in values do
-      let _ ← builder.appendOption v
-    builder.finish
-  | none => return none
+  columnOfPtr (← build_opt_string_column_impl values)
 
 /-- Build a Bool column with optional values -/
 def buildOptBoolColumn (values : Array (Option Bool)) : IO (Option ArrowArray) := do
-  match ← BoolBuilder.create values.size.toUSize with
-  | some builder =>
-    for v in values do
-      let _ ← builder.appendOption v
-    builder.finish
-  | none => return none
+  columnOfPtr (← build_opt_bool_column_impl values)
 
 /-- Build a Timestamp column with optional values -/
 def buildOptTimestampColumn (values : Array (Option Int64)) (timezone : String := "UTC") : IO (Option ArrowArray) := do
-  match ← TimestampBuilder.create values.size.toUSize timezone with
-  | some builder =>
-    for v in values do
-      let _ ← builder.appendOption v
-    builder.finish
-  | none => return none
+  columnOfPtr (← build_opt_timestamp_column_impl values timezone)
+
+instance : ToArrowColumn (Option Int64) where
+  arrowFormat := "l"
+  toColumn := buildOptInt64Column
+  nullable := true
+
+instance : ToArrowColumn (Option Float) where
+  arrowFormat := "g"
+  toColumn := buildOptFloat64Column
+  nullable := true
+
+instance : ToArrowColumn (Option String) where
+  arrowFormat := "u"
+  toColumn := buildOptStringColumn
+  nullable := true
+
+instance : ToArrowColumn (Option Bool) where
+  arrowFormat := "b"
+  toColumn := buildOptBoolColumn
+  nullable := true
 
 -- ============================================================================
 -- Example Usage Pattern
 -- ============================================================================
 
 /-
+Structures whose fields all have a `ToArrowColumn` instance can derive the
+batch instance (one column per field, named after it):
+
+import ArrowLean.Deriving
+
+structure Quote where
+  symbol : String
+  bid : Float
+  ask : Option Float
+  deriving ToArrowBatch
+
+For control over column types (e.g. timestamps), write it by hand.
 To use this with a custom type like Trade:
 
 structure Trade where
@@ -147,6 +147,104 @@ def free (builder : StringBuilder) : IO Unit :=
 
 end StringBuilder
 
+-- ============================================================================
+-- Large String Builder
+-- ============================================================================
+
+structure LargeStringBuilder where
+  ptr : LargeStringBuilderPtr.type
+
+namespace LargeStringBuilder
+
+def create (capacity : USize := 1024) (dataCapacity : USize := 8192) : IO (Option LargeStringBuilder) := do
+  match ← large_string_builder_create_impl capacity dataCapacity with
+  | some ptr => return some ⟨ptr⟩
+  | none => return none
+
+def append (builder : LargeStringBuilder) (value : String) : IO Bool :=
+  large_string_builder_append_impl builder.ptr value
+
+def appendNull (builder : LargeStringBuilder) : IO Bool :=
+  large_string_builder_append_null_impl builder.ptr
+
+def appendOption (builder : LargeStringBuilder) (value : Option String) : IO Bool := do
+  match value with
+  | some v => builder.append v
+  | none => builder.appendNull
+
+def appendAll (builder : LargeStringBuilder) (values : Array String) : IO Bool := do
+  for v in values do
+    let ok ← builder.append v
+    if !ok then return false
+  return true
+
+def length (builder : LargeStringBuilder) : IO USize :=
+  large_string_builder_length_impl builder.ptr
+
+def finish (builder : LargeStringBuilder) : IO (Option ArrowArray) := do
+  match ← large_string_builder_finish_impl builder.ptr with
+  | some ptr =>
+    let len ← arrow_array_get_length_impl ptr
+    let nullCount ← arrow_array_get_null_count_impl ptr
+    let offset ← arrow_array_get_offset_impl ptr
+    return some { ptr, length := len, null_count := nullCount, offset }
+  | none => return none
+
+def free (builder : LargeStringBuilder) : IO Unit :=
+  large_string_builder_free_impl builder.ptr
+
+end LargeStringBuilder
+
+-- ============================================================================
+-- String View Builder
+-- ============================================================================
+
+structure StringViewBuilder where
+  ptr : StringViewBuilderPtr.type
+
+namespace StringViewBuilder
+
+/-- Strings of up to 12 bytes are stored inline in their view; longer ones go
+    to data buffers of `blockSize` bytes (0: 32 KiB). -/
+def create (capacity : USize := 1024) (blockSize : USize := 0) : IO (Option StringViewBuilder) := do
+  match ← string_view_builder_create_impl capacity blockSize with
+  | some ptr => return some ⟨ptr⟩
+  | none => return none
+
+def append (builder : StringViewBuilder) (value : String) : IO Bool :=
+  string_view_builder_append_impl builder.ptr value
+
+def appendNull (builder : StringViewBuilder) : IO Bool :=
+  string_view_builder_append_null_impl builder.ptr
+
+def appendOption (builder : StringViewBuilder) (value : Option String) : IO Bool := do
+  match value with
+  | some v => builder.append v
+  | none => builder.appendNull
+
+def appendAll (builder : StringViewBuilder) (values : Array String) : IO Bool := do
+  for v in values do
+    let ok ← builder.append v
+    if !ok then return false
+  return true
+
+def length (builder : StringViewBuilder) : IO USize :=
+  string_view_builder_length_impl builder.ptr
+
+def finish (builder : StringViewBuilder) : IO (Option ArrowArray) := do
+  match ← string_view_builder_finish_impl builder.ptr with
+  | some ptr =>
+    let len ← arrow_array_get_length_impl ptr
+    let nullCount ← arrow_array_get_null_count_impl ptr
+    let offset ← arrow_array_get_offset_impl ptr
+    return some { ptr, length := len, null_count := nullCount, offset }
+  | none => return none
+
+def free (builder : StringViewBuilder) : IO Unit :=
+  string_view_builder_free_impl builder.ptr
+
+end StringViewBuilder
+
 -- ============================================================================
 -- Timestamp Builder
 -- ============================================================================
@@ -953,6 +1051,54 @@ def free (builder : BinaryBuilder) : IO Unit :=
 
 end BinaryBuilder
 
+-- ============================================================================
+-- Large Binary Builder
+-- ============================================================================
+
+structure LargeBinaryBuilder where
+  ptr : LargeBinaryBuilderPtr.type
+
+namespace LargeBinaryBuilder
+
+def create (capacity : USize := 1024) (dataCapacity : USize := 8192) : IO (Option LargeBinaryBuilder) := do
+  match ← large_binary_builder_create_impl capacity dataCapacity with
+  | some ptr => return some ⟨ptr⟩
+  | none => return none
+
+def append (builder : LargeBinaryBuilder) (value : ByteArray) : IO Bool :=
+  large_binary_builder_append_impl builder.ptr value
+
+def appendNull (builder : LargeBinaryBuilder) : IO Bool :=
+  large_binary_builder_append_null_impl builder.ptr
+
+def appendOption (builder : LargeBinaryBuilder) (value : Option ByteArray) : IO Bool := do
+  match value with
+  | some v => builder.append v
+  | none => builder.appendNull
+
+def appendAll (builder : LargeBinaryBuilder) (values : Array ByteArray) : IO Bool := do
+  for v in values do
+    let ok ← builder.append v
+    if !ok then return false
+  return true
+
+def length (builder : LargeBinaryBuilder) : IO USize :=
+  large_binary_builder_length_impl builder.ptr
+
+def finish (builder : LargeBinaryBuilder) : IO (Option ArrowArray) := do
+  match ← large_binary_builder_finish_impl builder.ptr with
+  | some ptr =>
+    let len ← arrow_array_get_length_impl ptr
+    let nullCount ← arrow_array_get_null_count_impl ptr
+    let offset ← arrow_array_get_offset_impl ptr
+    return some { ptr, length := len, null_count := nullCount, offset }
+  | none => return none
+
+def free (builder : LargeBinaryBuilder) : IO Unit :=
+  large_binary_builder_free_impl builder.ptr
+
+end LargeBinaryBuilder
+
 -- ============================================================================
 -- Schema Builder
 -- ============================================================================
@@ -1024,6 +1170,15 @@ def addDuration (builder : SchemaBuilder) (name : String) (unit : DurationUnit :
 def addBinary (builder : SchemaBuilder) (name : String) (nullable : Bool := true) : IO Bool :=
   schema_builder_add_binary_impl builder.ptr name (if nullable then 1 else 0)
 
+def addLargeString (builder : SchemaBuilder) (name : String) (nullable : Bool := true) : IO Bool :=
+  schema_builder_add_large_string_impl builder.ptr name (if nullable then 1 else 0)
+
+def addLargeBinary (builder : SchemaBuilder) (name : String) (nullable : Bool := true) : IO Bool :=
+  schema_builder_add_large_binary_impl builder.ptr name (if nullable then 1 else 0)
+
+def addStringView (builder : SchemaBuilder) (name : String) (nullable : Bool := true) : IO Bool :=
+  schema_builder_add_string_view_impl builder.ptr name (if nullable then 1 else 0)
+
 def fieldCount (builder : SchemaBuilder) : IO USize :=
   schema_builder_field_count_impl builder.ptr
 
@@ -1098,91 +1253,60 @@ def batchesToStream (schema : ArrowSchema) (batches : Array RecordBatch) : IO (O
 -- Convenience: Build columns from arrays
 -- ============================================================================
 
-def buildInt64Column (values : Array Int64) : IO (Option ArrowArray) := do
-  match ← Int64Builder.create values.size.toUSize with
-  | some builder =>
-    let _ ← builder.appendAll values
-    builder.finish
-  | none => return none
+-- Columns with a native constructor are built in a single FFI call. `validity`
+-- holds one byte per value (0 = null); leave it empty when every value is valid.
 
-def buildFloat64Column (values : Array Float) : IO (Option ArrowArray) := do
-  match ← Float64Builder.create values.size.toUSize with
-  | some builder =>
-    let _ ← builder.appendAll values
-    builder.finish
+def columnOfPtr : Option ArrowArrayPtr.type → IO (Option ArrowArray)
+  | some ptr => do
+    let len ← arrow_array_get_length_impl ptr
+    let nullCount ← arrow_array_get_null_count_impl ptr
+    let offset ← arrow_array_get_offset_impl ptr
+    return some { ptr, length := len, null_count := nullCount, offset }
   | none => return none
 
-def buildStringColumn (values : Array String) : IO (Option ArrowArray) := do
-  -- Estimate data capacity
-  let dataSize := values.foldl (fun acc s => acc + s.length) 0
-  match ← StringBuilder.create values.size.toUSize dataSize.toUSize with
-  | some builder =>
-    let _ ← builder.appendAll values
-    builder.finish
-  | none => return none
+def buildInt64Column (values : Array Int64) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_int64_column_impl values validity)
 
-def buildBoolColumn (values : Array Bool) : IO (Option ArrowArray) := do
-  match ← BoolBuilder.create values.size.toUSize with
-  | some builder =>
-    let _ ← builder.appendAll values
-    builder.finish
-  | none => return none
+def buildFloat64Column (values : Array Float) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_float64_column_impl values validity)
 
-def buildTimestampColumn (values : Array Int64) (timezone : String := "UTC") : IO (Option ArrowArray) := do
-  match ← TimestampBuilder.create values.size.toUSize timezone with
-  | some builder =>
-    let _ ← builder.appendAll values
-    builder.finish
-  | none => return none
+/-- Build a Float64 column straight from the unboxed storage of a `FloatArray` -/
+def buildFloat64ColumnOfFloatArray (values : FloatArray) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_float64_column_of_float_array_impl values validity)
 
-def buildInt8Column (values : Array Int8) : IO (Option ArrowArray) := do
-  match ← Int8Builder.create values.size.toUSize with
-  | some builder =>
-    let _ ← builder.appendAll values
-    builder.finish
-  | none => return none
+def buildStringColumn (values : Array String) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_string_column_impl values validity)
 
-def buildInt16Column (values : Array Int16) : IO (Option ArrowArray) := do
-  match ← Int16Builder.create values.size.toUSize with
-  | some builder =>
-    let _ ← builder.appendAll values
-    builder.finish
-  | none => return none
+def buildBoolColumn (values : Array Bool) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_bool_column_impl values validity)
 
-def buildInt32Column (values : Array Int32) : IO (Option ArrowArray) := do
-  match ← Int32Builder.create values.size.toUSize with
-  | some builder =>
-    let _ ← builder.appendAll values
-    builder.finish
-  | none => return none
+def buildTimestampColumn (values : Array Int64) (timezone : String := "UTC") (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_timestamp_column_impl values timezone validity)
 
-def buildUInt8Column (values : Array UInt8) : IO (Option ArrowArray) := do
-  match ← UInt8Builder.create values.size.toUSize with
-  | some builder =>
-    let _ ← builder.appendAll values
-    builder.finish
-  | none => return none
+def buildInt8Column (values : Array Int8) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_int8_column_impl values validity)
 
-def buildUInt16Column (values : Array UInt16) : IO (Option ArrowArray) := do
-  match ← UInt16Builder.create values.size.toUSize with
-  | some builder =>
-    let _ ← builder.appendAll values
-    builder.finish
-  | none => return none
+def buildInt16Column (values : Array Int16) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_int16_column_impl values validity)
 
-def buildUInt32Column (values : Array UInt32) : IO (Option ArrowArray) := do
-  match ← UInt32Builder.create values.size.toUSize with
-  | some builder =>
-    let _ ← builder.appendAll values
-    builder.finish
-  | none => return none
+def buildInt32Column (values : Array Int32) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_int32_column_impl values validity)
 
-def buildUInt64Column (values : Array UInt64) : IO (Option ArrowArray) := do
-  match ← UInt64Builder.create values.size.toUSize with
-  | some builder =>
-    let _ ← builder.appendAll values
-    builder.finish
-  | none => return none
+def buildUInt8Column (values : Array UInt8) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_uint8_column_impl values validity)
+
+/-- Build a UInt8 column straight from the bytes of a `ByteArray` -/
+def buildUInt8ColumnOfByteArray (values : ByteArray) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_uint8_column_of_byte_array_impl values validity)
+
+def buildUInt16Column (values : Array UInt16) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_uint16_column_impl values validity)
+
+def buildUInt32Column (values : Array UInt32) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_uint32_column_impl values validity)
+
+def buildUInt64Column (values : Array UInt64) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_uint64_column_impl values validity)
 
 def buildFloat32Column (values : Array Float) : IO (Option ArrowArray) := do
   match ← Float32Builder.create values.size.toUSize with
@@ -1226,13 +1350,8 @@ def buildDurationColumn (values : Array Int64) (unit : DurationUnit := .microsec
     builder.finish
   | none => return none
 
-def buildBinaryColumn (values : Array ByteArray) : IO (Option ArrowArray) := do
-  let dataSize := values.foldl (fun acc b => acc + b.size) 0
-  match ← BinaryBuilder.create values.size.toUSize dataSize.toUSize with
-  | some builder =>
-    let _ ← builder.appendAll values
-    builder.finish
-  | none => return none
+def buildBinaryColumn (values : Array ByteArray) (validity : ByteArray := .empty) : IO (Option ArrowArray) := do
+  columnOfPtr (← build_binary_column_impl values validity)
 
 -- ============================================================================
 -- List Builder (for List<T> arrays)
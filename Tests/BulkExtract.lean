@@ -0,0 +1,73 @@
+/-
+  Tests/BulkExtract.lean - Whole columns and ranges copied into Lean arrays
+  in one call, checked against the per-row getters
+-/
+
+import ArrowLean
+import Tests.Util
+
+namespace Tests.BulkExtract
+
+def rows : Nat := 300
+
+def stringAt (i : Nat) : Option String :=
+  if i % 7 == 0 then none else if i % 2 == 0 then some s!"short{i % 10}" else some s!"a longer string {i}"
+
+def testInt64Range : IO Unit := do
+  let values : Array (Option Int64) := (Array.range rows).map fun i =>
+    if i % 4 == 1 then none else some (i * 3).toInt64
+  let column ← expectSome (← buildOptInt64Column values) "int64 column"
+  check ((← column.toInt64Options) == values) "whole column"
+  let range ← column.toInt64Options 37 (some 100)
+  check (range == values.extract 37 137) "range"
+  for i in [37:137] do
+    check ((← column.getInt64 i.toUSize) == values[i]!) s!"getter row {i}"
+  let validity ← column.validityBytes 37 (some 100)
+  check (validity.data == (values.extract 37 137).map fun v => if v.isSome then (1 : UInt8) else 0) "validity bytes"
+  check ((← column.toInt64Options rows.toUSize (some 0)).size == 0) "empty range at the end"
+  let outOfRange ← (column.toInt64Options 250 (some 100)).toBaseIO
+  check (match outOfRange with | .error _ => true | .ok _ => false) "range past the end"
+  column.release
+
+def testFloatAndBytes : IO Unit := do
+  let floats : Array Float := (Array.range rows).map fun i => i.toFloat / 8
+  let column ← expectSome (← buildFloat64Column floats) "float64 column"
+  check ((← column.toFloatArray 10 (some 50)).data == floats.extract 10 60) "float range"
+  column.release
+
+  let bytes := ByteArray.mk ((Array.range rows).map fun i => (i % 256).toUInt8)
+  let uint8 ← expectSome (← buildUInt8ColumnOfByteArray bytes) "uint8 column"
+  check ((← uint8.toByteArray 5).data == bytes.data.extract 5 rows) "byte range to the end"
+  uint8.release
+
+def buildWith (create : IO (Option α)) (append : α → Option String → IO Bool)
+    (finish : α → IO (Option ArrowArray)) (free : α → IO Unit) : IO ArrowArray := do
+  let builder ← expectSome (← create) "builder"
+  for i in [0:rows] do
+    check (← append builder (stringAt i)) s!"append row {i}"
+  let column ← expectSome (← finish builder) "column"
+  free builder
+  return column
+
+def testStringLayouts : IO Unit := do
+  let expected := (Array.range rows).map stringAt
+  let utf8 ← expectSome (← buildOptStringColumn expected) "utf8 column"
+  let large ← buildWith (LargeStringBuilder.create 1024 8192) (·.appendOption ·) (·.finish) (·.free)
+  let view ← buildWith (StringViewBuilder.create 1024 0) (·.appendOption ·) (·.finish) (·.free)
+  check ((← utf8.toStrings) == expected) "utf8 strings"
+  check ((← large.toLargeStrings) == expected) "large strings"
+  check ((← view.toStringViews) == expected) "string views"
+  check ((← view.toStringViews 101 (some 57)) == expected.extract 101 158) "string view range"
+  for i in [101:158] do
+    check ((← view.getStringView i.toUSize) == expected[i]!) s!"view getter row {i}"
+  utf8.release
+  large.release
+  view.release
+
+def run : IO Unit := do
+  IO.println "Tests.BulkExtract"
+  runTest "testInt64Range" testInt64Range
+  runTest "testFloatAndBytes" testFloatAndBytes
+  runTest "testStringLayouts" testStringLayouts
+
+end Tests.BulkExtract
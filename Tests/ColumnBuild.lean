@@ -0,0 +1,90 @@
+/-
+  Tests/ColumnBuild.lean - Columns built from Lean arrays in one FFI call
+
+  Columns are longer than the native chunk (1024 values), so values are
+  unboxed over several chunks and the validity mask crosses chunk borders.
+-/
+
+import ArrowLean
+import Tests.Util
+
+namespace Tests.ColumnBuild
+
+def rows : Nat := 2500
+
+/-- Row `i` is null when `i % 5 == 2` (one byte per value, 0 = null) -/
+def mask (n : Nat) : ByteArray := Id.run do
+  let mut bytes := ByteArray.mkEmpty n
+  for i in [0:n] do
+    bytes := bytes.push (if i % 5 == 2 then 0 else 1)
+  return bytes
+
+def withNulls (values : Array α) : Array (Option α) :=
+  values.mapIdx fun i v => if i % 5 == 2 then none else some v
+
+def testInt64 : IO Unit := do
+  let values : Array Int64 := (Array.range rows).map fun i => (i * 1000003).toInt64 - 7
+  let column ← expectSome (← buildInt64Column values (mask rows)) "int64 column"
+  check (column.length == rows.toUInt64) "int64 length"
+  check (column.null_count == (rows / 5).toUInt64) "int64 null count"
+  check ((← column.toInt64Options) == withNulls values) "int64 values"
+  column.release
+
+  let dense ← expectSome (← buildInt64Column values) "dense int64 column"
+  check (dense.null_count == 0) "dense int64 null count"
+  check ((← dense.toInt64Options) == values.map some) "dense int64 values"
+  dense.release
+
+  let opt ← expectSome (← buildOptInt64Column (withNulls values)) "optional int64 column"
+  check ((← opt.toInt64Options) == withNulls values) "optional int64 values"
+  opt.release
+
+def testFloat64 : IO Unit := do
+  let values : Array Float := (Array.range rows).map fun i => i.toFloat * 0.25
+  let column ← expectSome (← buildFloat64Column values (mask rows)) "float64 column"
+  check ((← column.toFloat64Options) == withNulls values) "float64 values"
+  column.release
+
+  let unboxed ← expectSome (← buildFloat64ColumnOfFloatArray ⟨values⟩ (mask rows)) "FloatArray column"
+  check ((← unboxed.toFloat64Options) == withNulls values) "FloatArray values"
+  unboxed.release
+
+def testStrings : IO Unit := do
+  let values : Array String := (Array.range rows).map fun i =>
+    if i % 3 == 0 then "" else s!"value-{i}"
+  let column ← expectSome (← buildStringColumn values (mask rows)) "string column"
+  check (column.null_count == (rows / 5).toUInt64) "string null count"
+  check ((← column.toStrings) == withNulls values) "string values"
+  column.release
+
+  let opt ← expectSome (← buildOptStringColumn (withNulls values)) "optional string column"
+  check ((← opt.toStrings) == withNulls values) "optional string values"
+  opt.release
+
+def testBoolAndBytes : IO Unit := do
+  let bools : Array Bool := (Array.range rows).map fun i => i % 3 == 1
+  let column ← expectSome (← buildBoolColumn bools (mask rows)) "bool column"
+  for i in [0:rows] do
+    let expected := if i % 5 == 2 then none else some (i % 3 == 1)
+    check ((← column.getBool i.toUSize) == expected) s!"bool row {i}"
+  column.release
+
+  let bytes := ByteArray.mk ((Array.range rows).map fun i => (i % 251).toUInt8)
+  let uint8 ← expectSome (← buildUInt8ColumnOfByteArray bytes) "uint8 column"
+  check ((← uint8.toByteArray).data == bytes.data) "uint8 values"
+  uint8.release
+
+def testEmpty : IO Unit := do
+  let column ← expectSome (← buildInt64Column #[]) "empty column"
+  check (column.length == 0) "empty length"
+  column.release
+
+def run : IO Unit := do
+  IO.println "Tests.ColumnBuild"
+  runTest "testInt64" testInt64
+  runTest "testFloat64" testFloat64
+  runTest "testStrings" testStrings
+  runTest "testBoolAndBytes" testBoolAndBytes
+  runTest "testEmpty" testEmpty
+
+end Tests.ColumnBuild
@@ -0,0 +1,77 @@
+/-
+  Tests/DeriveBatch.lean - `deriving ToArrowBatch`: records transposed into
+  columns in one pass, then through a RecordBatch and the IPC format
+-/
+
+import ArrowLean
+import Tests.Util
+
+namespace Tests.DeriveBatch
+
+structure Quote where
+  symbol : String
+  bid : Float
+  ask : Option Float
+  size : Int64
+  venue : Option String
+  deriving ToArrowBatch
+
+def rows : Nat := 1500
+
+def quotes : Array Quote := (Array.range rows).map fun i => {
+  symbol := s!"SYM{i % 17}"
+  bid := i.toFloat / 4
+  ask := if i % 3 == 0 then none else some (i.toFloat / 4 + 0.5)
+  size := (i * 100).toInt64
+  venue := if i % 5 == 0 then none else some s!"V{i % 5}"
+}
+
+def testSpecs : IO Unit := do
+  let specs := ToArrowBatch.columnSpecs (α := Quote)
+  check (specs.map (·.name) == #["symbol", "bid", "ask", "size", "venue"]) "column names"
+  check (specs.map (·.format) == #["u", "g", "g", "l", "u"]) "column formats"
+  check (specs.map (·.nullable) == #[false, false, true, false, true]) "nullability"
+
+def checkColumns (array : ArrowArray) : IO Unit := do
+  check (array.length == rows.toUInt64) "row count"
+  let columns ← array.getChildren
+  check (columns.size == 5) "column count"
+  let column (i : Nat) : IO ArrowArray := expectSome columns[i]? s!"column {i}"
+  check ((← (← column 0).toStrings) == quotes.map (some ·.symbol)) "symbol"
+  check ((← (← column 1).toFloat64Options) == quotes.map (some ·.bid)) "bid"
+  check ((← (← column 2).toFloat64Options) == quotes.map (·.ask)) "ask"
+  check ((← (← column 3).toInt64Options) == quotes.map (some ·.size)) "size"
+  check ((← (← column 4).toStrings) == quotes.map (·.venue)) "venue"
+
+def testRecordBatch : IO Unit := do
+  let batch ← expectSome (← toRecordBatch quotes) "record batch"
+  check (batch.numRows == rows.toUSize) "batch rows"
+  check (batch.numColumns == 5) "batch columns"
+  -- The struct array takes over the batch's columns
+  let array ← expectSome (← batch.toStructArray) "struct array"
+  checkColumns array
+  array.release
+
+def testIPC : IO Unit := do
+  let bytes ← expectSome (← serializeRecordsToIPC quotes) "IPC bytes"
+  let batch ← expectSome (← ArrowLean.IPC.deserialize bytes) "deserialized batch"
+  check (batch.schema.format == "+s") "struct schema"
+  let fields ← batch.schema.getChildren
+  check (fields.map (·.name) == #["symbol", "bid", "ask", "size", "venue"].map some) "field names"
+  checkColumns batch.array
+  batch.release
+
+def testEmpty : IO Unit := do
+  let batch ← expectSome (← toRecordBatch (#[] : Array Quote)) "empty batch"
+  check (batch.numRows == 0) "no rows"
+  let array ← expectSome (← batch.toStructArray) "empty struct array"
+  array.release
+
+def run : IO Unit := do
+  IO.println "Tests.DeriveBatch"
+  runTest "testSpecs" testSpecs
+  runTest "testRecordBatch" testRecordBatch
+  runTest "testIPC" testIPC
+  runTest "testEmpty" testEmpty
+
+end Tests.DeriveBatch
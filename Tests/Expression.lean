@@ -0,0 +1,79 @@
+/-
+  Tests/Expression.lean - Fused expressions over a derived record batch,
+  checked row by row against the same arithmetic in Lean
+-/
+
+import ArrowLean
+import Tests.Util
+
+open ArrowLean
+
+namespace Tests.Expression
+
+structure Trade where
+  symbol : String
+  price : Option Float
+  qty : Int64
+  deriving ToArrowBatch
+
+-- Several 1024-row evaluation blocks and a ragged last one
+def rows : Nat := 4099
+
+def trades : Array Trade := (Array.range rows).map fun i => {
+  symbol := #["apple", "banana", "cherry"][i % 3]!
+  price := if i % 11 == 0 then none else some ((i % 97).toFloat * 0.5)
+  qty := ((i % 7).toInt64 - 3)
+}
+
+def bools (array : ArrowArray) : IO (Array (Option Bool)) :=
+  (Array.range rows).mapM fun i => array.getBool i.toUSize
+
+/-- Arithmetic and a comparison in one pass; a null price gives null -/
+def testArithmetic : IO Unit := do
+  let batch ← expectSome (← toRecordBatch trades) "record batch"
+  let expr := Expr.gt (.columnNamed "price" * .float64 2.0 + .column 2) (.float64 10.0)
+  let result ← expectSome (← expr.evaluateBatch batch) "evaluated"
+  check (result.length == rows.toUInt64) "row count"
+  let expected := trades.map fun t => t.price.map (· * 2.0 + Float.ofInt t.qty.toInt > 10.0)
+  check ((← bools result) == expected) "values and nulls"
+  result.release
+
+  -- Integer division by zero is null
+  let quotient ← expectSome (← (Expr.column 2 / .int64 2 + .column 2 / .column 2).evaluateBatch batch) "quotient"
+  let expected := trades.map fun t => if t.qty == 0 then none else some (t.qty / 2 + 1)
+  check ((← quotient.toInt64Options) == expected) "int64 division"
+  quotient.release
+  batch.free
+
+/-- String predicates and Kleene OR: true wins over null -/
+def testStringsAndLogic : IO Unit := do
+  let batch ← expectSome (← toRecordBatch trades) "record batch"
+  let expr := Expr.or ((Expr.column 0).startsWith "ba") (Expr.gt (.column 1) (.int64 40))
+  let result ← expectSome (← expr.evaluateBatch batch) "evaluated"
+  let expected := trades.map fun t =>
+    if t.symbol.startsWith "ba" then some true else t.price.map (· > 40.0)
+  check ((← bools result) == expected) "kleene or"
+  result.release
+
+  let apples := Expr.and (Expr.eq (.column 0) (.string "apple")) (Expr.not (Expr.isNull (.column 1)))
+  let result ← expectSome (← apples.evaluateBatch batch) "evaluated"
+  check (result.null_count == 0) "never null"
+  check ((← bools result) == trades.map fun t => some (t.symbol == "apple" && t.price.isSome)) "and"
+  result.release
+  batch.free
+
+/-- Ill-typed expressions and unknown columns evaluate to `none` -/
+def testTypeErrors : IO Unit := do
+  let batch ← expectSome (← toRecordBatch trades) "record batch"
+  for expr in [Expr.column 0 + .int64 1, Expr.column 3, Expr.columnNamed "missing",
+               (Expr.column 1).contains "x"] do
+    check ((← expr.evaluateBatch batch).isNone) "rejected"
+  batch.free
+
+def run : IO Unit := do
+  IO.println "Tests.Expression"
+  runTest "arithmetic" testArithmetic
+  runTest "stringsAndLogic" testStringsAndLogic
+  runTest "typeErrors" testTypeErrors
+
+end Tests.Expression
@@ -0,0 +1,17 @@
+-- Lean tests: `lake exe tests` (the C tests live in arrow/tests)
+
+import Tests.ColumnBuild
+import Tests.BulkExtract
+import Tests.DeriveBatch
+import Tests.MemoryStats
+import Tests.Parallel
+import Tests.Expression
+
+def main : IO UInt32 := do
+  Tests.ColumnBuild.run
+  Tests.BulkExtract.run
+  Tests.DeriveBatch.run
+  Tests.MemoryStats.run
+  Tests.Parallel.run
+  Tests.Expression.run
+  return 0
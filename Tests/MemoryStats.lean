@@ -0,0 +1,45 @@
+/-
+  Tests/MemoryStats.lean - Allocator counters seen from Lean
+-/
+
+import ArrowLean
+import Tests.Util
+
+namespace Tests.MemoryStats
+
+def rows : Nat := 3000
+
+/-- A built column is charged to the builders and released bytes come back -/
+def testBuilderColumn : IO Unit := do
+  let before ← MemoryStats.global
+  let values : Array Int64 := (Array.range rows).map (·.toInt64)
+  let column ← expectSome (← buildInt64Column values) "int64 column"
+
+  let during ← MemoryStats.global
+  check (during.builders.allocations > before.builders.allocations) "builder allocations counted"
+  check (during.builders.bytesLive ≥ before.builders.bytesLive + (rows * 8).toUInt64) "builder bytes live"
+  check (during.bytesAllocated > before.bytesAllocated) "bytes allocated grows"
+  check (during.peakBytesLive ≥ during.bytesLive) "peak covers live bytes"
+
+  column.release
+  let after ← MemoryStats.global
+  check (after.builders.bytesLive == before.builders.bytesLive) "builder bytes released"
+  check (after.liveAllocations == before.liveAllocations) "live allocations released"
+  check (after.bytesAllocated == during.bytesAllocated) "total is not reduced by releases"
+
+/-- Without a thread pool the current pool is the process default -/
+def testCurrentPool : IO Unit := do
+  let before ← MemoryStats.currentPool
+  let column ← expectSome (← buildInt64Column #[1, 2, 3]) "small column"
+  let during ← MemoryStats.currentPool
+  check (during.liveAllocations > before.liveAllocations) "current pool counts the column"
+  column.release
+  let after ← MemoryStats.currentPool
+  check (after.liveAllocations == before.liveAllocations) "current pool released"
+
+def run : IO Unit := do
+  IO.println "Tests.MemoryStats"
+  runTest "builderColumn" testBuilderColumn
+  runTest "currentPool" testCurrentPool
+
+end Tests.MemoryStats
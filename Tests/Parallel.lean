@@ -0,0 +1,79 @@
+/-
+  Tests/Parallel.lean - Kernels and IO actions on the native thread pool
+
+  Columns span several 64K-row morsels, so the parallel aggregates really
+  split their input.
+-/
+
+import ArrowLean
+import Tests.Util
+
+open ArrowLean
+
+namespace Tests.Parallel
+
+def rows : Nat := 200003
+
+def testThreadCount : IO Unit := do
+  Compute.setThreads 4
+  check ((← Compute.threads) == 4) "thread count"
+  Compute.setThreads 1
+  check ((← Compute.threads) == 1) "sequential"
+  Compute.setThreads 4
+
+def testAggregates : IO Unit := do
+  let values : Array Int64 := (Array.range rows).map fun i => ((i * 7919) % 100003).toInt64 - 50000
+  let ints ← expectSome (← buildInt64Column values) "int64 column"
+  check ((← Compute.parallelSumInt64 ints) == (← Compute.sumInt64 ints)) "sum"
+  check ((← Compute.parallelMinInt64 ints) == (← Compute.minInt64 ints)) "min"
+  check ((← Compute.parallelMaxInt64 ints) == (← Compute.maxInt64 ints)) "max"
+  let mean ← expectSome (← Compute.parallelMeanInt64 ints) "mean"
+  let expected ← expectSome (← Compute.meanInt64 ints) "sequential mean"
+  check ((mean - expected).abs < 1e-9) "mean"
+  ints.release
+
+/-- Float results are the same bits for every thread count -/
+def testDeterministicFloats : IO Unit := do
+  let values : Array Float := (Array.range rows).map fun i =>
+    1.0 / (i + 1).toFloat * (if i % 2 == 0 then 1e-3 else 1e10)
+  let floats ← expectSome (← buildFloat64Column values) "float64 column"
+  let mut sums : Array (Option Float) := #[]
+  let mut variances : Array (Option Float) := #[]
+  for threads in [1, 2, 4] do
+    Compute.setThreads threads
+    sums := sums.push (← Compute.parallelSumFloat64 floats)
+    variances := variances.push (← Compute.parallelVarianceFloat64 floats)
+  check (sums.all (· == sums[0]!)) "sum independent of threads"
+  check (variances.all (· == variances[0]!)) "variance independent of threads"
+  check (sums[0]!.isSome) "sum present"
+  floats.release
+
+def testParallelIO : IO Unit := do
+  let squares ← Compute.parallelIO ((Array.range 100).map fun i => pure (i * i))
+  check (squares == (Array.range 100).map (fun i => i * i)) "results in order"
+
+  -- Every action runs even when one fails, and the failure is rethrown
+  let ran ← IO.mkRef 0
+  let actions : Array (IO Nat) := (Array.range 20).map fun i => do
+    ran.modify (· + 1)
+    if i == 7 then throw (IO.userError "boom") else pure i
+  let result ← (Compute.parallelIO actions).toBaseIO
+  check (match result with | .error _ => true | .ok _ => false) "error rethrown"
+  check ((← ran.get) == 20) "all actions ran"
+
+def testArrowIOParallel : IO Unit := do
+  let ok ← (ArrowIO.parallel #[pure 1, pure 2, pure 3] : ArrowIO (Array Nat)).run
+  check (match ok with | .ok values => values == #[1, 2, 3] | .error _ => false) "ok results"
+  let failing : Array (ArrowIO Nat) := #[pure 1, throw (Arrow.Error.columnNotFound "x"), pure 3]
+  let failed ← (ArrowIO.parallel failing).run
+  check (match failed with | .error e => e.kind == .columnNotFound | .ok _ => false) "error kept"
+
+def run : IO Unit := do
+  IO.println "Tests.Parallel"
+  runTest "threadCount" testThreadCount
+  runTest "aggregates" testAggregates
+  runTest "deterministicFloats" testDeterministicFloats
+  runTest "parallelIO" testParallelIO
+  runTest "arrowIOParallel" testArrowIOParallel
+
+end Tests.Parallel
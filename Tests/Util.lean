@@ -0,0 +1,24 @@
+/-
+  Tests/Util.lean - Helpers shared by the Lean tests
+
+  Each test is an `IO Unit`; a failed check throws, so `lake exe tests`
+  stops at the first failure with a non-zero exit code.
+-/
+
+namespace Tests
+
+/-- Fail with `msg` unless `cond` holds -/
+def check (cond : Bool) (msg : String) : IO Unit :=
+  unless cond do throw <| IO.userError s!"check failed: {msg}"
+
+/-- Unwrap an optional result, failing with `msg` when it is missing -/
+def expectSome (value : Option α) (msg : String) : IO α :=
+  match value with
+  | some v => pure v
+  | none => throw <| IO.userError s!"check failed: no {msg}"
+
+def runTest (name : String) (test : IO Unit) : IO Unit := do
+  test
+  IO.println s!"  ok  {name}"
+
+end Tests
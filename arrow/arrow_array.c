@@ -1,4 +1,5 @@
 #include "arrow_c_abi.h"
+#include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -106,4 +107,118 @@ void arrow_array_release(struct ArrowArray* array) {
         array->release(array);
         free(array);
     }
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// Shared References
+// ============================================================================
+
+// Holds the moved original array; released when the last reference goes
+struct ArrowSharedArray {
+    struct ArrowArray array;
+    int64_t refcount;
+};
+
+static void arrow_shared_release(struct ArrowArray* array) {
+    if (!array || !array->release) return;
+
+    struct ArrowSharedArray* shared = (struct ArrowSharedArray*)array->private_data;
+    if (__atomic_sub_fetch(&shared->refcount, 1, __ATOMIC_ACQ_REL) == 0) {
+        if (shared->array.release) {
+            shared->array.release(&shared->array);
+        }
+        free(shared);
+    }
+
+    array->release = NULL;
+    array->private_data = NULL;
+}
+
+static inline bool arrow_array_is_shared(const struct ArrowArray* array) {
+    return array->release == arrow_shared_release;
+}
+
+// Copy the fields of `view` into `out` as a new reference to `shared`
+static void arrow_shared_ref(struct ArrowSharedArray* shared, const struct ArrowArray* view,
+                             struct ArrowArray* out) {
+    __atomic_add_fetch(&shared->refcount, 1, __ATOMIC_RELAXED);
+    *out = *view;
+    out->release = arrow_shared_release;
+    out->private_data = shared;
+}
+
+int arrow_array_make_shared(struct ArrowArray* array) {
+    if (!array) return -1;
+    if (!array->release || arrow_array_is_shared(array)) return 0;
+
+    struct ArrowSharedArray* shared = (struct ArrowSharedArray*)malloc(sizeof(struct ArrowSharedArray));
+    if (!shared) return -1;
+
+    // Move the original into the holder; the caller's struct keeps the same
+    // fields and becomes the first reference
+    shared->array = *array;
+    shared->refcount = 1;
+    array->release = arrow_shared_release;
+    array->private_data = shared;
+    return 0;
+}
+
+int arrow_array_share(struct ArrowArray* array, struct ArrowArray* out) {
+    if (!array || !out) return -1;
+    if (!array->release) {
+        // Borrowed from its owner: hand out a view with the same lifetime
+        *out = *array;
+        return 0;
+    }
+    if (arrow_array_make_shared(array) != 0) return -1;
+
+    arrow_shared_ref((struct ArrowSharedArray*)array->private_data, array, out);
+    return 0;
+}
+
+static int64_t arrow_count_unset_bits(const uint8_t* bitmap, int64_t offset, int64_t length) {
+    int64_t valid = 0;
+    int64_t i = 0;
+    // Leading bits up to a byte boundary, whole bytes, then the tail
+    for (; i < length && ((offset + i) & 7) != 0; i++) {
+        valid += (bitmap[(offset + i) >> 3] >> ((offset + i) & 7)) & 1;
+    }
+    for (; i + 8 <= length; i += 8) {
+        valid += __builtin_popcount(bitmap[(offset + i) >> 3]);
+    }
+    for (; i < length; i++) {
+        valid += (bitmap[(offset + i) >> 3] >> ((offset + i) & 7)) & 1;
+    }
+    return length - valid;
+}
+
+int arrow_array_share_slice(struct ArrowArray* array, int64_t offset, int64_t length,
+                            struct ArrowArray* out) {
+    if (!array || !out || offset < 0 || length < 0 || offset + length > array->length) return -1;
+    if (arrow_array_share(array, out) != 0) return -1;
+
+    out->offset = array->offset + offset;
+    out->length = length;
+    if (array->null_count == 0 || array->null_count == array->length) {
+        out->null_count = array->null_count == 0 ? 0 : length;
+    } else if (array->n_buffers > 0 && array->buffers[0]) {
+        out->null_count = arrow_count_unset_bits((const uint8_t*)array->buffers[0], out->offset, length);
+    } else {
+        out->null_count = -1;
+    }
+    return 0;
+}
+
+int arrow_array_share_child(struct ArrowArray* array, int64_t index, struct ArrowArray* out) {
+    if (!array || !out || index < 0 || index >= array->n_children || !array->children[index]) return -1;
+    if (!array->release) {
+        *out = *array->children[index];
+        out->release = NULL;
+        return 0;
+    }
+    if (arrow_array_make_shared(array) != 0) return -1;
+
+    // The child reference keeps the whole parent alive
+    arrow_shared_ref((struct ArrowSharedArray*)array->private_data, array->children[index], out);
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "arrow_c_abi.h"
+#include "arrow_memory.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -6,7 +7,7 @@ struct ArrowBuffer* arrow_allocate_buffer(size_t size) {
     struct ArrowBuffer* buffer = (struct ArrowBuffer*)malloc(sizeof(struct ArrowBuffer));
     if (!buffer) return NULL;
     
-    buffer->data = (uint8_t*)malloc(size);
+    buffer->data = (uint8_t*)arrow_mem_alloc(size);
     if (!buffer->data && size > 0) {
         free(buffer);
         return NULL;
@@ -33,7 +34,7 @@ int arrow_buffer_resize(struct ArrowBuffer* buffer, size_t new_size) {
     }
     
     // Need to reallocate
-    uint8_t* new_data = (uint8_t*)realloc(buffer->data, new_size);
+    uint8_t* new_data = (uint8_t*)arrow_mem_realloc(buffer->data, new_size);
     if (!new_data && new_size > 0) {
         return -1; // Reallocation failed
     }
@@ -53,7 +54,7 @@ int arrow_buffer_resize(struct ArrowBuffer* buffer, size_t new_size) {
 void arrow_buffer_free(struct ArrowBuffer* buffer) {
     if (!buffer) return;
     
-    free(buffer->data);
+    arrow_mem_free(buffer->data);
     free(buffer);
 }
 
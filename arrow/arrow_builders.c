@@ -2,6 +2,9 @@
 #define _POSIX_C_SOURCE 200809L
 
 #include "arrow_builders.h"
+#define ARROW_MEMORY_SUBSYSTEM ARROW_MEMORY_BUILDERS
+#include "arrow_memory.h"
+#include "arrow_wrapper.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -23,8 +26,8 @@ static void int64_array_release(struct ArrowArray* array) {
 
     ArrayPrivateData* priv = (ArrayPrivateData*)array->private_data;
     if (priv) {
-        free(priv->buffer0);  // validity
-        free(priv->buffer1);  // values
+        arrow_mem_free(priv->buffer0);  // validity
+        arrow_mem_free(priv->buffer1);  // values
         free(priv);
     }
 
@@ -40,8 +43,8 @@ static void float64_array_release(struct ArrowArray* array) {
 
     ArrayPrivateData* priv = (ArrayPrivateData*)array->private_data;
     if (priv) {
-        free(priv->buffer0);
-        free(priv->buffer1);
+        arrow_mem_free(priv->buffer0);
+        arrow_mem_free(priv->buffer1);
         free(priv);
     }
 
@@ -57,9 +60,9 @@ static void string_array_release(struct ArrowArray* array) {
 
     ArrayPrivateData* priv = (ArrayPrivateData*)array->private_data;
     if (priv) {
-        free(priv->buffer0);  // validity
-        free(priv->buffer1);  // offsets
-        free(priv->buffer2);  // data
+        arrow_mem_free(priv->buffer0);  // validity
+        arrow_mem_free(priv->buffer1);  // offsets
+        arrow_mem_free(priv->buffer2);  // data
         free(priv);
     }
 
@@ -75,8 +78,8 @@ static void bool_array_release(struct ArrowArray* array) {
 
     ArrayPrivateData* priv = (ArrayPrivateData*)array->private_data;
     if (priv) {
-        free(priv->buffer0);
-        free(priv->buffer1);
+        arrow_mem_free(priv->buffer0);
+        arrow_mem_free(priv->buffer1);
         free(priv);
     }
 
@@ -93,8 +96,8 @@ static void fixed_width_array_release(struct ArrowArray* array) {
 
     ArrayPrivateData* priv = (ArrayPrivateData*)array->private_data;
     if (priv) {
-        free(priv->buffer0);
-        free(priv->buffer1);
+        arrow_mem_free(priv->buffer0);
+        arrow_mem_free(priv->buffer1);
         free(priv);
     }
 
@@ -110,9 +113,9 @@ static void binary_array_release(struct ArrowArray* array) {
 
     ArrayPrivateData* priv = (ArrayPrivateData*)array->private_data;
     if (priv) {
-        free(priv->buffer0);  // validity
-        free(priv->buffer1);  // offsets
-        free(priv->buffer2);  // data
+        arrow_mem_free(priv->buffer0);  // validity
+        arrow_mem_free(priv->buffer1);  // offsets
+        arrow_mem_free(priv->buffer2);  // data
         free(priv);
     }
 
@@ -123,6 +126,51 @@ static void binary_array_release(struct ArrowArray* array) {
     array->release = NULL;
 }
 
+// String view arrays own every buffer, including the variadic data buffers
+static void string_view_array_release(struct ArrowArray* array) {
+    if (array->release == NULL) return;
+
+    if (array->buffers) {
+        for (int64_t i = 0; i < array->n_buffers; i++) {
+            arrow_mem_free((void*)array->buffers[i]);
+        }
+        free((void*)array->buffers);
+    }
+
+    array->release = NULL;
+}
+
+// ============================================================================
+// Private: Bitmap Helpers
+// ============================================================================
+
+// Copy `count` bits from `src` (NULL: all set) to `bitmap` starting at bit
+// `start`, a byte at a time. Returns the number of zero bits copied.
+static size_t bitmap_append_bits(uint8_t* bitmap, size_t start, const uint8_t* src, size_t count) {
+    if (count == 0) return 0;
+
+    size_t shift = start % 8;
+    uint8_t* out = bitmap + start / 8;
+    size_t zeros = 0;
+
+    // Keep only the bits before `start` in the first byte
+    out[0] &= (uint8_t)((1u << shift) - 1);
+    for (size_t i = 0; i * 8 < count; i++) {
+        size_t bits = count - i * 8 < 8 ? count - i * 8 : 8;
+        uint8_t byte = src ? src[i] : 0xFF;
+        if (bits < 8) byte &= (uint8_t)((1u << bits) - 1);
+        zeros += bits - (size_t)__builtin_popcount(byte);
+
+        if (shift == 0) {
+            out[i] = byte;
+        } else {
+            out[i] |= (uint8_t)(byte << shift);
+            if (shift + bits > 8) out[i + 1] = (uint8_t)(byte >> (8 - shift));
+        }
+    }
+    return zeros;
+}
+
 // ============================================================================
 // Int64 Builder Implementation
 // ============================================================================
@@ -133,8 +181,8 @@ Int64Builder* int64_builder_create(size_t initial_capacity) {
     Int64Builder* builder = calloc(1, sizeof(Int64Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(int64_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(int64_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -154,13 +202,13 @@ static int int64_builder_ensure_capacity(Int64Builder* builder, size_t additiona
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    int64_t* new_values = realloc(builder->values, new_capacity * sizeof(int64_t));
+    int64_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(int64_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     // Zero out new bitmap bytes
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
@@ -197,17 +245,17 @@ int int64_builder_append_null(Int64Builder* builder) {
     return BUILDER_OK;
 }
 
-int int64_builder_append_values(Int64Builder* builder, const int64_t* values, size_t count) {
+int int64_builder_append_values(Int64Builder* builder, const int64_t* values, size_t count, const uint8_t* validity) {
     if (!builder) return BUILDER_ERR_NULL;
     if (!values && count > 0) return BUILDER_ERR_NULL;
 
     int err = int64_builder_ensure_capacity(builder, count);
     if (err != BUILDER_OK) return err;
 
-    memcpy(builder->values + builder->length, values, count * sizeof(int64_t));
-    for (size_t i = 0; i < count; i++) {
-        bitmap_set(builder->validity, builder->length + i, true);
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(int64_t));
     }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
     builder->length += count;
 
     return BUILDER_OK;
@@ -273,8 +321,8 @@ void int64_builder_reset(Int64Builder* builder) {
 
 void int64_builder_free(Int64Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -292,8 +340,8 @@ Float64Builder* float64_builder_create(size_t initial_capacity) {
     Float64Builder* builder = calloc(1, sizeof(Float64Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(double));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(double));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -313,13 +361,13 @@ static int float64_builder_ensure_capacity(Float64Builder* builder, size_t addit
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    double* new_values = realloc(builder->values, new_capacity * sizeof(double));
+    double* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(double));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -355,17 +403,17 @@ int float64_builder_append_null(Float64Builder* builder) {
     return BUILDER_OK;
 }
 
-int float64_builder_append_values(Float64Builder* builder, const double* values, size_t count) {
+int float64_builder_append_values(Float64Builder* builder, const double* values, size_t count, const uint8_t* validity) {
     if (!builder) return BUILDER_ERR_NULL;
     if (!values && count > 0) return BUILDER_ERR_NULL;
 
     int err = float64_builder_ensure_capacity(builder, count);
     if (err != BUILDER_OK) return err;
 
-    memcpy(builder->values + builder->length, values, count * sizeof(double));
-    for (size_t i = 0; i < count; i++) {
-        bitmap_set(builder->validity, builder->length + i, true);
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(double));
     }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
     builder->length += count;
 
     return BUILDER_OK;
@@ -428,8 +476,8 @@ void float64_builder_reset(Float64Builder* builder) {
 
 void float64_builder_free(Float64Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -449,9 +497,9 @@ StringBuilder* string_builder_create(size_t initial_capacity, size_t initial_dat
     if (!builder) return NULL;
 
     // Offsets array has length+1 elements
-    builder->offsets = malloc((initial_capacity + 1) * sizeof(int32_t));
-    builder->data = malloc(initial_data_capacity);
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->offsets = arrow_mem_alloc((initial_capacity + 1) * sizeof(int32_t));
+    builder->data = arrow_mem_alloc(initial_data_capacity);
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->data_capacity = initial_data_capacity;
     builder->length = 0;
@@ -474,13 +522,13 @@ static int string_builder_ensure_capacity(StringBuilder* builder, size_t additio
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    int32_t* new_offsets = realloc(builder->offsets, (new_capacity + 1) * sizeof(int32_t));
+    int32_t* new_offsets = arrow_mem_realloc(builder->offsets, (new_capacity + 1) * sizeof(int32_t));
     if (!new_offsets) return BUILDER_ERR_ALLOC;
     builder->offsets = new_offsets;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -496,7 +544,7 @@ static int string_builder_ensure_data_capacity(StringBuilder* builder, size_t ad
     size_t new_capacity = builder->data_capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    char* new_data = realloc(builder->data, new_capacity);
+    char* new_data = arrow_mem_realloc(builder->data, new_capacity);
     if (!new_data) return BUILDER_ERR_ALLOC;
     builder->data = new_data;
     builder->data_capacity = new_capacity;
@@ -507,6 +555,7 @@ static int string_builder_ensure_data_capacity(StringBuilder* builder, size_t ad
 int string_builder_append(StringBuilder* builder, const char* value, size_t length) {
     if (!builder) return BUILDER_ERR_NULL;
     if (!value && length > 0) return BUILDER_ERR_NULL;
+    if (length > (size_t)INT32_MAX - builder->data_length) return BUILDER_ERR_FULL;  // int32 offsets
 
     int err = string_builder_ensure_capacity(builder, 1);
     if (err != BUILDER_OK) return err;
@@ -552,6 +601,39 @@ int string_builder_append_null(StringBuilder* builder) {
     return BUILDER_OK;
 }
 
+int string_builder_append_values(StringBuilder* builder, const int32_t* offsets, const char* data, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (count == 0) return BUILDER_OK;
+    if (!offsets) return BUILDER_ERR_NULL;
+
+    size_t data_size = (size_t)(offsets[count] - offsets[0]);
+    if (!data && data_size > 0) return BUILDER_ERR_NULL;
+    if (data_size > (size_t)INT32_MAX - builder->data_length) return BUILDER_ERR_FULL;  // int32 offsets
+
+    int err = string_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    err = string_builder_ensure_data_capacity(builder, data_size);
+    if (err != BUILDER_OK) return err;
+
+    if (data_size > 0) {
+        memcpy(builder->data + builder->data_length, data + offsets[0], data_size);
+    }
+
+    // Rebase the source offsets onto the end of the data buffer
+    int32_t* out = builder->offsets + builder->length + 1;
+    int64_t base = (int64_t)builder->data_length - offsets[0];
+    for (size_t i = 0; i < count; i++) {
+        out[i] = (int32_t)(base + offsets[i + 1]);
+    }
+    builder->data_length += data_size;
+
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* string_builder_finish(StringBuilder* builder) {
     if (!builder) return NULL;
 
@@ -615,9 +697,9 @@ void string_builder_reset(StringBuilder* builder) {
 
 void string_builder_free(StringBuilder* builder) {
     if (!builder) return;
-    free(builder->offsets);
-    free(builder->data);
-    free(builder->validity);
+    arrow_mem_free(builder->offsets);
+    arrow_mem_free(builder->data);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -625,6 +707,444 @@ size_t string_builder_length(const StringBuilder* builder) {
     return builder ? builder->length : 0;
 }
 
+// ============================================================================
+// Large String Builder Implementation
+// ============================================================================
+
+LargeStringBuilder* large_string_builder_create(size_t initial_capacity, size_t initial_data_capacity) {
+    if (initial_capacity == 0) initial_capacity = 1024;
+    if (initial_data_capacity == 0) initial_data_capacity = 8192;
+
+    LargeStringBuilder* builder = calloc(1, sizeof(LargeStringBuilder));
+    if (!builder) return NULL;
+
+    builder->offsets = arrow_mem_alloc((initial_capacity + 1) * sizeof(int64_t));
+    builder->data = arrow_mem_alloc(initial_data_capacity);
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->capacity = initial_capacity;
+    builder->data_capacity = initial_data_capacity;
+
+    if (!builder->offsets || !builder->data || !builder->validity) {
+        large_string_builder_free(builder);
+        return NULL;
+    }
+
+    builder->offsets[0] = 0;
+    return builder;
+}
+
+static int large_string_builder_ensure_capacity(LargeStringBuilder* builder, size_t additional) {
+    size_t required = builder->length + additional;
+    if (required <= builder->capacity) return BUILDER_OK;
+
+    size_t new_capacity = builder->capacity * 2;
+    while (new_capacity < required) new_capacity *= 2;
+
+    int64_t* new_offsets = arrow_mem_realloc(builder->offsets, (new_capacity + 1) * sizeof(int64_t));
+    if (!new_offsets) return BUILDER_ERR_ALLOC;
+    builder->offsets = new_offsets;
+
+    size_t new_bitmap_size = bitmap_byte_count(new_capacity);
+    size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
+    if (!new_validity) return BUILDER_ERR_ALLOC;
+    memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
+    builder->validity = new_validity;
+
+    builder->capacity = new_capacity;
+    return BUILDER_OK;
+}
+
+static int large_string_builder_ensure_data_capacity(LargeStringBuilder* builder, size_t additional) {
+    size_t required = builder->data_length + additional;
+    if (required <= builder->data_capacity) return BUILDER_OK;
+
+    size_t new_capacity = builder->data_capacity * 2;
+    while (new_capacity < required) new_capacity *= 2;
+
+    char* new_data = arrow_mem_realloc(builder->data, new_capacity);
+    if (!new_data) return BUILDER_ERR_ALLOC;
+    builder->data = new_data;
+    builder->data_capacity = new_capacity;
+
+    return BUILDER_OK;
+}
+
+int large_string_builder_append(LargeStringBuilder* builder, const char* value, size_t length) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!value && length > 0) return BUILDER_ERR_NULL;
+
+    int err = large_string_builder_ensure_capacity(builder, 1);
+    if (err != BUILDER_OK) return err;
+
+    err = large_string_builder_ensure_data_capacity(builder, length);
+    if (err != BUILDER_OK) return err;
+
+    if (length > 0) {
+        memcpy(builder->data + builder->data_length, value, length);
+    }
+    builder->data_length += length;
+
+    builder->offsets[builder->length + 1] = (int64_t)builder->data_length;
+
+    bitmap_set(builder->validity, builder->length, true);
+    builder->length++;
+
+    return BUILDER_OK;
+}
+
+int large_string_builder_append_cstr(LargeStringBuilder* builder, const char* value) {
+    if (!value) return large_string_builder_append_null(builder);
+    return large_string_builder_append(builder, value, strlen(value));
+}
+
+int large_string_builder_append_null(LargeStringBuilder* builder) {
+    if (!builder) return BUILDER_ERR_NULL;
+
+    int err = large_string_builder_ensure_capacity(builder, 1);
+    if (err != BUILDER_OK) return err;
+
+    builder->offsets[builder->length + 1] = (int64_t)builder->data_length;
+
+    bitmap_set(builder->validity, builder->length, false);
+    builder->length++;
+    builder->null_count++;
+
+    return BUILDER_OK;
+}
+
+int large_string_builder_append_values(LargeStringBuilder* builder, const int64_t* offsets, const char* data, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (count == 0) return BUILDER_OK;
+    if (!offsets) return BUILDER_ERR_NULL;
+
+    size_t data_size = (size_t)(offsets[count] - offsets[0]);
+    if (!data && data_size > 0) return BUILDER_ERR_NULL;
+
+    int err = large_string_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    err = large_string_builder_ensure_data_capacity(builder, data_size);
+    if (err != BUILDER_OK) return err;
+
+    if (data_size > 0) {
+        memcpy(builder->data + builder->data_length, data + offsets[0], data_size);
+    }
+
+    // Rebase the source offsets onto the end of the data buffer
+    int64_t* out = builder->offsets + builder->length + 1;
+    int64_t base = (int64_t)builder->data_length - offsets[0];
+    for (size_t i = 0; i < count; i++) {
+        out[i] = (int64_t)(base + offsets[i + 1]);
+    }
+    builder->data_length += data_size;
+
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
+struct ArrowArray* large_string_builder_finish(LargeStringBuilder* builder) {
+    if (!builder) return NULL;
+
+    struct ArrowArray* array = calloc(1, sizeof(struct ArrowArray));
+    if (!array) return NULL;
+
+    array->length = (int64_t)builder->length;
+    array->null_count = (int64_t)builder->null_count;
+    array->offset = 0;
+    array->n_buffers = 3;  // validity, offsets, data
+    array->n_children = 0;
+    array->children = NULL;
+    array->dictionary = NULL;
+
+    array->buffers = malloc(3 * sizeof(void*));
+    if (!array->buffers) {
+        free(array);
+        return NULL;
+    }
+
+    array->buffers[0] = builder->validity;
+    array->buffers[1] = builder->offsets;
+    array->buffers[2] = builder->data;
+
+    ArrayPrivateData* priv = malloc(sizeof(ArrayPrivateData));
+    if (!priv) {
+        free((void*)array->buffers);
+        free(array);
+        return NULL;
+    }
+    priv->buffer0 = builder->validity;
+    priv->buffer1 = builder->offsets;
+    priv->buffer2 = builder->data;
+    priv->builder = NULL;
+
+    array->private_data = priv;
+    array->release = string_array_release;
+
+    builder->offsets = NULL;
+    builder->data = NULL;
+    builder->validity = NULL;
+    builder->length = 0;
+    builder->capacity = 0;
+    builder->data_length = 0;
+    builder->data_capacity = 0;
+    builder->null_count = 0;
+
+    return array;
+}
+
+void large_string_builder_reset(LargeStringBuilder* builder) {
+    if (!builder) return;
+    builder->length = 0;
+    builder->data_length = 0;
+    builder->null_count = 0;
+    if (builder->offsets) builder->offsets[0] = 0;
+    if (builder->validity) {
+        memset(builder->validity, 0, bitmap_byte_count(builder->capacity));
+    }
+}
+
+void large_string_builder_free(LargeStringBuilder* builder) {
+    if (!builder) return;
+    arrow_mem_free(builder->offsets);
+    arrow_mem_free(builder->data);
+    arrow_mem_free(builder->validity);
+    free(builder);
+}
+
+size_t large_string_builder_length(const LargeStringBuilder* builder) {
+    return builder ? builder->length : 0;
+}
+
+// ============================================================================
+// String View Builder Implementation
+// ============================================================================
+
+StringViewBuilder* string_view_builder_create(size_t initial_capacity, size_t block_size) {
+    if (initial_capacity == 0) initial_capacity = 1024;
+    if (block_size == 0) block_size = 32 * 1024;
+    if (block_size > INT32_MAX) block_size = INT32_MAX;
+
+    StringViewBuilder* builder = calloc(1, sizeof(StringViewBuilder));
+    if (!builder) return NULL;
+
+    builder->views = arrow_mem_alloc(initial_capacity * STRING_VIEW_SIZE);
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->data_buffers = malloc(4 * sizeof(char*));
+    builder->data_sizes = arrow_mem_alloc(4 * sizeof(int64_t));
+    builder->data_buffers_capacity = 4;
+    builder->block_size = block_size;
+    builder->capacity = initial_capacity;
+
+    if (!builder->views || !builder->validity || !builder->data_buffers || !builder->data_sizes) {
+        string_view_builder_free(builder);
+        return NULL;
+    }
+    return builder;
+}
+
+static int string_view_builder_ensure_capacity(StringViewBuilder* builder, size_t additional) {
+    size_t required = builder->length + additional;
+    if (required <= builder->capacity) return BUILDER_OK;
+
+    size_t new_capacity = builder->capacity * 2;
+    while (new_capacity < required) new_capacity *= 2;
+
+    uint8_t* new_views = arrow_mem_realloc(builder->views, new_capacity * STRING_VIEW_SIZE);
+    if (!new_views) return BUILDER_ERR_ALLOC;
+    builder->views = new_views;
+
+    size_t new_bitmap_size = bitmap_byte_count(new_capacity);
+    size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
+    if (!new_validity) return BUILDER_ERR_ALLOC;
+    memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
+    builder->validity = new_validity;
+
+    builder->capacity = new_capacity;
+    return BUILDER_OK;
+}
+
+// Make room for `length` bytes in the last data buffer, starting a new
+// buffer when the last one would pass INT32_MAX (view offsets are int32)
+static int string_view_builder_reserve_data(StringViewBuilder* builder, size_t length) {
+    size_t last = builder->n_data_buffers;
+    if (last > 0) {
+        size_t used = (size_t)builder->data_sizes[last - 1];
+        size_t required = used + length;
+        if (required <= builder->data_capacity) return BUILDER_OK;
+        if (required <= INT32_MAX) {
+            size_t new_capacity = builder->data_capacity * 2;
+            while (new_capacity < required) new_capacity *= 2;
+            if (new_capacity > INT32_MAX) new_capacity = INT32_MAX;
+
+            char* new_data = arrow_mem_realloc(builder->data_buffers[last - 1], new_capacity);
+            if (!new_data) return BUILDER_ERR_ALLOC;
+            builder->data_buffers[last - 1] = new_data;
+            builder->data_capacity = new_capacity;
+            return BUILDER_OK;
+        }
+    }
+
+    if (builder->n_data_buffers >= INT32_MAX) return BUILDER_ERR_FULL;
+    if (builder->n_data_buffers == builder->data_buffers_capacity) {
+        size_t new_capacity = builder->data_buffers_capacity * 2;
+        char** new_buffers = realloc(builder->data_buffers, new_capacity * sizeof(char*));
+        if (!new_buffers) return BUILDER_ERR_ALLOC;
+        builder->data_buffers = new_buffers;
+        int64_t* new_sizes = arrow_mem_realloc(builder->data_sizes, new_capacity * sizeof(int64_t));
+        if (!new_sizes) return BUILDER_ERR_ALLOC;
+        builder->data_sizes = new_sizes;
+        builder->data_buffers_capacity = new_capacity;
+    }
+
+    size_t capacity = length > builder->block_size ? length : builder->block_size;
+    char* data = arrow_mem_alloc(capacity);
+    if (!data) return BUILDER_ERR_ALLOC;
+    builder->data_buffers[builder->n_data_buffers] = data;
+    builder->data_sizes[builder->n_data_buffers] = 0;
+    builder->n_data_buffers++;
+    builder->data_capacity = capacity;
+    return BUILDER_OK;
+}
+
+int string_view_builder_append(StringViewBuilder* builder, const char* value, size_t length) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!value && length > 0) return BUILDER_ERR_NULL;
+    if (length > INT32_MAX) return BUILDER_ERR_FULL;
+
+    int err = string_view_builder_ensure_capacity(builder, 1);
+    if (err != BUILDER_OK) return err;
+
+    uint8_t* view = builder->views + builder->length * STRING_VIEW_SIZE;
+    int32_t view_length = (int32_t)length;
+    memset(view, 0, STRING_VIEW_SIZE);
+    memcpy(view, &view_length, 4);
+
+    if (length <= STRING_VIEW_INLINE_MAX) {
+        if (length > 0) memcpy(view + 4, value, length);
+    } else {
+        err = string_view_builder_reserve_data(builder, length);
+        if (err != BUILDER_OK) return err;
+
+        int32_t buffer_index = (int32_t)(builder->n_data_buffers - 1);
+        int32_t offset = (int32_t)builder->data_sizes[buffer_index];
+        memcpy(builder->data_buffers[buffer_index] + offset, value, length);
+        builder->data_sizes[buffer_index] += (int64_t)length;
+
+        memcpy(view + 4, value, 4);  // Prefix
+        memcpy(view + 8, &buffer_index, 4);
+        memcpy(view + 12, &offset, 4);
+    }
+
+    bitmap_set(builder->validity, builder->length, true);
+    builder->length++;
+
+    return BUILDER_OK;
+}
+
+int string_view_builder_append_cstr(StringViewBuilder* builder, const char* value) {
+    if (!value) return string_view_builder_append_null(builder);
+    return string_view_builder_append(builder, value, strlen(value));
+}
+
+int string_view_builder_append_null(StringViewBuilder* builder) {
+    if (!builder) return BUILDER_ERR_NULL;
+
+    int err = string_view_builder_ensure_capacity(builder, 1);
+    if (err != BUILDER_OK) return err;
+
+    // Null is an empty inline view
+    memset(builder->views + builder->length * STRING_VIEW_SIZE, 0, STRING_VIEW_SIZE);
+
+    bitmap_set(builder->validity, builder->length, false);
+    builder->length++;
+    builder->null_count++;
+
+    return BUILDER_OK;
+}
+
+struct ArrowArray* string_view_builder_finish(StringViewBuilder* builder) {
+    if (!builder) return NULL;
+
+    struct ArrowArray* array = calloc(1, sizeof(struct ArrowArray));
+    if (!array) return NULL;
+
+    size_t n_buffers = 2 + builder->n_data_buffers + 1;
+    array->length = (int64_t)builder->length;
+    array->null_count = (int64_t)builder->null_count;
+    array->offset = 0;
+    array->n_buffers = (int64_t)n_buffers;
+    array->n_children = 0;
+    array->children = NULL;
+    array->dictionary = NULL;
+
+    array->buffers = malloc(n_buffers * sizeof(void*));
+    if (!array->buffers) {
+        free(array);
+        return NULL;
+    }
+
+    array->buffers[0] = builder->validity;
+    array->buffers[1] = builder->views;
+    for (size_t i = 0; i < builder->n_data_buffers; i++) {
+        array->buffers[2 + i] = builder->data_buffers[i];
+    }
+    array->buffers[n_buffers - 1] = builder->data_sizes;
+
+    // Every buffer is owned by the array
+    array->private_data = NULL;
+    array->release = string_view_array_release;
+
+    free(builder->data_buffers);
+    builder->views = NULL;
+    builder->validity = NULL;
+    builder->data_buffers = NULL;
+    builder->data_sizes = NULL;
+    builder->n_data_buffers = 0;
+    builder->data_buffers_capacity = 0;
+    builder->data_capacity = 0;
+    builder->length = 0;
+    builder->capacity = 0;
+    builder->null_count = 0;
+
+    return array;
+}
+
+void string_view_builder_reset(StringViewBuilder* builder) {
+    if (!builder) return;
+    for (size_t i = 0; i < builder->n_data_buffers; i++) {
+        arrow_mem_free(builder->data_buffers[i]);
+    }
+    builder->n_data_buffers = 0;
+    builder->data_capacity = 0;
+    builder->length = 0;
+    builder->null_count = 0;
+    if (builder->validity) {
+        memset(builder->validity, 0, bitmap_byte_count(builder->capacity));
+    }
+}
+
+void string_view_builder_free(StringViewBuilder* builder) {
+    if (!builder) return;
+    if (builder->data_buffers) {
+        for (size_t i = 0; i < builder->n_data_buffers; i++) {
+            arrow_mem_free(builder->data_buffers[i]);
+        }
+    }
+    free(builder->data_buffers);
+    arrow_mem_free(builder->data_sizes);
+    arrow_mem_free(builder->views);
+    arrow_mem_free(builder->validity);
+    free(builder);
+}
+
+size_t string_view_builder_length(const StringViewBuilder* builder) {
+    return builder ? builder->length : 0;
+}
+
 // ============================================================================
 // Timestamp Builder Implementation
 // ============================================================================
@@ -635,8 +1155,8 @@ TimestampBuilder* timestamp_builder_create(size_t initial_capacity, const char*
     TimestampBuilder* builder = calloc(1, sizeof(TimestampBuilder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(int64_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(int64_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -662,13 +1182,13 @@ static int timestamp_builder_ensure_capacity(TimestampBuilder* builder, size_t a
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    int64_t* new_values = realloc(builder->values, new_capacity * sizeof(int64_t));
+    int64_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(int64_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -704,6 +1224,22 @@ int timestamp_builder_append_null(TimestampBuilder* builder) {
     return BUILDER_OK;
 }
 
+int timestamp_builder_append_values(TimestampBuilder* builder, const int64_t* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = timestamp_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(int64_t));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* timestamp_builder_finish(TimestampBuilder* builder) {
     if (!builder) return NULL;
 
@@ -762,8 +1298,8 @@ void timestamp_builder_reset(TimestampBuilder* builder) {
 
 void timestamp_builder_free(TimestampBuilder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder->timezone);
     free(builder);
 }
@@ -786,8 +1322,8 @@ BoolBuilder* bool_builder_create(size_t initial_capacity) {
     BoolBuilder* builder = calloc(1, sizeof(BoolBuilder));
     if (!builder) return NULL;
 
-    builder->values = calloc(bitmap_byte_count(initial_capacity), 1);
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -810,12 +1346,12 @@ static int bool_builder_ensure_capacity(BoolBuilder* builder, size_t additional)
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
 
-    uint8_t* new_values = realloc(builder->values, new_bitmap_size);
+    uint8_t* new_values = arrow_mem_realloc(builder->values, new_bitmap_size);
     if (!new_values) return BUILDER_ERR_ALLOC;
     memset(new_values + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->values = new_values;
 
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -851,6 +1387,20 @@ int bool_builder_append_null(BoolBuilder* builder) {
     return BUILDER_OK;
 }
 
+int bool_builder_append_values(BoolBuilder* builder, const uint8_t* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = bool_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    bitmap_append_bits(builder->values, builder->length, values, count);
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* bool_builder_finish(BoolBuilder* builder) {
     if (!builder) return NULL;
 
@@ -911,8 +1461,8 @@ void bool_builder_reset(BoolBuilder* builder) {
 
 void bool_builder_free(BoolBuilder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -930,8 +1480,8 @@ Int8Builder* int8_builder_create(size_t initial_capacity) {
     Int8Builder* builder = calloc(1, sizeof(Int8Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(int8_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(int8_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -951,13 +1501,13 @@ static int int8_builder_ensure_capacity(Int8Builder* builder, size_t additional)
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    int8_t* new_values = realloc(builder->values, new_capacity * sizeof(int8_t));
+    int8_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(int8_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -993,6 +1543,22 @@ int int8_builder_append_null(Int8Builder* builder) {
     return BUILDER_OK;
 }
 
+int int8_builder_append_values(Int8Builder* builder, const int8_t* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = int8_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(int8_t));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* int8_builder_finish(Int8Builder* builder) {
     if (!builder) return NULL;
 
@@ -1050,8 +1616,8 @@ void int8_builder_reset(Int8Builder* builder) {
 
 void int8_builder_free(Int8Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -1069,8 +1635,8 @@ Int16Builder* int16_builder_create(size_t initial_capacity) {
     Int16Builder* builder = calloc(1, sizeof(Int16Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(int16_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(int16_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -1090,13 +1656,13 @@ static int int16_builder_ensure_capacity(Int16Builder* builder, size_t additiona
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    int16_t* new_values = realloc(builder->values, new_capacity * sizeof(int16_t));
+    int16_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(int16_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -1132,6 +1698,22 @@ int int16_builder_append_null(Int16Builder* builder) {
     return BUILDER_OK;
 }
 
+int int16_builder_append_values(Int16Builder* builder, const int16_t* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = int16_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(int16_t));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* int16_builder_finish(Int16Builder* builder) {
     if (!builder) return NULL;
 
@@ -1189,8 +1771,8 @@ void int16_builder_reset(Int16Builder* builder) {
 
 void int16_builder_free(Int16Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -1208,8 +1790,8 @@ Int32Builder* int32_builder_create(size_t initial_capacity) {
     Int32Builder* builder = calloc(1, sizeof(Int32Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(int32_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(int32_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -1229,13 +1811,13 @@ static int int32_builder_ensure_capacity(Int32Builder* builder, size_t additiona
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    int32_t* new_values = realloc(builder->values, new_capacity * sizeof(int32_t));
+    int32_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(int32_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -1271,6 +1853,22 @@ int int32_builder_append_null(Int32Builder* builder) {
     return BUILDER_OK;
 }
 
+int int32_builder_append_values(Int32Builder* builder, const int32_t* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = int32_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(int32_t));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* int32_builder_finish(Int32Builder* builder) {
     if (!builder) return NULL;
 
@@ -1328,8 +1926,8 @@ void int32_builder_reset(Int32Builder* builder) {
 
 void int32_builder_free(Int32Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -1347,8 +1945,8 @@ UInt8Builder* uint8_builder_create(size_t initial_capacity) {
     UInt8Builder* builder = calloc(1, sizeof(UInt8Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(uint8_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(uint8_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -1368,13 +1966,13 @@ static int uint8_builder_ensure_capacity(UInt8Builder* builder, size_t additiona
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    uint8_t* new_values = realloc(builder->values, new_capacity * sizeof(uint8_t));
+    uint8_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(uint8_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -1410,6 +2008,22 @@ int uint8_builder_append_null(UInt8Builder* builder) {
     return BUILDER_OK;
 }
 
+int uint8_builder_append_values(UInt8Builder* builder, const uint8_t* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = uint8_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(uint8_t));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* uint8_builder_finish(UInt8Builder* builder) {
     if (!builder) return NULL;
 
@@ -1467,8 +2081,8 @@ void uint8_builder_reset(UInt8Builder* builder) {
 
 void uint8_builder_free(UInt8Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -1486,8 +2100,8 @@ UInt16Builder* uint16_builder_create(size_t initial_capacity) {
     UInt16Builder* builder = calloc(1, sizeof(UInt16Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(uint16_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(uint16_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -1507,13 +2121,13 @@ static int uint16_builder_ensure_capacity(UInt16Builder* builder, size_t additio
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    uint16_t* new_values = realloc(builder->values, new_capacity * sizeof(uint16_t));
+    uint16_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(uint16_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -1549,6 +2163,22 @@ int uint16_builder_append_null(UInt16Builder* builder) {
     return BUILDER_OK;
 }
 
+int uint16_builder_append_values(UInt16Builder* builder, const uint16_t* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = uint16_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(uint16_t));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* uint16_builder_finish(UInt16Builder* builder) {
     if (!builder) return NULL;
 
@@ -1606,8 +2236,8 @@ void uint16_builder_reset(UInt16Builder* builder) {
 
 void uint16_builder_free(UInt16Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -1625,8 +2255,8 @@ UInt32Builder* uint32_builder_create(size_t initial_capacity) {
     UInt32Builder* builder = calloc(1, sizeof(UInt32Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(uint32_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(uint32_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -1646,13 +2276,13 @@ static int uint32_builder_ensure_capacity(UInt32Builder* builder, size_t additio
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    uint32_t* new_values = realloc(builder->values, new_capacity * sizeof(uint32_t));
+    uint32_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(uint32_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -1688,6 +2318,22 @@ int uint32_builder_append_null(UInt32Builder* builder) {
     return BUILDER_OK;
 }
 
+int uint32_builder_append_values(UInt32Builder* builder, const uint32_t* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = uint32_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(uint32_t));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* uint32_builder_finish(UInt32Builder* builder) {
     if (!builder) return NULL;
 
@@ -1745,8 +2391,8 @@ void uint32_builder_reset(UInt32Builder* builder) {
 
 void uint32_builder_free(UInt32Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -1764,8 +2410,8 @@ UInt64Builder* uint64_builder_create(size_t initial_capacity) {
     UInt64Builder* builder = calloc(1, sizeof(UInt64Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(uint64_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(uint64_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -1785,13 +2431,13 @@ static int uint64_builder_ensure_capacity(UInt64Builder* builder, size_t additio
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    uint64_t* new_values = realloc(builder->values, new_capacity * sizeof(uint64_t));
+    uint64_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(uint64_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -1827,6 +2473,22 @@ int uint64_builder_append_null(UInt64Builder* builder) {
     return BUILDER_OK;
 }
 
+int uint64_builder_append_values(UInt64Builder* builder, const uint64_t* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = uint64_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(uint64_t));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* uint64_builder_finish(UInt64Builder* builder) {
     if (!builder) return NULL;
 
@@ -1884,8 +2546,8 @@ void uint64_builder_reset(UInt64Builder* builder) {
 
 void uint64_builder_free(UInt64Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -1903,8 +2565,8 @@ Float32Builder* float32_builder_create(size_t initial_capacity) {
     Float32Builder* builder = calloc(1, sizeof(Float32Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(float));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(float));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -1924,13 +2586,13 @@ static int float32_builder_ensure_capacity(Float32Builder* builder, size_t addit
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    float* new_values = realloc(builder->values, new_capacity * sizeof(float));
+    float* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(float));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -1966,6 +2628,22 @@ int float32_builder_append_null(Float32Builder* builder) {
     return BUILDER_OK;
 }
 
+int float32_builder_append_values(Float32Builder* builder, const float* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = float32_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(float));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* float32_builder_finish(Float32Builder* builder) {
     if (!builder) return NULL;
 
@@ -2023,8 +2701,8 @@ void float32_builder_reset(Float32Builder* builder) {
 
 void float32_builder_free(Float32Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -2042,8 +2720,8 @@ Date32Builder* date32_builder_create(size_t initial_capacity) {
     Date32Builder* builder = calloc(1, sizeof(Date32Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(int32_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(int32_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -2063,13 +2741,13 @@ static int date32_builder_ensure_capacity(Date32Builder* builder, size_t additio
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    int32_t* new_values = realloc(builder->values, new_capacity * sizeof(int32_t));
+    int32_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(int32_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -2091,16 +2769,32 @@ int date32_builder_append(Date32Builder* builder, int32_t days) {
     return BUILDER_OK;
 }
 
-int date32_builder_append_null(Date32Builder* builder) {
+int date32_builder_append_null(Date32Builder* builder) {
+    if (!builder) return BUILDER_ERR_NULL;
+
+    int err = date32_builder_ensure_capacity(builder, 1);
+    if (err != BUILDER_OK) return err;
+
+    builder->values[builder->length] = 0;
+    bitmap_set(builder->validity, builder->length, false);
+    builder->length++;
+    builder->null_count++;
+
+    return BUILDER_OK;
+}
+
+int date32_builder_append_values(Date32Builder* builder, const int32_t* values, size_t count, const uint8_t* validity) {
     if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
 
-    int err = date32_builder_ensure_capacity(builder, 1);
+    int err = date32_builder_ensure_capacity(builder, count);
     if (err != BUILDER_OK) return err;
 
-    builder->values[builder->length] = 0;
-    bitmap_set(builder->validity, builder->length, false);
-    builder->length++;
-    builder->null_count++;
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(int32_t));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
 
     return BUILDER_OK;
 }
@@ -2162,8 +2856,8 @@ void date32_builder_reset(Date32Builder* builder) {
 
 void date32_builder_free(Date32Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -2181,8 +2875,8 @@ Date64Builder* date64_builder_create(size_t initial_capacity) {
     Date64Builder* builder = calloc(1, sizeof(Date64Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(int64_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(int64_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -2202,13 +2896,13 @@ static int date64_builder_ensure_capacity(Date64Builder* builder, size_t additio
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    int64_t* new_values = realloc(builder->values, new_capacity * sizeof(int64_t));
+    int64_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(int64_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -2244,6 +2938,22 @@ int date64_builder_append_null(Date64Builder* builder) {
     return BUILDER_OK;
 }
 
+int date64_builder_append_values(Date64Builder* builder, const int64_t* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = date64_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(int64_t));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* date64_builder_finish(Date64Builder* builder) {
     if (!builder) return NULL;
 
@@ -2301,8 +3011,8 @@ void date64_builder_reset(Date64Builder* builder) {
 
 void date64_builder_free(Date64Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -2321,8 +3031,8 @@ Time32Builder* time32_builder_create(size_t initial_capacity, char unit) {
     Time32Builder* builder = calloc(1, sizeof(Time32Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(int32_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(int32_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -2343,13 +3053,13 @@ static int time32_builder_ensure_capacity(Time32Builder* builder, size_t additio
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    int32_t* new_values = realloc(builder->values, new_capacity * sizeof(int32_t));
+    int32_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(int32_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -2385,6 +3095,22 @@ int time32_builder_append_null(Time32Builder* builder) {
     return BUILDER_OK;
 }
 
+int time32_builder_append_values(Time32Builder* builder, const int32_t* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = time32_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(int32_t));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* time32_builder_finish(Time32Builder* builder) {
     if (!builder) return NULL;
 
@@ -2442,8 +3168,8 @@ void time32_builder_reset(Time32Builder* builder) {
 
 void time32_builder_free(Time32Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -2462,8 +3188,8 @@ Time64Builder* time64_builder_create(size_t initial_capacity, char unit) {
     Time64Builder* builder = calloc(1, sizeof(Time64Builder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(int64_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(int64_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -2484,13 +3210,13 @@ static int time64_builder_ensure_capacity(Time64Builder* builder, size_t additio
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    int64_t* new_values = realloc(builder->values, new_capacity * sizeof(int64_t));
+    int64_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(int64_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -2526,6 +3252,22 @@ int time64_builder_append_null(Time64Builder* builder) {
     return BUILDER_OK;
 }
 
+int time64_builder_append_values(Time64Builder* builder, const int64_t* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = time64_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(int64_t));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* time64_builder_finish(Time64Builder* builder) {
     if (!builder) return NULL;
 
@@ -2583,8 +3325,8 @@ void time64_builder_reset(Time64Builder* builder) {
 
 void time64_builder_free(Time64Builder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -2603,8 +3345,8 @@ DurationBuilder* duration_builder_create(size_t initial_capacity, char unit) {
     DurationBuilder* builder = calloc(1, sizeof(DurationBuilder));
     if (!builder) return NULL;
 
-    builder->values = malloc(initial_capacity * sizeof(int64_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_alloc(initial_capacity * sizeof(int64_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->length = 0;
     builder->null_count = 0;
@@ -2625,13 +3367,13 @@ static int duration_builder_ensure_capacity(DurationBuilder* builder, size_t add
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    int64_t* new_values = realloc(builder->values, new_capacity * sizeof(int64_t));
+    int64_t* new_values = arrow_mem_realloc(builder->values, new_capacity * sizeof(int64_t));
     if (!new_values) return BUILDER_ERR_ALLOC;
     builder->values = new_values;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -2667,6 +3409,22 @@ int duration_builder_append_null(DurationBuilder* builder) {
     return BUILDER_OK;
 }
 
+int duration_builder_append_values(DurationBuilder* builder, const int64_t* values, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!values && count > 0) return BUILDER_ERR_NULL;
+
+    int err = duration_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    if (count > 0) {
+        memcpy(builder->values + builder->length, values, count * sizeof(int64_t));
+    }
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* duration_builder_finish(DurationBuilder* builder) {
     if (!builder) return NULL;
 
@@ -2724,8 +3482,8 @@ void duration_builder_reset(DurationBuilder* builder) {
 
 void duration_builder_free(DurationBuilder* builder) {
     if (!builder) return;
-    free(builder->values);
-    free(builder->validity);
+    arrow_mem_free(builder->values);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -2744,9 +3502,9 @@ BinaryBuilder* binary_builder_create(size_t initial_capacity, size_t initial_dat
     BinaryBuilder* builder = calloc(1, sizeof(BinaryBuilder));
     if (!builder) return NULL;
 
-    builder->offsets = malloc((initial_capacity + 1) * sizeof(int32_t));
-    builder->data = malloc(initial_data_capacity);
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->offsets = arrow_mem_alloc((initial_capacity + 1) * sizeof(int32_t));
+    builder->data = arrow_mem_alloc(initial_data_capacity);
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->capacity = initial_capacity;
     builder->data_capacity = initial_data_capacity;
     builder->length = 0;
@@ -2769,13 +3527,13 @@ static int binary_builder_ensure_capacity(BinaryBuilder* builder, size_t additio
     size_t new_capacity = builder->capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    int32_t* new_offsets = realloc(builder->offsets, (new_capacity + 1) * sizeof(int32_t));
+    int32_t* new_offsets = arrow_mem_realloc(builder->offsets, (new_capacity + 1) * sizeof(int32_t));
     if (!new_offsets) return BUILDER_ERR_ALLOC;
     builder->offsets = new_offsets;
 
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -2791,7 +3549,7 @@ static int binary_builder_ensure_data_capacity(BinaryBuilder* builder, size_t ad
     size_t new_capacity = builder->data_capacity * 2;
     while (new_capacity < required) new_capacity *= 2;
 
-    uint8_t* new_data = realloc(builder->data, new_capacity);
+    uint8_t* new_data = arrow_mem_realloc(builder->data, new_capacity);
     if (!new_data) return BUILDER_ERR_ALLOC;
     builder->data = new_data;
     builder->data_capacity = new_capacity;
@@ -2802,6 +3560,7 @@ static int binary_builder_ensure_data_capacity(BinaryBuilder* builder, size_t ad
 int binary_builder_append(BinaryBuilder* builder, const uint8_t* value, size_t length) {
     if (!builder) return BUILDER_ERR_NULL;
     if (!value && length > 0) return BUILDER_ERR_NULL;
+    if (length > (size_t)INT32_MAX - builder->data_length) return BUILDER_ERR_FULL;  // int32 offsets
 
     int err = binary_builder_ensure_capacity(builder, 1);
     if (err != BUILDER_OK) return err;
@@ -2837,6 +3596,39 @@ int binary_builder_append_null(BinaryBuilder* builder) {
     return BUILDER_OK;
 }
 
+int binary_builder_append_values(BinaryBuilder* builder, const int32_t* offsets, const uint8_t* data, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (count == 0) return BUILDER_OK;
+    if (!offsets) return BUILDER_ERR_NULL;
+
+    size_t data_size = (size_t)(offsets[count] - offsets[0]);
+    if (!data && data_size > 0) return BUILDER_ERR_NULL;
+    if (data_size > (size_t)INT32_MAX - builder->data_length) return BUILDER_ERR_FULL;  // int32 offsets
+
+    int err = binary_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    err = binary_builder_ensure_data_capacity(builder, data_size);
+    if (err != BUILDER_OK) return err;
+
+    if (data_size > 0) {
+        memcpy(builder->data + builder->data_length, data + offsets[0], data_size);
+    }
+
+    // Rebase the source offsets onto the end of the data buffer
+    int32_t* out = builder->offsets + builder->length + 1;
+    int64_t base = (int64_t)builder->data_length - offsets[0];
+    for (size_t i = 0; i < count; i++) {
+        out[i] = (int32_t)(base + offsets[i + 1]);
+    }
+    builder->data_length += data_size;
+
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
 struct ArrowArray* binary_builder_finish(BinaryBuilder* builder) {
     if (!builder) return NULL;
 
@@ -2900,9 +3692,9 @@ void binary_builder_reset(BinaryBuilder* builder) {
 
 void binary_builder_free(BinaryBuilder* builder) {
     if (!builder) return;
-    free(builder->offsets);
-    free(builder->data);
-    free(builder->validity);
+    arrow_mem_free(builder->offsets);
+    arrow_mem_free(builder->data);
+    arrow_mem_free(builder->validity);
     free(builder);
 }
 
@@ -2910,6 +3702,215 @@ size_t binary_builder_length(const BinaryBuilder* builder) {
     return builder ? builder->length : 0;
 }
 
+// ============================================================================
+// Large Binary Builder Implementation
+// ============================================================================
+
+LargeBinaryBuilder* large_binary_builder_create(size_t initial_capacity, size_t initial_data_capacity) {
+    if (initial_capacity == 0) initial_capacity = 1024;
+    if (initial_data_capacity == 0) initial_data_capacity = 8192;
+
+    LargeBinaryBuilder* builder = calloc(1, sizeof(LargeBinaryBuilder));
+    if (!builder) return NULL;
+
+    builder->offsets = arrow_mem_alloc((initial_capacity + 1) * sizeof(int64_t));
+    builder->data = arrow_mem_alloc(initial_data_capacity);
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->capacity = initial_capacity;
+    builder->data_capacity = initial_data_capacity;
+    builder->length = 0;
+    builder->data_length = 0;
+    builder->null_count = 0;
+
+    if (!builder->offsets || !builder->data || !builder->validity) {
+        large_binary_builder_free(builder);
+        return NULL;
+    }
+
+    builder->offsets[0] = 0;
+    return builder;
+}
+
+static int large_binary_builder_ensure_capacity(LargeBinaryBuilder* builder, size_t additional) {
+    size_t required = builder->length + additional;
+    if (required <= builder->capacity) return BUILDER_OK;
+
+    size_t new_capacity = builder->capacity * 2;
+    while (new_capacity < required) new_capacity *= 2;
+
+    int64_t* new_offsets = arrow_mem_realloc(builder->offsets, (new_capacity + 1) * sizeof(int64_t));
+    if (!new_offsets) return BUILDER_ERR_ALLOC;
+    builder->offsets = new_offsets;
+
+    size_t new_bitmap_size = bitmap_byte_count(new_capacity);
+    size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
+    if (!new_validity) return BUILDER_ERR_ALLOC;
+    memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
+    builder->validity = new_validity;
+
+    builder->capacity = new_capacity;
+    return BUILDER_OK;
+}
+
+static int large_binary_builder_ensure_data_capacity(LargeBinaryBuilder* builder, size_t additional) {
+    size_t required = builder->data_length + additional;
+    if (required <= builder->data_capacity) return BUILDER_OK;
+
+    size_t new_capacity = builder->data_capacity * 2;
+    while (new_capacity < required) new_capacity *= 2;
+
+    uint8_t* new_data = arrow_mem_realloc(builder->data, new_capacity);
+    if (!new_data) return BUILDER_ERR_ALLOC;
+    builder->data = new_data;
+    builder->data_capacity = new_capacity;
+
+    return BUILDER_OK;
+}
+
+int large_binary_builder_append(LargeBinaryBuilder* builder, const uint8_t* value, size_t length) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (!value && length > 0) return BUILDER_ERR_NULL;
+
+    int err = large_binary_builder_ensure_capacity(builder, 1);
+    if (err != BUILDER_OK) return err;
+
+    err = large_binary_builder_ensure_data_capacity(builder, length);
+    if (err != BUILDER_OK) return err;
+
+    if (length > 0) {
+        memcpy(builder->data + builder->data_length, value, length);
+    }
+    builder->data_length += length;
+
+    builder->offsets[builder->length + 1] = (int64_t)builder->data_length;
+
+    bitmap_set(builder->validity, builder->length, true);
+    builder->length++;
+
+    return BUILDER_OK;
+}
+
+int large_binary_builder_append_null(LargeBinaryBuilder* builder) {
+    if (!builder) return BUILDER_ERR_NULL;
+
+    int err = large_binary_builder_ensure_capacity(builder, 1);
+    if (err != BUILDER_OK) return err;
+
+    builder->offsets[builder->length + 1] = (int64_t)builder->data_length;
+
+    bitmap_set(builder->validity, builder->length, false);
+    builder->length++;
+    builder->null_count++;
+
+    return BUILDER_OK;
+}
+
+int large_binary_builder_append_values(LargeBinaryBuilder* builder, const int64_t* offsets, const uint8_t* data, size_t count, const uint8_t* validity) {
+    if (!builder) return BUILDER_ERR_NULL;
+    if (count == 0) return BUILDER_OK;
+    if (!offsets) return BUILDER_ERR_NULL;
+
+    size_t data_size = (size_t)(offsets[count] - offsets[0]);
+    if (!data && data_size > 0) return BUILDER_ERR_NULL;
+
+    int err = large_binary_builder_ensure_capacity(builder, count);
+    if (err != BUILDER_OK) return err;
+
+    err = large_binary_builder_ensure_data_capacity(builder, data_size);
+    if (err != BUILDER_OK) return err;
+
+    if (data_size > 0) {
+        memcpy(builder->data + builder->data_length, data + offsets[0], data_size);
+    }
+
+    // Rebase the source offsets onto the end of the data buffer
+    int64_t* out = builder->offsets + builder->length + 1;
+    int64_t base = (int64_t)builder->data_length - offsets[0];
+    for (size_t i = 0; i < count; i++) {
+        out[i] = (int64_t)(base + offsets[i + 1]);
+    }
+    builder->data_length += data_size;
+
+    builder->null_count += bitmap_append_bits(builder->validity, builder->length, validity, count);
+    builder->length += count;
+
+    return BUILDER_OK;
+}
+
+struct ArrowArray* large_binary_builder_finish(LargeBinaryBuilder* builder) {
+    if (!builder) return NULL;
+
+    struct ArrowArray* array = calloc(1, sizeof(struct ArrowArray));
+    if (!array) return NULL;
+
+    array->length = (int64_t)builder->length;
+    array->null_count = (int64_t)builder->null_count;
+    array->offset = 0;
+    array->n_buffers = 3;
+    array->n_children = 0;
+    array->children = NULL;
+    array->dictionary = NULL;
+
+    array->buffers = malloc(3 * sizeof(void*));
+    if (!array->buffers) {
+        free(array);
+        return NULL;
+    }
+
+    array->buffers[0] = builder->validity;
+    array->buffers[1] = builder->offsets;
+    array->buffers[2] = builder->data;
+
+    ArrayPrivateData* priv = malloc(sizeof(ArrayPrivateData));
+    if (!priv) {
+        free((void*)array->buffers);
+        free(array);
+        return NULL;
+    }
+    priv->buffer0 = builder->validity;
+    priv->buffer1 = builder->offsets;
+    priv->buffer2 = builder->data;
+    priv->builder = NULL;
+
+    array->private_data = priv;
+    array->release = binary_array_release;
+
+    builder->offsets = NULL;
+    builder->data = NULL;
+    builder->validity = NULL;
+    builder->length = 0;
+    builder->capacity = 0;
+    builder->data_length = 0;
+    builder->data_capacity = 0;
+    builder->null_count = 0;
+
+    return array;
+}
+
+void large_binary_builder_reset(LargeBinaryBuilder* builder) {
+    if (!builder) return;
+    builder->length = 0;
+    builder->data_length = 0;
+    builder->null_count = 0;
+    if (builder->offsets) builder->offsets[0] = 0;
+    if (builder->validity) {
+        memset(builder->validity, 0, bitmap_byte_count(builder->capacity));
+    }
+}
+
+void large_binary_builder_free(LargeBinaryBuilder* builder) {
+    if (!builder) return;
+    arrow_mem_free(builder->offsets);
+    arrow_mem_free(builder->data);
+    arrow_mem_free(builder->validity);
+    free(builder);
+}
+
+size_t large_binary_builder_length(const LargeBinaryBuilder* builder) {
+    return builder ? builder->length : 0;
+}
+
 // ============================================================================
 // Schema Builder Implementation
 // ============================================================================
@@ -3103,6 +4104,21 @@ int schema_builder_add_binary(SchemaBuilder* builder, const char* name, bool nul
     return schema_builder_add_field(builder, name, "z", flags);
 }
 
+int schema_builder_add_large_string(SchemaBuilder* builder, const char* name, bool nullable) {
+    int64_t flags = nullable ? ARROW_FLAG_NULLABLE : 0;
+    return schema_builder_add_field(builder, name, "U", flags);
+}
+
+int schema_builder_add_large_binary(SchemaBuilder* builder, const char* name, bool nullable) {
+    int64_t flags = nullable ? ARROW_FLAG_NULLABLE : 0;
+    return schema_builder_add_field(builder, name, "Z", flags);
+}
+
+int schema_builder_add_string_view(SchemaBuilder* builder, const char* name, bool nullable) {
+    int64_t flags = nullable ? ARROW_FLAG_NULLABLE : 0;
+    return schema_builder_add_field(builder, name, "vu", flags);
+}
+
 // Release callback for child schemas
 static void child_schema_release(struct ArrowSchema* schema) {
     if (!schema || !schema->release) return;
@@ -3263,6 +4279,11 @@ struct ArrowArray* record_batch_get_column(const RecordBatch* batch, size_t inde
     return batch->columns[index];
 }
 
+int record_batch_share_column(RecordBatch* batch, size_t index, struct ArrowArray* out) {
+    if (!batch || index >= batch->num_columns || !out) return -1;
+    return arrow_array_share(batch->columns[index], out);
+}
+
 size_t record_batch_num_rows(const RecordBatch* batch) {
     return batch ? batch->num_rows : 0;
 }
@@ -3414,6 +4435,14 @@ static int batch_stream_get_next(struct ArrowArrayStream* stream, struct ArrowAr
     struct ArrowArray* arr = record_batch_to_struct_array(batch);
     if (!arr) return -1;
 
+    // The struct array does not keep the batch's schema; one that is not the
+    // stream schema has no other owner
+    if (batch->schema && batch->schema != priv->schema) {
+        if (batch->schema->release) batch->schema->release(batch->schema);
+        free(batch->schema);
+        batch->schema = NULL;
+    }
+
     // Copy to output
     memcpy(out, arr, sizeof(struct ArrowArray));
     free(arr);  // Free the ArrowArray struct itself, not its contents
@@ -3432,9 +4461,17 @@ static void batch_stream_release(struct ArrowArrayStream* stream) {
 
     BatchStreamPrivate* priv = (BatchStreamPrivate*)stream->private_data;
     if (priv) {
-        // Schema is shared, only free if not consumed
-        if (!priv->schema_consumed && priv->schema) {
-            if (priv->schema->release) {
+        // Unconsumed batches may share the stream schema (batch_to_stream);
+        // it is freed once, here
+        for (size_t i = priv->current_batch; i < priv->num_batches; i++) {
+            if (priv->batches[i] && priv->batches[i]->schema == priv->schema) {
+                priv->batches[i]->schema = NULL;
+            }
+        }
+
+        // A consumed schema was moved out by get_schema; only its struct is left
+        if (priv->schema) {
+            if (!priv->schema_consumed && priv->schema->release) {
                 priv->schema->release(priv->schema);
             }
             free(priv->schema);
@@ -125,6 +125,38 @@ typedef struct {
     size_t null_count;
 } StringBuilder;
 
+// Large String Builder (like StringBuilder, with 64-bit offsets)
+typedef struct {
+    int64_t* offsets;       // Offset buffer (length + 1 elements)
+    char* data;             // Character data buffer
+    uint8_t* validity;      // Null bitmap
+    size_t length;          // Number of strings
+    size_t capacity;        // Capacity for strings (offsets)
+    size_t data_length;     // Current bytes used in data buffer
+    size_t data_capacity;   // Capacity of data buffer
+    size_t null_count;
+} LargeStringBuilder;
+
+// String View Builder (16-byte views). A view holds the int32 length, then
+// either the string itself (up to STRING_VIEW_INLINE_MAX bytes, zero padded)
+// or a 4-byte prefix, the data buffer index and the offset in that buffer.
+typedef struct {
+    uint8_t* views;         // View buffer (16 bytes per string)
+    uint8_t* validity;      // Null bitmap
+    char** data_buffers;    // Data buffers for strings stored out of line
+    int64_t* data_sizes;    // Bytes used in each data buffer
+    size_t n_data_buffers;  // Number of data buffers
+    size_t data_buffers_capacity;
+    size_t data_capacity;   // Capacity of the last data buffer
+    size_t block_size;      // Initial capacity of a new data buffer
+    size_t length;          // Number of strings
+    size_t capacity;        // Capacity for strings (views)
+    size_t null_count;
+} StringViewBuilder;
+
+#define STRING_VIEW_SIZE        16
+#define STRING_VIEW_INLINE_MAX  12
+
 // Timestamp Builder (int64 microseconds since epoch)
 typedef struct {
     int64_t* values;
@@ -204,6 +236,18 @@ typedef struct {
     size_t null_count;
 } BinaryBuilder;
 
+// Large Binary Builder (like BinaryBuilder, with 64-bit offsets)
+typedef struct {
+    int64_t* offsets;       // Offset buffer (length + 1 elements)
+    uint8_t* data;          // Binary data buffer
+    uint8_t* validity;      // Null bitmap
+    size_t length;          // Number of binary values
+    size_t capacity;        // Capacity for values (offsets)
+    size_t data_length;     // Current bytes used in data buffer
+    size_t data_capacity;   // Capacity of data buffer
+    size_t null_count;
+} LargeBinaryBuilder;
+
 // ============================================================================
 // Int8 Builder Functions
 // ============================================================================
@@ -211,6 +255,9 @@ typedef struct {
 Int8Builder* int8_builder_create(size_t initial_capacity);
 int int8_builder_append(Int8Builder* builder, int8_t value);
 int int8_builder_append_null(Int8Builder* builder);
+// Append `count` values with one capacity check and a memcpy. `validity`
+// holds one bit per value, LSB first (NULL: all valid).
+int int8_builder_append_values(Int8Builder* builder, const int8_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* int8_builder_finish(Int8Builder* builder);
 void int8_builder_reset(Int8Builder* builder);
 void int8_builder_free(Int8Builder* builder);
@@ -223,6 +270,7 @@ size_t int8_builder_length(const Int8Builder* builder);
 Int16Builder* int16_builder_create(size_t initial_capacity);
 int int16_builder_append(Int16Builder* builder, int16_t value);
 int int16_builder_append_null(Int16Builder* builder);
+int int16_builder_append_values(Int16Builder* builder, const int16_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* int16_builder_finish(Int16Builder* builder);
 void int16_builder_reset(Int16Builder* builder);
 void int16_builder_free(Int16Builder* builder);
@@ -235,6 +283,7 @@ size_t int16_builder_length(const Int16Builder* builder);
 Int32Builder* int32_builder_create(size_t initial_capacity);
 int int32_builder_append(Int32Builder* builder, int32_t value);
 int int32_builder_append_null(Int32Builder* builder);
+int int32_builder_append_values(Int32Builder* builder, const int32_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* int32_builder_finish(Int32Builder* builder);
 void int32_builder_reset(Int32Builder* builder);
 void int32_builder_free(Int32Builder* builder);
@@ -247,7 +296,7 @@ size_t int32_builder_length(const Int32Builder* builder);
 Int64Builder* int64_builder_create(size_t initial_capacity);
 int int64_builder_append(Int64Builder* builder, int64_t value);
 int int64_builder_append_null(Int64Builder* builder);
-int int64_builder_append_values(Int64Builder* builder, const int64_t* values, size_t count);
+int int64_builder_append_values(Int64Builder* builder, const int64_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* int64_builder_finish(Int64Builder* builder);
 void int64_builder_reset(Int64Builder* builder);
 void int64_builder_free(Int64Builder* builder);
@@ -260,6 +309,7 @@ size_t int64_builder_length(const Int64Builder* builder);
 UInt8Builder* uint8_builder_create(size_t initial_capacity);
 int uint8_builder_append(UInt8Builder* builder, uint8_t value);
 int uint8_builder_append_null(UInt8Builder* builder);
+int uint8_builder_append_values(UInt8Builder* builder, const uint8_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* uint8_builder_finish(UInt8Builder* builder);
 void uint8_builder_reset(UInt8Builder* builder);
 void uint8_builder_free(UInt8Builder* builder);
@@ -272,6 +322,7 @@ size_t uint8_builder_length(const UInt8Builder* builder);
 UInt16Builder* uint16_builder_create(size_t initial_capacity);
 int uint16_builder_append(UInt16Builder* builder, uint16_t value);
 int uint16_builder_append_null(UInt16Builder* builder);
+int uint16_builder_append_values(UInt16Builder* builder, const uint16_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* uint16_builder_finish(UInt16Builder* builder);
 void uint16_builder_reset(UInt16Builder* builder);
 void uint16_builder_free(UInt16Builder* builder);
@@ -284,6 +335,7 @@ size_t uint16_builder_length(const UInt16Builder* builder);
 UInt32Builder* uint32_builder_create(size_t initial_capacity);
 int uint32_builder_append(UInt32Builder* builder, uint32_t value);
 int uint32_builder_append_null(UInt32Builder* builder);
+int uint32_builder_append_values(UInt32Builder* builder, const uint32_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* uint32_builder_finish(UInt32Builder* builder);
 void uint32_builder_reset(UInt32Builder* builder);
 void uint32_builder_free(UInt32Builder* builder);
@@ -296,6 +348,7 @@ size_t uint32_builder_length(const UInt32Builder* builder);
 UInt64Builder* uint64_builder_create(size_t initial_capacity);
 int uint64_builder_append(UInt64Builder* builder, uint64_t value);
 int uint64_builder_append_null(UInt64Builder* builder);
+int uint64_builder_append_values(UInt64Builder* builder, const uint64_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* uint64_builder_finish(UInt64Builder* builder);
 void uint64_builder_reset(UInt64Builder* builder);
 void uint64_builder_free(UInt64Builder* builder);
@@ -308,6 +361,7 @@ size_t uint64_builder_length(const UInt64Builder* builder);
 Float32Builder* float32_builder_create(size_t initial_capacity);
 int float32_builder_append(Float32Builder* builder, float value);
 int float32_builder_append_null(Float32Builder* builder);
+int float32_builder_append_values(Float32Builder* builder, const float* values, size_t count, const uint8_t* validity);
 struct ArrowArray* float32_builder_finish(Float32Builder* builder);
 void float32_builder_reset(Float32Builder* builder);
 void float32_builder_free(Float32Builder* builder);
@@ -320,7 +374,7 @@ size_t float32_builder_length(const Float32Builder* builder);
 Float64Builder* float64_builder_create(size_t initial_capacity);
 int float64_builder_append(Float64Builder* builder, double value);
 int float64_builder_append_null(Float64Builder* builder);
-int float64_builder_append_values(Float64Builder* builder, const double* values, size_t count);
+int float64_builder_append_values(Float64Builder* builder, const double* values, size_t count, const uint8_t* validity);
 struct ArrowArray* float64_builder_finish(Float64Builder* builder);
 void float64_builder_reset(Float64Builder* builder);
 void float64_builder_free(Float64Builder* builder);
@@ -334,11 +388,44 @@ StringBuilder* string_builder_create(size_t initial_capacity, size_t initial_dat
 int string_builder_append(StringBuilder* builder, const char* value, size_t length);
 int string_builder_append_cstr(StringBuilder* builder, const char* value);
 int string_builder_append_null(StringBuilder* builder);
+// Append `count` strings given as Arrow offsets (count + 1 entries) and
+// data, copying the data range with a single memcpy
+int string_builder_append_values(StringBuilder* builder, const int32_t* offsets, const char* data, size_t count, const uint8_t* validity);
 struct ArrowArray* string_builder_finish(StringBuilder* builder);
 void string_builder_reset(StringBuilder* builder);
 void string_builder_free(StringBuilder* builder);
 size_t string_builder_length(const StringBuilder* builder);
 
+// ============================================================================
+// Large String Builder Functions
+// ============================================================================
+
+LargeStringBuilder* large_string_builder_create(size_t initial_capacity, size_t initial_data_capacity);
+int large_string_builder_append(LargeStringBuilder* builder, const char* value, size_t length);
+int large_string_builder_append_cstr(LargeStringBuilder* builder, const char* value);
+int large_string_builder_append_null(LargeStringBuilder* builder);
+int large_string_builder_append_values(LargeStringBuilder* builder, const int64_t* offsets, const char* data, size_t count, const uint8_t* validity);
+struct ArrowArray* large_string_builder_finish(LargeStringBuilder* builder);
+void large_string_builder_reset(LargeStringBuilder* builder);
+void large_string_builder_free(LargeStringBuilder* builder);
+size_t large_string_builder_length(const LargeStringBuilder* builder);
+
+// ============================================================================
+// String View Builder Functions
+// ============================================================================
+
+// block_size is the initial capacity of each data buffer (0: 32 KiB).
+// A new data buffer is started before one would pass INT32_MAX bytes.
+StringViewBuilder* string_view_builder_create(size_t initial_capacity, size_t block_size);
+int string_view_builder_append(StringViewBuilder* builder, const char* value, size_t length);
+int string_view_builder_append_cstr(StringViewBuilder* builder, const char* value);
+int string_view_builder_append_null(StringViewBuilder* builder);
+// Buffers: validity, views, the data buffers, then the int64 data buffer sizes
+struct ArrowArray* string_view_builder_finish(StringViewBuilder* builder);
+void string_view_builder_reset(StringViewBuilder* builder);
+void string_view_builder_free(StringViewBuilder* builder);
+size_t string_view_builder_length(const StringViewBuilder* builder);
+
 // ============================================================================
 // Timestamp Builder Functions
 // ============================================================================
@@ -346,6 +433,7 @@ size_t string_builder_length(const StringBuilder* builder);
 TimestampBuilder* timestamp_builder_create(size_t initial_capacity, const char* timezone);
 int timestamp_builder_append(TimestampBuilder* builder, int64_t microseconds);
 int timestamp_builder_append_null(TimestampBuilder* builder);
+int timestamp_builder_append_values(TimestampBuilder* builder, const int64_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* timestamp_builder_finish(TimestampBuilder* builder);
 void timestamp_builder_reset(TimestampBuilder* builder);
 void timestamp_builder_free(TimestampBuilder* builder);
@@ -359,6 +447,8 @@ const char* timestamp_builder_get_timezone(const TimestampBuilder* builder);
 BoolBuilder* bool_builder_create(size_t initial_capacity);
 int bool_builder_append(BoolBuilder* builder, bool value);
 int bool_builder_append_null(BoolBuilder* builder);
+// `values` are packed bits, like an Arrow boolean buffer
+int bool_builder_append_values(BoolBuilder* builder, const uint8_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* bool_builder_finish(BoolBuilder* builder);
 void bool_builder_reset(BoolBuilder* builder);
 void bool_builder_free(BoolBuilder* builder);
@@ -371,6 +461,7 @@ size_t bool_builder_length(const BoolBuilder* builder);
 Date32Builder* date32_builder_create(size_t initial_capacity);
 int date32_builder_append(Date32Builder* builder, int32_t days);
 int date32_builder_append_null(Date32Builder* builder);
+int date32_builder_append_values(Date32Builder* builder, const int32_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* date32_builder_finish(Date32Builder* builder);
 void date32_builder_reset(Date32Builder* builder);
 void date32_builder_free(Date32Builder* builder);
@@ -383,6 +474,7 @@ size_t date32_builder_length(const Date32Builder* builder);
 Date64Builder* date64_builder_create(size_t initial_capacity);
 int date64_builder_append(Date64Builder* builder, int64_t milliseconds);
 int date64_builder_append_null(Date64Builder* builder);
+int date64_builder_append_values(Date64Builder* builder, const int64_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* date64_builder_finish(Date64Builder* builder);
 void date64_builder_reset(Date64Builder* builder);
 void date64_builder_free(Date64Builder* builder);
@@ -395,6 +487,7 @@ size_t date64_builder_length(const Date64Builder* builder);
 Time32Builder* time32_builder_create(size_t initial_capacity, char unit);  // 's' or 'm'
 int time32_builder_append(Time32Builder* builder, int32_t value);
 int time32_builder_append_null(Time32Builder* builder);
+int time32_builder_append_values(Time32Builder* builder, const int32_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* time32_builder_finish(Time32Builder* builder);
 void time32_builder_reset(Time32Builder* builder);
 void time32_builder_free(Time32Builder* builder);
@@ -407,6 +500,7 @@ size_t time32_builder_length(const Time32Builder* builder);
 Time64Builder* time64_builder_create(size_t initial_capacity, char unit);  // 'u' or 'n'
 int time64_builder_append(Time64Builder* builder, int64_t value);
 int time64_builder_append_null(Time64Builder* builder);
+int time64_builder_append_values(Time64Builder* builder, const int64_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* time64_builder_finish(Time64Builder* builder);
 void time64_builder_reset(Time64Builder* builder);
 void time64_builder_free(Time64Builder* builder);
@@ -419,6 +513,7 @@ size_t time64_builder_length(const Time64Builder* builder);
 DurationBuilder* duration_builder_create(size_t initial_capacity, char unit);  // 's', 'm', 'u', 'n'
 int duration_builder_append(DurationBuilder* builder, int64_t value);
 int duration_builder_append_null(DurationBuilder* builder);
+int duration_builder_append_values(DurationBuilder* builder, const int64_t* values, size_t count, const uint8_t* validity);
 struct ArrowArray* duration_builder_finish(DurationBuilder* builder);
 void duration_builder_reset(DurationBuilder* builder);
 void duration_builder_free(DurationBuilder* builder);
@@ -431,11 +526,25 @@ size_t duration_builder_length(const DurationBuilder* builder);
 BinaryBuilder* binary_builder_create(size_t initial_capacity, size_t initial_data_capacity);
 int binary_builder_append(BinaryBuilder* builder, const uint8_t* value, size_t length);
 int binary_builder_append_null(BinaryBuilder* builder);
+int binary_builder_append_values(BinaryBuilder* builder, const int32_t* offsets, const uint8_t* data, size_t count, const uint8_t* validity);
 struct ArrowArray* binary_builder_finish(BinaryBuilder* builder);
 void binary_builder_reset(BinaryBuilder* builder);
 void binary_builder_free(BinaryBuilder* builder);
 size_t binary_builder_length(const BinaryBuilder* builder);
 
+// ============================================================================
+// Large Binary Builder Functions
+// ============================================================================
+
+LargeBinaryBuilder* large_binary_builder_create(size_t initial_capacity, size_t initial_data_capacity);
+int large_binary_builder_append(LargeBinaryBuilder* builder, const uint8_t* value, size_t length);
+int large_binary_builder_append_null(LargeBinaryBuilder* builder);
+int large_binary_builder_append_values(LargeBinaryBuilder* builder, const int64_t* offsets, const uint8_t* data, size_t count, const uint8_t* validity);
+struct ArrowArray* large_binary_builder_finish(LargeBinaryBuilder* builder);
+void large_binary_builder_reset(LargeBinaryBuilder* builder);
+void large_binary_builder_free(LargeBinaryBuilder* builder);
+size_t large_binary_builder_length(const LargeBinaryBuilder* builder);
+
 // ============================================================================
 // Schema Builder
 // ============================================================================
@@ -469,6 +578,9 @@ int schema_builder_add_time32(SchemaBuilder* builder, const char* name, char uni
 int schema_builder_add_time64(SchemaBuilder* builder, const char* name, char unit, bool nullable);
 int schema_builder_add_duration(SchemaBuilder* builder, const char* name, char unit, bool nullable);
 int schema_builder_add_binary(SchemaBuilder* builder, const char* name, bool nullable);
+int schema_builder_add_large_string(SchemaBuilder* builder, const char* name, bool nullable);
+int schema_builder_add_large_binary(SchemaBuilder* builder, const char* name, bool nullable);
+int schema_builder_add_string_view(SchemaBuilder* builder, const char* name, bool nullable);
 struct ArrowSchema* schema_builder_finish(SchemaBuilder* builder);
 void schema_builder_reset(SchemaBuilder* builder);
 void schema_builder_free(SchemaBuilder* builder);
@@ -500,6 +612,10 @@ struct ArrowSchema* record_batch_get_schema(const RecordBatch* batch);
 // Get a column by index (borrowed reference)
 struct ArrowArray* record_batch_get_column(const RecordBatch* batch, size_t index);
 
+// Shared reference to a column, valid after the batch is freed; the caller
+// releases `out`. Returns 0 on success, -1 on failure.
+int record_batch_share_column(RecordBatch* batch, size_t index, struct ArrowArray* out);
+
 // Get number of rows
 size_t record_batch_num_rows(const RecordBatch* batch);
 
@@ -42,6 +42,33 @@ static struct ArrowSchema* copy_schema(const struct ArrowSchema* src) {
     return copy;
 }
 
+// ============================================================================
+// Helper: Shared chunks
+// ============================================================================
+
+static void release_chunk(struct ArrowArray* chunk) {
+    if (!chunk) return;
+    if (chunk->release) {
+        chunk->release(chunk);
+    }
+    free(chunk);
+}
+
+// New reference to rows [offset, offset + length) of `chunk`
+static struct ArrowArray* share_chunk(struct ArrowArray* chunk, int64_t offset, int64_t length) {
+    struct ArrowArray* ref = (struct ArrowArray*)malloc(sizeof(struct ArrowArray));
+    if (!ref) return NULL;
+
+    int rc = offset == 0 && length == chunk->length
+        ? arrow_array_share(chunk, ref)
+        : arrow_array_share_slice(chunk, offset, length, ref);
+    if (rc != 0) {
+        free(ref);
+        return NULL;
+    }
+    return ref;
+}
+
 // ============================================================================
 // ChunkedArray Implementation
 // ============================================================================
@@ -150,18 +177,17 @@ ChunkedArray* chunked_array_slice(ChunkedArray* ca, int64_t offset, int64_t leng
         current_offset += ca->chunks[i]->length;
     }
 
-    // Copy chunk references (for now, we don't actually slice individual chunks)
-    // A proper implementation would create slice views of the arrays
+    // Each overlapping chunk contributes a sliced reference; no data is copied
     int64_t remaining = length;
     for (size_t i = start_chunk; i < ca->num_chunks && remaining > 0; i++) {
         struct ArrowArray* chunk = ca->chunks[i];
-        int64_t available = chunk->length - (i == start_chunk ? chunk_offset : 0);
+        int64_t start = i == start_chunk ? chunk_offset : 0;
+        int64_t available = chunk->length - start;
         int64_t to_take = available < remaining ? available : remaining;
 
-        // For simplicity, we just reference the whole chunk
-        // A proper implementation would create array slices
-        if (chunked_array_add_chunk(result, chunk) != 0) {
-            // Note: We're not properly handling ownership here
+        struct ArrowArray* slice = share_chunk(chunk, start, to_take);
+        if (!slice || chunked_array_add_chunk(result, slice) != 0) {
+            release_chunk(slice);
             chunked_array_free(result);
             return NULL;
         }
@@ -171,16 +197,31 @@ ChunkedArray* chunked_array_slice(ChunkedArray* ca, int64_t offset, int64_t leng
     return result;
 }
 
+ChunkedArray* chunked_array_share(ChunkedArray* ca) {
+    if (!ca) return NULL;
+
+    ChunkedArray* result = chunked_array_create(ca->type);
+    if (!result) return NULL;
+
+    for (size_t i = 0; i < ca->num_chunks; i++) {
+        struct ArrowArray* chunk = share_chunk(ca->chunks[i], 0, ca->chunks[i]->length);
+        if (!chunk || chunked_array_add_chunk(result, chunk) != 0) {
+            release_chunk(chunk);
+            chunked_array_free(result);
+            return NULL;
+        }
+    }
+
+    return result;
+}
+
 void chunked_array_free(ChunkedArray* ca) {
     if (!ca) return;
 
-    // Release all chunks
+    // Release all chunks; shared chunks only drop their reference
     if (ca->chunks) {
         for (size_t i = 0; i < ca->num_chunks; i++) {
-            if (ca->chunks[i] && ca->chunks[i]->release) {
-                ca->chunks[i]->release(ca->chunks[i]);
-                free(ca->chunks[i]);
-            }
+            release_chunk(ca->chunks[i]);
         }
         free(ca->chunks);
     }
@@ -234,17 +275,23 @@ Table* table_from_record_batch(struct ArrowArray* batch, const struct ArrowSchem
 
     // Create chunked arrays for each column
     for (size_t i = 0; i < table->num_columns && i < (size_t)batch->n_children; i++) {
-        struct ArrowArray* col_array = batch->children[i];
         struct ArrowSchema* col_schema = schema->children ? schema->children[i] : NULL;
+        if (!batch->children[i] || !col_schema) continue;
+
+        // Columns reference the batch, which stays alive until the caller
+        // and every column have released it
+        struct ArrowArray* col_array = (struct ArrowArray*)malloc(sizeof(struct ArrowArray));
+        if (!col_array || arrow_array_share_child(batch, (int64_t)i, col_array) != 0) {
+            free(col_array);
+            table_free(table);
+            return NULL;
+        }
 
-        if (col_array && col_schema) {
-            table->columns[i] = chunked_array_from_array(col_array, col_schema);
-            if (!table->columns[i]) {
-                // Don't release the batch's children since we don't own them
-                // Just mark as failed
-                table_free(table);
-                return NULL;
-            }
+        table->columns[i] = chunked_array_from_array(col_array, col_schema);
+        if (!table->columns[i]) {
+            release_chunk(col_array);
+            table_free(table);
+            return NULL;
         }
     }
 
@@ -305,17 +352,14 @@ Table* table_concatenate(Table** tables, size_t count) {
                 }
             }
 
-            // Add all chunks from this table's column
+            // Add a reference to every chunk of this table's column
             for (size_t c = 0; c < src->num_chunks; c++) {
-                struct ArrowArray* chunk = src->chunks[c];
-                if (chunk) {
-                    // Note: This doesn't properly copy the chunk
-                    // In a real implementation, we'd need to handle ownership carefully
-                    if (chunked_array_add_chunk(combined, chunk) != 0) {
-                        chunked_array_free(combined);
-                        table_free(result);
-                        return NULL;
-                    }
+                struct ArrowArray* chunk = share_chunk(src->chunks[c], 0, src->chunks[c]->length);
+                if (!chunk || chunked_array_add_chunk(combined, chunk) != 0) {
+                    release_chunk(chunk);
+                    chunked_array_free(combined);
+                    table_free(result);
+                    return NULL;
                 }
             }
         }
@@ -425,17 +469,14 @@ Table* table_select_columns(Table* table, const size_t* indices, size_t num_indi
 
     result->num_rows = table->num_rows;
 
-    // Copy selected columns
-    for (size_t i = 0; i < num_indices; i++) {
+    // Selected columns reference the source chunks
+    for (size_t i = 0; i < num_indices && i < result->num_columns; i++) {
         size_t idx = indices[i];
         if (idx < table->num_columns && table->columns[idx]) {
-            // Create a copy of the chunked array (shares chunks)
-            result->columns[i] = chunked_array_create(table->columns[idx]->type);
-            if (result->columns[i]) {
-                for (size_t c = 0; c < table->columns[idx]->num_chunks; c++) {
-                    // Note: This doesn't properly copy - shares the chunk pointers
-                    chunked_array_add_chunk(result->columns[i], table->columns[idx]->chunks[c]);
-                }
+            result->columns[i] = chunked_array_share(table->columns[idx]);
+            if (!result->columns[i]) {
+                table_free(result);
+                return NULL;
             }
         }
     }
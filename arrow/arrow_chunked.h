@@ -3,6 +3,11 @@
  *
  * ChunkedArray: Represents a single column as a sequence of contiguous chunks.
  * Table: Represents a table as a collection of ChunkedArray columns.
+ *
+ * Slices, column selections and concatenations do not copy data: their
+ * chunks are shared references (see arrow_array_share in arrow_wrapper.h)
+ * to the source chunks, whose buffers are freed when the last ChunkedArray
+ * or Table referencing them is freed.
  */
 
 #ifndef ARROW_CHUNKED_H
@@ -90,10 +95,17 @@ struct ArrowSchema* chunked_array_type(ChunkedArray* ca);
  * @param ca The ChunkedArray to slice
  * @param offset Start offset
  * @param length Number of elements to include
- * @return New ChunkedArray containing the slice
+ * @return New ChunkedArray referencing the overlapping parts of the chunks
  */
 ChunkedArray* chunked_array_slice(ChunkedArray* ca, int64_t offset, int64_t length);
 
+/**
+ * Create a ChunkedArray sharing all chunks of another.
+ * @param ca The ChunkedArray to share
+ * @return New ChunkedArray, freed independently of `ca`
+ */
+ChunkedArray* chunked_array_share(ChunkedArray* ca);
+
 /**
  * Free a ChunkedArray and all its chunks.
  */
@@ -122,6 +134,7 @@ Table* table_create(const struct ArrowSchema* schema);
 
 /**
  * Create a Table from a record batch (single-chunk columns).
+ * The columns reference the batch, which the caller still releases.
  * @param batch The record batch (struct array)
  * @param schema The schema for the batch
  * @return New Table or NULL on failure
@@ -196,7 +209,7 @@ Table* table_slice(Table* table, int64_t offset, int64_t length);
  * @param table The Table
  * @param indices Array of column indices
  * @param num_indices Number of indices
- * @return New Table with selected columns
+ * @return New Table with selected columns, sharing their chunks
  */
 Table* table_select_columns(Table* table, const size_t* indices, size_t num_indices);
 
@@ -0,0 +1,783 @@
+/**
+ * arrow_chunked_compute.c - Compute kernels over ChunkedArrays
+ */
+
+#include "arrow_chunked_compute.h"
+#include "arrow_thread_pool.h"
+#include "arrow_wrapper.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// ============================================================================
+// Task Execution
+// ============================================================================
+
+typedef void (*ChunkTaskFn)(void* ctx, size_t index);
+
+typedef struct {
+    ChunkTaskFn fn;
+    void* ctx;
+} TaskRange;
+
+static void run_task_range(void* ctx, size_t begin, size_t end) {
+    TaskRange* range = (TaskRange*)ctx;
+    for (size_t i = begin; i < end; i++) {
+        range->fn(range->ctx, i);
+    }
+}
+
+// Single-array kernels always use the pool
+static const ArrowChunkedExecOptions pool_options = {-1};
+
+// Run fn(ctx, i) for i in [0, count). Tasks write to their own slots, so
+// no ordering between them is needed.
+static void run_chunk_tasks(size_t count, ChunkTaskFn fn, void* ctx, const ArrowChunkedExecOptions* options) {
+    if (!options || options->num_threads == 0 || options->num_threads == 1) {
+        for (size_t i = 0; i < count; i++) fn(ctx, i);
+        return;
+    }
+    TaskRange range = {fn, ctx};
+    arrow_parallel_for(count, 1, run_task_range, &range);
+}
+
+// ============================================================================
+// Morsels
+// ============================================================================
+
+// Rows [offset, offset + length) of `array`
+typedef struct {
+    struct ArrowArray* array;
+    int64_t offset;
+    int64_t length;
+} Morsel;
+
+// Cut each array into ARROW_MORSEL_ROWS morsels. The boundaries depend only
+// on the input, so partial results combine the same way for every thread
+// count.
+static Morsel* split_morsels(struct ArrowArray** arrays, size_t num_arrays, size_t* out_count) {
+    size_t count = 0;
+    for (size_t i = 0; i < num_arrays; i++) {
+        count += (size_t)((arrays[i]->length + ARROW_MORSEL_ROWS - 1) / ARROW_MORSEL_ROWS);
+    }
+
+    Morsel* morsels = (Morsel*)calloc(count + 1, sizeof(Morsel));
+    if (!morsels) return NULL;
+
+    size_t m = 0;
+    for (size_t i = 0; i < num_arrays; i++) {
+        for (int64_t offset = 0; offset < arrays[i]->length; offset += ARROW_MORSEL_ROWS) {
+            int64_t left = arrays[i]->length - offset;
+            morsels[m].array = arrays[i];
+            morsels[m].offset = offset;
+            morsels[m].length = left < ARROW_MORSEL_ROWS ? left : ARROW_MORSEL_ROWS;
+            m++;
+        }
+    }
+    *out_count = count;
+    return morsels;
+}
+
+static int64_t count_nulls(const uint8_t* validity, int64_t offset, int64_t length) {
+    int64_t valid = 0;
+    int64_t i = offset, end = offset + length;
+    for (; i < end && (i & 7); i++) valid += (validity[i >> 3] >> (i & 7)) & 1;
+    for (; i + 8 <= end; i += 8) valid += __builtin_popcount(validity[i >> 3]);
+    for (; i < end; i++) valid += (validity[i >> 3] >> (i & 7)) & 1;
+    return length - valid;
+}
+
+// Borrowed, read-only view of a morsel for aggregate kernels, which keep no
+// reference to their input. The null count is exact, as kernels rely on it,
+// so an unknown (-1) count is computed from the bitmap.
+static struct ArrowArray* morsel_view(const Morsel* morsel, struct ArrowArray* view) {
+    struct ArrowArray* array = morsel->array;
+    if (morsel->offset == 0 && morsel->length == array->length && array->null_count >= 0) return array;
+
+    *view = *array;
+    view->offset = array->offset + morsel->offset;
+    view->length = morsel->length;
+    if (array->null_count != 0 && array->n_buffers > 0 && array->buffers[0]) {
+        view->null_count = count_nulls((const uint8_t*)array->buffers[0], view->offset, view->length);
+    } else {
+        view->null_count = 0;
+    }
+    view->release = NULL;
+    return view;
+}
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+static void release_array(struct ArrowArray* array) {
+    if (!array) return;
+    if (array->release) {
+        array->release(array);
+    }
+    free(array);
+}
+
+// Collect per-task results into a ChunkedArray of `type`; on any failure
+// everything is released
+static ChunkedArray* collect_results(const struct ArrowSchema* type, struct ArrowArray** results, size_t count) {
+    ChunkedArray* out = NULL;
+    bool failed = false;
+    for (size_t i = 0; i < count; i++) {
+        if (!results[i]) failed = true;
+    }
+    if (!failed) out = chunked_array_create(type);
+
+    size_t i = 0;
+    for (; out && i < count; i++) {
+        if (chunked_array_add_chunk(out, results[i]) != 0) {
+            chunked_array_free(out);
+            out = NULL;
+            break;
+        }
+    }
+    if (!out) {
+        // Chunks already added were freed with `out`
+        for (size_t j = i; j < count; j++) release_array(results[j]);
+    }
+    return out;
+}
+
+static ChunkedArray* collect_results_format(const char* format, struct ArrowArray** results, size_t count) {
+    struct ArrowSchema* type = format ? arrow_schema_init(format) : NULL;
+    ChunkedArray* out = collect_results(type, results, count);
+    if (type) arrow_schema_release(type);
+    return out;
+}
+
+// ============================================================================
+// Element-wise Operations
+// ============================================================================
+
+typedef struct {
+    struct ArrowArray** inputs;
+    ArrowChunkKernel kernel;
+    void* ctx;
+    struct ArrowArray** results;
+} MapTask;
+
+static void map_task(void* ctx, size_t index) {
+    MapTask* task = (MapTask*)ctx;
+    task->results[index] = task->kernel(task->inputs[index], task->ctx);
+}
+
+static ChunkedArray* map_impl(struct ArrowArray** inputs, size_t count, ArrowChunkKernel kernel, void* ctx,
+                              const char* result_format, const ArrowChunkedExecOptions* options) {
+    struct ArrowArray** results = (struct ArrowArray**)calloc(count + 1, sizeof(struct ArrowArray*));
+    if (!results) return NULL;
+
+    MapTask task = {inputs, kernel, ctx, results};
+    run_chunk_tasks(count, map_task, &task, options);
+
+    ChunkedArray* out = collect_results_format(result_format, results, count);
+    free(results);
+    return out;
+}
+
+ChunkedArray* arrow_chunked_map(ChunkedArray* ca, ArrowChunkKernel kernel, void* ctx,
+                                const char* result_format, const ArrowChunkedExecOptions* options) {
+    if (!ca || !kernel || !result_format) return NULL;
+    return map_impl(ca->chunks, ca->num_chunks, kernel, ctx, result_format, options);
+}
+
+static struct ArrowArray* apply_unary(struct ArrowArray* chunk, void* ctx) {
+    ArrowUnaryKernel kernel = *(ArrowUnaryKernel*)ctx;
+    return kernel(chunk);
+}
+
+ChunkedArray* arrow_chunked_unary(ChunkedArray* ca, ArrowUnaryKernel kernel,
+                                  const char* result_format, const ArrowChunkedExecOptions* options) {
+    if (!kernel) return NULL;
+    return arrow_chunked_map(ca, apply_unary, &kernel, result_format, options);
+}
+
+// One aligned piece of two ChunkedArrays. A piece covering a whole chunk
+// points at it; otherwise it points at a shared slice held in the view.
+typedef struct {
+    struct ArrowArray* a;
+    struct ArrowArray* b;
+    struct ArrowArray a_view;
+    struct ArrowArray b_view;
+} BinaryPiece;
+
+typedef struct {
+    BinaryPiece* pieces;
+    ArrowBinaryKernel kernel;
+    struct ArrowArray** results;
+} BinaryTask;
+
+static void binary_task(void* ctx, size_t index) {
+    BinaryTask* task = (BinaryTask*)ctx;
+    task->results[index] = task->kernel(task->pieces[index].a, task->pieces[index].b);
+}
+
+static struct ArrowArray* piece_of(struct ArrowArray* chunk, int64_t offset, int64_t length,
+                                   struct ArrowArray* view) {
+    if (offset == 0 && length == chunk->length) return chunk;
+    return arrow_array_share_slice(chunk, offset, length, view) == 0 ? view : NULL;
+}
+
+static void release_pieces(BinaryPiece* pieces, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (pieces[i].a == &pieces[i].a_view && pieces[i].a_view.release) pieces[i].a_view.release(&pieces[i].a_view);
+        if (pieces[i].b == &pieces[i].b_view && pieces[i].b_view.release) pieces[i].b_view.release(&pieces[i].b_view);
+    }
+    free(pieces);
+}
+
+// Split a and b at the union of their chunk boundaries. Slices are made
+// here, on the calling thread, since sharing converts the source chunk.
+static BinaryPiece* align_chunks(ChunkedArray* a, ChunkedArray* b, size_t* out_count) {
+    size_t capacity = a->num_chunks + b->num_chunks + 1;
+    BinaryPiece* pieces = (BinaryPiece*)calloc(capacity, sizeof(BinaryPiece));
+    if (!pieces) return NULL;
+
+    size_t count = 0, ia = 0, ib = 0;
+    int64_t oa = 0, ob = 0;     // offsets within the current chunks
+    while (ia < a->num_chunks && ib < b->num_chunks) {
+        struct ArrowArray* ca = a->chunks[ia];
+        struct ArrowArray* cb = b->chunks[ib];
+        int64_t left_a = ca->length - oa;
+        int64_t left_b = cb->length - ob;
+        int64_t length = left_a < left_b ? left_a : left_b;
+
+        if (length > 0) {
+            BinaryPiece* piece = &pieces[count];
+            piece->a = piece_of(ca, oa, length, &piece->a_view);
+            piece->b = piece_of(cb, ob, length, &piece->b_view);
+            count++;
+            if (!piece->a || !piece->b) {
+                release_pieces(pieces, count);
+                return NULL;
+            }
+        }
+
+        oa += length;
+        ob += length;
+        if (oa == ca->length) { ia++; oa = 0; }
+        if (ob == cb->length) { ib++; ob = 0; }
+    }
+
+    *out_count = count;
+    return pieces;
+}
+
+// Run `kernel` over the pieces and release them
+static ChunkedArray* run_binary_pieces(BinaryPiece* pieces, size_t count, ArrowBinaryKernel kernel,
+                                       const struct ArrowSchema* type, const char* format,
+                                       const ArrowChunkedExecOptions* options) {
+    struct ArrowArray** results = (struct ArrowArray**)calloc(count + 1, sizeof(struct ArrowArray*));
+    if (!results) {
+        release_pieces(pieces, count);
+        return NULL;
+    }
+
+    BinaryTask task = {pieces, kernel, results};
+    run_chunk_tasks(count, binary_task, &task, options);
+    release_pieces(pieces, count);
+
+    ChunkedArray* out = type ? collect_results(type, results, count)
+                             : collect_results_format(format, results, count);
+    free(results);
+    return out;
+}
+
+static ChunkedArray* binary_impl(ChunkedArray* a, ChunkedArray* b, ArrowBinaryKernel kernel,
+                                 const struct ArrowSchema* type, const char* format,
+                                 const ArrowChunkedExecOptions* options) {
+    if (chunked_array_length(a) != chunked_array_length(b)) return NULL;
+
+    size_t count = 0;
+    BinaryPiece* pieces = align_chunks(a, b, &count);
+    if (!pieces) return NULL;
+    return run_binary_pieces(pieces, count, kernel, type, format, options);
+}
+
+ChunkedArray* arrow_chunked_binary(ChunkedArray* a, ChunkedArray* b, ArrowBinaryKernel kernel,
+                                   const char* result_format, const ArrowChunkedExecOptions* options) {
+    if (!a || !b || !kernel || !result_format) return NULL;
+    return binary_impl(a, b, kernel, NULL, result_format, options);
+}
+
+// ============================================================================
+// Filter/Take
+// ============================================================================
+
+ChunkedArray* arrow_chunked_filter(ChunkedArray* values, ChunkedArray* bool_mask,
+                                   ArrowBinaryKernel filter_kernel, const ArrowChunkedExecOptions* options) {
+    if (!values || !bool_mask || !filter_kernel) return NULL;
+    return binary_impl(values, bool_mask, filter_kernel, values->type, NULL, options);
+}
+
+typedef struct {
+    struct ArrowArray* chunk;
+    struct ArrowArray indices;      // view into the local index buffer
+} TakeRun;
+
+typedef struct {
+    TakeRun* runs;
+    ArrowBinaryKernel kernel;
+    struct ArrowArray** results;
+} TakeTask;
+
+static void take_task(void* ctx, size_t index) {
+    TakeTask* task = (TakeTask*)ctx;
+    task->results[index] = task->kernel(task->runs[index].chunk, &task->runs[index].indices);
+}
+
+// Chunk holding global position `pos`, given the chunk start offsets
+static size_t find_chunk(const int64_t* starts, size_t num_chunks, int64_t pos) {
+    size_t lo = 0, hi = num_chunks;
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (starts[mid] <= pos) lo = mid; else hi = mid;
+    }
+    return lo;
+}
+
+ChunkedArray* arrow_chunked_take(ChunkedArray* values, struct ArrowArray* int32_indices,
+                                 ArrowBinaryKernel take_kernel, const ArrowChunkedExecOptions* options) {
+    if (!values || !int32_indices || !take_kernel) return NULL;
+
+    int64_t n = int32_indices->length;
+    if (values->num_chunks == 0 || n == 0) return chunked_array_create(values->type);
+
+    int64_t* starts = (int64_t*)malloc(values->num_chunks * sizeof(int64_t));
+    int32_t* local = (int32_t*)malloc((size_t)n * sizeof(int32_t));
+    TakeRun* runs = (TakeRun*)calloc((size_t)n, sizeof(TakeRun));
+    struct ArrowArray** results = (struct ArrowArray**)calloc((size_t)n, sizeof(struct ArrowArray*));
+    // Index views borrow `local`; their buffer pointers live here
+    const void** index_buffers = (const void**)calloc(2 * (size_t)n, sizeof(void*));
+    ChunkedArray* out = NULL;
+    if (!starts || !local || !runs || !results || !index_buffers) goto done;
+
+    int64_t start = 0;
+    for (size_t c = 0; c < values->num_chunks; c++) {
+        starts[c] = start;
+        start += values->chunks[c]->length;
+    }
+
+    const uint8_t* validity = int32_indices->null_count != 0 ? (const uint8_t*)int32_indices->buffers[0] : NULL;
+    const int32_t* global = (const int32_t*)int32_indices->buffers[1] + int32_indices->offset;
+
+    // Translate to chunk-local indices; null and out-of-range indices stay
+    // in the current run as -1
+    size_t num_runs = 0;
+    size_t current = 0;
+    int64_t run_start = 0;
+    for (int64_t i = 0; i < n; i++) {
+        int64_t bit = int32_indices->offset + i;
+        bool valid = !validity || ((validity[bit >> 3] >> (bit & 7)) & 1);
+        int32_t idx = global[i];
+        size_t chunk = current;
+        if (valid && idx >= 0 && idx < values->total_length) {
+            chunk = find_chunk(starts, values->num_chunks, idx);
+            local[i] = (int32_t)(idx - starts[chunk]);
+        } else {
+            local[i] = -1;
+        }
+
+        if (i > 0 && chunk != current) {
+            runs[num_runs].chunk = values->chunks[current];
+            runs[num_runs].indices.length = i - run_start;
+            runs[num_runs].indices.n_buffers = 2;
+            num_runs++;
+            run_start = i;
+        }
+        current = chunk;
+    }
+    runs[num_runs].chunk = values->chunks[current];
+    runs[num_runs].indices.length = n - run_start;
+    runs[num_runs].indices.n_buffers = 2;
+    num_runs++;
+
+    int64_t offset = 0;
+    for (size_t r = 0; r < num_runs; r++) {
+        index_buffers[2 * r + 1] = local + offset;
+        runs[r].indices.buffers = &index_buffers[2 * r];
+        offset += runs[r].indices.length;
+    }
+
+    TakeTask task = {runs, take_kernel, results};
+    run_chunk_tasks(num_runs, take_task, &task, options);
+
+    out = collect_results(values->type, results, num_runs);
+
+done:
+    free(starts);
+    free(local);
+    free(runs);
+    free(results);
+    free(index_buffers);
+    return out;
+}
+
+// ============================================================================
+// Aggregation Operations
+// ============================================================================
+
+typedef enum {
+    AGG_MIN_INT64,
+    AGG_MAX_INT64,
+    AGG_MIN_FLOAT64,
+    AGG_MAX_FLOAT64,
+    AGG_SUM_INT64,
+    AGG_SUM_FLOAT64,
+    AGG_MEAN_INT64,
+    AGG_MEAN_FLOAT64,
+    AGG_VARIANCE_FLOAT64,
+    AGG_ANY,
+    AGG_ALL
+} AggregateKind;
+
+// Partial result of one chunk
+typedef struct {
+    AggregateResult value;
+    int64_t count;      // non-null values (mean and variance)
+    double m2;          // sum of squared deviations from the chunk mean
+} AggregatePartial;
+
+typedef struct {
+    const Morsel* morsels;
+    AggregateKind kind;
+    AggregatePartial* partials;
+} AggregateTask;
+
+static void aggregate_task(void* ctx, size_t index) {
+    AggregateTask* task = (AggregateTask*)ctx;
+    struct ArrowArray view;
+    struct ArrowArray* chunk = morsel_view(&task->morsels[index], &view);
+    AggregatePartial* partial = &task->partials[index];
+
+    switch (task->kind) {
+        case AGG_MIN_INT64: partial->value = arrow_min_int64(chunk); break;
+        case AGG_MAX_INT64: partial->value = arrow_max_int64(chunk); break;
+        case AGG_MIN_FLOAT64: partial->value = arrow_min_float64(chunk); break;
+        case AGG_MAX_FLOAT64: partial->value = arrow_max_float64(chunk); break;
+        case AGG_SUM_INT64:
+        case AGG_MEAN_INT64:
+            partial->value = arrow_sum_int64(chunk);
+            partial->count = arrow_count(chunk);
+            break;
+        case AGG_SUM_FLOAT64:
+        case AGG_MEAN_FLOAT64:
+            partial->value = arrow_sum_float64(chunk);
+            partial->count = arrow_count(chunk);
+            break;
+        case AGG_VARIANCE_FLOAT64: {
+            partial->value = arrow_mean_float64(chunk);
+            partial->count = arrow_count(chunk);
+            AggregateResult variance = arrow_variance_float64(chunk);
+            partial->m2 = variance.is_valid ? variance.f64_value * (double)(partial->count - 1) : 0.0;
+            break;
+        }
+        case AGG_ANY:
+            partial->value.is_valid = true;
+            partial->value.i64_value = arrow_any(chunk);
+            break;
+        case AGG_ALL:
+            partial->value.is_valid = true;
+            partial->value.i64_value = arrow_all(chunk);
+            break;
+    }
+}
+
+// Fold the partials in morsel order
+static AggregateResult combine_partials(AggregateKind kind, const AggregatePartial* partials, size_t count) {
+    AggregateResult result = {false, 0, 0.0};
+    int64_t total = 0;
+    double mean = 0.0, m2 = 0.0;
+
+    if (kind == AGG_ANY || kind == AGG_ALL) {
+        result.is_valid = true;
+        result.i64_value = kind == AGG_ALL;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const AggregatePartial* p = &partials[i];
+        switch (kind) {
+            case AGG_MIN_INT64:
+            case AGG_MAX_INT64:
+                if (p->value.is_valid &&
+                    (!result.is_valid || (kind == AGG_MIN_INT64 ? p->value.i64_value < result.i64_value
+                                                                : p->value.i64_value > result.i64_value))) {
+                    result = p->value;
+                }
+                break;
+            case AGG_MIN_FLOAT64:
+            case AGG_MAX_FLOAT64:
+                if (p->value.is_valid &&
+                    (!result.is_valid || (kind == AGG_MIN_FLOAT64 ? p->value.f64_value < result.f64_value
+                                                                  : p->value.f64_value > result.f64_value))) {
+                    result = p->value;
+                }
+                break;
+            case AGG_SUM_INT64:
+            case AGG_MEAN_INT64:
+                if (p->value.is_valid) {
+                    result.is_valid = true;
+                    result.i64_value += p->value.i64_value;
+                    total += p->count;
+                }
+                break;
+            case AGG_SUM_FLOAT64:
+            case AGG_MEAN_FLOAT64:
+                if (p->value.is_valid) {
+                    result.is_valid = true;
+                    result.f64_value += p->value.f64_value;
+                    total += p->count;
+                }
+                break;
+            case AGG_VARIANCE_FLOAT64:
+                if (p->value.is_valid && p->count > 0) {
+                    // Chan et al. pairwise update of (count, mean, M2)
+                    int64_t merged = total + p->count;
+                    double delta = p->value.f64_value - mean;
+                    mean += delta * (double)p->count / (double)merged;
+                    m2 += p->m2 + delta * delta * (double)total * (double)p->count / (double)merged;
+                    total = merged;
+                }
+                break;
+            case AGG_ANY:
+                result.i64_value = result.i64_value || p->value.i64_value;
+                break;
+            case AGG_ALL:
+                result.i64_value = result.i64_value && p->value.i64_value;
+                break;
+        }
+    }
+
+    if (kind == AGG_MEAN_INT64 && result.is_valid) {
+        result.is_valid = total > 0;
+        result.f64_value = total > 0 ? (double)result.i64_value / (double)total : 0.0;
+        result.i64_value = 0;
+    } else if (kind == AGG_MEAN_FLOAT64 && result.is_valid) {
+        result.is_valid = total > 0;
+        result.f64_value = total > 0 ? result.f64_value / (double)total : 0.0;
+    } else if (kind == AGG_VARIANCE_FLOAT64) {
+        result.is_valid = total > 1;
+        result.f64_value = total > 1 ? m2 / (double)(total - 1) : 0.0;
+    }
+    return result;
+}
+
+static AggregateResult aggregate_arrays(struct ArrowArray** arrays, size_t num_arrays, AggregateKind kind,
+                                        const ArrowChunkedExecOptions* options) {
+    AggregateResult result = {false, 0, 0.0};
+    size_t count = 0;
+    Morsel* morsels = split_morsels(arrays, num_arrays, &count);
+    AggregatePartial* partials = (AggregatePartial*)calloc(count + 1, sizeof(AggregatePartial));
+    if (morsels && partials) {
+        AggregateTask task = {morsels, kind, partials};
+        run_chunk_tasks(count, aggregate_task, &task, options);
+        result = combine_partials(kind, partials, count);
+    }
+
+    free(morsels);
+    free(partials);
+    return result;
+}
+
+static AggregateResult aggregate(ChunkedArray* ca, AggregateKind kind, const ArrowChunkedExecOptions* options) {
+    AggregateResult result = {false, 0, 0.0};
+    if (!ca) return result;
+    return aggregate_arrays(ca->chunks, ca->num_chunks, kind, options);
+}
+
+AggregateResult arrow_chunked_min_int64(ChunkedArray* ca, const ArrowChunkedExecOptions* options) {
+    return aggregate(ca, AGG_MIN_INT64, options);
+}
+
+AggregateResult arrow_chunked_max_int64(ChunkedArray* ca, const ArrowChunkedExecOptions* options) {
+    return aggregate(ca, AGG_MAX_INT64, options);
+}
+
+AggregateResult arrow_chunked_min_float64(ChunkedArray* ca, const ArrowChunkedExecOptions* options) {
+    return aggregate(ca, AGG_MIN_FLOAT64, options);
+}
+
+AggregateResult arrow_chunked_max_float64(ChunkedArray* ca, const ArrowChunkedExecOptions* options) {
+    return aggregate(ca, AGG_MAX_FLOAT64, options);
+}
+
+AggregateResult arrow_chunked_sum_int64(ChunkedArray* ca, const ArrowChunkedExecOptions* options) {
+    return aggregate(ca, AGG_SUM_INT64, options);
+}
+
+AggregateResult arrow_chunked_sum_float64(ChunkedArray* ca, const ArrowChunkedExecOptions* options) {
+    return aggregate(ca, AGG_SUM_FLOAT64, options);
+}
+
+AggregateResult arrow_chunked_mean_int64(ChunkedArray* ca, const ArrowChunkedExecOptions* options) {
+    return aggregate(ca, AGG_MEAN_INT64, options);
+}
+
+AggregateResult arrow_chunked_mean_float64(ChunkedArray* ca, const ArrowChunkedExecOptions* options) {
+    return aggregate(ca, AGG_MEAN_FLOAT64, options);
+}
+
+AggregateResult arrow_chunked_variance_float64(ChunkedArray* ca, const ArrowChunkedExecOptions* options) {
+    return aggregate(ca, AGG_VARIANCE_FLOAT64, options);
+}
+
+AggregateResult arrow_chunked_stddev_float64(ChunkedArray* ca, const ArrowChunkedExecOptions* options) {
+    AggregateResult var = aggregate(ca, AGG_VARIANCE_FLOAT64, options);
+    if (var.is_valid) {
+        var.f64_value = sqrt(var.f64_value);
+    }
+    return var;
+}
+
+int64_t arrow_chunked_count(ChunkedArray* ca) {
+    if (!ca) return 0;
+    int64_t count = 0;
+    for (size_t i = 0; i < ca->num_chunks; i++) {
+        struct ArrowArray* chunk = ca->chunks[i];
+        int64_t nulls = chunk->null_count;
+        if (nulls < 0) {
+            nulls = chunk->n_buffers > 0 && chunk->buffers[0]
+                ? count_nulls((const uint8_t*)chunk->buffers[0], chunk->offset, chunk->length)
+                : 0;
+        }
+        count += chunk->length - nulls;
+    }
+    return count;
+}
+
+bool arrow_chunked_any(ChunkedArray* ca, const ArrowChunkedExecOptions* options) {
+    return aggregate(ca, AGG_ANY, options).i64_value != 0;
+}
+
+bool arrow_chunked_all(ChunkedArray* ca, const ArrowChunkedExecOptions* options) {
+    return aggregate(ca, AGG_ALL, options).i64_value != 0;
+}
+
+// ============================================================================
+// Single Arrays
+// ============================================================================
+
+// Pieces of one or two equal-length arrays at morsel boundaries; `b` may be
+// NULL. Slices are made on the calling thread, as in align_chunks.
+static BinaryPiece* split_pieces(struct ArrowArray* a, struct ArrowArray* b, size_t* out_count) {
+    size_t count = (size_t)((a->length + ARROW_MORSEL_ROWS - 1) / ARROW_MORSEL_ROWS);
+    BinaryPiece* pieces = (BinaryPiece*)calloc(count + 1, sizeof(BinaryPiece));
+    if (!pieces) return NULL;
+
+    for (size_t i = 0; i < count; i++) {
+        int64_t offset = (int64_t)i * ARROW_MORSEL_ROWS;
+        int64_t left = a->length - offset;
+        int64_t length = left < ARROW_MORSEL_ROWS ? left : ARROW_MORSEL_ROWS;
+        BinaryPiece* piece = &pieces[i];
+        piece->a = piece_of(a, offset, length, &piece->a_view);
+        piece->b = b ? piece_of(b, offset, length, &piece->b_view) : NULL;
+        if (!piece->a || (b && !piece->b)) {
+            release_pieces(pieces, i + 1);
+            return NULL;
+        }
+    }
+
+    *out_count = count;
+    return pieces;
+}
+
+ChunkedArray* arrow_parallel_map(struct ArrowArray* a, ArrowChunkKernel kernel, void* ctx,
+                                 const char* result_format) {
+    if (!a || !kernel || !result_format) return NULL;
+
+    size_t count = 0;
+    BinaryPiece* pieces = split_pieces(a, NULL, &count);
+    if (!pieces) return NULL;
+
+    ChunkedArray* out = NULL;
+    struct ArrowArray** inputs = (struct ArrowArray**)calloc(count + 1, sizeof(struct ArrowArray*));
+    if (inputs) {
+        for (size_t i = 0; i < count; i++) inputs[i] = pieces[i].a;
+        out = map_impl(inputs, count, kernel, ctx, result_format, &pool_options);
+        free(inputs);
+    }
+    release_pieces(pieces, count);
+    return out;
+}
+
+ChunkedArray* arrow_parallel_unary(struct ArrowArray* a, ArrowUnaryKernel kernel, const char* result_format) {
+    if (!kernel) return NULL;
+    return arrow_parallel_map(a, apply_unary, &kernel, result_format);
+}
+
+ChunkedArray* arrow_parallel_binary(struct ArrowArray* a, struct ArrowArray* b, ArrowBinaryKernel kernel,
+                                    const char* result_format) {
+    if (!a || !b || !kernel || !result_format || a->length != b->length) return NULL;
+
+    size_t count = 0;
+    BinaryPiece* pieces = split_pieces(a, b, &count);
+    if (!pieces) return NULL;
+    return run_binary_pieces(pieces, count, kernel, NULL, result_format, &pool_options);
+}
+
+ChunkedArray* arrow_parallel_filter(struct ArrowArray* values, struct ArrowArray* bool_mask,
+                                    ArrowBinaryKernel filter_kernel, const char* result_format) {
+    return arrow_parallel_binary(values, bool_mask, filter_kernel, result_format);
+}
+
+static AggregateResult aggregate_array(struct ArrowArray* a, AggregateKind kind) {
+    AggregateResult result = {false, 0, 0.0};
+    if (!a) return result;
+    return aggregate_arrays(&a, 1, kind, &pool_options);
+}
+
+AggregateResult arrow_parallel_min_int64(struct ArrowArray* a) {
+    return aggregate_array(a, AGG_MIN_INT64);
+}
+
+AggregateResult arrow_parallel_max_int64(struct ArrowArray* a) {
+    return aggregate_array(a, AGG_MAX_INT64);
+}
+
+AggregateResult arrow_parallel_min_float64(struct ArrowArray* a) {
+    return aggregate_array(a, AGG_MIN_FLOAT64);
+}
+
+AggregateResult arrow_parallel_max_float64(struct ArrowArray* a) {
+    return aggregate_array(a, AGG_MAX_FLOAT64);
+}
+
+AggregateResult arrow_parallel_sum_int64(struct ArrowArray* a) {
+    return aggregate_array(a, AGG_SUM_INT64);
+}
+
+AggregateResult arrow_parallel_sum_float64(struct ArrowArray* a) {
+    return aggregate_array(a, AGG_SUM_FLOAT64);
+}
+
+AggregateResult arrow_parallel_mean_int64(struct ArrowArray* a) {
+    return aggregate_array(a, AGG_MEAN_INT64);
+}
+
+AggregateResult arrow_parallel_mean_float64(struct ArrowArray* a) {
+    return aggregate_array(a, AGG_MEAN_FLOAT64);
+}
+
+AggregateResult arrow_parallel_variance_float64(struct ArrowArray* a) {
+    return aggregate_array(a, AGG_VARIANCE_FLOAT64);
+}
+
+AggregateResult arrow_parallel_stddev_float64(struct ArrowArray* a) {
+    AggregateResult var = aggregate_array(a, AGG_VARIANCE_FLOAT64);
+    if (var.is_valid) {
+        var.f64_value = sqrt(var.f64_value);
+    }
+    return var;
+}
+
+bool arrow_parallel_any(struct ArrowArray* a) {
+    return aggregate_array(a, AGG_ANY).i64_value != 0;
+}
+
+bool arrow_parallel_all(struct ArrowArray* a) {
+    return aggregate_array(a, AGG_ALL).i64_value != 0;
+}
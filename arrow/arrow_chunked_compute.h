@@ -0,0 +1,141 @@
+/**
+ * arrow_chunked_compute.h - Compute kernels over ChunkedArrays
+ *
+ * Runs the single-array kernels of arrow_compute.h chunk by chunk, so a
+ * column read from many row groups is processed without concatenating it.
+ * Element-wise results keep the chunk layout of their input; aggregates
+ * combine the partial result of each chunk.
+ *
+ * Chunks may be processed on the shared thread pool (arrow_thread_pool.h).
+ * Aggregates split chunks into ARROW_MORSEL_ROWS morsels and combine the
+ * partial results in morsel order, so a result does not depend on the
+ * thread count. Worker threads allocate from the calling thread's memory
+ * pool.
+ *
+ * The arrow_parallel_* functions run the same kernels over one large array,
+ * always on the pool, one morsel per task.
+ */
+
+#ifndef ARROW_CHUNKED_COMPUTE_H
+#define ARROW_CHUNKED_COMPUTE_H
+
+#include "arrow_chunked.h"
+#include "arrow_compute.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Execution Options
+// ============================================================================
+
+typedef struct {
+    int num_threads;    // 0 or 1: calling thread only; otherwise the shared thread pool
+} ArrowChunkedExecOptions;
+
+// Kernel signatures of arrow_compute.h; ChunkKernel passes a context
+// through, e.g. for scalar arguments
+typedef struct ArrowArray* (*ArrowUnaryKernel)(struct ArrowArray* a);
+typedef struct ArrowArray* (*ArrowBinaryKernel)(struct ArrowArray* a, struct ArrowArray* b);
+typedef struct ArrowArray* (*ArrowChunkKernel)(struct ArrowArray* chunk, void* ctx);
+
+// ============================================================================
+// Element-wise Operations
+// ============================================================================
+
+// Apply `kernel` to every chunk. The result has one chunk per input chunk
+// and type `result_format`. `options` may be NULL (sequential).
+// Returns NULL if any chunk fails.
+ChunkedArray* arrow_chunked_map(ChunkedArray* ca, ArrowChunkKernel kernel, void* ctx,
+                                const char* result_format, const ArrowChunkedExecOptions* options);
+ChunkedArray* arrow_chunked_unary(ChunkedArray* ca, ArrowUnaryKernel kernel,
+                                  const char* result_format, const ArrowChunkedExecOptions* options);
+
+// Apply `kernel` to aligned pieces of two equal-length ChunkedArrays. Where
+// chunk boundaries differ, the pieces are zero-copy slices.
+ChunkedArray* arrow_chunked_binary(ChunkedArray* a, ChunkedArray* b, ArrowBinaryKernel kernel,
+                                   const char* result_format, const ArrowChunkedExecOptions* options);
+
+// ============================================================================
+// Filter/Take
+// ============================================================================
+
+// Filter with a boolean ChunkedArray of the same length, e.g.
+// arrow_chunked_filter(values, mask, arrow_filter_int64, NULL)
+ChunkedArray* arrow_chunked_filter(ChunkedArray* values, ChunkedArray* bool_mask,
+                                   ArrowBinaryKernel filter_kernel, const ArrowChunkedExecOptions* options);
+
+// Take by int32 indices into the whole ChunkedArray. Each run of
+// consecutive indices falling in one chunk becomes one result chunk, so
+// sorted or clustered indices give few chunks and random ones many small
+// chunks. Null and out-of-range indices behave as in the take kernel.
+ChunkedArray* arrow_chunked_take(ChunkedArray* values, struct ArrowArray* int32_indices,
+                                 ArrowBinaryKernel take_kernel, const ArrowChunkedExecOptions* options);
+
+// ============================================================================
+// Aggregation Operations
+// ============================================================================
+
+AggregateResult arrow_chunked_min_int64(ChunkedArray* ca, const ArrowChunkedExecOptions* options);
+AggregateResult arrow_chunked_max_int64(ChunkedArray* ca, const ArrowChunkedExecOptions* options);
+AggregateResult arrow_chunked_min_float64(ChunkedArray* ca, const ArrowChunkedExecOptions* options);
+AggregateResult arrow_chunked_max_float64(ChunkedArray* ca, const ArrowChunkedExecOptions* options);
+
+AggregateResult arrow_chunked_sum_int64(ChunkedArray* ca, const ArrowChunkedExecOptions* options);
+AggregateResult arrow_chunked_sum_float64(ChunkedArray* ca, const ArrowChunkedExecOptions* options);
+
+// Mean (always returns float64)
+AggregateResult arrow_chunked_mean_int64(ChunkedArray* ca, const ArrowChunkedExecOptions* options);
+AggregateResult arrow_chunked_mean_float64(ChunkedArray* ca, const ArrowChunkedExecOptions* options);
+
+// Sample variance and standard deviation, merging per-chunk moments
+AggregateResult arrow_chunked_variance_float64(ChunkedArray* ca, const ArrowChunkedExecOptions* options);
+AggregateResult arrow_chunked_stddev_float64(ChunkedArray* ca, const ArrowChunkedExecOptions* options);
+
+// Count non-null values
+int64_t arrow_chunked_count(ChunkedArray* ca);
+
+// Any/All for boolean ChunkedArrays
+bool arrow_chunked_any(ChunkedArray* ca, const ArrowChunkedExecOptions* options);
+bool arrow_chunked_all(ChunkedArray* ca, const ArrowChunkedExecOptions* options);
+
+// ============================================================================
+// Single Arrays, by Morsel
+// ============================================================================
+
+// Element-wise kernels over zero-copy morsel slices of `a` (and `b`). The
+// result has one chunk per morsel and type `result_format`.
+ChunkedArray* arrow_parallel_map(struct ArrowArray* a, ArrowChunkKernel kernel, void* ctx,
+                                 const char* result_format);
+ChunkedArray* arrow_parallel_unary(struct ArrowArray* a, ArrowUnaryKernel kernel, const char* result_format);
+ChunkedArray* arrow_parallel_binary(struct ArrowArray* a, struct ArrowArray* b, ArrowBinaryKernel kernel,
+                                    const char* result_format);
+
+// Filter with a boolean array of the same length; `result_format` is the
+// format of `values`
+ChunkedArray* arrow_parallel_filter(struct ArrowArray* values, struct ArrowArray* bool_mask,
+                                    ArrowBinaryKernel filter_kernel, const char* result_format);
+
+AggregateResult arrow_parallel_min_int64(struct ArrowArray* a);
+AggregateResult arrow_parallel_max_int64(struct ArrowArray* a);
+AggregateResult arrow_parallel_min_float64(struct ArrowArray* a);
+AggregateResult arrow_parallel_max_float64(struct ArrowArray* a);
+
+AggregateResult arrow_parallel_sum_int64(struct ArrowArray* a);
+AggregateResult arrow_parallel_sum_float64(struct ArrowArray* a);
+
+AggregateResult arrow_parallel_mean_int64(struct ArrowArray* a);
+AggregateResult arrow_parallel_mean_float64(struct ArrowArray* a);
+
+AggregateResult arrow_parallel_variance_float64(struct ArrowArray* a);
+AggregateResult arrow_parallel_stddev_float64(struct ArrowArray* a);
+
+bool arrow_parallel_any(struct ArrowArray* a);
+bool arrow_parallel_all(struct ArrowArray* a);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARROW_CHUNKED_COMPUTE_H
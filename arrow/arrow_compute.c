@@ -1,5 +1,9 @@
 #include "arrow_compute.h"
 #include "arrow_builders.h"
+#define ARROW_MEMORY_SUBSYSTEM ARROW_MEMORY_COMPUTE
+#include "arrow_memory.h"
+#include "arrow_thread_pool.h"
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
@@ -44,21 +48,71 @@ static bool get_bool_at(struct ArrowArray* a, int64_t idx) {
     return (data[actual_idx / 8] >> (actual_idx % 8)) & 1;
 }
 
+// Physical layout of a string array. Arrays do not carry their format, so
+// the string kernels are told which layout they are reading.
+typedef enum {
+    STRING_LAYOUT_UTF8,   // "u": int32 offsets
+    STRING_LAYOUT_LARGE,  // "U": int64 offsets
+    STRING_LAYOUT_VIEW    // "vu": 16-byte views
+} StringLayout;
+
+// View of element idx of a string view array
+static const uint8_t* get_view_at(struct ArrowArray* a, int64_t idx) {
+    return (const uint8_t*)a->buffers[1] + (idx + a->offset) * STRING_VIEW_SIZE;
+}
+
+// Data of a view: inline, or in the data buffer the view points to
+static const char* view_data(struct ArrowArray* a, const uint8_t* view, int32_t len) {
+    if (len <= STRING_VIEW_INLINE_MAX) return (const char*)view + 4;
+    int32_t buffer_index, offset;
+    memcpy(&buffer_index, view + 8, 4);
+    memcpy(&offset, view + 12, 4);
+    return (const char*)a->buffers[2 + buffer_index] + offset;
+}
+
 // Get string at index (returns pointer and length, not a copy)
-static const char* get_string_at(struct ArrowArray* a, int64_t idx, int32_t* out_len) {
-    const int32_t* offsets = (const int32_t*)a->buffers[1];
-    const char* data = (const char*)a->buffers[2];
+static const char* get_string_at(struct ArrowArray* a, StringLayout layout, int64_t idx, int64_t* out_len) {
     int64_t actual_idx = idx + a->offset;
-    int32_t start = offsets[actual_idx];
-    int32_t end = offsets[actual_idx + 1];
-    *out_len = end - start;
-    return data + start;
+    switch (layout) {
+        case STRING_LAYOUT_LARGE: {
+            const int64_t* offsets = (const int64_t*)a->buffers[1];
+            *out_len = offsets[actual_idx + 1] - offsets[actual_idx];
+            return (const char*)a->buffers[2] + offsets[actual_idx];
+        }
+        case STRING_LAYOUT_VIEW: {
+            const uint8_t* view = get_view_at(a, idx);
+            int32_t len;
+            memcpy(&len, view, 4);
+            *out_len = len;
+            return view_data(a, view, len);
+        }
+        default: {
+            const int32_t* offsets = (const int32_t*)a->buffers[1];
+            *out_len = offsets[actual_idx + 1] - offsets[actual_idx];
+            return (const char*)a->buffers[2] + offsets[actual_idx];
+        }
+    }
+}
+
+// Compare element idx of two view arrays. The length and 4-byte prefix sit
+// in the first 8 bytes of a view, so most unequal strings are rejected
+// without reading the data buffers.
+static bool string_view_equal_at(struct ArrowArray* a, struct ArrowArray* b, int64_t idx) {
+    const uint8_t* view_a = get_view_at(a, idx);
+    const uint8_t* view_b = get_view_at(b, idx);
+    if (memcmp(view_a, view_b, 8) != 0) return false;
+
+    int32_t len;
+    memcpy(&len, view_a, 4);
+    if (len <= 4) return true;
+    if (len <= STRING_VIEW_INLINE_MAX) return memcmp(view_a + 8, view_b + 8, (size_t)len - 4) == 0;
+    return memcmp(view_data(a, view_a, len) + 4, view_data(b, view_b, len) + 4, (size_t)len - 4) == 0;
 }
 
 // Allocate validity bitmap
 static uint8_t* alloc_validity(int64_t length) {
     size_t bytes = (length + 7) / 8;
-    return calloc(bytes, 1);
+    return arrow_mem_calloc(bytes, 1);
 }
 
 // Set validity bit
@@ -75,7 +129,7 @@ static void release_computed_array(struct ArrowArray* array) {
     if (!array) return;
     if (array->buffers) {
         for (int64_t i = 0; i < array->n_buffers; i++) {
-            free((void*)array->buffers[i]);
+            arrow_mem_free((void*)array->buffers[i]);
         }
         free(array->buffers);
     }
@@ -103,7 +157,7 @@ static struct ArrowArray* create_int64_result(int64_t length) {
     result->n_children = 0;
     result->buffers = calloc(2, sizeof(void*));
     result->buffers[0] = NULL;  // No validity bitmap initially
-    result->buffers[1] = calloc(length, sizeof(int64_t));
+    result->buffers[1] = arrow_mem_calloc(length, sizeof(int64_t));
     result->children = NULL;
     result->dictionary = NULL;
     result->release = release_computed_array;
@@ -127,7 +181,7 @@ static struct ArrowArray* create_float64_result(int64_t length) {
     result->n_children = 0;
     result->buffers = calloc(2, sizeof(void*));
     result->buffers[0] = NULL;
-    result->buffers[1] = calloc(length, sizeof(double));
+    result->buffers[1] = arrow_mem_calloc(length, sizeof(double));
     result->children = NULL;
     result->dictionary = NULL;
     result->release = release_computed_array;
@@ -152,7 +206,7 @@ static struct ArrowArray* create_bool_result(int64_t length) {
     result->n_children = 0;
     result->buffers = calloc(2, sizeof(void*));
     result->buffers[0] = NULL;
-    result->buffers[1] = calloc(bytes, 1);
+    result->buffers[1] = arrow_mem_calloc(bytes, 1);
     result->children = NULL;
     result->dictionary = NULL;
     result->release = release_computed_array;
@@ -490,7 +544,7 @@ struct ArrowArray* arrow_eq_float64(struct ArrowArray* a, struct ArrowArray* b)
     return result;
 }
 
-struct ArrowArray* arrow_eq_string(struct ArrowArray* a, struct ArrowArray* b) {
+static struct ArrowArray* eq_string_impl(struct ArrowArray* a, struct ArrowArray* b, StringLayout layout) {
     if (!a || !b || a->length != b->length) return NULL;
 
     struct ArrowArray* result = create_bool_result(a->length);
@@ -498,16 +552,33 @@ struct ArrowArray* arrow_eq_string(struct ArrowArray* a, struct ArrowArray* b) {
 
     for (int64_t i = 0; i < a->length; i++) {
         if (is_valid_at(a, i) && is_valid_at(b, i)) {
-            int32_t len_a, len_b;
-            const char* str_a = get_string_at(a, i, &len_a);
-            const char* str_b = get_string_at(b, i, &len_b);
-            bool eq = (len_a == len_b) && (memcmp(str_a, str_b, len_a) == 0);
+            bool eq;
+            if (layout == STRING_LAYOUT_VIEW) {
+                eq = string_view_equal_at(a, b, i);
+            } else {
+                int64_t len_a, len_b;
+                const char* str_a = get_string_at(a, layout, i, &len_a);
+                const char* str_b = get_string_at(b, layout, i, &len_b);
+                eq = (len_a == len_b) && (memcmp(str_a, str_b, (size_t)len_a) == 0);
+            }
             set_bool_result(result, i, eq);
         }
     }
     return result;
 }
 
+struct ArrowArray* arrow_eq_string(struct ArrowArray* a, struct ArrowArray* b) {
+    return eq_string_impl(a, b, STRING_LAYOUT_UTF8);
+}
+
+struct ArrowArray* arrow_eq_large_string(struct ArrowArray* a, struct ArrowArray* b) {
+    return eq_string_impl(a, b, STRING_LAYOUT_LARGE);
+}
+
+struct ArrowArray* arrow_eq_string_view(struct ArrowArray* a, struct ArrowArray* b) {
+    return eq_string_impl(a, b, STRING_LAYOUT_VIEW);
+}
+
 struct ArrowArray* arrow_ne_int64(struct ArrowArray* a, struct ArrowArray* b) {
     if (!a || !b || a->length != b->length) return NULL;
 
@@ -1009,20 +1080,20 @@ int64_t arrow_count_distinct_int64(struct ArrowArray* a) {
     return count;
 }
 
-int64_t arrow_count_distinct_string(struct ArrowArray* a) {
+static int64_t count_distinct_string_impl(struct ArrowArray* a, StringLayout layout) {
     if (!a || a->length == 0) return 0;
 
     int64_t count = 0;
     for (int64_t i = 0; i < a->length; i++) {
         if (!is_valid_at(a, i)) continue;
-        int32_t len_i;
-        const char* str_i = get_string_at(a, i, &len_i);
+        int64_t len_i;
+        const char* str_i = get_string_at(a, layout, i, &len_i);
         bool seen = false;
         for (int64_t j = 0; j < i; j++) {
             if (!is_valid_at(a, j)) continue;
-            int32_t len_j;
-            const char* str_j = get_string_at(a, j, &len_j);
-            if (len_i == len_j && memcmp(str_i, str_j, len_i) == 0) {
+            int64_t len_j;
+            const char* str_j = get_string_at(a, layout, j, &len_j);
+            if (len_i == len_j && memcmp(str_i, str_j, (size_t)len_i) == 0) {
                 seen = true;
                 break;
             }
@@ -1032,6 +1103,18 @@ int64_t arrow_count_distinct_string(struct ArrowArray* a) {
     return count;
 }
 
+int64_t arrow_count_distinct_string(struct ArrowArray* a) {
+    return count_distinct_string_impl(a, STRING_LAYOUT_UTF8);
+}
+
+int64_t arrow_count_distinct_large_string(struct ArrowArray* a) {
+    return count_distinct_string_impl(a, STRING_LAYOUT_LARGE);
+}
+
+int64_t arrow_count_distinct_string_view(struct ArrowArray* a) {
+    return count_distinct_string_impl(a, STRING_LAYOUT_VIEW);
+}
+
 bool arrow_any(struct ArrowArray* a) {
     if (!a) return false;
     for (int64_t i = 0; i < a->length; i++) {
@@ -1056,9 +1139,11 @@ bool arrow_all(struct ArrowArray* a) {
 // String Operations Implementation
 // ============================================================================
 
-struct ArrowArray* arrow_string_length(struct ArrowArray* strings) {
+// Lengths are int64 for large strings, int32 otherwise
+static struct ArrowArray* string_length_impl(struct ArrowArray* strings, StringLayout layout) {
     if (!strings) return NULL;
 
+    size_t width = layout == STRING_LAYOUT_LARGE ? sizeof(int64_t) : sizeof(int32_t);
     struct ArrowArray* result = calloc(1, sizeof(struct ArrowArray));
     if (!result) return NULL;
 
@@ -1069,23 +1154,38 @@ struct ArrowArray* arrow_string_length(struct ArrowArray* strings) {
     result->n_children = 0;
     result->buffers = calloc(2, sizeof(void*));
     result->buffers[0] = NULL;  // Copy validity if needed
-    result->buffers[1] = calloc(strings->length, sizeof(int32_t));
+    result->buffers[1] = arrow_mem_calloc(strings->length, width);
     result->children = NULL;
     result->dictionary = NULL;
     result->release = release_computed_array;
 
-    int32_t* lengths = (int32_t*)result->buffers[1];
     for (int64_t i = 0; i < strings->length; i++) {
         if (is_valid_at(strings, i)) {
-            int32_t len;
-            get_string_at(strings, i, &len);
-            lengths[i] = len;
+            int64_t len;
+            get_string_at(strings, layout, i, &len);
+            if (layout == STRING_LAYOUT_LARGE) {
+                ((int64_t*)result->buffers[1])[i] = len;
+            } else {
+                ((int32_t*)result->buffers[1])[i] = (int32_t)len;
+            }
         }
     }
     return result;
 }
 
-struct ArrowArray* arrow_string_contains(struct ArrowArray* strings, const char* pattern) {
+struct ArrowArray* arrow_string_length(struct ArrowArray* strings) {
+    return string_length_impl(strings, STRING_LAYOUT_UTF8);
+}
+
+struct ArrowArray* arrow_large_string_length(struct ArrowArray* strings) {
+    return string_length_impl(strings, STRING_LAYOUT_LARGE);
+}
+
+struct ArrowArray* arrow_string_view_length(struct ArrowArray* strings) {
+    return string_length_impl(strings, STRING_LAYOUT_VIEW);
+}
+
+static struct ArrowArray* string_contains_impl(struct ArrowArray* strings, const char* pattern, StringLayout layout) {
     if (!strings || !pattern) return NULL;
 
     struct ArrowArray* result = create_bool_result(strings->length);
@@ -1094,12 +1194,12 @@ struct ArrowArray* arrow_string_contains(struct ArrowArray* strings, const char*
     size_t pattern_len = strlen(pattern);
     for (int64_t i = 0; i < strings->length; i++) {
         if (is_valid_at(strings, i)) {
-            int32_t len;
-            const char* str = get_string_at(strings, i, &len);
+            int64_t len;
+            const char* str = get_string_at(strings, layout, i, &len);
             // Simple substring search
             bool found = false;
             if (pattern_len <= (size_t)len) {
-                for (int32_t j = 0; j <= len - (int32_t)pattern_len; j++) {
+                for (int64_t j = 0; j <= len - (int64_t)pattern_len; j++) {
                     if (memcmp(str + j, pattern, pattern_len) == 0) {
                         found = true;
                         break;
@@ -1112,7 +1212,19 @@ struct ArrowArray* arrow_string_contains(struct ArrowArray* strings, const char*
     return result;
 }
 
-struct ArrowArray* arrow_string_starts_with(struct ArrowArray* strings, const char* prefix) {
+struct ArrowArray* arrow_string_contains(struct ArrowArray* strings, const char* pattern) {
+    return string_contains_impl(strings, pattern, STRING_LAYOUT_UTF8);
+}
+
+struct ArrowArray* arrow_large_string_contains(struct ArrowArray* strings, const char* pattern) {
+    return string_contains_impl(strings, pattern, STRING_LAYOUT_LARGE);
+}
+
+struct ArrowArray* arrow_string_view_contains(struct ArrowArray* strings, const char* pattern) {
+    return string_contains_impl(strings, pattern, STRING_LAYOUT_VIEW);
+}
+
+static struct ArrowArray* string_starts_with_impl(struct ArrowArray* strings, const char* prefix, StringLayout layout) {
     if (!strings || !prefix) return NULL;
 
     struct ArrowArray* result = create_bool_result(strings->length);
@@ -1121,16 +1233,37 @@ struct ArrowArray* arrow_string_starts_with(struct ArrowArray* strings, const ch
     size_t prefix_len = strlen(prefix);
     for (int64_t i = 0; i < strings->length; i++) {
         if (is_valid_at(strings, i)) {
-            int32_t len;
-            const char* str = get_string_at(strings, i, &len);
-            bool starts = (prefix_len <= (size_t)len) && (memcmp(str, prefix, prefix_len) == 0);
+            bool starts;
+            if (layout == STRING_LAYOUT_VIEW && prefix_len <= 4) {
+                // Answered by the view's inline prefix alone
+                const uint8_t* view = get_view_at(strings, i);
+                int32_t len;
+                memcpy(&len, view, 4);
+                starts = prefix_len <= (size_t)len && memcmp(view + 4, prefix, prefix_len) == 0;
+            } else {
+                int64_t len;
+                const char* str = get_string_at(strings, layout, i, &len);
+                starts = (prefix_len <= (size_t)len) && (memcmp(str, prefix, prefix_len) == 0);
+            }
             set_bool_result(result, i, starts);
         }
     }
     return result;
 }
 
-struct ArrowArray* arrow_string_ends_with(struct ArrowArray* strings, const char* suffix) {
+struct ArrowArray* arrow_string_starts_with(struct ArrowArray* strings, const char* prefix) {
+    return string_starts_with_impl(strings, prefix, STRING_LAYOUT_UTF8);
+}
+
+struct ArrowArray* arrow_large_string_starts_with(struct ArrowArray* strings, const char* prefix) {
+    return string_starts_with_impl(strings, prefix, STRING_LAYOUT_LARGE);
+}
+
+struct ArrowArray* arrow_string_view_starts_with(struct ArrowArray* strings, const char* prefix) {
+    return string_starts_with_impl(strings, prefix, STRING_LAYOUT_VIEW);
+}
+
+static struct ArrowArray* string_ends_with_impl(struct ArrowArray* strings, const char* suffix, StringLayout layout) {
     if (!strings || !suffix) return NULL;
 
     struct ArrowArray* result = create_bool_result(strings->length);
@@ -1139,8 +1272,8 @@ struct ArrowArray* arrow_string_ends_with(struct ArrowArray* strings, const char
     size_t suffix_len = strlen(suffix);
     for (int64_t i = 0; i < strings->length; i++) {
         if (is_valid_at(strings, i)) {
-            int32_t len;
-            const char* str = get_string_at(strings, i, &len);
+            int64_t len;
+            const char* str = get_string_at(strings, layout, i, &len);
             bool ends = (suffix_len <= (size_t)len) &&
                         (memcmp(str + len - suffix_len, suffix, suffix_len) == 0);
             set_bool_result(result, i, ends);
@@ -1149,6 +1282,18 @@ struct ArrowArray* arrow_string_ends_with(struct ArrowArray* strings, const char
     return result;
 }
 
+struct ArrowArray* arrow_string_ends_with(struct ArrowArray* strings, const char* suffix) {
+    return string_ends_with_impl(strings, suffix, STRING_LAYOUT_UTF8);
+}
+
+struct ArrowArray* arrow_large_string_ends_with(struct ArrowArray* strings, const char* suffix) {
+    return string_ends_with_impl(strings, suffix, STRING_LAYOUT_LARGE);
+}
+
+struct ArrowArray* arrow_string_view_ends_with(struct ArrowArray* strings, const char* suffix) {
+    return string_ends_with_impl(strings, suffix, STRING_LAYOUT_VIEW);
+}
+
 // Placeholder implementations for remaining string operations
 struct ArrowArray* arrow_substring(struct ArrowArray* strings, int32_t start, int32_t length) {
     (void)strings; (void)start; (void)length;
@@ -1329,10 +1474,185 @@ struct ArrowArray* arrow_filter_float64(struct ArrowArray* values, struct ArrowA
     return result;
 }
 
+// Result with the given buffers, all owned; validity is allocated when the
+// filter selects a null
+static struct ArrowArray* create_filtered_string_result(int64_t length, int64_t null_count, int64_t n_buffers) {
+    struct ArrowArray* result = calloc(1, sizeof(struct ArrowArray));
+    if (!result) return NULL;
+
+    result->length = length;
+    result->null_count = null_count;
+    result->offset = 0;
+    result->n_buffers = n_buffers;
+    result->n_children = 0;
+    result->buffers = calloc((size_t)n_buffers, sizeof(void*));
+    result->children = NULL;
+    result->dictionary = NULL;
+    result->release = release_computed_array;
+
+    if (!result->buffers) {
+        free(result);
+        return NULL;
+    }
+    if (null_count > 0) {
+        result->buffers[0] = alloc_validity(length);
+        if (!result->buffers[0]) {
+            arrow_compute_array_free(result);
+            return NULL;
+        }
+    }
+    return result;
+}
+
+static bool is_selected(struct ArrowArray* bool_mask, int64_t i) {
+    return is_valid_at(bool_mask, i) && get_bool_at(bool_mask, i);
+}
+
+// Selected views are copied as is when inline; out-of-line strings are
+// compacted into new data buffers of at most INT32_MAX bytes each.
+static struct ArrowArray* filter_string_view(struct ArrowArray* values, struct ArrowArray* bool_mask,
+                                             int64_t count, int64_t null_count) {
+    // First pass: sizes of the new data buffers
+    int64_t* sizes = NULL;
+    int64_t n_data = 0;
+    int64_t sizes_capacity = 0;
+    for (int64_t i = 0; i < values->length; i++) {
+        if (!is_selected(bool_mask, i) || !is_valid_at(values, i)) continue;
+        int32_t len;
+        memcpy(&len, get_view_at(values, i), 4);
+        if (len <= STRING_VIEW_INLINE_MAX) continue;
+        if (n_data == 0 || sizes[n_data - 1] + len > INT32_MAX) {
+            if (n_data == sizes_capacity) {
+                sizes_capacity = sizes_capacity ? sizes_capacity * 2 : 4;
+                int64_t* new_sizes = arrow_mem_realloc(sizes, (size_t)sizes_capacity * sizeof(int64_t));
+                if (!new_sizes) {
+                    arrow_mem_free(sizes);
+                    return NULL;
+                }
+                sizes = new_sizes;
+            }
+            sizes[n_data++] = 0;
+        }
+        sizes[n_data - 1] += len;
+    }
+
+    struct ArrowArray* result = create_filtered_string_result(count, null_count, 2 + n_data + 1);
+    if (!result) {
+        arrow_mem_free(sizes);
+        return NULL;
+    }
+    uint8_t* views = arrow_mem_calloc(count > 0 ? (size_t)count : 1, STRING_VIEW_SIZE);
+    result->buffers[1] = views;
+    result->buffers[2 + n_data] = sizes ? (void*)sizes : arrow_mem_alloc(1);
+    bool ok = views && result->buffers[2 + n_data];
+    for (int64_t d = 0; ok && d < n_data; d++) {
+        result->buffers[2 + d] = arrow_mem_alloc((size_t)sizes[d]);
+        ok = result->buffers[2 + d] != NULL;
+    }
+    if (!ok) {
+        arrow_compute_array_free(result);
+        return NULL;
+    }
+
+    // Second pass: copy views, moving out-of-line data
+    uint8_t* validity = (uint8_t*)result->buffers[0];
+    int32_t buffer_index = -1;
+    int32_t buffer_offset = 0;
+    int64_t out_idx = 0;
+    for (int64_t i = 0; i < values->length; i++) {
+        if (!is_selected(bool_mask, i)) continue;
+        uint8_t* out = views + out_idx * STRING_VIEW_SIZE;
+        if (!is_valid_at(values, i)) {
+            out_idx++;
+            continue;
+        }
+        if (validity) set_valid(validity, out_idx, true);
+
+        const uint8_t* view = get_view_at(values, i);
+        memcpy(out, view, STRING_VIEW_SIZE);
+        int32_t len;
+        memcpy(&len, view, 4);
+        if (len > STRING_VIEW_INLINE_MAX) {
+            if (buffer_index < 0 || (int64_t)buffer_offset + len > sizes[buffer_index]) {
+                buffer_index++;
+                buffer_offset = 0;
+            }
+            memcpy((char*)result->buffers[2 + buffer_index] + buffer_offset, view_data(values, view, len), (size_t)len);
+            memcpy(out + 8, &buffer_index, 4);
+            memcpy(out + 12, &buffer_offset, 4);
+            buffer_offset += len;
+        }
+        out_idx++;
+    }
+    return result;
+}
+
+// Offsets keep the input's width; nulls are carried into the result
+static struct ArrowArray* filter_string_impl(struct ArrowArray* values, struct ArrowArray* bool_mask,
+                                             StringLayout layout) {
+    if (!values || !bool_mask || values->length != bool_mask->length) return NULL;
+
+    int64_t count = 0;
+    int64_t null_count = 0;
+    int64_t data_size = 0;
+    for (int64_t i = 0; i < bool_mask->length; i++) {
+        if (!is_selected(bool_mask, i)) continue;
+        count++;
+        if (!is_valid_at(values, i)) {
+            null_count++;
+        } else if (layout != STRING_LAYOUT_VIEW) {
+            int64_t len;
+            get_string_at(values, layout, i, &len);
+            data_size += len;
+        }
+    }
+
+    if (layout == STRING_LAYOUT_VIEW) return filter_string_view(values, bool_mask, count, null_count);
+
+    struct ArrowArray* result = create_filtered_string_result(count, null_count, 3);
+    if (!result) return NULL;
+
+    size_t width = layout == STRING_LAYOUT_LARGE ? sizeof(int64_t) : sizeof(int32_t);
+    result->buffers[1] = arrow_mem_calloc((size_t)count + 1, width);
+    result->buffers[2] = arrow_mem_alloc(data_size > 0 ? (size_t)data_size : 1);
+    if (!result->buffers[1] || !result->buffers[2]) {
+        arrow_compute_array_free(result);
+        return NULL;
+    }
+
+    uint8_t* validity = (uint8_t*)result->buffers[0];
+    char* data = (char*)result->buffers[2];
+    int64_t position = 0;
+    int64_t out_idx = 0;
+    for (int64_t i = 0; i < bool_mask->length; i++) {
+        if (!is_selected(bool_mask, i)) continue;
+        if (is_valid_at(values, i)) {
+            int64_t len;
+            const char* str = get_string_at(values, layout, i, &len);
+            memcpy(data + position, str, (size_t)len);
+            position += len;
+            if (validity) set_valid(validity, out_idx, true);
+        }
+        out_idx++;
+        if (layout == STRING_LAYOUT_LARGE) {
+            ((int64_t*)result->buffers[1])[out_idx] = position;
+        } else {
+            ((int32_t*)result->buffers[1])[out_idx] = (int32_t)position;
+        }
+    }
+    return result;
+}
+
 struct ArrowArray* arrow_filter_string(struct ArrowArray* values, struct ArrowArray* bool_mask) {
-    (void)values; (void)bool_mask;
-    // TODO: Implement
-    return NULL;
+    return filter_string_impl(values, bool_mask, STRING_LAYOUT_UTF8);
+}
+
+struct ArrowArray* arrow_filter_large_string(struct ArrowArray* values, struct ArrowArray* bool_mask) {
+    return filter_string_impl(values, bool_mask, STRING_LAYOUT_LARGE);
+}
+
+struct ArrowArray* arrow_filter_string_view(struct ArrowArray* values, struct ArrowArray* bool_mask) {
+    return filter_string_impl(values, bool_mask, STRING_LAYOUT_VIEW);
 }
 
 struct ArrowArray* arrow_filter_bool(struct ArrowArray* values, struct ArrowArray* bool_mask) {
@@ -1400,55 +1720,143 @@ struct ArrowArray* arrow_take_string(struct ArrowArray* values, struct ArrowArra
     return NULL;
 }
 
-// Helper for sorting - simple insertion sort for now
-static void sort_indices_int64_impl(struct ArrowArray* values, int32_t* indices, int64_t n, bool ascending) {
-    for (int64_t i = 1; i < n; i++) {
-        int32_t key = indices[i];
-        int64_t key_val = is_valid_at(values, key) ? get_int64_at(values, key) : 0;
-        int64_t j = i - 1;
+// Parallel stable merge sort of indices. Morsel-sized runs are sorted
+// independently, then merged pairwise in rounds; every round is a parallel
+// loop. Nulls sort as 0 and NaN after all other floats.
+typedef struct {
+    struct ArrowArray* values;
+    bool is_float;
+    bool ascending;
+    int32_t* src;
+    int32_t* dst;
+    int64_t n;
+    int64_t width;      // length of the runs being merged
+} SortJob;
+
+// NaN goes last in both directions
+static bool float_before(double a, double b, bool ascending) {
+    if (isnan(a) || isnan(b)) return !isnan(a) && isnan(b);
+    return ascending ? a < b : b < a;
+}
+
+// Whether index x sorts strictly before index y
+static bool sort_before(const SortJob* job, int32_t x, int32_t y) {
+    struct ArrowArray* v = job->values;
+    if (job->is_float) {
+        double a = is_valid_at(v, x) ? get_float64_at(v, x) : 0.0;
+        double b = is_valid_at(v, y) ? get_float64_at(v, y) : 0.0;
+        return float_before(a, b, job->ascending);
+    }
+    int64_t a = is_valid_at(v, x) ? get_int64_at(v, x) : 0;
+    int64_t b = is_valid_at(v, y) ? get_int64_at(v, y) : 0;
+    return job->ascending ? a < b : b < a;
+}
+
+static void merge_runs(const SortJob* job, const int32_t* src, int32_t* dst, int64_t lo, int64_t mid, int64_t hi) {
+    int64_t i = lo, j = mid, k = lo;
+    while (i < mid && j < hi) {
+        // Ties take from the left run, keeping the sort stable
+        dst[k++] = sort_before(job, src[j], src[i]) ? src[j++] : src[i++];
+    }
+    while (i < mid) dst[k++] = src[i++];
+    while (j < hi) dst[k++] = src[j++];
+}
+
+// Sort [lo, hi) of job->src in place, using job->dst over the same range
+static void sort_run(const SortJob* job, int64_t lo, int64_t hi) {
+    const int64_t small = 32;
+    for (int64_t start = lo; start < hi; start += small) {
+        int64_t end = start + small < hi ? start + small : hi;
+        for (int64_t i = start + 1; i < end; i++) {
+            int32_t key = job->src[i];
+            int64_t j = i - 1;
+            while (j >= start && sort_before(job, key, job->src[j])) {
+                job->src[j + 1] = job->src[j];
+                j--;
+            }
+            job->src[j + 1] = key;
+        }
+    }
 
-        while (j >= 0) {
-            int64_t j_val = is_valid_at(values, indices[j]) ? get_int64_at(values, indices[j]) : 0;
-            bool should_swap = ascending ? (j_val > key_val) : (j_val < key_val);
-            if (!should_swap) break;
-            indices[j + 1] = indices[j];
-            j--;
+    int32_t* from = job->src;
+    int32_t* to = job->dst;
+    for (int64_t width = small; width < hi - lo; width *= 2) {
+        for (int64_t left = lo; left < hi; left += 2 * width) {
+            int64_t mid = left + width < hi ? left + width : hi;
+            int64_t right = left + 2 * width < hi ? left + 2 * width : hi;
+            merge_runs(job, from, to, left, mid, right);
         }
-        indices[j + 1] = key;
+        int32_t* swap = from; from = to; to = swap;
     }
+    if (from != job->src) memcpy(job->src + lo, from + lo, (size_t)(hi - lo) * sizeof(int32_t));
 }
 
-struct ArrowArray* arrow_sort_indices_int64(struct ArrowArray* values, bool ascending) {
-    if (!values) return NULL;
+static void sort_runs_task(void* ctx, size_t begin, size_t end) {
+    SortJob* job = (SortJob*)ctx;
+    for (size_t r = begin; r < end; r++) {
+        int64_t lo = (int64_t)r * ARROW_MORSEL_ROWS;
+        int64_t hi = lo + ARROW_MORSEL_ROWS < job->n ? lo + ARROW_MORSEL_ROWS : job->n;
+        for (int64_t i = lo; i < hi; i++) job->src[i] = (int32_t)i;
+        sort_run(job, lo, hi);
+    }
+}
+
+static void merge_round_task(void* ctx, size_t begin, size_t end) {
+    SortJob* job = (SortJob*)ctx;
+    for (size_t p = begin; p < end; p++) {
+        int64_t lo = (int64_t)p * 2 * job->width;
+        int64_t mid = lo + job->width < job->n ? lo + job->width : job->n;
+        int64_t hi = lo + 2 * job->width < job->n ? lo + 2 * job->width : job->n;
+        merge_runs(job, job->src, job->dst, lo, mid, hi);
+    }
+}
+
+static struct ArrowArray* sort_indices_impl(struct ArrowArray* values, bool is_float, bool ascending) {
+    if (!values || values->length > INT32_MAX) return NULL;
 
     struct ArrowArray* result = calloc(1, sizeof(struct ArrowArray));
     if (!result) return NULL;
 
-    result->length = values->length;
+    int64_t n = values->length;
+    result->length = n;
     result->null_count = 0;
     result->offset = 0;
     result->n_buffers = 2;
     result->n_children = 0;
     result->buffers = calloc(2, sizeof(void*));
-    result->buffers[0] = NULL;
-    result->buffers[1] = calloc(values->length, sizeof(int32_t));
     result->children = NULL;
     result->dictionary = NULL;
     result->release = release_computed_array;
 
-    int32_t* indices = (int32_t*)result->buffers[1];
-    for (int64_t i = 0; i < values->length; i++) {
-        indices[i] = (int32_t)i;
+    int32_t* indices = result->buffers ? arrow_mem_alloc((size_t)n * sizeof(int32_t)) : NULL;
+    int32_t* scratch = indices ? arrow_mem_alloc((size_t)n * sizeof(int32_t)) : NULL;
+    if (!indices || !scratch) {
+        arrow_mem_free(indices);
+        arrow_compute_array_free(result);
+        return NULL;
     }
 
-    sort_indices_int64_impl(values, indices, values->length, ascending);
+    SortJob job = {values, is_float, ascending, indices, scratch, n, ARROW_MORSEL_ROWS};
+    size_t runs = (size_t)((n + ARROW_MORSEL_ROWS - 1) / ARROW_MORSEL_ROWS);
+    arrow_parallel_for(runs, 1, sort_runs_task, &job);
+
+    for (; job.width < n; job.width *= 2) {
+        size_t pairs = (size_t)((n + 2 * job.width - 1) / (2 * job.width));
+        arrow_parallel_for(pairs, 1, merge_round_task, &job);
+        int32_t* swap = job.src; job.src = job.dst; job.dst = swap;
+    }
+
+    result->buffers[1] = job.src;
+    arrow_mem_free(job.dst);
     return result;
 }
 
+struct ArrowArray* arrow_sort_indices_int64(struct ArrowArray* values, bool ascending) {
+    return sort_indices_impl(values, false, ascending);
+}
+
 struct ArrowArray* arrow_sort_indices_float64(struct ArrowArray* values, bool ascending) {
-    (void)values; (void)ascending;
-    // TODO: Implement
-    return NULL;
+    return sort_indices_impl(values, true, ascending);
 }
 
 struct ArrowArray* arrow_sort_indices_string(struct ArrowArray* values, bool ascending) {
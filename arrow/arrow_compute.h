@@ -62,6 +62,8 @@ struct ArrowArray* arrow_abs_float64(struct ArrowArray* a);
 struct ArrowArray* arrow_eq_int64(struct ArrowArray* a, struct ArrowArray* b);
 struct ArrowArray* arrow_eq_float64(struct ArrowArray* a, struct ArrowArray* b);
 struct ArrowArray* arrow_eq_string(struct ArrowArray* a, struct ArrowArray* b);
+struct ArrowArray* arrow_eq_large_string(struct ArrowArray* a, struct ArrowArray* b);
+struct ArrowArray* arrow_eq_string_view(struct ArrowArray* a, struct ArrowArray* b);
 
 // Not equal
 struct ArrowArray* arrow_ne_int64(struct ArrowArray* a, struct ArrowArray* b);
@@ -131,6 +133,8 @@ int64_t arrow_count_all(struct ArrowArray* a);
 // Count distinct values
 int64_t arrow_count_distinct_int64(struct ArrowArray* a);
 int64_t arrow_count_distinct_string(struct ArrowArray* a);
+int64_t arrow_count_distinct_large_string(struct ArrowArray* a);
+int64_t arrow_count_distinct_string_view(struct ArrowArray* a);
 
 // Any/All for boolean arrays
 bool arrow_any(struct ArrowArray* a);
@@ -140,20 +144,32 @@ bool arrow_all(struct ArrowArray* a);
 // String Operations
 // ============================================================================
 
-// String length (returns int32 array)
+// The string kernels read utf8 ("u") arrays; the *_large_string variants
+// read "U" arrays (int64 offsets) and the *_string_view variants read "vu"
+// arrays, comparing the inline length and prefix before any data buffer.
+
+// String length (returns int32 array; int64 for large strings)
 struct ArrowArray* arrow_string_length(struct ArrowArray* strings);
+struct ArrowArray* arrow_large_string_length(struct ArrowArray* strings);
+struct ArrowArray* arrow_string_view_length(struct ArrowArray* strings);
 
 // Substring extraction
 struct ArrowArray* arrow_substring(struct ArrowArray* strings, int32_t start, int32_t length);
 
 // Contains pattern (returns boolean array)
 struct ArrowArray* arrow_string_contains(struct ArrowArray* strings, const char* pattern);
+struct ArrowArray* arrow_large_string_contains(struct ArrowArray* strings, const char* pattern);
+struct ArrowArray* arrow_string_view_contains(struct ArrowArray* strings, const char* pattern);
 
 // Starts with prefix (returns boolean array)
 struct ArrowArray* arrow_string_starts_with(struct ArrowArray* strings, const char* prefix);
+struct ArrowArray* arrow_large_string_starts_with(struct ArrowArray* strings, const char* prefix);
+struct ArrowArray* arrow_string_view_starts_with(struct ArrowArray* strings, const char* prefix);
 
 // Ends with suffix (returns boolean array)
 struct ArrowArray* arrow_string_ends_with(struct ArrowArray* strings, const char* suffix);
+struct ArrowArray* arrow_large_string_ends_with(struct ArrowArray* strings, const char* suffix);
+struct ArrowArray* arrow_string_view_ends_with(struct ArrowArray* strings, const char* suffix);
 
 // Upper/Lower case
 struct ArrowArray* arrow_string_upper(struct ArrowArray* strings);
@@ -198,6 +214,8 @@ struct ArrowArray* arrow_cast_string_to_float64(struct ArrowArray* a);
 struct ArrowArray* arrow_filter_int64(struct ArrowArray* values, struct ArrowArray* bool_mask);
 struct ArrowArray* arrow_filter_float64(struct ArrowArray* values, struct ArrowArray* bool_mask);
 struct ArrowArray* arrow_filter_string(struct ArrowArray* values, struct ArrowArray* bool_mask);
+struct ArrowArray* arrow_filter_large_string(struct ArrowArray* values, struct ArrowArray* bool_mask);
+struct ArrowArray* arrow_filter_string_view(struct ArrowArray* values, struct ArrowArray* bool_mask);
 struct ArrowArray* arrow_filter_bool(struct ArrowArray* values, struct ArrowArray* bool_mask);
 
 // Take: select elements by index
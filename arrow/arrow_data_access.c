@@ -80,6 +80,68 @@ const char* arrow_get_string_value(struct ArrowArray* array, size_t index) {
     return result;
 }
 
+// Large strings ("U") use int64 offsets; otherwise like arrow_get_string_value
+const char* arrow_get_large_string_value(struct ArrowArray* array, size_t index) {
+    if (!array || index >= (size_t)array->length || is_null(array, index)) {
+        return NULL;
+    }
+
+    if (array->n_buffers < 3 || array->buffers[1] == NULL || array->buffers[2] == NULL) {
+        return NULL;
+    }
+
+    const int64_t* offsets = (const int64_t*)array->buffers[1];
+    const char* data = (const char*)array->buffers[2];
+
+    size_t actual_index = index + array->offset;
+    int64_t start_offset = offsets[actual_index];
+    size_t length = (size_t)(offsets[actual_index + 1] - start_offset);
+
+    char* result = (char*)malloc(length + 1);
+    if (!result) return NULL;
+
+    memcpy(result, data + start_offset, length);
+    result[length] = '\0';
+
+    return result;
+}
+
+// String views ("vu") hold the length, then either the string itself (up to
+// 12 bytes) or a prefix, data buffer index and offset
+const char* arrow_get_string_view_value(struct ArrowArray* array, size_t index) {
+    if (!array || index >= (size_t)array->length || is_null(array, index)) {
+        return NULL;
+    }
+
+    // Validity, views, data buffers..., sizes
+    if (array->n_buffers < 3 || array->buffers[1] == NULL) {
+        return NULL;
+    }
+
+    const uint8_t* view = (const uint8_t*)array->buffers[1] + (index + array->offset) * 16;
+    int32_t length;
+    memcpy(&length, view, sizeof(int32_t));
+
+    const char* data;
+    if (length <= 12) {
+        data = (const char*)view + 4;
+    } else {
+        int32_t buffer_index, offset;
+        memcpy(&buffer_index, view + 8, sizeof(int32_t));
+        memcpy(&offset, view + 12, sizeof(int32_t));
+        if (buffer_index < 0 || 2 + buffer_index >= array->n_buffers - 1) return NULL;
+        data = (const char*)array->buffers[2 + buffer_index] + offset;
+    }
+
+    char* result = (char*)malloc((size_t)length + 1);
+    if (!result) return NULL;
+
+    memcpy(result, data, (size_t)length);
+    result[length] = '\0';
+
+    return result;
+}
+
 // Helper functions to check for null values - these return 1 if null, 0 if not null, -1 on error
 int arrow_is_bool_null(struct ArrowArray* array, size_t index) {
     if (!array || index >= (size_t)array->length) return -1;
@@ -340,4 +402,82 @@ const uint8_t* arrow_get_binary_value(struct ArrowArray* array, size_t index, si
 int arrow_is_binary_null(struct ArrowArray* array, size_t index) {
     if (!array || index >= (size_t)array->length) return -1;
     return is_null(array, index) ? 1 : 0;
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// Bulk extraction
+// ============================================================================
+
+bool arrow_range_in_bounds(const struct ArrowArray* array, size_t start, size_t count) {
+    return array && start <= (size_t)array->length && count <= (size_t)array->length - start;
+}
+
+size_t arrow_copy_validity_bytes(const struct ArrowArray* array, size_t start, size_t count, uint8_t* out) {
+    if (!arrow_range_in_bounds(array, start, count)) return 0;
+
+    const uint8_t* validity = array->n_buffers > 0 ? (const uint8_t*)array->buffers[0] : NULL;
+    if (array->null_count == 0 || !validity) {
+        memset(out, 1, count);
+        return 0;
+    }
+
+    size_t nulls = 0;
+    size_t bit = start + (size_t)array->offset;
+    for (size_t i = 0; i < count; i++, bit++) {
+        out[i] = (validity[bit / 8] >> (bit % 8)) & 1;
+        nulls += out[i] ^ 1;
+    }
+    return nulls;
+}
+
+bool arrow_copy_fixed_values(const struct ArrowArray* array, size_t value_size, size_t start, size_t count, void* out) {
+    if (!arrow_range_in_bounds(array, start, count)) return false;
+    if (count == 0) return true;
+    if (array->n_buffers <= 1 || array->buffers[1] == NULL) return false;
+
+    const uint8_t* data = (const uint8_t*)array->buffers[1];
+    memcpy(out, data + (start + (size_t)array->offset) * value_size, count * value_size);
+    return true;
+}
+
+bool arrow_get_string_ref(const struct ArrowArray* array, char layout, size_t index,
+                          const char** out_data, size_t* out_length) {
+    if (!array || index >= (size_t)array->length) return false;
+    if (array->n_buffers < 3 || array->buffers[1] == NULL) return false;
+
+    size_t slot = index + (size_t)array->offset;
+    switch (layout) {
+        case 'u':
+        case 'z': {
+            const int32_t* offsets = (const int32_t*)array->buffers[1];
+            *out_data = (const char*)array->buffers[2] + offsets[slot];
+            *out_length = (size_t)(offsets[slot + 1] - offsets[slot]);
+            return true;
+        }
+        case 'U':
+        case 'Z': {
+            const int64_t* offsets = (const int64_t*)array->buffers[1];
+            *out_data = (const char*)array->buffers[2] + offsets[slot];
+            *out_length = (size_t)(offsets[slot + 1] - offsets[slot]);
+            return true;
+        }
+        case 'v': {
+            const uint8_t* view = (const uint8_t*)array->buffers[1] + slot * 16;
+            int32_t length;
+            memcpy(&length, view, sizeof(int32_t));
+            if (length <= 12) {
+                *out_data = (const char*)view + 4;
+            } else {
+                int32_t buffer_index, offset;
+                memcpy(&buffer_index, view + 8, sizeof(int32_t));
+                memcpy(&offset, view + 12, sizeof(int32_t));
+                if (buffer_index < 0 || 2 + buffer_index >= array->n_buffers - 1) return false;
+                *out_data = (const char*)array->buffers[2 + buffer_index] + offset;
+            }
+            *out_length = (size_t)length;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,1060 @@
+/**
+ * arrow_expression.c - Fused expression evaluation over record batches
+ */
+
+#include "arrow_expression.h"
+#include "arrow_builders.h"
+#include "arrow_compute.h"
+#define ARROW_MEMORY_SUBSYSTEM ARROW_MEMORY_COMPUTE
+#include "arrow_memory.h"
+#include "arrow_thread_pool.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// ============================================================================
+// Expression Trees
+// ============================================================================
+
+typedef enum {
+    VALUE_INT64,
+    VALUE_FLOAT64,
+    VALUE_BOOL,     // one byte per row, 0 or 1
+    VALUE_STRING    // read in place from the column; never in a register
+} ValueType;
+
+typedef enum {
+    EXPR_COLUMN,
+    EXPR_LITERAL,
+    EXPR_UNARY,
+    EXPR_BINARY,
+    EXPR_CAST,
+    EXPR_STRING_PREDICATE
+} ExprKind;
+
+struct ArrowExpr {
+    ExprKind kind;
+    ArrowExprOp op;
+    ValueType type;         // literal type, or cast target
+    int64_t column;         // column index; -1 when referenced by name
+    char* text;             // column name, string literal or pattern
+    int64_t int_value;
+    double float_value;
+    bool bool_value;
+    ArrowExpr* left;
+    ArrowExpr* right;
+};
+
+static ArrowExpr* expr_new(ExprKind kind) {
+    ArrowExpr* expr = calloc(1, sizeof(ArrowExpr));
+    if (expr) {
+        expr->kind = kind;
+        expr->column = -1;
+    }
+    return expr;
+}
+
+static char* copy_text(const char* text) {
+    size_t len = strlen(text);
+    char* copy = malloc(len + 1);
+    if (copy) memcpy(copy, text, len + 1);
+    return copy;
+}
+
+ArrowExpr* arrow_expr_column(int64_t index) {
+    if (index < 0) return NULL;
+    ArrowExpr* expr = expr_new(EXPR_COLUMN);
+    if (expr) expr->column = index;
+    return expr;
+}
+
+ArrowExpr* arrow_expr_column_named(const char* name) {
+    if (!name) return NULL;
+    ArrowExpr* expr = expr_new(EXPR_COLUMN);
+    if (!expr) return NULL;
+    expr->text = copy_text(name);
+    if (!expr->text) {
+        free(expr);
+        return NULL;
+    }
+    return expr;
+}
+
+ArrowExpr* arrow_expr_literal_int64(int64_t value) {
+    ArrowExpr* expr = expr_new(EXPR_LITERAL);
+    if (expr) {
+        expr->type = VALUE_INT64;
+        expr->int_value = value;
+    }
+    return expr;
+}
+
+ArrowExpr* arrow_expr_literal_float64(double value) {
+    ArrowExpr* expr = expr_new(EXPR_LITERAL);
+    if (expr) {
+        expr->type = VALUE_FLOAT64;
+        expr->float_value = value;
+    }
+    return expr;
+}
+
+ArrowExpr* arrow_expr_literal_bool(bool value) {
+    ArrowExpr* expr = expr_new(EXPR_LITERAL);
+    if (expr) {
+        expr->type = VALUE_BOOL;
+        expr->bool_value = value;
+    }
+    return expr;
+}
+
+ArrowExpr* arrow_expr_literal_string(const char* value) {
+    if (!value) return NULL;
+    ArrowExpr* expr = expr_new(EXPR_LITERAL);
+    if (!expr) return NULL;
+    expr->type = VALUE_STRING;
+    expr->text = copy_text(value);
+    if (!expr->text) {
+        free(expr);
+        return NULL;
+    }
+    return expr;
+}
+
+ArrowExpr* arrow_expr_unary(ArrowExprOp op, ArrowExpr* operand) {
+    if (!operand) return NULL;
+    if (op > ARROW_EXPR_IS_VALID) {
+        arrow_expr_free(operand);
+        return NULL;
+    }
+    ArrowExpr* expr = expr_new(EXPR_UNARY);
+    if (!expr) {
+        arrow_expr_free(operand);
+        return NULL;
+    }
+    expr->op = op;
+    expr->left = operand;
+    return expr;
+}
+
+ArrowExpr* arrow_expr_binary(ArrowExprOp op, ArrowExpr* left, ArrowExpr* right) {
+    ArrowExpr* expr = NULL;
+    if (left && right && op >= ARROW_EXPR_ADD && op <= ARROW_EXPR_XOR) {
+        expr = expr_new(EXPR_BINARY);
+    }
+    if (!expr) {
+        arrow_expr_free(left);
+        arrow_expr_free(right);
+        return NULL;
+    }
+    expr->op = op;
+    expr->left = left;
+    expr->right = right;
+    return expr;
+}
+
+ArrowExpr* arrow_expr_cast(ArrowExpr* operand, ArrowExprType type) {
+    if (!operand) return NULL;
+    ArrowExpr* expr = expr_new(EXPR_CAST);
+    if (!expr) {
+        arrow_expr_free(operand);
+        return NULL;
+    }
+    switch (type) {
+        case ARROW_EXPR_TYPE_INT64: expr->type = VALUE_INT64; break;
+        case ARROW_EXPR_TYPE_FLOAT64: expr->type = VALUE_FLOAT64; break;
+        case ARROW_EXPR_TYPE_BOOL: expr->type = VALUE_BOOL; break;
+        default:
+            free(expr);
+            arrow_expr_free(operand);
+            return NULL;
+    }
+    expr->left = operand;
+    return expr;
+}
+
+ArrowExpr* arrow_expr_string_predicate(ArrowExprOp op, ArrowExpr* operand, const char* pattern) {
+    if (!operand) return NULL;
+    ArrowExpr* expr = NULL;
+    if (pattern && op >= ARROW_EXPR_CONTAINS && op <= ARROW_EXPR_ENDS_WITH) {
+        expr = expr_new(EXPR_STRING_PREDICATE);
+    }
+    if (expr) expr->text = copy_text(pattern);
+    if (!expr || !expr->text) {
+        free(expr);
+        arrow_expr_free(operand);
+        return NULL;
+    }
+    expr->op = op;
+    expr->left = operand;
+    return expr;
+}
+
+void arrow_expr_free(ArrowExpr* expr) {
+    if (!expr) return;
+    arrow_expr_free(expr->left);
+    arrow_expr_free(expr->right);
+    free(expr->text);
+    free(expr);
+}
+
+// ============================================================================
+// Compilation
+// ============================================================================
+//
+// A tree is compiled into a list of steps over numbered registers. Columns
+// and literals get one register each for the whole evaluation; every other
+// node gets a temporary register that is returned to a free list once its
+// consumer has run, so deep trees still need only a handful of registers.
+// A step never writes to one of its own operands.
+
+typedef enum {
+    STRING_LAYOUT_UTF8,   // "u"/"z": int32 offsets
+    STRING_LAYOUT_LARGE,  // "U"/"Z": int64 offsets
+    STRING_LAYOUT_VIEW    // "vu"/"vz": 16-byte views
+} StringLayout;
+
+typedef struct {
+    ValueType type;
+    bool pinned;                    // column or literal: never reused
+    bool literal;
+    int64_t int_value;              // literal values
+    double float_value;
+    const char* text;               // string literal
+    size_t text_len;
+    const struct ArrowArray* array; // column
+    const char* format;
+    int64_t offset;                 // batch offset + column offset
+    StringLayout layout;
+} RegisterInfo;
+
+typedef enum {
+    STEP_LOAD,              // read a block of column `out`
+    STEP_UNARY,
+    STEP_BINARY,
+    STEP_CAST,
+    STEP_STRING_COMPARE,
+    STEP_STRING_PREDICATE
+} StepKind;
+
+typedef struct {
+    StepKind kind;
+    ArrowExprOp op;
+    ValueType in;           // operand type after promotion
+    ValueType type;         // result type
+    int out;
+    int a;
+    int b;
+    const char* pattern;
+    size_t pattern_len;
+} Step;
+
+typedef struct {
+    RegisterInfo* regs;
+    int n_regs;
+    int cap_regs;
+    Step* steps;
+    int n_steps;
+    int cap_steps;
+    int* free_temps;        // sized cap_regs
+    int n_free;
+    int* column_regs;       // column index -> register, or -1
+    const struct ArrowSchema* schema;
+    const struct ArrowArray* batch;
+    int result;
+} Program;
+
+static void program_free(Program* prog) {
+    free(prog->regs);
+    free(prog->steps);
+    free(prog->free_temps);
+    free(prog->column_regs);
+}
+
+static int new_register(Program* prog, ValueType type, bool pinned) {
+    if (!pinned && prog->n_free > 0) {
+        int reg = prog->free_temps[--prog->n_free];
+        prog->regs[reg].type = type;
+        return reg;
+    }
+    if (prog->n_regs == prog->cap_regs) {
+        int cap = prog->cap_regs ? prog->cap_regs * 2 : 8;
+        RegisterInfo* regs = realloc(prog->regs, cap * sizeof(RegisterInfo));
+        if (!regs) return -1;
+        prog->regs = regs;
+        int* free_temps = realloc(prog->free_temps, cap * sizeof(int));
+        if (!free_temps) return -1;
+        prog->free_temps = free_temps;
+        prog->cap_regs = cap;
+    }
+    int reg = prog->n_regs++;
+    memset(&prog->regs[reg], 0, sizeof(RegisterInfo));
+    prog->regs[reg].type = type;
+    prog->regs[reg].pinned = pinned;
+    return reg;
+}
+
+static void release_register(Program* prog, int reg) {
+    if (reg >= 0 && !prog->regs[reg].pinned) {
+        prog->free_temps[prog->n_free++] = reg;
+    }
+}
+
+static bool add_step(Program* prog, Step step) {
+    if (prog->n_steps == prog->cap_steps) {
+        int cap = prog->cap_steps ? prog->cap_steps * 2 : 8;
+        Step* steps = realloc(prog->steps, cap * sizeof(Step));
+        if (!steps) return false;
+        prog->steps = steps;
+        prog->cap_steps = cap;
+    }
+    prog->steps[prog->n_steps++] = step;
+    return true;
+}
+
+// Emit a step writing a fresh temporary, then release its operands
+static int emit(Program* prog, Step step, ValueType type) {
+    step.type = type;
+    step.out = new_register(prog, type, false);
+    if (step.out < 0 || !add_step(prog, step)) return -1;
+    release_register(prog, step.a);
+    release_register(prog, step.b);
+    return step.out;
+}
+
+static bool column_type(const char* format, ValueType* type, StringLayout* layout) {
+    if (!format) return false;
+    if (strcmp(format, "l") == 0 || strcmp(format, "i") == 0) {
+        *type = VALUE_INT64;
+    } else if (strcmp(format, "g") == 0 || strcmp(format, "f") == 0) {
+        *type = VALUE_FLOAT64;
+    } else if (strcmp(format, "b") == 0) {
+        *type = VALUE_BOOL;
+    } else if (strcmp(format, "u") == 0 || strcmp(format, "z") == 0) {
+        *type = VALUE_STRING;
+        *layout = STRING_LAYOUT_UTF8;
+    } else if (strcmp(format, "U") == 0 || strcmp(format, "Z") == 0) {
+        *type = VALUE_STRING;
+        *layout = STRING_LAYOUT_LARGE;
+    } else if (strcmp(format, "vu") == 0 || strcmp(format, "vz") == 0) {
+        *type = VALUE_STRING;
+        *layout = STRING_LAYOUT_VIEW;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static int compile_column(Program* prog, const ArrowExpr* expr) {
+    const struct ArrowSchema* schema = prog->schema;
+    int64_t index = expr->column;
+    if (expr->text) {
+        for (int64_t i = 0; i < schema->n_children; i++) {
+            const char* name = schema->children[i]->name;
+            if (name && strcmp(name, expr->text) == 0) {
+                index = i;
+                break;
+            }
+        }
+    }
+    if (index < 0 || index >= schema->n_children) return -1;
+    if (prog->column_regs[index] >= 0) return prog->column_regs[index];
+
+    const struct ArrowArray* array = prog->batch->children[index];
+    ValueType type;
+    StringLayout layout = STRING_LAYOUT_UTF8;
+    if (!array || !column_type(schema->children[index]->format, &type, &layout)) return -1;
+
+    int reg = new_register(prog, type, true);
+    if (reg < 0) return -1;
+    RegisterInfo* info = &prog->regs[reg];
+    info->array = array;
+    info->format = schema->children[index]->format;
+    info->offset = prog->batch->offset + array->offset;
+    info->layout = layout;
+
+    Step load = { .kind = STEP_LOAD, .out = reg, .a = -1, .b = -1 };
+    if (!add_step(prog, load)) return -1;
+    prog->column_regs[index] = reg;
+    return reg;
+}
+
+static int compile_literal(Program* prog, const ArrowExpr* expr) {
+    int reg = new_register(prog, expr->type, true);
+    if (reg < 0) return -1;
+    RegisterInfo* info = &prog->regs[reg];
+    info->literal = true;
+    switch (expr->type) {
+        case VALUE_INT64: info->int_value = expr->int_value; break;
+        case VALUE_FLOAT64: info->float_value = expr->float_value; break;
+        case VALUE_BOOL: info->int_value = expr->bool_value; break;
+        case VALUE_STRING:
+            info->text = expr->text;
+            info->text_len = strlen(expr->text);
+            break;
+    }
+    return reg;
+}
+
+static bool is_numeric(ValueType type) {
+    return type == VALUE_INT64 || type == VALUE_FLOAT64;
+}
+
+// Convert register `reg` to `type`; the register itself if it already is
+static int convert(Program* prog, int reg, ValueType type) {
+    if (reg < 0) return -1;
+    ValueType from = prog->regs[reg].type;
+    if (from == type) return reg;
+    if (from == VALUE_STRING || type == VALUE_STRING) return -1;
+    Step step = { .kind = STEP_CAST, .in = from, .a = reg, .b = -1 };
+    return emit(prog, step, type);
+}
+
+static int compile_node(Program* prog, const ArrowExpr* expr);
+
+static int compile_unary(Program* prog, const ArrowExpr* expr) {
+    int a = compile_node(prog, expr->left);
+    if (a < 0) return -1;
+    ValueType in = prog->regs[a].type;
+    Step step = { .kind = STEP_UNARY, .op = expr->op, .in = in, .a = a, .b = -1 };
+
+    switch (expr->op) {
+        case ARROW_EXPR_NEGATE:
+        case ARROW_EXPR_ABS:
+            if (!is_numeric(in)) return -1;
+            return emit(prog, step, in);
+        case ARROW_EXPR_NOT:
+            if (in != VALUE_BOOL) return -1;
+            return emit(prog, step, VALUE_BOOL);
+        case ARROW_EXPR_IS_NULL:
+        case ARROW_EXPR_IS_VALID:
+            if (prog->regs[a].literal && in == VALUE_STRING) return -1;
+            return emit(prog, step, VALUE_BOOL);
+        default:
+            return -1;
+    }
+}
+
+static int compile_binary(Program* prog, const ArrowExpr* expr) {
+    int a = compile_node(prog, expr->left);
+    int b = a < 0 ? -1 : compile_node(prog, expr->right);
+    if (b < 0) return -1;
+    ValueType ta = prog->regs[a].type;
+    ValueType tb = prog->regs[b].type;
+    ArrowExprOp op = expr->op;
+
+    if (op >= ARROW_EXPR_AND) {
+        if (ta != VALUE_BOOL || tb != VALUE_BOOL) return -1;
+        Step step = { .kind = STEP_BINARY, .op = op, .in = VALUE_BOOL, .a = a, .b = b };
+        return emit(prog, step, VALUE_BOOL);
+    }
+
+    bool comparison = op >= ARROW_EXPR_EQ;
+    if (ta == VALUE_STRING || tb == VALUE_STRING) {
+        if (ta != tb || (op != ARROW_EXPR_EQ && op != ARROW_EXPR_NE)) return -1;
+        Step step = { .kind = STEP_STRING_COMPARE, .op = op, .in = VALUE_STRING, .a = a, .b = b };
+        return emit(prog, step, VALUE_BOOL);
+    }
+
+    ValueType in;
+    if (comparison && ta == VALUE_BOOL && tb == VALUE_BOOL) {
+        in = VALUE_BOOL;
+    } else if (is_numeric(ta) && is_numeric(tb)) {
+        in = (ta == VALUE_FLOAT64 || tb == VALUE_FLOAT64) ? VALUE_FLOAT64 : VALUE_INT64;
+        a = convert(prog, a, in);
+        b = a < 0 ? -1 : convert(prog, b, in);
+        if (b < 0) return -1;
+    } else {
+        return -1;
+    }
+    Step step = { .kind = STEP_BINARY, .op = op, .in = in, .a = a, .b = b };
+    return emit(prog, step, comparison ? VALUE_BOOL : in);
+}
+
+static int compile_node(Program* prog, const ArrowExpr* expr) {
+    switch (expr->kind) {
+        case EXPR_COLUMN:
+            return compile_column(prog, expr);
+        case EXPR_LITERAL:
+            return compile_literal(prog, expr);
+        case EXPR_UNARY:
+            return compile_unary(prog, expr);
+        case EXPR_BINARY:
+            return compile_binary(prog, expr);
+        case EXPR_CAST:
+            return convert(prog, compile_node(prog, expr->left), expr->type);
+        case EXPR_STRING_PREDICATE: {
+            int a = compile_node(prog, expr->left);
+            if (a < 0 || prog->regs[a].type != VALUE_STRING || prog->regs[a].literal) return -1;
+            Step step = { .kind = STEP_STRING_PREDICATE, .op = expr->op, .in = VALUE_STRING,
+                          .a = a, .b = -1, .pattern = expr->text,
+                          .pattern_len = strlen(expr->text) };
+            return emit(prog, step, VALUE_BOOL);
+        }
+    }
+    return -1;
+}
+
+static bool compile(Program* prog, const ArrowExpr* expr,
+                    const struct ArrowSchema* schema, const struct ArrowArray* batch) {
+    memset(prog, 0, sizeof(Program));
+    prog->schema = schema;
+    prog->batch = batch;
+    prog->column_regs = malloc((schema->n_children + 1) * sizeof(int));
+    if (!prog->column_regs) return false;
+    for (int64_t i = 0; i < schema->n_children; i++) prog->column_regs[i] = -1;
+
+    prog->result = compile_node(prog, expr);
+    return prog->result >= 0 && prog->regs[prog->result].type != VALUE_STRING;
+}
+
+// ============================================================================
+// Block Kernels
+// ============================================================================
+//
+// Registers hold one block: 8-byte int64/float64 values or one byte per
+// bool, plus one validity byte per row. Int64 and float64 columns are read
+// in place rather than copied.
+
+typedef struct {
+    const void* values;     // current block
+    const uint8_t* valid;   // one byte per row; NULL: all valid
+    void* data;             // scratch: ARROW_EXPR_BLOCK_ROWS 8-byte slots
+    uint8_t* data_valid;    // scratch: ARROW_EXPR_BLOCK_ROWS bytes
+} Register;
+
+static void unpack_bits(const uint8_t* bits, int64_t start, int64_t n, uint8_t* out) {
+    for (int64_t i = 0; i < n; i++) {
+        int64_t bit = start + i;
+        out[i] = (bits[bit >> 3] >> (bit & 7)) & 1;
+    }
+}
+
+// Pack n bytes of 0/1 into whole bitmap bytes starting at out
+static void pack_bits(const uint8_t* in, int64_t n, uint8_t* out) {
+    int64_t full = n / 8;
+    for (int64_t j = 0; j < full; j++) {
+        const uint8_t* p = in + j * 8;
+        out[j] = (uint8_t)(p[0] | p[1] << 1 | p[2] << 2 | p[3] << 3 |
+                           p[4] << 4 | p[5] << 5 | p[6] << 6 | p[7] << 7);
+    }
+    if (n % 8) {
+        uint8_t byte = 0;
+        for (int64_t k = 0; k < n % 8; k++) byte |= (uint8_t)(in[full * 8 + k] << k);
+        out[full] = byte;
+    }
+}
+
+static void load_column(const RegisterInfo* info, Register* reg, int64_t row, int64_t n) {
+    const struct ArrowArray* array = info->array;
+    int64_t idx = info->offset + row;
+
+    reg->valid = NULL;
+    if (array->null_count != 0 && array->buffers[0]) {
+        unpack_bits((const uint8_t*)array->buffers[0], idx, n, reg->data_valid);
+        reg->valid = reg->data_valid;
+    }
+    if (info->type == VALUE_STRING) return;
+
+    const char* format = info->format;
+    if (strcmp(format, "l") == 0) {
+        reg->values = (const int64_t*)array->buffers[1] + idx;
+    } else if (strcmp(format, "g") == 0) {
+        reg->values = (const double*)array->buffers[1] + idx;
+    } else if (strcmp(format, "i") == 0) {
+        const int32_t* in = (const int32_t*)array->buffers[1] + idx;
+        int64_t* out = reg->data;
+        for (int64_t i = 0; i < n; i++) out[i] = in[i];
+        reg->values = out;
+    } else if (strcmp(format, "f") == 0) {
+        const float* in = (const float*)array->buffers[1] + idx;
+        double* out = reg->data;
+        for (int64_t i = 0; i < n; i++) out[i] = in[i];
+        reg->values = out;
+    } else {
+        unpack_bits((const uint8_t*)array->buffers[1], idx, n, reg->data);
+        reg->values = reg->data;
+    }
+}
+
+// Validity of a binary result: NULL if both operands are all valid, unless
+// `force`, in which case the scratch bytes are always filled
+static const uint8_t* merge_valid(Register* out, const Register* a, const Register* b,
+                                  int64_t n, bool force) {
+    if (!a->valid && !b->valid) {
+        if (!force) return NULL;
+        memset(out->data_valid, 1, n);
+    } else if (!b->valid) {
+        memcpy(out->data_valid, a->valid, n);
+    } else if (!a->valid) {
+        memcpy(out->data_valid, b->valid, n);
+    } else {
+        for (int64_t i = 0; i < n; i++) out->data_valid[i] = a->valid[i] & b->valid[i];
+    }
+    return out->data_valid;
+}
+
+static const uint8_t* copy_valid(Register* out, const Register* a, int64_t n) {
+    if (!a->valid) return NULL;
+    memcpy(out->data_valid, a->valid, n);
+    return out->data_valid;
+}
+
+#define MAP2(T_IN, T_OUT, EXPR) do { \
+    const T_IN* x = a->values; \
+    const T_IN* y = b->values; \
+    T_OUT* z = out->data; \
+    for (int64_t i = 0; i < n; i++) z[i] = (T_OUT)(EXPR); \
+} while (0)
+
+#define MAP1(T_IN, T_OUT, EXPR) do { \
+    const T_IN* x = a->values; \
+    T_OUT* z = out->data; \
+    for (int64_t i = 0; i < n; i++) z[i] = (T_OUT)(EXPR); \
+} while (0)
+
+// Comparisons shared by all operand types
+#define COMPARE(T) do { \
+    switch (op) { \
+        case ARROW_EXPR_EQ: MAP2(T, uint8_t, x[i] == y[i]); break; \
+        case ARROW_EXPR_NE: MAP2(T, uint8_t, x[i] != y[i]); break; \
+        case ARROW_EXPR_LT: MAP2(T, uint8_t, x[i] < y[i]); break; \
+        case ARROW_EXPR_LE: MAP2(T, uint8_t, x[i] <= y[i]); break; \
+        case ARROW_EXPR_GT: MAP2(T, uint8_t, x[i] > y[i]); break; \
+        default: MAP2(T, uint8_t, x[i] >= y[i]); break; \
+    } \
+} while (0)
+
+static void run_int64_arithmetic(ArrowExprOp op, Register* out, const Register* a,
+                                 const Register* b, int64_t n) {
+    // Unsigned arithmetic wraps instead of overflowing
+    switch (op) {
+        case ARROW_EXPR_ADD:
+            MAP2(int64_t, int64_t, (uint64_t)x[i] + (uint64_t)y[i]);
+            break;
+        case ARROW_EXPR_SUBTRACT:
+            MAP2(int64_t, int64_t, (uint64_t)x[i] - (uint64_t)y[i]);
+            break;
+        case ARROW_EXPR_MULTIPLY:
+            MAP2(int64_t, int64_t, (uint64_t)x[i] * (uint64_t)y[i]);
+            break;
+        default: {
+            const int64_t* x = a->values;
+            const int64_t* y = b->values;
+            int64_t* z = out->data;
+            uint8_t* v = out->data_valid;
+            for (int64_t i = 0; i < n; i++) {
+                bool bad = y[i] == 0 || (y[i] == -1 && x[i] == INT64_MIN);
+                z[i] = bad ? 0 : x[i] / y[i];
+                v[i] &= !bad;
+            }
+            break;
+        }
+    }
+}
+
+static void run_binary(const Step* step, Register* out, const Register* a, const Register* b, int64_t n) {
+    ArrowExprOp op = step->op;
+
+    if (op == ARROW_EXPR_AND || op == ARROW_EXPR_OR) {
+        // Kleene logic: a known false (AND) or true (OR) decides the result
+        const uint8_t* x = a->values;
+        const uint8_t* y = b->values;
+        uint8_t* z = out->data;
+        if (!a->valid && !b->valid) {
+            if (op == ARROW_EXPR_AND) for (int64_t i = 0; i < n; i++) z[i] = x[i] & y[i];
+            else for (int64_t i = 0; i < n; i++) z[i] = x[i] | y[i];
+            out->valid = NULL;
+        } else {
+            uint8_t* v = out->data_valid;
+            for (int64_t i = 0; i < n; i++) {
+                uint8_t va = a->valid ? a->valid[i] : 1;
+                uint8_t vb = b->valid ? b->valid[i] : 1;
+                if (op == ARROW_EXPR_AND) {
+                    uint8_t decided = (va & !x[i]) | (vb & !y[i]);
+                    z[i] = va & vb & x[i] & y[i];
+                    v[i] = (va & vb) | decided;
+                } else {
+                    uint8_t decided = (va & x[i]) | (vb & y[i]);
+                    z[i] = decided;
+                    v[i] = (va & vb) | decided;
+                }
+            }
+            out->valid = v;
+        }
+        out->values = out->data;
+        return;
+    }
+
+    bool int_divide = op == ARROW_EXPR_DIVIDE && step->in == VALUE_INT64;
+    out->valid = merge_valid(out, a, b, n, int_divide);
+    out->values = out->data;
+
+    if (op == ARROW_EXPR_XOR) {
+        MAP2(uint8_t, uint8_t, x[i] ^ y[i]);
+    } else if (op >= ARROW_EXPR_EQ) {
+        switch (step->in) {
+            case VALUE_INT64: COMPARE(int64_t); break;
+            case VALUE_FLOAT64: COMPARE(double); break;
+            default: COMPARE(uint8_t); break;
+        }
+    } else if (step->in == VALUE_INT64) {
+        run_int64_arithmetic(op, out, a, b, n);
+    } else {
+        switch (op) {
+            case ARROW_EXPR_ADD: MAP2(double, double, x[i] + y[i]); break;
+            case ARROW_EXPR_SUBTRACT: MAP2(double, double, x[i] - y[i]); break;
+            case ARROW_EXPR_MULTIPLY: MAP2(double, double, x[i] * y[i]); break;
+            default: MAP2(double, double, x[i] / y[i]); break;
+        }
+    }
+}
+
+static void run_unary(const Step* step, Register* out, const Register* a, int64_t n) {
+    out->values = out->data;
+    switch (step->op) {
+        case ARROW_EXPR_IS_NULL:
+        case ARROW_EXPR_IS_VALID: {
+            uint8_t want_valid = step->op == ARROW_EXPR_IS_VALID;
+            uint8_t* z = out->data;
+            if (a->valid) {
+                for (int64_t i = 0; i < n; i++) z[i] = a->valid[i] == want_valid;
+            } else {
+                memset(z, want_valid, n);
+            }
+            out->valid = NULL;
+            return;
+        }
+        case ARROW_EXPR_NOT:
+            MAP1(uint8_t, uint8_t, !x[i]);
+            break;
+        case ARROW_EXPR_NEGATE:
+            if (step->in == VALUE_INT64) MAP1(int64_t, int64_t, 0 - (uint64_t)x[i]);
+            else MAP1(double, double, -x[i]);
+            break;
+        default:
+            if (step->in == VALUE_INT64) MAP1(int64_t, int64_t, x[i] < 0 ? 0 - (uint64_t)x[i] : (uint64_t)x[i]);
+            else MAP1(double, double, fabs(x[i]));
+            break;
+    }
+    out->valid = copy_valid(out, a, n);
+}
+
+static void run_cast(const Step* step, Register* out, const Register* a, int64_t n) {
+    ValueType to = step->type;
+    out->values = out->data;
+    out->valid = copy_valid(out, a, n);
+    switch (step->in) {
+        case VALUE_INT64:
+            if (to == VALUE_FLOAT64) MAP1(int64_t, double, x[i]);
+            else MAP1(int64_t, uint8_t, x[i] != 0);
+            break;
+        case VALUE_BOOL:
+            if (to == VALUE_INT64) MAP1(uint8_t, int64_t, x[i]);
+            else MAP1(uint8_t, double, x[i]);
+            break;
+        default:
+            if (to == VALUE_BOOL) {
+                MAP1(double, uint8_t, x[i] != 0);
+            } else {
+                // NaN and values outside int64 are null
+                const double* x = a->values;
+                int64_t* z = out->data;
+                uint8_t* v = out->data_valid;
+                if (!out->valid) memset(v, 1, n);
+                for (int64_t i = 0; i < n; i++) {
+                    bool ok = x[i] >= -9223372036854775808.0 && x[i] < 9223372036854775808.0;
+                    z[i] = ok ? (int64_t)x[i] : 0;
+                    v[i] &= ok;
+                }
+                out->valid = v;
+            }
+            break;
+    }
+}
+
+static const char* view_data(const struct ArrowArray* array, const uint8_t* view, int32_t len) {
+    if (len <= STRING_VIEW_INLINE_MAX) return (const char*)view + 4;
+    int32_t buffer_index, offset;
+    memcpy(&buffer_index, view + 8, 4);
+    memcpy(&offset, view + 12, 4);
+    return (const char*)array->buffers[2 + buffer_index] + offset;
+}
+
+// String at physical index idx of a column, or the literal
+static const char* string_at(const RegisterInfo* info, int64_t idx, int64_t* out_len) {
+    if (info->literal) {
+        *out_len = (int64_t)info->text_len;
+        return info->text;
+    }
+    const struct ArrowArray* array = info->array;
+    switch (info->layout) {
+        case STRING_LAYOUT_LARGE: {
+            const int64_t* offsets = (const int64_t*)array->buffers[1];
+            *out_len = offsets[idx + 1] - offsets[idx];
+            return (const char*)array->buffers[2] + offsets[idx];
+        }
+        case STRING_LAYOUT_VIEW: {
+            const uint8_t* view = (const uint8_t*)array->buffers[1] + idx * STRING_VIEW_SIZE;
+            int32_t len;
+            memcpy(&len, view, 4);
+            *out_len = len;
+            return view_data(array, view, len);
+        }
+        default: {
+            const int32_t* offsets = (const int32_t*)array->buffers[1];
+            *out_len = offsets[idx + 1] - offsets[idx];
+            return (const char*)array->buffers[2] + offsets[idx];
+        }
+    }
+}
+
+static bool match_pattern(ArrowExprOp op, const char* s, int64_t len,
+                          const char* pattern, int64_t pattern_len) {
+    if (pattern_len > len) return false;
+    switch (op) {
+        case ARROW_EXPR_STARTS_WITH:
+            return memcmp(s, pattern, pattern_len) == 0;
+        case ARROW_EXPR_ENDS_WITH:
+            return memcmp(s + len - pattern_len, pattern, pattern_len) == 0;
+        default:
+            if (pattern_len == 0) return true;
+            for (int64_t i = 0; i + pattern_len <= len; i++) {
+                if (s[i] == pattern[0] && memcmp(s + i, pattern, pattern_len) == 0) return true;
+            }
+            return false;
+    }
+}
+
+static void run_string_step(const Program* prog, const Step* step, Register* out,
+                            const Register* a, const Register* b, int64_t row, int64_t n) {
+    const RegisterInfo* ia = &prog->regs[step->a];
+    uint8_t* z = out->data;
+    out->values = z;
+
+    if (step->kind == STEP_STRING_PREDICATE) {
+        out->valid = copy_valid(out, a, n);
+        for (int64_t i = 0; i < n; i++) {
+            int64_t len;
+            const char* s = string_at(ia, ia->offset + row + i, &len);
+            z[i] = (!a->valid || a->valid[i]) &&
+                   match_pattern(step->op, s, len, step->pattern, (int64_t)step->pattern_len);
+        }
+        return;
+    }
+
+    const RegisterInfo* ib = &prog->regs[step->b];
+    out->valid = merge_valid(out, a, b, n, false);
+    uint8_t want_equal = step->op == ARROW_EXPR_EQ;
+    for (int64_t i = 0; i < n; i++) {
+        if (out->valid && !out->valid[i]) {
+            z[i] = 0;
+            continue;
+        }
+        int64_t len_a, len_b;
+        const char* sa = string_at(ia, ia->offset + row + i, &len_a);
+        const char* sb = string_at(ib, ib->offset + row + i, &len_b);
+        bool equal = len_a == len_b && memcmp(sa, sb, len_a) == 0;
+        z[i] = equal == want_equal;
+    }
+}
+
+static void run_block(const Program* prog, Register* regs, int64_t row, int64_t n) {
+    for (int s = 0; s < prog->n_steps; s++) {
+        const Step* step = &prog->steps[s];
+        Register* out = &regs[step->out];
+        const Register* a = step->a >= 0 ? &regs[step->a] : NULL;
+        const Register* b = step->b >= 0 ? &regs[step->b] : NULL;
+        switch (step->kind) {
+            case STEP_LOAD:
+                load_column(&prog->regs[step->out], out, row, n);
+                break;
+            case STEP_UNARY:
+                run_unary(step, out, a, n);
+                break;
+            case STEP_BINARY:
+                run_binary(step, out, a, b, n);
+                break;
+            case STEP_CAST:
+                run_cast(step, out, a, n);
+                break;
+            case STEP_STRING_COMPARE:
+            case STEP_STRING_PREDICATE:
+                run_string_step(prog, step, out, a, b, row, n);
+                break;
+        }
+    }
+}
+
+// ============================================================================
+// Evaluation
+// ============================================================================
+
+typedef struct {
+    const Program* prog;
+    int64_t length;
+    ValueType type;
+    void* values;           // result buffers
+    uint8_t* validity;
+    int64_t* null_counts;   // per morsel; -1 if its scratch allocation failed
+} EvalJob;
+
+// Copy a finished block of the result register into the output buffers
+static int64_t store_block(EvalJob* job, const Register* reg, int64_t row, int64_t n) {
+    int64_t nulls = 0;
+    if (reg->valid) {
+        for (int64_t i = 0; i < n; i++) nulls += !reg->valid[i];
+        pack_bits(reg->valid, n, job->validity + row / 8);
+    } else {
+        memset(job->validity + row / 8, 0xFF, (size_t)(n / 8));
+        if (n % 8) job->validity[row / 8 + n / 8] = (uint8_t)((1u << (n % 8)) - 1);
+    }
+
+    if (job->type == VALUE_BOOL) {
+        pack_bits(reg->values, n, (uint8_t*)job->values + row / 8);
+        if (nulls) {
+            // Clear the value bits of null rows
+            for (int64_t j = 0; j < (n + 7) / 8; j++) {
+                ((uint8_t*)job->values)[row / 8 + j] &= job->validity[row / 8 + j];
+            }
+        }
+    } else {
+        // Int64 and float64 slots are both 8 bytes; null rows are zeroed
+        uint64_t* out = (uint64_t*)job->values + row;
+        memcpy(out, reg->values, (size_t)n * sizeof(uint64_t));
+        if (nulls) {
+            for (int64_t i = 0; i < n; i++) {
+                if (!reg->valid[i]) out[i] = 0;
+            }
+        }
+    }
+    return nulls;
+}
+
+static void eval_morsels(void* ctx, size_t begin, size_t end) {
+    EvalJob* job = (EvalJob*)ctx;
+    const Program* prog = job->prog;
+    size_t slot = (size_t)ARROW_EXPR_BLOCK_ROWS * (sizeof(uint64_t) + 1);
+
+    // Scratch for every register, reused for all blocks of these morsels
+    Register* regs = calloc(prog->n_regs, sizeof(Register));
+    uint8_t* scratch = malloc(slot * prog->n_regs);
+    if (!regs || !scratch) {
+        for (size_t m = begin; m < end; m++) job->null_counts[m] = -1;
+        free(regs);
+        free(scratch);
+        return;
+    }
+    for (int r = 0; r < prog->n_regs; r++) {
+        const RegisterInfo* info = &prog->regs[r];
+        regs[r].data = scratch + slot * r;
+        regs[r].data_valid = scratch + slot * r + ARROW_EXPR_BLOCK_ROWS * sizeof(uint64_t);
+        if (!info->literal) continue;
+        regs[r].values = regs[r].data;
+        for (int64_t i = 0; i < ARROW_EXPR_BLOCK_ROWS; i++) {
+            switch (info->type) {
+                case VALUE_INT64: ((int64_t*)regs[r].data)[i] = info->int_value; break;
+                case VALUE_FLOAT64: ((double*)regs[r].data)[i] = info->float_value; break;
+                case VALUE_BOOL: ((uint8_t*)regs[r].data)[i] = (uint8_t)info->int_value; break;
+                case VALUE_STRING: break;
+            }
+        }
+    }
+
+    for (size_t m = begin; m < end; m++) {
+        int64_t start = (int64_t)m * ARROW_MORSEL_ROWS;
+        int64_t stop = start + ARROW_MORSEL_ROWS;
+        if (stop > job->length) stop = job->length;
+        int64_t nulls = 0;
+        for (int64_t row = start; row < stop; row += ARROW_EXPR_BLOCK_ROWS) {
+            int64_t n = stop - row < ARROW_EXPR_BLOCK_ROWS ? stop - row : ARROW_EXPR_BLOCK_ROWS;
+            run_block(prog, regs, row, n);
+            nulls += store_block(job, &regs[prog->result], row, n);
+        }
+        job->null_counts[m] = nulls;
+    }
+    free(scratch);
+    free(regs);
+}
+
+static void release_expression_result(struct ArrowArray* array) {
+    if (!array) return;
+    if (array->buffers) {
+        for (int64_t i = 0; i < array->n_buffers; i++) {
+            arrow_mem_free((void*)array->buffers[i]);
+        }
+        free(array->buffers);
+    }
+    array->release = NULL;
+}
+
+struct ArrowArray* arrow_expr_evaluate(const ArrowExpr* expr, const struct ArrowSchema* schema,
+                                       const struct ArrowArray* batch, const char** out_format) {
+    if (!expr || !schema || !batch) return NULL;
+    if (batch->n_children != schema->n_children) return NULL;
+
+    Program prog;
+    if (!compile(&prog, expr, schema, batch)) {
+        program_free(&prog);
+        return NULL;
+    }
+
+    int64_t length = batch->length;
+    ValueType type = prog.regs[prog.result].type;
+    int64_t bitmap_bytes = (length + 7) / 8;
+    int64_t value_bytes = type == VALUE_BOOL ? bitmap_bytes : length * (int64_t)sizeof(uint64_t);
+    size_t num_morsels = (size_t)((length + ARROW_MORSEL_ROWS - 1) / ARROW_MORSEL_ROWS);
+
+    struct ArrowArray* result = calloc(1, sizeof(struct ArrowArray));
+    void** buffers = calloc(2, sizeof(void*));
+    int64_t* null_counts = calloc(num_morsels + 1, sizeof(int64_t));
+    if (result && buffers) {
+        result->length = length;
+        result->n_buffers = 2;
+        result->buffers = (const void**)buffers;
+        result->release = release_expression_result;
+        buffers[0] = arrow_mem_alloc(bitmap_bytes > 0 ? bitmap_bytes : 1);
+        buffers[1] = arrow_mem_alloc(value_bytes > 0 ? value_bytes : 1);
+    } else {
+        free(buffers);
+    }
+    if (!result || !result->buffers || !buffers[0] || !buffers[1] || !null_counts) {
+        arrow_compute_array_free(result);
+        free(null_counts);
+        program_free(&prog);
+        return NULL;
+    }
+
+    EvalJob job = {
+        .prog = &prog,
+        .length = length,
+        .type = type,
+        .values = buffers[1],
+        .validity = buffers[0],
+        .null_counts = null_counts
+    };
+    arrow_parallel_for(num_morsels, 1, eval_morsels, &job);
+
+    int64_t null_count = 0;
+    for (size_t m = 0; m < num_morsels; m++) {
+        if (null_counts[m] < 0) {
+            arrow_compute_array_free(result);
+            free(null_counts);
+            program_free(&prog);
+            return NULL;
+        }
+        null_count += null_counts[m];
+    }
+    free(null_counts);
+    program_free(&prog);
+
+    result->null_count = null_count;
+    if (null_count == 0) {
+        arrow_mem_free(buffers[0]);
+        buffers[0] = NULL;
+    }
+    if (out_format) {
+        *out_format = type == VALUE_INT64 ? "l" : type == VALUE_FLOAT64 ? "g" : "b";
+    }
+    return result;
+}
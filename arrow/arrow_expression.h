@@ -0,0 +1,119 @@
+/**
+ * arrow_expression.h - Fused expression evaluation over record batches
+ *
+ * An expression tree (column references, literals, arithmetic, comparisons,
+ * boolean logic, casts and string predicates) is compiled once against a
+ * batch's schema into a short program over fixed-size registers, then run
+ * block by block: every operator processes ARROW_EXPR_BLOCK_ROWS rows before
+ * the next one starts, so intermediate values stay in L1/L2 cache and only
+ * the final column is written to memory. Chaining arrow_compute.h kernels
+ * instead materializes one full-length array per operator.
+ *
+ * Large batches are split into ARROW_MORSEL_ROWS morsels and evaluated on
+ * the shared thread pool (arrow_thread_pool.h); every task reuses its own
+ * scratch registers for all of its blocks.
+ *
+ * Semantics:
+ * - A null operand makes the result null, except for AND/OR, which use
+ *   Kleene logic (false AND null = false, true OR null = true), and
+ *   IS_NULL/IS_VALID, which are never null.
+ * - Integer and float operands promote to float64; int64 arithmetic wraps
+ *   on overflow. Integer division by zero (or INT64_MIN / -1) is null.
+ * - Casting a float64 that is NaN or out of int64 range to int64 is null.
+ * - Strings may only be compared with EQ/NE or tested with a string
+ *   predicate.
+ */
+
+#ifndef ARROW_EXPRESSION_H
+#define ARROW_EXPRESSION_H
+
+#include "arrow_c_abi.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Rows evaluated per operator before moving to the next one. Registers hold
+// one block of 8-byte values, so a few of them fit comfortably in L1.
+#define ARROW_EXPR_BLOCK_ROWS 1024
+
+typedef struct ArrowExpr ArrowExpr;
+
+typedef enum {
+    // Unary
+    ARROW_EXPR_NEGATE,
+    ARROW_EXPR_ABS,
+    ARROW_EXPR_NOT,
+    ARROW_EXPR_IS_NULL,
+    ARROW_EXPR_IS_VALID,
+    // Arithmetic
+    ARROW_EXPR_ADD,
+    ARROW_EXPR_SUBTRACT,
+    ARROW_EXPR_MULTIPLY,
+    ARROW_EXPR_DIVIDE,
+    // Comparison
+    ARROW_EXPR_EQ,
+    ARROW_EXPR_NE,
+    ARROW_EXPR_LT,
+    ARROW_EXPR_LE,
+    ARROW_EXPR_GT,
+    ARROW_EXPR_GE,
+    // Boolean
+    ARROW_EXPR_AND,
+    ARROW_EXPR_OR,
+    ARROW_EXPR_XOR,
+    // String predicates
+    ARROW_EXPR_CONTAINS,
+    ARROW_EXPR_STARTS_WITH,
+    ARROW_EXPR_ENDS_WITH
+} ArrowExprOp;
+
+typedef enum {
+    ARROW_EXPR_TYPE_INT64,      // "l"
+    ARROW_EXPR_TYPE_FLOAT64,    // "g"
+    ARROW_EXPR_TYPE_BOOL        // "b"
+} ArrowExprType;
+
+// ============================================================================
+// Building Expressions
+// ============================================================================
+
+// Leaves. Columns may be int64, int32, float64, float32, bool, or (for
+// string operations) utf8, large utf8 and string view columns; int32 and
+// float32 columns are widened to 64 bits as they are read.
+ArrowExpr* arrow_expr_column(int64_t index);
+ArrowExpr* arrow_expr_column_named(const char* name);
+ArrowExpr* arrow_expr_literal_int64(int64_t value);
+ArrowExpr* arrow_expr_literal_float64(double value);
+ArrowExpr* arrow_expr_literal_bool(bool value);
+ArrowExpr* arrow_expr_literal_string(const char* value);
+
+// Operators take ownership of their operands, also on failure. Passing a
+// NULL operand (e.g. a failed constructor) returns NULL, so trees can be
+// built by nesting calls and checked once.
+ArrowExpr* arrow_expr_unary(ArrowExprOp op, ArrowExpr* operand);
+ArrowExpr* arrow_expr_binary(ArrowExprOp op, ArrowExpr* left, ArrowExpr* right);
+ArrowExpr* arrow_expr_cast(ArrowExpr* operand, ArrowExprType type);
+ArrowExpr* arrow_expr_string_predicate(ArrowExprOp op, ArrowExpr* operand, const char* pattern);
+
+void arrow_expr_free(ArrowExpr* expr);
+
+// ============================================================================
+// Evaluation
+// ============================================================================
+
+// Evaluate `expr` over a record batch: a struct array whose children are the
+// columns described by `schema`. Returns a new int64, float64 or bool array
+// of batch->length rows (free with arrow_compute_array_free) and stores its
+// format in *out_format if that is not NULL. Returns NULL if the expression
+// does not type-check against the schema or allocation fails.
+struct ArrowArray* arrow_expr_evaluate(const ArrowExpr* expr, const struct ArrowSchema* schema,
+                                       const struct ArrowArray* batch, const char** out_format);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARROW_EXPRESSION_H
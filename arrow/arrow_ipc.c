@@ -2,11 +2,25 @@
  * Arrow IPC Serialization/Deserialization Implementation
  */
 
+/* posix_memalign */
+#define _POSIX_C_SOURCE 200112L
+
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <lz4frame.h>
+#include <zstd.h>
 #include "arrow_ipc.h"
 #include "arrow_c_abi.h"
+#define ARROW_MEMORY_SUBSYSTEM ARROW_MEMORY_IPC
+#include "arrow_memory.h"
+
+/* ZSTD level used when the options leave it at 0 */
+#define IPC_ZSTD_DEFAULT_LEVEL 1
+
+/* Upper bounds on the expansion of a compressed buffer */
+#define IPC_LZ4_MAX_RATIO  256
+#define IPC_ZSTD_MAX_RATIO 32768
 
 /* ============================================================================
  * Buffer Operations
@@ -86,6 +100,32 @@ int arrow_ipc_buffer_write_i64(ArrowIPCBuffer* buf, int64_t value) {
     return arrow_ipc_buffer_write_u64(buf, (uint64_t)value);
 }
 
+/*
+ * Allocate a buffer of exactly `size` bytes, aligned so that blob-relative
+ * alignment is also absolute alignment. Writes never need to grow it.
+ */
+static int ipc_buffer_init_exact(ArrowIPCBuffer* buf, size_t size) {
+    void* data = NULL;
+    arrow_ipc_buffer_init(buf);
+    if (posix_memalign(&data, ARROW_IPC_ALIGNMENT, size > 0 ? size : 1) != 0) {
+        return ARROW_IPC_ERR_ALLOC;
+    }
+    buf->data = (uint8_t*)data;
+    buf->capacity = size;
+    return ARROW_IPC_OK;
+}
+
+/* Give back the unused capacity of a buffer grown by doubling */
+static void buffer_shrink_to_fit(ArrowIPCBuffer* buf) {
+    if (buf->size < buf->capacity) {
+        uint8_t* shrunk = (uint8_t*)realloc(buf->data, buf->size > 0 ? buf->size : 1);
+        if (shrunk) {
+            buf->data = shrunk;
+            buf->capacity = buf->size > 0 ? buf->size : 1;
+        }
+    }
+}
+
 /* Read helpers */
 static uint32_t read_u32(const uint8_t* data) {
     return (uint32_t)data[0] |
@@ -106,6 +146,187 @@ static int64_t read_i64(const uint8_t* data) {
     return (int64_t)read_u64(data);
 }
 
+static void store_u64(uint8_t* dst, uint64_t value) {
+    for (int i = 0; i < 8; i++) {
+        dst[i] = (uint8_t)((value >> (i * 8)) & 0xFF);
+    }
+}
+
+/* ============================================================================
+ * Buffer Compression
+ * ============================================================================ */
+
+void arrow_ipc_write_options_init(ArrowIPCWriteOptions* options) {
+    options->compression = ARROW_IPC_COMPRESSION_NONE;
+    options->level = 0;
+    options->min_compress_size = ARROW_IPC_COMPRESSION_MIN_SIZE;
+    options->emit_dictionary_deltas = 0;
+}
+
+int arrow_ipc_codec_init(ArrowIPCCodec* codec, ArrowIPCCompression compression, int level) {
+    codec->compression = compression;
+    codec->level = level;
+    codec->state = NULL;
+    switch (compression) {
+        case ARROW_IPC_COMPRESSION_NONE:
+        case ARROW_IPC_COMPRESSION_LZ4_FRAME:
+        case ARROW_IPC_COMPRESSION_ZSTD:
+            return ARROW_IPC_OK;
+        default:
+            return ARROW_IPC_ERR_UNSUPPORTED;
+    }
+}
+
+void arrow_ipc_codec_free(ArrowIPCCodec* codec) {
+    if (!codec->state) return;
+    if (codec->compression == ARROW_IPC_COMPRESSION_ZSTD) {
+        ZSTD_freeCCtx((ZSTD_CCtx*)codec->state);
+    } else if (codec->compression == ARROW_IPC_COMPRESSION_LZ4_FRAME) {
+        LZ4F_freeCompressionContext((LZ4F_cctx*)codec->state);
+    }
+    codec->state = NULL;
+}
+
+static void lz4_preferences(const ArrowIPCCodec* codec, size_t size, LZ4F_preferences_t* prefs) {
+    memset(prefs, 0, sizeof(LZ4F_preferences_t));
+    prefs->frameInfo.contentSize = size;
+    prefs->compressionLevel = codec->level;
+}
+
+size_t arrow_ipc_codec_bound(const ArrowIPCCodec* codec, size_t size) {
+    switch (codec->compression) {
+        case ARROW_IPC_COMPRESSION_ZSTD:
+            return ZSTD_compressBound(size);
+        case ARROW_IPC_COMPRESSION_LZ4_FRAME: {
+            LZ4F_preferences_t prefs;
+            lz4_preferences(codec, size, &prefs);
+            return LZ4F_compressFrameBound(size, &prefs);
+        }
+        default:
+            return size;
+    }
+}
+
+static int lz4_compress(ArrowIPCCodec* codec, const void* src, size_t size,
+                        void* dst, size_t capacity, size_t* out_size) {
+    if (!codec->state) {
+        LZ4F_cctx* cctx = NULL;
+        if (LZ4F_isError(LZ4F_createCompressionContext(&cctx, LZ4F_VERSION))) return ARROW_IPC_ERR_ALLOC;
+        codec->state = cctx;
+    }
+    LZ4F_cctx* cctx = (LZ4F_cctx*)codec->state;
+    LZ4F_preferences_t prefs;
+    lz4_preferences(codec, size, &prefs);
+
+    uint8_t* out = (uint8_t*)dst;
+    size_t written = LZ4F_compressBegin(cctx, out, capacity, &prefs);
+    if (LZ4F_isError(written)) return ARROW_IPC_ERR_FORMAT;
+    size_t n = LZ4F_compressUpdate(cctx, out + written, capacity - written, src, size, NULL);
+    if (LZ4F_isError(n)) return ARROW_IPC_ERR_FORMAT;
+    written += n;
+    n = LZ4F_compressEnd(cctx, out + written, capacity - written, NULL);
+    if (LZ4F_isError(n)) return ARROW_IPC_ERR_FORMAT;
+    *out_size = written + n;
+    return ARROW_IPC_OK;
+}
+
+int arrow_ipc_codec_compress(
+    ArrowIPCCodec* codec,
+    const void* src,
+    size_t size,
+    void* dst,
+    size_t capacity,
+    size_t* out_size
+) {
+    if (!codec || (!src && size > 0) || !dst || !out_size) return ARROW_IPC_ERR_NULL;
+
+    switch (codec->compression) {
+        case ARROW_IPC_COMPRESSION_ZSTD: {
+            if (!codec->state) {
+                codec->state = ZSTD_createCCtx();
+                if (!codec->state) return ARROW_IPC_ERR_ALLOC;
+            }
+            int level = codec->level != 0 ? codec->level : IPC_ZSTD_DEFAULT_LEVEL;
+            size_t n = ZSTD_compressCCtx((ZSTD_CCtx*)codec->state, dst, capacity, src, size, level);
+            if (ZSTD_isError(n)) return ARROW_IPC_ERR_FORMAT;
+            *out_size = n;
+            return ARROW_IPC_OK;
+        }
+        case ARROW_IPC_COMPRESSION_LZ4_FRAME:
+            return lz4_compress(codec, src, size, dst, capacity, out_size);
+        default:
+            return ARROW_IPC_ERR_UNSUPPORTED;
+    }
+}
+
+static int lz4_decompress(const uint8_t* src, size_t size, uint8_t* dst, size_t dst_size) {
+    LZ4F_dctx* dctx = NULL;
+    if (LZ4F_isError(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION))) return ARROW_IPC_ERR_ALLOC;
+
+    /* Concatenated frames are accepted; each call resumes where the last stopped */
+    size_t consumed = 0, written = 0, hint = 1;
+    int rc = ARROW_IPC_OK;
+    while (consumed < size) {
+        size_t in = size - consumed;
+        size_t out = dst_size - written;
+        hint = LZ4F_decompress(dctx, dst + written, &out, src + consumed, &in, NULL);
+        if (LZ4F_isError(hint) || (in == 0 && out == 0)) {
+            rc = ARROW_IPC_ERR_FORMAT;
+            break;
+        }
+        consumed += in;
+        written += out;
+    }
+    LZ4F_freeDecompressionContext(dctx);
+    if (rc == ARROW_IPC_OK && (hint != 0 || written != dst_size)) rc = ARROW_IPC_ERR_FORMAT;
+    return rc;
+}
+
+/* Whether `size` compressed bytes can plausibly expand to `dst_size` */
+static int decompressed_size_ok(ArrowIPCCompression compression, const void* src, size_t size, size_t dst_size) {
+    switch (compression) {
+        case ARROW_IPC_COMPRESSION_ZSTD: {
+            unsigned long long content = ZSTD_getFrameContentSize(src, size);
+            if (content == ZSTD_CONTENTSIZE_ERROR) return 0;
+            if (content != ZSTD_CONTENTSIZE_UNKNOWN) return content == dst_size;
+            return dst_size / IPC_ZSTD_MAX_RATIO <= size;
+        }
+        case ARROW_IPC_COMPRESSION_LZ4_FRAME:
+            return dst_size / IPC_LZ4_MAX_RATIO <= size;
+        default:
+            return 0;
+    }
+}
+
+int arrow_ipc_decompress(
+    ArrowIPCCompression compression,
+    const void* src,
+    size_t size,
+    size_t dst_size,
+    void** out
+) {
+    if (!src || !out) return ARROW_IPC_ERR_NULL;
+    *out = NULL;
+    if (!decompressed_size_ok(compression, src, size, dst_size)) return ARROW_IPC_ERR_FORMAT;
+
+    void* dst = arrow_mem_alloc(dst_size > 0 ? dst_size : 1);
+    if (!dst) return ARROW_IPC_ERR_ALLOC;
+
+    int rc;
+    if (compression == ARROW_IPC_COMPRESSION_ZSTD) {
+        size_t n = ZSTD_decompress(dst, dst_size, src, size);
+        rc = !ZSTD_isError(n) && n == dst_size ? ARROW_IPC_OK : ARROW_IPC_ERR_FORMAT;
+    } else {
+        rc = lz4_decompress((const uint8_t*)src, size, (uint8_t*)dst, dst_size);
+    }
+    if (rc != ARROW_IPC_OK) {
+        arrow_mem_free(dst);
+        return rc;
+    }
+    *out = dst;
+    return ARROW_IPC_OK;
+}
+
 /* ============================================================================
  * Format Helpers
  * ============================================================================ */
@@ -123,9 +344,13 @@ int arrow_ipc_get_buffer_count(const char* format) {
         case 'u': case 'U':  /* utf8 string */
         case 'z': case 'Z':  /* binary */
             return 3;  /* validity + offsets + data */
+        case 'v':  /* string/binary view */
+            return 3;  /* validity + views + data sizes, plus each data buffer */
         case '+':
             if (format[1] == 's') return 1;  /* struct: just validity */
-            if (format[1] == 'l') return 2;  /* list: validity + offsets */
+            if (format[1] == 'l' || format[1] == 'L') return 2;  /* list: validity + offsets */
+            if (format[1] == 'm') return 2;  /* map: validity + offsets */
+            if (format[1] == 'w') return 1;  /* fixed-size list: just validity */
             return -1;
         case 't':
             /* timestamp, date, time, duration */
@@ -150,6 +375,9 @@ int arrow_ipc_get_element_size(const char* format) {
         case 'g': return 8;   /* float64 */
         case 'u': case 'U': case 'z': case 'Z':
             return 0;  /* variable-width */
+        case 'v': return 16;  /* string/binary view */
+        case 'w':  /* fixed-size binary "w:N" */
+            return format[1] == ':' ? atoi(format + 2) : 0;
         case 't':
             /* Timestamps are 64-bit */
             if (format[1] == 's' || format[1] == 'd') return 8;
@@ -203,6 +431,19 @@ static int serialize_schema_internal(ArrowIPCBuffer* buf, const struct ArrowSche
     return ARROW_IPC_OK;
 }
 
+/* Bytes serialize_schema_internal writes for this schema */
+static size_t schema_serialized_size(const struct ArrowSchema* schema) {
+    size_t size = 4 + (schema->format ? strlen(schema->format) : 0) +
+                  4 + (schema->name ? strlen(schema->name) : 0) +
+                  8 + 8;
+    for (int64_t i = 0; i < schema->n_children; i++) {
+        if (schema->children && schema->children[i]) {
+            size += schema_serialized_size(schema->children[i]);
+        }
+    }
+    return size;
+}
+
 int arrow_ipc_serialize_schema(
     const struct ArrowSchema* schema,
     uint8_t** out_data,
@@ -213,9 +454,8 @@ int arrow_ipc_serialize_schema(
     }
 
     ArrowIPCBuffer buf;
-    arrow_ipc_buffer_init(&buf);
-
-    int rc;
+    int rc = ipc_buffer_init_exact(&buf, 8 + schema_serialized_size(schema));
+    if (rc != ARROW_IPC_OK) return rc;
 
     /* Magic number */
     rc = arrow_ipc_buffer_write_u32(&buf, ARROW_IPC_MAGIC_SCHEMA);
@@ -238,6 +478,54 @@ error:
     return rc;
 }
 
+/* ============================================================================
+ * Schema Fingerprints
+ * ============================================================================ */
+
+#define IPC_FNV_OFFSET 0xcbf29ce484222325ULL
+#define IPC_FNV_PRIME  0x100000001b3ULL
+
+/* FNV-1a over `len` bytes */
+static uint64_t fnv1a(uint64_t hash, const void* data, size_t len) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= bytes[i];
+        hash *= IPC_FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint64_t fnv1a_u64(uint64_t hash, uint64_t value) {
+    uint8_t bytes[8];
+    store_u64(bytes, value);
+    return fnv1a(hash, bytes, 8);
+}
+
+/* Hash the fields serialize_schema_internal writes, in the same order */
+static uint64_t fingerprint_schema(uint64_t hash, const struct ArrowSchema* schema) {
+    size_t format_len = schema->format ? strlen(schema->format) : 0;
+    hash = fnv1a_u64(hash, format_len);
+    hash = fnv1a(hash, schema->format, format_len);
+
+    size_t name_len = schema->name ? strlen(schema->name) : 0;
+    hash = fnv1a_u64(hash, name_len);
+    hash = fnv1a(hash, schema->name, name_len);
+
+    hash = fnv1a_u64(hash, (uint64_t)schema->flags);
+    hash = fnv1a_u64(hash, (uint64_t)schema->n_children);
+    for (int64_t i = 0; i < schema->n_children; i++) {
+        if (schema->children && schema->children[i]) {
+            hash = fingerprint_schema(hash, schema->children[i]);
+        }
+    }
+    return hash;
+}
+
+uint64_t arrow_ipc_schema_fingerprint(const struct ArrowSchema* schema) {
+    if (!schema) return 0;
+    return fingerprint_schema(IPC_FNV_OFFSET, schema);
+}
+
 /* ============================================================================
  * Schema Deserialization
  * ============================================================================ */
@@ -382,7 +670,7 @@ int arrow_ipc_deserialize_schema(
     /* Version */
     if (offset + 4 > size) return ARROW_IPC_ERR_TRUNCATE;
     uint32_t version = read_u32(data + offset);
-    if (version != ARROW_IPC_VERSION) return ARROW_IPC_ERR_VERSION;
+    if (version != ARROW_IPC_VERSION && version != ARROW_IPC_VERSION_UNALIGNED) return ARROW_IPC_ERR_VERSION;
     offset += 4;
 
     /* Deserialize schema content */
@@ -399,21 +687,351 @@ int arrow_ipc_deserialize_schema(
  * Array Serialization
  * ============================================================================ */
 
-static int serialize_array_internal(
+/* Zero bytes needed to align `position` to ARROW_IPC_ALIGNMENT */
+static size_t align_padding(size_t position) {
+    return (ARROW_IPC_ALIGNMENT - (position % ARROW_IPC_ALIGNMENT)) % ARROW_IPC_ALIGNMENT;
+}
+
+/*
+ * Element range of an array being serialized. `offset` indexes the array's
+ * buffers directly: it is array->offset plus the offset inherited from a
+ * struct or list parent. Only this range is written, and the serialized
+ * array always has offset 0.
+ */
+typedef struct {
+    int64_t offset;
+    int64_t length;
+} IPCRange;
+
+static IPCRange array_full_range(const struct ArrowArray* array) {
+    IPCRange range = {array->offset, array->length};
+    return range;
+}
+
+/* Width of the offsets in buffer 1 (0: the type has no offsets buffer) */
+static int offsets_width(const char* format) {
+    switch (format[0]) {
+        case 'u': case 'z': return 4;
+        case 'U': case 'Z': return 8;
+        case '+':
+            if (format[1] == 'l' || format[1] == 'm') return 4;
+            if (format[1] == 'L') return 8;
+            return 0;
+        default:
+            return 0;
+    }
+}
+
+/* Children per element of a fixed-size list "+w:N" (0 for other types) */
+static int64_t fixed_list_size(const char* format) {
+    if (format[0] != '+' || format[1] != 'w' || format[2] != ':') return 0;
+    return atoll(format + 3);
+}
+
+static int64_t load_offset(const void* offsets, int width, int64_t i) {
+    return width == 4 ? ((const int32_t*)offsets)[i] : ((const int64_t*)offsets)[i];
+}
+
+/* How a buffer's bytes are produced from the source buffer */
+typedef enum {
+    IPC_SLICE_COPY,     /* `size` bytes at `data` */
+    IPC_SLICE_BITMAP,   /* Bits [first, first + length) shifted to bit 0 */
+    IPC_SLICE_OFFSETS   /* Offsets [first, first + length] minus `base` */
+} IPCSliceKind;
+
+typedef struct {
+    IPCSliceKind kind;
+    const uint8_t* data;
+    size_t size;        /* Serialized size in bytes */
+    int64_t first;
+    int64_t length;
+    int64_t base;
+    int width;
+} IPCBufferSlice;
+
+/* The part of buffer i that `range` references */
+static IPCBufferSlice array_buffer_slice(
+    const struct ArrowArray* array,
+    const struct ArrowSchema* schema,
+    int64_t i,
+    IPCRange range
+) {
+    IPCBufferSlice slice = {IPC_SLICE_COPY, NULL, 0, range.offset, range.length, 0, 0};
+    if (!array->buffers || !array->buffers[i] || range.length < 0) return slice;
+
+    const uint8_t* buffer = (const uint8_t*)array->buffers[i];
+    const char* format = schema->format;
+    int width = offsets_width(format);
+
+    if (i == 0 || (format[0] == 'b' && i == 1)) {
+        /* Validity bitmap, or boolean values */
+        slice.kind = range.offset % 8 == 0 ? IPC_SLICE_COPY : IPC_SLICE_BITMAP;
+        slice.data = buffer + (slice.kind == IPC_SLICE_COPY ? range.offset / 8 : 0);
+        slice.size = (size_t)((range.length + 7) / 8);
+        return slice;
+    }
+    if (width > 0 && i == 1) {
+        /* Offsets, re-based to start at 0 */
+        slice.base = load_offset(buffer, width, range.offset);
+        slice.kind = slice.base == 0 ? IPC_SLICE_COPY : IPC_SLICE_OFFSETS;
+        slice.data = buffer + (slice.kind == IPC_SLICE_COPY ? range.offset * width : 0);
+        slice.size = (size_t)(range.length + 1) * (size_t)width;
+        slice.width = width;
+        return slice;
+    }
+    if (width > 0 && format[0] != '+' && i == 2) {
+        /* Variable-width data referenced by the offsets */
+        const void* offsets = array->buffers[1];
+        if (!offsets) return slice;
+        int64_t start = load_offset(offsets, width, range.offset);
+        int64_t end = load_offset(offsets, width, range.offset + range.length);
+        slice.data = buffer + start;
+        slice.size = end > start ? (size_t)(end - start) : 0;
+        return slice;
+    }
+    if (format[0] == 'v' && i >= 2) {
+        /* Views point anywhere in the data buffers, so those are written
+         * whole; the last buffer holds their int64 sizes */
+        int64_t n_data = array->n_buffers - 3;
+        const int64_t* sizes = (const int64_t*)array->buffers[array->n_buffers - 1];
+        slice.data = buffer;
+        if (i == array->n_buffers - 1) {
+            slice.size = (size_t)n_data * sizeof(int64_t);
+        } else if (sizes) {
+            slice.size = (size_t)sizes[i - 2];
+        }
+        return slice;
+    }
+    if (width == 0) {
+        int element_size = arrow_ipc_get_element_size(format);
+        if (element_size > 0) {
+            slice.data = buffer + range.offset * element_size;
+            slice.size = (size_t)range.length * (size_t)element_size;
+        }
+    }
+    return slice;
+}
+
+/*
+ * Copy `length` bits starting at bit `first` of `src` to bit 0 of `dst`,
+ * eight bytes at a time where possible. Bits past `length` are cleared.
+ */
+static void copy_bitmap_shifted(uint8_t* dst, const uint8_t* src, int64_t first, int64_t length) {
+    size_t out_bytes = (size_t)((length + 7) / 8);
+    if (out_bytes == 0) return;
+
+    const uint8_t* s = src + first / 8;
+    unsigned shift = (unsigned)(first % 8);
+    size_t src_bytes = (size_t)((shift + length + 7) / 8);
+    size_t j = 0;
+
+    if (shift == 0) {
+        memcpy(dst, s, out_bytes);
+    } else {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        for (; j + 9 <= src_bytes; j += 8) {
+            uint64_t word;
+            memcpy(&word, s + j, 8);
+            word = (word >> shift) | ((uint64_t)s[j + 8] << (64 - shift));
+            memcpy(dst + j, &word, 8);
+        }
+#endif
+        for (; j < out_bytes; j++) {
+            uint8_t high = j + 1 < src_bytes ? (uint8_t)(s[j + 1] << (8 - shift)) : 0;
+            dst[j] = (uint8_t)(s[j] >> shift) | high;
+        }
+    }
+
+    if (length % 8 != 0) {
+        dst[out_bytes - 1] &= (uint8_t)((1u << (length % 8)) - 1);
+    }
+}
+
+/* Write the serialized bytes of `slice` (slice->size of them) to dst */
+static void buffer_slice_write(const IPCBufferSlice* slice, uint8_t* dst) {
+    switch (slice->kind) {
+        case IPC_SLICE_COPY:
+            memcpy(dst, slice->data, slice->size);
+            break;
+        case IPC_SLICE_BITMAP:
+            copy_bitmap_shifted(dst, slice->data, slice->first, slice->length);
+            break;
+        case IPC_SLICE_OFFSETS:
+            if (slice->width == 4) {
+                const int32_t* src = (const int32_t*)slice->data + slice->first;
+                int32_t base = (int32_t)slice->base;
+                for (int64_t k = 0; k <= slice->length; k++) {
+                    int32_t value = src[k] - base;
+                    memcpy(dst + k * 4, &value, 4);
+                }
+            } else {
+                const int64_t* src = (const int64_t*)slice->data + slice->first;
+                for (int64_t k = 0; k <= slice->length; k++) {
+                    int64_t value = src[k] - slice->base;
+                    memcpy(dst + k * 8, &value, 8);
+                }
+            }
+            break;
+    }
+}
+
+/* Number of set bits in [first, first + length) of a bitmap */
+static int64_t count_set_bits(const uint8_t* bitmap, int64_t first, int64_t length) {
+    int64_t count = 0;
+    int64_t i = first;
+    int64_t end = first + length;
+
+    for (; i < end && i % 64 != 0; i++) {
+        count += (bitmap[i / 8] >> (i % 8)) & 1;
+    }
+    for (; i + 64 <= end; i += 64) {
+        uint64_t word;
+        memcpy(&word, bitmap + i / 8, 8);
+        count += __builtin_popcountll(word);
+    }
+    for (; i < end; i++) {
+        count += (bitmap[i / 8] >> (i % 8)) & 1;
+    }
+    return count;
+}
+
+/* Null count of the serialized range */
+static int64_t range_null_count(
+    const struct ArrowArray* array,
+    const struct ArrowSchema* schema,
+    IPCRange range
+) {
+    if (schema->format[0] == 'n') return range.length;
+    if (!array->buffers || array->n_buffers < 1 || !array->buffers[0]) return 0;
+    if (range.offset == array->offset && range.length == array->length && array->null_count >= 0) {
+        return array->null_count;
+    }
+    return range.length - count_set_bits((const uint8_t*)array->buffers[0], range.offset, range.length);
+}
+
+/* Range of child i referenced by the parent's range */
+static IPCRange child_range(
+    const struct ArrowArray* array,
+    const struct ArrowSchema* schema,
+    IPCRange range,
+    int64_t i
+) {
+    const struct ArrowArray* child = array->children[i];
+    IPCRange result = {child->offset + range.offset, range.length};
+
+    int width = offsets_width(schema->format);
+    if (schema->format[0] == '+' && width > 0) {
+        /* List values spanned by the parent's offsets */
+        const void* offsets = array->n_buffers > 1 && array->buffers ? array->buffers[1] : NULL;
+        int64_t start = offsets ? load_offset(offsets, width, range.offset) : 0;
+        int64_t end = offsets ? load_offset(offsets, width, range.offset + range.length) : 0;
+        result.offset = child->offset + start;
+        result.length = end > start ? end - start : 0;
+    } else if (fixed_list_size(schema->format) > 0) {
+        /* N values per list */
+        int64_t n = fixed_list_size(schema->format);
+        result.offset = child->offset + range.offset * n;
+        result.length = range.length * n;
+    }
+    return result;
+}
+
+/* Bytes serialize_array_range writes when starting at blob position `position` */
+static size_t array_serialized_size(
+    const struct ArrowArray* array,
+    const struct ArrowSchema* schema,
+    IPCRange range,
+    size_t position
+) {
+    size_t size = 5 * 8;  /* length, null_count, offset, n_buffers, n_children */
+
+    for (int64_t i = 0; i < array->n_buffers; i++) {
+        size_t buffer_size = array_buffer_slice(array, schema, i, range).size;
+        size += 8;
+        if (buffer_size > 0) {
+            size += align_padding(position + size) + buffer_size;
+        }
+    }
+
+    for (int64_t i = 0; i < array->n_children; i++) {
+        if (array->children && array->children[i] &&
+            schema->children && schema->children[i]) {
+            size += array_serialized_size(array->children[i], schema->children[i],
+                                          child_range(array, schema, range, i), position + size);
+        }
+    }
+
+    return size;
+}
+
+/* Compression settings of a version 3 serialization */
+typedef struct {
+    ArrowIPCCodec codec;
+    size_t min_compress_size;
+} IPCCompressor;
+
+/*
+ * Version 3 buffer body after its size: uncompressed length (-1 when
+ * stored as is), padding, stored bytes. The size is patched once the
+ * compressed length is known.
+ */
+static int write_compressed_buffer(
+    ArrowIPCBuffer* buf,
+    IPCCompressor* compressor,
+    size_t size_pos,
+    const void* data,
+    size_t size
+) {
+    static const uint8_t zeros[ARROW_IPC_ALIGNMENT] = {0};
+
+    size_t length_pos = buf->size;
+    int rc = arrow_ipc_buffer_write_i64(buf, -1);
+    if (rc != ARROW_IPC_OK) return rc;
+    rc = arrow_ipc_buffer_write(buf, zeros, align_padding(buf->size));
+    if (rc != ARROW_IPC_OK) return rc;
+
+    if (size >= compressor->min_compress_size) {
+        size_t bound = arrow_ipc_codec_bound(&compressor->codec, size);
+        rc = arrow_ipc_buffer_reserve(buf, bound);
+        if (rc != ARROW_IPC_OK) return rc;
+
+        /* Incompressible buffers (or codec failures) fall back to raw */
+        size_t compressed = 0;
+        if (arrow_ipc_codec_compress(&compressor->codec, data, size, buf->data + buf->size,
+                                     bound, &compressed) == ARROW_IPC_OK && compressed < size) {
+            store_u64(buf->data + size_pos, (uint64_t)compressed);
+            store_u64(buf->data + length_pos, (uint64_t)size);
+            buf->size += compressed;
+            return ARROW_IPC_OK;
+        }
+    }
+    return arrow_ipc_buffer_write(buf, data, size);
+}
+
+/*
+ * Every non-empty buffer starts on an ARROW_IPC_ALIGNMENT boundary relative
+ * to the start of the blob, which must be where `buf` starts. With a
+ * compressor, buffers use the version 3 layout. Only `range` is written,
+ * so serializing a slice costs time proportional to the slice.
+ */
+static int serialize_array_range(
     ArrowIPCBuffer* buf,
     const struct ArrowArray* array,
-    const struct ArrowSchema* schema
+    const struct ArrowSchema* schema,
+    IPCRange range,
+    IPCCompressor* compressor
 ) {
+    static const uint8_t zeros[ARROW_IPC_ALIGNMENT] = {0};
     int rc;
 
     /* Array metadata */
-    rc = arrow_ipc_buffer_write_i64(buf, array->length);
+    rc = arrow_ipc_buffer_write_i64(buf, range.length);
     if (rc != ARROW_IPC_OK) return rc;
 
-    rc = arrow_ipc_buffer_write_i64(buf, array->null_count);
+    rc = arrow_ipc_buffer_write_i64(buf, range_null_count(array, schema, range));
     if (rc != ARROW_IPC_OK) return rc;
 
-    rc = arrow_ipc_buffer_write_i64(buf, array->offset);
+    rc = arrow_ipc_buffer_write_i64(buf, 0);
     if (rc != ARROW_IPC_OK) return rc;
 
     rc = arrow_ipc_buffer_write_i64(buf, array->n_buffers);
@@ -422,48 +1040,35 @@ static int serialize_array_internal(
     rc = arrow_ipc_buffer_write_i64(buf, array->n_children);
     if (rc != ARROW_IPC_OK) return rc;
 
-    /* Calculate buffer sizes based on type */
-    int element_size = arrow_ipc_get_element_size(schema->format);
-
     /* Serialize each buffer */
     for (int64_t i = 0; i < array->n_buffers; i++) {
-        size_t buffer_size = 0;
-
-        if (array->buffers && array->buffers[i]) {
-            /* Determine buffer size based on buffer index and type */
-            if (i == 0) {
-                /* Validity bitmap: (length + 7) / 8 bytes */
-                buffer_size = (array->length + 7) / 8;
-            } else if (schema->format[0] == 'u' || schema->format[0] == 'U' ||
-                       schema->format[0] == 'z' || schema->format[0] == 'Z') {
-                /* Variable-width: buffer 1 is offsets, buffer 2 is data */
-                if (i == 1) {
-                    /* Offsets: (length + 1) * 4 bytes for 32-bit offsets */
-                    buffer_size = (array->length + 1) * 4;
-                } else if (i == 2) {
-                    /* Data buffer: read size from last offset */
-                    const int32_t* offsets = (const int32_t*)array->buffers[1];
-                    if (offsets) {
-                        buffer_size = offsets[array->length];
-                    }
-                }
-            } else if (schema->format[0] == 'b') {
-                /* Boolean: data is also a bitmap */
-                buffer_size = (array->length + 7) / 8;
-            } else if (element_size > 0) {
-                /* Fixed-width: length * element_size */
-                buffer_size = array->length * element_size;
-            }
-        }
+        IPCBufferSlice slice = array_buffer_slice(array, schema, i, range);
 
         /* Write buffer size */
-        rc = arrow_ipc_buffer_write_u64(buf, (uint64_t)buffer_size);
+        size_t size_pos = buf->size;
+        rc = arrow_ipc_buffer_write_u64(buf, (uint64_t)slice.size);
         if (rc != ARROW_IPC_OK) return rc;
 
-        /* Write buffer data */
-        if (buffer_size > 0 && array->buffers && array->buffers[i]) {
-            rc = arrow_ipc_buffer_write(buf, array->buffers[i], buffer_size);
+        if (slice.size > 0 && compressor) {
+            /* Shifted bitmaps and re-based offsets are built before compressing */
+            if (slice.kind == IPC_SLICE_COPY) {
+                rc = write_compressed_buffer(buf, compressor, size_pos, slice.data, slice.size);
+            } else {
+                uint8_t* staged = (uint8_t*)malloc(slice.size);
+                if (!staged) return ARROW_IPC_ERR_ALLOC;
+                buffer_slice_write(&slice, staged);
+                rc = write_compressed_buffer(buf, compressor, size_pos, staged, slice.size);
+                free(staged);
+            }
+            if (rc != ARROW_IPC_OK) return rc;
+        } else if (slice.size > 0) {
+            /* Pad, then write buffer data */
+            rc = arrow_ipc_buffer_write(buf, zeros, align_padding(buf->size));
             if (rc != ARROW_IPC_OK) return rc;
+            rc = arrow_ipc_buffer_reserve(buf, slice.size);
+            if (rc != ARROW_IPC_OK) return rc;
+            buffer_slice_write(&slice, buf->data + buf->size);
+            buf->size += slice.size;
         }
     }
 
@@ -471,7 +1076,8 @@ static int serialize_array_internal(
     for (int64_t i = 0; i < array->n_children; i++) {
         if (array->children && array->children[i] &&
             schema->children && schema->children[i]) {
-            rc = serialize_array_internal(buf, array->children[i], schema->children[i]);
+            rc = serialize_array_range(buf, array->children[i], schema->children[i],
+                                       child_range(array, schema, range, i), compressor);
             if (rc != ARROW_IPC_OK) return rc;
         }
     }
@@ -479,6 +1085,15 @@ static int serialize_array_internal(
     return ARROW_IPC_OK;
 }
 
+static int serialize_array_internal(
+    ArrowIPCBuffer* buf,
+    const struct ArrowArray* array,
+    const struct ArrowSchema* schema,
+    IPCCompressor* compressor
+) {
+    return serialize_array_range(buf, array, schema, array_full_range(array), compressor);
+}
+
 int arrow_ipc_serialize_array(
     const struct ArrowArray* array,
     const struct ArrowSchema* schema,
@@ -490,9 +1105,8 @@ int arrow_ipc_serialize_array(
     }
 
     ArrowIPCBuffer buf;
-    arrow_ipc_buffer_init(&buf);
-
-    int rc;
+    int rc = ipc_buffer_init_exact(&buf, 8 + array_serialized_size(array, schema, array_full_range(array), 8));
+    if (rc != ARROW_IPC_OK) return rc;
 
     /* Magic number */
     rc = arrow_ipc_buffer_write_u32(&buf, ARROW_IPC_MAGIC_ARRAY);
@@ -503,7 +1117,7 @@ int arrow_ipc_serialize_array(
     if (rc != ARROW_IPC_OK) goto error;
 
     /* Array content */
-    rc = serialize_array_internal(&buf, array, schema);
+    rc = serialize_array_internal(&buf, array, schema, NULL);
     if (rc != ARROW_IPC_OK) goto error;
 
     *out_data = buf.data;
@@ -519,46 +1133,135 @@ error:
  * Array Deserialization
  * ============================================================================ */
 
-/* Forward declaration */
+/* Forward declarations */
 static void release_deserialized_array(struct ArrowArray* array);
+static void release_zero_copy_array(struct ArrowArray* array);
+
+/*
+ * Input shared by the arrays of a zero-copy deserialization. Every array
+ * node holds one reference, so children moved out of their parent keep the
+ * input alive on their own.
+ */
+typedef struct {
+    int64_t refcount;
+    ArrowIPCOwnerRelease release;
+    void* owner;
+} IPCSharedInput;
+
+/* Private data of a zero-copy array node */
+typedef struct {
+    IPCSharedInput* input;
+    uint8_t* owned;  /* owned[i] != 0: buffer i was copied and must be freed */
+} IPCZeroCopyPrivate;
+
+static void shared_input_retain(IPCSharedInput* input) {
+    __atomic_fetch_add(&input->refcount, 1, __ATOMIC_RELAXED);
+}
+
+static void shared_input_release(IPCSharedInput* input) {
+    if (__atomic_sub_fetch(&input->refcount, 1, __ATOMIC_ACQ_REL) == 0) {
+        if (input->release) input->release(input->owner);
+        free(input);
+    }
+}
+
+/* Alignment a buffer needs to be read in place */
+static size_t buffer_alignment(const char* format, int64_t index, int64_t n_buffers) {
+    if (index == 0 || !format) return 1;  /* validity bitmap */
+    switch (format[0]) {
+        case 'v':  /* views and data sizes; data buffers are bytes */
+            return index == 1 || index == n_buffers - 1 ? 8 : 1;
+        case 'u': case 'z':
+            return index == 1 ? 4 : 1;
+        case 'U': case 'Z':
+            return index == 1 ? 8 : 1;
+        case '+':
+            /* list and map offsets */
+            return offsets_width(format) == 8 ? 8 : 4;
+        case 'b':
+        case 'w':  /* fixed-size binary: bytes */
+            return 1;
+        default: {
+            int element_size = arrow_ipc_get_element_size(format);
+            return element_size > 1 ? (size_t)element_size : 1;
+        }
+    }
+}
+
+/* How buffers are laid out in a given format version */
+typedef struct {
+    size_t alignment;                 /* Blob-relative; 1 for version 1 */
+    int compressed;                   /* Version 3 buffer layout */
+    ArrowIPCCompression compression;
+} IPCBufferLayout;
 
+static const IPCBufferLayout ipc_layout_unaligned = {1, 0, ARROW_IPC_COMPRESSION_NONE};
+static const IPCBufferLayout ipc_layout_aligned = {ARROW_IPC_ALIGNMENT, 0, ARROW_IPC_COMPRESSION_NONE};
+
+/*
+ * `position` is the blob offset of data[0]; with an alignment > 1 each
+ * non-empty buffer is preceded by padding up to that blob-relative boundary.
+ * Compressed buffers are decompressed into owned memory.
+ */
 static int deserialize_array_internal(
     const uint8_t* data,
     size_t size,
+    size_t position,
+    const IPCBufferLayout* layout,
     const struct ArrowSchema* schema,
+    IPCSharedInput* input,
     struct ArrowArray* out_array,
     size_t* bytes_consumed
 ) {
     size_t offset = 0;
+    IPCZeroCopyPrivate* priv = NULL;
 
     /* Initialize output */
     memset(out_array, 0, sizeof(struct ArrowArray));
 
     /* Read metadata */
-    if (offset + 8 > size) return ARROW_IPC_ERR_TRUNCATE;
+    if (offset + 40 > size) return ARROW_IPC_ERR_TRUNCATE;
     out_array->length = read_i64(data + offset);
-    offset += 8;
-
-    if (offset + 8 > size) return ARROW_IPC_ERR_TRUNCATE;
-    out_array->null_count = read_i64(data + offset);
-    offset += 8;
-
-    if (offset + 8 > size) return ARROW_IPC_ERR_TRUNCATE;
-    out_array->offset = read_i64(data + offset);
-    offset += 8;
+    out_array->null_count = read_i64(data + offset + 8);
+    out_array->offset = read_i64(data + offset + 16);
+    out_array->n_buffers = read_i64(data + offset + 24);
+    out_array->n_children = read_i64(data + offset + 32);
+    offset += 40;
+
+    if (out_array->n_buffers < 0 || out_array->n_children < 0 ||
+        (uint64_t)out_array->n_buffers > size || (uint64_t)out_array->n_children > size) {
+        out_array->n_buffers = 0;
+        out_array->n_children = 0;
+        return ARROW_IPC_ERR_FORMAT;
+    }
 
-    if (offset + 8 > size) return ARROW_IPC_ERR_TRUNCATE;
-    out_array->n_buffers = read_i64(data + offset);
-    offset += 8;
+    /* From here on the release callback cleans up partial results */
+    if (input) {
+        priv = (IPCZeroCopyPrivate*)calloc(1, sizeof(IPCZeroCopyPrivate));
+        if (!priv) return ARROW_IPC_ERR_ALLOC;
+        priv->owned = (uint8_t*)calloc(out_array->n_buffers > 0 ? out_array->n_buffers : 1, 1);
+        if (!priv->owned) {
+            free(priv);
+            return ARROW_IPC_ERR_ALLOC;
+        }
+        shared_input_retain(input);
+        priv->input = input;
+        out_array->private_data = priv;
+        out_array->release = release_zero_copy_array;
+    } else {
+        out_array->release = release_deserialized_array;
+    }
 
-    if (offset + 8 > size) return ARROW_IPC_ERR_TRUNCATE;
-    out_array->n_children = read_i64(data + offset);
-    offset += 8;
+    const char* format = schema ? schema->format : NULL;
+    int rc = ARROW_IPC_ERR_TRUNCATE;
 
-    /* Allocate and read buffers */
+    /* Read buffers: alias the input when zero-copy and aligned, else copy */
     if (out_array->n_buffers > 0) {
         out_array->buffers = (const void**)calloc(out_array->n_buffers, sizeof(void*));
-        if (!out_array->buffers) goto error;
+        if (!out_array->buffers) {
+            rc = ARROW_IPC_ERR_ALLOC;
+            goto error;
+        }
 
         for (int64_t i = 0; i < out_array->n_buffers; i++) {
             /* Read buffer size */
@@ -566,18 +1269,48 @@ static int deserialize_array_internal(
             uint64_t buffer_size = read_u64(data + offset);
             offset += 8;
 
-            /* Read buffer data */
-            if (buffer_size > 0) {
-                if (offset + buffer_size > size) goto error;
-
-                void* buffer = malloc(buffer_size);
-                if (!buffer) goto error;
-                memcpy(buffer, data + offset, buffer_size);
+            if (buffer_size == 0) continue;
+            int64_t uncompressed = -1;
+            if (layout->compressed) {
+                if (offset + 8 > size) goto error;
+                uncompressed = read_i64(data + offset);
+                offset += 8;
+                if (uncompressed < -1 || uncompressed == 0) {
+                    rc = ARROW_IPC_ERR_FORMAT;
+                    goto error;
+                }
+            }
+            if (layout->alignment > 1) {
+                size_t padding = (layout->alignment - ((position + offset) % layout->alignment)) % layout->alignment;
+                if (padding > size - offset) goto error;
+                offset += padding;
+            }
+            if (buffer_size > size - offset) goto error;
+
+            const uint8_t* src = data + offset;
+            if (uncompressed > 0) {
+                void* buffer = NULL;
+                int decompress_rc = arrow_ipc_decompress(layout->compression, src, buffer_size,
+                                                         (size_t)uncompressed, &buffer);
+                if (decompress_rc != ARROW_IPC_OK) {
+                    rc = decompress_rc;
+                    goto error;
+                }
                 out_array->buffers[i] = buffer;
-                offset += buffer_size;
+                if (priv) priv->owned[i] = 1;
+            } else if (priv && ((uintptr_t)src % buffer_alignment(format, i, out_array->n_buffers)) == 0) {
+                out_array->buffers[i] = src;
             } else {
-                out_array->buffers[i] = NULL;
+                void* buffer = arrow_mem_alloc(buffer_size);
+                if (!buffer) {
+                    rc = ARROW_IPC_ERR_ALLOC;
+                    goto error;
+                }
+                memcpy(buffer, src, buffer_size);
+                out_array->buffers[i] = buffer;
+                if (priv) priv->owned[i] = 1;
             }
+            offset += buffer_size;
         }
     }
 
@@ -585,11 +1318,17 @@ static int deserialize_array_internal(
     if (out_array->n_children > 0) {
         out_array->children = (struct ArrowArray**)calloc(
             out_array->n_children, sizeof(struct ArrowArray*));
-        if (!out_array->children) goto error;
+        if (!out_array->children) {
+            rc = ARROW_IPC_ERR_ALLOC;
+            goto error;
+        }
 
         for (int64_t i = 0; i < out_array->n_children; i++) {
             out_array->children[i] = (struct ArrowArray*)calloc(1, sizeof(struct ArrowArray));
-            if (!out_array->children[i]) goto error;
+            if (!out_array->children[i]) {
+                rc = ARROW_IPC_ERR_ALLOC;
+                goto error;
+            }
 
             const struct ArrowSchema* child_schema = NULL;
             if (schema && schema->children && i < schema->n_children) {
@@ -597,25 +1336,35 @@ static int deserialize_array_internal(
             }
 
             size_t child_bytes = 0;
-            int rc = deserialize_array_internal(
-                data + offset, size - offset,
-                child_schema, out_array->children[i], &child_bytes);
+            rc = deserialize_array_internal(
+                data + offset, size - offset, position + offset, layout,
+                child_schema, input, out_array->children[i], &child_bytes);
             if (rc != ARROW_IPC_OK) goto error;
             offset += child_bytes;
         }
     }
 
-    /* Set release callback */
-    out_array->release = release_deserialized_array;
-    out_array->dictionary = NULL;
-    out_array->private_data = NULL;
-
     if (bytes_consumed) *bytes_consumed = offset;
     return ARROW_IPC_OK;
 
 error:
-    release_deserialized_array(out_array);
-    return ARROW_IPC_ERR_ALLOC;
+    out_array->release(out_array);
+    return rc;
+}
+
+static void release_array_children(struct ArrowArray* array) {
+    if (array->children) {
+        for (int64_t i = 0; i < array->n_children; i++) {
+            if (array->children[i]) {
+                if (array->children[i]->release) {
+                    array->children[i]->release(array->children[i]);
+                }
+                free(array->children[i]);
+            }
+        }
+        free(array->children);
+        array->children = NULL;
+    }
 }
 
 static void release_deserialized_array(struct ArrowArray* array) {
@@ -625,41 +1374,50 @@ static void release_deserialized_array(struct ArrowArray* array) {
     if (array->buffers) {
         for (int64_t i = 0; i < array->n_buffers; i++) {
             if (array->buffers[i]) {
-                free((void*)array->buffers[i]);
+                arrow_mem_free((void*)array->buffers[i]);
             }
         }
         free((void*)array->buffers);
         array->buffers = NULL;
     }
 
-    /* Free children */
-    if (array->children) {
-        for (int64_t i = 0; i < array->n_children; i++) {
-            if (array->children[i]) {
-                if (array->children[i]->release) {
-                    array->children[i]->release(array->children[i]);
-                }
-                free(array->children[i]);
+    release_array_children(array);
+    array->release = NULL;
+}
+
+static void release_zero_copy_array(struct ArrowArray* array) {
+    if (!array || !array->release) return;
+
+    IPCZeroCopyPrivate* priv = (IPCZeroCopyPrivate*)array->private_data;
+
+    /* Free only the buffers that had to be copied */
+    if (array->buffers) {
+        for (int64_t i = 0; i < array->n_buffers; i++) {
+            if (priv->owned[i]) {
+                arrow_mem_free((void*)array->buffers[i]);
             }
         }
-        free(array->children);
-        array->children = NULL;
+        free((void*)array->buffers);
+        array->buffers = NULL;
     }
 
+    release_array_children(array);
+
+    shared_input_release(priv->input);
+    free(priv->owned);
+    free(priv);
+    array->private_data = NULL;
     array->release = NULL;
 }
 
-int arrow_ipc_deserialize_array(
+static int deserialize_array_message(
     const uint8_t* data,
     size_t size,
     const struct ArrowSchema* schema,
+    IPCSharedInput* input,
     struct ArrowArray* out_array,
     size_t* bytes_read
 ) {
-    if (!data || !out_array) {
-        return ARROW_IPC_ERR_NULL;
-    }
-
     size_t offset = 0;
 
     /* Magic number */
@@ -671,12 +1429,14 @@ int arrow_ipc_deserialize_array(
     /* Version */
     if (offset + 4 > size) return ARROW_IPC_ERR_TRUNCATE;
     uint32_t version = read_u32(data + offset);
-    if (version != ARROW_IPC_VERSION) return ARROW_IPC_ERR_VERSION;
+    if (version != ARROW_IPC_VERSION && version != ARROW_IPC_VERSION_UNALIGNED) return ARROW_IPC_ERR_VERSION;
     offset += 4;
 
     /* Deserialize array content */
+    const IPCBufferLayout* layout = version == ARROW_IPC_VERSION ? &ipc_layout_aligned : &ipc_layout_unaligned;
     size_t content_bytes = 0;
-    int rc = deserialize_array_internal(data + offset, size - offset, schema, out_array, &content_bytes);
+    int rc = deserialize_array_internal(data + offset, size - offset, offset, layout,
+                                        schema, input, out_array, &content_bytes);
     if (rc != ARROW_IPC_OK) return rc;
     offset += content_bytes;
 
@@ -684,10 +1444,55 @@ int arrow_ipc_deserialize_array(
     return ARROW_IPC_OK;
 }
 
+int arrow_ipc_deserialize_array(
+    const uint8_t* data,
+    size_t size,
+    const struct ArrowSchema* schema,
+    struct ArrowArray* out_array,
+    size_t* bytes_read
+) {
+    if (!data || !out_array) {
+        return ARROW_IPC_ERR_NULL;
+    }
+    return deserialize_array_message(data, size, schema, NULL, out_array, bytes_read);
+}
+
 /* ============================================================================
  * RecordBatch Serialization
  * ============================================================================ */
 
+size_t arrow_ipc_serialized_batch_size(
+    const struct ArrowSchema* schema,
+    const struct ArrowArray* array
+) {
+    if (!schema || !array) return 0;
+    size_t header = 8 + schema_serialized_size(schema);
+    return header + array_serialized_size(array, schema, array_full_range(array), header);
+}
+
+static int serialize_batch_to(
+    ArrowIPCBuffer* buf,
+    const struct ArrowSchema* schema,
+    const struct ArrowArray* array
+) {
+    int rc;
+
+    /* Magic number for batch */
+    rc = arrow_ipc_buffer_write_u32(buf, ARROW_IPC_MAGIC_BATCH);
+    if (rc != ARROW_IPC_OK) return rc;
+
+    /* Version */
+    rc = arrow_ipc_buffer_write_u32(buf, ARROW_IPC_VERSION);
+    if (rc != ARROW_IPC_OK) return rc;
+
+    /* Serialize schema (inline, without header) */
+    rc = serialize_schema_internal(buf, schema);
+    if (rc != ARROW_IPC_OK) return rc;
+
+    /* Serialize array (inline, without header) */
+    return serialize_array_internal(buf, array, schema, NULL);
+}
+
 int arrow_ipc_serialize_batch(
     const struct ArrowSchema* schema,
     const struct ArrowArray* array,
@@ -698,46 +1503,171 @@ int arrow_ipc_serialize_batch(
         return ARROW_IPC_ERR_NULL;
     }
 
+    /* Size pass first, so the output is allocated exactly once */
     ArrowIPCBuffer buf;
-    arrow_ipc_buffer_init(&buf);
+    int rc = ipc_buffer_init_exact(&buf, arrow_ipc_serialized_batch_size(schema, array));
+    if (rc != ARROW_IPC_OK) return rc;
 
-    int rc;
+    rc = serialize_batch_to(&buf, schema, array);
+    if (rc != ARROW_IPC_OK) goto error;
+
+    *out_data = buf.data;
+    *out_size = buf.size;
+    return ARROW_IPC_OK;
+
+error:
+    arrow_ipc_buffer_free(&buf);
+    return rc;
+}
+
+int arrow_ipc_serialize_batch_into(
+    const struct ArrowSchema* schema,
+    const struct ArrowArray* array,
+    uint8_t* dst,
+    size_t capacity,
+    size_t* out_size
+) {
+    if (!schema || !array || !dst || !out_size) {
+        return ARROW_IPC_ERR_NULL;
+    }
+    if (arrow_ipc_serialized_batch_size(schema, array) > capacity) {
+        return ARROW_IPC_ERR_TRUNCATE;
+    }
+
+    /* A non-owning view over dst; the size check keeps writes in bounds */
+    ArrowIPCBuffer buf;
+    buf.data = dst;
+    buf.size = 0;
+    buf.capacity = capacity;
+
+    int rc = serialize_batch_to(&buf, schema, array);
+    if (rc != ARROW_IPC_OK) return rc;
+
+    *out_size = buf.size;
+    return ARROW_IPC_OK;
+}
+
+int arrow_ipc_serialize_batch_with_options(
+    const struct ArrowSchema* schema,
+    const struct ArrowArray* array,
+    const ArrowIPCWriteOptions* options,
+    uint8_t** out_data,
+    size_t* out_size
+) {
+    if (!schema || !array || !out_data || !out_size) {
+        return ARROW_IPC_ERR_NULL;
+    }
+    if (!options || options->compression == ARROW_IPC_COMPRESSION_NONE) {
+        return arrow_ipc_serialize_batch(schema, array, out_data, out_size);
+    }
+
+    IPCCompressor compressor;
+    int rc = arrow_ipc_codec_init(&compressor.codec, options->compression, options->level);
+    if (rc != ARROW_IPC_OK) return rc;
+    compressor.min_compress_size = options->min_compress_size;
+
+    /* The compressed size is unknown up front: grow, then shrink to fit */
+    ArrowIPCBuffer buf;
+    arrow_ipc_buffer_init(&buf);
 
-    /* Magic number for batch */
     rc = arrow_ipc_buffer_write_u32(&buf, ARROW_IPC_MAGIC_BATCH);
     if (rc != ARROW_IPC_OK) goto error;
-
-    /* Version */
-    rc = arrow_ipc_buffer_write_u32(&buf, ARROW_IPC_VERSION);
+    rc = arrow_ipc_buffer_write_u32(&buf, ARROW_IPC_VERSION_COMPRESSED);
+    if (rc != ARROW_IPC_OK) goto error;
+    rc = arrow_ipc_buffer_write_u32(&buf, (uint32_t)options->compression);
     if (rc != ARROW_IPC_OK) goto error;
-
-    /* Serialize schema (inline, without header) */
     rc = serialize_schema_internal(&buf, schema);
     if (rc != ARROW_IPC_OK) goto error;
-
-    /* Serialize array (inline, without header) */
-    rc = serialize_array_internal(&buf, array, schema);
+    rc = serialize_array_internal(&buf, array, schema, &compressor);
     if (rc != ARROW_IPC_OK) goto error;
 
+    arrow_ipc_codec_free(&compressor.codec);
+    buffer_shrink_to_fit(&buf);
     *out_data = buf.data;
     *out_size = buf.size;
     return ARROW_IPC_OK;
 
 error:
+    arrow_ipc_codec_free(&compressor.codec);
     arrow_ipc_buffer_free(&buf);
     return rc;
 }
 
-int arrow_ipc_deserialize_batch(
+/* Magic, version, codec and schema fingerprint */
+#define IPC_BATCH_REF_HEADER_SIZE 20
+
+int arrow_ipc_serialize_batch_ref(
+    const struct ArrowSchema* schema,
+    const struct ArrowArray* array,
+    const ArrowIPCWriteOptions* options,
+    uint8_t** out_data,
+    size_t* out_size
+) {
+    if (!schema || !array || !out_data || !out_size) {
+        return ARROW_IPC_ERR_NULL;
+    }
+
+    ArrowIPCCompression compression = options ? options->compression : ARROW_IPC_COMPRESSION_NONE;
+    IPCCompressor compressor;
+    IPCCompressor* active = NULL;
+    ArrowIPCBuffer buf;
+    int rc;
+    if (compression == ARROW_IPC_COMPRESSION_NONE) {
+        size_t array_size = array_serialized_size(array, schema, array_full_range(array),
+                                                  IPC_BATCH_REF_HEADER_SIZE);
+        rc = ipc_buffer_init_exact(&buf, IPC_BATCH_REF_HEADER_SIZE + array_size);
+        if (rc != ARROW_IPC_OK) return rc;
+    } else {
+        rc = arrow_ipc_codec_init(&compressor.codec, compression, options->level);
+        if (rc != ARROW_IPC_OK) return rc;
+        compressor.min_compress_size = options->min_compress_size;
+        active = &compressor;
+        arrow_ipc_buffer_init(&buf);
+    }
+
+    rc = arrow_ipc_buffer_write_u32(&buf, ARROW_IPC_MAGIC_BATCH);
+    if (rc == ARROW_IPC_OK) rc = arrow_ipc_buffer_write_u32(&buf, ARROW_IPC_VERSION_SCHEMA_REF);
+    if (rc == ARROW_IPC_OK) rc = arrow_ipc_buffer_write_u32(&buf, (uint32_t)compression);
+    if (rc == ARROW_IPC_OK) rc = arrow_ipc_buffer_write_u64(&buf, arrow_ipc_schema_fingerprint(schema));
+    if (rc == ARROW_IPC_OK) rc = serialize_array_internal(&buf, array, schema, active);
+
+    if (active) arrow_ipc_codec_free(&compressor.codec);
+    if (rc != ARROW_IPC_OK) {
+        arrow_ipc_buffer_free(&buf);
+        return rc;
+    }
+    if (active) buffer_shrink_to_fit(&buf);
+    *out_data = buf.data;
+    *out_size = buf.size;
+    return ARROW_IPC_OK;
+}
+
+/*
+ * Read the u32 codec of a version 3 or 4 blob into `layout`. Codec 0 (only
+ * written by version 4) selects the aligned uncompressed layout.
+ */
+static int read_codec_layout(const uint8_t* data, size_t size, size_t* offset, IPCBufferLayout* layout) {
+    if (*offset + 4 > size) return ARROW_IPC_ERR_TRUNCATE;
+    uint32_t compression = read_u32(data + *offset);
+    *offset += 4;
+
+    *layout = ipc_layout_aligned;
+    if (compression == ARROW_IPC_COMPRESSION_NONE) return ARROW_IPC_OK;
+    if (compression != ARROW_IPC_COMPRESSION_LZ4_FRAME && compression != ARROW_IPC_COMPRESSION_ZSTD) {
+        return ARROW_IPC_ERR_UNSUPPORTED;
+    }
+    layout->compressed = 1;
+    layout->compression = (ArrowIPCCompression)compression;
+    return ARROW_IPC_OK;
+}
+
+static int deserialize_batch_message(
     const uint8_t* data,
     size_t size,
+    IPCSharedInput* input,
     struct ArrowSchema* out_schema,
     struct ArrowArray* out_array
 ) {
-    if (!data || !out_schema || !out_array) {
-        return ARROW_IPC_ERR_NULL;
-    }
-
     size_t offset = 0;
 
     /* Magic number */
@@ -749,9 +1679,20 @@ int arrow_ipc_deserialize_batch(
     /* Version */
     if (offset + 4 > size) return ARROW_IPC_ERR_TRUNCATE;
     uint32_t version = read_u32(data + offset);
-    if (version != ARROW_IPC_VERSION) return ARROW_IPC_ERR_VERSION;
+    if (version == ARROW_IPC_VERSION_SCHEMA_REF) return ARROW_IPC_ERR_SCHEMA;
+    if (version != ARROW_IPC_VERSION && version != ARROW_IPC_VERSION_UNALIGNED &&
+        version != ARROW_IPC_VERSION_COMPRESSED) {
+        return ARROW_IPC_ERR_VERSION;
+    }
     offset += 4;
 
+    IPCBufferLayout layout = version == ARROW_IPC_VERSION ? ipc_layout_aligned : ipc_layout_unaligned;
+    if (version == ARROW_IPC_VERSION_COMPRESSED) {
+        int rc = read_codec_layout(data, size, &offset, &layout);
+        if (rc != ARROW_IPC_OK) return rc;
+        if (!layout.compressed) return ARROW_IPC_ERR_UNSUPPORTED;
+    }
+
     /* Deserialize schema */
     size_t schema_bytes = 0;
     int rc = deserialize_schema_internal(data + offset, size - offset, out_schema, &schema_bytes);
@@ -760,7 +1701,8 @@ int arrow_ipc_deserialize_batch(
 
     /* Deserialize array */
     size_t array_bytes = 0;
-    rc = deserialize_array_internal(data + offset, size - offset, out_schema, out_array, &array_bytes);
+    rc = deserialize_array_internal(data + offset, size - offset, offset, &layout,
+                                    out_schema, input, out_array, &array_bytes);
     if (rc != ARROW_IPC_OK) {
         release_deserialized_schema(out_schema);
         return rc;
@@ -768,3 +1710,160 @@ int arrow_ipc_deserialize_batch(
 
     return ARROW_IPC_OK;
 }
+
+int arrow_ipc_deserialize_batch(
+    const uint8_t* data,
+    size_t size,
+    struct ArrowSchema* out_schema,
+    struct ArrowArray* out_array
+) {
+    if (!data || !out_schema || !out_array) {
+        return ARROW_IPC_ERR_NULL;
+    }
+    return deserialize_batch_message(data, size, NULL, out_schema, out_array);
+}
+
+/* Header of a version 4 blob, up to the array */
+static int read_batch_ref_header(
+    const uint8_t* data,
+    size_t size,
+    size_t* offset,
+    IPCBufferLayout* layout,
+    uint64_t* fingerprint
+) {
+    if (size < 8) return ARROW_IPC_ERR_TRUNCATE;
+    if (read_u32(data) != ARROW_IPC_MAGIC_BATCH) return ARROW_IPC_ERR_FORMAT;
+    if (read_u32(data + 4) != ARROW_IPC_VERSION_SCHEMA_REF) return ARROW_IPC_ERR_VERSION;
+    *offset = 8;
+
+    int rc = read_codec_layout(data, size, offset, layout);
+    if (rc != ARROW_IPC_OK) return rc;
+    if (*offset + 8 > size) return ARROW_IPC_ERR_TRUNCATE;
+    *fingerprint = read_u64(data + *offset);
+    *offset += 8;
+    return ARROW_IPC_OK;
+}
+
+static int deserialize_batch_ref_message(
+    const uint8_t* data,
+    size_t size,
+    const struct ArrowSchema* schema,
+    IPCSharedInput* input,
+    struct ArrowArray* out_array
+) {
+    size_t offset;
+    IPCBufferLayout layout;
+    uint64_t fingerprint;
+    int rc = read_batch_ref_header(data, size, &offset, &layout, &fingerprint);
+    if (rc != ARROW_IPC_OK) return rc;
+    if (fingerprint != arrow_ipc_schema_fingerprint(schema)) return ARROW_IPC_ERR_SCHEMA;
+
+    size_t array_bytes = 0;
+    return deserialize_array_internal(data + offset, size - offset, offset, &layout,
+                                      schema, input, out_array, &array_bytes);
+}
+
+int arrow_ipc_batch_ref_fingerprint(
+    const uint8_t* data,
+    size_t size,
+    uint64_t* out_fingerprint
+) {
+    if (!data || !out_fingerprint) {
+        return ARROW_IPC_ERR_NULL;
+    }
+    size_t offset;
+    IPCBufferLayout layout;
+    return read_batch_ref_header(data, size, &offset, &layout, out_fingerprint);
+}
+
+int arrow_ipc_deserialize_batch_ref(
+    const uint8_t* data,
+    size_t size,
+    const struct ArrowSchema* schema,
+    struct ArrowArray* out_array
+) {
+    if (!data || !schema || !out_array) {
+        return ARROW_IPC_ERR_NULL;
+    }
+    return deserialize_batch_ref_message(data, size, schema, NULL, out_array);
+}
+
+/* ============================================================================
+ * Zero-Copy Deserialization
+ * ============================================================================ */
+
+static IPCSharedInput* shared_input_create(ArrowIPCOwnerRelease release, void* owner) {
+    IPCSharedInput* input = (IPCSharedInput*)malloc(sizeof(IPCSharedInput));
+    if (!input) return NULL;
+    input->refcount = 1;  /* Held by the deserializer until it returns */
+    input->release = release;
+    input->owner = owner;
+    return input;
+}
+
+/* Drop the deserializer's reference. On failure the caller keeps the owner. */
+static void shared_input_finish(IPCSharedInput* input, int rc) {
+    if (rc != ARROW_IPC_OK) input->release = NULL;
+    shared_input_release(input);
+}
+
+int arrow_ipc_deserialize_array_zero_copy(
+    const uint8_t* data,
+    size_t size,
+    const struct ArrowSchema* schema,
+    ArrowIPCOwnerRelease owner_release,
+    void* owner,
+    struct ArrowArray* out_array,
+    size_t* bytes_read
+) {
+    if (!data || !out_array) {
+        return ARROW_IPC_ERR_NULL;
+    }
+
+    IPCSharedInput* input = shared_input_create(owner_release, owner);
+    if (!input) return ARROW_IPC_ERR_ALLOC;
+
+    int rc = deserialize_array_message(data, size, schema, input, out_array, bytes_read);
+    shared_input_finish(input, rc);
+    return rc;
+}
+
+int arrow_ipc_deserialize_batch_zero_copy(
+    const uint8_t* data,
+    size_t size,
+    ArrowIPCOwnerRelease owner_release,
+    void* owner,
+    struct ArrowSchema* out_schema,
+    struct ArrowArray* out_array
+) {
+    if (!data || !out_schema || !out_array) {
+        return ARROW_IPC_ERR_NULL;
+    }
+
+    IPCSharedInput* input = shared_input_create(owner_release, owner);
+    if (!input) return ARROW_IPC_ERR_ALLOC;
+
+    int rc = deserialize_batch_message(data, size, input, out_schema, out_array);
+    shared_input_finish(input, rc);
+    return rc;
+}
+
+int arrow_ipc_deserialize_batch_ref_zero_copy(
+    const uint8_t* data,
+    size_t size,
+    const struct ArrowSchema* schema,
+    ArrowIPCOwnerRelease owner_release,
+    void* owner,
+    struct ArrowArray* out_array
+) {
+    if (!data || !schema || !out_array) {
+        return ARROW_IPC_ERR_NULL;
+    }
+
+    IPCSharedInput* input = shared_input_create(owner_release, owner);
+    if (!input) return ARROW_IPC_ERR_ALLOC;
+
+    int rc = deserialize_batch_ref_message(data, size, schema, input, out_array);
+    shared_input_finish(input, rc);
+    return rc;
+}
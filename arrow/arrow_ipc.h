@@ -5,12 +5,34 @@
  * for storage (e.g., in Redis) and later retrieval.
  *
  * This is a simplified format optimized for same-application round-trips,
- * not full Arrow IPC interoperability with other implementations.
+ * not full Arrow IPC interoperability with other implementations. The
+ * standard Arrow IPC stream and file formats live in arrow_ipc_stream.h.
  *
  * Format overview:
  * - RecordBatch: magic + version + schema + array
  * - Schema: format string + name + flags + children (recursive)
  * - Array: length + null_count + offset + buffers + children (recursive)
+ *
+ * Since version 2 every non-empty buffer is zero-padded to start on a
+ * 64-byte boundary relative to the start of the blob. Version 1 blobs
+ * (buffers packed after their size prefix) are still readable.
+ *
+ * Version 3 batches carry a u32 codec after the version and compress each
+ * buffer on its own, as Arrow's BodyCompression does: a non-empty buffer
+ * is stored as size + int64 uncompressed length + padding + bytes, where
+ * an uncompressed length of -1 marks a buffer stored as is.
+ *
+ * Sliced arrays (non-zero offset, including offsets inherited by struct and
+ * list children) are written compactly: only the referenced range, with
+ * validity bitmaps shifted to bit 0, string/list offsets re-based to 0 and
+ * the stored offset set to 0. String and binary views ("vu", "vz") keep
+ * their variadic buffers: validity, the 16-byte views of the range, every
+ * data buffer in full, and the int64 data buffer sizes.
+ *
+ * Version 4 batches ("schema references") replace the schema with a u32
+ * codec (0: uncompressed) and the u64 fingerprint of the schema, which the
+ * application stores once, e.g. as an arrow_ipc_serialize_schema blob
+ * under its fingerprint. They can only be read back with that schema.
  */
 
 #ifndef ARROW_IPC_H
@@ -24,7 +46,13 @@
 #define ARROW_IPC_MAGIC_SCHEMA  0x53525241  /* "ARRS" */
 #define ARROW_IPC_MAGIC_ARRAY   0x41525241  /* "ARRA" */
 #define ARROW_IPC_MAGIC_BATCH   0x42525241  /* "ARRB" */
-#define ARROW_IPC_VERSION       1
+#define ARROW_IPC_VERSION       2
+#define ARROW_IPC_VERSION_UNALIGNED 1  /* Packed buffers, read-only support */
+#define ARROW_IPC_VERSION_COMPRESSED 3  /* Per-buffer compressed batches */
+#define ARROW_IPC_VERSION_SCHEMA_REF 4  /* Batches referencing their schema by fingerprint */
+
+/* Blob-relative alignment of every buffer (version 2) */
+#define ARROW_IPC_ALIGNMENT     64
 
 /* Result codes */
 #define ARROW_IPC_OK            0
@@ -33,6 +61,77 @@
 #define ARROW_IPC_ERR_VERSION  -3
 #define ARROW_IPC_ERR_TRUNCATE -4
 #define ARROW_IPC_ERR_NULL     -5
+#define ARROW_IPC_ERR_UNSUPPORTED -6  /* Valid data using an unimplemented feature */
+#define ARROW_IPC_ERR_IO       -7
+#define ARROW_IPC_ERR_SCHEMA   -8  /* Schema missing or fingerprint mismatch */
+
+/* Per-buffer compression codecs */
+typedef enum {
+    ARROW_IPC_COMPRESSION_NONE = 0,
+    ARROW_IPC_COMPRESSION_LZ4_FRAME = 1,  /* Fast */
+    ARROW_IPC_COMPRESSION_ZSTD = 2        /* Better ratio */
+} ArrowIPCCompression;
+
+/* Buffers smaller than this are not worth compressing by default */
+#define ARROW_IPC_COMPRESSION_MIN_SIZE 1024
+
+/* Options for the compressing serializers */
+typedef struct {
+    ArrowIPCCompression compression;
+    int level;                  /* 0: codec default (ZSTD 1, LZ4 fast) */
+    size_t min_compress_size;   /* Smaller buffers are stored uncompressed */
+    int emit_dictionary_deltas; /* Stream writer: send grown dictionaries as deltas */
+} ArrowIPCWriteOptions;
+
+/* Initialize options: no compression, ARROW_IPC_COMPRESSION_MIN_SIZE, no deltas */
+void arrow_ipc_write_options_init(ArrowIPCWriteOptions* options);
+
+/*
+ * Compressor state, reused across buffers. The codec context is created
+ * on first use.
+ */
+typedef struct {
+    ArrowIPCCompression compression;
+    int level;
+    void* state;
+} ArrowIPCCodec;
+
+/* @return ARROW_IPC_OK, or ARROW_IPC_ERR_UNSUPPORTED for an unknown codec */
+int arrow_ipc_codec_init(ArrowIPCCodec* codec, ArrowIPCCompression compression, int level);
+void arrow_ipc_codec_free(ArrowIPCCodec* codec);
+
+/* Worst-case compressed size of `size` bytes */
+size_t arrow_ipc_codec_bound(const ArrowIPCCodec* codec, size_t size);
+
+/*
+ * Compress into dst (capacity from arrow_ipc_codec_bound)
+ *
+ * @return ARROW_IPC_OK on success, error code otherwise
+ */
+int arrow_ipc_codec_compress(
+    ArrowIPCCodec* codec,
+    const void* src,
+    size_t size,
+    void* dst,
+    size_t capacity,
+    size_t* out_size
+);
+
+/*
+ * Decompress into a new pool buffer of exactly `dst_size` bytes (caller
+ * frees it with arrow_mem_free). Sizes the input cannot expand to are rejected before
+ * allocating, so corrupt length prefixes do not trigger huge allocations.
+ *
+ * @return ARROW_IPC_OK, or ARROW_IPC_ERR_FORMAT if the data is corrupt or
+ *         does not expand to dst_size bytes
+ */
+int arrow_ipc_decompress(
+    ArrowIPCCompression compression,
+    const void* src,
+    size_t size,
+    size_t dst_size,
+    void** out
+);
 
 /* Buffer for building serialized data */
 typedef struct {
@@ -127,7 +226,7 @@ int arrow_ipc_deserialize_array(
  *
  * @param schema The schema
  * @param array The array
- * @param out_data Output pointer to allocated buffer (caller must free)
+ * @param out_data Output pointer to 64-byte aligned buffer (caller must free)
  * @param out_size Output size of the serialized data
  * @return ARROW_IPC_OK on success, error code otherwise
  */
@@ -139,7 +238,49 @@ int arrow_ipc_serialize_batch(
 );
 
 /*
- * Deserialize a RecordBatch from binary format
+ * Exact number of bytes arrow_ipc_serialize_batch produces, computed
+ * without serializing
+ */
+size_t arrow_ipc_serialized_batch_size(
+    const struct ArrowSchema* schema,
+    const struct ArrowArray* array
+);
+
+/*
+ * Serialize a RecordBatch into caller-provided memory (e.g. a Lean
+ * ByteArray sized with arrow_ipc_serialized_batch_size)
+ *
+ * @return ARROW_IPC_OK, or ARROW_IPC_ERR_TRUNCATE if capacity is too small
+ */
+int arrow_ipc_serialize_batch_into(
+    const struct ArrowSchema* schema,
+    const struct ArrowArray* array,
+    uint8_t* dst,
+    size_t capacity,
+    size_t* out_size
+);
+
+/*
+ * Serialize a RecordBatch, compressing each buffer with options->compression.
+ * Buffers below options->min_compress_size, or that do not shrink, are
+ * stored uncompressed. Without compression the output is identical to
+ * arrow_ipc_serialize_batch.
+ *
+ * @param options Compression options (NULL: uncompressed)
+ * @return ARROW_IPC_OK on success, error code otherwise
+ */
+int arrow_ipc_serialize_batch_with_options(
+    const struct ArrowSchema* schema,
+    const struct ArrowArray* array,
+    const ArrowIPCWriteOptions* options,
+    uint8_t** out_data,
+    size_t* out_size
+);
+
+/*
+ * Deserialize a RecordBatch from binary format (any version, compressed
+ * batches included). Schema references (version 4) fail with
+ * ARROW_IPC_ERR_SCHEMA; use arrow_ipc_deserialize_batch_ref.
  *
  * @param data Input buffer
  * @param size Size of input buffer
@@ -154,6 +295,115 @@ int arrow_ipc_deserialize_batch(
     struct ArrowArray* out_array
 );
 
+/* ============================================================================
+ * Schema References
+ * ============================================================================ */
+
+/*
+ * 64-bit fingerprint of a schema: a hash of everything the schema
+ * serialization writes (formats, names, flags, children). Equal schemas
+ * always have equal fingerprints.
+ */
+uint64_t arrow_ipc_schema_fingerprint(const struct ArrowSchema* schema);
+
+/*
+ * Serialize a RecordBatch without its schema (version 4). The blob only
+ * carries the schema fingerprint, so a small batch is mostly data. Buffers
+ * are 64-byte aligned as in arrow_ipc_serialize_batch, and compressed per
+ * buffer when options->compression is set.
+ *
+ * @param options Compression options (NULL: uncompressed)
+ * @return ARROW_IPC_OK on success, error code otherwise
+ */
+int arrow_ipc_serialize_batch_ref(
+    const struct ArrowSchema* schema,
+    const struct ArrowArray* array,
+    const ArrowIPCWriteOptions* options,
+    uint8_t** out_data,
+    size_t* out_size
+);
+
+/*
+ * Read the schema fingerprint of a version 4 blob, without decoding it
+ *
+ * @return ARROW_IPC_OK on success; ARROW_IPC_ERR_VERSION if the blob is a
+ *         batch carrying its own schema
+ */
+int arrow_ipc_batch_ref_fingerprint(
+    const uint8_t* data,
+    size_t size,
+    uint64_t* out_fingerprint
+);
+
+/*
+ * Deserialize a version 4 blob against `schema` (not retained). Only the
+ * array is produced; the caller keeps using its own schema.
+ *
+ * @return ARROW_IPC_OK on success; ARROW_IPC_ERR_SCHEMA if the fingerprint
+ *         does not match `schema`, other error codes otherwise
+ */
+int arrow_ipc_deserialize_batch_ref(
+    const uint8_t* data,
+    size_t size,
+    const struct ArrowSchema* schema,
+    struct ArrowArray* out_array
+);
+
+/*
+ * Release hook for memory aliased by zero-copy arrays (a Lean ByteArray,
+ * an mmap region, ...). Called once, after the last array referencing the
+ * input has been released.
+ */
+typedef void (*ArrowIPCOwnerRelease)(void* owner);
+
+/*
+ * Deserialize an ArrowArray whose buffers point into `data` instead of
+ * being copied. Buffers that are not aligned for their element type are
+ * still copied. Every array node (children included) keeps the input alive;
+ * owner_release(owner) runs when the last one is released. On failure the
+ * owner is not released.
+ *
+ * @param owner_release Release hook for `data` (can be NULL)
+ * @param owner Argument passed to owner_release
+ * @return ARROW_IPC_OK on success, error code otherwise
+ */
+int arrow_ipc_deserialize_array_zero_copy(
+    const uint8_t* data,
+    size_t size,
+    const struct ArrowSchema* schema,
+    ArrowIPCOwnerRelease owner_release,
+    void* owner,
+    struct ArrowArray* out_array,
+    size_t* bytes_read
+);
+
+/*
+ * Zero-copy variant of arrow_ipc_deserialize_batch. The schema is copied
+ * (it is small); array buffers alias `data` as in
+ * arrow_ipc_deserialize_array_zero_copy.
+ */
+int arrow_ipc_deserialize_batch_zero_copy(
+    const uint8_t* data,
+    size_t size,
+    ArrowIPCOwnerRelease owner_release,
+    void* owner,
+    struct ArrowSchema* out_schema,
+    struct ArrowArray* out_array
+);
+
+/*
+ * Zero-copy variant of arrow_ipc_deserialize_batch_ref; array buffers
+ * alias `data` as in arrow_ipc_deserialize_array_zero_copy.
+ */
+int arrow_ipc_deserialize_batch_ref_zero_copy(
+    const uint8_t* data,
+    size_t size,
+    const struct ArrowSchema* schema,
+    ArrowIPCOwnerRelease owner_release,
+    void* owner,
+    struct ArrowArray* out_array
+);
+
 /*
  * Get the number of buffers for a given Arrow format string
  *
@@ -0,0 +1,337 @@
+/*
+ * Arrow IPC Batch File Implementation
+ */
+
+/* mmap, fileno */
+#define _POSIX_C_SOURCE 200112L
+
+#include "arrow_ipc_batch_file.h"
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const uint8_t batch_file_zeros[ARROW_IPC_ALIGNMENT] = {0};
+
+static void put_u64(uint8_t* dst, uint64_t value) {
+    for (int i = 0; i < 8; i++) {
+        dst[i] = (uint8_t)(value >> (i * 8));
+    }
+}
+
+static uint64_t get_u64(const uint8_t* src) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++) {
+        value |= (uint64_t)src[i] << (i * 8);
+    }
+    return value;
+}
+
+/* ============================================================================
+ * Writer
+ * ============================================================================ */
+
+struct ArrowIPCBatchFileWriter {
+    FILE* file;
+    uint64_t position;          /* Bytes written so far */
+    ArrowIPCWriteOptions options;
+    ArrowIPCBuffer index;       /* Encoded index entries */
+    int64_t num_batches;
+    uint8_t* scratch;           /* Reused serialization buffer (uncompressed) */
+    size_t scratch_capacity;
+    int error;                  /* First write error; the file is unusable after it */
+};
+
+static int writer_write(ArrowIPCBatchFileWriter* writer, const void* data, size_t len) {
+    if (len > 0 && fwrite(data, 1, len, writer->file) != len) {
+        writer->error = ARROW_IPC_ERR_IO;
+        return ARROW_IPC_ERR_IO;
+    }
+    writer->position += len;
+    return ARROW_IPC_OK;
+}
+
+/* Pad the file to the next 64-byte boundary */
+static int writer_align(ArrowIPCBatchFileWriter* writer) {
+    size_t padding = (size_t)((ARROW_IPC_ALIGNMENT - writer->position % ARROW_IPC_ALIGNMENT) % ARROW_IPC_ALIGNMENT);
+    return writer_write(writer, batch_file_zeros, padding);
+}
+
+int arrow_ipc_batch_file_writer_open(
+    const char* path,
+    const ArrowIPCWriteOptions* options,
+    ArrowIPCBatchFileWriter** out_writer
+) {
+    if (!path || !out_writer) return ARROW_IPC_ERR_NULL;
+
+    ArrowIPCBatchFileWriter* writer = (ArrowIPCBatchFileWriter*)calloc(1, sizeof(ArrowIPCBatchFileWriter));
+    if (!writer) return ARROW_IPC_ERR_ALLOC;
+
+    if (options) {
+        writer->options = *options;
+    } else {
+        arrow_ipc_write_options_init(&writer->options);
+    }
+    arrow_ipc_buffer_init(&writer->index);
+
+    writer->file = fopen(path, "wb");
+    if (!writer->file) {
+        free(writer);
+        return ARROW_IPC_ERR_IO;
+    }
+
+    uint8_t header[ARROW_IPC_BATCH_FILE_HEADER_SIZE] = {0};
+    memcpy(header, ARROW_IPC_BATCH_FILE_MAGIC, ARROW_IPC_BATCH_FILE_MAGIC_SIZE);
+    header[8] = ARROW_IPC_BATCH_FILE_VERSION;
+
+    int rc = writer_write(writer, header, sizeof(header));
+    if (rc != ARROW_IPC_OK) {
+        fclose(writer->file);
+        free(writer);
+        return rc;
+    }
+
+    *out_writer = writer;
+    return ARROW_IPC_OK;
+}
+
+/* Serialize into the reusable scratch buffer, growing it as needed */
+static int writer_serialize_uncompressed(
+    ArrowIPCBatchFileWriter* writer,
+    const struct ArrowSchema* schema,
+    const struct ArrowArray* array,
+    size_t* out_size
+) {
+    size_t needed = arrow_ipc_serialized_batch_size(schema, array);
+    if (needed > writer->scratch_capacity) {
+        size_t capacity = writer->scratch_capacity > 0 ? writer->scratch_capacity : 4096;
+        while (capacity < needed) capacity *= 2;
+        uint8_t* scratch = (uint8_t*)realloc(writer->scratch, capacity);
+        if (!scratch) return ARROW_IPC_ERR_ALLOC;
+        writer->scratch = scratch;
+        writer->scratch_capacity = capacity;
+    }
+    return arrow_ipc_serialize_batch_into(schema, array, writer->scratch, writer->scratch_capacity, out_size);
+}
+
+int arrow_ipc_batch_file_writer_append(
+    ArrowIPCBatchFileWriter* writer,
+    const struct ArrowSchema* schema,
+    const struct ArrowArray* array
+) {
+    if (!writer || !schema || !array) return ARROW_IPC_ERR_NULL;
+    if (writer->error != ARROW_IPC_OK) return writer->error;
+
+    uint8_t* data = NULL;
+    uint8_t* compressed = NULL;
+    size_t size = 0;
+    int rc;
+
+    if (writer->options.compression == ARROW_IPC_COMPRESSION_NONE) {
+        rc = writer_serialize_uncompressed(writer, schema, array, &size);
+        data = writer->scratch;
+    } else {
+        rc = arrow_ipc_serialize_batch_with_options(schema, array, &writer->options, &compressed, &size);
+        data = compressed;
+    }
+    if (rc != ARROW_IPC_OK) goto done;
+
+    rc = writer_align(writer);
+    if (rc != ARROW_IPC_OK) goto done;
+
+    uint64_t offset = writer->position;
+    rc = writer_write(writer, data, size);
+    if (rc != ARROW_IPC_OK) goto done;
+
+    uint8_t entry[ARROW_IPC_BATCH_FILE_ENTRY_SIZE];
+    put_u64(entry, offset);
+    put_u64(entry + 8, (uint64_t)size);
+    put_u64(entry + 16, (uint64_t)array->length);
+    rc = arrow_ipc_buffer_write(&writer->index, entry, sizeof(entry));
+    if (rc != ARROW_IPC_OK) goto done;
+
+    writer->num_batches++;
+
+done:
+    free(compressed);
+    return rc;
+}
+
+int64_t arrow_ipc_batch_file_writer_num_batches(const ArrowIPCBatchFileWriter* writer) {
+    return writer ? writer->num_batches : 0;
+}
+
+int arrow_ipc_batch_file_writer_close(ArrowIPCBatchFileWriter* writer) {
+    if (!writer) return ARROW_IPC_ERR_NULL;
+
+    int rc = writer->error;
+    if (rc == ARROW_IPC_OK) rc = writer_align(writer);
+
+    uint64_t index_offset = writer->position;
+    if (rc == ARROW_IPC_OK) rc = writer_write(writer, writer->index.data, writer->index.size);
+
+    if (rc == ARROW_IPC_OK) {
+        uint8_t trailer[ARROW_IPC_BATCH_FILE_TRAILER_SIZE];
+        put_u64(trailer, index_offset);
+        put_u64(trailer + 8, (uint64_t)writer->num_batches);
+        memcpy(trailer + 16, ARROW_IPC_BATCH_FILE_MAGIC, ARROW_IPC_BATCH_FILE_MAGIC_SIZE);
+        rc = writer_write(writer, trailer, sizeof(trailer));
+    }
+
+    if (fclose(writer->file) != 0 && rc == ARROW_IPC_OK) rc = ARROW_IPC_ERR_IO;
+
+    arrow_ipc_buffer_free(&writer->index);
+    free(writer->scratch);
+    free(writer);
+    return rc;
+}
+
+/* ============================================================================
+ * Reader
+ * ============================================================================ */
+
+/* A file mapping shared by the reader and every batch read from it */
+typedef struct {
+    int refcount;
+    uint8_t* base;
+    size_t size;
+} BatchFileMapping;
+
+struct ArrowIPCBatchFileReader {
+    BatchFileMapping* mapping;
+    const uint8_t* index;
+    uint64_t index_offset;
+    int64_t num_batches;
+};
+
+static void mapping_retain(BatchFileMapping* mapping) {
+    __atomic_fetch_add(&mapping->refcount, 1, __ATOMIC_RELAXED);
+}
+
+static void mapping_release(void* owner) {
+    BatchFileMapping* mapping = (BatchFileMapping*)owner;
+    if (__atomic_sub_fetch(&mapping->refcount, 1, __ATOMIC_ACQ_REL) == 0) {
+        munmap(mapping->base, mapping->size);
+        free(mapping);
+    }
+}
+
+int arrow_ipc_batch_file_reader_open(
+    const char* path,
+    ArrowIPCBatchFileReader** out_reader
+) {
+    if (!path || !out_reader) return ARROW_IPC_ERR_NULL;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return ARROW_IPC_ERR_IO;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return ARROW_IPC_ERR_IO;
+    }
+    size_t size = (size_t)st.st_size;
+    if (st.st_size < ARROW_IPC_BATCH_FILE_HEADER_SIZE + ARROW_IPC_BATCH_FILE_TRAILER_SIZE) {
+        close(fd);
+        return ARROW_IPC_ERR_FORMAT;
+    }
+
+    void* base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  /* The mapping stays valid */
+    if (base == MAP_FAILED) return ARROW_IPC_ERR_IO;
+
+    const uint8_t* bytes = (const uint8_t*)base;
+    const uint8_t* trailer = bytes + size - ARROW_IPC_BATCH_FILE_TRAILER_SIZE;
+    uint64_t index_offset = get_u64(trailer);
+    uint64_t num_batches = get_u64(trailer + 8);
+    uint64_t index_end = size - ARROW_IPC_BATCH_FILE_TRAILER_SIZE;
+
+    bool valid =
+        memcmp(bytes, ARROW_IPC_BATCH_FILE_MAGIC, ARROW_IPC_BATCH_FILE_MAGIC_SIZE) == 0 &&
+        memcmp(trailer + 16, ARROW_IPC_BATCH_FILE_MAGIC, ARROW_IPC_BATCH_FILE_MAGIC_SIZE) == 0 &&
+        index_offset >= ARROW_IPC_BATCH_FILE_HEADER_SIZE && index_offset <= index_end &&
+        num_batches == (index_end - index_offset) / ARROW_IPC_BATCH_FILE_ENTRY_SIZE &&
+        (index_end - index_offset) % ARROW_IPC_BATCH_FILE_ENTRY_SIZE == 0;
+    if (!valid) {
+        munmap(base, size);
+        return ARROW_IPC_ERR_FORMAT;
+    }
+    if (bytes[8] != ARROW_IPC_BATCH_FILE_VERSION) {
+        munmap(base, size);
+        return ARROW_IPC_ERR_VERSION;
+    }
+
+    BatchFileMapping* mapping = (BatchFileMapping*)malloc(sizeof(BatchFileMapping));
+    ArrowIPCBatchFileReader* reader = (ArrowIPCBatchFileReader*)malloc(sizeof(ArrowIPCBatchFileReader));
+    if (!mapping || !reader) {
+        free(mapping);
+        free(reader);
+        munmap(base, size);
+        return ARROW_IPC_ERR_ALLOC;
+    }
+
+    mapping->refcount = 1;
+    mapping->base = (uint8_t*)base;
+    mapping->size = size;
+
+    reader->mapping = mapping;
+    reader->index = bytes + index_offset;
+    reader->index_offset = index_offset;
+    reader->num_batches = (int64_t)num_batches;
+
+    *out_reader = reader;
+    return ARROW_IPC_OK;
+}
+
+int64_t arrow_ipc_batch_file_reader_num_batches(const ArrowIPCBatchFileReader* reader) {
+    return reader ? reader->num_batches : 0;
+}
+
+int64_t arrow_ipc_batch_file_reader_batch_rows(const ArrowIPCBatchFileReader* reader, int64_t index) {
+    if (!reader || index < 0 || index >= reader->num_batches) return -1;
+    return (int64_t)get_u64(reader->index + index * ARROW_IPC_BATCH_FILE_ENTRY_SIZE + 16);
+}
+
+int64_t arrow_ipc_batch_file_reader_num_rows(const ArrowIPCBatchFileReader* reader) {
+    int64_t total = 0;
+    for (int64_t i = 0; reader && i < reader->num_batches; i++) {
+        total += arrow_ipc_batch_file_reader_batch_rows(reader, i);
+    }
+    return total;
+}
+
+int arrow_ipc_batch_file_reader_read_batch(
+    ArrowIPCBatchFileReader* reader,
+    int64_t index,
+    struct ArrowSchema* out_schema,
+    struct ArrowArray* out_array
+) {
+    if (!reader || !out_schema || !out_array) return ARROW_IPC_ERR_NULL;
+    if (index < 0 || index >= reader->num_batches) return ARROW_IPC_ERR_FORMAT;
+
+    /* Entries are only checked when used, so opening stays O(1) */
+    const uint8_t* entry = reader->index + index * ARROW_IPC_BATCH_FILE_ENTRY_SIZE;
+    uint64_t offset = get_u64(entry);
+    uint64_t size = get_u64(entry + 8);
+    if (offset < ARROW_IPC_BATCH_FILE_HEADER_SIZE || offset % ARROW_IPC_ALIGNMENT != 0 ||
+        offset > reader->index_offset || size > reader->index_offset - offset) {
+        return ARROW_IPC_ERR_FORMAT;
+    }
+
+    BatchFileMapping* mapping = reader->mapping;
+    mapping_retain(mapping);
+    int rc = arrow_ipc_deserialize_batch_zero_copy(
+        mapping->base + offset, (size_t)size, mapping_release, mapping, out_schema, out_array);
+    if (rc != ARROW_IPC_OK) mapping_release(mapping);
+    return rc;
+}
+
+void arrow_ipc_batch_file_reader_close(ArrowIPCBatchFileReader* reader) {
+    if (!reader) return;
+    mapping_release(reader->mapping);
+    free(reader);
+}
@@ -0,0 +1,125 @@
+/*
+ * Arrow IPC Batch File
+ *
+ * An append-only, memory-mapped file of record batches in the compact
+ * format of arrow_ipc.h, with a trailing index so any batch can be opened
+ * in O(1) without parsing the rest of the file. Intended as a local
+ * spill/cache format read back by this library.
+ *
+ * Layout (integers little-endian):
+ *   [8 bytes]  Magic "ARRBFILE"
+ *   [4 bytes]  Version
+ *   [52 bytes] Zero padding
+ *   [batches]  arrow_ipc_serialize_batch blobs, each starting on a 64-byte
+ *              boundary of the file
+ *   [index]    Per batch: u64 offset, u64 size, i64 row count
+ *   [8 bytes]  Index offset
+ *   [8 bytes]  Number of batches
+ *   [8 bytes]  Magic "ARRBFILE"
+ *
+ * Since mmap returns page-aligned memory and every blob starts 64-byte
+ * aligned, batches are read with arrow_ipc_deserialize_batch_zero_copy
+ * directly from the mapping. The index is only written by close(), so a
+ * file whose writer never closed cannot be opened.
+ */
+
+#ifndef ARROW_IPC_BATCH_FILE_H
+#define ARROW_IPC_BATCH_FILE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "arrow_c_abi.h"
+#include "arrow_ipc.h"
+
+#define ARROW_IPC_BATCH_FILE_MAGIC       "ARRBFILE"
+#define ARROW_IPC_BATCH_FILE_MAGIC_SIZE  8
+#define ARROW_IPC_BATCH_FILE_VERSION     1
+#define ARROW_IPC_BATCH_FILE_HEADER_SIZE 64
+#define ARROW_IPC_BATCH_FILE_ENTRY_SIZE  24
+#define ARROW_IPC_BATCH_FILE_TRAILER_SIZE 24
+
+/* ============================================================================
+ * Writer
+ * ============================================================================ */
+
+typedef struct ArrowIPCBatchFileWriter ArrowIPCBatchFileWriter;
+
+/*
+ * Create (or truncate) the file at `path` and write its header.
+ * `options` selects per-buffer compression (NULL: uncompressed).
+ *
+ * @return ARROW_IPC_OK on success, ARROW_IPC_ERR_IO if the file cannot be written
+ */
+int arrow_ipc_batch_file_writer_open(
+    const char* path,
+    const ArrowIPCWriteOptions* options,
+    ArrowIPCBatchFileWriter** out_writer
+);
+
+/*
+ * Append one record batch. Batches need not share a schema.
+ *
+ * @return ARROW_IPC_OK on success, error code otherwise
+ */
+int arrow_ipc_batch_file_writer_append(
+    ArrowIPCBatchFileWriter* writer,
+    const struct ArrowSchema* schema,
+    const struct ArrowArray* array
+);
+
+/* Number of batches appended so far */
+int64_t arrow_ipc_batch_file_writer_num_batches(const ArrowIPCBatchFileWriter* writer);
+
+/*
+ * Write the index and trailer, close the file and free the writer.
+ * The writer is freed even when an error is returned.
+ */
+int arrow_ipc_batch_file_writer_close(ArrowIPCBatchFileWriter* writer);
+
+/* ============================================================================
+ * Reader
+ * ============================================================================ */
+
+typedef struct ArrowIPCBatchFileReader ArrowIPCBatchFileReader;
+
+/*
+ * Map the file at `path` and check its header and trailer. Opening does
+ * not touch the batches, so its cost does not depend on the file size.
+ *
+ * @return ARROW_IPC_OK on success; ARROW_IPC_ERR_IO if the file cannot be
+ *         mapped, ARROW_IPC_ERR_FORMAT if it is not a complete batch file
+ */
+int arrow_ipc_batch_file_reader_open(
+    const char* path,
+    ArrowIPCBatchFileReader** out_reader
+);
+
+/* Number of batches in the file */
+int64_t arrow_ipc_batch_file_reader_num_batches(const ArrowIPCBatchFileReader* reader);
+
+/* Row count of batch `index` from the index (-1 if out of range) */
+int64_t arrow_ipc_batch_file_reader_batch_rows(const ArrowIPCBatchFileReader* reader, int64_t index);
+
+/* Sum of the row counts of every batch */
+int64_t arrow_ipc_batch_file_reader_num_rows(const ArrowIPCBatchFileReader* reader);
+
+/*
+ * Read batch `index` without copying its buffers (compressed buffers are
+ * decompressed into owned memory). The arrays keep the mapping alive, so
+ * they stay valid after the reader is closed.
+ *
+ * @return ARROW_IPC_OK on success, ARROW_IPC_ERR_FORMAT if `index` is out of
+ *         range or its index entry is corrupt, other error codes from
+ *         arrow_ipc_deserialize_batch_zero_copy
+ */
+int arrow_ipc_batch_file_reader_read_batch(
+    ArrowIPCBatchFileReader* reader,
+    int64_t index,
+    struct ArrowSchema* out_schema,
+    struct ArrowArray* out_array
+);
+
+/* Drop the reader's reference to the mapping and free it */
+void arrow_ipc_batch_file_reader_close(ArrowIPCBatchFileReader* reader);
+
+#endif /* ARROW_IPC_BATCH_FILE_H */
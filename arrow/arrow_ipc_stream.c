@@ -0,0 +1,3242 @@
+/*
+ * Arrow IPC Streaming and File Format Implementation
+ *
+ * Message metadata is encoded with a small flatbuffer builder/reader that
+ * covers exactly the tables of Schema.fbs, Message.fbs and File.fbs used
+ * here, so no flatbuffers dependency is needed.
+ */
+
+/* posix_memalign, writev */
+#define _POSIX_C_SOURCE 200112L
+
+#include "arrow_ipc_stream.h"
+#define ARROW_MEMORY_SUBSYSTEM ARROW_MEMORY_IPC
+#include "arrow_memory.h"
+#include <errno.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+/* MetadataVersion: V4 is the oldest layout this reader accepts */
+#define IPC_METADATA_V4 3
+#define IPC_METADATA_V5 4
+
+/* MessageHeader union */
+#define IPC_MESSAGE_SCHEMA           1
+#define IPC_MESSAGE_DICTIONARY_BATCH 2
+#define IPC_MESSAGE_RECORD_BATCH     3
+
+/* Type union */
+#define IPC_TYPE_NULL          1
+#define IPC_TYPE_INT           2
+#define IPC_TYPE_FLOAT         3
+#define IPC_TYPE_BINARY        4
+#define IPC_TYPE_UTF8          5
+#define IPC_TYPE_BOOL          6
+#define IPC_TYPE_DECIMAL       7
+#define IPC_TYPE_DATE          8
+#define IPC_TYPE_TIME          9
+#define IPC_TYPE_TIMESTAMP     10
+#define IPC_TYPE_INTERVAL      11
+#define IPC_TYPE_LIST          12
+#define IPC_TYPE_STRUCT        13
+#define IPC_TYPE_FIXED_BINARY  15
+#define IPC_TYPE_FIXED_LIST    16
+#define IPC_TYPE_MAP           17
+#define IPC_TYPE_DURATION      18
+#define IPC_TYPE_LARGE_BINARY  19
+#define IPC_TYPE_LARGE_UTF8    20
+#define IPC_TYPE_LARGE_LIST    21
+
+/* BodyCompression.codec values */
+#define IPC_CODEC_LZ4_FRAME 0
+#define IPC_CODEC_ZSTD      1
+
+/* Size of the FieldNode and Buffer structs, and of the footer's Block */
+#define IPC_FIELD_NODE_SIZE 16
+#define IPC_BUFFER_SIZE     16
+#define IPC_BLOCK_SIZE      24
+
+static const uint8_t ipc_zeros[ARROW_IPC_STREAM_ALIGNMENT] = {0};
+
+static void put_le(uint8_t* dst, uint64_t value, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        dst[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static uint64_t get_le(const uint8_t* src, size_t size) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < size; i++) {
+        value |= (uint64_t)src[i] << (8 * i);
+    }
+    return value;
+}
+
+static int64_t get_le_signed(const uint8_t* src, size_t size) {
+    uint64_t value = get_le(src, size);
+    if (size < 8 && (value >> (8 * size - 1)) & 1) {
+        value |= ~(uint64_t)0 << (8 * size);
+    }
+    return (int64_t)value;
+}
+
+/* ============================================================================
+ * Flatbuffer Builder
+ *
+ * Builds front to back: a table is written first with placeholder offsets,
+ * its vtable right after it, and the objects it references later, so every
+ * uoffset points forward as the format requires. Errors are sticky and
+ * checked once when the buffer is finished.
+ * ============================================================================ */
+
+#define FB_MAX_FIELDS 8
+
+typedef struct {
+    ArrowIPCBuffer buf;
+    int error;
+} FbBuilder;
+
+typedef struct {
+    size_t start;
+    uint16_t offsets[FB_MAX_FIELDS];  /* Field offsets relative to start */
+    int num_fields;
+} FbTable;
+
+static void fb_bytes(FbBuilder* b, const void* data, size_t len) {
+    if (b->error || len == 0) return;
+    b->error = arrow_ipc_buffer_write(&b->buf, data, len);
+}
+
+static void fb_put(FbBuilder* b, uint64_t value, size_t size) {
+    uint8_t bytes[8];
+    put_le(bytes, value, size);
+    fb_bytes(b, bytes, size);
+}
+
+static void fb_align(FbBuilder* b, size_t align) {
+    fb_bytes(b, ipc_zeros, (align - b->buf.size % align) % align);
+}
+
+/* Point the uoffset at `slot` to `target` (which lies after it) */
+static void fb_set_offset(FbBuilder* b, size_t slot, size_t target) {
+    if (b->error) return;
+    put_le(b->buf.data + slot, (uint64_t)(target - slot), 4);
+}
+
+/* Start a buffer; the root table offset is filled in by fb_set_root */
+static void fb_init(FbBuilder* b) {
+    arrow_ipc_buffer_init(&b->buf);
+    b->error = ARROW_IPC_OK;
+    fb_put(b, 0, 4);
+}
+
+static void fb_set_root(FbBuilder* b, size_t table) {
+    fb_set_offset(b, 0, table);
+}
+
+static void fb_table_begin(FbBuilder* b, FbTable* t) {
+    fb_align(b, 8);
+    t->start = b->buf.size;
+    t->num_fields = 0;
+    memset(t->offsets, 0, sizeof(t->offsets));
+    fb_put(b, 0, 4);  /* soffset to the vtable, set by fb_table_end */
+}
+
+static void fb_field(FbBuilder* b, FbTable* t, int id, uint64_t value, size_t size) {
+    fb_align(b, size);
+    t->offsets[id] = (uint16_t)(b->buf.size - t->start);
+    if (id >= t->num_fields) t->num_fields = id + 1;
+    fb_put(b, value, size);
+}
+
+/* Reserve a uoffset field; returns the slot to pass to fb_set_offset */
+static size_t fb_field_offset(FbBuilder* b, FbTable* t, int id) {
+    fb_field(b, t, id, 0, 4);
+    return b->buf.size - 4;
+}
+
+static size_t fb_table_end(FbBuilder* b, FbTable* t) {
+    fb_align(b, 2);
+    size_t vtable = b->buf.size;
+    fb_put(b, 4 + 2 * (uint64_t)t->num_fields, 2);
+    fb_put(b, vtable - t->start, 2);
+    for (int i = 0; i < t->num_fields; i++) {
+        fb_put(b, t->offsets[i], 2);
+    }
+    if (!b->error) {
+        int32_t soffset = (int32_t)((int64_t)t->start - (int64_t)vtable);
+        put_le(b->buf.data + t->start, (uint32_t)soffset, 4);
+    }
+    return t->start;
+}
+
+static size_t fb_string_n(FbBuilder* b, const char* data, size_t len) {
+    fb_align(b, 4);
+    size_t pos = b->buf.size;
+    fb_put(b, len, 4);
+    fb_bytes(b, data, len);
+    fb_put(b, 0, 1);
+    return pos;
+}
+
+/* Start a vector of `count` elements aligned to `align`; returns its position */
+static size_t fb_vector_begin(FbBuilder* b, size_t count, size_t align) {
+    fb_align(b, 4);
+    if (align > 4 && (b->buf.size + 4) % align != 0) fb_put(b, 0, 4);
+    size_t pos = b->buf.size;
+    fb_put(b, count, 4);
+    return pos;
+}
+
+/* Vector of table offsets; element i's slot is at pos + 4 + 4 * i */
+static size_t fb_offset_vector(FbBuilder* b, size_t count) {
+    size_t pos = fb_vector_begin(b, count, 4);
+    for (size_t i = 0; i < count; i++) fb_put(b, 0, 4);
+    return pos;
+}
+
+/* ============================================================================
+ * Flatbuffer Reader
+ *
+ * Every access is bounds-checked: metadata comes from other processes.
+ * ============================================================================ */
+
+typedef struct {
+    const uint8_t* buf;
+    size_t size;
+    size_t pos;          /* Table position */
+    size_t vtable;
+    size_t vtable_size;
+    size_t table_size;
+} FbRef;
+
+static bool fb_table_at(const uint8_t* buf, size_t size, size_t pos, FbRef* out) {
+    if (pos % 4 != 0 || pos > size || size - pos < 4) return false;
+    int64_t vtable = (int64_t)pos - get_le_signed(buf + pos, 4);
+    if (vtable < 0 || vtable % 2 != 0 || (uint64_t)vtable > size - 4) return false;
+
+    size_t vtable_size = (size_t)get_le(buf + vtable, 2);
+    size_t table_size = (size_t)get_le(buf + vtable + 2, 2);
+    if (vtable_size < 4 || vtable_size % 2 != 0 || vtable_size > size - (size_t)vtable) return false;
+    if (table_size < 4 || table_size > size - pos) return false;
+
+    out->buf = buf;
+    out->size = size;
+    out->pos = pos;
+    out->vtable = (size_t)vtable;
+    out->vtable_size = vtable_size;
+    out->table_size = table_size;
+    return true;
+}
+
+static bool fb_root(const uint8_t* buf, size_t size, FbRef* out) {
+    if (size < 4) return false;
+    return fb_table_at(buf, size, (size_t)get_le(buf, 4), out);
+}
+
+/* Position of field `id`, or 0 when absent or not inside the table */
+static size_t fb_field_pos(const FbRef* t, int id, size_t width) {
+    size_t entry = 4 + 2 * (size_t)id;
+    if (entry + 2 > t->vtable_size) return 0;
+    size_t offset = (size_t)get_le(t->buf + t->vtable + entry, 2);
+    if (offset == 0 || offset + width > t->table_size) return 0;
+    return t->pos + offset;
+}
+
+static int64_t fb_int(const FbRef* t, int id, size_t width, int64_t def) {
+    size_t pos = fb_field_pos(t, id, width);
+    return pos ? get_le_signed(t->buf + pos, width) : def;
+}
+
+/* Follow the uoffset at absolute position `slot` */
+static bool fb_deref(const FbRef* t, size_t slot, size_t* target) {
+    if (slot > t->size || t->size - slot < 4) return false;
+    *target = slot + (size_t)get_le(t->buf + slot, 4);
+    return *target < t->size;
+}
+
+static bool fb_table(const FbRef* t, int id, FbRef* out) {
+    size_t slot = fb_field_pos(t, id, 4);
+    size_t target;
+    return slot && fb_deref(t, slot, &target) && fb_table_at(t->buf, t->size, target, out);
+}
+
+/* Vector field: element position and count. Absent vectors are empty. */
+static bool fb_vector(const FbRef* t, int id, size_t elem_size, size_t* elems, size_t* count) {
+    *elems = 0;
+    *count = 0;
+    size_t slot = fb_field_pos(t, id, 4);
+    if (!slot) return true;
+
+    size_t pos;
+    if (!fb_deref(t, slot, &pos) || pos % 4 != 0 || t->size - pos < 4) return false;
+    size_t n = (size_t)get_le(t->buf + pos, 4);
+    if (elem_size > 0 && n > (t->size - pos - 4) / elem_size) return false;
+    *elems = pos + 4;
+    *count = n;
+    return true;
+}
+
+/* Element `i` of a vector of tables */
+static bool fb_vector_table(const FbRef* t, size_t elems, size_t i, FbRef* out) {
+    size_t target;
+    return fb_deref(t, elems + 4 * i, &target) && fb_table_at(t->buf, t->size, target, out);
+}
+
+/* String field; *data is NULL when absent */
+static bool fb_string(const FbRef* t, int id, const char** data, size_t* len) {
+    size_t elems, count;
+    if (!fb_vector(t, id, 1, &elems, &count)) return false;
+    *data = elems ? (const char*)t->buf + elems : NULL;
+    *len = count;
+    return true;
+}
+
+/* ============================================================================
+ * Type Mapping
+ *
+ * Between C data interface format strings and the Schema.fbs Type union.
+ * ============================================================================ */
+
+/* Physical buffer layout of an array node */
+typedef enum {
+    IPC_LAYOUT_NULL,          /* No buffers */
+    IPC_LAYOUT_BITMAP,        /* validity + bit-packed values */
+    IPC_LAYOUT_FIXED,         /* validity + byte_width values */
+    IPC_LAYOUT_BINARY,        /* validity + int32 offsets + data */
+    IPC_LAYOUT_LARGE_BINARY,  /* validity + int64 offsets + data */
+    IPC_LAYOUT_LIST,          /* validity + int32 offsets, one child */
+    IPC_LAYOUT_LARGE_LIST,    /* validity + int64 offsets, one child */
+    IPC_LAYOUT_FIXED_LIST,    /* validity, one child of width * length */
+    IPC_LAYOUT_STRUCT         /* validity, children of the same length */
+} IPCLayout;
+
+typedef struct {
+    uint8_t type;             /* Type union tag */
+    int32_t bit_width;        /* Int, Time, Decimal */
+    bool is_signed;           /* Int */
+    int16_t unit;             /* Float precision; Date/Time/Timestamp/Duration/Interval unit */
+    int32_t precision;        /* Decimal */
+    int32_t scale;            /* Decimal */
+    int32_t width;            /* FixedSizeBinary byte width, FixedSizeList size */
+    const char* timezone;     /* Timestamp; borrowed, not NUL-terminated */
+    size_t timezone_len;
+    bool keys_sorted;         /* Map */
+} IPCType;
+
+static const char ipc_time_units[] = "smun";
+
+static int time_unit(char c) {
+    const char* p = c ? strchr(ipc_time_units, c) : NULL;
+    return p ? (int)(p - ipc_time_units) : -1;
+}
+
+/* Parse a decimal integer that must be followed by `end` */
+static bool parse_int(const char** s, char end, int32_t* out) {
+    char* stop;
+    long value = strtol(*s, &stop, 10);
+    if (stop == *s || *stop != end || value < 0 || value > INT32_MAX) return false;
+    *out = (int32_t)value;
+    *s = end ? stop + 1 : stop;
+    return true;
+}
+
+static int parse_format(const char* format, int64_t flags, IPCType* t) {
+    memset(t, 0, sizeof(IPCType));
+    if (!format || !format[0]) return ARROW_IPC_ERR_FORMAT;
+
+    if (format[1] == '\0') {
+        const char* ints = "cCsSiIlL";
+        const char* p = strchr(ints, format[0]);
+        if (p) {
+            int index = (int)(p - ints);
+            t->type = IPC_TYPE_INT;
+            t->bit_width = 8 << (index / 2);
+            t->is_signed = index % 2 == 0;
+            return ARROW_IPC_OK;
+        }
+        switch (format[0]) {
+            case 'n': t->type = IPC_TYPE_NULL; return ARROW_IPC_OK;
+            case 'b': t->type = IPC_TYPE_BOOL; return ARROW_IPC_OK;
+            case 'e': t->type = IPC_TYPE_FLOAT; t->unit = 0; return ARROW_IPC_OK;
+            case 'f': t->type = IPC_TYPE_FLOAT; t->unit = 1; return ARROW_IPC_OK;
+            case 'g': t->type = IPC_TYPE_FLOAT; t->unit = 2; return ARROW_IPC_OK;
+            case 'z': t->type = IPC_TYPE_BINARY; return ARROW_IPC_OK;
+            case 'Z': t->type = IPC_TYPE_LARGE_BINARY; return ARROW_IPC_OK;
+            case 'u': t->type = IPC_TYPE_UTF8; return ARROW_IPC_OK;
+            case 'U': t->type = IPC_TYPE_LARGE_UTF8; return ARROW_IPC_OK;
+            default: return ARROW_IPC_ERR_UNSUPPORTED;
+        }
+    }
+
+    const char* s = format + 2;
+    if (format[0] == 'w' && format[1] == ':') {
+        t->type = IPC_TYPE_FIXED_BINARY;
+        return parse_int(&s, '\0', &t->width) && t->width > 0 ? ARROW_IPC_OK : ARROW_IPC_ERR_FORMAT;
+    }
+    if (format[0] == 'd' && format[1] == ':') {
+        t->type = IPC_TYPE_DECIMAL;
+        t->bit_width = 128;
+        if (!parse_int(&s, ',', &t->precision)) return ARROW_IPC_ERR_FORMAT;
+        if (strchr(s, ',')) {
+            if (!parse_int(&s, ',', &t->scale) || !parse_int(&s, '\0', &t->bit_width)) return ARROW_IPC_ERR_FORMAT;
+        } else if (!parse_int(&s, '\0', &t->scale)) {
+            return ARROW_IPC_ERR_FORMAT;
+        }
+        return t->bit_width == 128 || t->bit_width == 256 ? ARROW_IPC_OK : ARROW_IPC_ERR_UNSUPPORTED;
+    }
+    if (format[0] == '+') {
+        switch (format[1]) {
+            case 'l': t->type = IPC_TYPE_LIST; break;
+            case 'L': t->type = IPC_TYPE_LARGE_LIST; break;
+            case 's': t->type = IPC_TYPE_STRUCT; break;
+            case 'm':
+                t->type = IPC_TYPE_MAP;
+                t->keys_sorted = (flags & ARROW_FLAG_MAP_KEYS_SORTED) != 0;
+                break;
+            case 'w':
+                t->type = IPC_TYPE_FIXED_LIST;
+                s = format + 3;
+                return format[2] == ':' && parse_int(&s, '\0', &t->width) ? ARROW_IPC_OK : ARROW_IPC_ERR_FORMAT;
+            default:
+                return ARROW_IPC_ERR_UNSUPPORTED;
+        }
+        return format[2] == '\0' ? ARROW_IPC_OK : ARROW_IPC_ERR_FORMAT;
+    }
+    if (format[0] != 't' || !format[2]) return ARROW_IPC_ERR_UNSUPPORTED;
+
+    int unit = time_unit(format[2]);
+    switch (format[1]) {
+        case 'd':  /* tdD, tdm */
+            t->type = IPC_TYPE_DATE;
+            if (format[2] == 'D') t->unit = 0;
+            else if (format[2] == 'm') t->unit = 1;
+            else return ARROW_IPC_ERR_FORMAT;
+            return format[3] == '\0' ? ARROW_IPC_OK : ARROW_IPC_ERR_FORMAT;
+        case 't':  /* tts, ttm (32-bit), ttu, ttn (64-bit) */
+            t->type = IPC_TYPE_TIME;
+            if (unit < 0 || format[3] != '\0') return ARROW_IPC_ERR_FORMAT;
+            t->unit = (int16_t)unit;
+            t->bit_width = unit < 2 ? 32 : 64;
+            return ARROW_IPC_OK;
+        case 's':  /* ts{s,m,u,n}:timezone */
+            t->type = IPC_TYPE_TIMESTAMP;
+            if (unit < 0 || format[3] != ':') return ARROW_IPC_ERR_FORMAT;
+            t->unit = (int16_t)unit;
+            t->timezone = format + 4;
+            t->timezone_len = strlen(format + 4);
+            return ARROW_IPC_OK;
+        case 'D':  /* tD{s,m,u,n} */
+            t->type = IPC_TYPE_DURATION;
+            if (unit < 0 || format[3] != '\0') return ARROW_IPC_ERR_FORMAT;
+            t->unit = (int16_t)unit;
+            return ARROW_IPC_OK;
+        case 'i':  /* tiM, tiD, tin */
+            t->type = IPC_TYPE_INTERVAL;
+            if (format[2] == 'M') t->unit = 0;
+            else if (format[2] == 'D') t->unit = 1;
+            else if (format[2] == 'n') t->unit = 2;
+            else return ARROW_IPC_ERR_FORMAT;
+            return format[3] == '\0' ? ARROW_IPC_OK : ARROW_IPC_ERR_FORMAT;
+        default:
+            return ARROW_IPC_ERR_UNSUPPORTED;
+    }
+}
+
+/* Format string for a decoded type (caller must free) */
+static int format_from_type(const IPCType* t, char** out) {
+    char buf[64];
+    const char* fixed = NULL;
+    *out = NULL;
+
+    switch (t->type) {
+        case IPC_TYPE_NULL: fixed = "n"; break;
+        case IPC_TYPE_BOOL: fixed = "b"; break;
+        case IPC_TYPE_BINARY: fixed = "z"; break;
+        case IPC_TYPE_LARGE_BINARY: fixed = "Z"; break;
+        case IPC_TYPE_UTF8: fixed = "u"; break;
+        case IPC_TYPE_LARGE_UTF8: fixed = "U"; break;
+        case IPC_TYPE_LIST: fixed = "+l"; break;
+        case IPC_TYPE_LARGE_LIST: fixed = "+L"; break;
+        case IPC_TYPE_STRUCT: fixed = "+s"; break;
+        case IPC_TYPE_MAP: fixed = "+m"; break;
+        case IPC_TYPE_INT: {
+            static const char ints[] = "cCsSiIlL";
+            int index;
+            switch (t->bit_width) {
+                case 8: index = 0; break;
+                case 16: index = 2; break;
+                case 32: index = 4; break;
+                case 64: index = 6; break;
+                default: return ARROW_IPC_ERR_FORMAT;
+            }
+            buf[0] = ints[index + (t->is_signed ? 0 : 1)];
+            buf[1] = '\0';
+            break;
+        }
+        case IPC_TYPE_FLOAT:
+            if (t->unit < 0 || t->unit > 2) return ARROW_IPC_ERR_FORMAT;
+            buf[0] = "efg"[t->unit];
+            buf[1] = '\0';
+            break;
+        case IPC_TYPE_DECIMAL:
+            if (t->bit_width != 128 && t->bit_width != 256) return ARROW_IPC_ERR_UNSUPPORTED;
+            if (t->bit_width == 128) snprintf(buf, sizeof(buf), "d:%d,%d", (int)t->precision, (int)t->scale);
+            else snprintf(buf, sizeof(buf), "d:%d,%d,%d", (int)t->precision, (int)t->scale, (int)t->bit_width);
+            break;
+        case IPC_TYPE_DATE:
+            if (t->unit != 0 && t->unit != 1) return ARROW_IPC_ERR_FORMAT;
+            fixed = t->unit == 0 ? "tdD" : "tdm";
+            break;
+        case IPC_TYPE_TIME:
+            if (t->unit < 0 || t->unit > 3 || t->bit_width != (t->unit < 2 ? 32 : 64)) return ARROW_IPC_ERR_FORMAT;
+            snprintf(buf, sizeof(buf), "tt%c", ipc_time_units[t->unit]);
+            break;
+        case IPC_TYPE_DURATION:
+            if (t->unit < 0 || t->unit > 3) return ARROW_IPC_ERR_FORMAT;
+            snprintf(buf, sizeof(buf), "tD%c", ipc_time_units[t->unit]);
+            break;
+        case IPC_TYPE_INTERVAL:
+            if (t->unit < 0 || t->unit > 2) return ARROW_IPC_ERR_FORMAT;
+            fixed = t->unit == 0 ? "tiM" : t->unit == 1 ? "tiD" : "tin";
+            break;
+        case IPC_TYPE_FIXED_BINARY:
+            if (t->width <= 0) return ARROW_IPC_ERR_FORMAT;
+            snprintf(buf, sizeof(buf), "w:%d", (int)t->width);
+            break;
+        case IPC_TYPE_FIXED_LIST:
+            if (t->width < 0) return ARROW_IPC_ERR_FORMAT;
+            snprintf(buf, sizeof(buf), "+w:%d", (int)t->width);
+            break;
+        case IPC_TYPE_TIMESTAMP: {
+            if (t->unit < 0 || t->unit > 3) return ARROW_IPC_ERR_FORMAT;
+            char* format = malloc(5 + t->timezone_len);
+            if (!format) return ARROW_IPC_ERR_ALLOC;
+            format[0] = 't';
+            format[1] = 's';
+            format[2] = ipc_time_units[t->unit];
+            format[3] = ':';
+            if (t->timezone_len) memcpy(format + 4, t->timezone, t->timezone_len);
+            format[4 + t->timezone_len] = '\0';
+            *out = format;
+            return ARROW_IPC_OK;
+        }
+        default:
+            return ARROW_IPC_ERR_UNSUPPORTED;
+    }
+
+    const char* src = fixed ? fixed : buf;
+    size_t len = strlen(src);
+    *out = malloc(len + 1);
+    if (!*out) return ARROW_IPC_ERR_ALLOC;
+    memcpy(*out, src, len + 1);
+    return ARROW_IPC_OK;
+}
+
+static IPCLayout type_layout(const IPCType* t, int64_t* byte_width) {
+    *byte_width = 0;
+    switch (t->type) {
+        case IPC_TYPE_NULL: return IPC_LAYOUT_NULL;
+        case IPC_TYPE_BOOL: return IPC_LAYOUT_BITMAP;
+        case IPC_TYPE_INT:
+        case IPC_TYPE_TIME:
+        case IPC_TYPE_DECIMAL:
+            *byte_width = t->bit_width / 8;
+            return IPC_LAYOUT_FIXED;
+        case IPC_TYPE_FLOAT:
+            *byte_width = (int64_t)2 << t->unit;
+            return IPC_LAYOUT_FIXED;
+        case IPC_TYPE_DATE:
+            *byte_width = t->unit == 0 ? 4 : 8;
+            return IPC_LAYOUT_FIXED;
+        case IPC_TYPE_TIMESTAMP:
+        case IPC_TYPE_DURATION:
+            *byte_width = 8;
+            return IPC_LAYOUT_FIXED;
+        case IPC_TYPE_INTERVAL:
+            *byte_width = (int64_t)4 << t->unit;
+            return IPC_LAYOUT_FIXED;
+        case IPC_TYPE_FIXED_BINARY:
+            *byte_width = t->width;
+            return IPC_LAYOUT_FIXED;
+        case IPC_TYPE_BINARY:
+        case IPC_TYPE_UTF8:
+            return IPC_LAYOUT_BINARY;
+        case IPC_TYPE_LARGE_BINARY:
+        case IPC_TYPE_LARGE_UTF8:
+            return IPC_LAYOUT_LARGE_BINARY;
+        case IPC_TYPE_LIST:
+        case IPC_TYPE_MAP:
+            return IPC_LAYOUT_LIST;
+        case IPC_TYPE_LARGE_LIST:
+            return IPC_LAYOUT_LARGE_LIST;
+        case IPC_TYPE_FIXED_LIST:
+            *byte_width = t->width;  /* List size */
+            return IPC_LAYOUT_FIXED_LIST;
+        default:
+            return IPC_LAYOUT_STRUCT;
+    }
+}
+
+static int layout_buffer_count(IPCLayout layout) {
+    switch (layout) {
+        case IPC_LAYOUT_NULL: return 0;
+        case IPC_LAYOUT_FIXED_LIST:
+        case IPC_LAYOUT_STRUCT: return 1;
+        case IPC_LAYOUT_BINARY:
+        case IPC_LAYOUT_LARGE_BINARY: return 3;
+        default: return 2;
+    }
+}
+
+/* Number of children the type requires, or -1 for any (struct) */
+static int64_t type_child_count(const IPCType* t) {
+    switch (t->type) {
+        case IPC_TYPE_LIST:
+        case IPC_TYPE_LARGE_LIST:
+        case IPC_TYPE_FIXED_LIST:
+        case IPC_TYPE_MAP:
+            return 1;
+        case IPC_TYPE_STRUCT:
+            return -1;
+        default:
+            return 0;
+    }
+}
+
+/* ============================================================================
+ * Schema Flattening
+ *
+ * Array nodes appear in RecordBatch messages in depth-first pre-order, one
+ * FieldNode each. Both directions walk arrays against this flat list.
+ * ============================================================================ */
+
+typedef struct {
+    IPCType type;         /* Storage type: the index type when dictionary-encoded */
+    IPCLayout layout;
+    int64_t byte_width;   /* IPC_LAYOUT_FIXED value width, IPC_LAYOUT_FIXED_LIST size */
+    int64_t n_children;
+    int64_t dictionary;   /* Index into the dictionary table, or -1 */
+} IPCNode;
+
+typedef struct {
+    IPCNode* nodes;
+    size_t count;
+    size_t capacity;
+} IPCNodeList;
+
+/* Dictionary value schemas by dictionary index (borrowed) */
+typedef struct {
+    const struct ArrowSchema** schemas;
+    size_t count;
+    size_t capacity;
+} IPCSchemaList;
+
+static int grow_array(void** items, size_t* capacity, size_t needed, size_t elem_size) {
+    if (needed <= *capacity) return ARROW_IPC_OK;
+    size_t new_capacity = *capacity ? *capacity * 2 : 8;
+    while (new_capacity < needed) new_capacity *= 2;
+    void* grown = realloc(*items, new_capacity * elem_size);
+    if (!grown) return ARROW_IPC_ERR_ALLOC;
+    *items = grown;
+    *capacity = new_capacity;
+    return ARROW_IPC_OK;
+}
+
+static void node_list_free(IPCNodeList* list) {
+    free(list->nodes);
+    memset(list, 0, sizeof(IPCNodeList));
+}
+
+/*
+ * Append `schema` and its descendants. Dictionary-encoded nodes get the
+ * next dictionary index; `dictionaries` is NULL where they are not allowed.
+ */
+static int flatten_schema(const struct ArrowSchema* schema, IPCNodeList* list, IPCSchemaList* dictionaries) {
+    if (!schema) return ARROW_IPC_ERR_NULL;
+
+    IPCNode node;
+    memset(&node, 0, sizeof(IPCNode));
+    int rc = parse_format(schema->format, schema->flags, &node.type);
+    if (rc != ARROW_IPC_OK) return rc;
+    node.type.timezone = NULL;  /* Borrowed from the schema; only needed while encoding */
+    node.layout = type_layout(&node.type, &node.byte_width);
+    node.dictionary = -1;
+
+    if (schema->dictionary) {
+        if (!dictionaries) return ARROW_IPC_ERR_UNSUPPORTED;
+        if (node.type.type != IPC_TYPE_INT) return ARROW_IPC_ERR_FORMAT;
+        rc = grow_array((void**)&dictionaries->schemas, &dictionaries->capacity,
+                        dictionaries->count + 1, sizeof(struct ArrowSchema*));
+        if (rc != ARROW_IPC_OK) return rc;
+        node.dictionary = (int64_t)dictionaries->count;
+        dictionaries->schemas[dictionaries->count++] = schema->dictionary;
+    } else {
+        int64_t expected = type_child_count(&node.type);
+        if (expected >= 0 && schema->n_children != expected) return ARROW_IPC_ERR_FORMAT;
+        if (schema->n_children > 0 && !schema->children) return ARROW_IPC_ERR_FORMAT;
+        node.n_children = schema->n_children;
+    }
+
+    rc = grow_array((void**)&list->nodes, &list->capacity, list->count + 1, sizeof(IPCNode));
+    if (rc != ARROW_IPC_OK) return rc;
+    list->nodes[list->count++] = node;
+
+    for (int64_t i = 0; i < node.n_children; i++) {
+        rc = flatten_schema(schema->children[i], list, dictionaries);
+        if (rc != ARROW_IPC_OK) return rc;
+    }
+    return ARROW_IPC_OK;
+}
+
+/* Flatten the columns of a struct schema */
+static int flatten_columns(const struct ArrowSchema* schema, IPCNodeList* list, IPCSchemaList* dictionaries) {
+    if (!schema->format || strcmp(schema->format, "+s") != 0) return ARROW_IPC_ERR_FORMAT;
+    if (schema->n_children > 0 && !schema->children) return ARROW_IPC_ERR_FORMAT;
+    for (int64_t i = 0; i < schema->n_children; i++) {
+        int rc = flatten_schema(schema->children[i], list, dictionaries);
+        if (rc != ARROW_IPC_OK) return rc;
+    }
+    return ARROW_IPC_OK;
+}
+
+/* ============================================================================
+ * Schema Encoding
+ * ============================================================================ */
+
+static size_t encode_int_type(FbBuilder* b, int32_t bit_width, bool is_signed) {
+    FbTable t;
+    fb_table_begin(b, &t);
+    fb_field(b, &t, 0, (uint32_t)bit_width, 4);
+    fb_field(b, &t, 1, is_signed ? 1 : 0, 1);
+    return fb_table_end(b, &t);
+}
+
+/* Type union member table for `t` */
+static size_t encode_type(FbBuilder* b, const IPCType* t) {
+    if (t->type == IPC_TYPE_INT) return encode_int_type(b, t->bit_width, t->is_signed);
+
+    FbTable table;
+    size_t timezone_slot = 0;
+    fb_table_begin(b, &table);
+    switch (t->type) {
+        case IPC_TYPE_FLOAT:
+        case IPC_TYPE_DATE:
+        case IPC_TYPE_DURATION:
+        case IPC_TYPE_INTERVAL:
+            fb_field(b, &table, 0, (uint16_t)t->unit, 2);
+            break;
+        case IPC_TYPE_TIME:
+            fb_field(b, &table, 1, (uint32_t)t->bit_width, 4);
+            fb_field(b, &table, 0, (uint16_t)t->unit, 2);
+            break;
+        case IPC_TYPE_TIMESTAMP:
+            if (t->timezone_len > 0) timezone_slot = fb_field_offset(b, &table, 1);
+            fb_field(b, &table, 0, (uint16_t)t->unit, 2);
+            break;
+        case IPC_TYPE_DECIMAL:
+            fb_field(b, &table, 0, (uint32_t)t->precision, 4);
+            fb_field(b, &table, 1, (uint32_t)t->scale, 4);
+            fb_field(b, &table, 2, (uint32_t)t->bit_width, 4);
+            break;
+        case IPC_TYPE_FIXED_BINARY:
+        case IPC_TYPE_FIXED_LIST:
+            fb_field(b, &table, 0, (uint32_t)t->width, 4);
+            break;
+        case IPC_TYPE_MAP:
+            fb_field(b, &table, 0, t->keys_sorted ? 1 : 0, 1);
+            break;
+        default:
+            break;  /* Types without parameters are empty tables */
+    }
+    size_t pos = fb_table_end(b, &table);
+    if (timezone_slot) fb_set_offset(b, timezone_slot, fb_string_n(b, t->timezone, t->timezone_len));
+    return pos;
+}
+
+static int32_t metadata_read_i32(const uint8_t** p) {
+    int32_t value;
+    memcpy(&value, *p, 4);
+    *p += 4;
+    return value;
+}
+
+static int32_t metadata_count(const char* metadata) {
+    if (!metadata) return 0;
+    const uint8_t* p = (const uint8_t*)metadata;
+    return metadata_read_i32(&p);
+}
+
+/* KeyValue vector from C data interface metadata, referenced from `slot` */
+static void encode_metadata(FbBuilder* b, size_t slot, const char* metadata) {
+    const uint8_t* p = (const uint8_t*)metadata;
+    int32_t n = metadata_read_i32(&p);
+
+    size_t vec = fb_offset_vector(b, (size_t)n);
+    fb_set_offset(b, slot, vec);
+    for (int32_t i = 0; i < n; i++) {
+        int32_t key_len = metadata_read_i32(&p);
+        const char* key = (const char*)p;
+        p += key_len;
+        int32_t value_len = metadata_read_i32(&p);
+        const char* value = (const char*)p;
+        p += value_len;
+
+        FbTable kv;
+        fb_table_begin(b, &kv);
+        size_t key_slot = fb_field_offset(b, &kv, 0);
+        size_t value_slot = fb_field_offset(b, &kv, 1);
+        fb_set_offset(b, vec + 4 + 4 * (size_t)i, fb_table_end(b, &kv));
+        fb_set_offset(b, key_slot, fb_string_n(b, key, (size_t)key_len));
+        fb_set_offset(b, value_slot, fb_string_n(b, value, (size_t)value_len));
+    }
+}
+
+/*
+ * Field table. Dictionary ids are handed out in pre-order, matching the
+ * dictionary indices flatten_schema assigns.
+ */
+static size_t encode_field(FbBuilder* b, const struct ArrowSchema* field, int64_t* next_dictionary_id) {
+    const struct ArrowSchema* value = field->dictionary ? field->dictionary : field;
+    IPCType type, index_type;
+    if (parse_format(value->format, value->flags, &type) != ARROW_IPC_OK ||
+        (field->dictionary && parse_format(field->format, field->flags, &index_type) != ARROW_IPC_OK)) {
+        if (!b->error) b->error = ARROW_IPC_ERR_UNSUPPORTED;
+        return 0;
+    }
+
+    FbTable t;
+    fb_table_begin(b, &t);
+    size_t name_slot = fb_field_offset(b, &t, 0);
+    size_t type_slot = fb_field_offset(b, &t, 3);
+    size_t dictionary_slot = field->dictionary ? fb_field_offset(b, &t, 4) : 0;
+    size_t children_slot = fb_field_offset(b, &t, 5);
+    size_t metadata_slot = metadata_count(field->metadata) > 0 ? fb_field_offset(b, &t, 6) : 0;
+    fb_field(b, &t, 1, (field->flags & ARROW_FLAG_NULLABLE) ? 1 : 0, 1);
+    fb_field(b, &t, 2, type.type, 1);
+    size_t pos = fb_table_end(b, &t);
+
+    const char* name = field->name ? field->name : "";
+    fb_set_offset(b, name_slot, fb_string_n(b, name, strlen(name)));
+    fb_set_offset(b, type_slot, encode_type(b, &type));
+
+    if (dictionary_slot) {
+        FbTable d;
+        fb_table_begin(b, &d);
+        fb_field(b, &d, 0, (uint64_t)(*next_dictionary_id)++, 8);
+        size_t index_slot = fb_field_offset(b, &d, 1);
+        if (field->flags & ARROW_FLAG_DICTIONARY_ORDERED) fb_field(b, &d, 2, 1, 1);
+        fb_set_offset(b, dictionary_slot, fb_table_end(b, &d));
+        fb_set_offset(b, index_slot, encode_int_type(b, index_type.bit_width, index_type.is_signed));
+    }
+
+    size_t children = fb_offset_vector(b, (size_t)value->n_children);
+    fb_set_offset(b, children_slot, children);
+    for (int64_t i = 0; i < value->n_children; i++) {
+        fb_set_offset(b, children + 4 + 4 * (size_t)i, encode_field(b, value->children[i], next_dictionary_id));
+    }
+
+    if (metadata_slot) encode_metadata(b, metadata_slot, field->metadata);
+    return pos;
+}
+
+static size_t encode_schema(FbBuilder* b, const struct ArrowSchema* schema) {
+    FbTable t;
+    fb_table_begin(b, &t);
+    size_t fields_slot = fb_field_offset(b, &t, 1);
+    size_t metadata_slot = metadata_count(schema->metadata) > 0 ? fb_field_offset(b, &t, 2) : 0;
+    size_t pos = fb_table_end(b, &t);
+
+    int64_t next_dictionary_id = 0;
+    size_t fields = fb_offset_vector(b, (size_t)schema->n_children);
+    fb_set_offset(b, fields_slot, fields);
+    for (int64_t i = 0; i < schema->n_children; i++) {
+        fb_set_offset(b, fields + 4 + 4 * (size_t)i, encode_field(b, schema->children[i], &next_dictionary_id));
+    }
+
+    if (metadata_slot) encode_metadata(b, metadata_slot, schema->metadata);
+    return pos;
+}
+
+/* Start a Message buffer; returns the header slot */
+static size_t encode_message(FbBuilder* b, uint8_t header_type, int64_t body_length) {
+    FbTable t;
+    fb_init(b);
+    fb_table_begin(b, &t);
+    fb_field(b, &t, 3, (uint64_t)body_length, 8);
+    size_t header_slot = fb_field_offset(b, &t, 2);
+    fb_field(b, &t, 0, IPC_METADATA_V5, 2);
+    fb_field(b, &t, 1, header_type, 1);
+    fb_set_root(b, fb_table_end(b, &t));
+    return header_slot;
+}
+
+/* ============================================================================
+ * Record Batch Encoding
+ *
+ * Arrays are written as the logical slice they describe: bitmaps at a bit
+ * offset are shifted, offsets not starting at zero are rebased, and list
+ * children are cut to the referenced range. Everything else is written
+ * straight from the source buffers.
+ * ============================================================================ */
+
+typedef struct {
+    int64_t length;
+    int64_t null_count;
+} BodyNode;
+
+typedef struct {
+    const void* data;
+    int64_t size;
+} BodyBuffer;
+
+typedef struct {
+    BodyNode* nodes;
+    size_t num_nodes;
+    size_t nodes_capacity;
+    BodyBuffer* buffers;
+    size_t num_buffers;
+    size_t buffers_capacity;
+    void** scratch;           /* Shifted bitmaps and rebased offsets */
+    size_t num_scratch;
+    size_t scratch_capacity;
+    int64_t body_length;      /* Sum of padded buffer sizes */
+} BatchBody;
+
+static int64_t padded_size(int64_t size) {
+    return (size + ARROW_IPC_STREAM_ALIGNMENT - 1) & ~(int64_t)(ARROW_IPC_STREAM_ALIGNMENT - 1);
+}
+
+static void batch_body_free(BatchBody* body) {
+    for (size_t i = 0; i < body->num_scratch; i++) free(body->scratch[i]);
+    free(body->scratch);
+    free(body->nodes);
+    free(body->buffers);
+    memset(body, 0, sizeof(BatchBody));
+}
+
+static int body_push_buffer(BatchBody* body, const void* data, int64_t size) {
+    int rc = grow_array((void**)&body->buffers, &body->buffers_capacity, body->num_buffers + 1, sizeof(BodyBuffer));
+    if (rc != ARROW_IPC_OK) return rc;
+    body->buffers[body->num_buffers].data = data;
+    body->buffers[body->num_buffers].size = size;
+    body->num_buffers++;
+    body->body_length += padded_size(size);
+    return ARROW_IPC_OK;
+}
+
+static void* body_scratch(BatchBody* body, size_t size) {
+    if (grow_array((void**)&body->scratch, &body->scratch_capacity, body->num_scratch + 1, sizeof(void*)) != ARROW_IPC_OK) {
+        return NULL;
+    }
+    void* data = calloc(1, size > 0 ? size : 1);
+    if (data) body->scratch[body->num_scratch++] = data;
+    return data;
+}
+
+static int64_t count_nulls(const uint8_t* bitmap, int64_t offset, int64_t length) {
+    int64_t valid = 0;
+    int64_t i = 0;
+    for (; i < length && ((offset + i) & 7) != 0; i++) {
+        valid += (bitmap[(offset + i) >> 3] >> ((offset + i) & 7)) & 1;
+    }
+    for (; i + 8 <= length; i += 8) {
+        valid += __builtin_popcount(bitmap[(offset + i) >> 3]);
+    }
+    for (; i < length; i++) {
+        valid += (bitmap[(offset + i) >> 3] >> ((offset + i) & 7)) & 1;
+    }
+    return length - valid;
+}
+
+/* Bits [offset, offset + length) of a bitmap, shifted to bit 0 if needed */
+static int body_push_bitmap(BatchBody* body, const uint8_t* bitmap, int64_t offset, int64_t length) {
+    if (length == 0) return body_push_buffer(body, NULL, 0);
+    if (!bitmap) return ARROW_IPC_ERR_FORMAT;
+
+    /* Bits past the end are written as zeros, so equal slices render equal
+     * bytes (the dictionary writer compares renderings) */
+    int64_t bytes = (length + 7) / 8;
+    uint8_t tail_mask = (uint8_t)((1u << (length % 8)) - 1);
+    const uint8_t* src = bitmap + offset / 8;
+    if (offset % 8 == 0) {
+        if (tail_mask == 0 || (src[bytes - 1] & ~tail_mask) == 0) return body_push_buffer(body, src, bytes);
+        uint8_t* copy = body_scratch(body, (size_t)bytes);
+        if (!copy) return ARROW_IPC_ERR_ALLOC;
+        memcpy(copy, src, (size_t)bytes);
+        copy[bytes - 1] &= tail_mask;
+        return body_push_buffer(body, copy, bytes);
+    }
+
+    uint8_t* shifted = body_scratch(body, (size_t)bytes);
+    if (!shifted) return ARROW_IPC_ERR_ALLOC;
+    int shift = (int)(offset % 8);
+    int64_t src_bytes = (shift + length + 7) / 8;
+    for (int64_t i = 0; i < bytes; i++) {
+        uint8_t hi = i + 1 < src_bytes ? (uint8_t)(src[i + 1] << (8 - shift)) : 0;
+        shifted[i] = (uint8_t)(src[i] >> shift) | hi;
+    }
+    if (tail_mask != 0) shifted[bytes - 1] &= tail_mask;
+    return body_push_buffer(body, shifted, bytes);
+}
+
+static int64_t offset_at(const void* offsets, int64_t i, int width) {
+    return width == 4 ? ((const int32_t*)offsets)[i] : ((const int64_t*)offsets)[i];
+}
+
+/* Offsets [offset, offset + length], rebased to start at zero */
+static int body_push_offsets(BatchBody* body, const void* offsets, int64_t offset, int64_t length,
+                             int width, int64_t* first, int64_t* last) {
+    *first = *last = 0;
+    if (length == 0) return body_push_buffer(body, ipc_zeros, width);
+    if (!offsets) return ARROW_IPC_ERR_FORMAT;
+
+    *first = offset_at(offsets, offset, width);
+    *last = offset_at(offsets, offset + length, width);
+    if (*first < 0 || *last < *first) return ARROW_IPC_ERR_FORMAT;
+
+    int64_t size = (length + 1) * width;
+    if (*first == 0) return body_push_buffer(body, (const uint8_t*)offsets + offset * width, size);
+
+    void* rebased = body_scratch(body, (size_t)size);
+    if (!rebased) return ARROW_IPC_ERR_ALLOC;
+    for (int64_t i = 0; i <= length; i++) {
+        int64_t value = offset_at(offsets, offset + i, width) - *first;
+        if (width == 4) ((int32_t*)rebased)[i] = (int32_t)value;
+        else ((int64_t*)rebased)[i] = value;
+    }
+    return body_push_buffer(body, rebased, size);
+}
+
+/*
+ * Append the FieldNodes and buffers for elements [start, start + length)
+ * of `array` (relative to its own offset) and its descendants
+ */
+static int plan_array(BatchBody* body, const IPCNodeList* list, size_t* index,
+                      const struct ArrowArray* array, int64_t start, int64_t length) {
+    if (*index >= list->count || !array) return ARROW_IPC_ERR_FORMAT;
+    const IPCNode* node = &list->nodes[(*index)++];
+
+    int n_buffers = layout_buffer_count(node->layout);
+    if (array->n_buffers < n_buffers || (n_buffers > 0 && !array->buffers)) return ARROW_IPC_ERR_FORMAT;
+    if (array->n_children < node->n_children || (node->n_children > 0 && !array->children)) return ARROW_IPC_ERR_FORMAT;
+    if (node->dictionary >= 0 && !array->dictionary) return ARROW_IPC_ERR_FORMAT;
+
+    int64_t offset = array->offset + start;
+    const uint8_t* validity = n_buffers > 0 ? (const uint8_t*)array->buffers[0] : NULL;
+    int64_t null_count = 0;
+    if (node->layout == IPC_LAYOUT_NULL) {
+        null_count = length;
+    } else if (validity && array->null_count != 0) {
+        null_count = start == 0 && length == array->length && array->null_count > 0
+            ? array->null_count
+            : count_nulls(validity, offset, length);
+    }
+
+    int rc = grow_array((void**)&body->nodes, &body->nodes_capacity, body->num_nodes + 1, sizeof(BodyNode));
+    if (rc != ARROW_IPC_OK) return rc;
+    body->nodes[body->num_nodes].length = length;
+    body->nodes[body->num_nodes].null_count = null_count;
+    body->num_nodes++;
+
+    if (node->layout == IPC_LAYOUT_NULL) return ARROW_IPC_OK;
+
+    rc = null_count > 0
+        ? body_push_bitmap(body, validity, offset, length)
+        : body_push_buffer(body, NULL, 0);
+    if (rc != ARROW_IPC_OK) return rc;
+
+    int64_t first, last;
+    switch (node->layout) {
+        case IPC_LAYOUT_BITMAP:
+            return body_push_bitmap(body, array->buffers[1], offset, length);
+
+        case IPC_LAYOUT_FIXED:
+            if (length == 0) return body_push_buffer(body, NULL, 0);
+            if (!array->buffers[1]) return ARROW_IPC_ERR_FORMAT;
+            return body_push_buffer(body, (const uint8_t*)array->buffers[1] + offset * node->byte_width,
+                                    length * node->byte_width);
+
+        case IPC_LAYOUT_BINARY:
+        case IPC_LAYOUT_LARGE_BINARY: {
+            int width = node->layout == IPC_LAYOUT_BINARY ? 4 : 8;
+            rc = body_push_offsets(body, array->buffers[1], offset, length, width, &first, &last);
+            if (rc != ARROW_IPC_OK) return rc;
+            if (last > first && !array->buffers[2]) return ARROW_IPC_ERR_FORMAT;
+            return body_push_buffer(body, last > first ? (const uint8_t*)array->buffers[2] + first : NULL,
+                                    last - first);
+        }
+
+        case IPC_LAYOUT_LIST:
+        case IPC_LAYOUT_LARGE_LIST: {
+            int width = node->layout == IPC_LAYOUT_LIST ? 4 : 8;
+            rc = body_push_offsets(body, array->buffers[1], offset, length, width, &first, &last);
+            if (rc != ARROW_IPC_OK) return rc;
+            return plan_array(body, list, index, array->children[0], first, last - first);
+        }
+
+        case IPC_LAYOUT_FIXED_LIST:
+            return plan_array(body, list, index, array->children[0],
+                              offset * node->byte_width, length * node->byte_width);
+
+        case IPC_LAYOUT_STRUCT:
+            for (int64_t i = 0; i < node->n_children; i++) {
+                rc = plan_array(body, list, index, array->children[i], offset, length);
+                if (rc != ARROW_IPC_OK) return rc;
+            }
+            return ARROW_IPC_OK;
+
+        default:
+            return ARROW_IPC_ERR_FORMAT;
+    }
+}
+
+/* Copy `length` bits from bit `src_pos` of src to bit `dst_pos` of dst (zeroed) */
+static void copy_bits(uint8_t* dst, int64_t dst_pos, const uint8_t* src, int64_t src_pos, int64_t length) {
+    for (int64_t i = 0; i < length; i++) {
+        int64_t from = src_pos + i;
+        int64_t to = dst_pos + i;
+        if (!src || (src[from >> 3] >> (from & 7)) & 1) dst[to >> 3] |= (uint8_t)(1u << (to & 7));
+    }
+}
+
+/* Elements [start, start + length) of one array, as an input of plan_concat */
+typedef struct {
+    const struct ArrowArray* array;
+    int64_t start;            /* Relative to array->offset */
+    int64_t length;
+} ConcatPart;
+
+/*
+ * Like plan_array, for the parts written back to back as a single array.
+ * Every buffer is assembled in scratch memory. Used to merge a dictionary
+ * with its deltas; `parts` come from decode_array, so their buffers have
+ * already been checked against their lengths.
+ */
+static int plan_concat(BatchBody* body, const IPCNodeList* list, size_t* index,
+                       const ConcatPart* parts, size_t n) {
+    if (*index >= list->count) return ARROW_IPC_ERR_FORMAT;
+    const IPCNode* node = &list->nodes[(*index)++];
+
+    int64_t length = 0, null_count = 0;
+    for (size_t k = 0; k < n; k++) {
+        const struct ArrowArray* a = parts[k].array;
+        length += parts[k].length;
+        if (node->layout == IPC_LAYOUT_NULL) {
+            null_count += parts[k].length;
+        } else if (a->null_count != 0 && a->buffers[0]) {
+            null_count += count_nulls(a->buffers[0], a->offset + parts[k].start, parts[k].length);
+        }
+    }
+
+    int rc = grow_array((void**)&body->nodes, &body->nodes_capacity, body->num_nodes + 1, sizeof(BodyNode));
+    if (rc != ARROW_IPC_OK) return rc;
+    body->nodes[body->num_nodes].length = length;
+    body->nodes[body->num_nodes].null_count = null_count;
+    body->num_nodes++;
+    if (node->layout == IPC_LAYOUT_NULL) return ARROW_IPC_OK;
+
+    int64_t bitmap_bytes = (length + 7) / 8;
+    if (null_count > 0) {
+        uint8_t* validity = body_scratch(body, (size_t)bitmap_bytes);
+        if (!validity) return ARROW_IPC_ERR_ALLOC;
+        int64_t pos = 0;
+        for (size_t k = 0; k < n; k++) {
+            const struct ArrowArray* a = parts[k].array;
+            const uint8_t* src = a->null_count != 0 ? a->buffers[0] : NULL;
+            copy_bits(validity, pos, src, a->offset + parts[k].start, parts[k].length);
+            pos += parts[k].length;
+        }
+        rc = body_push_buffer(body, validity, bitmap_bytes);
+    } else {
+        rc = body_push_buffer(body, NULL, 0);
+    }
+    if (rc != ARROW_IPC_OK) return rc;
+
+    /* Child ranges, for nested layouts */
+    ConcatPart* children = NULL;
+    if (node->n_children > 0) {
+        children = malloc(n * sizeof(ConcatPart));
+        if (!children) return ARROW_IPC_ERR_ALLOC;
+    }
+
+    switch (node->layout) {
+        case IPC_LAYOUT_BITMAP: {
+            uint8_t* values = body_scratch(body, (size_t)bitmap_bytes);
+            if (!values) return ARROW_IPC_ERR_ALLOC;
+            int64_t pos = 0;
+            for (size_t k = 0; k < n; k++) {
+                const struct ArrowArray* a = parts[k].array;
+                if (parts[k].length > 0) {
+                    copy_bits(values, pos, a->buffers[1], a->offset + parts[k].start, parts[k].length);
+                }
+                pos += parts[k].length;
+            }
+            return body_push_buffer(body, values, bitmap_bytes);
+        }
+
+        case IPC_LAYOUT_FIXED: {
+            uint8_t* values = body_scratch(body, (size_t)(length * node->byte_width));
+            if (!values) return ARROW_IPC_ERR_ALLOC;
+            int64_t pos = 0;
+            for (size_t k = 0; k < n; k++) {
+                const struct ArrowArray* a = parts[k].array;
+                int64_t bytes = parts[k].length * node->byte_width;
+                if (bytes > 0) {
+                    memcpy(values + pos, (const uint8_t*)a->buffers[1] +
+                           (a->offset + parts[k].start) * node->byte_width, (size_t)bytes);
+                }
+                pos += bytes;
+            }
+            return body_push_buffer(body, values, length * node->byte_width);
+        }
+
+        case IPC_LAYOUT_BINARY:
+        case IPC_LAYOUT_LARGE_BINARY:
+        case IPC_LAYOUT_LIST:
+        case IPC_LAYOUT_LARGE_LIST: {
+            int width = node->layout == IPC_LAYOUT_BINARY || node->layout == IPC_LAYOUT_LIST ? 4 : 8;
+            bool binary = node->layout == IPC_LAYOUT_BINARY || node->layout == IPC_LAYOUT_LARGE_BINARY;
+            void* offsets = body_scratch(body, (size_t)((length + 1) * width));
+            if (!offsets) {
+                free(children);
+                return ARROW_IPC_ERR_ALLOC;
+            }
+
+            /* Rebased offsets; a part's values start where the previous part's end */
+            int64_t pos = 0, total = 0;
+            for (size_t k = 0; k < n; k++) {
+                const struct ArrowArray* a = parts[k].array;
+                int64_t offset = a->offset + parts[k].start;
+                int64_t first = parts[k].length > 0 ? offset_at(a->buffers[1], offset, width) : 0;
+                int64_t last = parts[k].length > 0 ? offset_at(a->buffers[1], offset + parts[k].length, width) : 0;
+                for (int64_t i = 0; i < parts[k].length; i++) {
+                    int64_t value = total + offset_at(a->buffers[1], offset + i, width) - first;
+                    if (width == 4) ((int32_t*)offsets)[pos + i] = (int32_t)value;
+                    else ((int64_t*)offsets)[pos + i] = value;
+                }
+                if (children) {
+                    children[k].array = a->children[0];
+                    children[k].start = first;
+                    children[k].length = last - first;
+                }
+                pos += parts[k].length;
+                total += last - first;
+            }
+            if (width == 4 && total > INT32_MAX) {
+                free(children);
+                return ARROW_IPC_ERR_UNSUPPORTED;
+            }
+            if (width == 4) ((int32_t*)offsets)[length] = (int32_t)total;
+            else ((int64_t*)offsets)[length] = total;
+            rc = body_push_buffer(body, offsets, (length + 1) * width);
+            if (rc != ARROW_IPC_OK || !binary) break;
+
+            uint8_t* data = body_scratch(body, (size_t)total);
+            if (!data) return ARROW_IPC_ERR_ALLOC;
+            int64_t data_pos = 0;
+            for (size_t k = 0; k < n; k++) {
+                const struct ArrowArray* a = parts[k].array;
+                if (parts[k].length == 0) continue;
+                int64_t offset = a->offset + parts[k].start;
+                int64_t first = offset_at(a->buffers[1], offset, width);
+                int64_t last = offset_at(a->buffers[1], offset + parts[k].length, width);
+                if (last > first) memcpy(data + data_pos, (const uint8_t*)a->buffers[2] + first, (size_t)(last - first));
+                data_pos += last - first;
+            }
+            return body_push_buffer(body, data, total);
+        }
+
+        case IPC_LAYOUT_FIXED_LIST:
+            for (size_t k = 0; k < n; k++) {
+                const struct ArrowArray* a = parts[k].array;
+                children[k].array = a->children[0];
+                children[k].start = (a->offset + parts[k].start) * node->byte_width;
+                children[k].length = parts[k].length * node->byte_width;
+            }
+            break;
+
+        case IPC_LAYOUT_STRUCT:
+            for (int64_t i = 0; i < node->n_children && rc == ARROW_IPC_OK; i++) {
+                for (size_t k = 0; k < n; k++) {
+                    const struct ArrowArray* a = parts[k].array;
+                    children[k].array = a->children[i];
+                    children[k].start = a->offset + parts[k].start;
+                    children[k].length = parts[k].length;
+                }
+                rc = plan_concat(body, list, index, children, n);
+            }
+            free(children);
+            return rc;
+
+        default:
+            free(children);
+            return ARROW_IPC_ERR_FORMAT;
+    }
+
+    /* Lists: the single child */
+    if (rc == ARROW_IPC_OK) rc = plan_concat(body, list, index, children, n);
+    free(children);
+    return rc;
+}
+
+/*
+ * Rewrite every non-empty buffer in BodyCompression form: int64
+ * uncompressed length (-1 when stored as is) followed by the bytes
+ */
+static int body_compress(BatchBody* body, ArrowIPCCodec* codec, size_t min_compress_size) {
+    body->body_length = 0;
+    for (size_t i = 0; i < body->num_buffers; i++) {
+        BodyBuffer* buffer = &body->buffers[i];
+        size_t size = (size_t)buffer->size;
+        if (size > 0) {
+            size_t bound = size >= min_compress_size ? arrow_ipc_codec_bound(codec, size) : 0;
+            uint8_t* out = body_scratch(body, 8 + (bound > size ? bound : size));
+            if (!out) return ARROW_IPC_ERR_ALLOC;
+
+            size_t compressed = 0;
+            if (bound > 0 && arrow_ipc_codec_compress(codec, buffer->data, size, out + 8, bound,
+                                                      &compressed) == ARROW_IPC_OK && compressed < size) {
+                put_le(out, size, 8);
+                buffer->size = (int64_t)(8 + compressed);
+            } else {
+                put_le(out, UINT64_MAX, 8);
+                memcpy(out + 8, buffer->data, size);
+                buffer->size = (int64_t)(8 + size);
+            }
+            buffer->data = out;
+        }
+        body->body_length += padded_size(buffer->size);
+    }
+    return ARROW_IPC_OK;
+}
+
+static size_t encode_record_batch(FbBuilder* b, int64_t length, const BatchBody* body,
+                                  ArrowIPCCompression compression) {
+    FbTable t;
+    fb_table_begin(b, &t);
+    fb_field(b, &t, 0, (uint64_t)length, 8);
+    size_t nodes_slot = fb_field_offset(b, &t, 1);
+    size_t buffers_slot = fb_field_offset(b, &t, 2);
+    size_t compression_slot = compression != ARROW_IPC_COMPRESSION_NONE ? fb_field_offset(b, &t, 3) : 0;
+    size_t pos = fb_table_end(b, &t);
+
+    if (compression != ARROW_IPC_COMPRESSION_NONE) {
+        FbTable c;
+        fb_table_begin(b, &c);
+        fb_field(b, &c, 0, compression == ARROW_IPC_COMPRESSION_ZSTD ? IPC_CODEC_ZSTD : IPC_CODEC_LZ4_FRAME, 1);
+        fb_field(b, &c, 1, 0, 1);  /* BodyCompressionMethod.BUFFER */
+        fb_set_offset(b, compression_slot, fb_table_end(b, &c));
+    }
+
+    fb_set_offset(b, nodes_slot, fb_vector_begin(b, body->num_nodes, 8));
+    for (size_t i = 0; i < body->num_nodes; i++) {
+        fb_put(b, (uint64_t)body->nodes[i].length, 8);
+        fb_put(b, (uint64_t)body->nodes[i].null_count, 8);
+    }
+
+    fb_set_offset(b, buffers_slot, fb_vector_begin(b, body->num_buffers, 8));
+    int64_t offset = 0;
+    for (size_t i = 0; i < body->num_buffers; i++) {
+        fb_put(b, (uint64_t)offset, 8);
+        fb_put(b, (uint64_t)body->buffers[i].size, 8);
+        offset += padded_size(body->buffers[i].size);
+    }
+    return pos;
+}
+
+/* ============================================================================
+ * Writer
+ * ============================================================================ */
+
+typedef struct {
+    int64_t offset;           /* Start of the message (its continuation marker) */
+    int32_t metadata_length;  /* Prefix + flatbuffer + padding */
+    int64_t body_length;
+} IPCBlock;
+
+typedef struct {
+    IPCBlock* items;
+    size_t count;
+    size_t capacity;
+} IPCBlockList;
+
+typedef struct {
+    IPCNodeList nodes;        /* Flattened value type */
+    ArrowIPCBuffer last;      /* Whole dictionary as last written (not as a delta) */
+    int64_t length;           /* Entries in `last` */
+    bool written;
+} WriterDictionary;
+
+struct ArrowIPCStreamWriter {
+    ArrowIPCFormat format;
+    ArrowIPCWriteFn write;
+    void* ctx;
+    int fd;                   /* >= 0: write to this descriptor with writev instead */
+    int64_t position;         /* Bytes written so far */
+    IPCNodeList nodes;        /* Flattened columns */
+    int64_t num_columns;
+    WriterDictionary* dictionaries;
+    size_t num_dictionaries;
+
+    /* File format: footer built up front, block vectors added on finish */
+    FbBuilder footer;
+    size_t dictionaries_slot;
+    size_t batches_slot;
+    IPCBlockList dictionary_blocks;
+    IPCBlockList batch_blocks;
+    bool finished;
+
+    ArrowIPCCodec codec;      /* ARROW_IPC_COMPRESSION_NONE: uncompressed bodies */
+    size_t min_compress_size;
+    bool emit_deltas;
+};
+
+static int buffer_write_fn(void* ctx, const void* data, size_t len) {
+    return arrow_ipc_buffer_write((ArrowIPCBuffer*)ctx, data, len) == ARROW_IPC_OK ? 0 : -1;
+}
+
+/* Pieces of one message, in output order */
+typedef struct {
+    struct iovec* items;
+    size_t count;
+    size_t capacity;
+} IPCSegments;
+
+static int segments_push(IPCSegments* segs, const void* data, size_t len) {
+    if (len == 0) return ARROW_IPC_OK;
+    int rc = grow_array((void**)&segs->items, &segs->capacity, segs->count + 1, sizeof(struct iovec));
+    if (rc != ARROW_IPC_OK) return rc;
+    segs->items[segs->count].iov_base = (void*)data;
+    segs->items[segs->count].iov_len = len;
+    segs->count++;
+    return ARROW_IPC_OK;
+}
+
+/* write(2) all of `len` bytes, retrying short writes and EINTR */
+static int fd_write_all(int fd, const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return ARROW_IPC_ERR_IO;
+        p += n;
+        len -= (size_t)n;
+    }
+    return ARROW_IPC_OK;
+}
+
+/* writev(2) every segment, IOV_MAX at a time. Consumes `segs`. */
+static int fd_writev_all(int fd, IPCSegments* segs) {
+    struct iovec* iov = segs->items;
+    size_t remaining = segs->count;
+    while (remaining > 0) {
+        int count = remaining > IOV_MAX ? IOV_MAX : (int)remaining;
+        ssize_t n = writev(fd, iov, count);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return ARROW_IPC_ERR_IO;
+
+        /* Skip what was written; a short write leaves a partial segment */
+        size_t written = (size_t)n;
+        while (remaining > 0 && written >= iov->iov_len) {
+            written -= iov->iov_len;
+            iov++;
+            remaining--;
+        }
+        if (remaining > 0) {
+            iov->iov_base = (uint8_t*)iov->iov_base + written;
+            iov->iov_len -= written;
+        }
+    }
+    return ARROW_IPC_OK;
+}
+
+static int writer_emit(ArrowIPCStreamWriter* w, const void* data, size_t len) {
+    if (len == 0) return ARROW_IPC_OK;
+    if (w->fd >= 0) {
+        if (fd_write_all(w->fd, data, len) != ARROW_IPC_OK) return ARROW_IPC_ERR_IO;
+    } else if (w->write(w->ctx, data, len) != 0) {
+        return ARROW_IPC_ERR_IO;
+    }
+    w->position += (int64_t)len;
+    return ARROW_IPC_OK;
+}
+
+/*
+ * Lay out an encapsulated message starting at stream offset `position` as
+ * segments pointing at the metadata and the body buffers. The metadata is
+ * padded so the body starts on an ARROW_IPC_STREAM_ALIGNMENT boundary of
+ * the stream. `prefix` must outlive the segments.
+ */
+static int message_segments(int64_t position, const FbBuilder* meta, const BatchBody* body,
+                            uint8_t prefix[8], IPCSegments* segs, IPCBlock* block) {
+    if (meta->error) return meta->error;
+
+    size_t fb_size = meta->buf.size;
+    size_t unpadded = (size_t)position + 8 + fb_size;
+    size_t padding = (ARROW_IPC_STREAM_ALIGNMENT - unpadded % ARROW_IPC_STREAM_ALIGNMENT) % ARROW_IPC_STREAM_ALIGNMENT;
+    if (fb_size + padding > INT32_MAX) return ARROW_IPC_ERR_FORMAT;
+
+    put_le(prefix, ARROW_IPC_CONTINUATION, 4);
+    put_le(prefix + 4, (uint32_t)(fb_size + padding), 4);
+
+    block->offset = position;
+    block->metadata_length = (int32_t)(8 + fb_size + padding);
+    block->body_length = body ? body->body_length : 0;
+
+    int rc = segments_push(segs, prefix, 8);
+    if (rc == ARROW_IPC_OK) rc = segments_push(segs, meta->buf.data, fb_size);
+    if (rc == ARROW_IPC_OK) rc = segments_push(segs, ipc_zeros, padding);
+
+    for (size_t i = 0; body && i < body->num_buffers && rc == ARROW_IPC_OK; i++) {
+        size_t size = (size_t)body->buffers[i].size;
+        size_t pad = (size_t)(padded_size(body->buffers[i].size) - body->buffers[i].size);
+        rc = segments_push(segs, body->buffers[i].data, size);
+        if (rc == ARROW_IPC_OK) rc = segments_push(segs, ipc_zeros, pad);
+    }
+    return rc;
+}
+
+/* Write an encapsulated message through a write hook */
+static int emit_message(ArrowIPCWriteFn write, void* ctx, int64_t position,
+                        const FbBuilder* meta, const BatchBody* body, IPCBlock* block) {
+    uint8_t prefix[8];
+    IPCSegments segs;
+    memset(&segs, 0, sizeof(IPCSegments));
+    int rc = message_segments(position, meta, body, prefix, &segs, block);
+    for (size_t i = 0; i < segs.count && rc == ARROW_IPC_OK; i++) {
+        if (write(ctx, segs.items[i].iov_base, segs.items[i].iov_len) != 0) rc = ARROW_IPC_ERR_IO;
+    }
+    free(segs.items);
+    return rc;
+}
+
+static int writer_message(ArrowIPCStreamWriter* w, const FbBuilder* meta, const BatchBody* body, IPCBlockList* blocks) {
+    IPCBlock block;
+    uint8_t prefix[8];
+    IPCSegments segs;
+    memset(&segs, 0, sizeof(IPCSegments));
+
+    /* A descriptor gets the whole message in one gathered write */
+    int rc = message_segments(w->position, meta, body, prefix, &segs, &block);
+    if (rc == ARROW_IPC_OK && w->fd >= 0) {
+        rc = fd_writev_all(w->fd, &segs);
+        if (rc == ARROW_IPC_OK) w->position = block.offset + block.metadata_length + block.body_length;
+    } else {
+        for (size_t i = 0; i < segs.count && rc == ARROW_IPC_OK; i++) {
+            rc = writer_emit(w, segs.items[i].iov_base, segs.items[i].iov_len);
+        }
+    }
+    free(segs.items);
+    if (rc != ARROW_IPC_OK || !blocks || w->format != ARROW_IPC_FORMAT_FILE) return rc;
+
+    rc = grow_array((void**)&blocks->items, &blocks->capacity, blocks->count + 1, sizeof(IPCBlock));
+    if (rc != ARROW_IPC_OK) return rc;
+    blocks->items[blocks->count++] = block;
+    return ARROW_IPC_OK;
+}
+
+/* Find the dictionary arrays referenced by a batch, by dictionary index */
+static int collect_dictionaries(const IPCNodeList* list, size_t* index, const struct ArrowArray* array,
+                                const struct ArrowArray** found) {
+    if (*index >= list->count || !array) return ARROW_IPC_ERR_FORMAT;
+    const IPCNode* node = &list->nodes[(*index)++];
+    if (node->dictionary >= 0) {
+        if (!array->dictionary) return ARROW_IPC_ERR_FORMAT;
+        found[node->dictionary] = array->dictionary;
+    }
+    if (node->n_children > 0 && (array->n_children < node->n_children || !array->children)) return ARROW_IPC_ERR_FORMAT;
+    for (int64_t i = 0; i < node->n_children; i++) {
+        int rc = collect_dictionaries(list, index, array->children[i], found);
+        if (rc != ARROW_IPC_OK) return rc;
+    }
+    return ARROW_IPC_OK;
+}
+
+/*
+ * Render the DictionaryBatch for elements [start, start + length) of
+ * dictionary `d` into `bytes`. After the schema every message starts
+ * aligned, so the bytes do not depend on where the message lands and can
+ * be compared with earlier renderings.
+ */
+static int render_dictionary(ArrowIPCStreamWriter* w, size_t d, const struct ArrowArray* values,
+                             int64_t start, int64_t length, bool is_delta,
+                             ArrowIPCBuffer* bytes, IPCBlock* block) {
+    WriterDictionary* dict = &w->dictionaries[d];
+    BatchBody body;
+    memset(&body, 0, sizeof(BatchBody));
+    FbBuilder meta;
+    memset(&meta, 0, sizeof(FbBuilder));
+
+    size_t value_index = 0;
+    int rc = plan_array(&body, &dict->nodes, &value_index, values, start, length);
+    if (rc == ARROW_IPC_OK && w->codec.compression != ARROW_IPC_COMPRESSION_NONE) {
+        rc = body_compress(&body, &w->codec, w->min_compress_size);
+    }
+    if (rc == ARROW_IPC_OK) {
+        size_t header_slot = encode_message(&meta, IPC_MESSAGE_DICTIONARY_BATCH, body.body_length);
+        FbTable t;
+        fb_table_begin(&meta, &t);
+        fb_field(&meta, &t, 0, (uint64_t)d, 8);
+        size_t data_slot = fb_field_offset(&meta, &t, 1);
+        if (is_delta) fb_field(&meta, &t, 2, 1, 1);
+        fb_set_offset(&meta, header_slot, fb_table_end(&meta, &t));
+        fb_set_offset(&meta, data_slot, encode_record_batch(&meta, length, &body, w->codec.compression));
+        rc = emit_message(buffer_write_fn, bytes, w->position, &meta, &body, block);
+    }
+
+    arrow_ipc_buffer_free(&meta.buf);
+    batch_body_free(&body);
+    return rc;
+}
+
+/* Write a rendered DictionaryBatch and record its block in the file footer */
+static int emit_dictionary(ArrowIPCStreamWriter* w, const ArrowIPCBuffer* bytes, const IPCBlock* block) {
+    int rc = writer_emit(w, bytes->data, bytes->size);
+    if (rc != ARROW_IPC_OK || w->format != ARROW_IPC_FORMAT_FILE) return rc;
+    rc = grow_array((void**)&w->dictionary_blocks.items, &w->dictionary_blocks.capacity,
+                    w->dictionary_blocks.count + 1, sizeof(IPCBlock));
+    if (rc == ARROW_IPC_OK) w->dictionary_blocks.items[w->dictionary_blocks.count++] = *block;
+    return rc;
+}
+
+/*
+ * With deltas enabled, a dictionary whose first entries are the ones
+ * already written only sends the new entries (isDelta). Otherwise the
+ * stream format replaces it; the file format cannot.
+ */
+static int write_dictionary(ArrowIPCStreamWriter* w, size_t d, const struct ArrowArray* values) {
+    WriterDictionary* dict = &w->dictionaries[d];
+    ArrowIPCBuffer bytes, prefix, delta;
+    arrow_ipc_buffer_init(&bytes);
+    arrow_ipc_buffer_init(&prefix);
+    arrow_ipc_buffer_init(&delta);
+    IPCBlock block;
+
+    int rc = render_dictionary(w, d, values, 0, values->length, false, &bytes, &block);
+    bool unchanged = rc == ARROW_IPC_OK && dict->written && dict->last.size == bytes.size &&
+                     memcmp(dict->last.data, bytes.data, bytes.size) == 0;
+    if (rc != ARROW_IPC_OK || unchanged) goto done;
+
+    bool grown = false;
+    if (dict->written && w->emit_deltas && values->length > dict->length) {
+        IPCBlock prefix_block;
+        rc = render_dictionary(w, d, values, 0, dict->length, false, &prefix, &prefix_block);
+        grown = rc == ARROW_IPC_OK && prefix.size == dict->last.size &&
+                memcmp(prefix.data, dict->last.data, prefix.size) == 0;
+    }
+
+    if (rc != ARROW_IPC_OK) {
+        goto done;
+    } else if (grown) {
+        rc = render_dictionary(w, d, values, dict->length, values->length - dict->length, true, &delta, &block);
+        if (rc == ARROW_IPC_OK) rc = emit_dictionary(w, &delta, &block);
+    } else if (dict->written && w->format == ARROW_IPC_FORMAT_FILE) {
+        rc = ARROW_IPC_ERR_UNSUPPORTED;  /* Files cannot replace dictionaries */
+    } else {
+        rc = emit_dictionary(w, &bytes, &block);
+    }
+
+    if (rc == ARROW_IPC_OK) {
+        /* Compare later batches against the whole dictionary */
+        arrow_ipc_buffer_free(&dict->last);
+        dict->last = bytes;
+        dict->length = values->length;
+        dict->written = true;
+        arrow_ipc_buffer_init(&bytes);
+    }
+
+done:
+    arrow_ipc_buffer_free(&bytes);
+    arrow_ipc_buffer_free(&prefix);
+    arrow_ipc_buffer_free(&delta);
+    return rc;
+}
+
+/* Emit a DictionaryBatch for every dictionary that differs from the last one written */
+static int write_dictionaries(ArrowIPCStreamWriter* w, const struct ArrowArray* batch) {
+    if (w->num_dictionaries == 0) return ARROW_IPC_OK;
+
+    const struct ArrowArray** found = calloc(w->num_dictionaries, sizeof(struct ArrowArray*));
+    if (!found) return ARROW_IPC_ERR_ALLOC;
+
+    size_t index = 0;
+    int rc = ARROW_IPC_OK;
+    for (int64_t i = 0; i < w->num_columns && rc == ARROW_IPC_OK; i++) {
+        rc = collect_dictionaries(&w->nodes, &index, batch->children[i], found);
+    }
+    for (size_t d = 0; d < w->num_dictionaries && rc == ARROW_IPC_OK; d++) {
+        rc = found[d] ? write_dictionary(w, d, found[d]) : ARROW_IPC_ERR_FORMAT;
+    }
+
+    free(found);
+    return rc;
+}
+
+void arrow_ipc_stream_writer_free(ArrowIPCStreamWriter* writer) {
+    if (!writer) return;
+    node_list_free(&writer->nodes);
+    for (size_t i = 0; i < writer->num_dictionaries; i++) {
+        node_list_free(&writer->dictionaries[i].nodes);
+        arrow_ipc_buffer_free(&writer->dictionaries[i].last);
+    }
+    free(writer->dictionaries);
+    arrow_ipc_buffer_free(&writer->footer.buf);
+    free(writer->dictionary_blocks.items);
+    free(writer->batch_blocks.items);
+    arrow_ipc_codec_free(&writer->codec);
+    free(writer);
+}
+
+/* Create a writer that outputs through `write` or, if fd >= 0, to `fd` */
+static int writer_create(
+    const struct ArrowSchema* schema,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    ArrowIPCWriteFn write,
+    void* ctx,
+    int fd,
+    ArrowIPCStreamWriter** out_writer
+) {
+    *out_writer = NULL;
+
+    ArrowIPCStreamWriter* w = calloc(1, sizeof(ArrowIPCStreamWriter));
+    if (!w) return ARROW_IPC_ERR_ALLOC;
+    w->format = format;
+    w->write = write;
+    w->ctx = ctx;
+    w->fd = fd;
+    w->num_columns = schema->n_children;
+    arrow_ipc_buffer_init(&w->footer.buf);
+
+    FbBuilder meta;
+    memset(&meta, 0, sizeof(FbBuilder));
+    IPCSchemaList dictionaries;
+    memset(&dictionaries, 0, sizeof(IPCSchemaList));
+
+    ArrowIPCWriteOptions defaults;
+    arrow_ipc_write_options_init(&defaults);
+    if (!options) options = &defaults;
+    w->min_compress_size = options->min_compress_size;
+    w->emit_deltas = options->emit_dictionary_deltas != 0;
+    int rc = arrow_ipc_codec_init(&w->codec, options->compression, options->level);
+    if (rc != ARROW_IPC_OK) goto error;
+
+    rc = flatten_columns(schema, &w->nodes, &dictionaries);
+    if (rc != ARROW_IPC_OK) goto error;
+
+    if (dictionaries.count > 0) {
+        w->dictionaries = calloc(dictionaries.count, sizeof(WriterDictionary));
+        if (!w->dictionaries) {
+            rc = ARROW_IPC_ERR_ALLOC;
+            goto error;
+        }
+        w->num_dictionaries = dictionaries.count;
+        for (size_t i = 0; i < dictionaries.count; i++) {
+            arrow_ipc_buffer_init(&w->dictionaries[i].last);
+            rc = flatten_schema(dictionaries.schemas[i], &w->dictionaries[i].nodes, NULL);
+            if (rc != ARROW_IPC_OK) goto error;
+        }
+    }
+
+    size_t header_slot = encode_message(&meta, IPC_MESSAGE_SCHEMA, 0);
+    fb_set_offset(&meta, header_slot, encode_schema(&meta, schema));
+    if (meta.error) {
+        rc = meta.error;
+        goto error;
+    }
+
+    if (format == ARROW_IPC_FORMAT_FILE) {
+        FbTable t;
+        fb_init(&w->footer);
+        fb_table_begin(&w->footer, &t);
+        size_t schema_slot = fb_field_offset(&w->footer, &t, 1);
+        w->dictionaries_slot = fb_field_offset(&w->footer, &t, 2);
+        w->batches_slot = fb_field_offset(&w->footer, &t, 3);
+        fb_field(&w->footer, &t, 0, IPC_METADATA_V5, 2);
+        fb_set_root(&w->footer, fb_table_end(&w->footer, &t));
+        fb_set_offset(&w->footer, schema_slot, encode_schema(&w->footer, schema));
+        if (w->footer.error) {
+            rc = w->footer.error;
+            goto error;
+        }
+
+        /* Magic padded to 8 bytes */
+        uint8_t magic[8] = {0};
+        memcpy(magic, ARROW_IPC_FILE_MAGIC, ARROW_IPC_FILE_MAGIC_SIZE);
+        rc = writer_emit(w, magic, sizeof(magic));
+        if (rc != ARROW_IPC_OK) goto error;
+    }
+
+    rc = writer_message(w, &meta, NULL, NULL);
+    if (rc != ARROW_IPC_OK) goto error;
+
+    arrow_ipc_buffer_free(&meta.buf);
+    free(dictionaries.schemas);
+    *out_writer = w;
+    return ARROW_IPC_OK;
+
+error:
+    arrow_ipc_buffer_free(&meta.buf);
+    free(dictionaries.schemas);
+    arrow_ipc_stream_writer_free(w);
+    return rc;
+}
+
+int arrow_ipc_stream_writer_create(
+    const struct ArrowSchema* schema,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    ArrowIPCWriteFn write,
+    void* ctx,
+    ArrowIPCStreamWriter** out_writer
+) {
+    if (!schema || !write || !out_writer) return ARROW_IPC_ERR_NULL;
+    return writer_create(schema, format, options, write, ctx, -1, out_writer);
+}
+
+int arrow_ipc_stream_writer_create_fd(
+    const struct ArrowSchema* schema,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    int fd,
+    ArrowIPCStreamWriter** out_writer
+) {
+    if (!schema || fd < 0 || !out_writer) return ARROW_IPC_ERR_NULL;
+    return writer_create(schema, format, options, NULL, NULL, fd, out_writer);
+}
+
+int arrow_ipc_stream_writer_write_batch(
+    ArrowIPCStreamWriter* writer,
+    const struct ArrowArray* batch
+) {
+    if (!writer || !batch) return ARROW_IPC_ERR_NULL;
+    if (writer->finished) return ARROW_IPC_ERR_FORMAT;
+    if (batch->n_children != writer->num_columns || (batch->n_children > 0 && !batch->children)) {
+        return ARROW_IPC_ERR_FORMAT;
+    }
+
+    int rc = write_dictionaries(writer, batch);
+    if (rc != ARROW_IPC_OK) return rc;
+
+    BatchBody body;
+    memset(&body, 0, sizeof(BatchBody));
+    size_t index = 0;
+    for (int64_t i = 0; i < batch->n_children && rc == ARROW_IPC_OK; i++) {
+        /* Columns share the batch's offset like struct children */
+        rc = plan_array(&body, &writer->nodes, &index, batch->children[i], batch->offset, batch->length);
+    }
+    if (rc == ARROW_IPC_OK && writer->codec.compression != ARROW_IPC_COMPRESSION_NONE) {
+        rc = body_compress(&body, &writer->codec, writer->min_compress_size);
+    }
+
+    FbBuilder meta;
+    memset(&meta, 0, sizeof(FbBuilder));
+    if (rc == ARROW_IPC_OK) {
+        size_t header_slot = encode_message(&meta, IPC_MESSAGE_RECORD_BATCH, body.body_length);
+        fb_set_offset(&meta, header_slot, encode_record_batch(&meta, batch->length, &body,
+                                                                   writer->codec.compression));
+        rc = writer_message(writer, &meta, &body, &writer->batch_blocks);
+    }
+
+    arrow_ipc_buffer_free(&meta.buf);
+    batch_body_free(&body);
+    return rc;
+}
+
+static void footer_blocks(FbBuilder* b, size_t slot, const IPCBlockList* blocks) {
+    fb_set_offset(b, slot, fb_vector_begin(b, blocks->count, 8));
+    for (size_t i = 0; i < blocks->count; i++) {
+        fb_put(b, (uint64_t)blocks->items[i].offset, 8);
+        fb_put(b, (uint32_t)blocks->items[i].metadata_length, 4);
+        fb_put(b, 0, 4);
+        fb_put(b, (uint64_t)blocks->items[i].body_length, 8);
+    }
+}
+
+int arrow_ipc_stream_writer_finish(ArrowIPCStreamWriter* writer) {
+    if (!writer) return ARROW_IPC_ERR_NULL;
+    if (writer->finished) return ARROW_IPC_OK;
+
+    uint8_t eos[8];
+    put_le(eos, ARROW_IPC_CONTINUATION, 4);
+    put_le(eos + 4, 0, 4);
+    int rc = writer_emit(writer, eos, sizeof(eos));
+    if (rc != ARROW_IPC_OK) return rc;
+
+    if (writer->format == ARROW_IPC_FORMAT_FILE) {
+        FbBuilder* footer = &writer->footer;
+        footer_blocks(footer, writer->dictionaries_slot, &writer->dictionary_blocks);
+        footer_blocks(footer, writer->batches_slot, &writer->batch_blocks);
+        if (footer->error) return footer->error;
+        if (footer->buf.size > INT32_MAX) return ARROW_IPC_ERR_FORMAT;
+
+        uint8_t trailer[4 + ARROW_IPC_FILE_MAGIC_SIZE];
+        put_le(trailer, (uint32_t)footer->buf.size, 4);
+        memcpy(trailer + 4, ARROW_IPC_FILE_MAGIC, ARROW_IPC_FILE_MAGIC_SIZE);
+        rc = writer_emit(writer, footer->buf.data, footer->buf.size);
+        if (rc == ARROW_IPC_OK) rc = writer_emit(writer, trailer, sizeof(trailer));
+        if (rc != ARROW_IPC_OK) return rc;
+    }
+
+    writer->finished = true;
+    return ARROW_IPC_OK;
+}
+
+/* ============================================================================
+ * Schema Decoding
+ * ============================================================================ */
+
+typedef struct {
+    int64_t* ids;
+    size_t count;
+    size_t capacity;
+} IPCIdList;
+
+static void release_ipc_schema(struct ArrowSchema* schema) {
+    if (!schema || !schema->release) return;
+
+    free((void*)schema->format);
+    free((void*)schema->name);
+    free((void*)schema->metadata);
+    for (int64_t i = 0; i < schema->n_children; i++) {
+        struct ArrowSchema* child = schema->children ? schema->children[i] : NULL;
+        if (!child) continue;
+        if (child->release) child->release(child);
+        free(child);
+    }
+    free(schema->children);
+    if (schema->dictionary) {
+        if (schema->dictionary->release) schema->dictionary->release(schema->dictionary);
+        free(schema->dictionary);
+    }
+    schema->release = NULL;
+}
+
+static char* copy_string(const char* data, size_t len) {
+    char* copy = malloc(len + 1);
+    if (!copy) return NULL;
+    if (len) memcpy(copy, data, len);
+    copy[len] = '\0';
+    return copy;
+}
+
+/* KeyValue vector field `id` as C data interface metadata (NULL if absent) */
+static int decode_metadata(const FbRef* table, int id, char** out) {
+    size_t elems, count;
+    *out = NULL;
+    if (!fb_vector(table, id, 4, &elems, &count)) return ARROW_IPC_ERR_FORMAT;
+    if (count == 0) return ARROW_IPC_OK;
+    if (count > INT32_MAX) return ARROW_IPC_ERR_FORMAT;
+
+    /* Two passes: size, then fill */
+    size_t total = 4;
+    for (int pass = 0; pass < 2; pass++) {
+        uint8_t* p = NULL;
+        if (pass == 1) {
+            *out = malloc(total);
+            if (!*out) return ARROW_IPC_ERR_ALLOC;
+            p = (uint8_t*)*out;
+            int32_t n = (int32_t)count;
+            memcpy(p, &n, 4);
+            p += 4;
+        }
+        for (size_t i = 0; i < count; i++) {
+            FbRef kv;
+            const char* strings[2];
+            size_t lens[2];
+            if (!fb_vector_table(table, elems, i, &kv) ||
+                !fb_string(&kv, 0, &strings[0], &lens[0]) ||
+                !fb_string(&kv, 1, &strings[1], &lens[1])) {
+                free(*out);
+                *out = NULL;
+                return ARROW_IPC_ERR_FORMAT;
+            }
+            for (int s = 0; s < 2; s++) {
+                if (lens[s] > INT32_MAX) {
+                    free(*out);
+                    *out = NULL;
+                    return ARROW_IPC_ERR_FORMAT;
+                }
+                if (pass == 0) {
+                    total += 4 + lens[s];
+                } else {
+                    int32_t len = (int32_t)lens[s];
+                    memcpy(p, &len, 4);
+                    if (len) memcpy(p + 4, strings[s], lens[s]);
+                    p += 4 + lens[s];
+                }
+            }
+        }
+    }
+    return ARROW_IPC_OK;
+}
+
+static int decode_int_type(const FbRef* table, IPCType* type) {
+    memset(type, 0, sizeof(IPCType));
+    type->type = IPC_TYPE_INT;
+    type->bit_width = (int32_t)fb_int(table, 0, 4, 0);
+    type->is_signed = fb_int(table, 1, 1, 0) != 0;
+    return ARROW_IPC_OK;
+}
+
+/* Type union of a Field (type_type = field 2, type = field 3) */
+static int decode_type(const FbRef* field, IPCType* type) {
+    FbRef t;
+    memset(&t, 0, sizeof(FbRef));  /* A missing table reads as all defaults */
+    fb_table(field, 3, &t);
+
+    memset(type, 0, sizeof(IPCType));
+    type->type = (uint8_t)fb_int(field, 2, 1, 0);
+    switch (type->type) {
+        case IPC_TYPE_INT:
+            return decode_int_type(&t, type);
+        case IPC_TYPE_FLOAT:
+            type->unit = (int16_t)fb_int(&t, 0, 2, 0);
+            break;
+        case IPC_TYPE_DECIMAL:
+            type->precision = (int32_t)fb_int(&t, 0, 4, 0);
+            type->scale = (int32_t)fb_int(&t, 1, 4, 0);
+            type->bit_width = (int32_t)fb_int(&t, 2, 4, 128);
+            break;
+        case IPC_TYPE_DATE:
+            type->unit = (int16_t)fb_int(&t, 0, 2, 1);
+            break;
+        case IPC_TYPE_TIME:
+            type->unit = (int16_t)fb_int(&t, 0, 2, 1);
+            type->bit_width = (int32_t)fb_int(&t, 1, 4, 32);
+            break;
+        case IPC_TYPE_TIMESTAMP:
+            type->unit = (int16_t)fb_int(&t, 0, 2, 0);
+            if (t.buf && !fb_string(&t, 1, &type->timezone, &type->timezone_len)) return ARROW_IPC_ERR_FORMAT;
+            break;
+        case IPC_TYPE_DURATION:
+            type->unit = (int16_t)fb_int(&t, 0, 2, 1);
+            break;
+        case IPC_TYPE_INTERVAL:
+            type->unit = (int16_t)fb_int(&t, 0, 2, 0);
+            break;
+        case IPC_TYPE_FIXED_BINARY:
+        case IPC_TYPE_FIXED_LIST:
+            type->width = (int32_t)fb_int(&t, 0, 4, 0);
+            break;
+        case IPC_TYPE_MAP:
+            type->keys_sorted = fb_int(&t, 0, 1, 0) != 0;
+            break;
+        case IPC_TYPE_NULL:
+        case IPC_TYPE_BOOL:
+        case IPC_TYPE_BINARY:
+        case IPC_TYPE_UTF8:
+        case IPC_TYPE_LARGE_BINARY:
+        case IPC_TYPE_LARGE_UTF8:
+        case IPC_TYPE_LIST:
+        case IPC_TYPE_LARGE_LIST:
+        case IPC_TYPE_STRUCT:
+            break;
+        default:
+            return ARROW_IPC_ERR_UNSUPPORTED;
+    }
+    return ARROW_IPC_OK;
+}
+
+static int decode_field(const FbRef* field, struct ArrowSchema* out, IPCIdList* dictionary_ids);
+
+/* Children vector (field 5) of a Field into `out` */
+static int decode_children(const FbRef* field, const IPCType* type, struct ArrowSchema* out, IPCIdList* dictionary_ids) {
+    size_t elems, count;
+    if (!fb_vector(field, 5, 4, &elems, &count)) return ARROW_IPC_ERR_FORMAT;
+    int64_t expected = type_child_count(type);
+    if (expected >= 0 && (int64_t)count != expected) return ARROW_IPC_ERR_FORMAT;
+    if (count == 0) return ARROW_IPC_OK;
+
+    out->children = calloc(count, sizeof(struct ArrowSchema*));
+    if (!out->children) return ARROW_IPC_ERR_ALLOC;
+    out->n_children = (int64_t)count;
+    for (size_t i = 0; i < count; i++) {
+        FbRef child;
+        if (!fb_vector_table(field, elems, i, &child)) return ARROW_IPC_ERR_FORMAT;
+        out->children[i] = calloc(1, sizeof(struct ArrowSchema));
+        if (!out->children[i]) return ARROW_IPC_ERR_ALLOC;
+        int rc = decode_field(&child, out->children[i], dictionary_ids);
+        if (rc != ARROW_IPC_OK) return rc;
+    }
+    return ARROW_IPC_OK;
+}
+
+/*
+ * Field table to ArrowSchema. Dictionary ids are appended to
+ * `dictionary_ids` in pre-order (NULL: dictionaries not allowed here).
+ * On failure `out` is left releasable.
+ */
+static int decode_field(const FbRef* field, struct ArrowSchema* out, IPCIdList* dictionary_ids) {
+    memset(out, 0, sizeof(struct ArrowSchema));
+    out->release = release_ipc_schema;
+
+    const char* name;
+    size_t name_len;
+    if (!fb_string(field, 0, &name, &name_len)) return ARROW_IPC_ERR_FORMAT;
+    if (name) {
+        out->name = copy_string(name, name_len);
+        if (!out->name) return ARROW_IPC_ERR_ALLOC;
+    }
+
+    IPCType type;
+    int rc = decode_type(field, &type);
+    if (rc != ARROW_IPC_OK) return rc;
+
+    int64_t flags = fb_int(field, 1, 1, 0) ? ARROW_FLAG_NULLABLE : 0;
+    rc = decode_metadata(field, 6, (char**)&out->metadata);
+    if (rc != ARROW_IPC_OK) return rc;
+
+    FbRef encoding;
+    if (!fb_table(field, 4, &encoding)) {
+        if (type.type == IPC_TYPE_MAP && type.keys_sorted) flags |= ARROW_FLAG_MAP_KEYS_SORTED;
+        out->flags = flags;
+        rc = format_from_type(&type, (char**)&out->format);
+        if (rc != ARROW_IPC_OK) return rc;
+        return decode_children(field, &type, out, dictionary_ids);
+    }
+
+    /* Dictionary-encoded: the field's type and children describe the values */
+    if (!dictionary_ids) return ARROW_IPC_ERR_UNSUPPORTED;
+    if (fb_int(&encoding, 3, 2, 0) != 0) return ARROW_IPC_ERR_UNSUPPORTED;  /* dictionaryKind */
+
+    IPCType index_type;
+    FbRef index_table;
+    if (fb_table(&encoding, 1, &index_table)) {
+        decode_int_type(&index_table, &index_type);
+    } else {
+        memset(&index_type, 0, sizeof(IPCType));
+        index_type.type = IPC_TYPE_INT;
+        index_type.bit_width = 32;
+        index_type.is_signed = true;
+    }
+    if (fb_int(&encoding, 2, 1, 0)) flags |= ARROW_FLAG_DICTIONARY_ORDERED;
+    out->flags = flags;
+    rc = format_from_type(&index_type, (char**)&out->format);
+    if (rc != ARROW_IPC_OK) return rc;
+
+    rc = grow_array((void**)&dictionary_ids->ids, &dictionary_ids->capacity,
+                    dictionary_ids->count + 1, sizeof(int64_t));
+    if (rc != ARROW_IPC_OK) return rc;
+    dictionary_ids->ids[dictionary_ids->count++] = fb_int(&encoding, 0, 8, 0);
+
+    struct ArrowSchema* values = calloc(1, sizeof(struct ArrowSchema));
+    if (!values) return ARROW_IPC_ERR_ALLOC;
+    out->dictionary = values;
+    values->release = release_ipc_schema;
+    values->flags = ARROW_FLAG_NULLABLE;
+    if (type.type == IPC_TYPE_MAP && type.keys_sorted) values->flags |= ARROW_FLAG_MAP_KEYS_SORTED;
+    rc = format_from_type(&type, (char**)&values->format);
+    if (rc != ARROW_IPC_OK) return rc;
+    return decode_children(field, &type, values, NULL);
+}
+
+/* Schema table to a struct ArrowSchema; on failure `out` is released */
+static int decode_schema(const FbRef* schema, struct ArrowSchema* out, IPCIdList* dictionary_ids) {
+    memset(out, 0, sizeof(struct ArrowSchema));
+    out->release = release_ipc_schema;
+
+    if (fb_int(schema, 0, 2, 0) != 0) {  /* Big-endian data */
+        out->release = NULL;
+        return ARROW_IPC_ERR_UNSUPPORTED;
+    }
+
+    int rc = ARROW_IPC_ERR_ALLOC;
+    out->format = copy_string("+s", 2);
+    if (!out->format) goto error;
+    rc = decode_metadata(schema, 2, (char**)&out->metadata);
+    if (rc != ARROW_IPC_OK) goto error;
+
+    size_t elems, count;
+    rc = ARROW_IPC_ERR_FORMAT;
+    if (!fb_vector(schema, 1, 4, &elems, &count)) goto error;
+    if (count > 0) {
+        rc = ARROW_IPC_ERR_ALLOC;
+        out->children = calloc(count, sizeof(struct ArrowSchema*));
+        if (!out->children) goto error;
+        out->n_children = (int64_t)count;
+        for (size_t i = 0; i < count; i++) {
+            FbRef field;
+            rc = ARROW_IPC_ERR_FORMAT;
+            if (!fb_vector_table(schema, elems, i, &field)) goto error;
+            rc = ARROW_IPC_ERR_ALLOC;
+            out->children[i] = calloc(1, sizeof(struct ArrowSchema));
+            if (!out->children[i]) goto error;
+            rc = decode_field(&field, out->children[i], dictionary_ids);
+            if (rc != ARROW_IPC_OK) goto error;
+        }
+    }
+    return ARROW_IPC_OK;
+
+error:
+    release_ipc_schema(out);
+    return rc;
+}
+
+/* ============================================================================
+ * Record Batch Decoding
+ *
+ * Arrays alias the input; every node holds a reference on it. Buffers not
+ * aligned for their element type are copied.
+ * ============================================================================ */
+
+typedef struct {
+    int refcount;
+    ArrowIPCOwnerRelease release;
+    void* owner;
+} IPCStreamInput;
+
+static void stream_input_retain(IPCStreamInput* input) {
+    __atomic_fetch_add(&input->refcount, 1, __ATOMIC_RELAXED);
+}
+
+static void stream_input_release(IPCStreamInput* input) {
+    if (__atomic_sub_fetch(&input->refcount, 1, __ATOMIC_ACQ_REL) == 0) {
+        if (input->release) input->release(input->owner);
+        free(input);
+    }
+}
+
+/* Private data of a decoded array node */
+typedef struct {
+    IPCStreamInput* input;
+    const void* buffers[3];
+    void* owned[3];           /* Copies of misaligned buffers */
+} StreamArrayPrivate;
+
+static void release_stream_array(struct ArrowArray* array) {
+    if (!array || !array->release) return;
+
+    for (int64_t i = 0; i < array->n_children; i++) {
+        struct ArrowArray* child = array->children ? array->children[i] : NULL;
+        if (!child) continue;
+        if (child->release) child->release(child);
+        free(child);
+    }
+    free(array->children);
+    if (array->dictionary) {
+        if (array->dictionary->release) array->dictionary->release(array->dictionary);
+        free(array->dictionary);
+    }
+
+    StreamArrayPrivate* priv = (StreamArrayPrivate*)array->private_data;
+    if (priv) {
+        for (int i = 0; i < 3; i++) arrow_mem_free(priv->owned[i]);
+        stream_input_release(priv->input);
+        free(priv);
+    }
+    array->release = NULL;
+}
+
+typedef struct {
+    int64_t id;
+    IPCNodeList nodes;        /* Flattened value type */
+    bool loaded;
+    FbRef batch;              /* RecordBatch of the latest DictionaryBatch */
+    const uint8_t* body;
+    size_t body_size;
+    IPCStreamInput* input;    /* Descriptor input: the message holding `batch` */
+} ReaderDictionary;
+
+typedef struct {
+    IPCStreamInput* input;    /* In-memory input (NULL when reading a descriptor) */
+    const uint8_t* data;
+    size_t size;
+    int fd;                   /* >= 0: messages are read from this descriptor */
+    IPCStreamInput* schema_input;
+    ArrowIPCFormat format;
+    FbRef schema;             /* Decoded again for every get_schema */
+    IPCNodeList nodes;        /* Flattened columns */
+    int64_t num_columns;
+    ReaderDictionary* dictionaries;
+    size_t num_dictionaries;
+    size_t position;          /* Stream format: next message */
+    FbRef footer;             /* File format */
+    size_t batch_blocks;
+    size_t num_batch_blocks;
+    size_t next_batch;
+    bool done;
+    char error[128];
+} IPCStreamReader;
+
+/* Cursor over one RecordBatch's FieldNodes and Buffers */
+typedef struct {
+    IPCStreamReader* reader;
+    IPCStreamInput* input;    /* Owner of `body`; every decoded node holds a reference */
+    const FbRef* batch;
+    size_t nodes;
+    size_t num_nodes;
+    size_t next_node;
+    size_t buffers;
+    size_t num_buffers;
+    size_t next_buffer;
+    const uint8_t* body;
+    size_t body_size;
+    ArrowIPCCompression compression;
+} DecodeCursor;
+
+static int decode_cursor_init(DecodeCursor* c, IPCStreamReader* reader, IPCStreamInput* input,
+                              const FbRef* batch, const uint8_t* body, size_t body_size) {
+    memset(c, 0, sizeof(DecodeCursor));
+    FbRef compression;
+    if (fb_table(batch, 3, &compression)) {
+        if (fb_int(&compression, 1, 1, 0) != 0) return ARROW_IPC_ERR_UNSUPPORTED;  /* Method other than BUFFER */
+        switch (fb_int(&compression, 0, 1, IPC_CODEC_LZ4_FRAME)) {
+            case IPC_CODEC_LZ4_FRAME: c->compression = ARROW_IPC_COMPRESSION_LZ4_FRAME; break;
+            case IPC_CODEC_ZSTD: c->compression = ARROW_IPC_COMPRESSION_ZSTD; break;
+            default: return ARROW_IPC_ERR_UNSUPPORTED;
+        }
+    }
+    if (!fb_vector(batch, 1, IPC_FIELD_NODE_SIZE, &c->nodes, &c->num_nodes) ||
+        !fb_vector(batch, 2, IPC_BUFFER_SIZE, &c->buffers, &c->num_buffers)) {
+        return ARROW_IPC_ERR_FORMAT;
+    }
+    c->reader = reader;
+    c->input = input;
+    c->batch = batch;
+    c->body = body;
+    c->body_size = body_size;
+    return ARROW_IPC_OK;
+}
+
+/* Alignment buffer `index` of a node needs to be read in place */
+static size_t node_buffer_alignment(const IPCNode* node, int index) {
+    if (index == 0) return 1;
+    switch (node->layout) {
+        case IPC_LAYOUT_FIXED: {
+            int64_t width = node->byte_width;
+            if (width >= 8) return width % 8 == 0 ? 8 : 1;
+            return width == 4 || width == 2 ? (size_t)width : 1;
+        }
+        case IPC_LAYOUT_BINARY:
+        case IPC_LAYOUT_LIST:
+            return index == 1 ? 4 : 1;
+        case IPC_LAYOUT_LARGE_BINARY:
+        case IPC_LAYOUT_LARGE_LIST:
+            return index == 1 ? 8 : 1;
+        default:
+            return 1;
+    }
+}
+
+static int load_dictionary(IPCStreamReader* reader, int64_t index, struct ArrowArray* out);
+
+/*
+ * Decode the next node of `list` and its descendants. On failure `out` is
+ * left releasable.
+ */
+static int decode_array(DecodeCursor* c, const IPCNodeList* list, size_t* index, struct ArrowArray* out) {
+    memset(out, 0, sizeof(struct ArrowArray));
+    if (*index >= list->count || c->next_node >= c->num_nodes) return ARROW_IPC_ERR_FORMAT;
+    const IPCNode* node = &list->nodes[(*index)++];
+
+    const uint8_t* field_node = c->batch->buf + c->nodes + IPC_FIELD_NODE_SIZE * c->next_node++;
+    int64_t length = get_le_signed(field_node, 8);
+    int64_t null_count = get_le_signed(field_node + 8, 8);
+    if (length < 0 || null_count < 0 || null_count > length) return ARROW_IPC_ERR_FORMAT;
+
+    StreamArrayPrivate* priv = calloc(1, sizeof(StreamArrayPrivate));
+    if (!priv) return ARROW_IPC_ERR_ALLOC;
+    priv->input = c->input;
+    stream_input_retain(priv->input);
+
+    int n_buffers = layout_buffer_count(node->layout);
+    out->length = length;
+    out->null_count = null_count;
+    out->n_buffers = n_buffers;
+    out->buffers = priv->buffers;
+    out->private_data = priv;
+    out->release = release_stream_array;
+
+    int64_t sizes[3] = {0, 0, 0};
+    for (int i = 0; i < n_buffers; i++) {
+        if (c->next_buffer >= c->num_buffers) return ARROW_IPC_ERR_FORMAT;
+        const uint8_t* entry = c->batch->buf + c->buffers + IPC_BUFFER_SIZE * c->next_buffer++;
+        int64_t offset = get_le_signed(entry, 8);
+        int64_t size = get_le_signed(entry + 8, 8);
+        if (offset < 0 || size < 0 || (uint64_t)offset > c->body_size ||
+            (uint64_t)size > c->body_size - (uint64_t)offset) {
+            return ARROW_IPC_ERR_TRUNCATE;
+        }
+        if (size == 0) continue;
+
+        const uint8_t* data = c->body + offset;
+        if (c->compression != ARROW_IPC_COMPRESSION_NONE) {
+            if (size < 8) return ARROW_IPC_ERR_FORMAT;
+            int64_t uncompressed = get_le_signed(data, 8);
+            data += 8;
+            size -= 8;
+            if (uncompressed > 0) {
+                int rc = arrow_ipc_decompress(c->compression, data, (size_t)size,
+                                              (size_t)uncompressed, &priv->owned[i]);
+                if (rc != ARROW_IPC_OK) return rc;
+                priv->buffers[i] = priv->owned[i];
+                sizes[i] = uncompressed;
+                continue;
+            }
+            if (uncompressed != -1 && !(uncompressed == 0 && size == 0)) return ARROW_IPC_ERR_FORMAT;
+        }
+        sizes[i] = size;
+        if (size == 0) continue;
+
+        size_t align = node_buffer_alignment(node, i);
+        if ((uintptr_t)data % align != 0) {
+            priv->owned[i] = arrow_mem_alloc((size_t)size);
+            if (!priv->owned[i]) return ARROW_IPC_ERR_ALLOC;
+            memcpy(priv->owned[i], data, (size_t)size);
+            data = priv->owned[i];
+        }
+        priv->buffers[i] = data;
+    }
+
+    /* Check the buffers cover the declared length */
+    if (node->layout == IPC_LAYOUT_NULL) {
+        out->null_count = length;
+    } else if (null_count == 0) {
+        priv->buffers[0] = NULL;
+    } else if (sizes[0] < (length + 7) / 8) {
+        return ARROW_IPC_ERR_FORMAT;
+    }
+
+    int64_t child_length = 0;
+    switch (node->layout) {
+        case IPC_LAYOUT_BITMAP:
+            if (sizes[1] < (length + 7) / 8) return ARROW_IPC_ERR_FORMAT;
+            break;
+        case IPC_LAYOUT_FIXED:
+            if (node->byte_width <= 0 || length > sizes[1] / node->byte_width) return ARROW_IPC_ERR_FORMAT;
+            break;
+        case IPC_LAYOUT_BINARY:
+        case IPC_LAYOUT_LARGE_BINARY:
+        case IPC_LAYOUT_LIST:
+        case IPC_LAYOUT_LARGE_LIST: {
+            int width = node->layout == IPC_LAYOUT_BINARY || node->layout == IPC_LAYOUT_LIST ? 4 : 8;
+            if (length == 0 && sizes[1] < width) {
+                priv->buffers[1] = ipc_zeros;  /* Empty arrays may omit their offsets */
+                break;
+            }
+            if (length >= sizes[1] / width) return ARROW_IPC_ERR_FORMAT;
+            int64_t first = offset_at(priv->buffers[1], 0, width);
+            int64_t last = offset_at(priv->buffers[1], length, width);
+            if (first < 0 || last < first) return ARROW_IPC_ERR_FORMAT;
+            if (node->layout == IPC_LAYOUT_BINARY || node->layout == IPC_LAYOUT_LARGE_BINARY) {
+                if (last > sizes[2]) return ARROW_IPC_ERR_FORMAT;
+            } else {
+                child_length = last;
+            }
+            break;
+        }
+        case IPC_LAYOUT_FIXED_LIST:
+            if (node->byte_width > 0 && length > INT64_MAX / node->byte_width) return ARROW_IPC_ERR_FORMAT;
+            child_length = length * node->byte_width;
+            break;
+        case IPC_LAYOUT_STRUCT:
+            child_length = length;
+            break;
+        default:
+            break;
+    }
+
+    if (node->n_children > 0) {
+        out->children = calloc((size_t)node->n_children, sizeof(struct ArrowArray*));
+        if (!out->children) return ARROW_IPC_ERR_ALLOC;
+        out->n_children = node->n_children;
+        for (int64_t i = 0; i < node->n_children; i++) {
+            out->children[i] = calloc(1, sizeof(struct ArrowArray));
+            if (!out->children[i]) return ARROW_IPC_ERR_ALLOC;
+            int rc = decode_array(c, list, index, out->children[i]);
+            if (rc != ARROW_IPC_OK) return rc;
+            if (out->children[i]->length < child_length) return ARROW_IPC_ERR_FORMAT;
+        }
+    }
+
+    if (node->dictionary >= 0) {
+        out->dictionary = calloc(1, sizeof(struct ArrowArray));
+        if (!out->dictionary) return ARROW_IPC_ERR_ALLOC;
+        return load_dictionary(c->reader, node->dictionary, out->dictionary);
+    }
+    return ARROW_IPC_OK;
+}
+
+/* A fresh array over the current batch of dictionary `index` */
+static int load_dictionary(IPCStreamReader* reader, int64_t index, struct ArrowArray* out) {
+    memset(out, 0, sizeof(struct ArrowArray));
+    ReaderDictionary* dict = &reader->dictionaries[index];
+    if (!dict->loaded) return ARROW_IPC_ERR_FORMAT;
+
+    DecodeCursor c;
+    IPCStreamInput* input = dict->input ? dict->input : reader->input;
+    int rc = decode_cursor_init(&c, reader, input, &dict->batch, dict->body, dict->body_size);
+    if (rc != ARROW_IPC_OK) return rc;
+    size_t node_index = 0;
+    return decode_array(&c, &dict->nodes, &node_index, out);
+}
+
+/* Struct array over the columns of a RecordBatch message */
+static int decode_batch(IPCStreamReader* reader, IPCStreamInput* input, const FbRef* batch,
+                        const uint8_t* body, size_t body_size, struct ArrowArray* out) {
+    memset(out, 0, sizeof(struct ArrowArray));
+    DecodeCursor c;
+    int rc = decode_cursor_init(&c, reader, input, batch, body, body_size);
+    if (rc != ARROW_IPC_OK) return rc;
+
+    int64_t length = fb_int(batch, 0, 8, 0);
+    if (length < 0) return ARROW_IPC_ERR_FORMAT;
+
+    StreamArrayPrivate* priv = calloc(1, sizeof(StreamArrayPrivate));
+    if (!priv) return ARROW_IPC_ERR_ALLOC;
+    priv->input = input;
+    stream_input_retain(priv->input);
+    out->length = length;
+    out->n_buffers = 1;
+    out->buffers = priv->buffers;
+    out->private_data = priv;
+    out->release = release_stream_array;
+
+    if (reader->num_columns > 0) {
+        rc = ARROW_IPC_ERR_ALLOC;
+        out->children = calloc((size_t)reader->num_columns, sizeof(struct ArrowArray*));
+        if (!out->children) goto error;
+        out->n_children = reader->num_columns;
+    }
+
+    size_t index = 0;
+    for (int64_t i = 0; i < reader->num_columns; i++) {
+        rc = ARROW_IPC_ERR_ALLOC;
+        out->children[i] = calloc(1, sizeof(struct ArrowArray));
+        if (!out->children[i]) goto error;
+        rc = decode_array(&c, &reader->nodes, &index, out->children[i]);
+        if (rc != ARROW_IPC_OK) goto error;
+        rc = ARROW_IPC_ERR_FORMAT;
+        if (out->children[i]->length < length) goto error;
+    }
+    return ARROW_IPC_OK;
+
+error:
+    out->release(out);
+    return rc;
+}
+
+/* ============================================================================
+ * Reader
+ * ============================================================================ */
+
+typedef struct {
+    uint8_t header_type;
+    FbRef header;
+    const uint8_t* body;
+    size_t body_size;
+    size_t end;               /* Position after the body */
+} IPCMessage;
+
+/* Decode a Message flatbuffer: header type, header table and body length */
+static int parse_message(const uint8_t* meta, size_t meta_len, IPCMessage* msg, int64_t* body_len) {
+    FbRef message;
+    if (!fb_root(meta, meta_len, &message)) return ARROW_IPC_ERR_FORMAT;
+    int64_t version = fb_int(&message, 0, 2, 0);
+    if (version < IPC_METADATA_V4 || version > IPC_METADATA_V5) return ARROW_IPC_ERR_VERSION;
+
+    msg->header_type = (uint8_t)fb_int(&message, 1, 1, 0);
+    if (!fb_table(&message, 2, &msg->header)) return ARROW_IPC_ERR_FORMAT;
+
+    *body_len = fb_int(&message, 3, 8, 0);
+    return *body_len < 0 ? ARROW_IPC_ERR_TRUNCATE : ARROW_IPC_OK;
+}
+
+/* Parse the message at `pos`; *eos is set at the end-of-stream marker */
+static int read_message(const uint8_t* data, size_t size, size_t pos, IPCMessage* msg, bool* eos) {
+    *eos = false;
+    if (pos >= size) {
+        *eos = true;  /* Tolerate a stream cut right after a message */
+        return ARROW_IPC_OK;
+    }
+    if (size - pos < 4) return ARROW_IPC_ERR_TRUNCATE;
+
+    size_t meta_start = pos + 4;
+    int64_t meta_len = get_le_signed(data + pos, 4);
+    if ((uint32_t)get_le(data + pos, 4) == ARROW_IPC_CONTINUATION) {
+        if (size - pos < 8) return ARROW_IPC_ERR_TRUNCATE;
+        meta_len = get_le_signed(data + pos + 4, 4);
+        meta_start = pos + 8;
+    }
+    if (meta_len == 0) {
+        *eos = true;
+        return ARROW_IPC_OK;
+    }
+    if (meta_len < 0 || (uint64_t)meta_len > size - meta_start) return ARROW_IPC_ERR_TRUNCATE;
+
+    int64_t body_len;
+    int rc = parse_message(data + meta_start, (size_t)meta_len, msg, &body_len);
+    if (rc != ARROW_IPC_OK) return rc;
+
+    size_t body_start = meta_start + (size_t)meta_len;
+    if ((uint64_t)body_len > size - body_start) return ARROW_IPC_ERR_TRUNCATE;
+    msg->body = data + body_start;
+    msg->body_size = (size_t)body_len;
+    msg->end = body_start + (size_t)body_len;
+    return ARROW_IPC_OK;
+}
+
+/* Point a dictionary at a DictionaryBatch's RecordBatch, held by `input` if not NULL */
+static void set_dictionary_batch(ReaderDictionary* dict, const FbRef* batch, const uint8_t* body,
+                                 size_t body_size, IPCStreamInput* input) {
+    dict->batch = *batch;
+    dict->body = body;
+    dict->body_size = body_size;
+    dict->loaded = true;
+    if (input) stream_input_retain(input);
+    if (dict->input) stream_input_release(dict->input);
+    dict->input = input;
+}
+
+/*
+ * Apply a delta: decode the current dictionary and the new entries, and
+ * render both into one uncompressed DictionaryBatch owned by the reader.
+ * Later batches then load the merged dictionary like any other.
+ */
+static int append_dictionary_delta(IPCStreamReader* reader, int64_t index, const FbRef* batch,
+                                   const uint8_t* body, size_t body_size, IPCStreamInput* input) {
+    ReaderDictionary* dict = &reader->dictionaries[index];
+    struct ArrowArray current, delta;
+    memset(&delta, 0, sizeof(struct ArrowArray));
+    BatchBody merged;
+    memset(&merged, 0, sizeof(BatchBody));
+    FbBuilder meta;
+    memset(&meta, 0, sizeof(FbBuilder));
+    ArrowIPCBuffer bytes;
+    arrow_ipc_buffer_init(&bytes);
+
+    int rc = load_dictionary(reader, index, &current);
+    if (rc == ARROW_IPC_OK) {
+        DecodeCursor c;
+        size_t node_index = 0;
+        rc = decode_cursor_init(&c, reader, input ? input : reader->input, batch, body, body_size);
+        if (rc == ARROW_IPC_OK) rc = decode_array(&c, &dict->nodes, &node_index, &delta);
+    }
+    if (rc == ARROW_IPC_OK) {
+        ConcatPart parts[2] = {{&current, 0, current.length}, {&delta, 0, delta.length}};
+        size_t node_index = 0;
+        rc = plan_concat(&merged, &dict->nodes, &node_index, parts, 2);
+    }
+    if (rc == ARROW_IPC_OK) {
+        size_t header_slot = encode_message(&meta, IPC_MESSAGE_DICTIONARY_BATCH, merged.body_length);
+        FbTable t;
+        fb_table_begin(&meta, &t);
+        fb_field(&meta, &t, 0, (uint64_t)dict->id, 8);
+        size_t data_slot = fb_field_offset(&meta, &t, 1);
+        fb_set_offset(&meta, header_slot, fb_table_end(&meta, &t));
+        fb_set_offset(&meta, data_slot, encode_record_batch(&meta, current.length + delta.length, &merged,
+                                                             ARROW_IPC_COMPRESSION_NONE));
+        IPCBlock block;
+        rc = emit_message(buffer_write_fn, &bytes, 0, &meta, &merged, &block);
+    }
+
+    IPCStreamInput* owner = NULL;
+    IPCMessage msg;
+    FbRef merged_batch;
+    if (rc == ARROW_IPC_OK) {
+        bool eos;
+        rc = read_message(bytes.data, bytes.size, 0, &msg, &eos);
+        if (rc == ARROW_IPC_OK && (eos || !fb_table(&msg.header, 1, &merged_batch))) rc = ARROW_IPC_ERR_FORMAT;
+    }
+    if (rc == ARROW_IPC_OK) {
+        owner = calloc(1, sizeof(IPCStreamInput));
+        if (!owner) rc = ARROW_IPC_ERR_ALLOC;
+    }
+    if (rc == ARROW_IPC_OK) {
+        owner->refcount = 1;
+        owner->release = free;
+        owner->owner = bytes.data;
+        arrow_ipc_buffer_init(&bytes);
+        set_dictionary_batch(dict, &merged_batch, msg.body, msg.body_size, owner);
+        stream_input_release(owner);
+    }
+
+    if (current.release) current.release(&current);
+    if (delta.release) delta.release(&delta);
+    arrow_ipc_buffer_free(&bytes);
+    arrow_ipc_buffer_free(&meta.buf);
+    batch_body_free(&merged);
+    return rc;
+}
+
+/*
+ * Make `msg` the current batch of its dictionary, or append it to the
+ * dictionary if it is a delta. With a descriptor input the dictionary keeps
+ * a reference on the message block.
+ */
+static int register_dictionary(IPCStreamReader* reader, const IPCMessage* msg, IPCStreamInput* input) {
+    int64_t id = fb_int(&msg->header, 0, 8, 0);
+    bool is_delta = fb_int(&msg->header, 2, 1, 0) != 0;
+
+    for (size_t i = 0; i < reader->num_dictionaries; i++) {
+        ReaderDictionary* dict = &reader->dictionaries[i];
+        if (dict->id != id) continue;
+        FbRef batch;
+        if (!fb_table(&msg->header, 1, &batch)) return ARROW_IPC_ERR_FORMAT;
+        if (!is_delta) {
+            set_dictionary_batch(dict, &batch, msg->body, msg->body_size, input);
+            return ARROW_IPC_OK;
+        }
+        if (!dict->loaded) return ARROW_IPC_ERR_FORMAT;
+        return append_dictionary_delta(reader, (int64_t)i, &batch, msg->body, msg->body_size, input);
+    }
+    return ARROW_IPC_ERR_FORMAT;
+}
+
+static int reader_message_at(IPCStreamReader* reader, const uint8_t* block, uint8_t header_type, IPCMessage* msg) {
+    int64_t offset = get_le_signed(block, 8);
+    bool eos;
+    if (offset < 0 || (uint64_t)offset >= reader->size) return ARROW_IPC_ERR_FORMAT;
+    int rc = read_message(reader->data, reader->size, (size_t)offset, msg, &eos);
+    if (rc != ARROW_IPC_OK) return rc;
+    return !eos && msg->header_type == header_type ? ARROW_IPC_OK : ARROW_IPC_ERR_FORMAT;
+}
+
+static int open_file(IPCStreamReader* reader) {
+    const size_t trailer = 4 + ARROW_IPC_FILE_MAGIC_SIZE;
+    if (reader->size < 8 + trailer) return ARROW_IPC_ERR_TRUNCATE;
+    if (memcmp(reader->data + reader->size - ARROW_IPC_FILE_MAGIC_SIZE, ARROW_IPC_FILE_MAGIC,
+               ARROW_IPC_FILE_MAGIC_SIZE) != 0) {
+        return ARROW_IPC_ERR_FORMAT;
+    }
+
+    int64_t footer_len = get_le_signed(reader->data + reader->size - trailer, 4);
+    if (footer_len <= 0 || (uint64_t)footer_len > reader->size - trailer - 8) return ARROW_IPC_ERR_FORMAT;
+    const uint8_t* footer = reader->data + reader->size - trailer - footer_len;
+    if (!fb_root(footer, (size_t)footer_len, &reader->footer)) return ARROW_IPC_ERR_FORMAT;
+    if (!fb_table(&reader->footer, 1, &reader->schema)) return ARROW_IPC_ERR_FORMAT;
+    if (!fb_vector(&reader->footer, 3, IPC_BLOCK_SIZE, &reader->batch_blocks, &reader->num_batch_blocks)) {
+        return ARROW_IPC_ERR_FORMAT;
+    }
+    return ARROW_IPC_OK;
+}
+
+/* File format: dictionaries are indexed by the footer and loaded up front */
+static int load_file_dictionaries(IPCStreamReader* reader) {
+    size_t elems, count;
+    if (!fb_vector(&reader->footer, 2, IPC_BLOCK_SIZE, &elems, &count)) return ARROW_IPC_ERR_FORMAT;
+    for (size_t i = 0; i < count; i++) {
+        IPCMessage msg;
+        int rc = reader_message_at(reader, reader->footer.buf + elems + IPC_BLOCK_SIZE * i,
+                                   IPC_MESSAGE_DICTIONARY_BATCH, &msg);
+        if (rc == ARROW_IPC_OK) rc = register_dictionary(reader, &msg, NULL);
+        if (rc != ARROW_IPC_OK) return rc;
+    }
+    return ARROW_IPC_OK;
+}
+
+/* read(2) up to `len` bytes, stopping early only at end of file */
+static int fd_read_all(int fd, void* data, size_t len, size_t* got) {
+    uint8_t* p = (uint8_t*)data;
+    *got = 0;
+    while (*got < len) {
+        ssize_t n = read(fd, p + *got, len - *got);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) return ARROW_IPC_ERR_IO;
+        if (n == 0) break;
+        *got += (size_t)n;
+    }
+    return ARROW_IPC_OK;
+}
+
+static int fd_read_exact(int fd, void* data, size_t len) {
+    size_t got;
+    int rc = fd_read_all(fd, data, len, &got);
+    if (rc != ARROW_IPC_OK) return rc;
+    return got == len ? ARROW_IPC_OK : ARROW_IPC_ERR_TRUNCATE;
+}
+
+/*
+ * Read the next message from the reader's descriptor into its own block:
+ * the body first (so it is 64-byte aligned), then the metadata. *out_input
+ * owns the block with one reference held by the caller. Memory use is
+ * bounded by the largest message plus the batches still alive.
+ */
+static int fd_read_message(IPCStreamReader* reader, IPCMessage* msg, IPCStreamInput** out_input, bool* eos) {
+    *eos = false;
+    *out_input = NULL;
+
+    uint8_t prefix[4];
+    size_t got;
+    int rc = fd_read_all(reader->fd, prefix, 4, &got);
+    if (rc != ARROW_IPC_OK) return rc;
+    if (got == 0) {
+        *eos = true;  /* Tolerate a stream cut right after a message */
+        return ARROW_IPC_OK;
+    }
+    if (got < 4) return ARROW_IPC_ERR_TRUNCATE;
+
+    int64_t meta_len = get_le_signed(prefix, 4);
+    if ((uint32_t)get_le(prefix, 4) == ARROW_IPC_CONTINUATION) {
+        rc = fd_read_exact(reader->fd, prefix, 4);
+        if (rc != ARROW_IPC_OK) return rc;
+        meta_len = get_le_signed(prefix, 4);
+    }
+    if (meta_len == 0) {
+        *eos = true;
+        return ARROW_IPC_OK;
+    }
+    if (meta_len < 0) return ARROW_IPC_ERR_FORMAT;
+
+    uint8_t* meta = malloc((size_t)meta_len);
+    if (!meta) return ARROW_IPC_ERR_ALLOC;
+    int64_t body_len = 0;
+    rc = fd_read_exact(reader->fd, meta, (size_t)meta_len);
+    if (rc == ARROW_IPC_OK) rc = parse_message(meta, (size_t)meta_len, msg, &body_len);
+    if (rc == ARROW_IPC_OK && (uint64_t)body_len > SIZE_MAX - (size_t)meta_len - ARROW_IPC_STREAM_ALIGNMENT) {
+        rc = ARROW_IPC_ERR_FORMAT;
+    }
+    if (rc != ARROW_IPC_OK) {
+        free(meta);
+        return rc;
+    }
+
+    size_t body_space = (size_t)padded_size(body_len);
+    void* block = NULL;
+    if (posix_memalign(&block, ARROW_IPC_STREAM_ALIGNMENT, body_space + (size_t)meta_len) != 0) {
+        free(meta);
+        return ARROW_IPC_ERR_ALLOC;
+    }
+    uint8_t* bytes = (uint8_t*)block;
+    memcpy(bytes + body_space, meta, (size_t)meta_len);
+    free(meta);
+
+    IPCStreamInput* input = calloc(1, sizeof(IPCStreamInput));
+    rc = input ? fd_read_exact(reader->fd, bytes, (size_t)body_len) : ARROW_IPC_ERR_ALLOC;
+    /* Re-parse so the header points into the block */
+    if (rc == ARROW_IPC_OK) rc = parse_message(bytes + body_space, (size_t)meta_len, msg, &body_len);
+    if (rc != ARROW_IPC_OK) {
+        free(input);
+        free(block);
+        return rc;
+    }
+
+    input->refcount = 1;
+    input->release = free;
+    input->owner = block;
+    msg->body = bytes;
+    msg->body_size = (size_t)body_len;
+    msg->end = 0;
+    *out_input = input;
+    return ARROW_IPC_OK;
+}
+
+/* Descriptor input: skip the file magic if present, then read the Schema */
+static int open_fd_stream(IPCStreamReader* reader) {
+    uint8_t magic[8];
+    size_t got;
+    int rc = fd_read_all(reader->fd, magic, 4, &got);
+    if (rc != ARROW_IPC_OK) return rc;
+    if (got < 4) return ARROW_IPC_ERR_TRUNCATE;
+
+    IPCMessage msg;
+    bool eos;
+    IPCStreamInput* input = NULL;
+    if (memcmp(magic, ARROW_IPC_FILE_MAGIC, 4) == 0) {
+        /* File format: read the embedded stream, leave the footer unread */
+        rc = fd_read_exact(reader->fd, magic + 4, 4);
+        if (rc != ARROW_IPC_OK) return rc;
+        if (memcmp(magic, ARROW_IPC_FILE_MAGIC, ARROW_IPC_FILE_MAGIC_SIZE) != 0) return ARROW_IPC_ERR_FORMAT;
+        rc = fd_read_message(reader, &msg, &input, &eos);
+    } else {
+        /* Stream format: the four bytes read start the Schema message */
+        uint8_t meta_prefix[4];
+        int64_t meta_len = get_le_signed(magic, 4);
+        if ((uint32_t)get_le(magic, 4) == ARROW_IPC_CONTINUATION) {
+            rc = fd_read_exact(reader->fd, meta_prefix, 4);
+            if (rc != ARROW_IPC_OK) return rc;
+            meta_len = get_le_signed(meta_prefix, 4);
+        }
+        if (meta_len <= 0) return ARROW_IPC_ERR_FORMAT;
+
+        uint8_t* meta = malloc((size_t)meta_len);
+        if (!meta) return ARROW_IPC_ERR_ALLOC;
+        int64_t body_len = 0;
+        rc = fd_read_exact(reader->fd, meta, (size_t)meta_len);
+        if (rc == ARROW_IPC_OK) rc = parse_message(meta, (size_t)meta_len, &msg, &body_len);
+        if (rc == ARROW_IPC_OK && (msg.header_type != IPC_MESSAGE_SCHEMA || body_len != 0)) rc = ARROW_IPC_ERR_FORMAT;
+        if (rc == ARROW_IPC_OK) {
+            input = calloc(1, sizeof(IPCStreamInput));
+            if (!input) rc = ARROW_IPC_ERR_ALLOC;
+        }
+        if (rc != ARROW_IPC_OK) {
+            free(meta);
+            return rc;
+        }
+        input->refcount = 1;
+        input->release = free;
+        input->owner = meta;
+        eos = false;
+    }
+    if (rc != ARROW_IPC_OK) return rc;
+    if (eos || msg.header_type != IPC_MESSAGE_SCHEMA) {
+        if (input) stream_input_release(input);
+        return ARROW_IPC_ERR_FORMAT;
+    }
+    reader->schema = msg.header;
+    reader->schema_input = input;
+    return ARROW_IPC_OK;
+}
+
+static int open_stream(IPCStreamReader* reader) {
+    IPCMessage msg;
+    bool eos;
+    int rc = read_message(reader->data, reader->size, 0, &msg, &eos);
+    if (rc != ARROW_IPC_OK) return rc;
+    if (eos || msg.header_type != IPC_MESSAGE_SCHEMA) return ARROW_IPC_ERR_FORMAT;
+    reader->schema = msg.header;
+    reader->position = msg.end;
+    return ARROW_IPC_OK;
+}
+
+/* Flatten the schema and set up the dictionary table */
+static int reader_setup(IPCStreamReader* reader) {
+    struct ArrowSchema schema;
+    IPCIdList ids;
+    IPCSchemaList dictionaries;
+    memset(&ids, 0, sizeof(IPCIdList));
+    memset(&dictionaries, 0, sizeof(IPCSchemaList));
+
+    int rc = decode_schema(&reader->schema, &schema, &ids);
+    if (rc != ARROW_IPC_OK) {
+        free(ids.ids);
+        return rc;
+    }
+    reader->num_columns = schema.n_children;
+    rc = flatten_columns(&schema, &reader->nodes, &dictionaries);
+
+    if (rc == ARROW_IPC_OK && dictionaries.count > 0) {
+        reader->dictionaries = calloc(dictionaries.count, sizeof(ReaderDictionary));
+        if (!reader->dictionaries) rc = ARROW_IPC_ERR_ALLOC;
+        else reader->num_dictionaries = dictionaries.count;
+    }
+    for (size_t i = 0; i < reader->num_dictionaries && rc == ARROW_IPC_OK; i++) {
+        reader->dictionaries[i].id = ids.ids[i];
+        rc = flatten_schema(dictionaries.schemas[i], &reader->dictionaries[i].nodes, NULL);
+    }
+
+    free(dictionaries.schemas);
+    free(ids.ids);
+    schema.release(&schema);
+    return rc;
+}
+
+static void reader_free(IPCStreamReader* reader) {
+    node_list_free(&reader->nodes);
+    for (size_t i = 0; i < reader->num_dictionaries; i++) {
+        node_list_free(&reader->dictionaries[i].nodes);
+        if (reader->dictionaries[i].input) stream_input_release(reader->dictionaries[i].input);
+    }
+    if (reader->schema_input) stream_input_release(reader->schema_input);
+    free(reader->dictionaries);
+    free(reader);
+}
+
+static int reader_fail(IPCStreamReader* reader, int rc) {
+    const char* what;
+    switch (rc) {
+        case ARROW_IPC_ERR_ALLOC: what = "allocation failed"; break;
+        case ARROW_IPC_ERR_UNSUPPORTED: what = "unsupported feature"; break;
+        case ARROW_IPC_ERR_VERSION: what = "unsupported metadata version"; break;
+        case ARROW_IPC_ERR_TRUNCATE: what = "truncated message"; break;
+        case ARROW_IPC_ERR_IO: what = "read failed"; break;
+        default: what = "invalid message"; break;
+    }
+    snprintf(reader->error, sizeof(reader->error), "Arrow IPC: %s", what);
+    reader->done = true;
+    if (rc == ARROW_IPC_ERR_ALLOC) return ENOMEM;
+    if (rc == ARROW_IPC_ERR_UNSUPPORTED) return ENOSYS;
+    return EINVAL;
+}
+
+static int reader_get_schema(struct ArrowArrayStream* stream, struct ArrowSchema* out) {
+    if (!stream || !stream->private_data || !out) return EINVAL;
+    IPCStreamReader* reader = (IPCStreamReader*)stream->private_data;
+    IPCIdList ids;
+    memset(&ids, 0, sizeof(IPCIdList));
+    int rc = decode_schema(&reader->schema, out, &ids);
+    free(ids.ids);
+    return rc == ARROW_IPC_OK ? 0 : reader_fail(reader, rc);
+}
+
+static int reader_get_next(struct ArrowArrayStream* stream, struct ArrowArray* out) {
+    if (!stream || !stream->private_data || !out) return EINVAL;
+    IPCStreamReader* reader = (IPCStreamReader*)stream->private_data;
+    memset(out, 0, sizeof(struct ArrowArray));
+    if (reader->done) return reader->error[0] ? EINVAL : 0;
+
+    IPCMessage msg;
+    IPCStreamInput* input = reader->input;
+    int rc;
+    if (reader->fd >= 0) {
+        for (;;) {
+            bool eos;
+            rc = fd_read_message(reader, &msg, &input, &eos);
+            if (rc != ARROW_IPC_OK) return reader_fail(reader, rc);
+            if (eos) {
+                reader->done = true;
+                return 0;
+            }
+            if (msg.header_type == IPC_MESSAGE_RECORD_BATCH) break;
+            rc = msg.header_type == IPC_MESSAGE_DICTIONARY_BATCH
+                ? register_dictionary(reader, &msg, input)
+                : ARROW_IPC_ERR_FORMAT;
+            stream_input_release(input);
+            if (rc != ARROW_IPC_OK) return reader_fail(reader, rc);
+        }
+    } else if (reader->format == ARROW_IPC_FORMAT_FILE) {
+        if (reader->next_batch >= reader->num_batch_blocks) {
+            reader->done = true;
+            return 0;
+        }
+        rc = reader_message_at(reader, reader->footer.buf + reader->batch_blocks + IPC_BLOCK_SIZE * reader->next_batch,
+                               IPC_MESSAGE_RECORD_BATCH, &msg);
+        if (rc != ARROW_IPC_OK) return reader_fail(reader, rc);
+        reader->next_batch++;
+    } else {
+        for (;;) {
+            bool eos;
+            rc = read_message(reader->data, reader->size, reader->position, &msg, &eos);
+            if (rc != ARROW_IPC_OK) return reader_fail(reader, rc);
+            if (eos) {
+                reader->done = true;
+                return 0;
+            }
+            reader->position = msg.end;
+            if (msg.header_type == IPC_MESSAGE_RECORD_BATCH) break;
+            if (msg.header_type != IPC_MESSAGE_DICTIONARY_BATCH) return reader_fail(reader, ARROW_IPC_ERR_FORMAT);
+            rc = register_dictionary(reader, &msg, NULL);
+            if (rc != ARROW_IPC_OK) return reader_fail(reader, rc);
+        }
+    }
+
+    rc = decode_batch(reader, input, &msg.header, msg.body, msg.body_size, out);
+    /* The batch holds its own references on a descriptor message */
+    if (reader->fd >= 0) stream_input_release(input);
+    return rc == ARROW_IPC_OK ? 0 : reader_fail(reader, rc);
+}
+
+static const char* reader_get_last_error(struct ArrowArrayStream* stream) {
+    if (!stream || !stream->private_data) return NULL;
+    IPCStreamReader* reader = (IPCStreamReader*)stream->private_data;
+    return reader->error[0] ? reader->error : NULL;
+}
+
+static void reader_release(struct ArrowArrayStream* stream) {
+    if (!stream || !stream->release) return;
+    IPCStreamReader* reader = (IPCStreamReader*)stream->private_data;
+    if (reader) {
+        if (reader->input) stream_input_release(reader->input);
+        reader_free(reader);
+    }
+    stream->private_data = NULL;
+    stream->release = NULL;
+}
+
+int arrow_ipc_read_array_stream(
+    const uint8_t* data,
+    size_t size,
+    ArrowIPCOwnerRelease owner_release,
+    void* owner,
+    struct ArrowArrayStream* out
+) {
+    if (!data || !out) return ARROW_IPC_ERR_NULL;
+    memset(out, 0, sizeof(struct ArrowArrayStream));
+
+    IPCStreamReader* reader = calloc(1, sizeof(IPCStreamReader));
+    if (!reader) return ARROW_IPC_ERR_ALLOC;
+    reader->data = data;
+    reader->size = size;
+    reader->fd = -1;
+    reader->format = size >= 8 && memcmp(data, ARROW_IPC_FILE_MAGIC, ARROW_IPC_FILE_MAGIC_SIZE) == 0
+        ? ARROW_IPC_FORMAT_FILE
+        : ARROW_IPC_FORMAT_STREAM;
+
+    /* Held by the stream itself; merging delta dictionaries decodes from it */
+    reader->input = calloc(1, sizeof(IPCStreamInput));
+    int rc = reader->input ? ARROW_IPC_OK : ARROW_IPC_ERR_ALLOC;
+    if (rc == ARROW_IPC_OK) {
+        reader->input->refcount = 1;
+        rc = reader->format == ARROW_IPC_FORMAT_FILE ? open_file(reader) : open_stream(reader);
+    }
+    if (rc == ARROW_IPC_OK) rc = reader_setup(reader);
+    if (rc == ARROW_IPC_OK && reader->format == ARROW_IPC_FORMAT_FILE) rc = load_file_dictionaries(reader);
+    if (rc != ARROW_IPC_OK) {
+        free(reader->input);
+        reader_free(reader);
+        return rc;
+    }
+
+    reader->input->release = owner_release;
+    reader->input->owner = owner;
+
+    out->get_schema = reader_get_schema;
+    out->get_next = reader_get_next;
+    out->get_last_error = reader_get_last_error;
+    out->release = reader_release;
+    out->private_data = reader;
+    return ARROW_IPC_OK;
+}
+
+int arrow_ipc_read_array_stream_from_fd(
+    int fd,
+    struct ArrowArrayStream* out
+) {
+    if (fd < 0 || !out) return ARROW_IPC_ERR_NULL;
+    memset(out, 0, sizeof(struct ArrowArrayStream));
+
+    IPCStreamReader* reader = calloc(1, sizeof(IPCStreamReader));
+    if (!reader) return ARROW_IPC_ERR_ALLOC;
+    reader->fd = fd;
+    reader->format = ARROW_IPC_FORMAT_STREAM;
+
+    int rc = open_fd_stream(reader);
+    if (rc == ARROW_IPC_OK) rc = reader_setup(reader);
+    if (rc != ARROW_IPC_OK) {
+        reader_free(reader);
+        return rc;
+    }
+
+    out->get_schema = reader_get_schema;
+    out->get_next = reader_get_next;
+    out->get_last_error = reader_get_last_error;
+    out->release = reader_release;
+    out->private_data = reader;
+    return ARROW_IPC_OK;
+}
+
+/* ============================================================================
+ * Convenience Entry Points
+ * ============================================================================ */
+
+/* Drain `stream` through `write`, or into `fd` if it is >= 0 */
+static int write_array_stream(
+    struct ArrowArrayStream* stream,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    ArrowIPCWriteFn write,
+    void* ctx,
+    int fd
+) {
+    struct ArrowSchema schema;
+    memset(&schema, 0, sizeof(struct ArrowSchema));
+    if (stream->get_schema(stream, &schema) != 0) return ARROW_IPC_ERR_IO;
+
+    ArrowIPCStreamWriter* writer = NULL;
+    int rc = writer_create(&schema, format, options, write, ctx, fd, &writer);
+    if (schema.release) schema.release(&schema);
+    if (rc != ARROW_IPC_OK) return rc;
+
+    for (;;) {
+        struct ArrowArray batch;
+        memset(&batch, 0, sizeof(struct ArrowArray));
+        if (stream->get_next(stream, &batch) != 0) {
+            rc = ARROW_IPC_ERR_IO;
+            break;
+        }
+        if (!batch.release) break;
+        rc = arrow_ipc_stream_writer_write_batch(writer, &batch);
+        batch.release(&batch);
+        if (rc != ARROW_IPC_OK) break;
+    }
+
+    if (rc == ARROW_IPC_OK) rc = arrow_ipc_stream_writer_finish(writer);
+    arrow_ipc_stream_writer_free(writer);
+    return rc;
+}
+
+int arrow_ipc_write_array_stream(
+    struct ArrowArrayStream* stream,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    ArrowIPCWriteFn write,
+    void* ctx
+) {
+    if (!stream || !stream->get_schema || !write) return ARROW_IPC_ERR_NULL;
+    return write_array_stream(stream, format, options, write, ctx, -1);
+}
+
+int arrow_ipc_write_array_stream_to_fd(
+    struct ArrowArrayStream* stream,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    int fd
+) {
+    if (!stream || !stream->get_schema || fd < 0) return ARROW_IPC_ERR_NULL;
+    return write_array_stream(stream, format, options, NULL, NULL, fd);
+}
+
+int arrow_ipc_write_array_stream_to_buffer(
+    struct ArrowArrayStream* stream,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    uint8_t** out_data,
+    size_t* out_size
+) {
+    if (!out_data || !out_size) return ARROW_IPC_ERR_NULL;
+
+    ArrowIPCBuffer buf;
+    arrow_ipc_buffer_init(&buf);
+    int rc = arrow_ipc_write_array_stream(stream, format, options, buffer_write_fn, &buf);
+    if (rc != ARROW_IPC_OK) {
+        arrow_ipc_buffer_free(&buf);
+        return rc;
+    }
+    *out_data = buf.data;
+    *out_size = buf.size;
+    return ARROW_IPC_OK;
+}
+
+static int file_write_fn(void* ctx, const void* data, size_t len) {
+    return fwrite(data, 1, len, (FILE*)ctx) == len ? 0 : -1;
+}
+
+int arrow_ipc_write_array_stream_to_path(
+    struct ArrowArrayStream* stream,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    const char* path
+) {
+    if (!path) return ARROW_IPC_ERR_NULL;
+    FILE* file = fopen(path, "wb");
+    if (!file) return ARROW_IPC_ERR_IO;
+
+    int rc = arrow_ipc_write_array_stream(stream, format, options, file_write_fn, file);
+    if (fclose(file) != 0 && rc == ARROW_IPC_OK) rc = ARROW_IPC_ERR_IO;
+    return rc;
+}
+
+int arrow_ipc_read_array_stream_from_path(
+    const char* path,
+    struct ArrowArrayStream* out
+) {
+    if (!path || !out) return ARROW_IPC_ERR_NULL;
+    FILE* file = fopen(path, "rb");
+    if (!file) return ARROW_IPC_ERR_IO;
+
+    int rc = ARROW_IPC_ERR_IO;
+    void* data = NULL;
+    long size = -1;
+    if (fseek(file, 0, SEEK_END) == 0) size = ftell(file);
+    if (size >= 0 && fseek(file, 0, SEEK_SET) == 0) {
+        rc = posix_memalign(&data, ARROW_IPC_STREAM_ALIGNMENT, size > 0 ? (size_t)size : 1) == 0
+            ? ARROW_IPC_OK : ARROW_IPC_ERR_ALLOC;
+        if (rc == ARROW_IPC_OK && fread(data, 1, (size_t)size, file) != (size_t)size) rc = ARROW_IPC_ERR_IO;
+    }
+    fclose(file);
+
+    if (rc == ARROW_IPC_OK) rc = arrow_ipc_read_array_stream(data, (size_t)size, free, data, out);
+    if (rc != ARROW_IPC_OK) free(data);
+    return rc;
+}
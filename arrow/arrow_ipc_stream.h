@@ -0,0 +1,211 @@
+/*
+ * Arrow IPC Streaming and File Format
+ *
+ * Reads and writes the standard Arrow IPC format, so data can be exchanged
+ * with pyarrow, DuckDB and other Arrow implementations without a detour
+ * through Parquet.
+ *
+ * Stream format: a sequence of encapsulated messages
+ *   [0xFFFFFFFF] [int32 metadata length] [Message flatbuffer + padding] [body]
+ * starting with a Schema message, followed by DictionaryBatch and
+ * RecordBatch messages, and terminated by 0xFFFFFFFF 0x00000000.
+ *
+ * File format: "ARROW1\0\0" + stream + Footer flatbuffer + int32 footer
+ * length + "ARROW1". The footer indexes every dictionary and record batch.
+ *
+ * Both directions work on ArrowArrayStream: a stream's batches are struct
+ * arrays whose children are the columns. Body buffers are written 64-byte
+ * aligned; readers hand out arrays that alias the input bytes.
+ *
+ * Record batch bodies can be compressed per buffer with LZ4_FRAME or ZSTD
+ * (BodyCompression); the reader handles both.
+ *
+ * Writers and readers can also work on a file descriptor or pipe: each
+ * message goes out as one writev of its metadata and source buffers, and
+ * the reader pulls one message at a time, so memory stays bounded by the
+ * batches still in use.
+ *
+ * Delta dictionaries are read in both formats: the new entries are appended
+ * to the dictionary once, when the DictionaryBatch arrives. Writers send
+ * them when options->emit_dictionary_deltas is set and a dictionary only
+ * grew since the last batch.
+ *
+ * Not supported: unions, view types, run-end encoding, and dictionaries
+ * nested inside dictionary values.
+ */
+
+#ifndef ARROW_IPC_STREAM_H
+#define ARROW_IPC_STREAM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "arrow_c_abi.h"
+#include "arrow_ipc.h"
+
+/* Encapsulation constants */
+#define ARROW_IPC_CONTINUATION      0xFFFFFFFFu
+#define ARROW_IPC_FILE_MAGIC        "ARROW1"
+#define ARROW_IPC_FILE_MAGIC_SIZE   6
+
+/* Alignment of body buffers and of every message */
+#define ARROW_IPC_STREAM_ALIGNMENT  64
+
+typedef enum {
+    ARROW_IPC_FORMAT_STREAM = 0,  /* Messages + end-of-stream marker */
+    ARROW_IPC_FORMAT_FILE = 1     /* Magic + stream + footer (random access) */
+} ArrowIPCFormat;
+
+/*
+ * Output hook: append `len` bytes. Returns 0 on success, non-zero on error.
+ */
+typedef int (*ArrowIPCWriteFn)(void* ctx, const void* data, size_t len);
+
+/* ============================================================================
+ * Writer
+ * ============================================================================ */
+
+typedef struct ArrowIPCStreamWriter ArrowIPCStreamWriter;
+
+/*
+ * Create a writer and emit the file magic (file format) and the Schema
+ * message. `schema` must be a struct ("+s") schema; it is not retained.
+ * `options` selects body compression (NULL: uncompressed).
+ *
+ * @return ARROW_IPC_OK on success; ARROW_IPC_ERR_UNSUPPORTED for types the
+ *         format cannot carry, ARROW_IPC_ERR_IO if the write hook fails
+ */
+int arrow_ipc_stream_writer_create(
+    const struct ArrowSchema* schema,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    ArrowIPCWriteFn write,
+    void* ctx,
+    ArrowIPCStreamWriter** out_writer
+);
+
+/*
+ * Write one record batch (a struct array matching the schema). Dictionary
+ * batches are emitted first for any dictionary that changed since the last
+ * batch: as a delta if deltas are enabled and the old entries are a prefix
+ * of the new ones, otherwise as a replacement, which the file format does
+ * not allow.
+ *
+ * @return ARROW_IPC_OK on success, error code otherwise
+ */
+int arrow_ipc_stream_writer_write_batch(
+    ArrowIPCStreamWriter* writer,
+    const struct ArrowArray* batch
+);
+
+/*
+ * Write the end-of-stream marker (and the footer for the file format).
+ * No batches can be written afterwards.
+ */
+int arrow_ipc_stream_writer_finish(ArrowIPCStreamWriter* writer);
+
+/*
+ * Create a writer on a file descriptor (file, pipe or socket). Each message
+ * is written with writev straight from the batch's buffers, without
+ * assembling it in memory. The descriptor is not closed by the writer.
+ */
+int arrow_ipc_stream_writer_create_fd(
+    const struct ArrowSchema* schema,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    int fd,
+    ArrowIPCStreamWriter** out_writer
+);
+
+/* Free the writer (does not finish it) */
+void arrow_ipc_stream_writer_free(ArrowIPCStreamWriter* writer);
+
+/*
+ * Drain an ArrowArrayStream into IPC format. The stream is consumed but not
+ * released.
+ */
+int arrow_ipc_write_array_stream(
+    struct ArrowArrayStream* stream,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    ArrowIPCWriteFn write,
+    void* ctx
+);
+
+/*
+ * Drain a stream into a file descriptor (not closed)
+ */
+int arrow_ipc_write_array_stream_to_fd(
+    struct ArrowArrayStream* stream,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    int fd
+);
+
+/*
+ * Drain a stream into a newly allocated buffer (caller must free)
+ */
+int arrow_ipc_write_array_stream_to_buffer(
+    struct ArrowArrayStream* stream,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    uint8_t** out_data,
+    size_t* out_size
+);
+
+/*
+ * Drain a stream into a file at `path` (created or truncated)
+ */
+int arrow_ipc_write_array_stream_to_path(
+    struct ArrowArrayStream* stream,
+    ArrowIPCFormat format,
+    const ArrowIPCWriteOptions* options,
+    const char* path
+);
+
+/* ============================================================================
+ * Reader
+ * ============================================================================ */
+
+/*
+ * Open IPC data (stream or file format, detected from the magic) as an
+ * ArrowArrayStream. Arrays alias `data`: owner_release(owner) runs once the
+ * stream and every array it produced have been released. On failure the
+ * owner is not released.
+ *
+ * @param owner_release Release hook for `data` (can be NULL)
+ * @param owner Argument passed to owner_release
+ * @return ARROW_IPC_OK on success, error code otherwise
+ */
+int arrow_ipc_read_array_stream(
+    const uint8_t* data,
+    size_t size,
+    ArrowIPCOwnerRelease owner_release,
+    void* owner,
+    struct ArrowArrayStream* out
+);
+
+/*
+ * Read an IPC stream or file from disk
+ */
+int arrow_ipc_read_array_stream_from_path(
+    const char* path,
+    struct ArrowArrayStream* out
+);
+
+/*
+ * Read IPC messages incrementally from a file descriptor or pipe. get_next
+ * blocks until the next batch has arrived and returns end of stream at the
+ * end-of-stream marker or EOF. Each batch owns the message it was read
+ * from, so only the batches still alive are kept in memory. The file format
+ * is accepted too: its embedded stream is read and the footer is ignored.
+ * The descriptor is not closed; it must stay open until the stream is
+ * released.
+ *
+ * @return ARROW_IPC_OK once the Schema message has been read, error code otherwise
+ */
+int arrow_ipc_read_array_stream_from_fd(
+    int fd,
+    struct ArrowArrayStream* out
+);
+
+#endif /* ARROW_IPC_STREAM_H */
@@ -0,0 +1,477 @@
+// Enable POSIX extensions for pthread mutexes and posix_memalign
+#define _POSIX_C_SOURCE 200809L
+
+#include "arrow_memory.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// Private: Allocation Header
+// ============================================================================
+
+// Stored in front of every buffer; one alignment unit keeps the buffer
+// aligned when the pool block is
+typedef struct {
+    ArrowMemoryPool* pool;
+    size_t size;            // bytes requested by the caller
+    int32_t subsystem;      // ArrowMemorySubsystem the buffer is counted against
+} MemHeader;
+
+#define MEM_HEADER_SIZE ARROW_BUFFER_ALIGNMENT
+
+typedef char mem_header_fits[sizeof(MemHeader) <= MEM_HEADER_SIZE ? 1 : -1];
+
+static inline MemHeader* mem_header(void* ptr) {
+    return (MemHeader*)((uint8_t*)ptr - MEM_HEADER_SIZE);
+}
+
+// Buffer size rounded up to the alignment (0 on overflow)
+static inline size_t mem_padded_size(size_t size) {
+    if (size > SIZE_MAX - MEM_HEADER_SIZE - (ARROW_BUFFER_ALIGNMENT - 1)) return 0;
+    return (size + ARROW_BUFFER_ALIGNMENT - 1) & ~(size_t)(ARROW_BUFFER_ALIGNMENT - 1);
+}
+
+static void* aligned_block(size_t size) {
+    void* ptr = NULL;
+    return posix_memalign(&ptr, ARROW_BUFFER_ALIGNMENT, size) == 0 ? ptr : NULL;
+}
+
+// ============================================================================
+// System Pool
+// ============================================================================
+
+static void* system_allocate(ArrowMemoryPool* pool, size_t size) {
+    (void)pool;
+    return aligned_block(size);
+}
+
+static void system_release(ArrowMemoryPool* pool, void* ptr, size_t size) {
+    (void)pool;
+    (void)size;
+    free(ptr);
+}
+
+// realloc does not preserve the alignment, so resizing allocates and copies
+static ArrowMemoryPool system_pool = {
+    system_allocate, NULL, system_release, NULL, NULL, {0}
+};
+
+ArrowMemoryPool* arrow_system_memory_pool(void) {
+    return &system_pool;
+}
+
+// ============================================================================
+// Size-Class Pool
+// ============================================================================
+
+#define SIZE_CLASS_MIN_SHIFT 7     // 128 bytes: header plus one padded unit
+#define SIZE_CLASS_MAX_SHIFT 26    // 64 MiB
+#define SIZE_CLASS_COUNT (SIZE_CLASS_MAX_SHIFT - SIZE_CLASS_MIN_SHIFT + 1)
+#define SIZE_CLASS_DEFAULT_CACHE ((size_t)64 << 20)
+
+typedef struct FreeBlock {
+    struct FreeBlock* next;
+} FreeBlock;
+
+typedef struct {
+    ArrowMemoryPool base;
+    pthread_mutex_t lock;
+    FreeBlock* free_lists[SIZE_CLASS_COUNT];
+    size_t cached_bytes;
+    size_t max_cached_bytes;
+} SizeClassPool;
+
+// Index of the smallest class holding `size` bytes (SIZE_CLASS_COUNT if none)
+static size_t size_class_of(size_t size) {
+    size_t shift = SIZE_CLASS_MIN_SHIFT;
+    while (shift <= SIZE_CLASS_MAX_SHIFT && ((size_t)1 << shift) < size) shift++;
+    return shift - SIZE_CLASS_MIN_SHIFT;
+}
+
+static inline size_t size_class_bytes(size_t cls) {
+    return (size_t)1 << (cls + SIZE_CLASS_MIN_SHIFT);
+}
+
+static void* size_class_allocate(ArrowMemoryPool* base, size_t size) {
+    SizeClassPool* pool = (SizeClassPool*)base;
+    size_t cls = size_class_of(size);
+    if (cls >= SIZE_CLASS_COUNT) return aligned_block(size);
+
+    pthread_mutex_lock(&pool->lock);
+    FreeBlock* block = pool->free_lists[cls];
+    if (block) {
+        pool->free_lists[cls] = block->next;
+        pool->cached_bytes -= size_class_bytes(cls);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return block ? (void*)block : aligned_block(size_class_bytes(cls));
+}
+
+static void size_class_release(ArrowMemoryPool* base, void* ptr, size_t size) {
+    SizeClassPool* pool = (SizeClassPool*)base;
+    size_t cls = size_class_of(size);
+    if (cls >= SIZE_CLASS_COUNT) {
+        free(ptr);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    int cache = pool->cached_bytes + size_class_bytes(cls) <= pool->max_cached_bytes;
+    if (cache) {
+        FreeBlock* block = (FreeBlock*)ptr;
+        block->next = pool->free_lists[cls];
+        pool->free_lists[cls] = block;
+        pool->cached_bytes += size_class_bytes(cls);
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    if (!cache) free(ptr);
+}
+
+static void* size_class_reallocate(ArrowMemoryPool* base, void* ptr, size_t old_size, size_t new_size) {
+    size_t old_cls = size_class_of(old_size);
+    if (old_cls < SIZE_CLASS_COUNT && old_cls == size_class_of(new_size)) return ptr;
+
+    void* new_ptr = size_class_allocate(base, new_size);
+    if (!new_ptr) return NULL;
+    memcpy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+    size_class_release(base, ptr, old_size);
+    return new_ptr;
+}
+
+static void size_class_destroy(ArrowMemoryPool* base) {
+    SizeClassPool* pool = (SizeClassPool*)base;
+    for (size_t cls = 0; cls < SIZE_CLASS_COUNT; cls++) {
+        FreeBlock* block = pool->free_lists[cls];
+        while (block) {
+            FreeBlock* next = block->next;
+            free(block);
+            block = next;
+        }
+    }
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+}
+
+ArrowMemoryPool* arrow_size_class_memory_pool_create(size_t max_cached_bytes) {
+    SizeClassPool* pool = calloc(1, sizeof(SizeClassPool));
+    if (!pool) return NULL;
+    if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+        free(pool);
+        return NULL;
+    }
+    pool->max_cached_bytes = max_cached_bytes ? max_cached_bytes : SIZE_CLASS_DEFAULT_CACHE;
+    pool->base.allocate = size_class_allocate;
+    pool->base.reallocate = size_class_reallocate;
+    pool->base.release = size_class_release;
+    pool->base.destroy = size_class_destroy;
+    return &pool->base;
+}
+
+// ============================================================================
+// Arena Pool
+// ============================================================================
+
+#define ARENA_ALIGNMENT ARROW_BUFFER_ALIGNMENT
+#define ARENA_DEFAULT_BLOCK_SIZE ((size_t)1 << 20)
+
+typedef struct ArenaBlock {
+    struct ArenaBlock* next;
+    size_t size;        // usable bytes after the block header
+    size_t used;
+    size_t last;        // offset of the most recent allocation
+} ArenaBlock;
+
+#define ARENA_BLOCK_HEADER (((sizeof(ArenaBlock) + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT) * ARENA_ALIGNMENT)
+
+typedef struct {
+    ArrowMemoryPool base;
+    pthread_mutex_t lock;
+    ArenaBlock* blocks;     // current block first
+    size_t block_size;
+} ArenaPool;
+
+static inline size_t arena_round(size_t size) {
+    return (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+}
+
+static inline uint8_t* arena_block_data(ArenaBlock* block) {
+    return (uint8_t*)block + ARENA_BLOCK_HEADER;
+}
+
+// Caller holds the lock
+static void* arena_bump(ArenaPool* pool, size_t size) {
+    size_t rounded = arena_round(size);
+    if (rounded < size) return NULL;
+
+    ArenaBlock* block = pool->blocks;
+    if (!block || block->size - block->used < rounded) {
+        size_t capacity = rounded > pool->block_size ? rounded : pool->block_size;
+        block = aligned_block(ARENA_BLOCK_HEADER + capacity);
+        if (!block) return NULL;
+        block->size = capacity;
+        block->used = 0;
+        block->last = 0;
+        if (rounded > pool->block_size && pool->blocks) {
+            // Oversized allocations get their own block behind the current one
+            block->next = pool->blocks->next;
+            pool->blocks->next = block;
+        } else {
+            block->next = pool->blocks;
+            pool->blocks = block;
+        }
+    }
+
+    void* ptr = arena_block_data(block) + block->used;
+    block->last = block->used;
+    block->used += rounded;
+    return ptr;
+}
+
+static void* arena_allocate(ArrowMemoryPool* base, size_t size) {
+    ArenaPool* pool = (ArenaPool*)base;
+    pthread_mutex_lock(&pool->lock);
+    void* ptr = arena_bump(pool, size);
+    pthread_mutex_unlock(&pool->lock);
+    return ptr;
+}
+
+// The most recent allocation grows in place; anything else is copied
+static void* arena_reallocate(ArrowMemoryPool* base, void* ptr, size_t old_size, size_t new_size) {
+    ArenaPool* pool = (ArenaPool*)base;
+    pthread_mutex_lock(&pool->lock);
+
+    ArenaBlock* block = pool->blocks;
+    size_t rounded = arena_round(new_size);
+    if (block && rounded >= new_size && (uint8_t*)ptr == arena_block_data(block) + block->last &&
+        block->size - block->last >= rounded) {
+        block->used = block->last + rounded;
+        pthread_mutex_unlock(&pool->lock);
+        return ptr;
+    }
+
+    void* new_ptr = arena_bump(pool, new_size);
+    pthread_mutex_unlock(&pool->lock);
+    if (new_ptr) memcpy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+    return new_ptr;
+}
+
+static void arena_release(ArrowMemoryPool* base, void* ptr, size_t size) {
+    (void)base;
+    (void)ptr;
+    (void)size;
+}
+
+static void arena_destroy(ArrowMemoryPool* base) {
+    ArenaPool* pool = (ArenaPool*)base;
+    ArenaBlock* block = pool->blocks;
+    while (block) {
+        ArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+}
+
+ArrowMemoryPool* arrow_arena_memory_pool_create(size_t block_size) {
+    ArenaPool* pool = calloc(1, sizeof(ArenaPool));
+    if (!pool) return NULL;
+    if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+        free(pool);
+        return NULL;
+    }
+    pool->block_size = block_size ? block_size : ARENA_DEFAULT_BLOCK_SIZE;
+    pool->base.allocate = arena_allocate;
+    pool->base.reallocate = arena_reallocate;
+    pool->base.release = arena_release;
+    pool->base.destroy = arena_destroy;
+    return &pool->base;
+}
+
+void arrow_memory_pool_destroy(ArrowMemoryPool* pool) {
+    if (pool && pool->destroy) pool->destroy(pool);
+}
+
+// ============================================================================
+// Pool Selection
+// ============================================================================
+
+static ArrowMemoryPool* default_pool = &system_pool;
+static __thread ArrowMemoryPool* thread_pool = NULL;
+
+void arrow_memory_pool_set_default(ArrowMemoryPool* pool) {
+    default_pool = pool ? pool : &system_pool;
+}
+
+ArrowMemoryPool* arrow_memory_pool_default(void) {
+    return default_pool;
+}
+
+ArrowMemoryPool* arrow_memory_pool_set_thread(ArrowMemoryPool* pool) {
+    ArrowMemoryPool* previous = thread_pool;
+    thread_pool = pool;
+    return previous;
+}
+
+ArrowMemoryPool* arrow_memory_pool_current(void) {
+    return thread_pool ? thread_pool : default_pool;
+}
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+// Counters are updated with atomic builtins; readers see each field
+// consistently but not a snapshot across fields
+
+static ArrowMemoryStats global_stats;
+
+static inline void counter_add(int64_t* counter, int64_t delta) {
+    __atomic_fetch_add(counter, delta, __ATOMIC_RELAXED);
+}
+
+static inline int64_t counter_load(const int64_t* counter) {
+    return __atomic_load_n(counter, __ATOMIC_RELAXED);
+}
+
+static void live_add(ArrowMemoryStats* stats, int32_t subsystem, int64_t bytes) {
+    int64_t live = __atomic_add_fetch(&stats->bytes_live, bytes, __ATOMIC_RELAXED);
+    int64_t peak = counter_load(&stats->peak_bytes_live);
+    while (live > peak &&
+           !__atomic_compare_exchange_n(&stats->peak_bytes_live, &peak, live, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+    counter_add(&stats->subsystems[subsystem].bytes_live, bytes);
+}
+
+static void stats_allocated(ArrowMemoryStats* stats, int32_t subsystem, int64_t bytes) {
+    counter_add(&stats->bytes_allocated, bytes);
+    counter_add(&stats->allocations, 1);
+    counter_add(&stats->live_allocations, 1);
+    counter_add(&stats->subsystems[subsystem].allocations, 1);
+    live_add(stats, subsystem, bytes);
+}
+
+static void stats_resized(ArrowMemoryStats* stats, int32_t subsystem, int64_t old_bytes, int64_t bytes) {
+    if (bytes > old_bytes) counter_add(&stats->bytes_allocated, bytes - old_bytes);
+    live_add(stats, subsystem, bytes - old_bytes);
+}
+
+static void stats_released(ArrowMemoryStats* stats, int32_t subsystem, int64_t bytes) {
+    counter_add(&stats->bytes_live, -bytes);
+    counter_add(&stats->live_allocations, -1);
+    counter_add(&stats->subsystems[subsystem].bytes_live, -bytes);
+}
+
+static void stats_copy(const ArrowMemoryStats* stats, ArrowMemoryStats* out) {
+    out->bytes_allocated = counter_load(&stats->bytes_allocated);
+    out->bytes_live = counter_load(&stats->bytes_live);
+    out->peak_bytes_live = counter_load(&stats->peak_bytes_live);
+    out->allocations = counter_load(&stats->allocations);
+    out->live_allocations = counter_load(&stats->live_allocations);
+    for (int i = 0; i < ARROW_MEMORY_SUBSYSTEM_COUNT; i++) {
+        out->subsystems[i].allocations = counter_load(&stats->subsystems[i].allocations);
+        out->subsystems[i].bytes_live = counter_load(&stats->subsystems[i].bytes_live);
+    }
+}
+
+void arrow_memory_stats(ArrowMemoryStats* out) {
+    if (out) stats_copy(&global_stats, out);
+}
+
+void arrow_memory_pool_stats(const ArrowMemoryPool* pool, ArrowMemoryStats* out) {
+    if (pool && out) stats_copy(&pool->stats, out);
+}
+
+const char* arrow_memory_subsystem_name(ArrowMemorySubsystem subsystem) {
+    switch (subsystem) {
+        case ARROW_MEMORY_BUILDERS: return "builders";
+        case ARROW_MEMORY_COMPUTE: return "compute";
+        case ARROW_MEMORY_PARQUET: return "parquet";
+        case ARROW_MEMORY_IPC: return "ipc";
+        case ARROW_MEMORY_OTHER: return "other";
+        default: return "unknown";
+    }
+}
+
+// ============================================================================
+// Buffer Allocation
+// ============================================================================
+
+void* arrow_mem_alloc_in(ArrowMemorySubsystem subsystem, size_t size) {
+    if ((unsigned)subsystem >= ARROW_MEMORY_SUBSYSTEM_COUNT) subsystem = ARROW_MEMORY_OTHER;
+    size_t padded = mem_padded_size(size);
+    if (padded < size) return NULL;
+
+    ArrowMemoryPool* pool = arrow_memory_pool_current();
+    uint8_t* block = pool->allocate(pool, MEM_HEADER_SIZE + padded);
+    if (!block) return NULL;
+
+    MemHeader* header = (MemHeader*)block;
+    header->pool = pool;
+    header->size = size;
+    header->subsystem = subsystem;
+    // Zeroed padding keeps over-reads deterministic
+    memset(block + MEM_HEADER_SIZE + size, 0, padded - size);
+
+    stats_allocated(&global_stats, subsystem, (int64_t)padded);
+    stats_allocated(&pool->stats, subsystem, (int64_t)padded);
+    return block + MEM_HEADER_SIZE;
+}
+
+void* arrow_mem_calloc_in(ArrowMemorySubsystem subsystem, size_t count, size_t size) {
+    if (size != 0 && count > SIZE_MAX / size) return NULL;
+    void* ptr = arrow_mem_alloc_in(subsystem, count * size);
+    if (ptr) memset(ptr, 0, count * size);
+    return ptr;
+}
+
+void* arrow_mem_realloc_in(ArrowMemorySubsystem subsystem, void* ptr, size_t size) {
+    if (!ptr) return arrow_mem_alloc_in(subsystem, size);
+    size_t padded = mem_padded_size(size);
+    if (padded < size) return NULL;
+
+    MemHeader* header = mem_header(ptr);
+    ArrowMemoryPool* pool = header->pool;
+    size_t old_size = header->size;
+    size_t old_padded = mem_padded_size(old_size);
+    uint8_t* block;
+
+    if (padded == old_padded) {
+        block = (uint8_t*)header;
+    } else if (pool->reallocate) {
+        block = pool->reallocate(pool, header, MEM_HEADER_SIZE + old_padded, MEM_HEADER_SIZE + padded);
+        if (!block) return NULL;
+    } else {
+        block = pool->allocate(pool, MEM_HEADER_SIZE + padded);
+        if (!block) return NULL;
+        memcpy(block, header, MEM_HEADER_SIZE + (old_size < size ? old_size : size));
+        pool->release(pool, header, MEM_HEADER_SIZE + old_padded);
+    }
+
+    header = (MemHeader*)block;
+    header->pool = pool;
+    header->size = size;
+    memset(block + MEM_HEADER_SIZE + size, 0, padded - size);
+
+    if (padded != old_padded) {
+        stats_resized(&global_stats, header->subsystem, (int64_t)old_padded, (int64_t)padded);
+        stats_resized(&pool->stats, header->subsystem, (int64_t)old_padded, (int64_t)padded);
+    }
+    return block + MEM_HEADER_SIZE;
+}
+
+void arrow_mem_free(void* ptr) {
+    if (!ptr) return;
+    MemHeader* header = mem_header(ptr);
+    ArrowMemoryPool* pool = header->pool;
+    int64_t padded = (int64_t)mem_padded_size(header->size);
+    stats_released(&global_stats, header->subsystem, padded);
+    stats_released(&pool->stats, header->subsystem, padded);
+    pool->release(pool, header, MEM_HEADER_SIZE + (size_t)padded);
+}
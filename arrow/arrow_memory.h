@@ -0,0 +1,167 @@
+/*
+ * Arrow Memory Pools
+ *
+ * Arrow buffers allocated by this library (builders, compute kernels, IPC
+ * and Parquet readers) come from a memory pool through arrow_mem_alloc and
+ * friends. Each allocation is preceded by a small header recording its pool
+ * and size. arrow_mem_free can therefore return a buffer to the pool it came
+ * from, whichever thread releases the array. Array structs, children
+ * pointers and other bookkeeping still use malloc.
+ *
+ * Every buffer is ARROW_BUFFER_ALIGNMENT (64) byte aligned and padded with
+ * zeros to a multiple of 64 bytes, as the Arrow format recommends. Kernels
+ * working on buffers from this library may read whole 64-byte vectors up to
+ * the padded end; arrays imported from other producers carry no such
+ * guarantee.
+ *
+ * Pools:
+ *   system      posix_memalign/free (the default)
+ *   size-class  power-of-two size classes with per-class free lists;
+ *               released blocks are kept for reuse up to a byte limit
+ *   arena       bump allocation from large blocks; releasing a buffer is a
+ *               no-op and all memory is freed by arrow_memory_pool_destroy
+ *
+ * New buffers come from the calling thread's pool if one is set, otherwise
+ * from the process default. For a per-query arena, set it on the thread
+ * running the query and destroy it once every array built from it has been
+ * released.
+ *
+ * Allocations are counted globally and per pool, broken down by the
+ * subsystem that made them. A source file selects its subsystem by
+ * defining ARROW_MEMORY_SUBSYSTEM before including this header.
+ * Counts follow the buffers rather than the ArrowArray structs, so arrays
+ * handed out with release = NULL (e.g. stream batches owned by their
+ * stream) stay live until their owner frees them.
+ */
+
+#ifndef ARROW_MEMORY_H
+#define ARROW_MEMORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ARROW_BUFFER_ALIGNMENT 64
+
+typedef struct ArrowMemoryPool ArrowMemoryPool;
+
+typedef enum {
+    ARROW_MEMORY_BUILDERS = 0,
+    ARROW_MEMORY_COMPUTE = 1,
+    ARROW_MEMORY_PARQUET = 2,
+    ARROW_MEMORY_IPC = 3,
+    ARROW_MEMORY_OTHER = 4,
+    ARROW_MEMORY_SUBSYSTEM_COUNT = 5
+} ArrowMemorySubsystem;
+
+typedef struct {
+    int64_t allocations;        // buffers allocated so far
+    int64_t bytes_live;         // bytes held by unreleased buffers
+} ArrowMemorySubsystemStats;
+
+// Byte counts include padding to ARROW_BUFFER_ALIGNMENT but not the pool's
+// own overhead or cached blocks
+typedef struct {
+    int64_t bytes_allocated;    // total bytes ever allocated (growth included)
+    int64_t bytes_live;
+    int64_t peak_bytes_live;
+    int64_t allocations;        // arrow_mem_alloc/calloc calls; resizes are not counted
+    int64_t live_allocations;
+    ArrowMemorySubsystemStats subsystems[ARROW_MEMORY_SUBSYSTEM_COUNT];
+} ArrowMemoryStats;
+
+/*
+ * Pool interface. Custom pools (e.g. backed by jemalloc) fill in the hooks;
+ * blocks must be ARROW_BUFFER_ALIGNMENT byte aligned. Sizes passed to the
+ * hooks are always multiples of the alignment.
+ */
+struct ArrowMemoryPool {
+    // Allocate `size` bytes (NULL on failure)
+    void* (*allocate)(ArrowMemoryPool* pool, size_t size);
+    // Resize a block of this pool (NULL: allocate, copy and release)
+    void* (*reallocate)(ArrowMemoryPool* pool, void* ptr, size_t old_size, size_t new_size);
+    // Give back a block of `size` bytes
+    void (*release)(ArrowMemoryPool* pool, void* ptr, size_t size);
+    // Free the pool and anything it caches (NULL for static pools)
+    void (*destroy)(ArrowMemoryPool* pool);
+    void* private_data;
+    // Maintained by arrow_mem_*; zero-initialise in custom pools
+    ArrowMemoryStats stats;
+};
+
+// ============================================================================
+// Pools
+// ============================================================================
+
+// posix_memalign/free; never destroyed
+ArrowMemoryPool* arrow_system_memory_pool(void);
+
+// Size-class pool caching up to `max_cached_bytes` of released blocks
+// (0: 64 MiB). Blocks over 64 MiB bypass the cache.
+ArrowMemoryPool* arrow_size_class_memory_pool_create(size_t max_cached_bytes);
+
+// Arena allocating `block_size` chunks (0: 1 MiB); buffers are freed only
+// when the arena is destroyed
+ArrowMemoryPool* arrow_arena_memory_pool_create(size_t block_size);
+
+// Destroy a pool. Every buffer allocated from it must have been released.
+void arrow_memory_pool_destroy(ArrowMemoryPool* pool);
+
+// ============================================================================
+// Pool Selection
+// ============================================================================
+
+// Process-wide pool (NULL restores the system pool)
+void arrow_memory_pool_set_default(ArrowMemoryPool* pool);
+ArrowMemoryPool* arrow_memory_pool_default(void);
+
+// Pool for allocations made by the calling thread (NULL: use the default).
+// Returns the previous thread pool, so scopes can be nested.
+ArrowMemoryPool* arrow_memory_pool_set_thread(ArrowMemoryPool* pool);
+
+// Pool new buffers come from on this thread
+ArrowMemoryPool* arrow_memory_pool_current(void);
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+// Counters across all pools
+void arrow_memory_stats(ArrowMemoryStats* out);
+
+// Counters for buffers allocated from `pool`
+void arrow_memory_pool_stats(const ArrowMemoryPool* pool, ArrowMemoryStats* out);
+
+// Lower-case name for metrics labels ("builders", "compute", ...)
+const char* arrow_memory_subsystem_name(ArrowMemorySubsystem subsystem);
+
+// ============================================================================
+// Buffer Allocation
+// ============================================================================
+
+// Like malloc/calloc/realloc/free, for Arrow buffers: aligned and padded as
+// described above. A buffer from these functions must be freed with
+// arrow_mem_free, never free().
+// arrow_mem_realloc keeps a buffer in the pool and subsystem it was
+// allocated in; the subsystem argument only applies when ptr is NULL.
+void* arrow_mem_alloc_in(ArrowMemorySubsystem subsystem, size_t size);
+void* arrow_mem_calloc_in(ArrowMemorySubsystem subsystem, size_t count, size_t size);
+void* arrow_mem_realloc_in(ArrowMemorySubsystem subsystem, void* ptr, size_t size);
+void arrow_mem_free(void* ptr);
+
+#ifndef ARROW_MEMORY_SUBSYSTEM
+#define ARROW_MEMORY_SUBSYSTEM ARROW_MEMORY_OTHER
+#endif
+
+#define arrow_mem_alloc(size) arrow_mem_alloc_in(ARROW_MEMORY_SUBSYSTEM, (size))
+#define arrow_mem_calloc(count, size) arrow_mem_calloc_in(ARROW_MEMORY_SUBSYSTEM, (count), (size))
+#define arrow_mem_realloc(ptr, size) arrow_mem_realloc_in(ARROW_MEMORY_SUBSYSTEM, (ptr), (size))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARROW_MEMORY_H
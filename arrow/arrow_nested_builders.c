@@ -2,6 +2,8 @@
 #define _POSIX_C_SOURCE 200809L
 
 #include "arrow_nested_builders.h"
+#define ARROW_MEMORY_SUBSYSTEM ARROW_MEMORY_BUILDERS
+#include "arrow_memory.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -123,8 +125,8 @@ static void list_array_release(struct ArrowArray* array) {
 
     ListArrayPrivateData* priv = (ListArrayPrivateData*)array->private_data;
     if (priv) {
-        free(priv->validity);
-        free(priv->offsets);
+        arrow_mem_free(priv->validity);
+        arrow_mem_free(priv->offsets);
         if (priv->child && priv->child->release) {
             priv->child->release(priv->child);
         }
@@ -148,13 +150,13 @@ ListBuilder* list_builder_create(size_t initial_capacity, ListElementType elemen
     ListBuilder* builder = calloc(1, sizeof(ListBuilder));
     if (!builder) return NULL;
 
-    builder->offsets = malloc((initial_capacity + 1) * sizeof(int32_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->offsets = arrow_mem_alloc((initial_capacity + 1) * sizeof(int32_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->child_builder = create_child_builder(element_type, initial_capacity * 4);
 
     if (!builder->offsets || !builder->validity || !builder->child_builder) {
-        free(builder->offsets);
-        free(builder->validity);
+        arrow_mem_free(builder->offsets);
+        arrow_mem_free(builder->validity);
         free_child_builder(builder->child_builder, element_type);
         free(builder);
         return NULL;
@@ -173,13 +175,13 @@ static int list_builder_ensure_capacity(ListBuilder* builder) {
 
     size_t new_capacity = builder->capacity * 2;
 
-    int32_t* new_offsets = realloc(builder->offsets, (new_capacity + 1) * sizeof(int32_t));
+    int32_t* new_offsets = arrow_mem_realloc(builder->offsets, (new_capacity + 1) * sizeof(int32_t));
     if (!new_offsets) return BUILDER_ERR_ALLOC;
     builder->offsets = new_offsets;
 
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -394,8 +396,8 @@ struct ArrowArray* list_builder_finish(ListBuilder* builder) {
 
 void list_builder_free(ListBuilder* builder) {
     if (!builder) return;
-    free(builder->validity);
-    free(builder->offsets);
+    arrow_mem_free(builder->validity);
+    arrow_mem_free(builder->offsets);
     free_child_builder(builder->child_builder, builder->element_type);
     free(builder);
 }
@@ -419,7 +421,7 @@ static void struct_array_release(struct ArrowArray* array) {
 
     StructArrayPrivateData* priv = (StructArrayPrivateData*)array->private_data;
     if (priv) {
-        free(priv->validity);
+        arrow_mem_free(priv->validity);
         if (priv->children) {
             for (size_t i = 0; i < priv->num_children; i++) {
                 if (priv->children[i] && priv->children[i]->release) {
@@ -448,7 +450,7 @@ StructBuilder* struct_builder_create(size_t initial_capacity) {
     StructBuilder* builder = calloc(1, sizeof(StructBuilder));
     if (!builder) return NULL;
 
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     if (!builder->validity) {
         free(builder);
         return NULL;
@@ -502,7 +504,7 @@ static int struct_builder_ensure_capacity(StructBuilder* builder) {
 
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -801,7 +803,7 @@ struct ArrowSchema* struct_builder_get_schema(StructBuilder* builder) {
 void struct_builder_free(StructBuilder* builder) {
     if (!builder) return;
 
-    free(builder->validity);
+    arrow_mem_free(builder->validity);
 
     for (size_t i = 0; i < builder->num_fields; i++) {
         free_child_builder(builder->field_builders[i], builder->field_types[i]);
@@ -838,8 +840,8 @@ static void decimal128_array_release(struct ArrowArray* array) {
 
     Decimal128ArrayPrivateData* priv = (Decimal128ArrayPrivateData*)array->private_data;
     if (priv) {
-        free(priv->validity);
-        free(priv->values);
+        arrow_mem_free(priv->validity);
+        arrow_mem_free(priv->values);
         free(priv);
     }
 
@@ -858,12 +860,12 @@ Decimal128Builder* decimal128_builder_create(size_t initial_capacity, int32_t pr
     Decimal128Builder* builder = calloc(1, sizeof(Decimal128Builder));
     if (!builder) return NULL;
 
-    builder->values = calloc(initial_capacity, 16);  // 16 bytes per decimal128
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->values = arrow_mem_calloc(initial_capacity, 16);  // 16 bytes per decimal128
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
 
     if (!builder->values || !builder->validity) {
-        free(builder->values);
-        free(builder->validity);
+        arrow_mem_free(builder->values);
+        arrow_mem_free(builder->validity);
         free(builder);
         return NULL;
     }
@@ -880,14 +882,14 @@ static int decimal128_builder_ensure_capacity(Decimal128Builder* builder) {
 
     size_t new_capacity = builder->capacity * 2;
 
-    uint8_t* new_values = realloc(builder->values, new_capacity * 16);
+    uint8_t* new_values = arrow_mem_realloc(builder->values, new_capacity * 16);
     if (!new_values) return BUILDER_ERR_ALLOC;
     memset(new_values + builder->capacity * 16, 0, builder->capacity * 16);
     builder->values = new_values;
 
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -1024,8 +1026,8 @@ struct ArrowArray* decimal128_builder_finish(Decimal128Builder* builder) {
 
 void decimal128_builder_free(Decimal128Builder* builder) {
     if (!builder) return;
-    free(builder->validity);
-    free(builder->values);
+    arrow_mem_free(builder->validity);
+    arrow_mem_free(builder->values);
     free(builder);
 }
 
@@ -1066,8 +1068,8 @@ static void dict_array_release(struct ArrowArray* array) {
 
     DictArrayPrivateData* priv = (DictArrayPrivateData*)array->private_data;
     if (priv) {
-        free(priv->validity);
-        free(priv->indices);
+        arrow_mem_free(priv->validity);
+        arrow_mem_free(priv->indices);
         if (priv->dictionary && priv->dictionary->release) {
             priv->dictionary->release(priv->dictionary);
         }
@@ -1089,8 +1091,8 @@ DictionaryBuilder* dictionary_builder_create(size_t initial_capacity, size_t dic
     DictionaryBuilder* builder = calloc(1, sizeof(DictionaryBuilder));
     if (!builder) return NULL;
 
-    builder->indices = malloc(initial_capacity * sizeof(int32_t));
-    builder->validity = calloc(bitmap_byte_count(initial_capacity), 1);
+    builder->indices = arrow_mem_alloc(initial_capacity * sizeof(int32_t));
+    builder->validity = arrow_mem_calloc(bitmap_byte_count(initial_capacity), 1);
     builder->dictionary = string_builder_create(dict_capacity, dict_capacity * 32);
 
     // Hash table for deduplication
@@ -1100,8 +1102,8 @@ DictionaryBuilder* dictionary_builder_create(size_t initial_capacity, size_t dic
 
     if (!builder->indices || !builder->validity || !builder->dictionary ||
         !builder->hash_keys || !builder->hash_values) {
-        free(builder->indices);
-        free(builder->validity);
+        arrow_mem_free(builder->indices);
+        arrow_mem_free(builder->validity);
         if (builder->dictionary) string_builder_free(builder->dictionary);
         free(builder->hash_keys);
         free(builder->hash_values);
@@ -1123,13 +1125,13 @@ static int dictionary_builder_ensure_capacity(DictionaryBuilder* builder) {
 
     size_t new_capacity = builder->capacity * 2;
 
-    int32_t* new_indices = realloc(builder->indices, new_capacity * sizeof(int32_t));
+    int32_t* new_indices = arrow_mem_realloc(builder->indices, new_capacity * sizeof(int32_t));
     if (!new_indices) return BUILDER_ERR_ALLOC;
     builder->indices = new_indices;
 
     size_t old_bitmap_size = bitmap_byte_count(builder->capacity);
     size_t new_bitmap_size = bitmap_byte_count(new_capacity);
-    uint8_t* new_validity = realloc(builder->validity, new_bitmap_size);
+    uint8_t* new_validity = arrow_mem_realloc(builder->validity, new_bitmap_size);
     if (!new_validity) return BUILDER_ERR_ALLOC;
     memset(new_validity + old_bitmap_size, 0, new_bitmap_size - old_bitmap_size);
     builder->validity = new_validity;
@@ -1260,8 +1262,8 @@ struct ArrowArray* dictionary_builder_finish(DictionaryBuilder* builder, struct
 void dictionary_builder_free(DictionaryBuilder* builder) {
     if (!builder) return;
 
-    free(builder->validity);
-    free(builder->indices);
+    arrow_mem_free(builder->validity);
+    arrow_mem_free(builder->indices);
     if (builder->dictionary) string_builder_free(builder->dictionary);
 
     // Free hash table keys
@@ -35,10 +35,11 @@ static int arrow_stream_get_next_internal(struct ArrowArrayStream* stream, struc
         return 0;
     }
     
-    // Copy the next array
+    // Move the next array to the consumer, which now releases it
     struct ArrowArray* next_array = private_data->arrays[private_data->current_index];
     if (next_array) {
         memcpy(out, next_array, sizeof(struct ArrowArray));
+        next_array->release = NULL;
         private_data->current_index++;
         return 0;
     }
@@ -68,13 +69,13 @@ static void arrow_stream_release_internal(struct ArrowArrayStream* stream) {
             free(private_data->schema);
         }
         
-        // Release arrays
+        // Release arrays not yet moved out
         if (private_data->arrays) {
             for (size_t i = 0; i < private_data->array_count; i++) {
                 if (private_data->arrays[i] && private_data->arrays[i]->release) {
                     private_data->arrays[i]->release(private_data->arrays[i]);
-                    free(private_data->arrays[i]);
                 }
+                free(private_data->arrays[i]);
             }
             free(private_data->arrays);
         }
@@ -0,0 +1,395 @@
+// Enable POSIX extensions for sysconf
+#define _POSIX_C_SOURCE 200809L
+
+/**
+ * arrow_thread_pool.c - Work-stealing pool for data-parallel kernels
+ */
+
+#include "arrow_thread_pool.h"
+#include "arrow_memory.h"
+#include <pthread.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DEQUE_INITIAL_CAPACITY 64
+
+// ============================================================================
+// Loops and Deques
+// ============================================================================
+
+// One arrow_parallel_for call; lives on the caller's stack
+typedef struct {
+    ArrowParallelFn fn;
+    void* ctx;
+    size_t grain;
+    ArrowMemoryPool* pool;      // the caller's pool, used by every piece
+    pthread_mutex_t lock;
+    pthread_cond_t done;
+    size_t remaining;           // indices not yet finished, under lock
+} Loop;
+
+typedef struct {
+    Loop* loop;
+    size_t begin;
+    size_t end;
+} Task;
+
+// Ring of tasks. The owner pushes and pops at the bottom (newest); thieves
+// take from the top (oldest).
+typedef struct {
+    pthread_mutex_t lock;
+    Task* tasks;
+    size_t head;        // top
+    size_t count;
+    size_t capacity;
+} Deque;
+
+static bool deque_init(Deque* dq) {
+    dq->tasks = (Task*)malloc(DEQUE_INITIAL_CAPACITY * sizeof(Task));
+    if (!dq->tasks) return false;
+    if (pthread_mutex_init(&dq->lock, NULL) != 0) {
+        free(dq->tasks);
+        return false;
+    }
+    dq->head = 0;
+    dq->count = 0;
+    dq->capacity = DEQUE_INITIAL_CAPACITY;
+    return true;
+}
+
+static void deque_destroy(Deque* dq) {
+    pthread_mutex_destroy(&dq->lock);
+    free(dq->tasks);
+}
+
+static bool deque_push(Deque* dq, Task task) {
+    pthread_mutex_lock(&dq->lock);
+    if (dq->count == dq->capacity) {
+        Task* grown = (Task*)malloc(2 * dq->capacity * sizeof(Task));
+        if (!grown) {
+            pthread_mutex_unlock(&dq->lock);
+            return false;
+        }
+        for (size_t i = 0; i < dq->count; i++) {
+            grown[i] = dq->tasks[(dq->head + i) % dq->capacity];
+        }
+        free(dq->tasks);
+        dq->tasks = grown;
+        dq->head = 0;
+        dq->capacity *= 2;
+    }
+    dq->tasks[(dq->head + dq->count) % dq->capacity] = task;
+    dq->count++;
+    pthread_mutex_unlock(&dq->lock);
+    return true;
+}
+
+// Take the newest task, if it belongs to `only` (NULL: any loop)
+static bool deque_pop(Deque* dq, const Loop* only, Task* out) {
+    bool found = false;
+    pthread_mutex_lock(&dq->lock);
+    if (dq->count > 0) {
+        Task* bottom = &dq->tasks[(dq->head + dq->count - 1) % dq->capacity];
+        if (!only || bottom->loop == only) {
+            *out = *bottom;
+            dq->count--;
+            found = true;
+        }
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return found;
+}
+
+// Take the oldest task, if it belongs to `only` (NULL: any loop)
+static bool deque_steal(Deque* dq, const Loop* only, Task* out) {
+    bool found = false;
+    pthread_mutex_lock(&dq->lock);
+    if (dq->count > 0) {
+        Task* top = &dq->tasks[dq->head];
+        if (!only || top->loop == only) {
+            *out = *top;
+            dq->head = (dq->head + 1) % dq->capacity;
+            dq->count--;
+            found = true;
+        }
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return found;
+}
+
+// ============================================================================
+// Pool State
+// ============================================================================
+
+typedef struct {
+    int threads;                // workers + 1
+    Deque* deques;              // one per worker, then one shared by callers
+    size_t num_deques;
+    pthread_t* workers;
+    size_t num_workers;
+    size_t next_index;          // deque index handed to the next worker
+
+    // Idle workers sleep until the epoch moves, i.e. a task was pushed
+    pthread_mutex_t idle_lock;
+    pthread_cond_t idle_cond;
+    uint64_t epoch;
+    int sleeping;
+    bool stopping;
+} Pool;
+
+static pthread_mutex_t config_lock = PTHREAD_MUTEX_INITIALIZER;
+static int configured_threads = 0;      // 0: one per online CPU
+static Pool* pool = NULL;               // NULL until first use
+static ArrowThreadHook start_hook = NULL;
+static ArrowThreadHook exit_hook = NULL;
+
+static __thread Deque* own_deque = NULL;    // set on workers
+static __thread size_t own_index = 0;
+static __thread bool hooked = false;
+
+static int resolve_threads(int requested) {
+    if (requested > 0) return requested;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus < 1 ? 1 : (int)cpus;
+}
+
+static void notify_push(Pool* p) {
+    pthread_mutex_lock(&p->idle_lock);
+    __atomic_add_fetch(&p->epoch, 1, __ATOMIC_RELEASE);
+    if (p->sleeping > 0) pthread_cond_signal(&p->idle_cond);
+    pthread_mutex_unlock(&p->idle_lock);
+}
+
+// ============================================================================
+// Running Pieces
+// ============================================================================
+
+static void finish_piece(Loop* loop, size_t indices) {
+    pthread_mutex_lock(&loop->lock);
+    loop->remaining -= indices;
+    if (loop->remaining == 0) pthread_cond_broadcast(&loop->done);
+    pthread_mutex_unlock(&loop->lock);
+}
+
+// Split [begin, end) down to grain, leaving the upper halves on `dq`, and
+// run the lowest piece
+static void run_task(Pool* p, Deque* dq, Task task) {
+    Loop* loop = task.loop;
+    while (task.end - task.begin > loop->grain) {
+        size_t mid = task.begin + (task.end - task.begin) / 2;
+        Task upper = {loop, mid, task.end};
+        if (!deque_push(dq, upper)) break;  // run the rest here instead
+        notify_push(p);
+        task.end = mid;
+    }
+
+    ArrowMemoryPool* previous = arrow_memory_pool_set_thread(loop->pool);
+    loop->fn(loop->ctx, task.begin, task.end);
+    arrow_memory_pool_set_thread(previous);
+    finish_piece(loop, task.end - task.begin);
+}
+
+// Steal from any deque but `self`, starting after it
+static bool steal_any(Pool* p, size_t self, const Loop* only, Task* out) {
+    for (size_t i = 1; i <= p->num_deques; i++) {
+        size_t victim = (self + i) % p->num_deques;
+        if (victim == self) continue;
+        if (deque_steal(&p->deques[victim], only, out)) return true;
+    }
+    return false;
+}
+
+static void* worker_main(void* arg) {
+    Pool* p = (Pool*)arg;
+    own_index = __atomic_fetch_add(&p->next_index, 1, __ATOMIC_RELAXED);
+    own_deque = &p->deques[own_index];
+
+    for (;;) {
+        uint64_t seen = __atomic_load_n(&p->epoch, __ATOMIC_ACQUIRE);
+        Task task;
+        if (deque_pop(own_deque, NULL, &task) || steal_any(p, own_index, NULL, &task)) {
+            if (!hooked) {
+                ArrowThreadHook hook = __atomic_load_n(&start_hook, __ATOMIC_ACQUIRE);
+                if (hook) {
+                    hook();
+                    hooked = true;
+                }
+            }
+            run_task(p, own_deque, task);
+            continue;
+        }
+
+        pthread_mutex_lock(&p->idle_lock);
+        if (p->stopping) {
+            pthread_mutex_unlock(&p->idle_lock);
+            break;
+        }
+        if (p->epoch == seen) {
+            p->sleeping++;
+            pthread_cond_wait(&p->idle_cond, &p->idle_lock);
+            p->sleeping--;
+        }
+        pthread_mutex_unlock(&p->idle_lock);
+    }
+
+    if (hooked) {
+        ArrowThreadHook hook = __atomic_load_n(&exit_hook, __ATOMIC_ACQUIRE);
+        if (hook) hook();
+        hooked = false;
+    }
+    own_deque = NULL;
+    return NULL;
+}
+
+// ============================================================================
+// Start and Stop
+// ============================================================================
+
+static void pool_stop(Pool* p) {
+    pthread_mutex_lock(&p->idle_lock);
+    p->stopping = true;
+    pthread_cond_broadcast(&p->idle_cond);
+    pthread_mutex_unlock(&p->idle_lock);
+
+    for (size_t i = 0; i < p->num_workers; i++) {
+        pthread_join(p->workers[i], NULL);
+    }
+    for (size_t i = 0; i < p->num_deques; i++) {
+        deque_destroy(&p->deques[i]);
+    }
+    pthread_cond_destroy(&p->idle_cond);
+    pthread_mutex_destroy(&p->idle_lock);
+    free(p->workers);
+    free(p->deques);
+    free(p);
+}
+
+static Pool* pool_start(int threads) {
+    Pool* p = (Pool*)calloc(1, sizeof(Pool));
+    if (!p) return NULL;
+
+    size_t workers = (size_t)threads - 1;
+    p->threads = threads;
+    p->deques = (Deque*)calloc(workers + 1, sizeof(Deque));
+    p->workers = (pthread_t*)calloc(workers + 1, sizeof(pthread_t));
+    if (!p->deques || !p->workers ||
+        pthread_mutex_init(&p->idle_lock, NULL) != 0) {
+        free(p->deques);
+        free(p->workers);
+        free(p);
+        return NULL;
+    }
+    pthread_cond_init(&p->idle_cond, NULL);
+
+    while (p->num_deques < workers + 1 && deque_init(&p->deques[p->num_deques])) {
+        p->num_deques++;
+    }
+    if (p->num_deques < workers + 1) {
+        pool_stop(p);
+        return NULL;
+    }
+
+    // Fewer workers than asked for only means less parallelism
+    while (p->num_workers < workers &&
+           pthread_create(&p->workers[p->num_workers], NULL, worker_main, p) == 0) {
+        p->num_workers++;
+    }
+    return p;
+}
+
+static Pool* pool_get(void) {
+    Pool* p = __atomic_load_n(&pool, __ATOMIC_ACQUIRE);
+    if (p) return p;
+
+    pthread_mutex_lock(&config_lock);
+    p = pool;
+    if (!p) {
+        int threads = resolve_threads(configured_threads);
+        if (threads > 1) p = pool_start(threads);
+        if (p) __atomic_store_n(&pool, p, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&config_lock);
+    return p;
+}
+
+int arrow_thread_pool_set_threads(int num_threads) {
+    if (num_threads < 0) return -1;
+
+    pthread_mutex_lock(&config_lock);
+    Pool* p = pool;
+    if (p) {
+        __atomic_store_n(&pool, NULL, __ATOMIC_RELEASE);
+        pool_stop(p);
+    }
+    configured_threads = num_threads;
+    pthread_mutex_unlock(&config_lock);
+    return 0;
+}
+
+int arrow_thread_pool_threads(void) {
+    pthread_mutex_lock(&config_lock);
+    int threads = pool ? pool->threads : resolve_threads(configured_threads);
+    pthread_mutex_unlock(&config_lock);
+    return threads;
+}
+
+void arrow_thread_pool_set_hooks(ArrowThreadHook on_start, ArrowThreadHook on_exit) {
+    __atomic_store_n(&start_hook, on_start, __ATOMIC_RELEASE);
+    __atomic_store_n(&exit_hook, on_exit, __ATOMIC_RELEASE);
+}
+
+// ============================================================================
+// Parallel Loops
+// ============================================================================
+
+void arrow_parallel_for(size_t count, size_t grain, ArrowParallelFn fn, void* ctx) {
+    if (count == 0 || !fn) return;
+    if (grain == 0) grain = 1;
+
+    Pool* p = count > grain ? pool_get() : NULL;
+    if (!p) {
+        for (size_t begin = 0; begin < count; begin += grain) {
+            fn(ctx, begin, count - begin < grain ? count : begin + grain);
+        }
+        return;
+    }
+
+    Loop loop;
+    loop.fn = fn;
+    loop.ctx = ctx;
+    loop.grain = grain;
+    loop.pool = arrow_memory_pool_current();
+    loop.remaining = count;
+    pthread_mutex_init(&loop.lock, NULL);
+    pthread_cond_init(&loop.done, NULL);
+
+    // Callers that are not workers share the last deque
+    size_t self = own_deque ? own_index : p->num_deques - 1;
+    Deque* dq = &p->deques[self];
+    Task whole = {&loop, 0, count};
+    run_task(p, dq, whole);
+
+    // Help with this loop's pieces; sleep once the rest are being run
+    // elsewhere
+    for (;;) {
+        Task task;
+        if (deque_pop(dq, &loop, &task) || steal_any(p, self, &loop, &task)) {
+            run_task(p, dq, task);
+            continue;
+        }
+        pthread_mutex_lock(&loop.lock);
+        bool finished = loop.remaining == 0;
+        if (!finished) {
+            pthread_cond_wait(&loop.done, &loop.lock);
+            finished = loop.remaining == 0;
+        }
+        pthread_mutex_unlock(&loop.lock);
+        if (finished) break;
+    }
+
+    pthread_cond_destroy(&loop.done);
+    pthread_mutex_destroy(&loop.lock);
+}
@@ -0,0 +1,60 @@
+/*
+ * Arrow Thread Pool
+ *
+ * A process-wide work-stealing pool for data-parallel kernels. Work is
+ * submitted as arrow_parallel_for over an index range. A range is split in
+ * halves down to `grain`; the thread splitting it keeps the halves on its
+ * own deque and runs the newest first, while idle workers steal the oldest,
+ * largest pieces from other deques. A thread waiting for its loop runs the
+ * loop's pending pieces meanwhile, so loops may nest inside loop bodies.
+ *
+ * The pool starts on first use with one thread per online CPU, the calling
+ * thread included. Tasks allocate Arrow buffers from the memory pool that
+ * was current on the thread calling arrow_parallel_for.
+ *
+ * Kernels built on the pool split their input into fixed ARROW_MORSEL_ROWS
+ * morsels and combine per-morsel results in index order, so results,
+ * including float sums, do not depend on the thread count or on
+ * scheduling.
+ */
+
+#ifndef ARROW_THREAD_POOL_H
+#define ARROW_THREAD_POOL_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Rows per unit of parallel work
+#define ARROW_MORSEL_ROWS 65536
+
+// Set the number of threads running parallel loops, the caller included
+// (0: one per online CPU; 1: run loops on the calling thread). Restarts the
+// pool, so no loop may be running. Returns 0 on success, -1 on failure.
+int arrow_thread_pool_set_threads(int num_threads);
+
+// Current thread count, as set or defaulted
+int arrow_thread_pool_threads(void);
+
+// Called on each worker thread before the first task it runs after
+// registration, and when that worker exits; e.g. to attach the thread to a
+// language runtime. Threads calling arrow_parallel_for are not affected:
+// while waiting they only run pieces of their own loop. NULL clears a hook.
+typedef void (*ArrowThreadHook)(void);
+void arrow_thread_pool_set_hooks(ArrowThreadHook on_start, ArrowThreadHook on_exit);
+
+// Loop body for the indices [begin, end)
+typedef void (*ArrowParallelFn)(void* ctx, size_t begin, size_t end);
+
+// Call fn over [0, count) in pieces of at most `grain` indices (0: 1) and
+// return when all have finished. Pieces may run concurrently and in any
+// order, so they must write to disjoint outputs.
+void arrow_parallel_for(size_t count, size_t grain, ArrowParallelFn fn, void* ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARROW_THREAD_POOL_H
@@ -21,6 +21,24 @@ int arrow_array_set_buffer(struct ArrowArray* array, size_t index, uint8_t* buff
 uint8_t* arrow_array_get_buffer(struct ArrowArray* array, size_t index);
 void arrow_array_release(struct ArrowArray* array);
 
+// Shared references. Sharing moves an owned array (release != NULL) into a
+// refcounted holder in place: the caller's struct becomes the first
+// reference and `out` another one. Each reference is released on its own
+// and the buffers are freed with the last. References are O(1) struct
+// copies; counting is atomic, but converting an array is not, so share it
+// before handing it to other threads. Arrays without a release callback are
+// borrowed from their owner and only get plain views (release = NULL).
+// All return 0 on success, -1 on failure.
+int arrow_array_make_shared(struct ArrowArray* array);
+int arrow_array_share(struct ArrowArray* array, struct ArrowArray* out);
+// Rows [offset, offset + length) of `array`; null_count is recounted from
+// the validity bitmap when the parent has some nulls
+int arrow_array_share_slice(struct ArrowArray* array, int64_t offset, int64_t length,
+                            struct ArrowArray* out);
+// Child `index`, keeping the whole parent alive. The parent's offset is not
+// applied, as for children in the C data interface.
+int arrow_array_share_child(struct ArrowArray* array, int64_t index, struct ArrowArray* out);
+
 // Stream operations
 struct ArrowArrayStream* arrow_stream_init(void);
 struct ArrowSchema* arrow_stream_get_schema(struct ArrowArrayStream* stream);
@@ -34,6 +52,8 @@ uint64_t arrow_get_uint64_value(struct ArrowArray* array, size_t index);
 double arrow_get_float64_value(struct ArrowArray* array, size_t index);
 float arrow_get_float32_value(struct ArrowArray* array, size_t index);
 const char* arrow_get_string_value(struct ArrowArray* array, size_t index);
+const char* arrow_get_large_string_value(struct ArrowArray* array, size_t index);
+const char* arrow_get_string_view_value(struct ArrowArray* array, size_t index);
 
 // Null checking functions
 int arrow_is_bool_null(struct ArrowArray* array, size_t index);
@@ -44,6 +64,19 @@ int arrow_is_float64_null(struct ArrowArray* array, size_t index);
 int arrow_is_float32_null(struct ArrowArray* array, size_t index);
 int arrow_is_string_null(struct ArrowArray* array, size_t index);
 
+// Bulk extraction of the range [start, start + count). Each returns
+// 0/false when the range is out of bounds.
+// True if [start, start + count) lies within the array
+bool arrow_range_in_bounds(const struct ArrowArray* array, size_t start, size_t count);
+// One byte per value (1 = valid) into `out`; returns the null count
+size_t arrow_copy_validity_bytes(const struct ArrowArray* array, size_t start, size_t count, uint8_t* out);
+// memcpy of `count` values of `value_size` bytes (null slots are copied as stored)
+bool arrow_copy_fixed_values(const struct ArrowArray* array, size_t value_size, size_t start, size_t count, void* out);
+// Locate a string or binary value without copying it. `layout` is 'u'/'z'
+// (int32 offsets), 'U'/'Z' (int64 offsets) or 'v' (views). Ignores validity.
+bool arrow_get_string_ref(const struct ArrowArray* array, char layout, size_t index,
+                          const char** out_data, size_t* out_length);
+
 // Buffer management
 struct ArrowBuffer* arrow_allocate_buffer(size_t size);
 int arrow_buffer_resize(struct ArrowBuffer* buffer, size_t new_size);
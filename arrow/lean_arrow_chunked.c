@@ -4,6 +4,7 @@
 
 #include <lean/lean.h>
 #include "arrow_chunked.h"
+#include "arrow_chunked_compute.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -219,9 +220,14 @@ LEAN_EXPORT lean_obj_res lean_table_get_column(b_lean_obj_arg table_obj, uint64_
         return lean_io_result_mk_ok(lean_mk_option_none());
     }
 
-    // Return a reference to the column (not owned by caller)
-    // We wrap it but don't transfer ownership
-    lean_object* external = lean_alloc_external(g_chunked_array_class, column);
+    // The Lean object owns its own ChunkedArray sharing the column's chunks,
+    // so it may outlive the table
+    ChunkedArray* shared = chunked_array_share(column);
+    if (!shared) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+
+    lean_object* external = lean_alloc_external(g_chunked_array_class, shared);
     return lean_io_result_mk_ok(lean_mk_option_some(external));
 }
 
@@ -236,11 +242,12 @@ LEAN_EXPORT lean_obj_res lean_table_get_column_by_name(b_lean_obj_arg table_obj,
     }
 
     ChunkedArray* column = table_get_column_by_name(table, name);
-    if (!column) {
+    ChunkedArray* shared = chunked_array_share(column);
+    if (!shared) {
         return lean_io_result_mk_ok(lean_mk_option_none());
     }
 
-    lean_object* external = lean_alloc_external(g_chunked_array_class, column);
+    lean_object* external = lean_alloc_external(g_chunked_array_class, shared);
     return lean_io_result_mk_ok(lean_mk_option_some(external));
 }
 
@@ -295,6 +302,90 @@ LEAN_EXPORT lean_obj_res lean_table_slice(lean_obj_arg table_obj, int64_t offset
     return lean_io_result_mk_ok(lean_mk_option_some(external));
 }
 
+// ============================================================================
+// Chunked Aggregation FFI
+// ============================================================================
+
+// `threads` as in ArrowChunkedExecOptions: 0 or 1 sequential, otherwise the pool
+static lean_obj_res mk_aggregate_int(AggregateResult result) {
+    if (!result.is_valid) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some(lean_int64_to_int(result.i64_value)));
+}
+
+static lean_obj_res mk_aggregate_float(AggregateResult result) {
+    if (!result.is_valid) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some(lean_box_float(result.f64_value)));
+}
+
+LEAN_EXPORT lean_obj_res lean_chunked_min_int64(b_lean_obj_arg ca_obj, uint32_t threads, lean_obj_arg w) {
+    ChunkedArray* ca = (ChunkedArray*)lean_get_external_data(ca_obj);
+    ArrowChunkedExecOptions options = {(int32_t)threads};
+    return mk_aggregate_int(arrow_chunked_min_int64(ca, &options));
+}
+
+LEAN_EXPORT lean_obj_res lean_chunked_max_int64(b_lean_obj_arg ca_obj, uint32_t threads, lean_obj_arg w) {
+    ChunkedArray* ca = (ChunkedArray*)lean_get_external_data(ca_obj);
+    ArrowChunkedExecOptions options = {(int32_t)threads};
+    return mk_aggregate_int(arrow_chunked_max_int64(ca, &options));
+}
+
+LEAN_EXPORT lean_obj_res lean_chunked_sum_int64(b_lean_obj_arg ca_obj, uint32_t threads, lean_obj_arg w) {
+    ChunkedArray* ca = (ChunkedArray*)lean_get_external_data(ca_obj);
+    ArrowChunkedExecOptions options = {(int32_t)threads};
+    return mk_aggregate_int(arrow_chunked_sum_int64(ca, &options));
+}
+
+LEAN_EXPORT lean_obj_res lean_chunked_min_float64(b_lean_obj_arg ca_obj, uint32_t threads, lean_obj_arg w) {
+    ChunkedArray* ca = (ChunkedArray*)lean_get_external_data(ca_obj);
+    ArrowChunkedExecOptions options = {(int32_t)threads};
+    return mk_aggregate_float(arrow_chunked_min_float64(ca, &options));
+}
+
+LEAN_EXPORT lean_obj_res lean_chunked_max_float64(b_lean_obj_arg ca_obj, uint32_t threads, lean_obj_arg w) {
+    ChunkedArray* ca = (ChunkedArray*)lean_get_external_data(ca_obj);
+    ArrowChunkedExecOptions options = {(int32_t)threads};
+    return mk_aggregate_float(arrow_chunked_max_float64(ca, &options));
+}
+
+LEAN_EXPORT lean_obj_res lean_chunked_sum_float64(b_lean_obj_arg ca_obj, uint32_t threads, lean_obj_arg w) {
+    ChunkedArray* ca = (ChunkedArray*)lean_get_external_data(ca_obj);
+    ArrowChunkedExecOptions options = {(int32_t)threads};
+    return mk_aggregate_float(arrow_chunked_sum_float64(ca, &options));
+}
+
+LEAN_EXPORT lean_obj_res lean_chunked_mean_int64(b_lean_obj_arg ca_obj, uint32_t threads, lean_obj_arg w) {
+    ChunkedArray* ca = (ChunkedArray*)lean_get_external_data(ca_obj);
+    ArrowChunkedExecOptions options = {(int32_t)threads};
+    return mk_aggregate_float(arrow_chunked_mean_int64(ca, &options));
+}
+
+LEAN_EXPORT lean_obj_res lean_chunked_mean_float64(b_lean_obj_arg ca_obj, uint32_t threads, lean_obj_arg w) {
+    ChunkedArray* ca = (ChunkedArray*)lean_get_external_data(ca_obj);
+    ArrowChunkedExecOptions options = {(int32_t)threads};
+    return mk_aggregate_float(arrow_chunked_mean_float64(ca, &options));
+}
+
+LEAN_EXPORT lean_obj_res lean_chunked_variance_float64(b_lean_obj_arg ca_obj, uint32_t threads, lean_obj_arg w) {
+    ChunkedArray* ca = (ChunkedArray*)lean_get_external_data(ca_obj);
+    ArrowChunkedExecOptions options = {(int32_t)threads};
+    return mk_aggregate_float(arrow_chunked_variance_float64(ca, &options));
+}
+
+LEAN_EXPORT lean_obj_res lean_chunked_stddev_float64(b_lean_obj_arg ca_obj, uint32_t threads, lean_obj_arg w) {
+    ChunkedArray* ca = (ChunkedArray*)lean_get_external_data(ca_obj);
+    ArrowChunkedExecOptions options = {(int32_t)threads};
+    return mk_aggregate_float(arrow_chunked_stddev_float64(ca, &options));
+}
+
+LEAN_EXPORT lean_obj_res lean_chunked_count(b_lean_obj_arg ca_obj, lean_obj_arg w) {
+    ChunkedArray* ca = (ChunkedArray*)lean_get_external_data(ca_obj);
+    return lean_io_result_mk_ok(lean_box_uint64((uint64_t)arrow_chunked_count(ca)));
+}
+
 #ifdef __cplusplus
 }
 #endif
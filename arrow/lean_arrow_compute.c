@@ -7,6 +7,8 @@
 
 #include <lean/lean.h>
 #include "arrow_compute.h"
+#include "arrow_chunked_compute.h"
+#include "arrow_thread_pool.h"
 #include "arrow_wrapper.h"
 #include <stdlib.h>
 #include <string.h>
@@ -177,6 +179,20 @@ LEAN_EXPORT lean_obj_res lean_arrow_eq_string(b_lean_obj_arg a_ptr, b_lean_obj_a
     return lean_io_result_mk_ok(wrap_array_result(result));
 }
 
+LEAN_EXPORT lean_obj_res lean_arrow_eq_large_string(b_lean_obj_arg a_ptr, b_lean_obj_arg b_ptr, lean_obj_arg w) {
+    struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
+    struct ArrowArray* b = (struct ArrowArray*)lean_get_external_data(b_ptr);
+    struct ArrowArray* result = arrow_eq_large_string(a, b);
+    return lean_io_result_mk_ok(wrap_array_result(result));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_eq_string_view(b_lean_obj_arg a_ptr, b_lean_obj_arg b_ptr, lean_obj_arg w) {
+    struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
+    struct ArrowArray* b = (struct ArrowArray*)lean_get_external_data(b_ptr);
+    struct ArrowArray* result = arrow_eq_string_view(a, b);
+    return lean_io_result_mk_ok(wrap_array_result(result));
+}
+
 LEAN_EXPORT lean_obj_res lean_arrow_ne_int64(b_lean_obj_arg a_ptr, b_lean_obj_arg b_ptr, lean_obj_arg w) {
     struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
     struct ArrowArray* b = (struct ArrowArray*)lean_get_external_data(b_ptr);
@@ -434,6 +450,18 @@ LEAN_EXPORT lean_obj_res lean_arrow_count_distinct_string(b_lean_obj_arg a_ptr,
     return lean_io_result_mk_ok(lean_int64_to_int(result));
 }
 
+LEAN_EXPORT lean_obj_res lean_arrow_count_distinct_large_string(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
+    int64_t result = arrow_count_distinct_large_string(a);
+    return lean_io_result_mk_ok(lean_int64_to_int(result));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_count_distinct_string_view(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
+    int64_t result = arrow_count_distinct_string_view(a);
+    return lean_io_result_mk_ok(lean_int64_to_int(result));
+}
+
 LEAN_EXPORT lean_obj_res lean_arrow_any(b_lean_obj_arg a_ptr, lean_obj_arg w) {
     struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
     bool result = arrow_any(a);
@@ -456,6 +484,18 @@ LEAN_EXPORT lean_obj_res lean_arrow_string_length(b_lean_obj_arg a_ptr, lean_obj
     return lean_io_result_mk_ok(wrap_array_result(result));
 }
 
+LEAN_EXPORT lean_obj_res lean_arrow_large_string_length(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
+    struct ArrowArray* result = arrow_large_string_length(a);
+    return lean_io_result_mk_ok(wrap_array_result(result));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_string_view_length(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
+    struct ArrowArray* result = arrow_string_view_length(a);
+    return lean_io_result_mk_ok(wrap_array_result(result));
+}
+
 LEAN_EXPORT lean_obj_res lean_arrow_substring(b_lean_obj_arg a_ptr, int32_t start, int32_t length, lean_obj_arg w) {
     struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
     struct ArrowArray* result = arrow_substring(a, start, length);
@@ -469,6 +509,20 @@ LEAN_EXPORT lean_obj_res lean_arrow_string_contains(b_lean_obj_arg a_ptr, b_lean
     return lean_io_result_mk_ok(wrap_array_result(result));
 }
 
+LEAN_EXPORT lean_obj_res lean_arrow_large_string_contains(b_lean_obj_arg a_ptr, b_lean_obj_arg pattern, lean_obj_arg w) {
+    struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
+    const char* pat = lean_string_cstr(pattern);
+    struct ArrowArray* result = arrow_large_string_contains(a, pat);
+    return lean_io_result_mk_ok(wrap_array_result(result));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_string_view_contains(b_lean_obj_arg a_ptr, b_lean_obj_arg pattern, lean_obj_arg w) {
+    struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
+    const char* pat = lean_string_cstr(pattern);
+    struct ArrowArray* result = arrow_string_view_contains(a, pat);
+    return lean_io_result_mk_ok(wrap_array_result(result));
+}
+
 LEAN_EXPORT lean_obj_res lean_arrow_string_starts_with(b_lean_obj_arg a_ptr, b_lean_obj_arg prefix, lean_obj_arg w) {
     struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
     const char* pref = lean_string_cstr(prefix);
@@ -476,6 +530,20 @@ LEAN_EXPORT lean_obj_res lean_arrow_string_starts_with(b_lean_obj_arg a_ptr, b_l
     return lean_io_result_mk_ok(wrap_array_result(result));
 }
 
+LEAN_EXPORT lean_obj_res lean_arrow_large_string_starts_with(b_lean_obj_arg a_ptr, b_lean_obj_arg prefix, lean_obj_arg w) {
+    struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
+    const char* pref = lean_string_cstr(prefix);
+    struct ArrowArray* result = arrow_large_string_starts_with(a, pref);
+    return lean_io_result_mk_ok(wrap_array_result(result));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_string_view_starts_with(b_lean_obj_arg a_ptr, b_lean_obj_arg prefix, lean_obj_arg w) {
+    struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
+    const char* pref = lean_string_cstr(prefix);
+    struct ArrowArray* result = arrow_string_view_starts_with(a, pref);
+    return lean_io_result_mk_ok(wrap_array_result(result));
+}
+
 LEAN_EXPORT lean_obj_res lean_arrow_string_ends_with(b_lean_obj_arg a_ptr, b_lean_obj_arg suffix, lean_obj_arg w) {
     struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
     const char* suf = lean_string_cstr(suffix);
@@ -483,6 +551,20 @@ LEAN_EXPORT lean_obj_res lean_arrow_string_ends_with(b_lean_obj_arg a_ptr, b_lea
     return lean_io_result_mk_ok(wrap_array_result(result));
 }
 
+LEAN_EXPORT lean_obj_res lean_arrow_large_string_ends_with(b_lean_obj_arg a_ptr, b_lean_obj_arg suffix, lean_obj_arg w) {
+    struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
+    const char* suf = lean_string_cstr(suffix);
+    struct ArrowArray* result = arrow_large_string_ends_with(a, suf);
+    return lean_io_result_mk_ok(wrap_array_result(result));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_string_view_ends_with(b_lean_obj_arg a_ptr, b_lean_obj_arg suffix, lean_obj_arg w) {
+    struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
+    const char* suf = lean_string_cstr(suffix);
+    struct ArrowArray* result = arrow_string_view_ends_with(a, suf);
+    return lean_io_result_mk_ok(wrap_array_result(result));
+}
+
 LEAN_EXPORT lean_obj_res lean_arrow_string_upper(b_lean_obj_arg a_ptr, lean_obj_arg w) {
     struct ArrowArray* a = (struct ArrowArray*)lean_get_external_data(a_ptr);
     struct ArrowArray* result = arrow_string_upper(a);
@@ -602,6 +684,20 @@ LEAN_EXPORT lean_obj_res lean_arrow_filter_string(b_lean_obj_arg values_ptr, b_l
     return lean_io_result_mk_ok(wrap_array_result(result));
 }
 
+LEAN_EXPORT lean_obj_res lean_arrow_filter_large_string(b_lean_obj_arg values_ptr, b_lean_obj_arg mask_ptr, lean_obj_arg w) {
+    struct ArrowArray* values = (struct ArrowArray*)lean_get_external_data(values_ptr);
+    struct ArrowArray* mask = (struct ArrowArray*)lean_get_external_data(mask_ptr);
+    struct ArrowArray* result = arrow_filter_large_string(values, mask);
+    return lean_io_result_mk_ok(wrap_array_result(result));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_filter_string_view(b_lean_obj_arg values_ptr, b_lean_obj_arg mask_ptr, lean_obj_arg w) {
+    struct ArrowArray* values = (struct ArrowArray*)lean_get_external_data(values_ptr);
+    struct ArrowArray* mask = (struct ArrowArray*)lean_get_external_data(mask_ptr);
+    struct ArrowArray* result = arrow_filter_string_view(values, mask);
+    return lean_io_result_mk_ok(wrap_array_result(result));
+}
+
 LEAN_EXPORT lean_obj_res lean_arrow_filter_bool(b_lean_obj_arg values_ptr, b_lean_obj_arg mask_ptr, lean_obj_arg w) {
     struct ArrowArray* values = (struct ArrowArray*)lean_get_external_data(values_ptr);
     struct ArrowArray* mask = (struct ArrowArray*)lean_get_external_data(mask_ptr);
@@ -689,6 +785,138 @@ LEAN_EXPORT lean_obj_res lean_arrow_drop_null(b_lean_obj_arg a_ptr, lean_obj_arg
     return lean_io_result_mk_ok(wrap_array_result(result));
 }
 
+// ============================================================================
+// Parallel Execution
+// ============================================================================
+
+static lean_obj_res mk_aggregate_int(AggregateResult result) {
+    if (!result.is_valid) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some(lean_int64_to_int(result.i64_value)));
+}
+
+static lean_obj_res mk_aggregate_float(AggregateResult result) {
+    if (!result.is_valid) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some(lean_box_float(result.f64_value)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_thread_pool_set_threads(uint32_t threads, lean_obj_arg w) {
+    int rc = threads > INT32_MAX ? -1 : arrow_thread_pool_set_threads((int)threads);
+    return lean_io_result_mk_ok(lean_box(rc == 0));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_thread_pool_threads(lean_obj_arg w) {
+    return lean_io_result_mk_ok(lean_box_uint32((uint32_t)arrow_thread_pool_threads()));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_parallel_min_int64(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    return mk_aggregate_int(arrow_parallel_min_int64((struct ArrowArray*)lean_get_external_data(a_ptr)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_parallel_max_int64(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    return mk_aggregate_int(arrow_parallel_max_int64((struct ArrowArray*)lean_get_external_data(a_ptr)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_parallel_sum_int64(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    return mk_aggregate_int(arrow_parallel_sum_int64((struct ArrowArray*)lean_get_external_data(a_ptr)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_parallel_min_float64(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    return mk_aggregate_float(arrow_parallel_min_float64((struct ArrowArray*)lean_get_external_data(a_ptr)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_parallel_max_float64(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    return mk_aggregate_float(arrow_parallel_max_float64((struct ArrowArray*)lean_get_external_data(a_ptr)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_parallel_sum_float64(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    return mk_aggregate_float(arrow_parallel_sum_float64((struct ArrowArray*)lean_get_external_data(a_ptr)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_parallel_mean_int64(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    return mk_aggregate_float(arrow_parallel_mean_int64((struct ArrowArray*)lean_get_external_data(a_ptr)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_parallel_mean_float64(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    return mk_aggregate_float(arrow_parallel_mean_float64((struct ArrowArray*)lean_get_external_data(a_ptr)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_parallel_variance_float64(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    return mk_aggregate_float(arrow_parallel_variance_float64((struct ArrowArray*)lean_get_external_data(a_ptr)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_parallel_stddev_float64(b_lean_obj_arg a_ptr, lean_obj_arg w) {
+    return mk_aggregate_float(arrow_parallel_stddev_float64((struct ArrowArray*)lean_get_external_data(a_ptr)));
+}
+
+// Pool workers running Lean closures must be registered with the runtime
+static void attach_lean_thread(void) {
+    lean_initialize_thread();
+}
+
+static void detach_lean_thread(void) {
+    lean_finalize_thread();
+}
+
+typedef struct {
+    lean_object* actions;
+    lean_object** results;
+} ParallelActions;
+
+static void run_lean_actions(void* ctx, size_t begin, size_t end) {
+    ParallelActions* job = (ParallelActions*)ctx;
+    for (size_t i = begin; i < end; i++) {
+        lean_object* action = lean_array_get_core(job->actions, i);
+        lean_inc(action);
+        lean_object* result = lean_apply_1(action, lean_io_mk_world());
+        // Read by the calling thread once the loop ends
+        lean_mark_mt(result);
+        job->results[i] = result;
+    }
+}
+
+// Run an array of IO actions on the thread pool. All actions run; the
+// results come back in order, or the error of the first failed action.
+LEAN_EXPORT lean_obj_res lean_arrow_parallel_io(b_lean_obj_arg actions, lean_obj_arg w) {
+    size_t n = lean_array_size(actions);
+    lean_object** results = (lean_object**)calloc(n + 1, sizeof(lean_object*));
+    if (!results) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("parallel: out of memory")));
+    }
+
+    arrow_thread_pool_set_hooks(attach_lean_thread, detach_lean_thread);
+    // The closures are shared with the workers
+    lean_mark_mt(actions);
+    ParallelActions job = {actions, results};
+    arrow_parallel_for(n, 1, run_lean_actions, &job);
+
+    lean_object* values = lean_alloc_array(0, n);
+    lean_object* error = NULL;
+    for (size_t i = 0; i < n; i++) {
+        lean_object* result = results[i];
+        if (!error && lean_io_result_is_ok(result)) {
+            lean_object* value = lean_io_result_get_value(result);
+            lean_inc(value);
+            values = lean_array_push(values, value);
+            lean_dec(result);
+        } else if (!error) {
+            error = result;
+        } else {
+            lean_dec(result);
+        }
+    }
+    free(results);
+
+    if (error) {
+        lean_dec(values);
+        return error;
+    }
+    return lean_io_result_mk_ok(values);
+}
+
 // ============================================================================
 // Utility
 // ============================================================================
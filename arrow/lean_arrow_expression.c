@@ -0,0 +1,129 @@
+/**
+ * lean_arrow_expression.c - Lean FFI wrappers for expression evaluation
+ *
+ * Expressions cross the FFI as boxed ArrowExpr pointers. Operators take
+ * ownership of their operands, and a failed constructor yields a null
+ * pointer that makes every operator built on it fail in turn, so Lean can
+ * build a whole tree and check it once at evaluation.
+ */
+
+#include <lean/lean.h>
+#include "arrow_expression.h"
+#include "arrow_builders.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Helper functions for Option type
+static lean_obj_res lean_mk_option_none(void) {
+    return lean_alloc_ctor(0, 0, 0);
+}
+
+static lean_obj_res lean_mk_option_some(lean_obj_arg value) {
+    lean_object* option = lean_alloc_ctor(1, 1, 0);
+    lean_ctor_set(option, 0, value);
+    return option;
+}
+
+static inline lean_obj_res box_expr(ArrowExpr* expr) {
+    return lean_io_result_mk_ok(lean_box_usize((uintptr_t)expr));
+}
+
+static inline ArrowExpr* unbox_expr(b_lean_obj_arg obj) {
+    return (ArrowExpr*)lean_unbox_usize(obj);
+}
+
+// ============================================================================
+// Building Expressions
+// ============================================================================
+
+LEAN_EXPORT lean_obj_res lean_arrow_expr_column(uint64_t index, lean_obj_arg w) {
+    return box_expr(arrow_expr_column((int64_t)index));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_expr_column_named(b_lean_obj_arg name, lean_obj_arg w) {
+    return box_expr(arrow_expr_column_named(lean_string_cstr(name)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_expr_literal_int64(int64_t value, lean_obj_arg w) {
+    return box_expr(arrow_expr_literal_int64(value));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_expr_literal_float64(double value, lean_obj_arg w) {
+    return box_expr(arrow_expr_literal_float64(value));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_expr_literal_bool(uint8_t value, lean_obj_arg w) {
+    return box_expr(arrow_expr_literal_bool(value != 0));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_expr_literal_string(b_lean_obj_arg value, lean_obj_arg w) {
+    return box_expr(arrow_expr_literal_string(lean_string_cstr(value)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_expr_unary(uint8_t op, b_lean_obj_arg operand, lean_obj_arg w) {
+    return box_expr(arrow_expr_unary((ArrowExprOp)op, unbox_expr(operand)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_expr_binary(uint8_t op, b_lean_obj_arg left, b_lean_obj_arg right,
+                                                lean_obj_arg w) {
+    return box_expr(arrow_expr_binary((ArrowExprOp)op, unbox_expr(left), unbox_expr(right)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_expr_cast(b_lean_obj_arg operand, uint8_t type, lean_obj_arg w) {
+    return box_expr(arrow_expr_cast(unbox_expr(operand), (ArrowExprType)type));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_expr_string_predicate(uint8_t op, b_lean_obj_arg operand,
+                                                          b_lean_obj_arg pattern, lean_obj_arg w) {
+    return box_expr(arrow_expr_string_predicate((ArrowExprOp)op, unbox_expr(operand),
+                                                lean_string_cstr(pattern)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_expr_free(b_lean_obj_arg expr, lean_obj_arg w) {
+    arrow_expr_free(unbox_expr(expr));
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+// ============================================================================
+// Evaluation
+// ============================================================================
+
+static lean_obj_res wrap_result(struct ArrowArray* array) {
+    if (!array) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some(lean_box_usize((uintptr_t)array)));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_expr_evaluate(b_lean_obj_arg expr, b_lean_obj_arg schema_ptr,
+                                                  b_lean_obj_arg batch_ptr, lean_obj_arg w) {
+    ArrowExpr* e = unbox_expr(expr);
+    struct ArrowSchema* schema = (struct ArrowSchema*)lean_unbox_usize(schema_ptr);
+    struct ArrowArray* batch = (struct ArrowArray*)lean_unbox_usize(batch_ptr);
+    return wrap_result(arrow_expr_evaluate(e, schema, batch, NULL));
+}
+
+// Evaluate over a RecordBatch through a borrowed struct-array view of its
+// columns
+LEAN_EXPORT lean_obj_res lean_arrow_expr_evaluate_batch(b_lean_obj_arg expr, b_lean_obj_arg batch_ptr,
+                                                        lean_obj_arg w) {
+    ArrowExpr* e = unbox_expr(expr);
+    RecordBatch* batch = (RecordBatch*)lean_unbox_usize(batch_ptr);
+    if (!e || !batch) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+    struct ArrowArray view;
+    memset(&view, 0, sizeof(view));
+    view.length = (int64_t)batch->num_rows;
+    view.n_children = (int64_t)batch->num_columns;
+    view.children = batch->columns;
+    return wrap_result(arrow_expr_evaluate(e, batch->schema, &view, NULL));
+}
+
+#ifdef __cplusplus
+}
+#endif
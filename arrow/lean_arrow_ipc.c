@@ -11,6 +11,8 @@
 #include "arrow_c_abi.h"
 #include "arrow_wrapper.h"
 #include "arrow_ipc.h"
+#include "arrow_ipc_stream.h"
+#include "arrow_ipc_batch_file.h"
 
 /* ============================================================================
  * Helper Functions (matching lean_arrow_wrapper.c patterns)
@@ -44,6 +46,15 @@ static lean_object* make_ipc_error(int error_code) {
         case ARROW_IPC_ERR_NULL:
             msg = "IPC null error: null pointer argument";
             break;
+        case ARROW_IPC_ERR_UNSUPPORTED:
+            msg = "IPC unsupported error: type or feature not supported";
+            break;
+        case ARROW_IPC_ERR_IO:
+            msg = "IPC I/O error: read or write failed";
+            break;
+        case ARROW_IPC_ERR_SCHEMA:
+            msg = "IPC schema error: missing schema or fingerprint mismatch";
+            break;
         default:
             msg = "IPC unknown error";
             break;
@@ -51,6 +62,12 @@ static lean_object* make_ipc_error(int error_code) {
     return lean_mk_io_user_error(lean_mk_string(msg));
 }
 
+/* Options for a codec id from Lean (ArrowIPCCompression value) */
+static void ipc_options_from_lean(ArrowIPCWriteOptions* options, uint8_t compression) {
+    arrow_ipc_write_options_init(options);
+    options->compression = (ArrowIPCCompression)compression;
+}
+
 /* ============================================================================
  * Schema Serialization
  * ============================================================================ */
@@ -219,19 +236,55 @@ LEAN_EXPORT lean_obj_res lean_arrow_ipc_serialize_batch(
             lean_mk_io_user_error(lean_mk_string("Null array pointer")));
     }
 
+    /* Size first, then serialize straight into the ByteArray */
+    size_t size = arrow_ipc_serialized_batch_size(schema, array);
+    lean_object* byte_array = lean_alloc_sarray(1, size, size);
+
+    int rc = arrow_ipc_serialize_batch_into(schema, array, lean_sarray_cptr(byte_array), size, &size);
+    if (rc != ARROW_IPC_OK) {
+        lean_dec(byte_array);
+        return lean_io_result_mk_error(make_ipc_error(rc));
+    }
+
+    return lean_io_result_mk_ok(byte_array);
+}
+
+/*
+ * Serialize a RecordBatch with per-buffer compression. Buffers smaller than
+ * `min_size` bytes are stored uncompressed.
+ *
+ * @extern "lean_arrow_ipc_serialize_batch_compressed"
+ * opaque serializeBatchCompressedRaw : @& ArrowSchemaPtr.type → @& ArrowArrayPtr.type → UInt8 → UInt64 → IO ByteArray
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_serialize_batch_compressed(
+    b_lean_obj_arg schema_ptr_obj,
+    b_lean_obj_arg array_ptr_obj,
+    uint8_t compression,
+    uint64_t min_size,
+    lean_obj_arg w
+) {
+    struct ArrowSchema* schema = (struct ArrowSchema*)lean_unbox_usize(schema_ptr_obj);
+    struct ArrowArray* array = (struct ArrowArray*)lean_unbox_usize(array_ptr_obj);
+
+    if (!schema || !array) {
+        return lean_io_result_mk_error(
+            lean_mk_io_user_error(lean_mk_string("Null pointer")));
+    }
+
+    ArrowIPCWriteOptions options;
+    ipc_options_from_lean(&options, compression);
+    options.min_compress_size = (size_t)min_size;
+
     uint8_t* data = NULL;
     size_t size = 0;
-
-    int rc = arrow_ipc_serialize_batch(schema, array, &data, &size);
+    int rc = arrow_ipc_serialize_batch_with_options(schema, array, &options, &data, &size);
     if (rc != ARROW_IPC_OK) {
         return lean_io_result_mk_error(make_ipc_error(rc));
     }
 
-    /* Create Lean ByteArray */
     lean_object* byte_array = lean_alloc_sarray(1, size, size);
     memcpy(lean_sarray_cptr(byte_array), data, size);
     free(data);
-
     return lean_io_result_mk_ok(byte_array);
 }
 
@@ -276,18 +329,92 @@ LEAN_EXPORT lean_obj_res lean_arrow_ipc_deserialize_batch(
 }
 
 /* ============================================================================
- * Utility Functions
+ * Zero-Copy Deserialization
  * ============================================================================ */
 
+/* Owner hook: drop the reference the arrays held on the ByteArray */
+static void release_byte_array_owner(void* owner) {
+    lean_dec((lean_object*)owner);
+}
+
 /*
- * Get the serialized size of a batch
+ * Deserialize a ByteArray to RecordBatch without copying buffer data.
+ * The arrays alias the ByteArray, which stays alive until they are released.
  *
- * @extern "lean_arrow_ipc_batch_size"
- * opaque batchSerializedSize : ArrowSchemaPtr.type → ArrowArrayPtr.type → IO UInt64
+ * @extern "lean_arrow_ipc_deserialize_batch_zero_copy"
+ * opaque deserializeBatchZeroCopyRaw : @& ByteArray → IO (Option (ArrowSchemaPtr.type × ArrowArrayPtr.type))
  */
-LEAN_EXPORT lean_obj_res lean_arrow_ipc_batch_size(
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_deserialize_batch_zero_copy(
+    b_lean_obj_arg byte_array,
+    lean_obj_arg w
+) {
+    const uint8_t* data = lean_sarray_cptr(byte_array);
+    size_t size = lean_sarray_size(byte_array);
+
+    struct ArrowSchema* schema = (struct ArrowSchema*)calloc(1, sizeof(struct ArrowSchema));
+    struct ArrowArray* array = (struct ArrowArray*)calloc(1, sizeof(struct ArrowArray));
+
+    if (!schema || !array) {
+        if (schema) free(schema);
+        if (array) free(array);
+        return lean_io_result_mk_error(
+            lean_mk_io_user_error(lean_mk_string("Failed to allocate schema/array")));
+    }
+
+    /* Arrays may be released from any thread */
+    lean_mark_mt((lean_object*)byte_array);
+    lean_inc(byte_array);
+
+    int rc = arrow_ipc_deserialize_batch_zero_copy(
+        data, size, release_byte_array_owner, (void*)byte_array, schema, array);
+    if (rc != ARROW_IPC_OK) {
+        lean_dec(byte_array);
+        free(schema);
+        free(array);
+        return lean_io_result_mk_ok(lean_mk_option_none_ipc());
+    }
+
+    lean_object* schema_obj = lean_box_usize((uintptr_t)schema);
+    lean_object* array_obj = lean_box_usize((uintptr_t)array);
+    lean_object* pair = lean_alloc_ctor(0, 2, 0);
+    lean_ctor_set(pair, 0, schema_obj);
+    lean_ctor_set(pair, 1, array_obj);
+
+    return lean_io_result_mk_ok(lean_mk_option_some_ipc(pair));
+}
+
+/* ============================================================================
+ * Schema References
+ * ============================================================================ */
+
+/*
+ * Fingerprint of a schema, the key schema-reference blobs point to
+ *
+ * @extern "lean_arrow_ipc_schema_fingerprint"
+ * opaque schemaFingerprintRaw : @& ArrowSchemaPtr.type → IO UInt64
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_schema_fingerprint(
+    b_lean_obj_arg schema_ptr_obj,
+    lean_obj_arg w
+) {
+    struct ArrowSchema* schema = (struct ArrowSchema*)lean_unbox_usize(schema_ptr_obj);
+    if (!schema) {
+        return lean_io_result_mk_error(
+            lean_mk_io_user_error(lean_mk_string("Null schema pointer")));
+    }
+    return lean_io_result_mk_ok(lean_box_uint64(arrow_ipc_schema_fingerprint(schema)));
+}
+
+/*
+ * Serialize a RecordBatch without its schema
+ *
+ * @extern "lean_arrow_ipc_serialize_batch_ref"
+ * opaque serializeBatchRefRaw : @& ArrowSchemaPtr.type → @& ArrowArrayPtr.type → UInt8 → IO ByteArray
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_serialize_batch_ref(
     b_lean_obj_arg schema_ptr_obj,
     b_lean_obj_arg array_ptr_obj,
+    uint8_t compression,
     lean_obj_arg w
 ) {
     struct ArrowSchema* schema = (struct ArrowSchema*)lean_unbox_usize(schema_ptr_obj);
@@ -298,14 +425,450 @@ LEAN_EXPORT lean_obj_res lean_arrow_ipc_batch_size(
             lean_mk_io_user_error(lean_mk_string("Null pointer")));
     }
 
+    ArrowIPCWriteOptions options;
+    ipc_options_from_lean(&options, compression);
+
     uint8_t* data = NULL;
     size_t size = 0;
+    int rc = arrow_ipc_serialize_batch_ref(schema, array, &options, &data, &size);
+    if (rc != ARROW_IPC_OK) {
+        return lean_io_result_mk_error(make_ipc_error(rc));
+    }
+
+    lean_object* byte_array = lean_alloc_sarray(1, size, size);
+    memcpy(lean_sarray_cptr(byte_array), data, size);
+    free(data);
+    return lean_io_result_mk_ok(byte_array);
+}
+
+/*
+ * Schema fingerprint stored in a schema-reference blob
+ *
+ * @extern "lean_arrow_ipc_batch_ref_fingerprint"
+ * opaque batchRefFingerprintRaw : @& ByteArray → IO (Option UInt64)
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_batch_ref_fingerprint(
+    b_lean_obj_arg byte_array,
+    lean_obj_arg w
+) {
+    uint64_t fingerprint = 0;
+    int rc = arrow_ipc_batch_ref_fingerprint(lean_sarray_cptr(byte_array), lean_sarray_size(byte_array),
+                                             &fingerprint);
+    if (rc != ARROW_IPC_OK) {
+        return lean_io_result_mk_ok(lean_mk_option_none_ipc());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some_ipc(lean_box_uint64(fingerprint)));
+}
+
+/*
+ * Deserialize a schema-reference blob against its schema. With `zero_copy`
+ * the array aliases the ByteArray, as in deserializeBatchZeroCopy.
+ *
+ * @extern "lean_arrow_ipc_deserialize_batch_ref"
+ * opaque deserializeBatchRefRaw : @& ByteArray → @& ArrowSchemaPtr.type → UInt8 → IO (Option ArrowArrayPtr.type)
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_deserialize_batch_ref(
+    b_lean_obj_arg byte_array,
+    b_lean_obj_arg schema_ptr_obj,
+    uint8_t zero_copy,
+    lean_obj_arg w
+) {
+    const uint8_t* data = lean_sarray_cptr(byte_array);
+    size_t size = lean_sarray_size(byte_array);
+    struct ArrowSchema* schema = (struct ArrowSchema*)lean_unbox_usize(schema_ptr_obj);
+
+    struct ArrowArray* array = (struct ArrowArray*)calloc(1, sizeof(struct ArrowArray));
+    if (!array) {
+        return lean_io_result_mk_error(
+            lean_mk_io_user_error(lean_mk_string("Failed to allocate array")));
+    }
 
-    int rc = arrow_ipc_serialize_batch(schema, array, &data, &size);
+    int rc;
+    if (zero_copy) {
+        lean_mark_mt((lean_object*)byte_array);
+        lean_inc(byte_array);
+        rc = arrow_ipc_deserialize_batch_ref_zero_copy(
+            data, size, schema, release_byte_array_owner, (void*)byte_array, array);
+        if (rc != ARROW_IPC_OK) lean_dec(byte_array);
+    } else {
+        rc = arrow_ipc_deserialize_batch_ref(data, size, schema, array);
+    }
+    if (rc != ARROW_IPC_OK) {
+        free(array);
+        return lean_io_result_mk_ok(lean_mk_option_none_ipc());
+    }
+
+    lean_object* array_obj = lean_box_usize((uintptr_t)array);
+    return lean_io_result_mk_ok(lean_mk_option_some_ipc(array_obj));
+}
+
+/* ============================================================================
+ * Standard IPC Stream/File Format
+ * ============================================================================ */
+
+static lean_obj_res mk_stream_option(struct ArrowArrayStream* stream, int rc) {
+    if (rc != ARROW_IPC_OK) {
+        free(stream);
+        return lean_io_result_mk_ok(lean_mk_option_none_ipc());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some_ipc(lean_box_usize((uintptr_t)stream)));
+}
+
+/*
+ * Drain an ArrowArrayStream into Arrow IPC stream (0) or file (1) format
+ *
+ * @extern "lean_arrow_ipc_write_stream"
+ * opaque writeStreamRaw : @& ArrowArrayStreamPtr.type → UInt8 → UInt8 → IO ByteArray
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_write_stream(
+    b_lean_obj_arg stream_ptr_obj,
+    uint8_t format,
+    uint8_t compression,
+    lean_obj_arg w
+) {
+    struct ArrowArrayStream* stream = (struct ArrowArrayStream*)lean_unbox_usize(stream_ptr_obj);
+    if (!stream) {
+        return lean_io_result_mk_error(
+            lean_mk_io_user_error(lean_mk_string("Null stream pointer")));
+    }
+
+    ArrowIPCWriteOptions options;
+    ipc_options_from_lean(&options, compression);
+
+    uint8_t* data = NULL;
+    size_t size = 0;
+    int rc = arrow_ipc_write_array_stream_to_buffer(stream, (ArrowIPCFormat)format, &options, &data, &size);
     if (rc != ARROW_IPC_OK) {
         return lean_io_result_mk_error(make_ipc_error(rc));
     }
 
+    lean_object* byte_array = lean_alloc_sarray(1, size, size);
+    if (size > 0) {
+        memcpy(lean_sarray_cptr(byte_array), data, size);
+    }
     free(data);
+    return lean_io_result_mk_ok(byte_array);
+}
+
+/*
+ * Drain an ArrowArrayStream into an Arrow IPC file at `path`
+ *
+ * @extern "lean_arrow_ipc_write_stream_path"
+ * opaque writeStreamPathRaw : @& ArrowArrayStreamPtr.type → UInt8 → UInt8 → @& String → IO Unit
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_write_stream_path(
+    b_lean_obj_arg stream_ptr_obj,
+    uint8_t format,
+    uint8_t compression,
+    b_lean_obj_arg path,
+    lean_obj_arg w
+) {
+    struct ArrowArrayStream* stream = (struct ArrowArrayStream*)lean_unbox_usize(stream_ptr_obj);
+    if (!stream) {
+        return lean_io_result_mk_error(
+            lean_mk_io_user_error(lean_mk_string("Null stream pointer")));
+    }
+
+    ArrowIPCWriteOptions options;
+    ipc_options_from_lean(&options, compression);
+
+    int rc = arrow_ipc_write_array_stream_to_path(stream, (ArrowIPCFormat)format, &options, lean_string_cstr(path));
+    if (rc != ARROW_IPC_OK) {
+        return lean_io_result_mk_error(make_ipc_error(rc));
+    }
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+/*
+ * Open Arrow IPC stream or file bytes as an ArrowArrayStream. Batches alias
+ * the ByteArray, which stays alive until the stream and its arrays are released.
+ *
+ * @extern "lean_arrow_ipc_read_stream"
+ * opaque readStreamRaw : @& ByteArray → IO (Option ArrowArrayStreamPtr.type)
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_read_stream(
+    b_lean_obj_arg byte_array,
+    lean_obj_arg w
+) {
+    struct ArrowArrayStream* stream = (struct ArrowArrayStream*)calloc(1, sizeof(struct ArrowArrayStream));
+    if (!stream) {
+        return lean_io_result_mk_error(
+            lean_mk_io_user_error(lean_mk_string("Failed to allocate stream")));
+    }
+
+    lean_mark_mt((lean_object*)byte_array);
+    lean_inc(byte_array);
+
+    int rc = arrow_ipc_read_array_stream(
+        lean_sarray_cptr(byte_array), lean_sarray_size(byte_array),
+        release_byte_array_owner, (void*)byte_array, stream);
+    if (rc != ARROW_IPC_OK) {
+        lean_dec(byte_array);
+    }
+    return mk_stream_option(stream, rc);
+}
+
+/*
+ * Open an Arrow IPC stream or file on disk as an ArrowArrayStream
+ *
+ * @extern "lean_arrow_ipc_read_stream_path"
+ * opaque readStreamPathRaw : @& String → IO (Option ArrowArrayStreamPtr.type)
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_read_stream_path(
+    b_lean_obj_arg path,
+    lean_obj_arg w
+) {
+    struct ArrowArrayStream* stream = (struct ArrowArrayStream*)calloc(1, sizeof(struct ArrowArrayStream));
+    if (!stream) {
+        return lean_io_result_mk_error(
+            lean_mk_io_user_error(lean_mk_string("Failed to allocate stream")));
+    }
+
+    int rc = arrow_ipc_read_array_stream_from_path(lean_string_cstr(path), stream);
+    return mk_stream_option(stream, rc);
+}
+
+/*
+ * Drain an ArrowArrayStream into a file descriptor or pipe (not closed)
+ *
+ * @extern "lean_arrow_ipc_write_stream_fd"
+ * opaque writeStreamFdRaw : @& ArrowArrayStreamPtr.type → UInt8 → UInt8 → UInt32 → IO Unit
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_write_stream_fd(
+    b_lean_obj_arg stream_ptr_obj,
+    uint8_t format,
+    uint8_t compression,
+    uint32_t fd,
+    lean_obj_arg w
+) {
+    struct ArrowArrayStream* stream = (struct ArrowArrayStream*)lean_unbox_usize(stream_ptr_obj);
+    if (!stream) {
+        return lean_io_result_mk_error(
+            lean_mk_io_user_error(lean_mk_string("Null stream pointer")));
+    }
+
+    ArrowIPCWriteOptions options;
+    ipc_options_from_lean(&options, compression);
+
+    int rc = arrow_ipc_write_array_stream_to_fd(stream, (ArrowIPCFormat)format, &options, (int)fd);
+    if (rc != ARROW_IPC_OK) {
+        return lean_io_result_mk_error(make_ipc_error(rc));
+    }
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+/*
+ * Read Arrow IPC messages incrementally from a file descriptor or pipe
+ *
+ * @extern "lean_arrow_ipc_read_stream_fd"
+ * opaque readStreamFdRaw : UInt32 → IO (Option ArrowArrayStreamPtr.type)
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_read_stream_fd(
+    uint32_t fd,
+    lean_obj_arg w
+) {
+    struct ArrowArrayStream* stream = (struct ArrowArrayStream*)calloc(1, sizeof(struct ArrowArrayStream));
+    if (!stream) {
+        return lean_io_result_mk_error(
+            lean_mk_io_user_error(lean_mk_string("Failed to allocate stream")));
+    }
+
+    int rc = arrow_ipc_read_array_stream_from_fd((int)fd, stream);
+    return mk_stream_option(stream, rc);
+}
+
+/* ============================================================================
+ * Memory-Mapped Batch File
+ * ============================================================================ */
+
+/*
+ * Create a batch file at `path`, compressing buffers with the given codec
+ *
+ * @extern "lean_arrow_ipc_batch_file_writer_open"
+ * opaque batchFileWriterOpenRaw : @& String → UInt8 → IO (Option IPCBatchFileWriterPtr.type)
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_batch_file_writer_open(
+    b_lean_obj_arg path,
+    uint8_t compression,
+    lean_obj_arg w
+) {
+    ArrowIPCWriteOptions options;
+    ipc_options_from_lean(&options, compression);
+
+    ArrowIPCBatchFileWriter* writer = NULL;
+    if (arrow_ipc_batch_file_writer_open(lean_string_cstr(path), &options, &writer) != ARROW_IPC_OK) {
+        return lean_io_result_mk_ok(lean_mk_option_none_ipc());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some_ipc(lean_box_usize((uintptr_t)writer)));
+}
+
+/*
+ * Append a record batch to a batch file
+ *
+ * @extern "lean_arrow_ipc_batch_file_writer_append"
+ * opaque batchFileWriterAppendRaw : @& IPCBatchFileWriterPtr.type → @& ArrowSchemaPtr.type → @& ArrowArrayPtr.type → IO Unit
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_batch_file_writer_append(
+    b_lean_obj_arg writer_ptr,
+    b_lean_obj_arg schema_ptr_obj,
+    b_lean_obj_arg array_ptr_obj,
+    lean_obj_arg w
+) {
+    ArrowIPCBatchFileWriter* writer = (ArrowIPCBatchFileWriter*)lean_unbox_usize(writer_ptr);
+    struct ArrowSchema* schema = (struct ArrowSchema*)lean_unbox_usize(schema_ptr_obj);
+    struct ArrowArray* array = (struct ArrowArray*)lean_unbox_usize(array_ptr_obj);
+
+    int rc = arrow_ipc_batch_file_writer_append(writer, schema, array);
+    if (rc != ARROW_IPC_OK) {
+        return lean_io_result_mk_error(make_ipc_error(rc));
+    }
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+/*
+ * Write the index, close the file and free the writer
+ *
+ * @extern "lean_arrow_ipc_batch_file_writer_close"
+ * opaque batchFileWriterCloseRaw : @& IPCBatchFileWriterPtr.type → IO Unit
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_batch_file_writer_close(
+    b_lean_obj_arg writer_ptr,
+    lean_obj_arg w
+) {
+    ArrowIPCBatchFileWriter* writer = (ArrowIPCBatchFileWriter*)lean_unbox_usize(writer_ptr);
+    int rc = arrow_ipc_batch_file_writer_close(writer);
+    if (rc != ARROW_IPC_OK) {
+        return lean_io_result_mk_error(make_ipc_error(rc));
+    }
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+/*
+ * Map a batch file for random access
+ *
+ * @extern "lean_arrow_ipc_batch_file_reader_open"
+ * opaque batchFileReaderOpenRaw : @& String → IO (Option IPCBatchFileReaderPtr.type)
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_batch_file_reader_open(
+    b_lean_obj_arg path,
+    lean_obj_arg w
+) {
+    ArrowIPCBatchFileReader* reader = NULL;
+    if (arrow_ipc_batch_file_reader_open(lean_string_cstr(path), &reader) != ARROW_IPC_OK) {
+        return lean_io_result_mk_ok(lean_mk_option_none_ipc());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some_ipc(lean_box_usize((uintptr_t)reader)));
+}
+
+/*
+ * Number of batches in a batch file
+ *
+ * @extern "lean_arrow_ipc_batch_file_reader_num_batches"
+ * opaque batchFileReaderNumBatchesRaw : @& IPCBatchFileReaderPtr.type → IO UInt64
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_batch_file_reader_num_batches(
+    b_lean_obj_arg reader_ptr,
+    lean_obj_arg w
+) {
+    ArrowIPCBatchFileReader* reader = (ArrowIPCBatchFileReader*)lean_unbox_usize(reader_ptr);
+    return lean_io_result_mk_ok(lean_box_uint64((uint64_t)arrow_ipc_batch_file_reader_num_batches(reader)));
+}
+
+/*
+ * Row count of one batch, from the index
+ *
+ * @extern "lean_arrow_ipc_batch_file_reader_batch_rows"
+ * opaque batchFileReaderBatchRowsRaw : @& IPCBatchFileReaderPtr.type → UInt64 → IO UInt64
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_batch_file_reader_batch_rows(
+    b_lean_obj_arg reader_ptr,
+    uint64_t index,
+    lean_obj_arg w
+) {
+    ArrowIPCBatchFileReader* reader = (ArrowIPCBatchFileReader*)lean_unbox_usize(reader_ptr);
+    int64_t rows = index > INT64_MAX ? -1 : arrow_ipc_batch_file_reader_batch_rows(reader, (int64_t)index);
+    if (rows < 0) {
+        return lean_io_result_mk_error(
+            lean_mk_io_user_error(lean_mk_string("Batch index out of range")));
+    }
+    return lean_io_result_mk_ok(lean_box_uint64((uint64_t)rows));
+}
+
+/*
+ * Read one batch; its buffers alias the mapping, which outlives the reader
+ * until the batch is released
+ *
+ * @extern "lean_arrow_ipc_batch_file_reader_read"
+ * opaque batchFileReaderReadRaw : @& IPCBatchFileReaderPtr.type → UInt64 → IO (Option (ArrowSchemaPtr.type × ArrowArrayPtr.type))
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_batch_file_reader_read(
+    b_lean_obj_arg reader_ptr,
+    uint64_t index,
+    lean_obj_arg w
+) {
+    ArrowIPCBatchFileReader* reader = (ArrowIPCBatchFileReader*)lean_unbox_usize(reader_ptr);
+
+    struct ArrowSchema* schema = (struct ArrowSchema*)calloc(1, sizeof(struct ArrowSchema));
+    struct ArrowArray* array = (struct ArrowArray*)calloc(1, sizeof(struct ArrowArray));
+
+    if (!schema || !array) {
+        if (schema) free(schema);
+        if (array) free(array);
+        return lean_io_result_mk_error(
+            lean_mk_io_user_error(lean_mk_string("Failed to allocate schema/array")));
+    }
+
+    if (index > INT64_MAX ||
+        arrow_ipc_batch_file_reader_read_batch(reader, (int64_t)index, schema, array) != ARROW_IPC_OK) {
+        free(schema);
+        free(array);
+        return lean_io_result_mk_ok(lean_mk_option_none_ipc());
+    }
+
+    lean_object* pair = lean_alloc_ctor(0, 2, 0);
+    lean_ctor_set(pair, 0, lean_box_usize((uintptr_t)schema));
+    lean_ctor_set(pair, 1, lean_box_usize((uintptr_t)array));
+
+    return lean_io_result_mk_ok(lean_mk_option_some_ipc(pair));
+}
+
+/*
+ * Close a batch file reader. Batches already read stay valid.
+ *
+ * @extern "lean_arrow_ipc_batch_file_reader_close"
+ * opaque batchFileReaderCloseRaw : @& IPCBatchFileReaderPtr.type → IO Unit
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_batch_file_reader_close(
+    b_lean_obj_arg reader_ptr,
+    lean_obj_arg w
+) {
+    arrow_ipc_batch_file_reader_close((ArrowIPCBatchFileReader*)lean_unbox_usize(reader_ptr));
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+/* ============================================================================
+ * Utility Functions
+ * ============================================================================ */
+
+/*
+ * Get the serialized size of a batch
+ *
+ * @extern "lean_arrow_ipc_batch_size"
+ * opaque batchSerializedSize : ArrowSchemaPtr.type → ArrowArrayPtr.type → IO UInt64
+ */
+LEAN_EXPORT lean_obj_res lean_arrow_ipc_batch_size(
+    b_lean_obj_arg schema_ptr_obj,
+    b_lean_obj_arg array_ptr_obj,
+    lean_obj_arg w
+) {
+    struct ArrowSchema* schema = (struct ArrowSchema*)lean_unbox_usize(schema_ptr_obj);
+    struct ArrowArray* array = (struct ArrowArray*)lean_unbox_usize(array_ptr_obj);
+
+    if (!schema || !array) {
+        return lean_io_result_mk_error(
+            lean_mk_io_user_error(lean_mk_string("Null pointer")));
+    }
+
+    size_t size = arrow_ipc_serialized_batch_size(schema, array);
     return lean_io_result_mk_ok(lean_box_uint64((uint64_t)size));
 }
@@ -1,5 +1,6 @@
 #define _GNU_SOURCE
 #include "arrow_wrapper.h"
+#include "arrow_memory.h"
 #include <lean/lean.h>
 #include <stdlib.h>
 #include <string.h>
@@ -415,6 +416,32 @@ LEAN_EXPORT lean_obj_res lean_arrow_get_string_value(b_lean_obj_arg array_ptr_ob
     return lean_io_result_mk_ok(str);
 }
 
+LEAN_EXPORT lean_obj_res lean_arrow_get_large_string_value(b_lean_obj_arg array_ptr_obj, size_t index, lean_obj_arg w) {
+    struct ArrowArray* array = (struct ArrowArray*)lean_unbox_usize(array_ptr_obj);
+    const char* value = arrow_get_large_string_value(array, index);
+    
+    if (!value) {
+        return lean_io_result_mk_error(lean_mk_string("Failed to get large string value"));
+    }
+    
+    lean_obj_res str = lean_mk_string(value);
+    free((char*)value); // Free the C string allocated by arrow_get_large_string_value
+    return lean_io_result_mk_ok(str);
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_get_string_view_value(b_lean_obj_arg array_ptr_obj, size_t index, lean_obj_arg w) {
+    struct ArrowArray* array = (struct ArrowArray*)lean_unbox_usize(array_ptr_obj);
+    const char* value = arrow_get_string_view_value(array, index);
+    
+    if (!value) {
+        return lean_io_result_mk_error(lean_mk_string("Failed to get string view value"));
+    }
+    
+    lean_obj_res str = lean_mk_string(value);
+    free((char*)value); // Free the C string allocated by arrow_get_string_view_value
+    return lean_io_result_mk_ok(str);
+}
+
 LEAN_EXPORT lean_obj_res lean_arrow_is_string_null(b_lean_obj_arg array_ptr_obj, size_t index, lean_obj_arg w) {
     struct ArrowArray* array = (struct ArrowArray*)lean_unbox_usize(array_ptr_obj);
     int result = arrow_is_string_null(array, index);
@@ -518,4 +545,146 @@ LEAN_EXPORT lean_obj_res lean_arrow_buffer_get_capacity(b_lean_obj_arg buffer_pt
     
     size_t capacity = arrow_buffer_get_capacity(buffer);
     return lean_io_result_mk_ok(lean_box_usize(capacity));
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// Bulk extraction
+// ============================================================================
+// Each export copies rows [start, start + count) of a column in one call,
+// reading the validity bitmap once instead of once per row.
+
+static lean_obj_res export_range_error(void) {
+    return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Export range out of bounds")));
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_export_validity(b_lean_obj_arg array_ptr_obj, size_t start, size_t count, lean_obj_arg w) {
+    struct ArrowArray* array = (struct ArrowArray*)lean_unbox_usize(array_ptr_obj);
+    if (!arrow_range_in_bounds(array, start, count)) return export_range_error();
+
+    lean_object* bytes = lean_alloc_sarray(1, count, count);
+    arrow_copy_validity_bytes(array, start, count, lean_sarray_cptr(bytes));
+    return lean_io_result_mk_ok(bytes);
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_export_float64_values(b_lean_obj_arg array_ptr_obj, size_t start, size_t count, lean_obj_arg w) {
+    struct ArrowArray* array = (struct ArrowArray*)lean_unbox_usize(array_ptr_obj);
+    if (!arrow_range_in_bounds(array, start, count)) return export_range_error();
+
+    lean_object* values = lean_alloc_sarray(sizeof(double), count, count);
+    if (!arrow_copy_fixed_values(array, sizeof(double), start, count, lean_float_array_cptr(values))) {
+        lean_dec_ref(values);
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Array has no values buffer")));
+    }
+    return lean_io_result_mk_ok(values);
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_export_uint8_values(b_lean_obj_arg array_ptr_obj, size_t start, size_t count, lean_obj_arg w) {
+    struct ArrowArray* array = (struct ArrowArray*)lean_unbox_usize(array_ptr_obj);
+    if (!arrow_range_in_bounds(array, start, count)) return export_range_error();
+
+    lean_object* values = lean_alloc_sarray(1, count, count);
+    if (!arrow_copy_fixed_values(array, 1, start, count, lean_sarray_cptr(values))) {
+        lean_dec_ref(values);
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Array has no values buffer")));
+    }
+    return lean_io_result_mk_ok(values);
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_export_int64_options(b_lean_obj_arg array_ptr_obj, size_t start, size_t count, lean_obj_arg w) {
+    struct ArrowArray* array = (struct ArrowArray*)lean_unbox_usize(array_ptr_obj);
+    if (!arrow_range_in_bounds(array, start, count)) return export_range_error();
+    if (count > 0 && (array->n_buffers <= 1 || array->buffers[1] == NULL)) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Array has no values buffer")));
+    }
+
+    const uint8_t* validity = array->null_count != 0 ? (const uint8_t*)array->buffers[0] : NULL;
+    const int64_t* data = (const int64_t*)array->buffers[1];
+    size_t first = start + (size_t)array->offset;
+    lean_object* result = lean_alloc_array(count, count);
+    lean_object** slots = lean_array_cptr(result);
+    for (size_t i = 0; i < count; i++) {
+        size_t slot = first + i;
+        slots[i] = (validity && !((validity[slot / 8] >> (slot % 8)) & 1))
+            ? lean_mk_option_none()
+            : lean_mk_option_some(lean_box_uint64((uint64_t)data[slot]));
+    }
+    return lean_io_result_mk_ok(result);
+}
+
+LEAN_EXPORT lean_obj_res lean_arrow_export_float64_options(b_lean_obj_arg array_ptr_obj, size_t start, size_t count, lean_obj_arg w) {
+    struct ArrowArray* array = (struct ArrowArray*)lean_unbox_usize(array_ptr_obj);
+    if (!arrow_range_in_bounds(array, start, count)) return export_range_error();
+    if (count > 0 && (array->n_buffers <= 1 || array->buffers[1] == NULL)) {
+        return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Array has no values buffer")));
+    }
+
+    const uint8_t* validity = array->null_count != 0 ? (const uint8_t*)array->buffers[0] : NULL;
+    const double* data = (const double*)array->buffers[1];
+    size_t first = start + (size_t)array->offset;
+    lean_object* result = lean_alloc_array(count, count);
+    lean_object** slots = lean_array_cptr(result);
+    for (size_t i = 0; i < count; i++) {
+        size_t slot = first + i;
+        slots[i] = (validity && !((validity[slot / 8] >> (slot % 8)) & 1))
+            ? lean_mk_option_none()
+            : lean_mk_option_some(lean_box_float(data[slot]));
+    }
+    return lean_io_result_mk_ok(result);
+}
+
+// `layout` is the format character of the column: 'u' (int32 offsets),
+// 'U' (int64 offsets) or 'v' (string views)
+LEAN_EXPORT lean_obj_res lean_arrow_export_strings(b_lean_obj_arg array_ptr_obj, uint32_t layout, size_t start, size_t count, lean_obj_arg w) {
+    struct ArrowArray* array = (struct ArrowArray*)lean_unbox_usize(array_ptr_obj);
+    if (!arrow_range_in_bounds(array, start, count)) return export_range_error();
+
+    const uint8_t* validity = array->null_count != 0 ? (const uint8_t*)array->buffers[0] : NULL;
+    size_t first = start + (size_t)array->offset;
+    lean_object* result = lean_alloc_array(0, count);
+    for (size_t i = 0; i < count; i++) {
+        size_t slot = first + i;
+        lean_object* value;
+        if (validity && !((validity[slot / 8] >> (slot % 8)) & 1)) {
+            value = lean_mk_option_none();
+        } else {
+            const char* data;
+            size_t length;
+            if (!arrow_get_string_ref(array, (char)layout, start + i, &data, &length)) {
+                lean_dec_ref(result);
+                return lean_io_result_mk_error(lean_mk_io_user_error(lean_mk_string("Not a string array of the given layout")));
+            }
+            value = lean_mk_option_some(lean_mk_string_from_bytes(data, length));
+        }
+        result = lean_array_push(result, value);
+    }
+    return lean_io_result_mk_ok(result);
+}
+
+// ============================================================================
+// Memory statistics
+// ============================================================================
+
+// Counters as a flat UInt64 array: bytes allocated, bytes live, peak,
+// allocations, live allocations, then (allocations, bytes live) for each
+// subsystem in ArrowMemorySubsystem order. `scope` 0 is global, 1 is the
+// calling thread's current pool.
+LEAN_EXPORT lean_obj_res lean_arrow_memory_stats(uint8_t scope, lean_obj_arg w) {
+    ArrowMemoryStats stats;
+    if (scope == 0) {
+        arrow_memory_stats(&stats);
+    } else {
+        arrow_memory_pool_stats(arrow_memory_pool_current(), &stats);
+    }
+
+    lean_object* result = lean_alloc_array(0, 5 + 2 * ARROW_MEMORY_SUBSYSTEM_COUNT);
+    result = lean_array_push(result, lean_box_uint64((uint64_t)stats.bytes_allocated));
+    result = lean_array_push(result, lean_box_uint64((uint64_t)stats.bytes_live));
+    result = lean_array_push(result, lean_box_uint64((uint64_t)stats.peak_bytes_live));
+    result = lean_array_push(result, lean_box_uint64((uint64_t)stats.allocations));
+    result = lean_array_push(result, lean_box_uint64((uint64_t)stats.live_allocations));
+    for (int i = 0; i < ARROW_MEMORY_SUBSYSTEM_COUNT; i++) {
+        result = lean_array_push(result, lean_box_uint64((uint64_t)stats.subsystems[i].allocations));
+        result = lean_array_push(result, lean_box_uint64((uint64_t)stats.subsystems[i].bytes_live));
+    }
+    return lean_io_result_mk_ok(result);
+}
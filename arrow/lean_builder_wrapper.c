@@ -154,6 +154,100 @@ LEAN_EXPORT lean_obj_res lean_string_builder_length(b_lean_obj_arg builder_ptr,
     return lean_io_result_mk_ok(lean_box_usize(len));
 }
 
+// ============================================================================
+// Large String Builder FFI
+// ============================================================================
+
+LEAN_EXPORT lean_obj_res lean_large_string_builder_create(size_t capacity, size_t data_capacity, lean_obj_arg w) {
+    LargeStringBuilder* builder = large_string_builder_create(capacity, data_capacity);
+    if (!builder) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some(lean_box_usize((uintptr_t)builder)));
+}
+
+LEAN_EXPORT lean_obj_res lean_large_string_builder_append(b_lean_obj_arg builder_ptr, b_lean_obj_arg str, lean_obj_arg w) {
+    LargeStringBuilder* builder = (LargeStringBuilder*)lean_unbox_usize(builder_ptr);
+    const char* cstr = lean_string_cstr(str);
+    size_t len = lean_string_size(str) - 1;  // Exclude null terminator
+    int result = large_string_builder_append(builder, cstr, len);
+    return lean_io_result_mk_ok(lean_box(result == BUILDER_OK ? 1 : 0));
+}
+
+LEAN_EXPORT lean_obj_res lean_large_string_builder_append_null(b_lean_obj_arg builder_ptr, lean_obj_arg w) {
+    LargeStringBuilder* builder = (LargeStringBuilder*)lean_unbox_usize(builder_ptr);
+    int result = large_string_builder_append_null(builder);
+    return lean_io_result_mk_ok(lean_box(result == BUILDER_OK ? 1 : 0));
+}
+
+LEAN_EXPORT lean_obj_res lean_large_string_builder_finish(b_lean_obj_arg builder_ptr, lean_obj_arg w) {
+    LargeStringBuilder* builder = (LargeStringBuilder*)lean_unbox_usize(builder_ptr);
+    struct ArrowArray* array = large_string_builder_finish(builder);
+    if (!array) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some(lean_box_usize((uintptr_t)array)));
+}
+
+LEAN_EXPORT lean_obj_res lean_large_string_builder_free(b_lean_obj_arg builder_ptr, lean_obj_arg w) {
+    LargeStringBuilder* builder = (LargeStringBuilder*)lean_unbox_usize(builder_ptr);
+    large_string_builder_free(builder);
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+LEAN_EXPORT lean_obj_res lean_large_string_builder_length(b_lean_obj_arg builder_ptr, lean_obj_arg w) {
+    LargeStringBuilder* builder = (LargeStringBuilder*)lean_unbox_usize(builder_ptr);
+    size_t len = large_string_builder_length(builder);
+    return lean_io_result_mk_ok(lean_box_usize(len));
+}
+
+// ============================================================================
+// String View Builder FFI
+// ============================================================================
+
+LEAN_EXPORT lean_obj_res lean_string_view_builder_create(size_t capacity, size_t block_size, lean_obj_arg w) {
+    StringViewBuilder* builder = string_view_builder_create(capacity, block_size);
+    if (!builder) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some(lean_box_usize((uintptr_t)builder)));
+}
+
+LEAN_EXPORT lean_obj_res lean_string_view_builder_append(b_lean_obj_arg builder_ptr, b_lean_obj_arg str, lean_obj_arg w) {
+    StringViewBuilder* builder = (StringViewBuilder*)lean_unbox_usize(builder_ptr);
+    const char* cstr = lean_string_cstr(str);
+    size_t len = lean_string_size(str) - 1;  // Exclude null terminator
+    int result = string_view_builder_append(builder, cstr, len);
+    return lean_io_result_mk_ok(lean_box(result == BUILDER_OK ? 1 : 0));
+}
+
+LEAN_EXPORT lean_obj_res lean_string_view_builder_append_null(b_lean_obj_arg builder_ptr, lean_obj_arg w) {
+    StringViewBuilder* builder = (StringViewBuilder*)lean_unbox_usize(builder_ptr);
+    int result = string_view_builder_append_null(builder);
+    return lean_io_result_mk_ok(lean_box(result == BUILDER_OK ? 1 : 0));
+}
+
+LEAN_EXPORT lean_obj_res lean_string_view_builder_finish(b_lean_obj_arg builder_ptr, lean_obj_arg w) {
+    StringViewBuilder* builder = (StringViewBuilder*)lean_unbox_usize(builder_ptr);
+    struct ArrowArray* array = string_view_builder_finish(builder);
+    if (!array) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some(lean_box_usize((uintptr_t)array)));
+}
+
+LEAN_EXPORT lean_obj_res lean_string_view_builder_free(b_lean_obj_arg builder_ptr, lean_obj_arg w) {
+    StringViewBuilder* builder = (StringViewBuilder*)lean_unbox_usize(builder_ptr);
+    string_view_builder_free(builder);
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+LEAN_EXPORT lean_obj_res lean_string_view_builder_length(b_lean_obj_arg builder_ptr, lean_obj_arg w) {
+    StringViewBuilder* builder = (StringViewBuilder*)lean_unbox_usize(builder_ptr);
+    size_t len = string_view_builder_length(builder);
+    return lean_io_result_mk_ok(lean_box_usize(len));
+}
+
 // ============================================================================
 // Timestamp Builder FFI
 // ============================================================================
@@ -886,6 +980,53 @@ LEAN_EXPORT lean_obj_res lean_binary_builder_length(b_lean_obj_arg builder_ptr,
     return lean_io_result_mk_ok(lean_box_usize(len));
 }
 
+// ============================================================================
+// Large Binary Builder FFI
+// ============================================================================
+
+LEAN_EXPORT lean_obj_res lean_large_binary_builder_create(size_t capacity, size_t data_capacity, lean_obj_arg w) {
+    LargeBinaryBuilder* builder = large_binary_builder_create(capacity, data_capacity);
+    if (!builder) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some(lean_box_usize((uintptr_t)builder)));
+}
+
+LEAN_EXPORT lean_obj_res lean_large_binary_builder_append(b_lean_obj_arg builder_ptr, b_lean_obj_arg data, lean_obj_arg w) {
+    LargeBinaryBuilder* builder = (LargeBinaryBuilder*)lean_unbox_usize(builder_ptr);
+    size_t len = lean_sarray_size(data);
+    const uint8_t* bytes = lean_sarray_cptr(data);
+    int result = large_binary_builder_append(builder, bytes, len);
+    return lean_io_result_mk_ok(lean_box(result == BUILDER_OK ? 1 : 0));
+}
+
+LEAN_EXPORT lean_obj_res lean_large_binary_builder_append_null(b_lean_obj_arg builder_ptr, lean_obj_arg w) {
+    LargeBinaryBuilder* builder = (LargeBinaryBuilder*)lean_unbox_usize(builder_ptr);
+    int result = large_binary_builder_append_null(builder);
+    return lean_io_result_mk_ok(lean_box(result == BUILDER_OK ? 1 : 0));
+}
+
+LEAN_EXPORT lean_obj_res lean_large_binary_builder_finish(b_lean_obj_arg builder_ptr, lean_obj_arg w) {
+    LargeBinaryBuilder* builder = (LargeBinaryBuilder*)lean_unbox_usize(builder_ptr);
+    struct ArrowArray* array = large_binary_builder_finish(builder);
+    if (!array) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some(lean_box_usize((uintptr_t)array)));
+}
+
+LEAN_EXPORT lean_obj_res lean_large_binary_builder_free(b_lean_obj_arg builder_ptr, lean_obj_arg w) {
+    LargeBinaryBuilder* builder = (LargeBinaryBuilder*)lean_unbox_usize(builder_ptr);
+    large_binary_builder_free(builder);
+    return lean_io_result_mk_ok(lean_box(0));
+}
+
+LEAN_EXPORT lean_obj_res lean_large_binary_builder_length(b_lean_obj_arg builder_ptr, lean_obj_arg w) {
+    LargeBinaryBuilder* builder = (LargeBinaryBuilder*)lean_unbox_usize(builder_ptr);
+    size_t len = large_binary_builder_length(builder);
+    return lean_io_result_mk_ok(lean_box_usize(len));
+}
+
 // ============================================================================
 // Schema Builder FFI
 // ============================================================================
@@ -1032,6 +1173,27 @@ LEAN_EXPORT lean_obj_res lean_schema_builder_add_binary(b_lean_obj_arg builder_p
     return lean_io_result_mk_ok(lean_box(result == BUILDER_OK ? 1 : 0));
 }
 
+LEAN_EXPORT lean_obj_res lean_schema_builder_add_large_string(b_lean_obj_arg builder_ptr, b_lean_obj_arg name, uint8_t nullable, lean_obj_arg w) {
+    SchemaBuilder* builder = (SchemaBuilder*)lean_unbox_usize(builder_ptr);
+    const char* cname = lean_string_cstr(name);
+    int result = schema_builder_add_large_string(builder, cname, nullable != 0);
+    return lean_io_result_mk_ok(lean_box(result == BUILDER_OK ? 1 : 0));
+}
+
+LEAN_EXPORT lean_obj_res lean_schema_builder_add_large_binary(b_lean_obj_arg builder_ptr, b_lean_obj_arg name, uint8_t nullable, lean_obj_arg w) {
+    SchemaBuilder* builder = (SchemaBuilder*)lean_unbox_usize(builder_ptr);
+    const char* cname = lean_string_cstr(name);
+    int result = schema_builder_add_large_binary(builder, cname, nullable != 0);
+    return lean_io_result_mk_ok(lean_box(result == BUILDER_OK ? 1 : 0));
+}
+
+LEAN_EXPORT lean_obj_res lean_schema_builder_add_string_view(b_lean_obj_arg builder_ptr, b_lean_obj_arg name, uint8_t nullable, lean_obj_arg w) {
+    SchemaBuilder* builder = (SchemaBuilder*)lean_unbox_usize(builder_ptr);
+    const char* cname = lean_string_cstr(name);
+    int result = schema_builder_add_string_view(builder, cname, nullable != 0);
+    return lean_io_result_mk_ok(lean_box(result == BUILDER_OK ? 1 : 0));
+}
+
 LEAN_EXPORT lean_obj_res lean_schema_builder_finish(b_lean_obj_arg builder_ptr, lean_obj_arg w) {
     SchemaBuilder* builder = (SchemaBuilder*)lean_unbox_usize(builder_ptr);
     struct ArrowSchema* schema = schema_builder_finish(builder);
@@ -1451,3 +1613,510 @@ LEAN_EXPORT lean_obj_res lean_dictionary_builder_dict_size(b_lean_obj_arg builde
     size_t size = dictionary_builder_dict_size(builder);
     return lean_io_result_mk_ok(lean_box_usize(size));
 }
+
+// ============================================================================
+// Column Construction FFI
+// ============================================================================
+//
+// Build a whole column in one call instead of one FFI call per element.
+// `validity` is a ByteArray with one byte per value (0 = null), or empty when
+// every value is valid. Boxed array elements are unboxed a chunk at a time
+// into a stack buffer and handed to the builder's append_values; FloatArray
+// and ByteArray payloads are appended straight from their storage.
+
+#define COLUMN_CHUNK 1024
+
+static int column_validity_ok(b_lean_obj_arg validity, size_t length) {
+    size_t size = lean_sarray_size(validity);
+    return size == 0 || size == length;
+}
+
+// Pack mask bytes [start, start + count) into Arrow validity bits (NULL when
+// the mask is empty)
+static const uint8_t* column_validity_bits(b_lean_obj_arg validity, size_t start, size_t count, uint8_t* bits) {
+    if (lean_sarray_size(validity) == 0) {
+        return NULL;
+    }
+    const uint8_t* mask = lean_sarray_cptr(validity) + start;
+    memset(bits, 0, (count + 7) / 8);
+    for (size_t i = 0; i < count; i++) {
+        if (mask[i]) bits[i / 8] |= (uint8_t)(1u << (i % 8));
+    }
+    return bits;
+}
+
+static inline size_t column_chunk_count(size_t length, size_t start) {
+    return length - start < COLUMN_CHUNK ? length - start : COLUMN_CHUNK;
+}
+
+static inline lean_obj_res column_result(struct ArrowArray* array) {
+    if (!array) {
+        return lean_io_result_mk_ok(lean_mk_option_none());
+    }
+    return lean_io_result_mk_ok(lean_mk_option_some(lean_box_usize((uintptr_t)array)));
+}
+
+// `Option α` elements: none is the scalar box 0, some holds the boxed value
+static inline lean_object* column_option_value(b_lean_obj_arg option) {
+    return lean_is_scalar(option) ? NULL : lean_ctor_get(option, 0);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_int8_column(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    Int8Builder* builder = int8_builder_create(length);
+    if (!builder) return column_result(NULL);
+    int8_t chunk[COLUMN_CHUNK];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        for (size_t i = 0; i < count; i++) {
+            chunk[i] = (int8_t)(uint8_t)lean_unbox(lean_array_get_core(values, start + i));
+        }
+        if (int8_builder_append_values(builder, chunk, count, column_validity_bits(validity, start, count, bits)) != BUILDER_OK) {
+            int8_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = int8_builder_finish(builder);
+    int8_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_int16_column(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    Int16Builder* builder = int16_builder_create(length);
+    if (!builder) return column_result(NULL);
+    int16_t chunk[COLUMN_CHUNK];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        for (size_t i = 0; i < count; i++) {
+            chunk[i] = (int16_t)(uint16_t)lean_unbox(lean_array_get_core(values, start + i));
+        }
+        if (int16_builder_append_values(builder, chunk, count, column_validity_bits(validity, start, count, bits)) != BUILDER_OK) {
+            int16_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = int16_builder_finish(builder);
+    int16_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_int32_column(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    Int32Builder* builder = int32_builder_create(length);
+    if (!builder) return column_result(NULL);
+    int32_t chunk[COLUMN_CHUNK];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        for (size_t i = 0; i < count; i++) {
+            chunk[i] = (int32_t)lean_unbox_uint32(lean_array_get_core(values, start + i));
+        }
+        if (int32_builder_append_values(builder, chunk, count, column_validity_bits(validity, start, count, bits)) != BUILDER_OK) {
+            int32_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = int32_builder_finish(builder);
+    int32_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_int64_column(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    Int64Builder* builder = int64_builder_create(length);
+    if (!builder) return column_result(NULL);
+    int64_t chunk[COLUMN_CHUNK];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        for (size_t i = 0; i < count; i++) {
+            chunk[i] = (int64_t)lean_unbox_uint64(lean_array_get_core(values, start + i));
+        }
+        if (int64_builder_append_values(builder, chunk, count, column_validity_bits(validity, start, count, bits)) != BUILDER_OK) {
+            int64_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = int64_builder_finish(builder);
+    int64_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_uint8_column(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    UInt8Builder* builder = uint8_builder_create(length);
+    if (!builder) return column_result(NULL);
+    uint8_t chunk[COLUMN_CHUNK];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        for (size_t i = 0; i < count; i++) {
+            chunk[i] = (uint8_t)lean_unbox(lean_array_get_core(values, start + i));
+        }
+        if (uint8_builder_append_values(builder, chunk, count, column_validity_bits(validity, start, count, bits)) != BUILDER_OK) {
+            uint8_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = uint8_builder_finish(builder);
+    uint8_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_uint16_column(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    UInt16Builder* builder = uint16_builder_create(length);
+    if (!builder) return column_result(NULL);
+    uint16_t chunk[COLUMN_CHUNK];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        for (size_t i = 0; i < count; i++) {
+            chunk[i] = (uint16_t)lean_unbox(lean_array_get_core(values, start + i));
+        }
+        if (uint16_builder_append_values(builder, chunk, count, column_validity_bits(validity, start, count, bits)) != BUILDER_OK) {
+            uint16_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = uint16_builder_finish(builder);
+    uint16_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_uint32_column(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    UInt32Builder* builder = uint32_builder_create(length);
+    if (!builder) return column_result(NULL);
+    uint32_t chunk[COLUMN_CHUNK];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        for (size_t i = 0; i < count; i++) {
+            chunk[i] = lean_unbox_uint32(lean_array_get_core(values, start + i));
+        }
+        if (uint32_builder_append_values(builder, chunk, count, column_validity_bits(validity, start, count, bits)) != BUILDER_OK) {
+            uint32_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = uint32_builder_finish(builder);
+    uint32_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_uint64_column(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    UInt64Builder* builder = uint64_builder_create(length);
+    if (!builder) return column_result(NULL);
+    uint64_t chunk[COLUMN_CHUNK];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        for (size_t i = 0; i < count; i++) {
+            chunk[i] = lean_unbox_uint64(lean_array_get_core(values, start + i));
+        }
+        if (uint64_builder_append_values(builder, chunk, count, column_validity_bits(validity, start, count, bits)) != BUILDER_OK) {
+            uint64_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = uint64_builder_finish(builder);
+    uint64_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_float64_column(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    Float64Builder* builder = float64_builder_create(length);
+    if (!builder) return column_result(NULL);
+    double chunk[COLUMN_CHUNK];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        for (size_t i = 0; i < count; i++) {
+            chunk[i] = lean_unbox_float(lean_array_get_core(values, start + i));
+        }
+        if (float64_builder_append_values(builder, chunk, count, column_validity_bits(validity, start, count, bits)) != BUILDER_OK) {
+            float64_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = float64_builder_finish(builder);
+    float64_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_timestamp_column(b_lean_obj_arg values, b_lean_obj_arg timezone, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    TimestampBuilder* builder = timestamp_builder_create(length, lean_string_cstr(timezone));
+    if (!builder) return column_result(NULL);
+    int64_t chunk[COLUMN_CHUNK];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        for (size_t i = 0; i < count; i++) {
+            chunk[i] = (int64_t)lean_unbox_uint64(lean_array_get_core(values, start + i));
+        }
+        if (timestamp_builder_append_values(builder, chunk, count, column_validity_bits(validity, start, count, bits)) != BUILDER_OK) {
+            timestamp_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = timestamp_builder_finish(builder);
+    timestamp_builder_free(builder);
+    return column_result(array);
+}
+
+// FloatArray stores unboxed doubles, so each chunk is copied straight out of it
+LEAN_EXPORT lean_obj_res lean_build_float64_column_of_float_array(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_sarray_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    Float64Builder* builder = float64_builder_create(length);
+    if (!builder) return column_result(NULL);
+    const double* data = lean_float_array_cptr(values);
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        if (float64_builder_append_values(builder, data + start, count, column_validity_bits(validity, start, count, bits)) != BUILDER_OK) {
+            float64_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = float64_builder_finish(builder);
+    float64_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_uint8_column_of_byte_array(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_sarray_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    UInt8Builder* builder = uint8_builder_create(length);
+    if (!builder) return column_result(NULL);
+    const uint8_t* data = lean_sarray_cptr(values);
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        if (uint8_builder_append_values(builder, data + start, count, column_validity_bits(validity, start, count, bits)) != BUILDER_OK) {
+            uint8_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = uint8_builder_finish(builder);
+    uint8_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_bool_column(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    BoolBuilder* builder = bool_builder_create(length);
+    if (!builder) return column_result(NULL);
+    uint8_t chunk[COLUMN_CHUNK / 8];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        memset(chunk, 0, (count + 7) / 8);
+        for (size_t i = 0; i < count; i++) {
+            if (lean_unbox(lean_array_get_core(values, start + i))) chunk[i / 8] |= (uint8_t)(1u << (i % 8));
+        }
+        if (bool_builder_append_values(builder, chunk, count, column_validity_bits(validity, start, count, bits)) != BUILDER_OK) {
+            bool_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = bool_builder_finish(builder);
+    bool_builder_free(builder);
+    return column_result(array);
+}
+
+// Strings live in separate Lean objects, so they are appended one by one, but
+// into buffers sized for the whole column up front
+LEAN_EXPORT lean_obj_res lean_build_string_column(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    const uint8_t* mask = lean_sarray_size(validity) ? lean_sarray_cptr(validity) : NULL;
+    size_t data_size = 0;
+    for (size_t i = 0; i < length; i++) {
+        data_size += lean_string_size(lean_array_get_core(values, i)) - 1;
+    }
+    StringBuilder* builder = string_builder_create(length, data_size);
+    if (!builder) return column_result(NULL);
+    for (size_t i = 0; i < length; i++) {
+        lean_object* str = lean_array_get_core(values, i);
+        int result = (mask && !mask[i])
+            ? string_builder_append_null(builder)
+            : string_builder_append(builder, lean_string_cstr(str), lean_string_size(str) - 1);
+        if (result != BUILDER_OK) {
+            string_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = string_builder_finish(builder);
+    string_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_binary_column(b_lean_obj_arg values, b_lean_obj_arg validity, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    if (!column_validity_ok(validity, length)) return column_result(NULL);
+    const uint8_t* mask = lean_sarray_size(validity) ? lean_sarray_cptr(validity) : NULL;
+    size_t data_size = 0;
+    for (size_t i = 0; i < length; i++) {
+        data_size += lean_sarray_size(lean_array_get_core(values, i));
+    }
+    BinaryBuilder* builder = binary_builder_create(length, data_size);
+    if (!builder) return column_result(NULL);
+    for (size_t i = 0; i < length; i++) {
+        lean_object* bytes = lean_array_get_core(values, i);
+        int result = (mask && !mask[i])
+            ? binary_builder_append_null(builder)
+            : binary_builder_append(builder, lean_sarray_cptr(bytes), lean_sarray_size(bytes));
+        if (result != BUILDER_OK) {
+            binary_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = binary_builder_finish(builder);
+    binary_builder_free(builder);
+    return column_result(array);
+}
+
+// ----------------------------------------------------------------------------
+// Array (Option α): nulls come from the elements themselves
+// ----------------------------------------------------------------------------
+
+LEAN_EXPORT lean_obj_res lean_build_opt_int64_column(b_lean_obj_arg values, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    Int64Builder* builder = int64_builder_create(length);
+    if (!builder) return column_result(NULL);
+    int64_t chunk[COLUMN_CHUNK];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        memset(bits, 0, (count + 7) / 8);
+        for (size_t i = 0; i < count; i++) {
+            lean_object* value = column_option_value(lean_array_get_core(values, start + i));
+            chunk[i] = value ? (int64_t)lean_unbox_uint64(value) : 0;
+            if (value) bits[i / 8] |= (uint8_t)(1u << (i % 8));
+        }
+        if (int64_builder_append_values(builder, chunk, count, bits) != BUILDER_OK) {
+            int64_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = int64_builder_finish(builder);
+    int64_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_opt_float64_column(b_lean_obj_arg values, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    Float64Builder* builder = float64_builder_create(length);
+    if (!builder) return column_result(NULL);
+    double chunk[COLUMN_CHUNK];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        memset(bits, 0, (count + 7) / 8);
+        for (size_t i = 0; i < count; i++) {
+            lean_object* value = column_option_value(lean_array_get_core(values, start + i));
+            chunk[i] = value ? lean_unbox_float(value) : 0.0;
+            if (value) bits[i / 8] |= (uint8_t)(1u << (i % 8));
+        }
+        if (float64_builder_append_values(builder, chunk, count, bits) != BUILDER_OK) {
+            float64_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = float64_builder_finish(builder);
+    float64_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_opt_timestamp_column(b_lean_obj_arg values, b_lean_obj_arg timezone, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    TimestampBuilder* builder = timestamp_builder_create(length, lean_string_cstr(timezone));
+    if (!builder) return column_result(NULL);
+    int64_t chunk[COLUMN_CHUNK];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        memset(bits, 0, (count + 7) / 8);
+        for (size_t i = 0; i < count; i++) {
+            lean_object* value = column_option_value(lean_array_get_core(values, start + i));
+            chunk[i] = value ? (int64_t)lean_unbox_uint64(value) : 0;
+            if (value) bits[i / 8] |= (uint8_t)(1u << (i % 8));
+        }
+        if (timestamp_builder_append_values(builder, chunk, count, bits) != BUILDER_OK) {
+            timestamp_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = timestamp_builder_finish(builder);
+    timestamp_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_opt_bool_column(b_lean_obj_arg values, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    BoolBuilder* builder = bool_builder_create(length);
+    if (!builder) return column_result(NULL);
+    uint8_t chunk[COLUMN_CHUNK / 8];
+    uint8_t bits[COLUMN_CHUNK / 8];
+    for (size_t start = 0; start < length; start += COLUMN_CHUNK) {
+        size_t count = column_chunk_count(length, start);
+        memset(chunk, 0, (count + 7) / 8);
+        memset(bits, 0, (count + 7) / 8);
+        for (size_t i = 0; i < count; i++) {
+            lean_object* value = column_option_value(lean_array_get_core(values, start + i));
+            if (!value) continue;
+            bits[i / 8] |= (uint8_t)(1u << (i % 8));
+            if (lean_unbox(value)) chunk[i / 8] |= (uint8_t)(1u << (i % 8));
+        }
+        if (bool_builder_append_values(builder, chunk, count, bits) != BUILDER_OK) {
+            bool_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = bool_builder_finish(builder);
+    bool_builder_free(builder);
+    return column_result(array);
+}
+
+LEAN_EXPORT lean_obj_res lean_build_opt_string_column(b_lean_obj_arg values, lean_obj_arg w) {
+    size_t length = lean_array_size(values);
+    size_t data_size = 0;
+    for (size_t i = 0; i < length; i++) {
+        lean_object* str = column_option_value(lean_array_get_core(values, i));
+        if (str) data_size += lean_string_size(str) - 1;
+    }
+    StringBuilder* builder = string_builder_create(length, data_size);
+    if (!builder) return column_result(NULL);
+    for (size_t i = 0; i < length; i++) {
+        lean_object* str = column_option_value(lean_array_get_core(values, i));
+        int result = str
+            ? string_builder_append(builder, lean_string_cstr(str), lean_string_size(str) - 1)
+            : string_builder_append_null(builder);
+        if (result != BUILDER_OK) {
+            string_builder_free(builder);
+            return column_result(NULL);
+        }
+    }
+    struct ArrowArray* array = string_builder_finish(builder);
+    string_builder_free(builder);
+    return column_result(array);
+}
@@ -3,9 +3,12 @@
 
 #include "parquet_reader_impl.h"
 #include "arrow_builders.h"
+#define ARROW_MEMORY_SUBSYSTEM ARROW_MEMORY_PARQUET
+#include "arrow_memory.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <zstd.h>
 
 // ============================================================================
 // Thrift Compact Protocol Reader Implementation
@@ -683,6 +686,93 @@ static int parse_schema_element(ThriftReader* reader, ParquetSchemaElement* elem
     return 0;
 }
 
+// ============================================================================
+// Statistics Parsing
+// ============================================================================
+
+static int parse_statistics(ThriftReader* reader, ParquetColumnChunkMeta* meta) {
+    int16_t field_id;
+    uint8_t type;
+    int16_t last_field = 0;
+
+    // Deprecated min/max (fields 1/2) were ordered by signed byte comparison,
+    // so they are only used as a fallback for non-binary types.
+    uint8_t* legacy_min = NULL;
+    uint8_t* legacy_max = NULL;
+    size_t legacy_min_len = 0, legacy_max_len = 0;
+    bool has_legacy_min = false, has_legacy_max = false;
+    bool has_min = false, has_max = false;
+
+    meta->has_statistics = true;
+    meta->null_count = -1;
+    meta->distinct_count = -1;
+
+    while (1) {
+        if (thrift_reader_read_field_header(reader, &field_id, &type, last_field) != 0) goto fail;
+        if (type == THRIFT_CT_STOP) break;
+
+        switch (field_id) {
+            case 1:  // max (deprecated)
+                free(legacy_max);
+                if (thrift_reader_read_binary(reader, &legacy_max, &legacy_max_len) != 0) goto fail;
+                has_legacy_max = true;
+                break;
+            case 2:  // min (deprecated)
+                free(legacy_min);
+                if (thrift_reader_read_binary(reader, &legacy_min, &legacy_min_len) != 0) goto fail;
+                has_legacy_min = true;
+                break;
+            case 3: {  // null_count
+                int64_t val;
+                if (thrift_reader_read_zigzag(reader, &val) != 0) goto fail;
+                meta->null_count = val;
+                break;
+            }
+            case 4: {  // distinct_count
+                int64_t val;
+                if (thrift_reader_read_zigzag(reader, &val) != 0) goto fail;
+                meta->distinct_count = val;
+                break;
+            }
+            case 5:  // max_value
+                free(meta->max_value);
+                if (thrift_reader_read_binary(reader, &meta->max_value, &meta->max_value_len) != 0) goto fail;
+                has_max = true;
+                break;
+            case 6:  // min_value
+                free(meta->min_value);
+                if (thrift_reader_read_binary(reader, &meta->min_value, &meta->min_value_len) != 0) goto fail;
+                has_min = true;
+                break;
+            default:
+                if (thrift_reader_skip_field(reader, type) != 0) goto fail;
+        }
+        last_field = field_id;
+    }
+
+    if (!(has_min && has_max) && has_legacy_min && has_legacy_max &&
+        meta->type != PARQUET_TYPE_BYTE_ARRAY && meta->type != PARQUET_TYPE_FIXED_LEN_BYTE_ARRAY) {
+        free(meta->min_value);
+        free(meta->max_value);
+        meta->min_value = legacy_min;
+        meta->min_value_len = legacy_min_len;
+        meta->max_value = legacy_max;
+        meta->max_value_len = legacy_max_len;
+        legacy_min = legacy_max = NULL;
+        has_min = has_max = true;
+    }
+    meta->has_min_max = has_min && has_max;
+
+    free(legacy_min);
+    free(legacy_max);
+    return 0;
+
+fail:
+    free(legacy_min);
+    free(legacy_max);
+    return -1;
+}
+
 // ============================================================================
 // Column Chunk Metadata Parsing
 // ============================================================================
@@ -767,6 +857,22 @@ static int parse_column_metadata(ThriftReader* reader, ParquetColumnChunkMeta* m
                 meta->dictionary_page_offset = val;
                 break;
             }
+            case 12: {  // statistics
+                if (parse_statistics(reader, meta) != 0) return -1;
+                break;
+            }
+            case 14: {  // bloom_filter_offset
+                int64_t val;
+                if (thrift_reader_read_zigzag(reader, &val) != 0) return -1;
+                meta->bloom_filter_offset = val;
+                break;
+            }
+            case 15: {  // bloom_filter_length
+                int64_t val;
+                if (thrift_reader_read_zigzag(reader, &val) != 0) return -1;
+                meta->bloom_filter_length = (int32_t)val;
+                break;
+            }
             default:
                 if (thrift_reader_skip_field(reader, type) != 0) return -1;
         }
@@ -1036,6 +1142,8 @@ void parquet_column_chunk_meta_free(ParquetColumnChunkMeta* chunk) {
     if (!chunk) return;
     free(chunk->encodings);
     free(chunk->path_in_schema);
+    free(chunk->min_value);
+    free(chunk->max_value);
 }
 
 void parquet_row_group_meta_free(ParquetRowGroupMeta* rg) {
@@ -1145,47 +1253,258 @@ static const char* parquet_type_to_arrow_format(ParquetType type, ParquetConvert
     }
 }
 
-int parquet_schema_to_arrow(const ParquetFileMeta* meta, struct ArrowSchema* out) {
+// Node of the Parquet schema tree annotated with Dremel levels. LIST
+// annotated groups collapse their repeated middle level into one node.
+typedef enum {
+    READ_NODE_PRIMITIVE,
+    READ_NODE_STRUCT,
+    READ_NODE_LIST
+} ReadNodeKind;
+
+typedef struct ReadNode {
+    ReadNodeKind kind;
+    const ParquetSchemaElement* elem;
+    struct ReadNode* parent;
+    struct ReadNode* children;
+    int num_children;
+    bool nullable;
+    int16_t def_level;  // Definition level at which this node is present
+    int16_t rep_level;  // LIST: level of its elements; PRIMITIVE: max level
+    int column_index;   // PRIMITIVE: leaf column (column chunk) index
+    int first_leaf;     // First leaf column of the subtree
+} ReadNode;
+
+typedef struct {
+    ReadNode* fields;
+    int num_fields;
+    ReadNode** leaves;  // Leaf nodes in column chunk order
+    int num_leaves;
+    ParquetBytesLayout bytes_layout;  // Arrow layout of byte array columns
+} ReadSchema;
+
+static void read_node_free(ReadNode* node) {
+    for (int i = 0; i < node->num_children; i++) {
+        read_node_free(&node->children[i]);
+    }
+    free(node->children);
+}
+
+static void read_schema_free(ReadSchema* schema) {
+    for (int i = 0; i < schema->num_fields; i++) {
+        read_node_free(&schema->fields[i]);
+    }
+    free(schema->fields);
+    free(schema->leaves);
+    memset(schema, 0, sizeof(*schema));
+}
+
+// Build the subtree rooted at meta->schema[*pos]. The repeated node of a
+// two-level list is itself the element and is treated as required.
+static int build_read_node(const ParquetFileMeta* meta, int* pos, ReadNode* parent,
+                           int16_t parent_def, int16_t parent_rep, bool list_element,
+                           int* num_leaves, ReadNode* out) {
+    if (*pos >= meta->num_schema_elements) return -1;
+    const ParquetSchemaElement* elem = &meta->schema[(*pos)++];
+
     memset(out, 0, sizeof(*out));
+    out->elem = elem;
+    out->parent = parent;
+    out->column_index = -1;
+    out->first_leaf = *num_leaves;
+
+    ParquetRepetition repetition = list_element ? PARQUET_REPETITION_REQUIRED : elem->repetition;
+    if (repetition == PARQUET_REPETITION_REPEATED) return -1;  // Only LIST-annotated repetition
+    out->nullable = repetition == PARQUET_REPETITION_OPTIONAL;
+    out->def_level = (int16_t)(parent_def + (out->nullable ? 1 : 0));
+
+    if (elem->num_children == 0) {
+        out->kind = READ_NODE_PRIMITIVE;
+        out->rep_level = parent_rep;
+        out->column_index = (*num_leaves)++;
+        return 0;
+    }
 
-    // Count leaf columns (skip root element)
-    int num_columns = 0;
-    for (int i = 1; i < meta->num_schema_elements; i++) {
-        if (meta->schema[i].num_children == 0) {
-            num_columns++;
+    if (elem->converted_type == PARQUET_CONVERTED_LIST && elem->num_children == 1 &&
+        *pos < meta->num_schema_elements &&
+        meta->schema[*pos].repetition == PARQUET_REPETITION_REPEATED) {
+        out->kind = READ_NODE_LIST;
+        out->rep_level = (int16_t)(parent_rep + 1);
+        out->children = calloc(1, sizeof(ReadNode));
+        if (!out->children) return -1;
+        out->num_children = 1;
+
+        // The repeated level adds one definition level (non-empty list)
+        int16_t elem_def = (int16_t)(out->def_level + 1);
+        if (meta->schema[*pos].num_children == 1) {
+            (*pos)++;  // Three-level list: skip the repeated wrapper group
+            return build_read_node(meta, pos, out, elem_def, out->rep_level, false,
+                                   num_leaves, &out->children[0]);
         }
+        return build_read_node(meta, pos, out, elem_def, out->rep_level, true,
+                               num_leaves, &out->children[0]);
     }
 
-    // Allocate children
-    out->format = "+s";  // struct
-    out->name = NULL;
-    out->flags = 0;
-    out->n_children = num_columns;
-    out->children = calloc(num_columns, sizeof(struct ArrowSchema*));
-    out->dictionary = NULL;
-    out->release = NULL;  // Will be set by caller
+    out->kind = READ_NODE_STRUCT;
+    out->children = calloc(elem->num_children, sizeof(ReadNode));
+    if (!out->children) return -1;
+    out->num_children = elem->num_children;
+    for (int i = 0; i < elem->num_children; i++) {
+        if (build_read_node(meta, pos, out, out->def_level, parent_rep, false,
+                            num_leaves, &out->children[i]) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
 
-    // Fill children
-    int col_idx = 0;
-    for (int i = 1; i < meta->num_schema_elements && col_idx < num_columns; i++) {
-        ParquetSchemaElement* elem = &meta->schema[i];
-        if (elem->num_children > 0) continue;  // Skip group elements
+static void collect_leaves(ReadNode* node, ReadNode** leaves) {
+    if (node->kind == READ_NODE_PRIMITIVE) {
+        leaves[node->column_index] = node;
+        return;
+    }
+    for (int i = 0; i < node->num_children; i++) {
+        collect_leaves(&node->children[i], leaves);
+    }
+}
 
-        struct ArrowSchema* child = calloc(1, sizeof(struct ArrowSchema));
-        out->children[col_idx] = child;
+static int build_read_schema(const ParquetFileMeta* meta, ReadSchema* out) {
+    memset(out, 0, sizeof(*out));
+    if (meta->num_schema_elements < 1 || meta->schema[0].num_children < 0) return -1;
+
+    int num_fields = meta->schema[0].num_children;
+    out->fields = calloc(num_fields > 0 ? num_fields : 1, sizeof(ReadNode));
+    if (!out->fields) return -1;
+    out->num_fields = num_fields;
+
+    int pos = 1;
+    int num_leaves = 0;
+    for (int i = 0; i < num_fields; i++) {
+        if (build_read_node(meta, &pos, NULL, 0, 0, false, &num_leaves, &out->fields[i]) != 0) {
+            read_schema_free(out);
+            return -1;
+        }
+    }
+
+    out->leaves = calloc(num_leaves > 0 ? num_leaves : 1, sizeof(ReadNode*));
+    if (!out->leaves) {
+        read_schema_free(out);
+        return -1;
+    }
+    out->num_leaves = num_leaves;
+    for (int i = 0; i < num_fields; i++) {
+        collect_leaves(&out->fields[i], out->leaves);
+    }
+    return 0;
+}
 
-        child->format = parquet_type_to_arrow_format(elem->type, elem->converted_type);
-        child->name = elem->name ? strdup(elem->name) : NULL;
-        child->flags = (elem->repetition != PARQUET_REPETITION_REQUIRED) ? ARROW_FLAG_NULLABLE : 0;
-        child->n_children = 0;
-        child->children = NULL;
-        child->dictionary = NULL;
-        child->release = NULL;
+static void parquet_schema_release(struct ArrowSchema* schema) {
+    if (!schema || !schema->release) return;
 
-        col_idx++;
+    free((void*)schema->format);
+    free((void*)schema->name);
+    for (int64_t i = 0; i < schema->n_children; i++) {
+        if (schema->children[i] && schema->children[i]->release) {
+            schema->children[i]->release(schema->children[i]);
+        }
+        free(schema->children[i]);
     }
+    free(schema->children);
+    schema->release = NULL;
+}
 
+// Arrow format of a byte array leaf ("u" or "z") in the requested layout
+static const char* byte_array_format(const char* format, ParquetBytesLayout layout) {
+    bool utf8 = format[0] == 'u';
+    switch (layout) {
+        case PARQUET_BYTES_OFFSETS64: return utf8 ? "U" : "Z";
+        case PARQUET_BYTES_VIEW: return utf8 ? "vu" : "vz";
+        default: return format;
+    }
+}
+
+static int read_node_to_arrow(const ReadNode* node, ParquetBytesLayout layout, struct ArrowSchema* out) {
+    memset(out, 0, sizeof(*out));
+    out->release = parquet_schema_release;
+    out->flags = node->nullable ? ARROW_FLAG_NULLABLE : 0;
+    out->name = strdup(node->elem->name ? node->elem->name : "");
+
+    switch (node->kind) {
+        case READ_NODE_PRIMITIVE:
+        {
+            if (node->elem->type == PARQUET_TYPE_INT96) return -1;
+            const char* format = parquet_type_to_arrow_format(node->elem->type,
+                                                              node->elem->converted_type);
+            if (node->elem->type == PARQUET_TYPE_BYTE_ARRAY ||
+                node->elem->type == PARQUET_TYPE_FIXED_LEN_BYTE_ARRAY) {
+                format = byte_array_format(format, layout);
+            }
+            out->format = strdup(format);
+            break;
+        }
+        case READ_NODE_STRUCT:
+            out->format = strdup("+s");
+            break;
+        case READ_NODE_LIST:
+            out->format = strdup("+l");
+            break;
+    }
+    if (!out->format || !out->name) return -1;
+
+    if (node->num_children > 0) {
+        out->children = calloc(node->num_children, sizeof(struct ArrowSchema*));
+        if (!out->children) return -1;
+        out->n_children = node->num_children;
+        for (int i = 0; i < node->num_children; i++) {
+            out->children[i] = calloc(1, sizeof(struct ArrowSchema));
+            if (!out->children[i]) return -1;
+            if (read_node_to_arrow(&node->children[i], layout, out->children[i]) != 0) return -1;
+        }
+    }
+    return 0;
+}
+
+// Build a struct schema over the selected top-level fields
+static int read_schema_to_arrow(const ReadSchema* schema, const int* fields, int num_fields,
+                                struct ArrowSchema* out) {
+    memset(out, 0, sizeof(*out));
+    out->release = parquet_schema_release;
+    out->format = strdup("+s");
+    if (!out->format) goto fail;
+
+    if (num_fields > 0) {
+        out->children = calloc(num_fields, sizeof(struct ArrowSchema*));
+        if (!out->children) goto fail;
+        out->n_children = num_fields;
+        for (int i = 0; i < num_fields; i++) {
+            out->children[i] = calloc(1, sizeof(struct ArrowSchema));
+            if (!out->children[i]) goto fail;
+            if (read_node_to_arrow(&schema->fields[fields[i]], schema->bytes_layout, out->children[i]) != 0) goto fail;
+        }
+    }
     return 0;
+
+fail:
+    parquet_schema_release(out);
+    return -1;
+}
+
+int parquet_schema_to_arrow(const ParquetFileMeta* meta, struct ArrowSchema* out) {
+    memset(out, 0, sizeof(*out));
+
+    ReadSchema schema;
+    if (build_read_schema(meta, &schema) != 0) return -1;
+
+    int* fields = calloc(schema.num_fields > 0 ? schema.num_fields : 1, sizeof(int));
+    if (!fields) {
+        read_schema_free(&schema);
+        return -1;
+    }
+    for (int i = 0; i < schema.num_fields; i++) fields[i] = i;
+
+    int result = read_schema_to_arrow(&schema, fields, schema.num_fields, out);
+    free(fields);
+    read_schema_free(&schema);
+    return result;
 }
 
 // ============================================================================
@@ -1262,298 +1581,1086 @@ void parquet_file_reader_close(ParquetFileReader* reader) {
     parquet_file_meta_free(reader->metadata);
     free(reader->page_buffer);
     free(reader->decompress_buffer);
+    ZSTD_freeDCtx(reader->zstd_dctx);
+    ZSTD_freeDDict(reader->zstd_ddict);
+    free(reader->bloom_buffer);
     free(reader);
 }
 
+int parquet_file_reader_set_zstd_dictionary(ParquetFileReader* reader, const void* dict, size_t dict_size) {
+    if (!reader) return -1;
+
+    ZSTD_freeDDict(reader->zstd_ddict);
+    reader->zstd_ddict = NULL;
+
+    if (!dict || dict_size == 0) return 0;
+
+    reader->zstd_ddict = ZSTD_createDDict(dict, dict_size);
+    return reader->zstd_ddict ? 0 : -1;
+}
+
+int parquet_file_reader_set_bytes_layout(ParquetFileReader* reader, ParquetBytesLayout layout) {
+    if (!reader) return -1;
+    if (layout != PARQUET_BYTES_OFFSETS32 && layout != PARQUET_BYTES_OFFSETS64 &&
+        layout != PARQUET_BYTES_VIEW) return -1;
+    reader->bytes_layout = layout;
+    return 0;
+}
+
 // ============================================================================
-// Data Reading (simplified, uncompressed data pages only)
+// Data Reading (PLAIN v1 data pages)
 // ============================================================================
 
-// Helper to read a column into an Arrow array
-static int read_column_data(ParquetFileReader* reader,
-                            ParquetColumnChunkMeta* col_meta,
-                            ParquetSchemaElement* schema_elem,
-                            struct ArrowArray** out_array) {
-    // Seek to data page
-    int64_t offset = col_meta->data_page_offset;
-    if (col_meta->dictionary_page_offset > 0 && col_meta->dictionary_page_offset < offset) {
-        offset = col_meta->dictionary_page_offset;
+// Grow a reader scratch buffer to at least `size` bytes
+static uint8_t* reader_scratch(uint8_t** buf, size_t* capacity, size_t size) {
+    if (size > *capacity) {
+        uint8_t* new_buf = realloc(*buf, size);
+        if (!new_buf) return NULL;
+        *buf = new_buf;
+        *capacity = size;
     }
+    return *buf;
+}
 
-    if (fseek(reader->file, offset, SEEK_SET) != 0) return -1;
+// Decompress a ZSTD page into the reader's reusable buffer
+static uint8_t* decompress_page_zstd(ParquetFileReader* reader, const uint8_t* src, size_t size,
+                                     size_t uncompressed_size) {
+    if (!reader->zstd_dctx) {
+        reader->zstd_dctx = ZSTD_createDCtx();
+        if (!reader->zstd_dctx) return NULL;
+    }
 
-    // Read page header
-    // First, we need to read enough bytes for the header
-    uint8_t header_buf[256];
-    size_t header_bytes = fread(header_buf, 1, sizeof(header_buf), reader->file);
-    if (header_bytes == 0) return -1;
+    uint8_t* dst = reader_scratch(&reader->decompress_buffer, &reader->decompress_buffer_capacity,
+                                  uncompressed_size);
+    if (!dst) return NULL;
 
-    ThriftReader header_reader;
-    thrift_reader_init(&header_reader, header_buf, header_bytes);
+    size_t result;
+    if (reader->zstd_ddict) {
+        result = ZSTD_decompress_usingDDict(reader->zstd_dctx, dst, uncompressed_size,
+                                            src, size, reader->zstd_ddict);
+    } else {
+        result = ZSTD_decompressDCtx(reader->zstd_dctx, dst, uncompressed_size, src, size);
+    }
+    if (ZSTD_isError(result) || result != uncompressed_size) return NULL;
+    return dst;
+}
 
-    ParquetPageHeader page_header;
-    if (parquet_parse_page_header(&header_reader, &page_header) != 0) return -1;
+// Decoded contents of one leaf column chunk: levels for every entry and the
+// PLAIN values of the entries whose definition level is the maximum
+typedef struct {
+    int32_t* def_levels;
+    int32_t* rep_levels;
+    int64_t num_levels;
+    int64_t levels_capacity;
+
+    uint8_t* values;     // Fixed-width values, packed booleans, or byte array data
+    size_t values_size;
+    size_t values_capacity;
+    int64_t* offsets;    // Byte arrays: num_values + 1 offsets into values
+    size_t offsets_capacity;
+    int64_t num_values;
+} ColumnData;
+
+static void column_data_free(ColumnData* data) {
+    free(data->def_levels);
+    free(data->rep_levels);
+    free(data->values);
+    free(data->offsets);
+    memset(data, 0, sizeof(*data));
+}
 
-    // Seek back and skip header, then read page data
-    size_t header_size = header_reader.pos;
-    if (fseek(reader->file, offset + header_size, SEEK_SET) != 0) return -1;
+static int column_data_reserve_values(ColumnData* data, size_t size) {
+    if (size <= data->values_capacity) return 0;
+    size_t capacity = data->values_capacity ? data->values_capacity : 256;
+    while (capacity < size) capacity *= 2;
+    uint8_t* values = realloc(data->values, capacity);
+    if (!values) return -1;
+    memset(values + data->values_capacity, 0, capacity - data->values_capacity);
+    data->values = values;
+    data->values_capacity = capacity;
+    return 0;
+}
 
-    // Allocate buffer for page data
-    size_t data_size = page_header.compressed_page_size;
-    uint8_t* page_data = malloc(data_size);
-    if (!page_data) return -1;
+static int column_data_reserve_offsets(ColumnData* data, size_t count) {
+    if (count <= data->offsets_capacity) return 0;
+    size_t capacity = data->offsets_capacity ? data->offsets_capacity : 64;
+    while (capacity < count) capacity *= 2;
+    int64_t* offsets = realloc(data->offsets, capacity * sizeof(int64_t));
+    if (!offsets) return -1;
+    if (data->offsets_capacity == 0) offsets[0] = 0;
+    data->offsets = offsets;
+    data->offsets_capacity = capacity;
+    return 0;
+}
 
-    if (fread(page_data, 1, data_size, reader->file) != data_size) {
-        free(page_data);
-        return -1;
+static int level_bit_width(int max_level) {
+    int width = 0;
+    while (max_level > 0) {
+        width++;
+        max_level >>= 1;
     }
+    return width;
+}
 
-    // For now, only handle uncompressed data
-    if (col_meta->codec != PARQUET_CODEC_UNCOMPRESSED) {
-        // TODO: Add decompression support
-        free(page_data);
-        return -1;
+// Decode a length-prefixed RLE/bit-packed level run (data page v1 layout)
+static int decode_levels(const uint8_t* data, size_t size, size_t* pos, int max_level,
+                         int32_t* out, int32_t count) {
+    if (max_level == 0) {
+        memset(out, 0, (size_t)count * sizeof(int32_t));
+        return 0;
+    }
+    if (*pos + 4 > size) return -1;
+    uint32_t len = (uint32_t)data[*pos] | ((uint32_t)data[*pos + 1] << 8) |
+                   ((uint32_t)data[*pos + 2] << 16) | ((uint32_t)data[*pos + 3] << 24);
+    *pos += 4;
+    if (len > size - *pos) return -1;
+
+    RleDecoder decoder;
+    rle_decoder_init(&decoder, data + *pos, len, level_bit_width(max_level));
+    if (rle_decoder_decode_batch(&decoder, out, count) != count) return -1;
+    for (int32_t i = 0; i < count; i++) {
+        if (out[i] < 0 || out[i] > max_level) return -1;
+    }
+    *pos += len;
+    return 0;
+}
+
+// Append `count` PLAIN values of the leaf's physical type
+static int append_plain_values(ColumnData* out, const ParquetSchemaElement* elem,
+                               const uint8_t* data, size_t size, int64_t count) {
+    size_t width = 0;
+    switch (elem->type) {
+        case PARQUET_TYPE_BOOLEAN: {
+            if ((size_t)((count + 7) / 8) > size) return -1;
+            int64_t total = out->num_values + count;
+            if (column_data_reserve_values(out, (size_t)((total + 7) / 8)) != 0) return -1;
+            for (int64_t i = 0; i < count; i++) {
+                if ((data[i >> 3] >> (i & 7)) & 1) {
+                    int64_t bit = out->num_values + i;
+                    out->values[bit >> 3] |= (uint8_t)(1u << (bit & 7));
+                }
+            }
+            out->num_values = total;
+            out->values_size = (size_t)((total + 7) / 8);
+            return 0;
+        }
+        case PARQUET_TYPE_INT32:
+        case PARQUET_TYPE_FLOAT:
+            width = 4;
+            break;
+        case PARQUET_TYPE_INT64:
+        case PARQUET_TYPE_DOUBLE:
+            width = 8;
+            break;
+        case PARQUET_TYPE_BYTE_ARRAY:
+        case PARQUET_TYPE_FIXED_LEN_BYTE_ARRAY: {
+            bool fixed = elem->type == PARQUET_TYPE_FIXED_LEN_BYTE_ARRAY;
+            if (fixed && elem->type_length <= 0) return -1;
+            if (column_data_reserve_offsets(out, (size_t)(out->num_values + count + 1)) != 0) return -1;
+            size_t pos = 0;
+            for (int64_t i = 0; i < count; i++) {
+                uint32_t len;
+                if (fixed) {
+                    len = (uint32_t)elem->type_length;
+                } else {
+                    if (pos + 4 > size) return -1;
+                    len = (uint32_t)data[pos] | ((uint32_t)data[pos + 1] << 8) |
+                          ((uint32_t)data[pos + 2] << 16) | ((uint32_t)data[pos + 3] << 24);
+                    pos += 4;
+                }
+                if (len > size - pos) return -1;
+                if (len > 0) {
+                    if (column_data_reserve_values(out, out->values_size + len) != 0) return -1;
+                    memcpy(out->values + out->values_size, data + pos, len);
+                    out->values_size += len;
+                }
+                pos += len;
+                out->offsets[out->num_values + i + 1] = (int64_t)out->values_size;
+            }
+            out->num_values += count;
+            return 0;
+        }
+        default:
+            return -1;  // INT96 is not supported
     }
 
-    // Decode based on physical type
-    int num_values = page_header.num_values;
-    if (num_values <= 0) num_values = (int)col_meta->num_values;
+    size_t bytes = (size_t)count * width;
+    if (bytes > size) return -1;
+    if (bytes > 0) {
+        if (column_data_reserve_values(out, out->values_size + bytes) != 0) return -1;
+        memcpy(out->values + out->values_size, data, bytes);
+        out->values_size += bytes;
+    }
+    out->num_values += count;
+    return 0;
+}
 
-    struct ArrowArray* array = calloc(1, sizeof(struct ArrowArray));
-    if (!array) {
-        free(page_data);
-        return -1;
+// Decode one uncompressed v1 data page: rep levels, def levels, PLAIN values
+static int decode_data_page(ColumnData* out, const ReadNode* leaf, const uint8_t* data,
+                            size_t size, int32_t num_values) {
+    if (num_values < 0) return -1;
+    int64_t needed = out->num_levels + num_values;
+    if (needed > out->levels_capacity) {
+        int64_t capacity = out->levels_capacity ? out->levels_capacity : 1024;
+        while (capacity < needed) capacity *= 2;
+        int32_t* def = realloc(out->def_levels, (size_t)capacity * sizeof(int32_t));
+        if (!def) return -1;
+        out->def_levels = def;
+        int32_t* rep = realloc(out->rep_levels, (size_t)capacity * sizeof(int32_t));
+        if (!rep) return -1;
+        out->rep_levels = rep;
+        out->levels_capacity = capacity;
     }
 
-    // Skip definition levels for optional columns (simplified)
-    size_t data_offset = 0;
-    bool is_optional = (schema_elem->repetition == PARQUET_REPETITION_OPTIONAL);
+    int32_t* rep = out->rep_levels + out->num_levels;
+    int32_t* def = out->def_levels + out->num_levels;
+    size_t pos = 0;
+    if (decode_levels(data, size, &pos, leaf->rep_level, rep, num_values) != 0) return -1;
+    if (decode_levels(data, size, &pos, leaf->def_level, def, num_values) != 0) return -1;
 
-    if (is_optional && page_header.definition_level_encoding == PARQUET_ENCODING_RLE) {
-        // Read definition level length (4 bytes)
-        if (data_offset + 4 > data_size) {
-            free(page_data);
-            free(array);
-            return -1;
+    int64_t present = 0;
+    for (int32_t i = 0; i < num_values; i++) {
+        present += def[i] == leaf->def_level;
+    }
+    if (append_plain_values(out, leaf->elem, data + pos, size - pos, present) != 0) return -1;
+
+    out->num_levels = needed;
+    return 0;
+}
+
+// Read and parse the page header at `pos`, growing the read window for
+// headers carrying large statistics
+static int read_page_header(ParquetFileReader* reader, int64_t pos, int64_t end,
+                            ParquetPageHeader* header, size_t* header_size) {
+    size_t window = 256;
+    for (;;) {
+        size_t avail = (size_t)(end - pos);
+        size_t len = window < avail ? window : avail;
+        uint8_t* buf = reader_scratch(&reader->page_buffer, &reader->page_buffer_capacity, len);
+        if (!buf) return -1;
+        if (fseek(reader->file, pos, SEEK_SET) != 0) return -1;
+        if (fread(buf, 1, len, reader->file) != len) return -1;
+
+        ThriftReader thrift;
+        thrift_reader_init(&thrift, buf, len);
+        if (parquet_parse_page_header(&thrift, header) == 0) {
+            *header_size = thrift.pos;
+            return 0;
         }
-        uint32_t def_level_len;
-        memcpy(&def_level_len, page_data + data_offset, 4);
-        data_offset += 4 + def_level_len;
+        if (len == avail) return -1;
+        window *= 4;
     }
+}
 
-    // Decode values
-    uint8_t* value_data = page_data + data_offset;
-    size_t value_data_size = data_size - data_offset;
+// Decode every data page of one leaf column chunk
+static int read_column_chunk(ParquetFileReader* reader, const ParquetColumnChunkMeta* chunk,
+                             const ReadNode* leaf, ColumnData* out) {
+    if (chunk->codec != PARQUET_CODEC_UNCOMPRESSED && chunk->codec != PARQUET_CODEC_ZSTD) return -1;
 
-    switch (schema_elem->type) {
-        case PARQUET_TYPE_INT32: {
-            int32_t* values = malloc(num_values * sizeof(int32_t));
-            int decoded = decode_plain_int32(value_data, value_data_size, values, num_values);
-            if (decoded <= 0) {
-                free(values);
-                free(page_data);
-                free(array);
-                return -1;
-            }
+    int64_t pos = chunk->data_page_offset;
+    if (chunk->dictionary_page_offset > 0 && chunk->dictionary_page_offset < pos) {
+        pos = chunk->dictionary_page_offset;
+    }
+    int64_t end = pos + chunk->total_compressed_size;
+    if (pos < 4 || end > reader->file_size) return -1;
+
+    while (out->num_levels < chunk->num_values && pos < end) {
+        ParquetPageHeader header;
+        size_t header_size;
+        if (read_page_header(reader, pos, end, &header, &header_size) != 0) return -1;
+        pos += (int64_t)header_size;
+        if (header.compressed_page_size < 0 || pos + header.compressed_page_size > end) return -1;
+
+        if (header.type == PARQUET_PAGE_INDEX) {
+            pos += header.compressed_page_size;
+            continue;
+        }
+        // Dictionary-encoded and v2 pages are not produced by this writer
+        if (header.type != PARQUET_PAGE_DATA || header.encoding != PARQUET_ENCODING_PLAIN) return -1;
+
+        size_t size = (size_t)header.compressed_page_size;
+        uint8_t* page = reader_scratch(&reader->page_buffer, &reader->page_buffer_capacity,
+                                       size > 0 ? size : 1);
+        if (!page) return -1;
+        if (fseek(reader->file, pos, SEEK_SET) != 0) return -1;
+        if (fread(page, 1, size, reader->file) != size) return -1;
+
+        if (chunk->codec == PARQUET_CODEC_ZSTD) {
+            if (header.uncompressed_page_size < 0) return -1;
+            page = decompress_page_zstd(reader, page, size, (size_t)header.uncompressed_page_size);
+            if (!page) return -1;
+            size = (size_t)header.uncompressed_page_size;
+        }
 
-            // Build Arrow array
-            array->length = decoded;
-            array->null_count = 0;
-            array->offset = 0;
-            array->n_buffers = 2;
-            array->n_children = 0;
-            array->buffers = calloc(2, sizeof(void*));
-            array->buffers[0] = NULL;  // No null bitmap
-            array->buffers[1] = values;
-            array->children = NULL;
-            array->dictionary = NULL;
-            array->release = NULL;  // Caller should set this
-            break;
+        if (decode_data_page(out, leaf, page, size, header.num_values) != 0) return -1;
+        pos += header.compressed_page_size;
+    }
+
+    return out->num_levels == chunk->num_values ? 0 : -1;
+}
+
+// ============================================================================
+// Record Assembly (levels -> nested Arrow arrays)
+// ============================================================================
+
+// Slots are sorted level indices into a leaf column, one per array slot of
+// the node being assembled. Every leaf under the node sees the same slot
+// structure, so any leaf's levels can drive an ancestor's assembly.
+
+static void parquet_array_release(struct ArrowArray* array) {
+    if (!array || !array->release) return;
+
+    for (int64_t i = 0; i < array->n_buffers; i++) {
+        arrow_mem_free((void*)array->buffers[i]);
+    }
+    free(array->buffers);
+    for (int64_t i = 0; i < array->n_children; i++) {
+        if (array->children[i] && array->children[i]->release) {
+            array->children[i]->release(array->children[i]);
         }
+        free(array->children[i]);
+    }
+    free(array->children);
+    array->release = NULL;
+}
 
-        case PARQUET_TYPE_INT64: {
-            int64_t* values = malloc(num_values * sizeof(int64_t));
-            int decoded = decode_plain_int64(value_data, value_data_size, values, num_values);
-            if (decoded <= 0) {
-                free(values);
-                free(page_data);
-                free(array);
-                return -1;
-            }
+// Entries with repetition level 0 start a new record
+static int64_t* record_slots(const ColumnData* data, int64_t* num_slots) {
+    int64_t count = 0;
+    for (int64_t i = 0; i < data->num_levels; i++) {
+        count += data->rep_levels[i] == 0;
+    }
+    int64_t* slots = malloc((size_t)(count > 0 ? count : 1) * sizeof(int64_t));
+    if (!slots) return NULL;
+    int64_t n = 0;
+    for (int64_t i = 0; i < data->num_levels; i++) {
+        if (data->rep_levels[i] == 0) slots[n++] = i;
+    }
+    *num_slots = count;
+    return slots;
+}
 
-            array->length = decoded;
-            array->null_count = 0;
-            array->offset = 0;
-            array->n_buffers = 2;
-            array->n_children = 0;
-            array->buffers = calloc(2, sizeof(void*));
-            array->buffers[0] = NULL;
-            array->buffers[1] = values;
-            array->children = NULL;
-            array->dictionary = NULL;
-            array->release = NULL;
-            break;
+// Expand list slots into element slots. A list slot is non-empty when its
+// definition level reaches the repeated level; its elements are the slot
+// itself plus every following entry that repeats at the list's level.
+static int64_t* list_element_slots(const ReadNode* list, const ColumnData* data,
+                                   const int64_t* slots, int64_t num_slots,
+                                   int32_t* offsets, int64_t* num_child_slots) {
+    int32_t rep = list->rep_level;
+    int32_t min_def = list->def_level + 1;
+
+    int64_t count = 0;
+    for (int64_t i = 0; i < num_slots; i++) {
+        int64_t p = slots[i];
+        if (data->def_levels[p] < min_def) continue;
+        count++;
+        for (int64_t k = p + 1; k < data->num_levels && data->rep_levels[k] >= rep; k++) {
+            count += data->rep_levels[k] == rep;
         }
+    }
 
-        case PARQUET_TYPE_FLOAT: {
-            float* values = malloc(num_values * sizeof(float));
-            int decoded = decode_plain_float(value_data, value_data_size, values, num_values);
-            if (decoded <= 0) {
-                free(values);
-                free(page_data);
-                free(array);
-                return -1;
+    int64_t* child = malloc((size_t)(count > 0 ? count : 1) * sizeof(int64_t));
+    if (!child) return NULL;
+
+    int64_t n = 0;
+    if (offsets) offsets[0] = 0;
+    for (int64_t i = 0; i < num_slots; i++) {
+        int64_t p = slots[i];
+        if (data->def_levels[p] >= min_def) {
+            child[n++] = p;
+            for (int64_t k = p + 1; k < data->num_levels && data->rep_levels[k] >= rep; k++) {
+                if (data->rep_levels[k] == rep) child[n++] = k;
             }
+        }
+        if (offsets) offsets[i + 1] = (int32_t)n;
+    }
+    *num_child_slots = count;
+    return child;
+}
 
-            array->length = decoded;
-            array->null_count = 0;
-            array->offset = 0;
-            array->n_buffers = 2;
-            array->n_children = 0;
-            array->buffers = calloc(2, sizeof(void*));
-            array->buffers[0] = NULL;
-            array->buffers[1] = values;
-            array->children = NULL;
-            array->dictionary = NULL;
-            array->release = NULL;
-            break;
+// Recompute the slots of `node` from a different leaf's levels
+static int64_t* node_slots(const ReadNode* node, const ColumnData* data, int64_t* num_slots) {
+    const ReadNode* chain[PARQUET_MAX_NESTING + 1];
+    int depth = 0;
+    for (const ReadNode* n = node->parent; n; n = n->parent) {
+        if (depth == PARQUET_MAX_NESTING) return NULL;
+        chain[depth++] = n;
+    }
+
+    int64_t* slots = record_slots(data, num_slots);
+    for (int i = depth - 1; i >= 0 && slots; i--) {
+        if (chain[i]->kind != READ_NODE_LIST) continue;
+        int64_t count;
+        int64_t* child = list_element_slots(chain[i], data, slots, *num_slots, NULL, &count);
+        free(slots);
+        slots = child;
+        *num_slots = count;
+    }
+    return slots;
+}
+
+// Output width of a fixed-width leaf (INT32 may carry narrower integers)
+static size_t leaf_value_width(const ParquetSchemaElement* elem) {
+    switch (elem->type) {
+        case PARQUET_TYPE_INT32:
+            switch (elem->converted_type) {
+                case PARQUET_CONVERTED_INT_8:
+                case PARQUET_CONVERTED_UINT_8:
+                    return 1;
+                case PARQUET_CONVERTED_INT_16:
+                case PARQUET_CONVERTED_UINT_16:
+                    return 2;
+                default:
+                    return 4;
+            }
+        case PARQUET_TYPE_FLOAT:
+            return 4;
+        case PARQUET_TYPE_INT64:
+        case PARQUET_TYPE_DOUBLE:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+// Value index of each slot's entry (-1 where the slot has no value)
+static int64_t* slot_value_indices(const ColumnData* data, int32_t max_def, const int64_t* slots,
+                                   int64_t num_slots) {
+    int64_t* indices = malloc((size_t)(num_slots > 0 ? num_slots : 1) * sizeof(int64_t));
+    if (!indices) return NULL;
+    int64_t k = 0, v = 0;
+    for (int64_t i = 0; i < num_slots; i++) {
+        int64_t p = slots[i];
+        while (k < p) {
+            v += data->def_levels[k] == max_def;
+            k++;
         }
+        indices[i] = data->def_levels[p] == max_def ? v : -1;
+    }
+    return indices;
+}
 
-        case PARQUET_TYPE_DOUBLE: {
-            double* values = malloc(num_values * sizeof(double));
-            int decoded = decode_plain_double(value_data, value_data_size, values, num_values);
-            if (decoded <= 0) {
-                free(values);
-                free(page_data);
-                free(array);
-                return -1;
+// Byte arrays as validity + int32 or int64 offsets + data
+static int assemble_byte_array_offsets(const ColumnData* data, ParquetBytesLayout layout,
+                                       const int64_t* indices, int64_t num_slots,
+                                       struct ArrowArray* out) {
+    size_t width = layout == PARQUET_BYTES_OFFSETS64 ? sizeof(int64_t) : sizeof(int32_t);
+    int64_t data_size = 0;
+    for (int64_t i = 0; i < num_slots; i++) {
+        int64_t v = indices[i];
+        if (v >= 0) data_size += data->offsets[v + 1] - data->offsets[v];
+    }
+    if (width == sizeof(int32_t) && data_size > INT32_MAX) return -1;
+
+    uint8_t* offsets = arrow_mem_alloc((size_t)(num_slots + 1) * width);
+    uint8_t* values = arrow_mem_alloc(data_size > 0 ? (size_t)data_size : 1);
+    out->n_buffers = 3;
+    out->buffers = calloc(3, sizeof(void*));
+    if (!offsets || !values || !out->buffers) {
+        arrow_mem_free(offsets);
+        arrow_mem_free(values);
+        return -1;
+    }
+
+    int64_t pos = 0;
+    for (int64_t i = 0; i <= num_slots; i++) {
+        if (width == sizeof(int64_t)) {
+            ((int64_t*)offsets)[i] = pos;
+        } else {
+            ((int32_t*)offsets)[i] = (int32_t)pos;
+        }
+        if (i == num_slots || indices[i] < 0) continue;
+        int64_t v = indices[i];
+        int64_t len = data->offsets[v + 1] - data->offsets[v];
+        memcpy(values + pos, data->values + data->offsets[v], (size_t)len);
+        pos += len;
+    }
+    out->buffers[1] = offsets;
+    out->buffers[2] = values;
+    return 0;
+}
+
+// Byte arrays as validity + 16-byte views + data buffers + int64 buffer
+// sizes. Values of up to 12 bytes are stored in the view itself.
+static int assemble_byte_array_views(const ColumnData* data, const int64_t* indices,
+                                     int64_t num_slots, struct ArrowArray* out) {
+    // First pass: split the out-of-line data into buffers of at most INT32_MAX bytes
+    int64_t* sizes = NULL;
+    int64_t n_data = 0;
+    int64_t sizes_capacity = 0;
+    for (int64_t i = 0; i < num_slots; i++) {
+        int64_t v = indices[i];
+        if (v < 0) continue;
+        int64_t len = data->offsets[v + 1] - data->offsets[v];
+        if (len > INT32_MAX) {
+            arrow_mem_free(sizes);
+            return -1;
+        }
+        if (len <= 12) continue;
+        if (n_data == 0 || sizes[n_data - 1] + len > INT32_MAX) {
+            if (n_data == sizes_capacity) {
+                sizes_capacity = sizes_capacity ? sizes_capacity * 2 : 4;
+                int64_t* new_sizes = arrow_mem_realloc(sizes, (size_t)sizes_capacity * sizeof(int64_t));
+                if (!new_sizes) {
+                    arrow_mem_free(sizes);
+                    return -1;
+                }
+                sizes = new_sizes;
             }
+            sizes[n_data++] = 0;
+        }
+        sizes[n_data - 1] += len;
+    }
 
-            array->length = decoded;
-            array->null_count = 0;
-            array->offset = 0;
-            array->n_buffers = 2;
-            array->n_children = 0;
-            array->buffers = calloc(2, sizeof(void*));
-            array->buffers[0] = NULL;
-            array->buffers[1] = values;
-            array->children = NULL;
-            array->dictionary = NULL;
-            array->release = NULL;
-            break;
+    out->n_buffers = 2 + n_data + 1;
+    out->buffers = calloc((size_t)out->n_buffers, sizeof(void*));
+    if (!out->buffers) {
+        arrow_mem_free(sizes);
+        return -1;
+    }
+    out->buffers[out->n_buffers - 1] = sizes ? (void*)sizes : arrow_mem_alloc(1);
+    uint8_t* views = arrow_mem_calloc((size_t)(num_slots > 0 ? num_slots : 1), 16);
+    out->buffers[1] = views;
+    if (!views || !out->buffers[out->n_buffers - 1]) return -1;
+    for (int64_t d = 0; d < n_data; d++) {
+        out->buffers[2 + d] = arrow_mem_alloc((size_t)sizes[d]);
+        if (!out->buffers[2 + d]) return -1;
+    }
+
+    // Second pass: fill the views and copy the out-of-line data
+    int32_t buffer_index = -1;
+    int32_t buffer_offset = 0;
+    for (int64_t i = 0; i < num_slots; i++) {
+        int64_t v = indices[i];
+        if (v < 0) continue;
+        uint8_t* view = views + i * 16;
+        const uint8_t* value = data->values + data->offsets[v];
+        int32_t len = (int32_t)(data->offsets[v + 1] - data->offsets[v]);
+        memcpy(view, &len, 4);
+        if (len <= 12) {
+            memcpy(view + 4, value, (size_t)len);
+            continue;
+        }
+        if (buffer_index < 0 || (int64_t)buffer_offset + len > sizes[buffer_index]) {
+            buffer_index++;
+            buffer_offset = 0;
+        }
+        memcpy((uint8_t*)out->buffers[2 + buffer_index] + buffer_offset, value, (size_t)len);
+        memcpy(view + 4, value, 4);
+        memcpy(view + 8, &buffer_index, 4);
+        memcpy(view + 12, &buffer_offset, 4);
+        buffer_offset += len;
+    }
+    return 0;
+}
+
+static int assemble_leaf(const ReadNode* leaf, const ColumnData* data, ParquetBytesLayout layout,
+                         const int64_t* slots, int64_t num_slots, struct ArrowArray* out) {
+    const ParquetSchemaElement* elem = leaf->elem;
+    int32_t max_def = leaf->def_level;
+
+    if (elem->type == PARQUET_TYPE_BYTE_ARRAY || elem->type == PARQUET_TYPE_FIXED_LEN_BYTE_ARRAY) {
+        int64_t* indices = slot_value_indices(data, max_def, slots, num_slots);
+        if (!indices) return -1;
+        int result = layout == PARQUET_BYTES_VIEW
+                         ? assemble_byte_array_views(data, indices, num_slots, out)
+                         : assemble_byte_array_offsets(data, layout, indices, num_slots, out);
+        free(indices);
+        return result;
+    }
+
+    size_t width = leaf_value_width(elem);
+    size_t in_width = elem->type == PARQUET_TYPE_INT32 ? 4 : width;
+    uint8_t* values;
+    if (elem->type == PARQUET_TYPE_BOOLEAN) {
+        values = arrow_mem_calloc((size_t)(num_slots + 7) / 8 + 1, 1);
+    } else {
+        values = arrow_mem_calloc((size_t)num_slots * width + 1, 1);
+    }
+    if (!values) return -1;
+
+    // Walk slots in order, counting present values to find each value index
+    int64_t k = 0, v = 0;
+    for (int64_t i = 0; i < num_slots; i++) {
+        int64_t p = slots[i];
+        while (k < p) {
+            v += data->def_levels[k] == max_def;
+            k++;
+        }
+        if (data->def_levels[p] != max_def) continue;
+        if (elem->type == PARQUET_TYPE_BOOLEAN) {
+            if ((data->values[v >> 3] >> (v & 7)) & 1) values[i >> 3] |= (uint8_t)(1u << (i & 7));
+        } else {
+            // Little-endian truncation of INT32 to the narrower width
+            memcpy(values + (size_t)i * width, data->values + (size_t)v * in_width, width);
         }
+    }
 
-        case PARQUET_TYPE_BOOLEAN: {
-            bool* values = malloc(num_values * sizeof(bool));
-            int decoded = decode_plain_boolean(value_data, value_data_size, values, num_values);
-            if (decoded <= 0) {
-                free(values);
-                free(page_data);
-                free(array);
-                return -1;
+    out->n_buffers = 2;
+    out->buffers = calloc(2, sizeof(void*));
+    if (!out->buffers) {
+        arrow_mem_free(values);
+        return -1;
+    }
+    out->buffers[1] = values;
+    return 0;
+}
+
+static int assemble_node(const ReadNode* node, const ReadSchema* schema, const ColumnData* columns,
+                         const int64_t* slots, int64_t num_slots, struct ArrowArray* out) {
+    const ColumnData* data = &columns[node->first_leaf];
+
+    memset(out, 0, sizeof(*out));
+    out->length = num_slots;
+    out->release = parquet_array_release;
+
+    // Validity from definition levels
+    uint8_t* validity = NULL;
+    if (node->nullable) {
+        validity = arrow_mem_alloc((size_t)(num_slots + 7) / 8 + 1);
+        if (!validity) return -1;
+        memset(validity, 0, (size_t)(num_slots + 7) / 8 + 1);
+        for (int64_t i = 0; i < num_slots; i++) {
+            if (data->def_levels[slots[i]] >= node->def_level) {
+                validity[i >> 3] |= (uint8_t)(1u << (i & 7));
+            } else {
+                out->null_count++;
             }
+        }
+        if (out->null_count == 0) {
+            arrow_mem_free(validity);
+            validity = NULL;
+        }
+    }
+
+    int result = 0;
+    switch (node->kind) {
+        case READ_NODE_PRIMITIVE:
+            result = assemble_leaf(node, data, schema->bytes_layout, slots, num_slots, out);
+            break;
 
-            // Convert to bit-packed format
-            size_t bit_bytes = (decoded + 7) / 8;
-            uint8_t* bit_data = calloc(bit_bytes, 1);
-            for (int i = 0; i < decoded; i++) {
-                if (values[i]) {
-                    bit_data[i / 8] |= (1 << (i % 8));
+        case READ_NODE_STRUCT:
+            out->n_buffers = 1;
+            out->buffers = calloc(1, sizeof(void*));
+            if (!out->buffers) {
+                result = -1;
+                break;
+            }
+            out->children = calloc((size_t)node->num_children, sizeof(struct ArrowArray*));
+            if (!out->children) {
+                result = -1;
+                break;
+            }
+            out->n_children = node->num_children;
+            for (int i = 0; i < node->num_children && result == 0; i++) {
+                const ReadNode* child = &node->children[i];
+                out->children[i] = calloc(1, sizeof(struct ArrowArray));
+                if (!out->children[i]) {
+                    result = -1;
+                    break;
+                }
+                if (child->first_leaf == node->first_leaf) {
+                    result = assemble_node(child, schema, columns, slots, num_slots, out->children[i]);
+                } else {
+                    int64_t count;
+                    int64_t* child_slots = node_slots(child, &columns[child->first_leaf], &count);
+                    if (!child_slots || count != num_slots) {
+                        free(child_slots);
+                        result = -1;
+                        break;
+                    }
+                    result = assemble_node(child, schema, columns, child_slots, count, out->children[i]);
+                    free(child_slots);
                 }
             }
-            free(values);
-
-            array->length = decoded;
-            array->null_count = 0;
-            array->offset = 0;
-            array->n_buffers = 2;
-            array->n_children = 0;
-            array->buffers = calloc(2, sizeof(void*));
-            array->buffers[0] = NULL;
-            array->buffers[1] = bit_data;
-            array->children = NULL;
-            array->dictionary = NULL;
-            array->release = NULL;
             break;
-        }
 
-        case PARQUET_TYPE_BYTE_ARRAY: {
-            int32_t* offsets = NULL;
-            uint8_t* values = NULL;
-            size_t values_len = 0;
-            int decoded = decode_plain_byte_array(value_data, value_data_size,
-                                                   &offsets, &values, num_values, &values_len);
-            if (decoded < 0) {
-                free(page_data);
-                free(array);
-                return -1;
+        case READ_NODE_LIST: {
+            int32_t* offsets = arrow_mem_alloc((size_t)(num_slots + 1) * sizeof(int32_t));
+            out->n_buffers = 2;
+            out->buffers = calloc(2, sizeof(void*));
+            out->children = calloc(1, sizeof(struct ArrowArray*));
+            if (!offsets || !out->buffers || !out->children) {
+                arrow_mem_free(offsets);
+                result = -1;
+                break;
+            }
+            out->buffers[1] = offsets;
+            out->n_children = 1;
+            out->children[0] = calloc(1, sizeof(struct ArrowArray));
+            if (!out->children[0]) {
+                result = -1;
+                break;
             }
 
-            array->length = decoded;
-            array->null_count = 0;
-            array->offset = 0;
-            array->n_buffers = 3;
-            array->n_children = 0;
-            array->buffers = calloc(3, sizeof(void*));
-            array->buffers[0] = NULL;     // No null bitmap
-            array->buffers[1] = offsets;  // Offset buffer
-            array->buffers[2] = values;   // Data buffer
-            array->children = NULL;
-            array->dictionary = NULL;
-            array->release = NULL;
+            int64_t count;
+            int64_t* child_slots = list_element_slots(node, data, slots, num_slots, offsets, &count);
+            if (!child_slots) {
+                result = -1;
+                break;
+            }
+            result = assemble_node(&node->children[0], schema, columns, child_slots, count,
+                                   out->children[0]);
+            free(child_slots);
             break;
         }
-
-        default:
-            free(page_data);
-            free(array);
-            return -1;
     }
 
-    free(page_data);
-    *out_array = array;
-    return 0;
+    if (out->buffers) {
+        out->buffers[0] = validity;
+    } else {
+        arrow_mem_free(validity);
+    }
+    return result;
 }
 
-// Simplified row group reader
-struct ArrowArrayStream* parquet_file_reader_read_row_group(ParquetFileReader* reader, int row_group_index) {
-    if (!reader || !reader->metadata) return NULL;
-    if (row_group_index < 0 || row_group_index >= reader->metadata->num_row_groups) return NULL;
+// ============================================================================
+// Row Group Streams
+// ============================================================================
+
+// Read the selected top-level fields of one row group into a record batch
+static RecordBatch* read_row_group_batch(ParquetFileReader* reader, const ReadSchema* schema,
+                                         int row_group_index, const int* fields, int num_fields) {
+    const ParquetRowGroupMeta* rg = &reader->metadata->row_groups[row_group_index];
+    if (rg->num_columns != schema->num_leaves) return NULL;
+
+    ColumnData* columns = calloc(schema->num_leaves > 0 ? schema->num_leaves : 1, sizeof(ColumnData));
+    struct ArrowArray** arrays = calloc(num_fields > 0 ? num_fields : 1, sizeof(struct ArrowArray*));
+    struct ArrowSchema* batch_schema = calloc(1, sizeof(struct ArrowSchema));
+    RecordBatch* batch = NULL;
+    if (!columns || !arrays || !batch_schema) goto done;
+
+    for (int f = 0; f < num_fields; f++) {
+        const ReadNode* field = &schema->fields[fields[f]];
+        int leaf_end = fields[f] + 1 < schema->num_fields ?
+                       schema->fields[fields[f] + 1].first_leaf : schema->num_leaves;
+        for (int c = field->first_leaf; c < leaf_end; c++) {
+            if (columns[c].num_levels > 0 || rg->columns[c].num_values == 0) continue;
+            if (read_column_chunk(reader, &rg->columns[c], schema->leaves[c], &columns[c]) != 0) goto done;
+        }
 
-    ParquetRowGroupMeta* rg = &reader->metadata->row_groups[row_group_index];
+        int64_t num_slots;
+        int64_t* slots = record_slots(&columns[field->first_leaf], &num_slots);
+        if (!slots) goto done;
+        arrays[f] = calloc(1, sizeof(struct ArrowArray));
+        int result = (arrays[f] && num_slots == rg->num_rows)
+                         ? assemble_node(field, schema, columns, slots, num_slots, arrays[f])
+                         : -1;
+        free(slots);
+        if (result != 0) goto done;
+    }
+
+    if (read_schema_to_arrow(schema, fields, num_fields, batch_schema) != 0) goto done;
+    batch = record_batch_create(batch_schema, arrays, (size_t)num_fields, (size_t)rg->num_rows);
+
+done:
+    for (int c = 0; columns && c < schema->num_leaves; c++) {
+        column_data_free(&columns[c]);
+    }
+    free(columns);
+    if (!batch) {
+        for (int f = 0; arrays && f < num_fields; f++) {
+            if (arrays[f] && arrays[f]->release) arrays[f]->release(arrays[f]);
+            free(arrays[f]);
+        }
+        free(arrays);
+        if (batch_schema && batch_schema->release) batch_schema->release(batch_schema);
+        free(batch_schema);
+    }
+    return batch;
+}
 
-    // For now, just return a placeholder
-    // Full implementation would read all columns and create a proper stream
-    struct ArrowArrayStream* stream = calloc(1, sizeof(struct ArrowArrayStream));
-    if (!stream) return NULL;
+// Stream the given row groups (all when row_group_index < 0), projected to
+// the given top-level fields (all when fields is NULL)
+static struct ArrowArrayStream* read_row_groups(ParquetFileReader* reader, int row_group_index,
+                                                const int* fields, int num_fields) {
+    ReadSchema schema;
+    if (build_read_schema(reader->metadata, &schema) != 0) return NULL;
+    schema.bytes_layout = reader->bytes_layout;
+
+    int first = row_group_index < 0 ? 0 : row_group_index;
+    int count = row_group_index < 0 ? reader->metadata->num_row_groups : 1;
+
+    int* all_fields = NULL;
+    if (!fields) {
+        all_fields = calloc(schema.num_fields > 0 ? schema.num_fields : 1, sizeof(int));
+        if (!all_fields) {
+            read_schema_free(&schema);
+            return NULL;
+        }
+        for (int i = 0; i < schema.num_fields; i++) all_fields[i] = i;
+        fields = all_fields;
+        num_fields = schema.num_fields;
+    }
 
-    // TODO: Implement proper streaming of row group data
-    // This would involve:
-    // 1. Creating Arrow schema from Parquet schema
-    // 2. Reading each column's data pages
-    // 3. Combining into record batches
-    // 4. Wrapping in a stream interface
+    struct ArrowArrayStream* stream = NULL;
+    RecordBatch** batches = calloc(count > 0 ? count : 1, sizeof(RecordBatch*));
+    struct ArrowSchema* stream_schema = calloc(1, sizeof(struct ArrowSchema));
+    int built = 0;
+    if (!batches || !stream_schema) goto done;
+    for (int i = 0; i < num_fields; i++) {
+        if (fields[i] < 0 || fields[i] >= schema.num_fields) goto done;
+    }
+    if (read_schema_to_arrow(&schema, fields, num_fields, stream_schema) != 0) goto done;
 
+    for (; built < count; built++) {
+        batches[built] = read_row_group_batch(reader, &schema, first + built, fields, num_fields);
+        if (!batches[built]) goto done;
+    }
+    stream = batches_to_stream(stream_schema, batches, (size_t)count);
+
+done:
+    if (!stream) {
+        for (int i = 0; i < built; i++) record_batch_free(batches[i]);
+        free(batches);
+        if (stream_schema && stream_schema->release) stream_schema->release(stream_schema);
+        free(stream_schema);
+    }
+    free(all_fields);
+    read_schema_free(&schema);
     return stream;
 }
 
-struct ArrowArrayStream* parquet_file_reader_read_all(ParquetFileReader* reader) {
+struct ArrowArrayStream* parquet_file_reader_read_row_group(ParquetFileReader* reader, int row_group_index) {
     if (!reader || !reader->metadata) return NULL;
+    if (row_group_index < 0 || row_group_index >= reader->metadata->num_row_groups) return NULL;
 
-    // Read all row groups and combine
-    struct ArrowArrayStream* stream = calloc(1, sizeof(struct ArrowArrayStream));
-    if (!stream) return NULL;
+    return read_row_groups(reader, row_group_index, NULL, 0);
+}
 
-    // TODO: Implement full file reading
-    return stream;
+struct ArrowArrayStream* parquet_file_reader_read_all(ParquetFileReader* reader) {
+    if (!reader || !reader->metadata) return NULL;
+
+    return read_row_groups(reader, -1, NULL, 0);
 }
 
 struct ArrowArrayStream* parquet_file_reader_read_columns(ParquetFileReader* reader,
                                                            int row_group_index,
                                                            int* column_indices,
                                                            int num_columns) {
-    if (!reader || !reader->metadata) return NULL;
+    if (!reader || !reader->metadata || !column_indices || num_columns < 0) return NULL;
+    if (row_group_index < 0 || row_group_index >= reader->metadata->num_row_groups) return NULL;
+
+    return read_row_groups(reader, row_group_index, column_indices, num_columns);
+}
+
+// ============================================================================
+// Point-Lookup Skipping (statistics and Bloom filters)
+// ============================================================================
+
+// Bytes read up front when the footer does not record bloom_filter_length
+#define BLOOM_HEADER_PROBE_SIZE 64
+
+// Read a single-member union (algorithm/hash/compression); returns the member id
+static int parse_bloom_union_member(ThriftReader* reader, int16_t* member_id) {
+    uint8_t type;
+    if (thrift_reader_read_field_header(reader, member_id, &type, 0) != 0) return -1;
+    if (type != THRIFT_CT_STRUCT) return -1;
+    if (thrift_reader_skip_field(reader, type) != 0) return -1;
+
+    int16_t stop_id;
+    if (thrift_reader_read_field_header(reader, &stop_id, &type, *member_id) != 0) return -1;
+    return type == THRIFT_CT_STOP ? 0 : -1;
+}
+
+// Parse BloomFilterHeader; only split-block / XXH64 / uncompressed is defined
+static int parse_bloom_filter_header(ThriftReader* reader, int32_t* num_bytes) {
+    int16_t field_id;
+    uint8_t type;
+    int16_t last_field = 0;
+    *num_bytes = 0;
+
+    while (1) {
+        if (thrift_reader_read_field_header(reader, &field_id, &type, last_field) != 0) return -1;
+        if (type == THRIFT_CT_STOP) break;
+
+        switch (field_id) {
+            case 1: {  // numBytes
+                int64_t val;
+                if (thrift_reader_read_zigzag(reader, &val) != 0) return -1;
+                *num_bytes = (int32_t)val;
+                break;
+            }
+            case 2:    // algorithm: BLOCK
+            case 3:    // hash: XXHASH
+            case 4: {  // compression: UNCOMPRESSED
+                int16_t member_id;
+                if (type != THRIFT_CT_STRUCT) return -1;
+                if (parse_bloom_union_member(reader, &member_id) != 0) return -1;
+                if (member_id != 1) return -1;
+                break;
+            }
+            default:
+                if (thrift_reader_skip_field(reader, type) != 0) return -1;
+        }
+        last_field = field_id;
+    }
+
+    return 0;
+}
+
+// Load a chunk's Bloom filter into the reader's buffer (cached by position)
+static int load_bloom_filter(ParquetFileReader* reader, int row_group, int column,
+                             const uint8_t** bitset, size_t* num_bytes) {
+    if (reader->bloom_cached && reader->bloom_row_group == row_group && reader->bloom_column == column) {
+        *bitset = reader->bloom_buffer + reader->bloom_bitset_offset;
+        *num_bytes = reader->bloom_num_bytes;
+        return 0;
+    }
+
+    ParquetColumnChunkMeta* meta = &reader->metadata->row_groups[row_group].columns[column];
+    int64_t offset = meta->bloom_filter_offset;
+    if (offset <= 0 || offset >= reader->file_size) return -1;
+
+    reader->bloom_cached = false;
+    size_t available = (size_t)(reader->file_size - offset);
+    size_t to_read = meta->bloom_filter_length > 0 ? (size_t)meta->bloom_filter_length : BLOOM_HEADER_PROBE_SIZE;
+    if (to_read > available) to_read = available;
 
-    // TODO: Implement column projection
-    return NULL;
+    uint8_t* buf = reader_scratch(&reader->bloom_buffer, &reader->bloom_buffer_capacity, to_read);
+    if (!buf) return -1;
+    if (fseek(reader->file, offset, SEEK_SET) != 0) return -1;
+    size_t got = fread(buf, 1, to_read, reader->file);
+    if (got == 0) return -1;
+
+    ThriftReader header_reader;
+    thrift_reader_init(&header_reader, buf, got);
+    int32_t bitset_bytes;
+    if (parse_bloom_filter_header(&header_reader, &bitset_bytes) != 0) return -1;
+
+    // Bitset must be a power of two and a whole number of 32-byte blocks
+    if (bitset_bytes < PARQUET_BLOOM_MIN_BYTES || bitset_bytes > PARQUET_BLOOM_MAX_BYTES) return -1;
+    if ((bitset_bytes & (bitset_bytes - 1)) != 0) return -1;
+
+    size_t total = header_reader.pos + (size_t)bitset_bytes;
+    if (total > available) return -1;
+    if (total > got) {
+        buf = reader_scratch(&reader->bloom_buffer, &reader->bloom_buffer_capacity, total);
+        if (!buf) return -1;
+        if (fread(buf + got, 1, total - got, reader->file) != total - got) return -1;
+    }
+
+    reader->bloom_cached = true;
+    reader->bloom_row_group = row_group;
+    reader->bloom_column = column;
+    reader->bloom_bitset_offset = header_reader.pos;
+    reader->bloom_num_bytes = (size_t)bitset_bytes;
+
+    *bitset = buf + header_reader.pos;
+    *num_bytes = (size_t)bitset_bytes;
+    return 0;
+}
+
+int parquet_file_reader_bloom_filter_check(ParquetFileReader* reader, int row_group, int column,
+                                           const void* value, size_t len) {
+    if (!reader || !reader->metadata || (!value && len > 0)) return -1;
+    if (row_group < 0 || row_group >= reader->metadata->num_row_groups) return -1;
+    if (column < 0 || column >= reader->metadata->row_groups[row_group].num_columns) return -1;
+
+    const uint8_t* bitset;
+    size_t num_bytes;
+    if (load_bloom_filter(reader, row_group, column, &bitset, &num_bytes) != 0) return -1;
+
+    return parquet_bloom_check(bitset, num_bytes, parquet_xxhash64(value, len, 0)) ? 1 : 0;
+}
+
+// Compare a PLAIN-encoded value against a statistics bound using the column's
+// sort order. Returns 0 and sets *cmp on success, -1 if they are not comparable.
+static int compare_plain_value(ParquetType type, const void* a, size_t a_len,
+                               const uint8_t* b, size_t b_len, int* cmp) {
+    switch (type) {
+        case PARQUET_TYPE_INT32: {
+            int32_t x, y;
+            if (a_len != sizeof(x) || b_len != sizeof(y)) return -1;
+            memcpy(&x, a, sizeof(x));
+            memcpy(&y, b, sizeof(y));
+            *cmp = x < y ? -1 : (x > y ? 1 : 0);
+            return 0;
+        }
+        case PARQUET_TYPE_INT64: {
+            int64_t x, y;
+            if (a_len != sizeof(x) || b_len != sizeof(y)) return -1;
+            memcpy(&x, a, sizeof(x));
+            memcpy(&y, b, sizeof(y));
+            *cmp = x < y ? -1 : (x > y ? 1 : 0);
+            return 0;
+        }
+        case PARQUET_TYPE_FLOAT: {
+            float x, y;
+            if (a_len != sizeof(x) || b_len != sizeof(y)) return -1;
+            memcpy(&x, a, sizeof(x));
+            memcpy(&y, b, sizeof(y));
+            if (x != x || y != y) return -1;
+            *cmp = x < y ? -1 : (x > y ? 1 : 0);
+            return 0;
+        }
+        case PARQUET_TYPE_DOUBLE: {
+            double x, y;
+            if (a_len != sizeof(x) || b_len != sizeof(y)) return -1;
+            memcpy(&x, a, sizeof(x));
+            memcpy(&y, b, sizeof(y));
+            if (x != x || y != y) return -1;
+            *cmp = x < y ? -1 : (x > y ? 1 : 0);
+            return 0;
+        }
+        case PARQUET_TYPE_BYTE_ARRAY: {
+            size_t n = a_len < b_len ? a_len : b_len;
+            int c = n > 0 ? memcmp(a, b, n) : 0;
+            *cmp = c != 0 ? c : (a_len < b_len ? -1 : (a_len > b_len ? 1 : 0));
+            return 0;
+        }
+        default:
+            return -1;
+    }
+}
+
+static int find_column_index(const ParquetRowGroupMeta* rg, const char* column_name) {
+    for (int i = 0; i < rg->num_columns; i++) {
+        if (rg->columns[i].path_in_schema && strcmp(rg->columns[i].path_in_schema, column_name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool parquet_file_reader_row_group_might_contain(ParquetFileReader* reader, int row_group,
+                                                 const char* column_name,
+                                                 const void* value, size_t len) {
+    if (!reader || !reader->metadata || !column_name) return true;
+    if (row_group < 0 || row_group >= reader->metadata->num_row_groups) return true;
+
+    const ParquetRowGroupMeta* rg = &reader->metadata->row_groups[row_group];
+    int column = find_column_index(rg, column_name);
+    if (column < 0) return true;
+    const ParquetColumnChunkMeta* meta = &rg->columns[column];
+
+    // Cheapest first: statistics are already in memory
+    if (meta->has_statistics) {
+        if (meta->null_count >= 0 && meta->num_values > 0 && meta->null_count == meta->num_values) {
+            return false;  // All nulls never equal a value
+        }
+        if (meta->has_min_max) {
+            int cmp;
+            if (compare_plain_value(meta->type, value, len, meta->min_value, meta->min_value_len, &cmp) == 0 && cmp < 0) {
+                return false;
+            }
+            if (compare_plain_value(meta->type, value, len, meta->max_value, meta->max_value_len, &cmp) == 0 && cmp > 0) {
+                return false;
+            }
+        }
+    }
+
+    return parquet_file_reader_bloom_filter_check(reader, row_group, column, value, len) != 0;
+}
+
+bool parquet_file_reader_might_contain(ParquetFileReader* reader, const char* column_name,
+                                       const void* value, size_t len) {
+    if (!reader || !reader->metadata) return true;
+
+    for (int i = 0; i < reader->metadata->num_row_groups; i++) {
+        if (parquet_file_reader_row_group_might_contain(reader, i, column_name, value, len)) {
+            return true;
+        }
+    }
+    return false;
 }
@@ -80,6 +80,20 @@ typedef struct {
     int num_encodings;
     ParquetType type;
     char* path_in_schema;
+
+    // Statistics (min/max are PLAIN-encoded; absent values are -1 / false)
+    bool has_statistics;
+    int64_t null_count;
+    int64_t distinct_count;
+    bool has_min_max;
+    uint8_t* min_value;
+    size_t min_value_len;
+    uint8_t* max_value;
+    size_t max_value_len;
+
+    // Split-block Bloom filter location (offset 0 = none)
+    int64_t bloom_filter_offset;
+    int32_t bloom_filter_length;
 } ParquetColumnChunkMeta;
 
 typedef struct {
@@ -219,6 +233,22 @@ typedef struct {
 
     uint8_t* decompress_buffer;
     size_t decompress_buffer_capacity;
+
+    // Reusable ZSTD decompression state (dictionary is optional)
+    struct ZSTD_DCtx_s* zstd_dctx;
+    struct ZSTD_DDict_s* zstd_ddict;
+
+    // Last Bloom filter loaded (header + bitset), reused across probes
+    uint8_t* bloom_buffer;
+    size_t bloom_buffer_capacity;
+    bool bloom_cached;
+    int bloom_row_group;
+    int bloom_column;
+    size_t bloom_bitset_offset;
+    size_t bloom_num_bytes;
+
+    // Arrow layout produced for byte array columns
+    ParquetBytesLayout bytes_layout;
 } ParquetFileReader;
 
 // Open a Parquet file for reading
@@ -249,6 +279,37 @@ struct ArrowArrayStream* parquet_file_reader_read_all(ParquetFileReader* reader)
 // Close and free the reader
 void parquet_file_reader_close(ParquetFileReader* reader);
 
+// Set the ZSTD dictionary used to decompress pages written in dictionary mode.
+// The dictionary is copied; pass NULL to clear. Returns 0 on success.
+int parquet_file_reader_set_zstd_dictionary(ParquetFileReader* reader, const void* dict, size_t dict_size);
+
+// Choose the Arrow layout of byte array columns: "u"/"z" with int32 offsets
+// (the default), "U"/"Z" with int64 offsets for columns over 2 GiB, or
+// "vu"/"vz" string views. Applies to streams read afterwards. Returns 0 on success.
+int parquet_file_reader_set_bytes_layout(ParquetFileReader* reader, ParquetBytesLayout layout);
+
+// ============================================================================
+// Point-Lookup Skipping
+// ============================================================================
+
+// Values are PLAIN-encoded: 8 bytes for INT64/DOUBLE, 4 for INT32/FLOAT and
+// the raw bytes (no length prefix) for BYTE_ARRAY.
+
+// Probe a column chunk's Bloom filter. Returns 1 if the value may be present,
+// 0 if it is definitely absent, -1 if the chunk has no filter or on error.
+int parquet_file_reader_bloom_filter_check(ParquetFileReader* reader, int row_group, int column,
+                                           const void* value, size_t len);
+
+// False only when min/max statistics or the Bloom filter prove that no row of
+// the row group has column == value; the data pages are never read.
+bool parquet_file_reader_row_group_might_contain(ParquetFileReader* reader, int row_group,
+                                                 const char* column_name,
+                                                 const void* value, size_t len);
+
+// Same check over every row group, for skipping whole files
+bool parquet_file_reader_might_contain(ParquetFileReader* reader, const char* column_name,
+                                       const void* value, size_t len);
+
 // ============================================================================
 // Internal Functions (exposed for testing)
 // ============================================================================
@@ -0,0 +1,355 @@
+// O_DIRECT is a GNU extension
+#define _GNU_SOURCE
+
+#include "parquet_sink.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/types.h>
+
+#define PARQUET_SINK_DEFAULT_BUFFER (4 * 1024 * 1024)
+#define PARQUET_SINK_MAX_QUEUE 64
+
+// ============================================================================
+// Sink State
+// ============================================================================
+
+typedef struct {
+    uint8_t* data;
+    size_t size;     // Bytes filled
+    int64_t offset;  // File offset of data[0]
+} SinkBuffer;
+
+struct ParquetSink {
+    int fd;
+    bool direct;  // Page cache bypass actually in effect
+    bool padded;  // An aligned write ran past the logical end of file
+    ParquetFsyncPolicy fsync_policy;
+    size_t buffer_size;
+
+    SinkBuffer* buffers;
+    int num_buffers;
+    SinkBuffer* current;  // Buffer being filled by the encoder
+    int64_t offset;       // Logical bytes appended
+
+    // Background writer (not started when queue_depth is 0)
+    bool threaded;
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;  // Signals queue and free-list changes
+    SinkBuffer** queue;   // Ring of full buffers waiting to be written
+    int queue_head;
+    int queue_count;
+    SinkBuffer** free_list;
+    int num_free;
+    bool stopping;
+    int error;  // First errno seen; sticky
+};
+
+void parquet_write_options_init(ParquetWriteOptions* options) {
+    if (!options) return;
+    options->buffer_size = PARQUET_SINK_DEFAULT_BUFFER;
+    options->queue_depth = 2;
+    options->direct_io = false;
+    options->fsync_policy = PARQUET_FSYNC_NONE;
+}
+
+// ============================================================================
+// Raw I/O
+// ============================================================================
+
+static int pwrite_all(int fd, const uint8_t* data, size_t size, int64_t offset) {
+    while (size > 0) {
+        ssize_t n = pwrite(fd, data, size, (off_t)offset);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return errno ? errno : EIO;
+        }
+        data += n;
+        size -= (size_t)n;
+        offset += n;
+    }
+    return 0;
+}
+
+static int sync_data(int fd) {
+#if defined(__APPLE__)
+    return fsync(fd) == 0 ? 0 : errno;
+#else
+    return fdatasync(fd) == 0 ? 0 : errno;
+#endif
+}
+
+// Write one buffer at its offset. Direct I/O needs aligned lengths, so the
+// tail is zero-padded and the file is truncated back on close.
+static int write_buffer(ParquetSink* sink, SinkBuffer* buf) {
+    size_t len = buf->size;
+    if (sink->direct && len % PARQUET_SINK_ALIGNMENT != 0) {
+        size_t padded = (len + PARQUET_SINK_ALIGNMENT - 1) & ~(size_t)(PARQUET_SINK_ALIGNMENT - 1);
+        memset(buf->data + len, 0, padded - len);
+        len = padded;
+        sink->padded = true;
+    }
+    return pwrite_all(sink->fd, buf->data, len, buf->offset);
+}
+
+// ============================================================================
+// Background Writer
+// ============================================================================
+
+static void* sink_thread_main(void* arg) {
+    ParquetSink* sink = (ParquetSink*)arg;
+
+    pthread_mutex_lock(&sink->mutex);
+    for (;;) {
+        while (sink->queue_count == 0 && !sink->stopping) {
+            pthread_cond_wait(&sink->cond, &sink->mutex);
+        }
+        if (sink->queue_count == 0) break;
+
+        SinkBuffer* buf = sink->queue[sink->queue_head];
+        sink->queue_head = (sink->queue_head + 1) % sink->num_buffers;
+        sink->queue_count--;
+
+        // Skip the I/O once an error is latched, but keep recycling buffers
+        int skip = sink->error;
+        pthread_mutex_unlock(&sink->mutex);
+        int err = skip ? 0 : write_buffer(sink, buf);
+        pthread_mutex_lock(&sink->mutex);
+
+        if (err && !sink->error) sink->error = err;
+        sink->free_list[sink->num_free++] = buf;
+        pthread_cond_broadcast(&sink->cond);
+    }
+    pthread_mutex_unlock(&sink->mutex);
+    return NULL;
+}
+
+// Hand the current buffer to the writer and start filling a fresh one
+static int submit_current(ParquetSink* sink) {
+    SinkBuffer* buf = sink->current;
+    int error;
+
+    if (!sink->threaded) {
+        int err = write_buffer(sink, buf);
+        if (err && !sink->error) sink->error = err;
+        error = sink->error;
+    } else {
+        pthread_mutex_lock(&sink->mutex);
+        int tail = (sink->queue_head + sink->queue_count) % sink->num_buffers;
+        sink->queue[tail] = buf;
+        sink->queue_count++;
+        pthread_cond_broadcast(&sink->cond);
+
+        while (sink->num_free == 0) {
+            pthread_cond_wait(&sink->cond, &sink->mutex);
+        }
+        buf = sink->free_list[--sink->num_free];
+        error = sink->error;
+        pthread_mutex_unlock(&sink->mutex);
+    }
+
+    buf->size = 0;
+    buf->offset = sink->offset;
+    sink->current = buf;
+    return error ? -1 : 0;
+}
+
+// Wait until every submitted buffer has been written
+static void drain(ParquetSink* sink) {
+    if (!sink->threaded) return;
+    pthread_mutex_lock(&sink->mutex);
+    while (sink->num_free < sink->num_buffers - 1) {
+        pthread_cond_wait(&sink->cond, &sink->mutex);
+    }
+    pthread_mutex_unlock(&sink->mutex);
+}
+
+static void stop_thread(ParquetSink* sink) {
+    if (!sink->threaded) return;
+    pthread_mutex_lock(&sink->mutex);
+    sink->stopping = true;
+    pthread_cond_broadcast(&sink->cond);
+    pthread_mutex_unlock(&sink->mutex);
+    pthread_join(sink->thread, NULL);
+    pthread_cond_destroy(&sink->cond);
+    pthread_mutex_destroy(&sink->mutex);
+    sink->threaded = false;
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+static int open_file(const char* path, bool direct_io, bool* direct) {
+    int flags = O_WRONLY | O_CREAT | O_TRUNC;
+    *direct = false;
+
+#if defined(O_DIRECT)
+    if (direct_io) {
+        int fd = open(path, flags | O_DIRECT, 0644);
+        if (fd >= 0) {
+            *direct = true;
+            return fd;
+        }
+        if (errno != EINVAL) return -1;  // Filesystem without O_DIRECT: fall back
+    }
+#endif
+
+    int fd = open(path, flags, 0644);
+#if defined(__APPLE__)
+    if (fd >= 0 && direct_io) fcntl(fd, F_NOCACHE, 1);
+#endif
+    return fd;
+}
+
+static void sink_free(ParquetSink* sink) {
+    for (int i = 0; i < sink->num_buffers; i++) {
+        free(sink->buffers[i].data);
+    }
+    free(sink->buffers);
+    free(sink->queue);
+    free(sink->free_list);
+    free(sink);
+}
+
+ParquetSink* parquet_sink_open(const char* path, const ParquetWriteOptions* options) {
+    if (!path) return NULL;
+
+    ParquetWriteOptions defaults;
+    parquet_write_options_init(&defaults);
+    if (!options) options = &defaults;
+
+    ParquetSink* sink = calloc(1, sizeof(ParquetSink));
+    if (!sink) return NULL;
+
+    size_t buffer_size = options->buffer_size ? options->buffer_size : PARQUET_SINK_DEFAULT_BUFFER;
+    sink->buffer_size = (buffer_size + PARQUET_SINK_ALIGNMENT - 1) & ~(size_t)(PARQUET_SINK_ALIGNMENT - 1);
+    sink->fsync_policy = options->fsync_policy;
+
+    int queue_depth = options->queue_depth;
+    if (queue_depth < 0) queue_depth = 0;
+    if (queue_depth > PARQUET_SINK_MAX_QUEUE) queue_depth = PARQUET_SINK_MAX_QUEUE;
+
+    // One buffer being filled plus queue_depth in flight
+    sink->num_buffers = queue_depth + 1;
+    sink->buffers = calloc(sink->num_buffers, sizeof(SinkBuffer));
+    sink->queue = calloc(sink->num_buffers, sizeof(SinkBuffer*));
+    sink->free_list = calloc(sink->num_buffers, sizeof(SinkBuffer*));
+    if (!sink->buffers || !sink->queue || !sink->free_list) {
+        sink_free(sink);
+        return NULL;
+    }
+    for (int i = 0; i < sink->num_buffers; i++) {
+        void* data = NULL;
+        if (posix_memalign(&data, PARQUET_SINK_ALIGNMENT, sink->buffer_size) != 0) {
+            sink_free(sink);
+            return NULL;
+        }
+        sink->buffers[i].data = data;
+    }
+
+    sink->fd = open_file(path, options->direct_io, &sink->direct);
+    if (sink->fd < 0) {
+        sink_free(sink);
+        return NULL;
+    }
+
+    sink->current = &sink->buffers[0];
+    for (int i = 1; i < sink->num_buffers; i++) {
+        sink->free_list[sink->num_free++] = &sink->buffers[i];
+    }
+
+    // Without a thread the sink still coalesces, it just writes inline
+    if (queue_depth > 0 && pthread_mutex_init(&sink->mutex, NULL) == 0) {
+        if (pthread_cond_init(&sink->cond, NULL) != 0) {
+            pthread_mutex_destroy(&sink->mutex);
+        } else if (pthread_create(&sink->thread, NULL, sink_thread_main, sink) != 0) {
+            pthread_cond_destroy(&sink->cond);
+            pthread_mutex_destroy(&sink->mutex);
+        } else {
+            sink->threaded = true;
+        }
+    }
+
+    return sink;
+}
+
+int parquet_sink_write(ParquetSink* sink, const void* data, size_t size) {
+    if (!sink) return -1;
+
+    const uint8_t* src = (const uint8_t*)data;
+    while (size > 0) {
+        SinkBuffer* buf = sink->current;
+        size_t room = sink->buffer_size - buf->size;
+        size_t n = size < room ? size : room;
+        memcpy(buf->data + buf->size, src, n);
+        buf->size += n;
+        sink->offset += (int64_t)n;
+        src += n;
+        size -= n;
+
+        if (buf->size == sink->buffer_size && submit_current(sink) != 0) return -1;
+    }
+    return 0;
+}
+
+int64_t parquet_sink_offset(const ParquetSink* sink) {
+    return sink ? sink->offset : 0;
+}
+
+int parquet_sink_sync(ParquetSink* sink) {
+    if (!sink) return -1;
+
+    // The partial buffer is written in place and kept; it is rewritten at
+    // the same offset once it fills, so later writes stay aligned.
+    drain(sink);
+    if (!sink->error && sink->current->size > 0) {
+        sink->error = write_buffer(sink, sink->current);
+    }
+    if (!sink->error) {
+        sink->error = sync_data(sink->fd);
+    }
+    return sink->error ? -1 : 0;
+}
+
+int parquet_sink_close(ParquetSink* sink) {
+    if (!sink) return -1;
+
+    if (sink->current->size > 0) {
+        submit_current(sink);
+    }
+    drain(sink);
+    stop_thread(sink);
+
+    if (!sink->error && sink->padded && ftruncate(sink->fd, (off_t)sink->offset) != 0) {
+        sink->error = errno;
+    }
+    if (!sink->error && sink->fsync_policy != PARQUET_FSYNC_NONE && fsync(sink->fd) != 0) {
+        sink->error = errno;
+    }
+    if (close(sink->fd) != 0 && !sink->error) {
+        sink->error = errno;
+    }
+
+    int result = sink->error ? -1 : 0;
+    sink_free(sink);
+    return result;
+}
+
+void parquet_sink_abort(ParquetSink* sink) {
+    if (!sink) return;
+
+    // Latch an error so queued buffers are recycled without being written
+    if (sink->threaded) {
+        pthread_mutex_lock(&sink->mutex);
+        sink->error = ECANCELED;
+        pthread_mutex_unlock(&sink->mutex);
+    }
+    stop_thread(sink);
+    close(sink->fd);
+    sink_free(sink);
+}
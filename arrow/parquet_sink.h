@@ -0,0 +1,65 @@
+#ifndef PARQUET_SINK_H
+#define PARQUET_SINK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Parquet Output Sink
+//
+// Coalesces the writer's small writes (magic, page headers, pages, footer)
+// into large aligned buffers and hands full buffers to a background thread,
+// so page encoding overlaps with disk I/O.
+// ============================================================================
+
+// Alignment of sink buffers and of every write issued to the file
+#define PARQUET_SINK_ALIGNMENT 4096
+
+typedef enum {
+    PARQUET_FSYNC_NONE = 0,       // Leave durability to the OS
+    PARQUET_FSYNC_ON_CLOSE = 1,   // fsync once after the footer
+    PARQUET_FSYNC_ROW_GROUP = 2   // fdatasync after every row group, fsync on close
+} ParquetFsyncPolicy;
+
+typedef struct {
+    size_t buffer_size;               // Coalescing buffer size (default 4 MiB)
+    int queue_depth;                  // Buffers in flight; 0 writes synchronously (default 2)
+    bool direct_io;                   // Bypass the page cache (O_DIRECT / F_NOCACHE)
+    ParquetFsyncPolicy fsync_policy;  // Default PARQUET_FSYNC_NONE
+} ParquetWriteOptions;
+
+typedef struct ParquetSink ParquetSink;
+
+// Fill in the default options
+void parquet_write_options_init(ParquetWriteOptions* options);
+
+// Create (truncate) the file at path. options may be NULL for the defaults.
+// direct_io silently falls back to buffered I/O where unsupported.
+ParquetSink* parquet_sink_open(const char* path, const ParquetWriteOptions* options);
+
+// Append bytes. Returns 0, or -1 if this or an earlier write failed.
+int parquet_sink_write(ParquetSink* sink, const void* data, size_t size);
+
+// Bytes appended so far (the logical file size)
+int64_t parquet_sink_offset(const ParquetSink* sink);
+
+// Write out everything appended so far and fdatasync it
+int parquet_sink_sync(ParquetSink* sink);
+
+// Flush, apply the fsync policy and close the file. Always frees the sink;
+// returns 0 if every write since open succeeded.
+int parquet_sink_close(ParquetSink* sink);
+
+// Discard buffered data, stop the background thread and close the file
+void parquet_sink_abort(ParquetSink* sink);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PARQUET_SINK_H
@@ -6,7 +6,9 @@
 #include <string.h>
 #include <stdio.h>
 #include <assert.h>
+#include <math.h>
 #include <zstd.h>
+#include <zdict.h>
 
 // ============================================================================
 // Thrift Compact Protocol Implementation
@@ -163,35 +165,84 @@ static int thrift_write_list_header(ThriftBuffer* buf, int16_t field_id, uint8_t
 // ============================================================================
 
 // Serialize SchemaElement
-static int serialize_schema_element(ThriftBuffer* buf, ParquetColumnDef* col, bool is_root, int32_t num_children) {
+static int serialize_schema_element(ThriftBuffer* buf, const ParquetSchemaNode* node, bool is_root) {
     int16_t last_field = 0;
 
     // Field 1: type (only for leaf nodes)
-    if (!is_root && col->type >= 0) {
-        if (thrift_write_i32(buf, 1, col->type, &last_field) != 0) return -1;
-    }
-
-    // Field 2: type_length (for fixed-length types)
-    if (col->type_length > 0) {
-        if (thrift_write_i32(buf, 2, col->type_length, &last_field) != 0) return -1;
+    if (!is_root && node->num_children == 0 && node->type >= 0) {
+        if (thrift_write_i32(buf, 1, node->type, &last_field) != 0) return -1;
     }
 
     // Field 3: repetition_type
     if (!is_root) {
-        if (thrift_write_i32(buf, 3, col->repetition, &last_field) != 0) return -1;
+        if (thrift_write_i32(buf, 3, node->repetition, &last_field) != 0) return -1;
     }
 
     // Field 4: name
-    if (thrift_write_string_field(buf, 4, col->name, &last_field) != 0) return -1;
+    if (thrift_write_string_field(buf, 4, node->name, &last_field) != 0) return -1;
 
     // Field 5: num_children (only for groups/root)
-    if (is_root && num_children > 0) {
-        if (thrift_write_i32(buf, 5, num_children, &last_field) != 0) return -1;
+    if (node->num_children > 0) {
+        if (thrift_write_i32(buf, 5, node->num_children, &last_field) != 0) return -1;
     }
 
     // Field 6: converted_type
-    if (!is_root && col->converted_type >= 0) {
-        if (thrift_write_i32(buf, 6, col->converted_type, &last_field) != 0) return -1;
+    if (!is_root && node->converted_type >= 0) {
+        if (thrift_write_i32(buf, 6, node->converted_type, &last_field) != 0) return -1;
+    }
+
+    return thrift_write_field_stop(buf);
+}
+
+// Serialize Statistics (min/max as PLAIN-encoded values)
+static int serialize_statistics(ThriftBuffer* buf, ParquetType type, const ParquetColumnStats* stats) {
+    int16_t last_field = 0;
+
+    // Field 3: null_count
+    if (thrift_write_i64(buf, 3, stats->null_count, &last_field) != 0) return -1;
+
+    // Field 4 (distinct_count) is exact by spec; the writer only has an
+    // estimate, so it is left out
+
+    if (stats->has_min_max) {
+        const void* max_value;
+        const void* min_value;
+        size_t max_len, min_len;
+        uint8_t bool_max, bool_min;
+
+        switch (type) {
+            case PARQUET_TYPE_INT64:
+                max_value = &stats->max_int64;
+                min_value = &stats->min_int64;
+                max_len = min_len = sizeof(int64_t);
+                break;
+            case PARQUET_TYPE_DOUBLE:
+                max_value = &stats->max_double;
+                min_value = &stats->min_double;
+                max_len = min_len = sizeof(double);
+                break;
+            case PARQUET_TYPE_BOOLEAN:
+                bool_max = (uint8_t)stats->max_int64;
+                bool_min = (uint8_t)stats->min_int64;
+                max_value = &bool_max;
+                min_value = &bool_min;
+                max_len = min_len = 1;
+                break;
+            case PARQUET_TYPE_BYTE_ARRAY:
+                max_value = stats->max_bytes;
+                min_value = stats->min_bytes;
+                max_len = stats->max_bytes_len;
+                min_len = stats->min_bytes_len;
+                break;
+            default:
+                return thrift_write_field_stop(buf);
+        }
+
+        // Field 5: max_value
+        if (thrift_write_binary_field(buf, 5, max_value, max_len, &last_field) != 0) return -1;
+
+        // Field 6: min_value
+        if (thrift_write_binary_field(buf, 6, min_value, min_len, &last_field) != 0) return -1;
     }
 
     return thrift_write_field_stop(buf);
@@ -211,8 +262,10 @@ static int serialize_column_metadata(ThriftBuffer* buf, ParquetColumnDef* col, P
     }
 
     // Field 3: path_in_schema (list<string>)
-    if (thrift_write_list_header(buf, 3, THRIFT_CT_BINARY, 1, &last_field) != 0) return -1;
-    if (thrift_buffer_write_string(buf, col->name) != 0) return -1;
+    if (thrift_write_list_header(buf, 3, THRIFT_CT_BINARY, col->path_length, &last_field) != 0) return -1;
+    for (int i = 0; i < col->path_length; i++) {
+        if (thrift_buffer_write_string(buf, col->path[i]) != 0) return -1;
+    }
 
     // Field 4: codec
     if (thrift_write_i32(buf, 4, codec, &last_field) != 0) return -1;
@@ -229,6 +282,18 @@ static int serialize_column_metadata(ThriftBuffer* buf, ParquetColumnDef* col, P
     // Field 9: data_page_offset
     if (thrift_write_i64(buf, 9, info->data_page_offset, &last_field) != 0) return -1;
 
+    // Field 12: statistics
+    if (info->has_stats) {
+        if (thrift_write_field_header(buf, 12, THRIFT_CT_STRUCT, &last_field) != 0) return -1;
+        if (serialize_statistics(buf, col->type, &info->stats) != 0) return -1;
+    }
+
+    // Field 14: bloom_filter_offset, Field 15: bloom_filter_length
+    if (info->bloom_filter_offset > 0) {
+        if (thrift_write_i64(buf, 14, info->bloom_filter_offset, &last_field) != 0) return -1;
+        if (thrift_write_i32(buf, 15, info->bloom_filter_length, &last_field) != 0) return -1;
+    }
+
     return thrift_write_field_stop(buf);
 }
 
@@ -273,17 +338,17 @@ static int serialize_file_metadata(ThriftBuffer* buf, ParquetFileWriter* writer)
     if (thrift_write_i32(buf, 1, PARQUET_VERSION, &last_field) != 0) return -1;
 
     // Field 2: schema (list<SchemaElement>)
-    // First element is root, then columns
-    int num_schema_elements = 1 + writer->num_columns;
+    // First element is root, then the schema tree in depth-first order
+    int num_schema_elements = 1 + writer->num_schema_nodes;
     if (thrift_write_list_header(buf, 2, THRIFT_CT_STRUCT, num_schema_elements, &last_field) != 0) return -1;
 
     // Root schema element
-    ParquetColumnDef root = { .name = "schema", .type = -1, .repetition = PARQUET_REPETITION_REQUIRED };
-    if (serialize_schema_element(buf, &root, true, writer->num_columns) != 0) return -1;
+    ParquetSchemaNode root = { .name = "schema", .type = -1, .converted_type = PARQUET_CONVERTED_NONE,
+                               .repetition = PARQUET_REPETITION_REQUIRED, .num_children = writer->num_fields };
+    if (serialize_schema_element(buf, &root, true) != 0) return -1;
 
-    // Column schema elements
-    for (int i = 0; i < writer->num_columns; i++) {
-        if (serialize_schema_element(buf, &writer->columns[i], false, 0) != 0) return -1;
+    for (int i = 0; i < writer->num_schema_nodes; i++) {
+        if (serialize_schema_element(buf, &writer->schema_nodes[i], false) != 0) return -1;
     }
 
     // Field 3: num_rows
@@ -299,6 +364,17 @@ static int serialize_file_metadata(ThriftBuffer* buf, ParquetFileWriter* writer)
         if (serialize_row_group(buf, &writer->row_groups[i], writer->columns, writer->compression) != 0) return -1;
     }
 
+    // Field 5: key_value_metadata (list<KeyValue>)
+    if (writer->zstd_dict_id != 0) {
+        char dict_id[16];
+        snprintf(dict_id, sizeof(dict_id), "%u", (unsigned)writer->zstd_dict_id);
+        if (thrift_write_list_header(buf, 5, THRIFT_CT_STRUCT, 1, &last_field) != 0) return -1;
+        int16_t kv_last_field = 0;
+        if (thrift_write_string_field(buf, 1, PARQUET_ZSTD_DICT_ID_KEY, &kv_last_field) != 0) return -1;
+        if (thrift_write_string_field(buf, 2, dict_id, &kv_last_field) != 0) return -1;
+        if (thrift_write_field_stop(buf) != 0) return -1;
+    }
+
     // Field 6: created_by
     if (writer->created_by) {
         if (thrift_write_string_field(buf, 6, writer->created_by, &last_field) != 0) return -1;
@@ -308,7 +384,7 @@ static int serialize_file_metadata(ThriftBuffer* buf, ParquetFileWriter* writer)
 }
 
 // Serialize DataPageHeader
-static int serialize_data_page_header(ThriftBuffer* buf, int32_t num_values, int32_t uncompressed_size, int32_t compressed_size, ParquetEncoding encoding) {
+static int serialize_data_page_header(ThriftBuffer* buf, int32_t num_values, ParquetEncoding encoding, ParquetType type, const ParquetColumnStats* stats) {
     int16_t last_field = 0;
 
     // Field 1: num_values
@@ -323,11 +399,17 @@ static int serialize_data_page_header(ThriftBuffer* buf, int32_t num_values, int
     // Field 4: repetition_level_encoding
     if (thrift_write_i32(buf, 4, PARQUET_ENCODING_RLE, &last_field) != 0) return -1;
 
+    // Field 5: statistics
+    if (stats) {
+        if (thrift_write_field_header(buf, 5, THRIFT_CT_STRUCT, &last_field) != 0) return -1;
+        if (serialize_statistics(buf, type, stats) != 0) return -1;
+    }
+
     return thrift_write_field_stop(buf);
 }
 
 // Serialize PageHeader
-static int serialize_page_header(ThriftBuffer* buf, ParquetPageType type, int32_t uncompressed_size, int32_t compressed_size, int32_t num_values, ParquetEncoding encoding) {
+static int serialize_page_header(ThriftBuffer* buf, ParquetPageType type, int32_t uncompressed_size, int32_t compressed_size, int32_t num_values, ParquetEncoding encoding, ParquetType value_type, const ParquetColumnStats* stats) {
     int16_t last_field = 0;
 
     // Field 1: type
@@ -342,7 +424,27 @@ static int serialize_page_header(ThriftBuffer* buf, ParquetPageType type, int32_
     // Field 5: data_page_header (for DATA pages)
     if (type == PARQUET_PAGE_DATA) {
         if (thrift_write_field_header(buf, 5, THRIFT_CT_STRUCT, &last_field) != 0) return -1;
-        if (serialize_data_page_header(buf, num_values, uncompressed_size, compressed_size, encoding) != 0) return -1;
+        if (serialize_data_page_header(buf, num_values, encoding, value_type, stats) != 0) return -1;
+    }
+
+    return thrift_write_field_stop(buf);
+}
+
+// Serialize BloomFilterHeader (split-block algorithm, XXH64, uncompressed)
+static int serialize_bloom_filter_header(ThriftBuffer* buf, int32_t num_bytes) {
+    int16_t last_field = 0;
+
+    // Field 1: numBytes
+    if (thrift_write_i32(buf, 1, num_bytes, &last_field) != 0) return -1;
+
+    // Fields 2-4: algorithm, hash, compression. Each is a union whose only
+    // member (field 1) is an empty struct: BLOCK, XXHASH, UNCOMPRESSED.
+    for (int16_t field_id = 2; field_id <= 4; field_id++) {
+        int16_t union_last_field = 0;
+        if (thrift_write_field_header(buf, field_id, THRIFT_CT_STRUCT, &last_field) != 0) return -1;
+        if (thrift_write_field_header(buf, 1, THRIFT_CT_STRUCT, &union_last_field) != 0) return -1;
+        if (thrift_write_field_stop(buf) != 0) return -1;
+        if (thrift_write_field_stop(buf) != 0) return -1;
     }
 
     return thrift_write_field_stop(buf);
@@ -353,11 +455,21 @@ static int serialize_page_header(ThriftBuffer* buf, ParquetPageType type, int32_
 // ============================================================================
 
 ParquetFileWriter* parquet_file_writer_create(const char* path) {
+    return parquet_file_writer_create_with_options(path, NULL);
+}
+
+ParquetFileWriter* parquet_file_writer_create_with_options(const char* path, const ParquetWriteOptions* options) {
     ParquetFileWriter* writer = calloc(1, sizeof(ParquetFileWriter));
     if (!writer) return NULL;
 
-    writer->file = fopen(path, "wb");
-    if (!writer->file) {
+    if (options) {
+        writer->write_options = *options;
+    } else {
+        parquet_write_options_init(&writer->write_options);
+    }
+
+    writer->sink = parquet_sink_open(path, &writer->write_options);
+    if (!writer->sink) {
         free(writer);
         return NULL;
     }
@@ -365,13 +477,14 @@ ParquetFileWriter* parquet_file_writer_create(const char* path) {
     writer->file_path = strdup(path);
     writer->compression = PARQUET_CODEC_UNCOMPRESSED;
     writer->row_group_size = 128 * 1024 * 1024;  // 128 MB default
-    writer->write_statistics = false;
+    writer->write_statistics = true;
+    writer->compression_level = 3;
     writer->created_by = strdup("arrow-lean pure-c-parquet-1.0.0");
     writer->row_groups_capacity = 8;
     writer->row_groups = calloc(writer->row_groups_capacity, sizeof(ParquetRowGroupInfo));
 
-    // Write magic bytes
-    fwrite(PARQUET_MAGIC, 1, PARQUET_MAGIC_SIZE, writer->file);
+    // Write magic bytes (buffered; cannot fail before the first flush)
+    parquet_sink_write(writer->sink, PARQUET_MAGIC, PARQUET_MAGIC_SIZE);
     writer->current_offset = PARQUET_MAGIC_SIZE;
 
     return writer;
@@ -383,37 +496,155 @@ void parquet_file_writer_set_compression(ParquetFileWriter* writer, ParquetCompr
     }
 }
 
+void parquet_file_writer_set_compression_level(ParquetFileWriter* writer, int level) {
+    if (writer) {
+        writer->compression_level = level;
+    }
+}
+
+void parquet_file_writer_set_write_statistics(ParquetFileWriter* writer, bool enabled) {
+    if (writer) {
+        writer->write_statistics = enabled;
+    }
+}
+
 void parquet_file_writer_set_row_group_size(ParquetFileWriter* writer, int64_t size) {
     if (writer && size > 0) {
         writer->row_group_size = size;
     }
 }
 
-int parquet_file_writer_add_column(
-    ParquetFileWriter* writer,
-    const char* name,
-    ParquetType type,
-    ParquetConvertedType converted_type,
-    ParquetRepetition repetition
-) {
-    if (!writer || !name) return -1;
+// Append a node to the schema tree; returns its index or -1
+static int add_schema_node(ParquetFileWriter* writer, const char* name, ParquetType type,
+                           ParquetConvertedType converted_type, ParquetRepetition repetition,
+                           int32_t num_children) {
+    int new_count = writer->num_schema_nodes + 1;
+    ParquetSchemaNode* new_nodes = realloc(writer->schema_nodes, new_count * sizeof(ParquetSchemaNode));
+    if (!new_nodes) return -1;
+    writer->schema_nodes = new_nodes;
+
+    ParquetSchemaNode* node = &writer->schema_nodes[writer->num_schema_nodes];
+    node->name = strdup(name);
+    if (!node->name) return -1;
+    node->type = type;
+    node->converted_type = converted_type;
+    node->repetition = repetition;
+    node->num_children = num_children;
+
+    writer->num_schema_nodes = new_count;
+    return new_count - 1;
+}
 
+// Path and levels accumulated while walking a (possibly nested) Arrow field
+typedef struct {
+    const char* path[2 * PARQUET_MAX_NESTING];
+    int path_length;
+    ParquetShredStep steps[PARQUET_MAX_NESTING];
+    int num_steps;
+    int16_t def_level;
+    int16_t rep_level;
+    int top_level_index;
+} SchemaWalk;
+
+// Append a leaf column for the end of a schema walk
+static int add_leaf_column(ParquetFileWriter* writer, const SchemaWalk* walk, ParquetType type,
+                           ParquetConvertedType converted_type, ParquetRepetition repetition) {
     int new_count = writer->num_columns + 1;
     ParquetColumnDef* new_cols = realloc(writer->columns, new_count * sizeof(ParquetColumnDef));
     if (!new_cols) return -1;
 
     writer->columns = new_cols;
     ParquetColumnDef* col = &writer->columns[writer->num_columns];
-    col->name = strdup(name);
+    memset(col, 0, sizeof(*col));
+    col->name = strdup(walk->path[walk->path_length - 1]);
     col->type = type;
     col->converted_type = converted_type;
     col->repetition = repetition;
     col->type_length = 0;
+    col->bloom_filter_fpp = 0.0;
+    col->top_level_index = walk->top_level_index;
+    col->max_def_level = walk->def_level;
+    col->max_rep_level = walk->rep_level;
+
+    col->path = calloc(walk->path_length, sizeof(char*));
+    col->steps = malloc(walk->num_steps * sizeof(ParquetShredStep));
+    if (!col->name || !col->path || !col->steps) {
+        free(col->name);
+        free(col->path);
+        free(col->steps);
+        return -1;
+    }
+    for (int i = 0; i < walk->path_length; i++) {
+        col->path[i] = strdup(walk->path[i]);
+    }
+    col->path_length = walk->path_length;
+    memcpy(col->steps, walk->steps, walk->num_steps * sizeof(ParquetShredStep));
+    col->num_steps = walk->num_steps;
+
+    // Bloom filters are requested by leaf name (the last path element)
+    for (int i = 0; i < writer->num_bloom_columns; i++) {
+        if (strcmp(writer->bloom_columns[i], col->name) == 0) {
+            col->bloom_filter_fpp = writer->bloom_fpps[i];
+        }
+    }
 
     writer->num_columns = new_count;
     return 0;
 }
 
+int parquet_file_writer_add_column(
+    ParquetFileWriter* writer,
+    const char* name,
+    ParquetType type,
+    ParquetConvertedType converted_type,
+    ParquetRepetition repetition
+) {
+    if (!writer || !name) return -1;
+
+    if (add_schema_node(writer, name, type, converted_type, repetition, 0) < 0) return -1;
+
+    SchemaWalk walk;
+    memset(&walk, 0, sizeof(walk));
+    walk.path[0] = name;
+    walk.path_length = 1;
+    walk.steps[0].kind = PARQUET_SHRED_LEAF;
+    walk.steps[0].nullable = repetition == PARQUET_REPETITION_OPTIONAL;
+    walk.num_steps = 1;
+    walk.def_level = walk.steps[0].nullable ? 1 : 0;
+    walk.top_level_index = writer->num_fields;
+
+    if (add_leaf_column(writer, &walk, type, converted_type, repetition) != 0) return -1;
+    writer->num_fields++;
+    return 0;
+}
+
+int parquet_file_writer_enable_bloom_filter(ParquetFileWriter* writer, const char* column_name, double fpp) {
+    if (!writer || !column_name || !(fpp > 0.0 && fpp < 1.0)) return -1;
+
+    int new_count = writer->num_bloom_columns + 1;
+    char** new_names = realloc(writer->bloom_columns, new_count * sizeof(char*));
+    if (!new_names) return -1;
+    writer->bloom_columns = new_names;
+
+    double* new_fpps = realloc(writer->bloom_fpps, new_count * sizeof(double));
+    if (!new_fpps) return -1;
+    writer->bloom_fpps = new_fpps;
+
+    char* name = strdup(column_name);
+    if (!name) return -1;
+    writer->bloom_columns[writer->num_bloom_columns] = name;
+    writer->bloom_fpps[writer->num_bloom_columns] = fpp;
+    writer->num_bloom_columns = new_count;
+
+    // Apply to columns that already exist
+    for (int i = 0; i < writer->num_columns; i++) {
+        if (strcmp(writer->columns[i].name, column_name) == 0) {
+            writer->columns[i].bloom_filter_fpp = fpp;
+        }
+    }
+    return 0;
+}
+
 // Convert Arrow format string to Parquet types
 static int arrow_format_to_parquet(const char* format, ParquetType* type, ParquetConvertedType* converted) {
     if (!format) return -1;
@@ -451,6 +682,11 @@ static int arrow_format_to_parquet(const char* format, ParquetType* type, Parque
         case 'Z':  // large binary
             *type = PARQUET_TYPE_BYTE_ARRAY;
             break;
+        case 'v':  // string / binary view
+            if (format[1] != 'u' && format[1] != 'z') return -1;
+            *type = PARQUET_TYPE_BYTE_ARRAY;
+            if (format[1] == 'u') *converted = PARQUET_CONVERTED_UTF8;
+            break;
         case 't':  // timestamp
             *type = PARQUET_TYPE_INT64;
             if (strncmp(format, "tsu", 3) == 0) {
@@ -469,6 +705,67 @@ static int arrow_format_to_parquet(const char* format, ParquetType* type, Parque
     return 0;
 }
 
+// Add an Arrow field to the schema tree, recursing into struct and list types.
+// Lists use the standard three-level layout: <name> (LIST) / repeated list / element.
+static int add_arrow_field(ParquetFileWriter* writer, const struct ArrowSchema* field, const char* name, SchemaWalk walk) {
+    if (!field->format) return -1;
+    if (walk.num_steps >= PARQUET_MAX_NESTING || walk.path_length + 2 > 2 * PARQUET_MAX_NESTING) return -1;
+
+    bool nullable = (field->flags & ARROW_FLAG_NULLABLE) != 0;
+    ParquetRepetition rep = nullable ? PARQUET_REPETITION_OPTIONAL : PARQUET_REPETITION_REQUIRED;
+
+    walk.path[walk.path_length++] = name;
+    if (nullable) walk.def_level++;
+
+    ParquetShredStep* step = &walk.steps[walk.num_steps++];
+    step->nullable = nullable;
+    step->child_index = 0;
+    step->rep_level = 0;
+
+    if (strcmp(field->format, "+s") == 0) {
+        // Parquet does not allow empty groups
+        if (field->n_children <= 0) return -1;
+        if (add_schema_node(writer, name, -1, PARQUET_CONVERTED_NONE, rep, (int32_t)field->n_children) < 0) return -1;
+
+        step->kind = PARQUET_SHRED_STRUCT;
+        for (int64_t i = 0; i < field->n_children; i++) {
+            const struct ArrowSchema* child = field->children[i];
+            if (!child) return -1;
+            walk.steps[walk.num_steps - 1].child_index = (int32_t)i;
+            if (add_arrow_field(writer, child, child->name ? child->name : "", walk) != 0) return -1;
+        }
+        return 0;
+    }
+
+    if (strcmp(field->format, "+l") == 0) {
+        if (field->n_children != 1 || !field->children[0]) return -1;
+        if (add_schema_node(writer, name, -1, PARQUET_CONVERTED_LIST, rep, 1) < 0) return -1;
+        if (add_schema_node(writer, "list", -1, PARQUET_CONVERTED_NONE, PARQUET_REPETITION_REPEATED, 1) < 0) return -1;
+
+        walk.path[walk.path_length++] = "list";
+        walk.def_level++;
+        walk.rep_level++;
+        step->kind = PARQUET_SHRED_LIST;
+        step->rep_level = walk.rep_level;
+        return add_arrow_field(writer, field->children[0], "element", walk);
+    }
+
+    ParquetType type;
+    ParquetConvertedType converted;
+    if (arrow_format_to_parquet(field->format, &type, &converted) != 0) return -1;
+    if (add_schema_node(writer, name, type, converted, rep, 0) < 0) return -1;
+
+    step->kind = PARQUET_SHRED_LEAF;
+    if (add_leaf_column(writer, &walk, type, converted, rep) != 0) return -1;
+    ParquetColumnDef* col = &writer->columns[writer->num_columns - 1];
+    if (field->format[0] == 'U' || field->format[0] == 'Z') {
+        col->bytes_layout = PARQUET_BYTES_OFFSETS64;
+    } else if (field->format[0] == 'v') {
+        col->bytes_layout = PARQUET_BYTES_VIEW;
+    }
+    return 0;
+}
+
 int parquet_file_writer_set_schema_from_arrow(ParquetFileWriter* writer, struct ArrowSchema* schema) {
     if (!writer || !schema) return -1;
 
@@ -477,40 +774,36 @@ int parquet_file_writer_set_schema_from_arrow(ParquetFileWriter* writer, struct
 
     for (int64_t i = 0; i < schema->n_children; i++) {
         struct ArrowSchema* child = schema->children[i];
-        if (!child || !child->format || !child->name) continue;
-
-        ParquetType type;
-        ParquetConvertedType converted;
-        if (arrow_format_to_parquet(child->format, &type, &converted) != 0) {
-            return -1;
-        }
+        if (!child || !child->format || !child->name) return -1;
 
-        ParquetRepetition rep = (child->flags & ARROW_FLAG_NULLABLE)
-            ? PARQUET_REPETITION_OPTIONAL
-            : PARQUET_REPETITION_REQUIRED;
+        SchemaWalk walk;
+        memset(&walk, 0, sizeof(walk));
+        walk.top_level_index = (int)i;
 
-        if (parquet_file_writer_add_column(writer, child->name, type, converted, rep) != 0) {
+        if (add_arrow_field(writer, child, child->name, walk) != 0) {
             return -1;
         }
+        writer->num_fields++;
     }
 
     return 0;
 }
 
-// Write RLE-encoded definition levels
-static int write_definition_levels(ThriftBuffer* buf, int num_values, const uint8_t* validity, int64_t null_count) {
-    // Definition level: 0 = null, 1 = not null
-    // For OPTIONAL columns, we need definition levels
-
-    // RLE encoding: bit-width, then RLE/bit-packed data
-    // Bit width for max definition level 1 is 1
+// Patch the 4-byte length prefix that precedes RLE levels in a v1 data page
+static void finish_level_length(ThriftBuffer* buf, size_t length_pos) {
+    uint32_t length = (uint32_t)(buf->size - length_pos - sizeof(uint32_t));
+    memcpy(buf->data + length_pos, &length, sizeof(uint32_t));
+}
 
-    if (null_count == 0) {
-        // All values are defined (level 1)
-        // Write as RLE run
-        int bit_width = 1;
-        if (thrift_buffer_write_byte(buf, bit_width) != 0) return -1;
+// Write RLE-encoded definition levels for a flat OPTIONAL column
+static int write_definition_levels(ThriftBuffer* buf, int num_values, const uint8_t* validity, int64_t null_count) {
+    // Definition level: 0 = null, 1 = not null, bit width 1
+    size_t length_pos = buf->size;
+    uint32_t placeholder = 0;
+    if (thrift_buffer_write_bytes(buf, &placeholder, sizeof(placeholder)) != 0) return -1;
 
+    if (null_count == 0 || !validity) {
+        // All values are defined: one RLE run of 1s
         // RLE header: (count << 1) | 0
         int rle_header = (num_values << 1);
         if (thrift_buffer_write_varint(buf, rle_header) != 0) return -1;
@@ -518,166 +811,788 @@ static int write_definition_levels(ThriftBuffer* buf, int num_values, const uint
         // Value: 1 (defined)
         if (thrift_buffer_write_byte(buf, 1) != 0) return -1;
     } else {
-        // Mix of null and non-null
-        // Write as bit-packed
-        int bit_width = 1;
-        if (thrift_buffer_write_byte(buf, bit_width) != 0) return -1;
-
-        // Bit-packed header: ((count / 8) << 1) | 1
+        // Mix of null and non-null: the validity bitmap is already the
+        // bit-packed form. Header: (groups of 8 << 1) | 1
         int num_groups = (num_values + 7) / 8;
         int bp_header = (num_groups << 1) | 1;
         if (thrift_buffer_write_varint(buf, bp_header) != 0) return -1;
 
-        // Copy validity bitmap directly (it's already bit-packed)
         int bitmap_bytes = (num_values + 7) / 8;
         if (thrift_buffer_write_bytes(buf, validity, bitmap_bytes) != 0) return -1;
     }
 
+    finish_level_length(buf, length_pos);
+    return 0;
+}
+
+static int level_bit_width(int max_level) {
+    int width = 0;
+    while ((1 << width) <= max_level) width++;
+    return width;
+}
+
+static size_t level_run_length(const uint8_t* levels, size_t pos, size_t count) {
+    size_t end = pos + 1;
+    while (end < count && levels[end] == levels[pos]) end++;
+    return end - pos;
+}
+
+// Write repetition or definition levels with the RLE/bit-packed hybrid
+// encoding: runs of 8+ equal levels become RLE runs, the rest is packed in
+// groups of 8.
+static int write_levels(ThriftBuffer* buf, const uint8_t* levels, size_t count, int max_level) {
+    int bit_width = level_bit_width(max_level);
+
+    size_t length_pos = buf->size;
+    uint32_t placeholder = 0;
+    if (thrift_buffer_write_bytes(buf, &placeholder, sizeof(placeholder)) != 0) return -1;
+
+    size_t i = 0;
+    while (i < count) {
+        size_t run = level_run_length(levels, i, count);
+        if (run >= 8) {
+            if (thrift_buffer_write_varint(buf, (uint64_t)run << 1) != 0) return -1;
+            if (thrift_buffer_write_byte(buf, levels[i]) != 0) return -1;
+            i += run;
+            continue;
+        }
+
+        // Literal groups until a long run starts (63 groups keeps the header one byte)
+        size_t start = i;
+        size_t groups = 0;
+        do {
+            i += 8;
+            groups++;
+        } while (i < count && groups < 63 && level_run_length(levels, i, count) < 8);
+
+        if (thrift_buffer_write_varint(buf, (groups << 1) | 1) != 0) return -1;
+        if (thrift_buffer_ensure_capacity(buf, groups * bit_width) != 0) return -1;
+
+        uint64_t bits = 0;
+        int num_bits = 0;
+        for (size_t k = start; k < start + groups * 8; k++) {
+            uint64_t value = k < count ? levels[k] : 0;  // Pad the last group with zeros
+            bits |= value << num_bits;
+            num_bits += bit_width;
+            while (num_bits >= 8) {
+                buf->data[buf->size++] = (uint8_t)bits;
+                bits >>= 8;
+                num_bits -= 8;
+            }
+        }
+
+        if (i > count) i = count;
+    }
+
+    finish_level_length(buf, length_pos);
+    return 0;
+}
+
+// ============================================================================
+// Nested Column Shredding (Dremel repetition/definition levels)
+// ============================================================================
+
+typedef struct {
+    ParquetFileWriter* writer;
+    const ParquetColumnDef* col;
+    const struct ArrowArray* leaf;  // Leaf array reached by the column's steps
+    size_t num_levels;
+    size_t num_values;
+} ShredContext;
+
+static int shred_reserve(ShredContext* ctx, size_t levels, size_t values) {
+    ParquetFileWriter* w = ctx->writer;
+
+    if (ctx->num_levels + levels > w->levels_capacity) {
+        size_t new_cap = w->levels_capacity ? w->levels_capacity : 1024;
+        while (new_cap < ctx->num_levels + levels) new_cap *= 2;
+        uint8_t* new_rep = realloc(w->rep_levels, new_cap);
+        if (!new_rep) return -1;
+        w->rep_levels = new_rep;
+        uint8_t* new_def = realloc(w->def_levels, new_cap);
+        if (!new_def) return -1;
+        w->def_levels = new_def;
+        w->levels_capacity = new_cap;
+    }
+
+    if (ctx->num_values + values > w->value_indices_capacity) {
+        size_t new_cap = w->value_indices_capacity ? w->value_indices_capacity : 1024;
+        while (new_cap < ctx->num_values + values) new_cap *= 2;
+        int64_t* new_indices = realloc(w->value_indices, new_cap * sizeof(int64_t));
+        if (!new_indices) return -1;
+        w->value_indices = new_indices;
+        w->value_indices_capacity = new_cap;
+    }
+    return 0;
+}
+
+static inline int shred_emit(ShredContext* ctx, uint8_t def, uint8_t rep) {
+    if (ctx->num_levels >= ctx->writer->levels_capacity && shred_reserve(ctx, 1, 0) != 0) return -1;
+    ctx->writer->def_levels[ctx->num_levels] = def;
+    ctx->writer->rep_levels[ctx->num_levels] = rep;
+    ctx->num_levels++;
+    return 0;
+}
+
+static inline bool array_is_valid(const struct ArrowArray* array, int64_t physical_index) {
+    const uint8_t* validity = (const uint8_t*)array->buffers[0];
+    if (!validity || array->null_count == 0) return true;
+    return (validity[physical_index >> 3] >> (physical_index & 7)) & 1;
+}
+
+// Shred one logical element of `array` at step `step` of the column's path
+static int shred_value(ShredContext* ctx, int step, const struct ArrowArray* array,
+                       int64_t index, uint8_t def, uint8_t rep) {
+    const ParquetShredStep* s = &ctx->col->steps[step];
+    int64_t physical = array->offset + index;
+
+    if (s->nullable) {
+        if (!array_is_valid(array, physical)) return shred_emit(ctx, def, rep);
+        def++;
+    }
+
+    switch (s->kind) {
+        case PARQUET_SHRED_LEAF:
+            if (shred_emit(ctx, def, rep) != 0) return -1;
+            if (ctx->num_values >= ctx->writer->value_indices_capacity && shred_reserve(ctx, 0, 1) != 0) return -1;
+            ctx->writer->value_indices[ctx->num_values++] = physical;
+            return 0;
+
+        case PARQUET_SHRED_STRUCT:
+            // Struct children are indexed by the parent's physical position
+            return shred_value(ctx, step + 1, array->children[s->child_index], physical, def, rep);
+
+        case PARQUET_SHRED_LIST: {
+            const int32_t* offsets = (const int32_t*)array->buffers[1];
+            int64_t start = offsets[physical];
+            int64_t end = offsets[physical + 1];
+            if (start == end) return shred_emit(ctx, def, rep);  // Empty list
+
+            const struct ArrowArray* child = array->children[0];
+            const ParquetShredStep* next = &ctx->col->steps[step + 1];
+            uint8_t elem_def = def + 1;
+
+            // Fast path: a list of non-null leaf values fills whole level
+            // blocks at once instead of recursing per element.
+            if (next->kind == PARQUET_SHRED_LEAF &&
+                (!next->nullable || child->null_count == 0 || !child->buffers[0])) {
+                size_t n = (size_t)(end - start);
+                if (shred_reserve(ctx, n, n) != 0) return -1;
+                uint8_t leaf_def = elem_def + (next->nullable ? 1 : 0);
+                memset(ctx->writer->def_levels + ctx->num_levels, leaf_def, n);
+                ctx->writer->rep_levels[ctx->num_levels] = rep;
+                memset(ctx->writer->rep_levels + ctx->num_levels + 1, (uint8_t)s->rep_level, n - 1);
+                int64_t* indices = ctx->writer->value_indices + ctx->num_values;
+                int64_t base = child->offset + start;
+                for (size_t k = 0; k < n; k++) {
+                    indices[k] = base + (int64_t)k;
+                }
+                ctx->num_levels += n;
+                ctx->num_values += n;
+                return 0;
+            }
+
+            for (int64_t j = start; j < end; j++) {
+                uint8_t elem_rep = j == start ? rep : (uint8_t)s->rep_level;
+                if (shred_value(ctx, step + 1, child, j, elem_def, elem_rep) != 0) return -1;
+            }
+            return 0;
+        }
+    }
+    return -1;
+}
+
+// Compute levels and leaf value positions for every row of a top-level array
+static int shred_column(ShredContext* ctx, const struct ArrowArray* array) {
+    // Locate the leaf array by following the steps
+    const struct ArrowArray* leaf = array;
+    for (int i = 0; i < ctx->col->num_steps - 1; i++) {
+        const ParquetShredStep* s = &ctx->col->steps[i];
+        int32_t child = s->kind == PARQUET_SHRED_STRUCT ? s->child_index : 0;
+        if (!leaf || child >= leaf->n_children) return -1;
+        leaf = leaf->children[child];
+    }
+    if (!leaf) return -1;
+    ctx->leaf = leaf;
+
+    if (shred_reserve(ctx, (size_t)array->length, 0) != 0) return -1;
+    for (int64_t i = 0; i < array->length; i++) {
+        if (shred_value(ctx, 0, array, i, 0, 0) != 0) return -1;
+    }
+    return 0;
+}
+
+// ============================================================================
+// Column Statistics
+// ============================================================================
+
+// HyperLogLog precision for distinct-count estimation (1024 registers, ~3% error)
+#define STATS_HLL_BITS 10
+#define STATS_HLL_REGISTERS (1 << STATS_HLL_BITS)
+
+// Running statistics, updated by the PLAIN encoders as they emit each value
+typedef struct {
+    bool has_min_max;
+    int64_t min_int64;
+    int64_t max_int64;
+    double min_double;
+    double max_double;
+    const uint8_t* min_bytes;  // Borrowed from the array until stats_finish
+    int32_t min_bytes_len;
+    const uint8_t* max_bytes;
+    int32_t max_bytes_len;
+    int64_t null_count;
+    int64_t value_count;
+    uint8_t hll[STATS_HLL_REGISTERS];
+} StatsAccumulator;
+
+static void stats_init(StatsAccumulator* acc) {
+    memset(acc, 0, sizeof(*acc));
+}
+
+// 64-bit finalizer (splitmix64) to spread value bits across the hash
+static inline uint64_t stats_mix64(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+static inline uint64_t stats_hash_bytes(const uint8_t* data, size_t len) {
+    uint64_t h = 0xcbf29ce484222325ULL;  // FNV-1a
+    for (size_t i = 0; i < len; i++) {
+        h ^= data[i];
+        h *= 0x100000001b3ULL;
+    }
+    return stats_mix64(h);
+}
+
+static inline void stats_hll_add(StatsAccumulator* acc, uint64_t hash) {
+    uint32_t index = (uint32_t)(hash >> (64 - STATS_HLL_BITS));
+    // Sentinel bit bounds the rank at 64 - STATS_HLL_BITS + 1
+    uint64_t rest = (hash << STATS_HLL_BITS) | (1ULL << (STATS_HLL_BITS - 1));
+    uint8_t rank = 1;
+    while (!(rest & 0x8000000000000000ULL)) {
+        rest <<= 1;
+        rank++;
+    }
+    if (rank > acc->hll[index]) acc->hll[index] = rank;
+}
+
+static int64_t stats_hll_estimate(const StatsAccumulator* acc) {
+    double m = (double)STATS_HLL_REGISTERS;
+    double sum = 0.0;
+    int zeros = 0;
+    for (int i = 0; i < STATS_HLL_REGISTERS; i++) {
+        sum += ldexp(1.0, -acc->hll[i]);
+        if (acc->hll[i] == 0) zeros++;
+    }
+
+    double estimate = (0.7213 / (1.0 + 1.079 / m)) * m * m / sum;
+    if (estimate <= 2.5 * m && zeros > 0) {
+        estimate = m * log(m / zeros);  // Linear counting for small cardinalities
+    }
+
+    int64_t result = (int64_t)(estimate + 0.5);
+    return result < acc->value_count ? result : acc->value_count;
+}
+
+static inline void stats_update_int64(StatsAccumulator* acc, int64_t value) {
+    if (!acc->has_min_max) {
+        acc->min_int64 = acc->max_int64 = value;
+        acc->has_min_max = true;
+    } else if (value < acc->min_int64) {
+        acc->min_int64 = value;
+    } else if (value > acc->max_int64) {
+        acc->max_int64 = value;
+    }
+    acc->value_count++;
+    stats_hll_add(acc, stats_mix64((uint64_t)value));
+}
+
+static inline void stats_update_double(StatsAccumulator* acc, double value) {
+    acc->value_count++;
+    if (value != value) return;  // NaN is excluded from min/max
+
+    if (!acc->has_min_max) {
+        acc->min_double = acc->max_double = value;
+        acc->has_min_max = true;
+    } else if (value < acc->min_double) {
+        acc->min_double = value;
+    } else if (value > acc->max_double) {
+        acc->max_double = value;
+    }
+
+    uint64_t bits;
+    double normalized = value == 0.0 ? 0.0 : value;  // -0.0 and +0.0 are one value
+    memcpy(&bits, &normalized, sizeof(bits));
+    stats_hll_add(acc, stats_mix64(bits));
+}
+
+static inline void stats_update_bool(StatsAccumulator* acc, uint8_t value) {
+    if (!acc->has_min_max) {
+        acc->min_int64 = acc->max_int64 = value;
+        acc->has_min_max = true;
+    } else if (value < acc->min_int64) {
+        acc->min_int64 = value;
+    } else if (value > acc->max_int64) {
+        acc->max_int64 = value;
+    }
+    acc->value_count++;
+}
+
+// Unsigned lexicographic order, as required for BYTE_ARRAY statistics
+static int stats_compare_bytes(const uint8_t* a, size_t a_len, const uint8_t* b, size_t b_len) {
+    size_t n = a_len < b_len ? a_len : b_len;
+    int cmp = n > 0 ? memcmp(a, b, n) : 0;
+    if (cmp != 0) return cmp;
+    return a_len < b_len ? -1 : (a_len > b_len ? 1 : 0);
+}
+
+static inline void stats_update_bytes(StatsAccumulator* acc, const uint8_t* value, int32_t len) {
+    if (!acc->has_min_max) {
+        acc->min_bytes = acc->max_bytes = value;
+        acc->min_bytes_len = acc->max_bytes_len = len;
+        acc->has_min_max = true;
+    } else if (stats_compare_bytes(value, len, acc->min_bytes, acc->min_bytes_len) < 0) {
+        acc->min_bytes = value;
+        acc->min_bytes_len = len;
+    } else if (stats_compare_bytes(value, len, acc->max_bytes, acc->max_bytes_len) > 0) {
+        acc->max_bytes = value;
+        acc->max_bytes_len = len;
+    }
+    acc->value_count++;
+    stats_hll_add(acc, stats_hash_bytes(value, len));
+}
+
+static uint8_t* stats_copy_bytes(const uint8_t* data, size_t len) {
+    uint8_t* copy = malloc(len > 0 ? len : 1);
+    if (copy && len > 0) memcpy(copy, data, len);
+    return copy;
+}
+
+// Move accumulated statistics into the column chunk (copies borrowed byte values)
+static int stats_finish(StatsAccumulator* acc, ParquetType type, ParquetColumnStats* out) {
+    memset(out, 0, sizeof(*out));
+    out->null_count = acc->null_count;
+    out->has_min_max = acc->has_min_max;
+
+    switch (type) {
+        case PARQUET_TYPE_INT64:
+            out->min_int64 = acc->min_int64;
+            out->max_int64 = acc->max_int64;
+            out->distinct_estimate = stats_hll_estimate(acc);
+            break;
+        case PARQUET_TYPE_DOUBLE:
+            // Zero bounds are widened so that both -0.0 and +0.0 fall inside
+            out->min_double = acc->min_double == 0.0 ? -0.0 : acc->min_double;
+            out->max_double = acc->max_double == 0.0 ? 0.0 : acc->max_double;
+            out->distinct_estimate = stats_hll_estimate(acc);
+            break;
+        case PARQUET_TYPE_BOOLEAN:
+            out->min_int64 = acc->min_int64;
+            out->max_int64 = acc->max_int64;
+            out->distinct_estimate = !acc->has_min_max ? 0 : (acc->min_int64 == acc->max_int64 ? 1 : 2);
+            break;
+        case PARQUET_TYPE_BYTE_ARRAY:
+            out->distinct_estimate = stats_hll_estimate(acc);
+            if (acc->has_min_max) {
+                out->min_bytes = stats_copy_bytes(acc->min_bytes, acc->min_bytes_len);
+                out->max_bytes = stats_copy_bytes(acc->max_bytes, acc->max_bytes_len);
+                if (!out->min_bytes || !out->max_bytes) return -1;
+                out->min_bytes_len = acc->min_bytes_len;
+                out->max_bytes_len = acc->max_bytes_len;
+            }
+            break;
+        default:
+            out->has_min_max = false;
+            out->distinct_estimate = -1;
+    }
+
     return 0;
 }
 
-// Write plain-encoded data for different types
-static int write_plain_int64_data(ThriftBuffer* buf, const int64_t* data, int num_values, const uint8_t* validity) {
-    for (int i = 0; i < num_values; i++) {
+static void column_stats_free(ParquetColumnStats* stats) {
+    free(stats->min_bytes);
+    free(stats->max_bytes);
+    stats->min_bytes = NULL;
+    stats->max_bytes = NULL;
+}
+
+// Hashes of the PLAIN-encoded values, collected for the column's Bloom filter
+typedef struct {
+    uint64_t* hashes;
+    size_t count;
+} BloomCollector;
+
+// Write plain-encoded data for different types. Values are taken at the
+// given array positions (nested columns) or 0..num_values-1 when indices is
+// NULL. Statistics and Bloom filter hashes are gathered in the same pass when
+// acc / bloom are non-NULL.
+static int write_plain_int64_data(ThriftBuffer* buf, const int64_t* data, int num_values, const uint8_t* validity, const int64_t* indices, StatsAccumulator* acc, BloomCollector* bloom) {
+    for (int k = 0; k < num_values; k++) {
+        int64_t i = indices ? indices[k] : k;
         // Skip nulls
         if (validity) {
-            int byte_idx = i / 8;
-            int bit_idx = i % 8;
-            if (!((validity[byte_idx] >> bit_idx) & 1)) continue;
+            int64_t byte_idx = i / 8;
+            int bit_idx = (int)(i % 8);
+            if (!((validity[byte_idx] >> bit_idx) & 1)) {
+                if (acc) acc->null_count++;
+                continue;
+            }
         }
         if (thrift_buffer_write_bytes(buf, &data[i], sizeof(int64_t)) != 0) return -1;
+        if (acc) stats_update_int64(acc, data[i]);
+        if (bloom) bloom->hashes[bloom->count++] = parquet_xxhash64(&data[i], sizeof(int64_t), 0);
     }
     return 0;
 }
 
-static int write_plain_double_data(ThriftBuffer* buf, const double* data, int num_values, const uint8_t* validity) {
-    for (int i = 0; i < num_values; i++) {
+static int write_plain_double_data(ThriftBuffer* buf, const double* data, int num_values, const uint8_t* validity, const int64_t* indices, StatsAccumulator* acc, BloomCollector* bloom) {
+    for (int k = 0; k < num_values; k++) {
+        int64_t i = indices ? indices[k] : k;
         if (validity) {
-            int byte_idx = i / 8;
-            int bit_idx = i % 8;
-            if (!((validity[byte_idx] >> bit_idx) & 1)) continue;
+            int64_t byte_idx = i / 8;
+            int bit_idx = (int)(i % 8);
+            if (!((validity[byte_idx] >> bit_idx) & 1)) {
+                if (acc) acc->null_count++;
+                continue;
+            }
         }
         if (thrift_buffer_write_bytes(buf, &data[i], sizeof(double)) != 0) return -1;
+        if (acc) stats_update_double(acc, data[i]);
+        if (bloom) bloom->hashes[bloom->count++] = parquet_xxhash64(&data[i], sizeof(double), 0);
     }
     return 0;
 }
 
-static int write_plain_bool_data(ThriftBuffer* buf, const uint8_t* data, int num_values, const uint8_t* validity) {
-    for (int i = 0; i < num_values; i++) {
+static int write_plain_bool_data(ThriftBuffer* buf, const uint8_t* data, int num_values, const uint8_t* validity, const int64_t* indices, StatsAccumulator* acc) {
+    for (int k = 0; k < num_values; k++) {
+        int64_t i = indices ? indices[k] : k;
         if (validity) {
-            int byte_idx = i / 8;
-            int bit_idx = i % 8;
-            if (!((validity[byte_idx] >> bit_idx) & 1)) continue;
+            int64_t byte_idx = i / 8;
+            int bit_idx = (int)(i % 8);
+            if (!((validity[byte_idx] >> bit_idx) & 1)) {
+                if (acc) acc->null_count++;
+                continue;
+            }
         }
-        int data_byte_idx = i / 8;
-        int data_bit_idx = i % 8;
+        int64_t data_byte_idx = i / 8;
+        int data_bit_idx = (int)(i % 8);
         uint8_t value = (data[data_byte_idx] >> data_bit_idx) & 1;
         if (thrift_buffer_write_byte(buf, value) != 0) return -1;
+        if (acc) stats_update_bool(acc, value);
     }
     return 0;
 }
 
-static int write_plain_string_data(ThriftBuffer* buf, const int32_t* offsets, const char* data, int num_values, const uint8_t* validity) {
-    for (int i = 0; i < num_values; i++) {
+// Locate byte array value i of a "u"/"z", "U"/"Z" or "vu"/"vz" array
+static const char* byte_array_value(const struct ArrowArray* array, ParquetBytesLayout layout,
+                                    int64_t i, int64_t* len) {
+    switch (layout) {
+        case PARQUET_BYTES_OFFSETS64: {
+            const int64_t* offsets = (const int64_t*)array->buffers[1];
+            *len = offsets[i + 1] - offsets[i];
+            return (const char*)array->buffers[2] + offsets[i];
+        }
+        case PARQUET_BYTES_VIEW: {
+            const uint8_t* view = (const uint8_t*)array->buffers[1] + i * 16;
+            int32_t view_len, buffer_index, offset;
+            memcpy(&view_len, view, 4);
+            *len = view_len;
+            if (view_len <= 12) return (const char*)view + 4;
+            memcpy(&buffer_index, view + 8, 4);
+            memcpy(&offset, view + 12, 4);
+            return (const char*)array->buffers[2 + buffer_index] + offset;
+        }
+        default: {
+            const int32_t* offsets = (const int32_t*)array->buffers[1];
+            *len = offsets[i + 1] - offsets[i];
+            return (const char*)array->buffers[2] + offsets[i];
+        }
+    }
+}
+
+static int write_plain_string_data(ThriftBuffer* buf, const struct ArrowArray* array, ParquetBytesLayout layout, int num_values, const uint8_t* validity, const int64_t* indices, StatsAccumulator* acc, BloomCollector* bloom) {
+    for (int k = 0; k < num_values; k++) {
+        int64_t i = indices ? indices[k] : k;
         if (validity) {
-            int byte_idx = i / 8;
-            int bit_idx = i % 8;
-            if (!((validity[byte_idx] >> bit_idx) & 1)) continue;
+            int64_t byte_idx = i / 8;
+            int bit_idx = (int)(i % 8);
+            if (!((validity[byte_idx] >> bit_idx) & 1)) {
+                if (acc) acc->null_count++;
+                continue;
+            }
         }
-        int32_t start = offsets[i];
-        int32_t end = offsets[i + 1];
-        int32_t len = end - start;
+        int64_t value_len;
+        const char* value = byte_array_value(array, layout, i, &value_len);
+        // BYTE_ARRAY lengths are 4-byte little-endian
+        if (value_len > INT32_MAX) return -1;
+        int32_t len = (int32_t)value_len;
 
-        // Write length as 4-byte little-endian
         if (thrift_buffer_write_bytes(buf, &len, sizeof(int32_t)) != 0) return -1;
         // Write string data
         if (len > 0) {
-            if (thrift_buffer_write_bytes(buf, data + start, len) != 0) return -1;
+            if (thrift_buffer_write_bytes(buf, value, len) != 0) return -1;
         }
+        if (acc) stats_update_bytes(acc, (const uint8_t*)value, len);
+        if (bloom) bloom->hashes[bloom->count++] = parquet_xxhash64(value, (size_t)len, 0);
     }
     return 0;
 }
 
-// Write a column chunk
-static int write_column_chunk(ParquetFileWriter* writer, struct ArrowArray* array, ParquetColumnDef* col, ParquetColumnChunkInfo* info) {
-    // Build the data page
-    ThriftBuffer* data_buf = thrift_buffer_create(4096);
-    if (!data_buf) return -1;
+// ============================================================================
+// Page Compression
+// ============================================================================
+
+// Get a scratch buffer, creating it on first use and clearing it otherwise
+static ThriftBuffer* writer_scratch(ThriftBuffer** slot, size_t initial_capacity) {
+    if (!*slot) {
+        *slot = thrift_buffer_create(initial_capacity);
+    } else {
+        (*slot)->size = 0;
+    }
+    return *slot;
+}
+
+// Record an uncompressed page as a dictionary training sample
+static void capture_sample(ParquetFileWriter* writer, const uint8_t* data, size_t size) {
+    if (writer->sample_limit == 0 || size == 0) return;
+    if (writer->sample_buffer && writer->sample_buffer->size + size > writer->sample_limit) return;
+
+    if (!writer->sample_buffer) {
+        writer->sample_buffer = thrift_buffer_create(size > 4096 ? size : 4096);
+        if (!writer->sample_buffer) return;
+    }
+    if (writer->num_samples >= writer->samples_capacity) {
+        size_t new_cap = writer->samples_capacity ? writer->samples_capacity * 2 : 64;
+        size_t* new_sizes = realloc(writer->sample_sizes, new_cap * sizeof(size_t));
+        if (!new_sizes) return;
+        writer->sample_sizes = new_sizes;
+        writer->samples_capacity = new_cap;
+    }
+    if (thrift_buffer_write_bytes(writer->sample_buffer, data, size) != 0) return;
+    writer->sample_sizes[writer->num_samples++] = size;
+}
+
+// Compress a page with the writer's reusable ZSTD context.
+// Returns 0 and sets *out/*out_size on success, -1 on failure.
+static int compress_page_zstd(ParquetFileWriter* writer, const uint8_t* src, size_t size,
+                              const uint8_t** out, size_t* out_size) {
+    if (!writer->zstd_cctx) {
+        writer->zstd_cctx = ZSTD_createCCtx();
+        if (!writer->zstd_cctx) return -1;
+    }
+
+    size_t bound = ZSTD_compressBound(size);
+    if (bound > writer->compress_buffer_capacity) {
+        uint8_t* new_buf = realloc(writer->compress_buffer, bound);
+        if (!new_buf) return -1;
+        writer->compress_buffer = new_buf;
+        writer->compress_buffer_capacity = bound;
+    }
+
+    size_t csize;
+    if (writer->zstd_cdict) {
+        csize = ZSTD_compress_usingCDict(writer->zstd_cctx, writer->compress_buffer, bound,
+                                         src, size, writer->zstd_cdict);
+    } else {
+        csize = ZSTD_compressCCtx(writer->zstd_cctx, writer->compress_buffer, bound,
+                                  src, size, writer->compression_level);
+    }
+    if (ZSTD_isError(csize)) return -1;
+
+    *out = writer->compress_buffer;
+    *out_size = csize;
+    return 0;
+}
+
+// Size, fill and write a column chunk's Bloom filter after its data page
+static int write_bloom_filter(ParquetFileWriter* writer, BloomCollector* bloom, ParquetColumnChunkInfo* info, double fpp) {
+    // Size from the distinct estimate when statistics are on, else the value count
+    int64_t ndv = info->has_stats ? info->stats.distinct_estimate : (int64_t)bloom->count;
+    size_t num_bytes = parquet_bloom_optimal_bytes(ndv, fpp);
+
+    if (num_bytes > writer->bloom_bitset_capacity) {
+        uint8_t* new_bitset = realloc(writer->bloom_bitset, num_bytes);
+        if (!new_bitset) return -1;
+        writer->bloom_bitset = new_bitset;
+        writer->bloom_bitset_capacity = num_bytes;
+    }
+    memset(writer->bloom_bitset, 0, num_bytes);
+
+    for (size_t i = 0; i < bloom->count; i++) {
+        parquet_bloom_insert(writer->bloom_bitset, num_bytes, bloom->hashes[i]);
+    }
+
+    ThriftBuffer* header_buf = writer_scratch(&writer->header_buffer, 256);
+    if (!header_buf) return -1;
+    if (serialize_bloom_filter_header(header_buf, (int32_t)num_bytes) != 0) return -1;
+
+    info->bloom_filter_offset = writer->current_offset;
+    info->bloom_filter_length = (int32_t)(header_buf->size + num_bytes);
 
+    if (parquet_sink_write(writer->sink, header_buf->data, header_buf->size) != 0) return -1;
+    if (parquet_sink_write(writer->sink, writer->bloom_bitset, num_bytes) != 0) return -1;
+    writer->current_offset += header_buf->size + num_bytes;
+
+    return 0;
+}
+
+// Start collecting Bloom filter hashes for up to max_values values. Sets
+// *out to storage, or to NULL if the column has no Bloom filter.
+// Returns -1 if the hash buffer cannot be allocated.
+static int bloom_begin(ParquetFileWriter* writer, const ParquetColumnDef* col,
+                       size_t max_values, BloomCollector* storage, BloomCollector** out) {
+    *out = NULL;
+    // Bloom filters apply to hashable physical types only
+    if (!(col->bloom_filter_fpp > 0.0) || col->type == PARQUET_TYPE_BOOLEAN) return 0;
+
+    if (max_values > writer->bloom_hashes_capacity) {
+        uint64_t* new_hashes = realloc(writer->bloom_hashes, max_values * sizeof(uint64_t));
+        if (!new_hashes) return -1;
+        writer->bloom_hashes = new_hashes;
+        writer->bloom_hashes_capacity = max_values;
+    }
+    storage->hashes = writer->bloom_hashes;
+    storage->count = 0;
+    *out = storage;
+    return 0;
+}
+
+// PLAIN-encode values of a leaf array by physical type
+static int encode_values(ThriftBuffer* buf, const ParquetColumnDef* col, const struct ArrowArray* array,
+                         int num_values, const uint8_t* validity, const int64_t* indices,
+                         StatsAccumulator* acc, BloomCollector* bloom) {
+    switch (col->type) {
+        case PARQUET_TYPE_INT64:
+            return write_plain_int64_data(buf, (const int64_t*)array->buffers[1], num_values, validity, indices, acc, bloom);
+        case PARQUET_TYPE_DOUBLE:
+            return write_plain_double_data(buf, (const double*)array->buffers[1], num_values, validity, indices, acc, bloom);
+        case PARQUET_TYPE_BOOLEAN:
+            return write_plain_bool_data(buf, (const uint8_t*)array->buffers[1], num_values, validity, indices, acc);
+        case PARQUET_TYPE_BYTE_ARRAY:
+            return write_plain_string_data(buf, array, col->bytes_layout,
+                                           num_values, validity, indices, acc, bloom);
+        default:
+            return -1;
+    }
+}
+
+// Encode a flat column: optional definition levels straight from the
+// validity bitmap, then the values
+static int encode_flat_page(ParquetFileWriter* writer, const struct ArrowArray* array, const ParquetColumnDef* col,
+                            ThriftBuffer* data_buf, StatsAccumulator* acc,
+                            BloomCollector** bloom, BloomCollector* bloom_storage, int64_t* num_levels) {
     int num_values = (int)array->length;
     const uint8_t* validity = (const uint8_t*)array->buffers[0];
     int64_t null_count = array->null_count;
 
+    if (num_values > 0 && bloom_begin(writer, col, (size_t)num_values, bloom_storage, bloom) != 0) {
+        return -1;
+    }
+
     // Write definition levels if column is optional
     if (col->repetition == PARQUET_REPETITION_OPTIONAL) {
         if (write_definition_levels(data_buf, num_values, validity, null_count) != 0) {
-            thrift_buffer_free(data_buf);
             return -1;
         }
     }
 
-    // Write data based on type
-    int result = 0;
-    switch (col->type) {
-        case PARQUET_TYPE_INT64:
-            result = write_plain_int64_data(data_buf, (const int64_t*)array->buffers[1], num_values, validity);
-            break;
-        case PARQUET_TYPE_DOUBLE:
-            result = write_plain_double_data(data_buf, (const double*)array->buffers[1], num_values, validity);
-            break;
-        case PARQUET_TYPE_BOOLEAN:
-            result = write_plain_bool_data(data_buf, (const uint8_t*)array->buffers[1], num_values, validity);
-            break;
-        case PARQUET_TYPE_BYTE_ARRAY:
-            result = write_plain_string_data(data_buf,
-                (const int32_t*)array->buffers[1],
-                (const char*)array->buffers[2],
-                num_values, validity);
-            break;
-        default:
-            result = -1;
+    *num_levels = num_values;
+    return encode_values(data_buf, col, array, num_values, validity, NULL, acc, *bloom);
+}
+
+// Encode a nested column: shred into repetition/definition levels, then
+// write the non-null leaf values in level order
+static int encode_nested_page(ParquetFileWriter* writer, const struct ArrowArray* array, const ParquetColumnDef* col,
+                              ThriftBuffer* data_buf, StatsAccumulator* acc,
+                              BloomCollector** bloom, BloomCollector* bloom_storage, int64_t* num_levels) {
+    ShredContext ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.writer = writer;
+    ctx.col = col;
+
+    if (shred_column(&ctx, array) != 0) return -1;
+
+    if (col->max_rep_level > 0) {
+        if (write_levels(data_buf, writer->rep_levels, ctx.num_levels, col->max_rep_level) != 0) return -1;
+    }
+    if (col->max_def_level > 0) {
+        if (write_levels(data_buf, writer->def_levels, ctx.num_levels, col->max_def_level) != 0) return -1;
+    }
+
+    if (ctx.num_values > 0 && bloom_begin(writer, col, ctx.num_values, bloom_storage, bloom) != 0) {
+        return -1;
+    }
+    if (acc) {
+        acc->null_count = (int64_t)(ctx.num_levels - ctx.num_values);
+    }
+
+    *num_levels = (int64_t)ctx.num_levels;
+    return encode_values(data_buf, col, ctx.leaf, (int)ctx.num_values, NULL, writer->value_indices, acc, *bloom);
+}
+
+// Write a column chunk
+static int write_column_chunk(ParquetFileWriter* writer, struct ArrowArray* array, ParquetColumnDef* col, ParquetColumnChunkInfo* info) {
+    // Build the data page
+    ThriftBuffer* data_buf = writer_scratch(&writer->page_buffer, 4096);
+    if (!data_buf) return -1;
+
+    StatsAccumulator stats_acc;
+    StatsAccumulator* acc = NULL;
+    if (writer->write_statistics) {
+        stats_init(&stats_acc);
+        acc = &stats_acc;
     }
 
+    BloomCollector bloom_collector;
+    BloomCollector* bloom = NULL;
+
+    // Write levels and data
+    int64_t num_levels = 0;
+    bool nested = col->max_rep_level > 0 || col->num_steps > 1;
+    int result = nested
+        ? encode_nested_page(writer, array, col, data_buf, acc, &bloom, &bloom_collector, &num_levels)
+        : encode_flat_page(writer, array, col, data_buf, acc, &bloom, &bloom_collector, &num_levels);
+
     if (result != 0) {
-        thrift_buffer_free(data_buf);
         return -1;
     }
 
+    const ParquetColumnStats* page_stats = NULL;
+    if (acc) {
+        if (stats_finish(acc, col->type, &info->stats) != 0) return -1;
+        info->has_stats = true;
+        page_stats = &info->stats;
+    }
+
+    capture_sample(writer, data_buf->data, data_buf->size);
+
     // Compress data page if compression is enabled
     int32_t uncompressed_size = (int32_t)data_buf->size;
-    uint8_t* write_data = data_buf->data;
+    const uint8_t* write_data = data_buf->data;
     int32_t compressed_size = uncompressed_size;
-    uint8_t* compressed_buf = NULL;
 
     if (writer->compression == PARQUET_CODEC_ZSTD && uncompressed_size > 0) {
-        size_t bound = ZSTD_compressBound(uncompressed_size);
-        compressed_buf = malloc(bound);
-        if (compressed_buf) {
-            size_t csize = ZSTD_compress(compressed_buf, bound,
-                                         data_buf->data, uncompressed_size, 3);
-            if (!ZSTD_isError(csize)) {
-                compressed_size = (int32_t)csize;
-                write_data = compressed_buf;
-            } else {
-                free(compressed_buf);
-                compressed_buf = NULL;
-                // Fall back to uncompressed
-            }
+        const uint8_t* compressed = NULL;
+        size_t csize = 0;
+        // The chunk is labeled ZSTD, so its pages cannot be stored raw
+        if (compress_page_zstd(writer, data_buf->data, data_buf->size, &compressed, &csize) != 0) {
+            return -1;
         }
+        compressed_size = (int32_t)csize;
+        write_data = compressed;
     }
 
     // Build page header
-    ThriftBuffer* header_buf = thrift_buffer_create(256);
-    if (!header_buf) {
-        free(compressed_buf);
-        thrift_buffer_free(data_buf);
-        return -1;
-    }
+    ThriftBuffer* header_buf = writer_scratch(&writer->header_buffer, 256);
+    if (!header_buf) return -1;
 
-    if (serialize_page_header(header_buf, PARQUET_PAGE_DATA, uncompressed_size, compressed_size, num_values, PARQUET_ENCODING_PLAIN) != 0) {
-        free(compressed_buf);
-        thrift_buffer_free(data_buf);
-        thrift_buffer_free(header_buf);
+    if (serialize_page_header(header_buf, PARQUET_PAGE_DATA, uncompressed_size, compressed_size, (int32_t)num_levels, PARQUET_ENCODING_PLAIN,
+                              col->type, page_stats) != 0) {
         return -1;
     }
 
@@ -686,24 +1601,24 @@ static int write_column_chunk(ParquetFileWriter* writer, struct ArrowArray* arra
     info->data_page_offset = writer->current_offset;
     info->total_uncompressed_size = header_buf->size + uncompressed_size;
     info->total_compressed_size = header_buf->size + compressed_size;
-    info->num_values = num_values;
+    info->num_values = num_levels;
 
     // Set encodings
-    info->num_encodings = col->repetition == PARQUET_REPETITION_OPTIONAL ? 2 : 1;
+    info->num_encodings = (col->max_def_level > 0 || col->max_rep_level > 0) ? 2 : 1;
     info->encodings = malloc(info->num_encodings * sizeof(ParquetEncoding));
     info->encodings[0] = PARQUET_ENCODING_PLAIN;
     if (info->num_encodings > 1) {
-        info->encodings[1] = PARQUET_ENCODING_RLE;  // For definition levels
+        info->encodings[1] = PARQUET_ENCODING_RLE;  // For repetition/definition levels
     }
 
-    // Write to file
-    fwrite(header_buf->data, 1, header_buf->size, writer->file);
-    fwrite(write_data, 1, compressed_size, writer->file);
+    // Append to the sink; full buffers are written in the background
+    if (parquet_sink_write(writer->sink, header_buf->data, header_buf->size) != 0) return -1;
+    if (parquet_sink_write(writer->sink, write_data, compressed_size) != 0) return -1;
     writer->current_offset += header_buf->size + compressed_size;
 
-    free(compressed_buf);
-    thrift_buffer_free(data_buf);
-    thrift_buffer_free(header_buf);
+    if (bloom) {
+        return write_bloom_filter(writer, bloom, info, col->bloom_filter_fpp);
+    }
 
     return 0;
 }
@@ -718,8 +1633,8 @@ int parquet_file_writer_write_batch(ParquetFileWriter* writer, struct ArrowArray
         }
     }
 
-    // The array should be a struct array with children
-    if (array->n_children != writer->num_columns) {
+    // The array should be a struct array with one child per top-level field
+    if (array->n_children != writer->num_fields) {
         return -1;
     }
 
@@ -741,11 +1656,12 @@ int parquet_file_writer_write_batch(ParquetFileWriter* writer, struct ArrowArray
     // Write each column
     int64_t total_size = 0;
     for (int i = 0; i < writer->num_columns; i++) {
-        struct ArrowArray* col_array = array->children[i];
+        struct ArrowArray* col_array = array->children[writer->columns[i].top_level_index];
         if (write_column_chunk(writer, col_array, &writer->columns[i], &rg->columns[i]) != 0) {
             // Cleanup on error
-            for (int j = 0; j < i; j++) {
+            for (int j = 0; j <= i; j++) {
                 free(rg->columns[j].encodings);
+                column_stats_free(&rg->columns[j].stats);
             }
             free(rg->columns);
             return -1;
@@ -756,11 +1672,14 @@ int parquet_file_writer_write_batch(ParquetFileWriter* writer, struct ArrowArray
     rg->total_byte_size = total_size;
     writer->num_row_groups++;
 
+    if (writer->write_options.fsync_policy == PARQUET_FSYNC_ROW_GROUP) {
+        return parquet_sink_sync(writer->sink);
+    }
     return 0;
 }
 
 int parquet_file_writer_close(ParquetFileWriter* writer) {
-    if (!writer || !writer->file) return -1;
+    if (!writer || !writer->sink) return -1;
 
     // Serialize footer (FileMetaData)
     ThriftBuffer* footer = thrift_buffer_create(4096);
@@ -771,41 +1690,73 @@ int parquet_file_writer_close(ParquetFileWriter* writer) {
         return -1;
     }
 
-    // Write footer
-    fwrite(footer->data, 1, footer->size, writer->file);
-
-    // Write footer size (4 bytes, little-endian)
+    // Write footer, footer size (4 bytes, little-endian) and magic bytes
     uint32_t footer_size = (uint32_t)footer->size;
-    fwrite(&footer_size, sizeof(uint32_t), 1, writer->file);
-
-    // Write magic bytes
-    fwrite(PARQUET_MAGIC, 1, PARQUET_MAGIC_SIZE, writer->file);
-
+    int result = 0;
+    if (parquet_sink_write(writer->sink, footer->data, footer->size) != 0 ||
+        parquet_sink_write(writer->sink, &footer_size, sizeof(uint32_t)) != 0 ||
+        parquet_sink_write(writer->sink, PARQUET_MAGIC, PARQUET_MAGIC_SIZE) != 0) {
+        result = -1;
+    }
     thrift_buffer_free(footer);
-    fclose(writer->file);
-    writer->file = NULL;
 
-    return 0;
+    // Flushes, applies the fsync policy and reports any background write error
+    if (parquet_sink_close(writer->sink) != 0) {
+        result = -1;
+    }
+    writer->sink = NULL;
+
+    return result;
 }
 
 void parquet_file_writer_free(ParquetFileWriter* writer) {
     if (!writer) return;
 
-    if (writer->file) {
-        fclose(writer->file);
-    }
+    // A writer freed without close leaves a truncated file behind
+    parquet_sink_abort(writer->sink);
 
     free(writer->file_path);
     free(writer->created_by);
 
+    ZSTD_freeCCtx(writer->zstd_cctx);
+    ZSTD_freeCDict(writer->zstd_cdict);
+    free(writer->compress_buffer);
+    thrift_buffer_free(writer->page_buffer);
+    thrift_buffer_free(writer->header_buffer);
+    thrift_buffer_free(writer->sample_buffer);
+    free(writer->sample_sizes);
+
+    for (int i = 0; i < writer->num_bloom_columns; i++) {
+        free(writer->bloom_columns[i]);
+    }
+    free(writer->bloom_columns);
+    free(writer->bloom_fpps);
+    free(writer->bloom_hashes);
+    free(writer->bloom_bitset);
+
     for (int i = 0; i < writer->num_columns; i++) {
-        free(writer->columns[i].name);
+        ParquetColumnDef* col = &writer->columns[i];
+        free(col->name);
+        for (int j = 0; j < col->path_length; j++) {
+            free(col->path[j]);
+        }
+        free(col->path);
+        free(col->steps);
     }
     free(writer->columns);
 
+    for (int i = 0; i < writer->num_schema_nodes; i++) {
+        free(writer->schema_nodes[i].name);
+    }
+    free(writer->schema_nodes);
+    free(writer->rep_levels);
+    free(writer->def_levels);
+    free(writer->value_indices);
+
     for (int i = 0; i < writer->num_row_groups; i++) {
         for (int j = 0; j < writer->row_groups[i].num_columns; j++) {
             free(writer->row_groups[i].columns[j].encodings);
+            column_stats_free(&writer->row_groups[i].columns[j].stats);
         }
         free(writer->row_groups[i].columns);
     }
@@ -814,6 +1765,216 @@ void parquet_file_writer_free(ParquetFileWriter* writer) {
     free(writer);
 }
 
+// ============================================================================
+// Split-Block Bloom Filters
+// ============================================================================
+
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+static inline uint64_t xxh_rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t xxh_read64(const uint8_t* p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t xxh_read32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t xxh_round(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME64_2;
+    acc = xxh_rotl64(acc, 31);
+    return acc * XXH_PRIME64_1;
+}
+
+static inline uint64_t xxh_merge_round(uint64_t acc, uint64_t val) {
+    acc ^= xxh_round(0, val);
+    return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+uint64_t parquet_xxhash64(const void* data, size_t len, uint64_t seed) {
+    const uint8_t* p = (const uint8_t*)data;
+    const uint8_t* end = p + len;
+    uint64_t h;
+
+    if (len >= 32) {
+        const uint8_t* limit = end - 32;
+        uint64_t v1 = seed + XXH_PRIME64_1 + XXH_PRIME64_2;
+        uint64_t v2 = seed + XXH_PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - XXH_PRIME64_1;
+
+        do {
+            v1 = xxh_round(v1, xxh_read64(p));
+            v2 = xxh_round(v2, xxh_read64(p + 8));
+            v3 = xxh_round(v3, xxh_read64(p + 16));
+            v4 = xxh_round(v4, xxh_read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = xxh_rotl64(v1, 1) + xxh_rotl64(v2, 7) + xxh_rotl64(v3, 12) + xxh_rotl64(v4, 18);
+        h = xxh_merge_round(h, v1);
+        h = xxh_merge_round(h, v2);
+        h = xxh_merge_round(h, v3);
+        h = xxh_merge_round(h, v4);
+    } else {
+        h = seed + XXH_PRIME64_5;
+    }
+
+    h += (uint64_t)len;
+
+    while (p + 8 <= end) {
+        h ^= xxh_round(0, xxh_read64(p));
+        h = xxh_rotl64(h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+        p += 8;
+    }
+    if (p + 4 <= end) {
+        h ^= (uint64_t)xxh_read32(p) * XXH_PRIME64_1;
+        h = xxh_rotl64(h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        p += 4;
+    }
+    while (p < end) {
+        h ^= (uint64_t)(*p) * XXH_PRIME64_5;
+        h = xxh_rotl64(h, 11) * XXH_PRIME64_1;
+        p++;
+    }
+
+    // Avalanche
+    h ^= h >> 33;
+    h *= XXH_PRIME64_2;
+    h ^= h >> 29;
+    h *= XXH_PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+size_t parquet_bloom_optimal_bytes(int64_t ndv, double fpp) {
+    if (ndv <= 0 || !(fpp > 0.0 && fpp < 1.0)) return PARQUET_BLOOM_MIN_BYTES;
+
+    // m = -8 * ndv / ln(1 - fpp^(1/8)) bits for 8 hash bits per value
+    double bits = -8.0 * (double)ndv / log(1.0 - pow(fpp, 1.0 / 8.0));
+    size_t num_bytes = PARQUET_BLOOM_MIN_BYTES;
+    while (num_bytes < PARQUET_BLOOM_MAX_BYTES && (double)num_bytes * 8.0 < bits) {
+        num_bytes <<= 1;
+    }
+    return num_bytes;
+}
+
+static const uint32_t bloom_salt[8] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+    0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+};
+
+// Upper 32 bits select the block, lower 32 bits set one bit in each word
+static inline size_t bloom_block_offset(size_t num_bytes, uint64_t hash) {
+    uint64_t num_blocks = num_bytes / PARQUET_BLOOM_BLOCK_BYTES;
+    return (size_t)(((hash >> 32) * num_blocks) >> 32) * PARQUET_BLOOM_BLOCK_BYTES;
+}
+
+static inline void bloom_block_mask(uint64_t hash, uint32_t mask[8]) {
+    uint32_t key = (uint32_t)hash;
+    for (int i = 0; i < 8; i++) {
+        mask[i] = 1U << ((key * bloom_salt[i]) >> 27);
+    }
+}
+
+void parquet_bloom_insert(uint8_t* bitset, size_t num_bytes, uint64_t hash) {
+    uint8_t* block = bitset + bloom_block_offset(num_bytes, hash);
+    uint32_t mask[8];
+    uint32_t words[8];
+    bloom_block_mask(hash, mask);
+    memcpy(words, block, sizeof(words));
+    for (int i = 0; i < 8; i++) {
+        words[i] |= mask[i];
+    }
+    memcpy(block, words, sizeof(words));
+}
+
+bool parquet_bloom_check(const uint8_t* bitset, size_t num_bytes, uint64_t hash) {
+    const uint8_t* block = bitset + bloom_block_offset(num_bytes, hash);
+    uint32_t mask[8];
+    uint32_t words[8];
+    bloom_block_mask(hash, mask);
+    memcpy(words, block, sizeof(words));
+    uint32_t missing = 0;
+    for (int i = 0; i < 8; i++) {
+        missing |= mask[i] & ~words[i];
+    }
+    return missing == 0;
+}
+
+// ============================================================================
+// ZSTD Dictionary Compression
+// ============================================================================
+
+int parquet_file_writer_set_zstd_dictionary(ParquetFileWriter* writer, const void* dict, size_t dict_size) {
+    if (!writer) return -1;
+
+    ZSTD_freeCDict(writer->zstd_cdict);
+    writer->zstd_cdict = NULL;
+    writer->zstd_dict_id = 0;
+
+    if (!dict || dict_size == 0) return 0;
+
+    // ZSTD_createCDict copies the dictionary content
+    writer->zstd_cdict = ZSTD_createCDict(dict, dict_size, writer->compression_level);
+    if (!writer->zstd_cdict) return -1;
+    writer->zstd_dict_id = ZSTD_getDictID_fromCDict(writer->zstd_cdict);
+    return 0;
+}
+
+void parquet_file_writer_capture_samples(ParquetFileWriter* writer, size_t max_bytes) {
+    if (writer) {
+        writer->sample_limit = max_bytes;
+    }
+}
+
+int parquet_zstd_train_dictionary(
+    const void* samples,
+    const size_t* sample_sizes,
+    size_t num_samples,
+    size_t max_dict_size,
+    uint8_t** out_dict,
+    size_t* out_dict_size
+) {
+    if (!samples || !sample_sizes || !out_dict || !out_dict_size) return -1;
+    if (num_samples == 0 || max_dict_size == 0) return -1;
+
+    uint8_t* dict = malloc(max_dict_size);
+    if (!dict) return -1;
+
+    size_t size = ZDICT_trainFromBuffer(dict, max_dict_size, samples, sample_sizes, (unsigned)num_samples);
+    if (ZDICT_isError(size)) {
+        free(dict);
+        return -1;
+    }
+
+    *out_dict = dict;
+    *out_dict_size = size;
+    return 0;
+}
+
+int parquet_file_writer_train_zstd_dictionary(
+    ParquetFileWriter* writer,
+    size_t max_dict_size,
+    uint8_t** out_dict,
+    size_t* out_dict_size
+) {
+    if (!writer || !writer->sample_buffer) return -1;
+    return parquet_zstd_train_dictionary(writer->sample_buffer->data, writer->sample_sizes,
+                                         writer->num_samples, max_dict_size, out_dict, out_dict_size);
+}
+
 // ============================================================================
 // High-level API
 // ============================================================================
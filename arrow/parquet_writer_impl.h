@@ -3,6 +3,7 @@
 
 #include "arrow_c_abi.h"
 #include "arrow_builders.h"
+#include "parquet_sink.h"
 #include <stdint.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -103,24 +104,83 @@ typedef enum {
 // Writer Structures
 // ============================================================================
 
-// Column metadata for writing
+// Buffer for building Thrift-encoded data
+typedef struct {
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+} ThriftBuffer;
+
+// Opaque ZSTD handles (see <zstd.h>)
+struct ZSTD_CCtx_s;
+struct ZSTD_CDict_s;
+
+// Maximum depth of nested Arrow types accepted by the writer
+#define PARQUET_MAX_NESTING 32
+
+// Schema tree node, stored depth-first (root excluded)
+typedef struct {
+    char* name;
+    ParquetType type;  // -1 for group nodes
+    ParquetConvertedType converted_type;
+    ParquetRepetition repetition;
+    int32_t num_children;  // 0 for leaf nodes
+} ParquetSchemaNode;
+
+// Arrow layout of BYTE_ARRAY values
+typedef enum {
+    PARQUET_BYTES_OFFSETS32 = 0,  // "u" / "z": int32 offsets + data
+    PARQUET_BYTES_OFFSETS64 = 1,  // "U" / "Z": int64 offsets + data
+    PARQUET_BYTES_VIEW = 2        // "vu" / "vz": 16-byte views + data buffers
+} ParquetBytesLayout;
+
+// One step on the way from a top-level Arrow array down to a leaf column
+typedef enum {
+    PARQUET_SHRED_LEAF = 0,
+    PARQUET_SHRED_STRUCT = 1,
+    PARQUET_SHRED_LIST = 2
+} ParquetShredKind;
+
+typedef struct {
+    ParquetShredKind kind;
+    bool nullable;
+    int32_t child_index;  // STRUCT: child array to descend into
+    int16_t rep_level;    // LIST: repetition level of its elements
+} ParquetShredStep;
+
+// Column metadata for writing (one per leaf)
 typedef struct {
     char* name;
     ParquetType type;
     ParquetConvertedType converted_type;
     ParquetRepetition repetition;
     int32_t type_length;  // For fixed-length types
+    ParquetBytesLayout bytes_layout;  // BYTE_ARRAY: how the Arrow values are laid out
+    double bloom_filter_fpp;  // Target false-positive rate (0 = no Bloom filter)
+
+    // Position in the schema tree
+    char** path;  // path_in_schema, from the top-level field to the leaf
+    int path_length;
+    int top_level_index;  // Child of the written struct array holding this column
+    int16_t max_def_level;
+    int16_t max_rep_level;
+    ParquetShredStep* steps;
+    int num_steps;
 } ParquetColumnDef;
 
 // Column chunk statistics
 typedef struct {
     bool has_min_max;
-    int64_t min_int64;
+    int64_t min_int64;     // INT64 and BOOLEAN columns
     int64_t max_int64;
-    double min_double;
+    double min_double;     // DOUBLE columns
     double max_double;
+    uint8_t* min_bytes;    // BYTE_ARRAY columns (owned copies)
+    size_t min_bytes_len;
+    uint8_t* max_bytes;
+    size_t max_bytes_len;
     int64_t null_count;
-    int64_t distinct_count;
+    int64_t distinct_estimate;  // HyperLogLog estimate for Bloom sizing; not written
 } ParquetColumnStats;
 
 // Column chunk info (after writing)
@@ -133,7 +193,10 @@ typedef struct {
     int64_t dictionary_page_offset;
     ParquetEncoding* encodings;
     int num_encodings;
+    bool has_stats;
     ParquetColumnStats stats;
+    int64_t bloom_filter_offset;  // 0 when the chunk has no Bloom filter
+    int32_t bloom_filter_length;
 } ParquetColumnChunkInfo;
 
 // Row group info
@@ -146,12 +209,16 @@ typedef struct {
 
 // Parquet file writer state
 typedef struct {
-    FILE* file;
+    ParquetSink* sink;  // Coalescing, optionally asynchronous output
+    ParquetWriteOptions write_options;
     char* file_path;
 
     // Schema
-    ParquetColumnDef* columns;
+    ParquetColumnDef* columns;  // Leaf columns
     int num_columns;
+    ParquetSchemaNode* schema_nodes;
+    int num_schema_nodes;
+    int num_fields;  // Top-level fields
 
     // Row groups
     ParquetRowGroupInfo* row_groups;
@@ -165,22 +232,52 @@ typedef struct {
     // Options
     int64_t row_group_size;  // Max bytes per row group
     bool write_statistics;
+    int compression_level;
 
     // Created by info
     char* created_by;
+
+    // Compression state, created lazily and reused for every page
+    struct ZSTD_CCtx_s* zstd_cctx;
+    struct ZSTD_CDict_s* zstd_cdict;   // Optional trained dictionary
+    uint32_t zstd_dict_id;
+    uint8_t* compress_buffer;
+    size_t compress_buffer_capacity;
+
+    // Page scratch buffers (reset per column chunk instead of reallocated)
+    ThriftBuffer* page_buffer;
+    ThriftBuffer* header_buffer;
+
+    // Optional capture of uncompressed pages for dictionary training
+    ThriftBuffer* sample_buffer;
+    size_t* sample_sizes;
+    size_t num_samples;
+    size_t samples_capacity;
+    size_t sample_limit;  // Max bytes to capture (0 = capture disabled)
+
+    // Bloom filter requests by column name, applied as columns are added
+    char** bloom_columns;
+    double* bloom_fpps;
+    int num_bloom_columns;
+
+    // Bloom filter scratch (value hashes collected during encoding, bitset)
+    uint64_t* bloom_hashes;
+    size_t bloom_hashes_capacity;
+    uint8_t* bloom_bitset;
+    size_t bloom_bitset_capacity;
+
+    // Level scratch for nested columns (repetition/definition per entry)
+    uint8_t* rep_levels;
+    uint8_t* def_levels;
+    size_t levels_capacity;
+    int64_t* value_indices;  // Leaf array positions of non-null values
+    size_t value_indices_capacity;
 } ParquetFileWriter;
 
 // ============================================================================
 // Thrift Compact Protocol Writer
 // ============================================================================
 
-// Buffer for building Thrift-encoded data
-typedef struct {
-    uint8_t* data;
-    size_t size;
-    size_t capacity;
-} ThriftBuffer;
-
 ThriftBuffer* thrift_buffer_create(size_t initial_capacity);
 void thrift_buffer_free(ThriftBuffer* buf);
 int thrift_buffer_ensure_capacity(ThriftBuffer* buf, size_t additional);
@@ -198,9 +295,23 @@ int thrift_buffer_write_binary(ThriftBuffer* buf, const void* data, size_t len);
 // Create a new Parquet writer
 ParquetFileWriter* parquet_file_writer_create(const char* path);
 
+// Create a writer with explicit I/O options (buffering, background writes,
+// direct I/O, fsync policy). NULL options behave like parquet_file_writer_create.
+ParquetFileWriter* parquet_file_writer_create_with_options(const char* path, const ParquetWriteOptions* options);
+
 // Set compression codec
 void parquet_file_writer_set_compression(ParquetFileWriter* writer, ParquetCompressionCodec codec);
 
+// Set ZSTD compression level (default 3)
+void parquet_file_writer_set_compression_level(ParquetFileWriter* writer, int level);
+
+// Enable or disable min/max/null_count statistics (default: enabled)
+void parquet_file_writer_set_write_statistics(ParquetFileWriter* writer, bool enabled);
+
+// Build a split-block Bloom filter for a column with the given false-positive
+// rate (e.g. 0.01). May be called before the schema is known. Returns 0 on success.
+int parquet_file_writer_enable_bloom_filter(ParquetFileWriter* writer, const char* column_name, double fpp);
+
 // Set row group size (bytes)
 void parquet_file_writer_set_row_group_size(ParquetFileWriter* writer, int64_t size);
 
@@ -232,6 +343,62 @@ int parquet_file_writer_close(ParquetFileWriter* writer);
 // Free the writer resources
 void parquet_file_writer_free(ParquetFileWriter* writer);
 
+// ============================================================================
+// Split-Block Bloom Filters
+// ============================================================================
+
+#define PARQUET_BLOOM_BLOCK_BYTES 32                  // 8 x 32-bit words
+#define PARQUET_BLOOM_MIN_BYTES   32
+#define PARQUET_BLOOM_MAX_BYTES   (128 * 1024 * 1024)
+
+// XXH64 as used by Parquet to hash PLAIN-encoded values (seed 0)
+uint64_t parquet_xxhash64(const void* data, size_t len, uint64_t seed);
+
+// Bitset size (power of two) for the expected distinct values and false-positive rate
+size_t parquet_bloom_optimal_bytes(int64_t ndv, double fpp);
+
+// Insert / probe a hash in a split-block bitset of num_bytes bytes
+void parquet_bloom_insert(uint8_t* bitset, size_t num_bytes, uint64_t hash);
+bool parquet_bloom_check(const uint8_t* bitset, size_t num_bytes, uint64_t hash);
+
+// ============================================================================
+// ZSTD Dictionary Compression
+// ============================================================================
+//
+// Tiny files with a shared schema compress poorly page-by-page: every page
+// starts from an empty ZSTD window. A dictionary trained on representative
+// pages primes that window. Files written with a dictionary can only be read
+// back by a reader configured with the same dictionary; its ID is recorded in
+// the footer key-value metadata under PARQUET_ZSTD_DICT_ID_KEY.
+
+#define PARQUET_ZSTD_DICT_ID_KEY "arrow-lean.zstd.dictionary_id"
+
+// Use a trained dictionary for all subsequent ZSTD pages (copies dict).
+// Passing NULL/0 clears the dictionary.
+int parquet_file_writer_set_zstd_dictionary(ParquetFileWriter* writer, const void* dict, size_t dict_size);
+
+// Capture uncompressed pages (up to max_bytes) as dictionary training samples
+void parquet_file_writer_capture_samples(ParquetFileWriter* writer, size_t max_bytes);
+
+// Train a dictionary from the pages captured so far.
+// On success *out_dict is malloc'd and must be freed by the caller.
+int parquet_file_writer_train_zstd_dictionary(
+    ParquetFileWriter* writer,
+    size_t max_dict_size,
+    uint8_t** out_dict,
+    size_t* out_dict_size
+);
+
+// Train a dictionary from concatenated samples (sample_sizes[i] bytes each)
+int parquet_zstd_train_dictionary(
+    const void* samples,
+    const size_t* sample_sizes,
+    size_t num_samples,
+    size_t max_dict_size,
+    uint8_t** out_dict,
+    size_t* out_dict_size
+);
+
 // ============================================================================
 // High-level API (integrates with existing parquet_wrapper.h)
 // ============================================================================
@@ -0,0 +1,202 @@
+/**
+ * test_array_share.c - Shared array references: slices, chunked arrays and
+ * table projections alias the original buffers and free them with the last
+ * reference
+ */
+
+#include "test_util.h"
+#include "arrow_chunked.h"
+#include "arrow_wrapper.h"
+
+#define ROWS 100
+
+static int frees;
+
+// An owned int64 array: value k * 1000 + i, null when i % 4 == 0
+typedef struct {
+    int64_t values[ROWS];
+    uint8_t validity[(ROWS + 7) / 8];
+    const void* buffers[2];
+} Tracked;
+
+static void release_tracked(struct ArrowArray* array) {
+    free(array->private_data);
+    array->release = NULL;
+    frees++;
+}
+
+static void make_tracked(struct ArrowArray* out, int64_t k) {
+    Tracked* t = calloc(1, sizeof(Tracked));
+    CHECK(t != NULL);
+    for (int64_t i = 0; i < ROWS; i++) {
+        t->values[i] = k * 1000 + i;
+        if (i % 4 != 0) t->validity[i / 8] |= (uint8_t)(1u << (i % 8));
+    }
+    t->buffers[0] = t->validity;
+    t->buffers[1] = t->values;
+    memset(out, 0, sizeof(*out));
+    out->length = ROWS;
+    out->null_count = ROWS / 4;
+    out->n_buffers = 2;
+    out->buffers = t->buffers;
+    out->release = release_tracked;
+    out->private_data = t;
+}
+
+static struct ArrowArray* new_tracked(int64_t k) {
+    struct ArrowArray* array = malloc(sizeof(struct ArrowArray));
+    CHECK(array != NULL);
+    make_tracked(array, k);
+    return array;
+}
+
+// Row `r` of a (possibly sliced) tracked array comes from chunk `k`, row `i`
+static void check_row(const struct ArrowArray* array, int64_t r, int64_t k, int64_t i) {
+    CHECK_EQ(test_bit(array->buffers[0], array->offset + r), i % 4 != 0);
+    if (i % 4 != 0) CHECK_EQ(((const int64_t*)array->buffers[1])[array->offset + r], k * 1000 + i);
+}
+
+static void test_share_and_slice(void) {
+    frees = 0;
+    struct ArrowArray array;
+    make_tracked(&array, 0);
+    const void* values = array.buffers[1];
+
+    struct ArrowArray copy;
+    struct ArrowArray slice;
+    CHECK_EQ(arrow_array_share(&array, &copy), 0);
+    CHECK_EQ(arrow_array_share_slice(&array, 10, 20, &slice), 0);
+    CHECK(copy.buffers[1] == values && slice.buffers[1] == values);
+    CHECK_EQ(slice.offset, 10);
+    CHECK_EQ(slice.length, 20);
+    CHECK_EQ(slice.null_count, 5);     // rows 12, 16, 20, 24, 28
+    for (int64_t r = 0; r < 20; r++) check_row(&slice, r, 0, 10 + r);
+
+    // A slice of a slice stacks the offsets
+    struct ArrowArray inner;
+    CHECK_EQ(arrow_array_share_slice(&slice, 5, 3, &inner), 0);
+    CHECK_EQ(inner.offset, 15);
+    for (int64_t r = 0; r < 3; r++) check_row(&inner, r, 0, 15 + r);
+    inner.release(&inner);
+
+    // Rows past the end are refused
+    struct ArrowArray outside;
+    CHECK_EQ(arrow_array_share_slice(&slice, 18, 5, &outside), -1);
+
+    array.release(&array);
+    slice.release(&slice);
+    CHECK_EQ(frees, 0);
+    copy.release(&copy);
+    CHECK_EQ(frees, 1);
+}
+
+static void test_chunked_slice(void) {
+    frees = 0;
+    struct ArrowSchema type = test_schema("l", "v", 0, NULL);
+    ChunkedArray* ca = chunked_array_create(&type);
+    CHECK(ca != NULL);
+    for (int64_t k = 0; k < 3; k++) CHECK_EQ(chunked_array_add_chunk(ca, new_tracked(k)), 0);
+    CHECK_EQ(chunked_array_length(ca), 3 * ROWS);
+
+    // Rows 150..249 span the second and third chunks without copying
+    ChunkedArray* slice = chunked_array_slice(ca, 150, 100);
+    CHECK(slice != NULL);
+    CHECK_EQ(chunked_array_length(slice), 100);
+    CHECK_EQ(chunked_array_num_chunks(slice), 2);
+    struct ArrowArray* first = chunked_array_get_chunk(slice, 0);
+    struct ArrowArray* second = chunked_array_get_chunk(slice, 1);
+    CHECK_EQ(first->length, 50);
+    CHECK_EQ(second->length, 50);
+    CHECK(first->buffers[1] == chunked_array_get_chunk(ca, 1)->buffers[1]);
+    for (int64_t r = 0; r < 50; r++) {
+        check_row(first, r, 1, 50 + r);
+        check_row(second, r, 2, r);
+    }
+
+    ChunkedArray* shared = chunked_array_share(slice);
+    CHECK(shared != NULL);
+
+    // Only the chunk no slice refers to goes with the original
+    chunked_array_free(ca);
+    CHECK_EQ(frees, 1);
+    chunked_array_free(slice);
+    CHECK_EQ(frees, 1);
+    check_row(chunked_array_get_chunk(shared, 1), 49, 2, 49);
+    chunked_array_free(shared);
+    CHECK_EQ(frees, 3);
+}
+
+// A struct batch owning three tracked columns
+typedef struct {
+    struct ArrowArray columns[3];
+    struct ArrowArray* column_ptrs[3];
+    const void* buffers[1];
+} TrackedBatch;
+
+static void release_batch(struct ArrowArray* array) {
+    TrackedBatch* b = array->private_data;
+    for (int c = 0; c < 3; c++) {
+        if (b->columns[c].release) b->columns[c].release(&b->columns[c]);
+    }
+    free(b);
+    array->release = NULL;
+}
+
+static void test_table_views(void) {
+    frees = 0;
+    TrackedBatch* b = calloc(1, sizeof(TrackedBatch));
+    CHECK(b != NULL);
+    for (int c = 0; c < 3; c++) {
+        make_tracked(&b->columns[c], c);
+        b->column_ptrs[c] = &b->columns[c];
+    }
+    struct ArrowArray batch;
+    memset(&batch, 0, sizeof(batch));
+    batch.length = ROWS;
+    batch.n_buffers = 1;
+    batch.buffers = b->buffers;
+    batch.n_children = 3;
+    batch.children = b->column_ptrs;
+    batch.private_data = b;
+    batch.release = release_batch;
+
+    struct ArrowSchema a = test_schema("l", "a", 0, NULL);
+    struct ArrowSchema bb = test_schema("l", "b", 0, NULL);
+    struct ArrowSchema c = test_schema("l", "c", 0, NULL);
+    struct ArrowSchema* fields[] = {&a, &bb, &c};
+    struct ArrowSchema schema = test_schema("+s", "", 3, fields);
+
+    Table* table = table_from_record_batch(&batch, &schema);
+    CHECK(table != NULL);
+    batch.release(&batch);
+    CHECK_EQ(frees, 0);
+
+    size_t indices[] = {2, 0};
+    Table* projected = table_select_columns(table, indices, 2);
+    Table* sliced = table_slice(table, 30, 40);
+    CHECK(projected != NULL && sliced != NULL);
+    table_free(table);
+    CHECK_EQ(frees, 0);
+
+    CHECK_EQ(table_num_columns(projected), 2);
+    struct ArrowArray* col = chunked_array_get_chunk(table_get_column(projected, 0), 0);
+    for (int64_t r = 0; r < ROWS; r++) check_row(col, r, 2, r);
+
+    CHECK_EQ(table_num_rows(sliced), 40);
+    col = chunked_array_get_chunk(table_get_column(sliced, 1), 0);
+    for (int64_t r = 0; r < 40; r++) check_row(col, r, 1, 30 + r);
+
+    // The batch goes with its last column reference
+    table_free(projected);
+    CHECK_EQ(frees, 0);
+    table_free(sliced);
+    CHECK_EQ(frees, 3);
+}
+
+int main(void) {
+    printf("test_array_share\n");
+    RUN_TEST(test_share_and_slice);
+    RUN_TEST(test_chunked_slice);
+    RUN_TEST(test_table_views);
+    return 0;
+}
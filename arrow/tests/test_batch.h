@@ -0,0 +1,161 @@
+/**
+ * test_batch.h - A sample record batch covering the common layouts
+ *
+ * Columns: id int64 (required), score float64 (every third row null),
+ * name utf8 and tags list<int32> (row i has i % 4 elements).
+ * Values are a function of the row number and a seed, so a batch read back
+ * can be checked without keeping the original.
+ */
+
+#ifndef ARROW_TEST_BATCH_H
+#define ARROW_TEST_BATCH_H
+
+#include "test_util.h"
+
+#define TEST_BATCH_MAX_ROWS 4096
+
+typedef struct {
+    int64_t ids[TEST_BATCH_MAX_ROWS];
+    double scores[TEST_BATCH_MAX_ROWS];
+    uint8_t score_validity[TEST_BATCH_MAX_ROWS / 8];
+    int32_t name_offsets[TEST_BATCH_MAX_ROWS + 1];
+    char names[TEST_BATCH_MAX_ROWS * 12];
+    int32_t tag_offsets[TEST_BATCH_MAX_ROWS + 1];
+    int32_t tags[TEST_BATCH_MAX_ROWS * 3];
+
+    const void* id_buffers[2];
+    const void* score_buffers[2];
+    const void* name_buffers[3];
+    const void* tag_value_buffers[2];
+    const void* tag_buffers[2];
+    const void* batch_buffers[1];
+    struct ArrowArray columns[4];
+    struct ArrowArray tag_values;
+    struct ArrowArray* tag_children[1];
+    struct ArrowArray* column_ptrs[4];
+    struct ArrowArray array;
+
+    struct ArrowSchema fields[4];
+    struct ArrowSchema tag_item;
+    struct ArrowSchema* tag_fields[1];
+    struct ArrowSchema* field_ptrs[4];
+    struct ArrowSchema schema;
+} TestBatch;
+
+static inline int test_batch_score_valid(int64_t row) {
+    return row % 3 != 0;
+}
+
+static inline int test_batch_name(char* out, int64_t seed, int64_t row) {
+    return sprintf(out, "n%lld", (long long)((seed * 7919 + row) % 100000));
+}
+
+// Fill `b` with `rows` rows; b->array and b->schema borrow from `b`
+static inline void test_batch_init(TestBatch* b, int64_t rows, int64_t seed) {
+    CHECK(rows <= TEST_BATCH_MAX_ROWS);
+    memset(b->score_validity, 0, sizeof(b->score_validity));
+    int32_t name_pos = 0;
+    int32_t tag_pos = 0;
+    for (int64_t i = 0; i < rows; i++) {
+        b->ids[i] = seed * 1000000 + i;
+        b->scores[i] = test_batch_score_valid(i) ? (double)i * 0.5 + (double)seed : 0.0;
+        if (test_batch_score_valid(i)) b->score_validity[i / 8] |= (uint8_t)(1u << (i % 8));
+        b->name_offsets[i] = name_pos;
+        name_pos += test_batch_name(b->names + name_pos, seed, i);
+        b->tag_offsets[i] = tag_pos;
+        for (int64_t k = 0; k < i % 4; k++) b->tags[tag_pos++] = (int32_t)(i * 10 + k);
+    }
+    b->name_offsets[rows] = name_pos;
+    b->tag_offsets[rows] = tag_pos;
+
+    b->id_buffers[0] = NULL;
+    b->id_buffers[1] = b->ids;
+    b->score_buffers[0] = b->score_validity;
+    b->score_buffers[1] = b->scores;
+    b->name_buffers[0] = NULL;
+    b->name_buffers[1] = b->name_offsets;
+    b->name_buffers[2] = b->names;
+    b->tag_value_buffers[0] = NULL;
+    b->tag_value_buffers[1] = b->tags;
+    b->tag_buffers[0] = NULL;
+    b->tag_buffers[1] = b->tag_offsets;
+    b->batch_buffers[0] = NULL;
+
+    b->tag_values = test_array(tag_pos, 2, b->tag_value_buffers, 0, NULL);
+    b->tag_children[0] = &b->tag_values;
+    b->columns[0] = test_array(rows, 2, b->id_buffers, 0, NULL);
+    b->columns[1] = test_array(rows, 2, b->score_buffers, 0, NULL);
+    b->columns[1].null_count = (rows + 2) / 3;
+    b->columns[2] = test_array(rows, 3, b->name_buffers, 0, NULL);
+    b->columns[3] = test_array(rows, 2, b->tag_buffers, 1, b->tag_children);
+    for (int c = 0; c < 4; c++) b->column_ptrs[c] = &b->columns[c];
+    b->array = test_array(rows, 1, b->batch_buffers, 4, b->column_ptrs);
+
+    b->fields[0] = test_schema("l", "id", 0, NULL);
+    b->fields[0].flags = 0;
+    b->fields[1] = test_schema("g", "score", 0, NULL);
+    b->fields[2] = test_schema("u", "name", 0, NULL);
+    b->tag_item = test_schema("i", "item", 0, NULL);
+    b->tag_fields[0] = &b->tag_item;
+    b->fields[3] = test_schema("+l", "tags", 1, b->tag_fields);
+    for (int c = 0; c < 4; c++) b->field_ptrs[c] = &b->fields[c];
+    b->schema = test_schema("+s", "", 4, b->field_ptrs);
+}
+
+// Check a batch read back: `rows` rows of the batch made with `seed`,
+// starting at row `first` of it
+static inline void test_batch_check_rows(const struct ArrowSchema* schema, const struct ArrowArray* array,
+                                         int64_t seed, int64_t first, int64_t rows) {
+    if (schema) {
+        CHECK_EQ(schema->n_children, 4);
+        CHECK(strcmp(schema->children[0]->format, "l") == 0);
+        CHECK(strcmp(schema->children[1]->name, "score") == 0);
+        CHECK(strcmp(schema->children[3]->format, "+l") == 0);
+        CHECK(strcmp(schema->children[3]->children[0]->format, "i") == 0);
+    }
+    CHECK_EQ(array->length, rows);
+    CHECK_EQ(array->n_children, 4);
+
+    const struct ArrowArray* id = array->children[0];
+    const struct ArrowArray* score = array->children[1];
+    const struct ArrowArray* name = array->children[2];
+    const struct ArrowArray* tags = array->children[3];
+    const struct ArrowArray* tag_values = tags->children[0];
+    const int64_t* ids = (const int64_t*)id->buffers[1];
+    const double* scores = (const double*)score->buffers[1];
+    const int32_t* name_offsets = (const int32_t*)name->buffers[1];
+    const char* names = (const char*)name->buffers[2];
+    const int32_t* tag_offsets = (const int32_t*)tags->buffers[1];
+    const int32_t* tag_items = (const int32_t*)tag_values->buffers[1];
+
+    int64_t nulls = 0;
+    char expected[16];
+    for (int64_t r = 0; r < rows; r++) {
+        int64_t i = first + r;
+        CHECK_EQ(ids[id->offset + r], seed * 1000000 + i);
+
+        int is_valid = test_bit(score->buffers[0], score->offset + r);
+        CHECK_EQ(is_valid, test_batch_score_valid(i));
+        if (is_valid) CHECK_EQ(scores[score->offset + r], (double)i * 0.5 + (double)seed);
+        nulls += !is_valid;
+
+        int len = test_batch_name(expected, seed, i);
+        int32_t start = name_offsets[name->offset + r];
+        CHECK_EQ(name_offsets[name->offset + r + 1] - start, len);
+        CHECK(memcmp(names + start, expected, (size_t)len) == 0);
+
+        int32_t tag_start = tag_offsets[tags->offset + r];
+        CHECK_EQ(tag_offsets[tags->offset + r + 1] - tag_start, i % 4);
+        for (int64_t k = 0; k < i % 4; k++) {
+            CHECK_EQ(tag_items[tag_values->offset + tag_start + k], (int32_t)(i * 10 + k));
+        }
+    }
+    if (score->null_count >= 0) CHECK_EQ(score->null_count, nulls);
+}
+
+static inline void test_batch_check(const struct ArrowSchema* schema, const struct ArrowArray* array,
+                                    int64_t seed, int64_t rows) {
+    test_batch_check_rows(schema, array, seed, 0, rows);
+}
+
+#endif // ARROW_TEST_BATCH_H
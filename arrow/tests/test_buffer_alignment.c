@@ -0,0 +1,198 @@
+/**
+ * test_buffer_alignment.c - 64-byte aligned, padded buffers from builders,
+ * kernels, IPC and Parquet reads
+ *
+ * Each buffer is read up to its padded end, so the sanitizer build catches
+ * a buffer shorter than the guarantee.
+ */
+
+#include "test_parquet_util.h"
+#include "arrow_builders.h"
+#include "arrow_compute.h"
+#include "arrow_ipc.h"
+#include "arrow_memory.h"
+
+#define ROWS 3001
+
+static size_t padded(size_t used) {
+    return (used + ARROW_BUFFER_ALIGNMENT - 1) / ARROW_BUFFER_ALIGNMENT * ARROW_BUFFER_ALIGNMENT;
+}
+
+// Aligned, and every byte up to the padded end of `used` is readable
+static void check_buffer(const void* buffer, size_t used) {
+    if (!buffer) return;
+    CHECK_EQ((uintptr_t)buffer % ARROW_BUFFER_ALIGNMENT, 0);
+    const volatile uint8_t* p = (const volatile uint8_t*)buffer;
+    uint8_t acc = 0;
+    for (size_t i = 0; i < padded(used); i++) acc ^= p[i];
+    (void)acc;
+}
+
+static void check_fixed(const struct ArrowArray* array, size_t width) {
+    size_t length = (size_t)(array->offset + array->length);
+    check_buffer(array->buffers[0], (length + 7) / 8);
+    check_buffer(array->buffers[1], width ? length * width : (length + 7) / 8);
+}
+
+static void check_string(const struct ArrowArray* array) {
+    size_t length = (size_t)(array->offset + array->length);
+    const int32_t* offsets = (const int32_t*)array->buffers[1];
+    check_buffer(array->buffers[0], (length + 7) / 8);
+    check_buffer(offsets, (length + 1) * sizeof(int32_t));
+    check_buffer(array->buffers[2], (size_t)offsets[length]);
+}
+
+static void release(struct ArrowArray* array) {
+    array->release(array);
+    free(array);
+}
+
+// Start from a capacity of one so every buffer goes through realloc growth
+static struct ArrowArray* build_int64(void) {
+    Int64Builder* builder = int64_builder_create(1);
+    for (int64_t i = 0; i < ROWS; i++) {
+        CHECK_EQ(i % 11 == 0 ? int64_builder_append_null(builder) : int64_builder_append(builder, i * 3), 0);
+    }
+    struct ArrowArray* array = int64_builder_finish(builder);
+    int64_builder_free(builder);
+    CHECK(array != NULL);
+    return array;
+}
+
+static struct ArrowArray* build_string(void) {
+    StringBuilder* builder = string_builder_create(1, 1);
+    char text[32];
+    for (int64_t i = 0; i < ROWS; i++) {
+        int len = sprintf(text, "value-%lld", (long long)i);
+        CHECK_EQ(string_builder_append(builder, text, (size_t)len), 0);
+    }
+    struct ArrowArray* array = string_builder_finish(builder);
+    string_builder_free(builder);
+    CHECK(array != NULL);
+    return array;
+}
+
+static struct ArrowArray* build_mask(void) {
+    BoolBuilder* builder = bool_builder_create(1);
+    for (int64_t i = 0; i < ROWS; i++) CHECK_EQ(bool_builder_append(builder, i % 3 == 1), 0);
+    struct ArrowArray* array = bool_builder_finish(builder);
+    bool_builder_free(builder);
+    CHECK(array != NULL);
+    return array;
+}
+
+static void test_raw_allocations(void) {
+    // Every size from empty to a few vectors, with zeroed padding
+    for (size_t size = 0; size <= 3 * ARROW_BUFFER_ALIGNMENT; size++) {
+        uint8_t* p = arrow_mem_alloc(size);
+        CHECK(p != NULL);
+        check_buffer(p, size);
+        for (size_t i = size; i < padded(size); i++) CHECK_EQ(p[i], 0);
+        arrow_mem_free(p);
+    }
+
+    // Growing and shrinking keep the alignment, the contents and the padding
+    uint8_t* p = arrow_mem_alloc(10);
+    memset(p, 0xEE, 10);
+    size_t sizes[] = {100, 1000, 65, 64, 7, 5000};
+    size_t kept = 10;
+    for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++) {
+        p = arrow_mem_realloc(p, sizes[k]);
+        CHECK(p != NULL);
+        check_buffer(p, sizes[k]);
+        if (sizes[k] < kept) kept = sizes[k];
+        for (size_t i = 0; i < kept; i++) CHECK_EQ(p[i], 0xEE);
+        if (sizes[k] <= kept) {
+            for (size_t i = sizes[k]; i < padded(sizes[k]); i++) CHECK_EQ(p[i], 0);
+        }
+    }
+    arrow_mem_free(p);
+}
+
+static void test_builders(void) {
+    struct ArrowArray* ints = build_int64();
+    struct ArrowArray* strings = build_string();
+    struct ArrowArray* mask = build_mask();
+    check_fixed(ints, sizeof(int64_t));
+    check_string(strings);
+    check_fixed(mask, 0);
+    release(ints);
+    release(strings);
+    release(mask);
+}
+
+static void test_kernels(void) {
+    struct ArrowArray* ints = build_int64();
+    struct ArrowArray* strings = build_string();
+    struct ArrowArray* mask = build_mask();
+
+    struct ArrowArray* sum = arrow_add_int64(ints, ints);
+    struct ArrowArray* scaled = arrow_multiply_scalar_int64(ints, 5);
+    struct ArrowArray* filtered = arrow_filter_string(strings, mask);
+    struct ArrowArray* indices = arrow_sort_indices_int64(ints, false);
+    CHECK(sum && scaled && filtered && indices);
+    check_fixed(sum, sizeof(int64_t));
+    check_fixed(scaled, sizeof(int64_t));
+    check_string(filtered);
+    CHECK_EQ(filtered->length, ROWS / 3);
+    check_fixed(indices, sizeof(int32_t));
+
+    release(sum);
+    release(scaled);
+    release(filtered);
+    release(indices);
+    release(ints);
+    release(strings);
+    release(mask);
+}
+
+// A batch of builder columns read back through copying IPC and Parquet
+static void test_readers(void) {
+    struct ArrowArray* ints = build_int64();
+    struct ArrowArray* strings = build_string();
+    struct ArrowArray* column_ptrs[] = {ints, strings};
+    const void* batch_buffers[] = {NULL};
+    struct ArrowArray batch = test_array(ROWS, 1, batch_buffers, 2, column_ptrs);
+    struct ArrowSchema id = test_schema("l", "id", 0, NULL);
+    struct ArrowSchema name = test_schema("u", "name", 0, NULL);
+    struct ArrowSchema* fields[] = {&id, &name};
+    struct ArrowSchema schema = test_schema("+s", "", 2, fields);
+
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch(&schema, &batch, &data, &size), ARROW_IPC_OK);
+    struct ArrowSchema ipc_schema;
+    struct ArrowArray ipc_batch;
+    CHECK_EQ(arrow_ipc_deserialize_batch(data, size, &ipc_schema, &ipc_batch), ARROW_IPC_OK);
+    free(data);
+    CHECK_EQ(ipc_batch.length, ROWS);
+    check_fixed(ipc_batch.children[0], sizeof(int64_t));
+    check_string(ipc_batch.children[1]);
+    ipc_batch.release(&ipc_batch);
+    ipc_schema.release(&ipc_schema);
+
+    const char* path = test_parquet_path("alignment");
+    test_parquet_write(parquet_file_writer_create(path), &batch, &schema);
+    ParquetFileReader* reader = parquet_file_reader_open(path);
+    struct ArrowSchema pq_schema;
+    struct ArrowArray pq_batch;
+    test_parquet_read(reader, &pq_schema, &pq_batch);
+    CHECK_EQ(pq_batch.length, ROWS);
+    check_fixed(pq_batch.children[0], sizeof(int64_t));
+    check_string(pq_batch.children[1]);
+    test_parquet_release(&pq_schema, &pq_batch);
+    parquet_file_reader_close(reader);
+    remove(path);
+
+    release(ints);
+    release(strings);
+}
+
+int main(void) {
+    printf("test_buffer_alignment\n");
+    RUN_TEST(test_raw_allocations);
+    RUN_TEST(test_builders);
+    RUN_TEST(test_kernels);
+    RUN_TEST(test_readers);
+    return 0;
+}
@@ -0,0 +1,207 @@
+/**
+ * test_builder_bulk.c - Bulk append_values against element-wise appends
+ */
+
+#include "test_util.h"
+#include "arrow_builders.h"
+
+#define COUNT 1000
+
+// Row i is null when i % 5 == 2
+static int row_valid(size_t i) {
+    return i % 5 != 2;
+}
+
+static uint8_t validity[(COUNT + 7) / 8];
+
+static void init_validity(void) {
+    memset(validity, 0, sizeof(validity));
+    for (size_t i = 0; i < COUNT; i++) {
+        if (row_valid(i)) validity[i / 8] |= (uint8_t)(1u << (i % 8));
+    }
+}
+
+// Bit `start` of validity as the first bit of a new bitmap
+static const uint8_t* validity_from(size_t start, uint8_t* out) {
+    memset(out, 0, sizeof(validity));
+    for (size_t i = start; i < COUNT; i++) {
+        if (test_bit(validity, (int64_t)i)) out[(i - start) / 8] |= (uint8_t)(1u << ((i - start) % 8));
+    }
+    return out;
+}
+
+static void check_same(struct ArrowArray* a, struct ArrowArray* b, int value_buffer, size_t width) {
+    CHECK_EQ(a->length, b->length);
+    CHECK_EQ(a->null_count, b->null_count);
+    for (int64_t i = 0; i < a->length; i++) {
+        CHECK_EQ(test_bit(a->buffers[0], i), test_bit(b->buffers[0], i));
+        if (!test_bit(a->buffers[0], i)) continue;
+        if (width == 0) {
+            CHECK_EQ(test_bit(a->buffers[value_buffer], i), test_bit(b->buffers[value_buffer], i));
+        } else {
+            CHECK(memcmp((const uint8_t*)a->buffers[value_buffer] + i * width,
+                         (const uint8_t*)b->buffers[value_buffer] + i * width, width) == 0);
+        }
+    }
+    a->release(a);
+    free(a);
+    b->release(b);
+    free(b);
+}
+
+/*
+ * Build the same column twice: element by element, and as a few single
+ * appends mixed with bulk appends that start at unaligned bit positions
+ * (the last one without a validity bitmap).
+ */
+#define TEST_FIXED(name, Builder, ctype, create_args, value_of) \
+static void test_##name(void) { \
+    static ctype values[COUNT]; \
+    for (size_t i = 0; i < COUNT; i++) values[i] = (ctype)(value_of); \
+    uint8_t shifted[sizeof(validity)]; \
+    \
+    Builder* one = name##_builder_create create_args; \
+    for (size_t i = 0; i < COUNT - 100; i++) { \
+        CHECK_EQ(row_valid(i) ? name##_builder_append(one, values[i]) : name##_builder_append_null(one), 0); \
+    } \
+    for (size_t i = COUNT - 100; i < COUNT; i++) CHECK_EQ(name##_builder_append(one, values[i]), 0); \
+    \
+    Builder* bulk = name##_builder_create create_args; \
+    for (size_t i = 0; i < 3; i++) { \
+        CHECK_EQ(row_valid(i) ? name##_builder_append(bulk, values[i]) : name##_builder_append_null(bulk), 0); \
+    } \
+    CHECK_EQ(name##_builder_append_values(bulk, values + 3, 510, validity_from(3, shifted)), 0); \
+    CHECK_EQ(name##_builder_append_values(bulk, values + 513, 0, NULL), 0); \
+    CHECK_EQ(name##_builder_append(bulk, values[513]), 0); \
+    CHECK_EQ(name##_builder_append_values(bulk, values + 514, COUNT - 614, validity_from(514, shifted)), 0); \
+    CHECK_EQ(name##_builder_append_values(bulk, values + COUNT - 100, 100, NULL), 0); \
+    \
+    check_same(name##_builder_finish(one), name##_builder_finish(bulk), 1, sizeof(ctype)); \
+    name##_builder_free(one); \
+    name##_builder_free(bulk); \
+}
+
+TEST_FIXED(int8, Int8Builder, int8_t, (0), i * 7)
+TEST_FIXED(int16, Int16Builder, int16_t, (0), i * 301)
+TEST_FIXED(int32, Int32Builder, int32_t, (16), i * 100003)
+TEST_FIXED(int64, Int64Builder, int64_t, (0), i * 1000000007LL)
+TEST_FIXED(uint8, UInt8Builder, uint8_t, (0), i)
+TEST_FIXED(uint16, UInt16Builder, uint16_t, (0), i * 61)
+TEST_FIXED(uint32, UInt32Builder, uint32_t, (0), i * 4000037u)
+TEST_FIXED(uint64, UInt64Builder, uint64_t, (0), i * 0x9E3779B97F4A7C15ULL)
+TEST_FIXED(float32, Float32Builder, float, (0), i * 0.25f)
+TEST_FIXED(float64, Float64Builder, double, (0), i * -1.5)
+TEST_FIXED(timestamp, TimestampBuilder, int64_t, (0, "UTC"), 1700000000000000LL + i)
+TEST_FIXED(date32, Date32Builder, int32_t, (0), 19000 + i)
+TEST_FIXED(date64, Date64Builder, int64_t, (0), 1700000000000LL + i * 86400000LL)
+TEST_FIXED(time32, Time32Builder, int32_t, (0, 's'), i * 60)
+TEST_FIXED(time64, Time64Builder, int64_t, (0, 'u'), i * 1000)
+TEST_FIXED(duration, DurationBuilder, int64_t, (0, 'n'), i * 3)
+
+// Booleans come in as packed bits
+static void test_bool(void) {
+    uint8_t bits[(COUNT + 7) / 8] = {0};
+    for (size_t i = 0; i < COUNT; i++) {
+        if (i % 3 == 0) bits[i / 8] |= (uint8_t)(1u << (i % 8));
+    }
+    BoolBuilder* one = bool_builder_create(0);
+    for (size_t i = 0; i < COUNT; i++) {
+        CHECK_EQ(row_valid(i) ? bool_builder_append(one, i % 3 == 0) : bool_builder_append_null(one), 0);
+    }
+
+    BoolBuilder* bulk = bool_builder_create(0);
+    uint8_t shifted_bits[sizeof(bits)];
+    uint8_t shifted[sizeof(validity)];
+    CHECK_EQ(bool_builder_append(bulk, true), 0);
+    CHECK_EQ(bool_builder_append(bulk, false), 0);
+    memset(shifted_bits, 0, sizeof(shifted_bits));
+    for (size_t i = 2; i < COUNT; i++) {
+        if (i % 3 == 0) shifted_bits[(i - 2) / 8] |= (uint8_t)(1u << ((i - 2) % 8));
+    }
+    CHECK_EQ(bool_builder_append_values(bulk, shifted_bits, COUNT - 2, validity_from(2, shifted)), 0);
+    check_same(bool_builder_finish(one), bool_builder_finish(bulk), 1, 0);
+    bool_builder_free(one);
+    bool_builder_free(bulk);
+}
+
+// Strings and binaries come in as (offsets, data); source offsets need not
+// start at 0
+static void test_strings(void) {
+    static char data[COUNT * 8];
+    static int32_t offsets[COUNT + 1];
+    static int64_t large_offsets[COUNT + 1];
+    int32_t pos = 5;
+    for (size_t i = 0; i < COUNT; i++) {
+        offsets[i] = pos;
+        large_offsets[i] = pos;
+        if (row_valid(i)) pos += sprintf(data + pos, "s%zu", i * 13);
+    }
+    offsets[COUNT] = pos;
+    large_offsets[COUNT] = pos;
+    uint8_t shifted[sizeof(validity)];
+
+    StringBuilder* one = string_builder_create(0, 0);
+    StringBuilder* bulk = string_builder_create(4, 8);
+    LargeStringBuilder* large = large_string_builder_create(0, 0);
+    BinaryBuilder* binary = binary_builder_create(0, 0);
+    LargeBinaryBuilder* large_binary = large_binary_builder_create(0, 0);
+    for (size_t i = 0; i < COUNT; i++) {
+        size_t len = (size_t)(offsets[i + 1] - offsets[i]);
+        CHECK_EQ(row_valid(i) ? string_builder_append(one, data + offsets[i], len) : string_builder_append_null(one), 0);
+    }
+    CHECK_EQ(string_builder_append(bulk, data + offsets[0], (size_t)(offsets[1] - offsets[0])), 0);
+    CHECK_EQ(string_builder_append_values(bulk, offsets + 1, data, COUNT - 1, validity_from(1, shifted)), 0);
+    CHECK_EQ(large_string_builder_append_values(large, large_offsets, data, COUNT, validity), 0);
+    CHECK_EQ(binary_builder_append_values(binary, offsets, (const uint8_t*)data, COUNT, validity), 0);
+    CHECK_EQ(large_binary_builder_append_values(large_binary, large_offsets, (const uint8_t*)data, COUNT,
+                                                validity), 0);
+
+    struct ArrowArray* results[] = {
+        string_builder_finish(one), string_builder_finish(bulk), large_string_builder_finish(large),
+        binary_builder_finish(binary), large_binary_builder_finish(large_binary)
+    };
+    int wide[] = {0, 0, 1, 0, 1};
+    for (int r = 0; r < 5; r++) {
+        struct ArrowArray* a = results[r];
+        CHECK_EQ(a->length, COUNT);
+        CHECK_EQ(a->null_count, COUNT / 5);
+        for (int64_t i = 0; i < COUNT; i++) {
+            CHECK_EQ(test_bit(a->buffers[0], i), row_valid((size_t)i));
+            int64_t start = wide[r] ? ((const int64_t*)a->buffers[1])[i] : ((const int32_t*)a->buffers[1])[i];
+            int64_t end = wide[r] ? ((const int64_t*)a->buffers[1])[i + 1] : ((const int32_t*)a->buffers[1])[i + 1];
+            CHECK_EQ(end - start, offsets[i + 1] - offsets[i]);
+            CHECK(memcmp((const char*)a->buffers[2] + start, data + offsets[i], (size_t)(end - start)) == 0);
+        }
+        a->release(a);
+        free(a);
+    }
+    string_builder_free(one);
+    string_builder_free(bulk);
+    large_string_builder_free(large);
+    binary_builder_free(binary);
+    large_binary_builder_free(large_binary);
+}
+
+int main(void) {
+    printf("test_builder_bulk\n");
+    init_validity();
+    RUN_TEST(test_int8);
+    RUN_TEST(test_int16);
+    RUN_TEST(test_int32);
+    RUN_TEST(test_int64);
+    RUN_TEST(test_uint8);
+    RUN_TEST(test_uint16);
+    RUN_TEST(test_uint32);
+    RUN_TEST(test_uint64);
+    RUN_TEST(test_float32);
+    RUN_TEST(test_float64);
+    RUN_TEST(test_timestamp);
+    RUN_TEST(test_date32);
+    RUN_TEST(test_date64);
+    RUN_TEST(test_time32);
+    RUN_TEST(test_time64);
+    RUN_TEST(test_duration);
+    RUN_TEST(test_bool);
+    RUN_TEST(test_strings);
+    return 0;
+}
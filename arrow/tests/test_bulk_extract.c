@@ -0,0 +1,106 @@
+/**
+ * test_bulk_extract.c - Bulk extraction of column ranges (validity bytes,
+ * fixed-width values, string references)
+ */
+
+#include "test_util.h"
+#include "arrow_wrapper.h"
+#include "arrow_builders.h"
+
+#define COUNT 100
+
+static void test_fixed_range(void) {
+    int64_t values[COUNT];
+    uint8_t validity[(COUNT + 7) / 8] = {0};
+    for (int i = 0; i < COUNT; i++) {
+        values[i] = i * 11;
+        if (i % 4 != 1) validity[i / 8] |= (uint8_t)(1u << (i % 8));
+    }
+    const void* buffers[] = {validity, values};
+    struct ArrowArray array = test_array(COUNT, 2, buffers, 0, NULL);
+
+    // A slice starting at an odd bit, extracted from an inner range
+    array.offset = 13;
+    array.length = 60;
+    uint8_t valid[40];
+    int64_t got[40];
+    size_t nulls = arrow_copy_validity_bytes(&array, 7, 40, valid);
+    CHECK(arrow_copy_fixed_values(&array, sizeof(int64_t), 7, 40, got));
+    size_t expected_nulls = 0;
+    for (int k = 0; k < 40; k++) {
+        int i = 13 + 7 + k;
+        CHECK_EQ(valid[k], i % 4 != 1);
+        expected_nulls += i % 4 == 1;
+        CHECK_EQ(got[k], values[i]);
+    }
+    CHECK_EQ(nulls, expected_nulls);
+
+    // No validity buffer: every value is valid
+    buffers[0] = NULL;
+    array.null_count = 0;
+    CHECK_EQ(arrow_copy_validity_bytes(&array, 0, 40, valid), 0);
+    for (int k = 0; k < 40; k++) CHECK_EQ(valid[k], 1);
+}
+
+static void test_bounds(void) {
+    int64_t values[4] = {1, 2, 3, 4};
+    const void* buffers[] = {NULL, values};
+    struct ArrowArray array = test_array(4, 2, buffers, 0, NULL);
+    int64_t out[5];
+    CHECK(arrow_range_in_bounds(&array, 0, 4));
+    CHECK(arrow_range_in_bounds(&array, 4, 0));
+    CHECK(!arrow_range_in_bounds(&array, 3, 2));
+    CHECK(!arrow_range_in_bounds(&array, 5, 0));
+    CHECK(!arrow_range_in_bounds(&array, 1, SIZE_MAX));
+    CHECK(!arrow_range_in_bounds(NULL, 0, 0));
+    CHECK(!arrow_copy_fixed_values(&array, sizeof(int64_t), 2, 3, out));
+    CHECK(arrow_copy_fixed_values(&array, sizeof(int64_t), 4, 0, out));
+}
+
+// The same strings through each layout, from a slice
+static void test_string_refs(void) {
+    StringBuilder* utf8 = string_builder_create(0, 0);
+    LargeStringBuilder* large = large_string_builder_create(0, 0);
+    StringViewBuilder* view = string_view_builder_create(0, 0);
+    char value[64];
+    for (int i = 0; i < COUNT; i++) {
+        int len = i % 2 ? sprintf(value, "k%d", i) : sprintf(value, "a-longer-value-%d", i);
+        CHECK_EQ(string_builder_append(utf8, value, (size_t)len), 0);
+        CHECK_EQ(large_string_builder_append(large, value, (size_t)len), 0);
+        CHECK_EQ(string_view_builder_append(view, value, (size_t)len), 0);
+    }
+    struct ArrowArray* arrays[] = {
+        string_builder_finish(utf8), large_string_builder_finish(large), string_view_builder_finish(view)
+    };
+    char layouts[] = {'u', 'U', 'v'};
+    for (int a = 0; a < 3; a++) {
+        arrays[a]->offset = 30;
+        arrays[a]->length = 50;
+        for (int k = 0; k < 50; k++) {
+            int i = 30 + k;
+            int len = i % 2 ? sprintf(value, "k%d", i) : sprintf(value, "a-longer-value-%d", i);
+            const char* data = NULL;
+            size_t got_len = 0;
+            CHECK(arrow_get_string_ref(arrays[a], layouts[a], (size_t)k, &data, &got_len));
+            CHECK_EQ(got_len, (size_t)len);
+            CHECK(memcmp(data, value, got_len) == 0);
+        }
+        const char* data = NULL;
+        size_t got_len = 0;
+        CHECK(!arrow_get_string_ref(arrays[a], layouts[a], 50, &data, &got_len));
+        CHECK(!arrow_get_string_ref(arrays[a], 'x', 0, &data, &got_len));
+        arrays[a]->release(arrays[a]);
+        free(arrays[a]);
+    }
+    string_builder_free(utf8);
+    large_string_builder_free(large);
+    string_view_builder_free(view);
+}
+
+int main(void) {
+    printf("test_bulk_extract\n");
+    RUN_TEST(test_fixed_range);
+    RUN_TEST(test_bounds);
+    RUN_TEST(test_string_refs);
+    return 0;
+}
@@ -0,0 +1,233 @@
+/**
+ * test_chunked_compute.c - Chunk-wise and morsel-parallel kernels against
+ * the single-array kernels over the same rows
+ */
+
+#include "test_util.h"
+#include "arrow_chunked_compute.h"
+#include "arrow_thread_pool.h"
+#include <math.h>
+
+// Over three morsels, so the parallel paths really split
+#define ROWS 200003
+
+static int64_t ints[ROWS];
+static double floats[ROWS];
+static uint8_t validity[(ROWS + 7) / 8];     // null when i % 7 == 0
+static uint8_t mask_bits[(ROWS + 7) / 8];    // true when i % 3 == 1
+static const void* int_buffers[2];
+static const void* float_buffers[2];
+static const void* mask_buffers[2];
+static struct ArrowArray whole_ints;
+static struct ArrowArray whole_floats;
+static struct ArrowArray whole_mask;
+
+static void init_data(void) {
+    memset(validity, 0, sizeof(validity));
+    memset(mask_bits, 0, sizeof(mask_bits));
+    for (int64_t i = 0; i < ROWS; i++) {
+        ints[i] = (i * 7919) % 100003 - 50000;
+        floats[i] = (double)ints[i] * 0.125;
+        if (i % 7 != 0) validity[i / 8] |= (uint8_t)(1u << (i % 8));
+        if (i % 3 == 1) mask_bits[i / 8] |= (uint8_t)(1u << (i % 8));
+    }
+    int_buffers[0] = validity;
+    int_buffers[1] = ints;
+    float_buffers[0] = validity;
+    float_buffers[1] = floats;
+    mask_buffers[0] = NULL;
+    mask_buffers[1] = mask_bits;
+    whole_ints = test_array(ROWS, 2, int_buffers, 0, NULL);
+    whole_ints.null_count = (ROWS + 6) / 7;
+    whole_floats = test_array(ROWS, 2, float_buffers, 0, NULL);
+    whole_floats.null_count = (ROWS + 6) / 7;
+    whole_mask = test_array(ROWS, 2, mask_buffers, 0, NULL);
+}
+
+// An owned copy of rows [start, start + length) of a fixed-width array
+// (`width` 0: bit-packed values)
+typedef struct {
+    void* buffers[2];
+} OwnedBuffers;
+
+static void release_owned(struct ArrowArray* array) {
+    OwnedBuffers* owned = array->private_data;
+    free(owned->buffers[0]);
+    free(owned->buffers[1]);
+    free(owned);
+    array->release = NULL;
+}
+
+static void copy_bits(uint8_t* dst, const uint8_t* src, int64_t start, int64_t length) {
+    for (int64_t i = 0; i < length; i++) {
+        if (test_bit(src, start + i)) dst[i / 8] |= (uint8_t)(1u << (i % 8));
+    }
+}
+
+static struct ArrowArray* copy_range(const struct ArrowArray* src, size_t width, int64_t start, int64_t length) {
+    struct ArrowArray* array = calloc(1, sizeof(struct ArrowArray));
+    OwnedBuffers* owned = calloc(1, sizeof(OwnedBuffers));
+    CHECK(array != NULL && owned != NULL);
+    size_t bitmap_bytes = (size_t)(length + 8) / 8;
+    if (src->buffers[0]) {
+        owned->buffers[0] = calloc(1, bitmap_bytes);
+        copy_bits(owned->buffers[0], src->buffers[0], start, length);
+        array->null_count = -1;
+    }
+    if (width) {
+        owned->buffers[1] = malloc((size_t)length * width + 1);
+        memcpy(owned->buffers[1], (const uint8_t*)src->buffers[1] + (size_t)start * width, (size_t)length * width);
+    } else {
+        owned->buffers[1] = calloc(1, bitmap_bytes);
+        copy_bits(owned->buffers[1], src->buffers[1], start, length);
+    }
+    array->length = length;
+    array->n_buffers = 2;
+    array->buffers = (const void**)owned->buffers;
+    array->private_data = owned;
+    array->release = release_owned;
+    return array;
+}
+
+// `src` split at the given row boundaries
+static ChunkedArray* split(const struct ArrowArray* src, const char* format, size_t width,
+                           const int64_t* bounds, size_t num_bounds) {
+    struct ArrowSchema type = test_schema(format, "", 0, NULL);
+    ChunkedArray* ca = chunked_array_create(&type);
+    CHECK(ca != NULL);
+    int64_t start = 0;
+    for (size_t k = 0; k <= num_bounds; k++) {
+        int64_t end = k < num_bounds ? bounds[k] : src->length;
+        CHECK_EQ(chunked_array_add_chunk(ca, copy_range(src, width, start, end - start)), 0);
+        start = end;
+    }
+    return ca;
+}
+
+static const int64_t bounds_a[] = {1000, 1001, 70000, 150000};
+static const int64_t bounds_b[] = {3, 65536, 131072};
+#define SPLIT(src, format, width, bounds) split(src, format, width, bounds, sizeof(bounds) / sizeof(bounds[0]))
+
+// Row by row, a ChunkedArray result equals a single-array result
+static void check_same_int64(ChunkedArray* ca, struct ArrowArray* expected) {
+    CHECK(ca != NULL && expected != NULL);
+    CHECK_EQ(chunked_array_length(ca), expected->length);
+    int64_t row = 0;
+    for (size_t k = 0; k < chunked_array_num_chunks(ca); k++) {
+        struct ArrowArray* chunk = chunked_array_get_chunk(ca, k);
+        const int64_t* values = (const int64_t*)chunk->buffers[1];
+        const int64_t* want = (const int64_t*)expected->buffers[1];
+        for (int64_t i = 0; i < chunk->length; i++, row++) {
+            int valid = !chunk->buffers[0] || test_bit(chunk->buffers[0], chunk->offset + i);
+            int want_valid = !expected->buffers[0] || test_bit(expected->buffers[0], expected->offset + row);
+            CHECK_EQ(valid, want_valid);
+            if (valid) CHECK_EQ(values[chunk->offset + i], want[expected->offset + row]);
+        }
+    }
+    CHECK_EQ(row, expected->length);
+    expected->release(expected);
+    free(expected);
+    chunked_array_free(ca);
+}
+
+static void check_close(double got, double want) {
+    CHECK(fabs(got - want) <= 1e-9 * (fabs(want) + 1.0));
+}
+
+static struct ArrowArray* triple(struct ArrowArray* chunk, void* ctx) {
+    return arrow_multiply_scalar_int64(chunk, *(const int64_t*)ctx);
+}
+
+static void run_chunked(const ArrowChunkedExecOptions* options) {
+    ChunkedArray* a = SPLIT(&whole_ints, "l", sizeof(int64_t), bounds_a);
+    ChunkedArray* b = SPLIT(&whole_ints, "l", sizeof(int64_t), bounds_b);
+    ChunkedArray* f = SPLIT(&whole_floats, "g", sizeof(double), bounds_b);
+    ChunkedArray* mask = SPLIT(&whole_mask, "b", 0, bounds_b);
+
+    // Aggregates merge per-chunk partials
+    CHECK_EQ(arrow_chunked_sum_int64(a, options).i64_value, arrow_sum_int64(&whole_ints).i64_value);
+    CHECK_EQ(arrow_chunked_min_int64(a, options).i64_value, arrow_min_int64(&whole_ints).i64_value);
+    CHECK_EQ(arrow_chunked_max_int64(a, options).i64_value, arrow_max_int64(&whole_ints).i64_value);
+    check_close(arrow_chunked_mean_int64(a, options).f64_value, arrow_mean_int64(&whole_ints).f64_value);
+    check_close(arrow_chunked_sum_float64(f, options).f64_value, arrow_sum_float64(&whole_floats).f64_value);
+    check_close(arrow_chunked_variance_float64(f, options).f64_value,
+                arrow_variance_float64(&whole_floats).f64_value);
+    check_close(arrow_chunked_stddev_float64(f, options).f64_value,
+                arrow_stddev_float64(&whole_floats).f64_value);
+    CHECK_EQ(arrow_chunked_count(a), ROWS - (ROWS + 6) / 7);
+    CHECK(arrow_chunked_any(mask, options));
+    CHECK(!arrow_chunked_all(mask, options));
+
+    // Element-wise, including inputs whose chunk boundaries differ
+    int64_t three = 3;
+    check_same_int64(arrow_chunked_map(a, triple, &three, "l", options),
+                     arrow_multiply_scalar_int64(&whole_ints, 3));
+    check_same_int64(arrow_chunked_binary(a, b, arrow_add_int64, "l", options),
+                     arrow_add_int64(&whole_ints, &whole_ints));
+    check_same_int64(arrow_chunked_filter(a, mask, arrow_filter_int64, options),
+                     arrow_filter_int64(&whole_ints, &whole_mask));
+
+    // Take: a sorted run crossing chunks, then scattered indices
+    enum { TAKE = 5000 };
+    static int32_t indices[TAKE];
+    for (int32_t i = 0; i < TAKE; i++) {
+        indices[i] = i < TAKE / 2 ? 999 + i : (int32_t)(((int64_t)i * 104729) % ROWS);
+    }
+    const void* index_buffers[] = {NULL, indices};
+    struct ArrowArray index_array = test_array(TAKE, 2, index_buffers, 0, NULL);
+    check_same_int64(arrow_chunked_take(a, &index_array, arrow_take_int64, options),
+                     arrow_take_int64(&whole_ints, &index_array));
+
+    chunked_array_free(a);
+    chunked_array_free(b);
+    chunked_array_free(f);
+    chunked_array_free(mask);
+}
+
+static void test_chunked_sequential(void) {
+    run_chunked(NULL);
+}
+
+static void test_chunked_parallel(void) {
+    ArrowChunkedExecOptions options = {4};
+    run_chunked(&options);
+}
+
+// Chunks whose lengths differ: the binary kernel rejects them
+static void test_length_mismatch(void) {
+    ChunkedArray* a = SPLIT(&whole_ints, "l", sizeof(int64_t), bounds_a);
+    ChunkedArray* shorter = chunked_array_slice(a, 0, ROWS - 1);
+    CHECK(arrow_chunked_binary(a, shorter, arrow_add_int64, "l", NULL) == NULL);
+    chunked_array_free(shorter);
+    chunked_array_free(a);
+}
+
+// A single array split into morsels
+static void test_parallel_single_array(void) {
+    CHECK_EQ(arrow_parallel_sum_int64(&whole_ints).i64_value, arrow_sum_int64(&whole_ints).i64_value);
+    CHECK_EQ(arrow_parallel_min_int64(&whole_ints).i64_value, arrow_min_int64(&whole_ints).i64_value);
+    CHECK_EQ(arrow_parallel_max_float64(&whole_floats).f64_value, arrow_max_float64(&whole_floats).f64_value);
+    check_close(arrow_parallel_mean_float64(&whole_floats).f64_value, arrow_mean_float64(&whole_floats).f64_value);
+    check_close(arrow_parallel_variance_float64(&whole_floats).f64_value,
+                arrow_variance_float64(&whole_floats).f64_value);
+    CHECK(arrow_parallel_any(&whole_mask));
+    CHECK(!arrow_parallel_all(&whole_mask));
+
+    ChunkedArray* doubled = arrow_parallel_binary(&whole_ints, &whole_ints, arrow_add_int64, "l");
+    CHECK(doubled != NULL);
+    CHECK(chunked_array_num_chunks(doubled) > 1);
+    check_same_int64(doubled, arrow_add_int64(&whole_ints, &whole_ints));
+    check_same_int64(arrow_parallel_filter(&whole_ints, &whole_mask, arrow_filter_int64, "l"),
+                     arrow_filter_int64(&whole_ints, &whole_mask));
+}
+
+int main(void) {
+    printf("test_chunked_compute\n");
+    init_data();
+    CHECK_EQ(arrow_thread_pool_set_threads(4), 0);
+    RUN_TEST(test_chunked_sequential);
+    RUN_TEST(test_chunked_parallel);
+    RUN_TEST(test_length_mismatch);
+    RUN_TEST(test_parallel_single_array);
+    return 0;
+}
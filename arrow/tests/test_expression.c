@@ -0,0 +1,251 @@
+/**
+ * test_expression.c - Fused expressions against the composed compute kernels
+ * and a row-by-row reference: arithmetic, null propagation, Kleene logic,
+ * string predicates, casts and type errors
+ */
+
+#include "test_util.h"
+#include "arrow_compute.h"
+#include "arrow_expression.h"
+
+// Several evaluation blocks and a ragged last one
+#define ROWS (4 * ARROW_EXPR_BLOCK_ROWS + 3)
+
+static double a_values[ROWS];                   // column 0 "a", null when i % 11 == 0
+static double b_values[ROWS];                   // column 1 "b"
+static int32_t k_values[ROWS];                  // column 2 "k", widened to int64
+static int32_t s_offsets[ROWS + 1];             // column 3 "s", apple/banana/cherry
+static char s_data[ROWS * 6];
+static uint8_t a_validity[(ROWS + 7) / 8];
+
+static const void* a_buffers[2];
+static const void* b_buffers[2];
+static const void* k_buffers[2];
+static const void* s_buffers[3];
+static const void* batch_buffers[1];
+static struct ArrowArray columns[4];
+static struct ArrowArray* column_ptrs[4];
+static struct ArrowArray batch;
+static struct ArrowSchema fields[4];
+static struct ArrowSchema* field_ptrs[4];
+static struct ArrowSchema schema;
+
+static const char* const words[] = {"apple", "banana", "cherry"};
+
+static void init_data(void) {
+    memset(a_validity, 0, sizeof(a_validity));
+    int32_t pos = 0;
+    for (int64_t i = 0; i < ROWS; i++) {
+        a_values[i] = (double)(i % 97) * 0.5;
+        b_values[i] = (double)(i % 13) - 3.0;
+        k_values[i] = (int32_t)(i % 7) - 3;
+        if (i % 11 != 0) a_validity[i / 8] |= (uint8_t)(1u << (i % 8));
+        s_offsets[i] = pos;
+        size_t len = strlen(words[i % 3]);
+        memcpy(s_data + pos, words[i % 3], len);
+        pos += (int32_t)len;
+    }
+    s_offsets[ROWS] = pos;
+
+    a_buffers[0] = a_validity;
+    a_buffers[1] = a_values;
+    b_buffers[1] = b_values;
+    k_buffers[1] = k_values;
+    s_buffers[1] = s_offsets;
+    s_buffers[2] = s_data;
+    columns[0] = test_array(ROWS, 2, a_buffers, 0, NULL);
+    columns[1] = test_array(ROWS, 2, b_buffers, 0, NULL);
+    columns[2] = test_array(ROWS, 2, k_buffers, 0, NULL);
+    columns[3] = test_array(ROWS, 3, s_buffers, 0, NULL);
+    fields[0] = test_schema("g", "a", 0, NULL);
+    fields[1] = test_schema("g", "b", 0, NULL);
+    fields[2] = test_schema("i", "k", 0, NULL);
+    fields[3] = test_schema("u", "s", 0, NULL);
+    for (int c = 0; c < 4; c++) {
+        column_ptrs[c] = &columns[c];
+        field_ptrs[c] = &fields[c];
+    }
+    batch = test_array(ROWS, 1, batch_buffers, 4, column_ptrs);
+    schema = test_schema("+s", "", 4, field_ptrs);
+}
+
+static int a_valid(int64_t i) {
+    return test_bit(a_validity, i);
+}
+
+// Evaluate, check the result format and length, and free the expression
+static struct ArrowArray* evaluate(ArrowExpr* expr, const char* format) {
+    CHECK(expr != NULL);
+    const char* out_format = NULL;
+    struct ArrowArray* result = arrow_expr_evaluate(expr, &schema, &batch, &out_format);
+    arrow_expr_free(expr);
+    CHECK(result != NULL);
+    CHECK(strcmp(out_format, format) == 0);
+    CHECK_EQ(result->length, ROWS);
+    return result;
+}
+
+static int result_valid(const struct ArrowArray* result, int64_t i) {
+    return !result->buffers[0] || test_bit(result->buffers[0], i);
+}
+
+// (a * 2 + b) > 10 in one pass equals the chain of kernels it replaces. The
+// scalar kernels leave null rows false without a validity bitmap, so only
+// valid rows are compared with them.
+static void test_matches_kernels(void) {
+    ArrowExpr* expr = arrow_expr_binary(
+        ARROW_EXPR_GT,
+        arrow_expr_binary(ARROW_EXPR_ADD,
+                          arrow_expr_binary(ARROW_EXPR_MULTIPLY, arrow_expr_column_named("a"),
+                                            arrow_expr_literal_float64(2.0)),
+                          arrow_expr_column(1)),
+        arrow_expr_literal_float64(10.0));
+    struct ArrowArray* fused = evaluate(expr, "b");
+
+    struct ArrowArray* doubled = arrow_multiply_scalar_float64(&columns[0], 2.0);
+    struct ArrowArray* sum = arrow_add_float64(doubled, &columns[1]);
+    struct ArrowArray* composed = arrow_gt_scalar_float64(sum, 10.0);
+    CHECK(composed != NULL);
+
+    int64_t nulls = 0;
+    for (int64_t i = 0; i < ROWS; i++) {
+        int valid = a_valid(i);
+        nulls += !valid;
+        CHECK_EQ(result_valid(fused, i), valid);
+        if (!valid) continue;
+        CHECK_EQ(test_bit(fused->buffers[1], i), test_bit(composed->buffers[1], i));
+        CHECK_EQ(test_bit(fused->buffers[1], i), a_values[i] * 2 + b_values[i] > 10);
+    }
+    CHECK_EQ(fused->null_count, nulls);
+
+    arrow_compute_array_free(fused);
+    arrow_compute_array_free(doubled);
+    arrow_compute_array_free(sum);
+    arrow_compute_array_free(composed);
+}
+
+// Int32 columns widen to int64; integer division by zero is null
+static void test_integer_division(void) {
+    ArrowExpr* expr = arrow_expr_binary(
+        ARROW_EXPR_DIVIDE,
+        arrow_expr_binary(ARROW_EXPR_ADD, arrow_expr_column(2), arrow_expr_literal_int64(1)),
+        arrow_expr_column_named("k"));
+    struct ArrowArray* result = evaluate(expr, "l");
+    const int64_t* values = (const int64_t*)result->buffers[1];
+    for (int64_t i = 0; i < ROWS; i++) {
+        int64_t k = k_values[i];
+        CHECK_EQ(result_valid(result, i), k != 0);
+        if (k != 0) CHECK_EQ(values[i], (k + 1) / k);
+    }
+    arrow_compute_array_free(result);
+}
+
+// A float64 column compared with an int64 literal promotes the literal
+static void test_mixed_promotion(void) {
+    ArrowExpr* expr = arrow_expr_binary(ARROW_EXPR_GT, arrow_expr_column(0), arrow_expr_literal_int64(40));
+    struct ArrowArray* result = evaluate(expr, "b");
+    for (int64_t i = 0; i < ROWS; i++) {
+        if (a_valid(i)) CHECK_EQ(test_bit(result->buffers[1], i), a_values[i] > 40);
+    }
+    arrow_compute_array_free(result);
+}
+
+static void test_string_predicates(void) {
+    struct ArrowArray* starts = evaluate(
+        arrow_expr_string_predicate(ARROW_EXPR_STARTS_WITH, arrow_expr_column_named("s"), "ba"), "b");
+    struct ArrowArray* ends = evaluate(
+        arrow_expr_string_predicate(ARROW_EXPR_ENDS_WITH, arrow_expr_column(3), "rry"), "b");
+    struct ArrowArray* contains = evaluate(
+        arrow_expr_string_predicate(ARROW_EXPR_CONTAINS, arrow_expr_column(3), "pl"), "b");
+    struct ArrowArray* equal = evaluate(
+        arrow_expr_binary(ARROW_EXPR_NE, arrow_expr_column(3), arrow_expr_literal_string("banana")), "b");
+    for (int64_t i = 0; i < ROWS; i++) {
+        CHECK_EQ(test_bit(starts->buffers[1], i), i % 3 == 1);
+        CHECK_EQ(test_bit(ends->buffers[1], i), i % 3 == 2);
+        CHECK_EQ(test_bit(contains->buffers[1], i), i % 3 == 0);
+        CHECK_EQ(test_bit(equal->buffers[1], i), i % 3 != 1);
+    }
+    arrow_compute_array_free(starts);
+    arrow_compute_array_free(ends);
+    arrow_compute_array_free(contains);
+    arrow_compute_array_free(equal);
+}
+
+// OR is true when either side is true, even if the other is null; AND with
+// a never-null operand
+static void test_kleene_logic(void) {
+    ArrowExpr* expr = arrow_expr_binary(
+        ARROW_EXPR_OR,
+        arrow_expr_string_predicate(ARROW_EXPR_STARTS_WITH, arrow_expr_column(3), "ba"),
+        arrow_expr_binary(ARROW_EXPR_GT, arrow_expr_column(0), arrow_expr_literal_int64(40)));
+    struct ArrowArray* result = evaluate(expr, "b");
+    for (int64_t i = 0; i < ROWS; i++) {
+        int banana = i % 3 == 1;
+        int valid = banana || a_valid(i);
+        CHECK_EQ(result_valid(result, i), valid);
+        if (valid) CHECK_EQ(test_bit(result->buffers[1], i), banana || a_values[i] > 40);
+    }
+    arrow_compute_array_free(result);
+
+    expr = arrow_expr_binary(
+        ARROW_EXPR_AND,
+        arrow_expr_binary(ARROW_EXPR_EQ, arrow_expr_column(3), arrow_expr_literal_string("apple")),
+        arrow_expr_unary(ARROW_EXPR_NOT, arrow_expr_unary(ARROW_EXPR_IS_NULL, arrow_expr_column(0))));
+    result = evaluate(expr, "b");
+    CHECK_EQ(result->null_count, 0);
+    for (int64_t i = 0; i < ROWS; i++) {
+        CHECK(result_valid(result, i));
+        CHECK_EQ(test_bit(result->buffers[1], i), i % 3 == 0 && a_valid(i));
+    }
+    arrow_compute_array_free(result);
+}
+
+// Unary arithmetic and a float-to-int cast; non-finite values cast to null
+static void test_unary_and_cast(void) {
+    ArrowExpr* expr = arrow_expr_cast(
+        arrow_expr_unary(ARROW_EXPR_ABS, arrow_expr_unary(ARROW_EXPR_NEGATE, arrow_expr_column(1))),
+        ARROW_EXPR_TYPE_INT64);
+    struct ArrowArray* result = evaluate(expr, "l");
+    for (int64_t i = 0; i < ROWS; i++) {
+        CHECK(result_valid(result, i));
+        double b = b_values[i];
+        CHECK_EQ(((const int64_t*)result->buffers[1])[i], (int64_t)(b < 0 ? -b : b));
+    }
+    arrow_compute_array_free(result);
+
+    expr = arrow_expr_cast(
+        arrow_expr_binary(ARROW_EXPR_DIVIDE, arrow_expr_column(0), arrow_expr_literal_float64(0.0)),
+        ARROW_EXPR_TYPE_INT64);
+    result = evaluate(expr, "l");
+    CHECK_EQ(result->null_count, ROWS);
+    arrow_compute_array_free(result);
+}
+
+// Expressions that do not type-check return NULL
+static void test_type_errors(void) {
+    ArrowExpr* errors[] = {
+        arrow_expr_binary(ARROW_EXPR_ADD, arrow_expr_column(3), arrow_expr_literal_int64(1)),
+        arrow_expr_binary(ARROW_EXPR_LT, arrow_expr_column(3), arrow_expr_literal_string("b")),
+        arrow_expr_string_predicate(ARROW_EXPR_CONTAINS, arrow_expr_column(0), "x"),
+        arrow_expr_column(4),
+        arrow_expr_column_named("missing"),
+    };
+    for (size_t e = 0; e < sizeof(errors) / sizeof(errors[0]); e++) {
+        CHECK(errors[e] != NULL);
+        CHECK(arrow_expr_evaluate(errors[e], &schema, &batch, NULL) == NULL);
+        arrow_expr_free(errors[e]);
+    }
+}
+
+int main(void) {
+    printf("test_expression\n");
+    init_data();
+    RUN_TEST(test_matches_kernels);
+    RUN_TEST(test_integer_division);
+    RUN_TEST(test_mixed_promotion);
+    RUN_TEST(test_string_predicates);
+    RUN_TEST(test_kleene_logic);
+    RUN_TEST(test_unary_and_cast);
+    RUN_TEST(test_type_errors);
+    return 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * test_ipc_alignment.c - 64-byte aligned buffer layout of IPC batches
+ */
+
+#include "test_batch.h"
+#include "arrow_ipc.h"
+
+static uint32_t load_u32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+// Every buffer of a zero-copy result sits on a 64-byte boundary of the blob
+static void check_aligned(const struct ArrowArray* array, const uint8_t* data, size_t size) {
+    for (int64_t i = 0; i < array->n_buffers; i++) {
+        const uint8_t* p = (const uint8_t*)array->buffers[i];
+        if (p && p >= data && p < data + size) {
+            CHECK_EQ((size_t)(p - data) % ARROW_IPC_ALIGNMENT, 0);
+        }
+    }
+    for (int64_t i = 0; i < array->n_children; i++) {
+        check_aligned(array->children[i], data, size);
+    }
+}
+
+static void test_aligned_layout(void) {
+    static TestBatch b;
+    test_batch_init(&b, 333, 2);
+
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch(&b.schema, &b.array, &data, &size), ARROW_IPC_OK);
+    CHECK_EQ((uintptr_t)data % ARROW_IPC_ALIGNMENT, 0);
+    CHECK_EQ(load_u32(data), ARROW_IPC_MAGIC_BATCH);
+    CHECK_EQ(load_u32(data + 4), ARROW_IPC_VERSION);
+
+    struct ArrowSchema schema;
+    struct ArrowArray array;
+    CHECK_EQ(arrow_ipc_deserialize_batch_zero_copy(data, size, NULL, NULL, &schema, &array), ARROW_IPC_OK);
+    check_aligned(&array, data, size);
+    test_batch_check(&schema, &array, 2, 333);
+    array.release(&array);
+    schema.release(&schema);
+    free(data);
+}
+
+// The size is known up front, and serializing into caller memory gives the
+// same bytes
+static void test_serialize_into(void) {
+    static TestBatch b;
+    test_batch_init(&b, 100, 4);
+
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch(&b.schema, &b.array, &data, &size), ARROW_IPC_OK);
+    CHECK_EQ(arrow_ipc_serialized_batch_size(&b.schema, &b.array), size);
+
+    uint8_t* dst = malloc(size);
+    CHECK(dst != NULL);
+    size_t written = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch_into(&b.schema, &b.array, dst, size - 1, &written),
+             ARROW_IPC_ERR_TRUNCATE);
+    CHECK_EQ(arrow_ipc_serialize_batch_into(&b.schema, &b.array, dst, size, &written), ARROW_IPC_OK);
+    CHECK_EQ(written, size);
+    CHECK(memcmp(dst, data, size) == 0);
+
+    // Copying deserialization works from any address
+    struct ArrowSchema schema;
+    struct ArrowArray array;
+    CHECK_EQ(arrow_ipc_deserialize_batch(dst, size, &schema, &array), ARROW_IPC_OK);
+    test_batch_check(&schema, &array, 4, 100);
+    array.release(&array);
+    schema.release(&schema);
+    free(dst);
+    free(data);
+}
+
+// The size of a sliced batch accounts for compaction
+static void test_sliced_size(void) {
+    static TestBatch b;
+    test_batch_init(&b, 200, 6);
+    for (int c = 0; c < 4; c++) {
+        b.columns[c].offset = 50;
+        b.columns[c].length = 30;
+    }
+    b.columns[1].null_count = -1;
+    b.array.length = 30;
+
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch(&b.schema, &b.array, &data, &size), ARROW_IPC_OK);
+    CHECK_EQ(arrow_ipc_serialized_batch_size(&b.schema, &b.array), size);
+
+    struct ArrowSchema schema;
+    struct ArrowArray array;
+    CHECK_EQ(arrow_ipc_deserialize_batch(data, size, &schema, &array), ARROW_IPC_OK);
+    test_batch_check_rows(&schema, &array, 6, 50, 30);
+    array.release(&array);
+    schema.release(&schema);
+    free(data);
+}
+
+int main(void) {
+    printf("test_ipc_alignment\n");
+    RUN_TEST(test_aligned_layout);
+    RUN_TEST(test_serialize_into);
+    RUN_TEST(test_sliced_size);
+    return 0;
+}
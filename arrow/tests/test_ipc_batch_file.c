@@ -0,0 +1,115 @@
+/**
+ * test_ipc_batch_file.c - The memory-mapped, indexed IPC batch file
+ */
+
+#include "test_batch.h"
+#include "arrow_ipc_batch_file.h"
+
+#define BATCHES 5
+
+static const char* temp_path(const char* name) {
+    static char path[512];
+    const char* dir = getenv("TMPDIR");
+    snprintf(path, sizeof(path), "%s/arrow_lean_%s.arrb", dir && dir[0] ? dir : "/tmp", name);
+    return path;
+}
+
+static int64_t batch_rows(int64_t index) {
+    return 100 + index * 37;
+}
+
+static void write_file(const char* path, const ArrowIPCWriteOptions* options) {
+    static TestBatch b;
+    ArrowIPCBatchFileWriter* writer = NULL;
+    CHECK_EQ(arrow_ipc_batch_file_writer_open(path, options, &writer), ARROW_IPC_OK);
+    for (int64_t i = 0; i < BATCHES; i++) {
+        test_batch_init(&b, batch_rows(i), i + 1);
+        CHECK_EQ(arrow_ipc_batch_file_writer_append(writer, &b.schema, &b.array), ARROW_IPC_OK);
+    }
+    CHECK_EQ(arrow_ipc_batch_file_writer_num_batches(writer), BATCHES);
+    CHECK_EQ(arrow_ipc_batch_file_writer_close(writer), ARROW_IPC_OK);
+}
+
+// Batches come back in any order, and outlive the reader
+static void read_file(const char* path) {
+    ArrowIPCBatchFileReader* reader = NULL;
+    CHECK_EQ(arrow_ipc_batch_file_reader_open(path, &reader), ARROW_IPC_OK);
+    CHECK_EQ(arrow_ipc_batch_file_reader_num_batches(reader), BATCHES);
+    int64_t total = 0;
+    for (int64_t i = 0; i < BATCHES; i++) {
+        CHECK_EQ(arrow_ipc_batch_file_reader_batch_rows(reader, i), batch_rows(i));
+        total += batch_rows(i);
+    }
+    CHECK_EQ(arrow_ipc_batch_file_reader_num_rows(reader), total);
+
+    struct ArrowSchema schemas[BATCHES];
+    struct ArrowArray arrays[BATCHES];
+    for (int64_t k = 0; k < BATCHES; k++) {
+        int64_t i = (k * 3) % BATCHES;
+        CHECK_EQ(arrow_ipc_batch_file_reader_read_batch(reader, i, &schemas[i], &arrays[i]), ARROW_IPC_OK);
+    }
+    struct ArrowSchema schema;
+    struct ArrowArray array;
+    CHECK_EQ(arrow_ipc_batch_file_reader_read_batch(reader, BATCHES, &schema, &array), ARROW_IPC_ERR_FORMAT);
+    CHECK_EQ(arrow_ipc_batch_file_reader_read_batch(reader, -1, &schema, &array), ARROW_IPC_ERR_FORMAT);
+    arrow_ipc_batch_file_reader_close(reader);
+
+    for (int64_t i = 0; i < BATCHES; i++) {
+        test_batch_check(&schemas[i], &arrays[i], i + 1, batch_rows(i));
+        arrays[i].release(&arrays[i]);
+        schemas[i].release(&schemas[i]);
+    }
+}
+
+static void test_round_trip(void) {
+    const char* path = temp_path("batch_file");
+    write_file(path, NULL);
+    read_file(path);
+    remove(path);
+}
+
+static void test_compressed(void) {
+    ArrowIPCWriteOptions options;
+    arrow_ipc_write_options_init(&options);
+    options.compression = ARROW_IPC_COMPRESSION_ZSTD;
+    options.min_compress_size = 64;
+    const char* path = temp_path("batch_file_zstd");
+    write_file(path, &options);
+    read_file(path);
+    remove(path);
+}
+
+// Files without a trailer (writer never closed, or truncated) are rejected
+static void test_incomplete_file(void) {
+    const char* path = temp_path("batch_file_cut");
+    write_file(path, NULL);
+
+    FILE* file = fopen(path, "rb");
+    CHECK(file != NULL);
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t* contents = malloc((size_t)size);
+    CHECK(contents != NULL);
+    CHECK_EQ(fread(contents, 1, (size_t)size, file), (size_t)size);
+    fclose(file);
+
+    file = fopen(path, "wb");
+    CHECK(file != NULL);
+    CHECK_EQ(fwrite(contents, 1, (size_t)size - 8, file), (size_t)size - 8);
+    fclose(file);
+    free(contents);
+
+    ArrowIPCBatchFileReader* reader = NULL;
+    CHECK_EQ(arrow_ipc_batch_file_reader_open(path, &reader), ARROW_IPC_ERR_FORMAT);
+    remove(path);
+    CHECK_EQ(arrow_ipc_batch_file_reader_open(path, &reader), ARROW_IPC_ERR_IO);
+}
+
+int main(void) {
+    printf("test_ipc_batch_file\n");
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_compressed);
+    RUN_TEST(test_incomplete_file);
+    return 0;
+}
@@ -0,0 +1,160 @@
+/**
+ * test_ipc_compression.c - Per-buffer LZ4_FRAME and ZSTD compression of IPC
+ * batches
+ */
+
+#include "test_batch.h"
+#include "arrow_ipc.h"
+#include "arrow_memory.h"
+
+#define ROWS 4000
+
+static uint32_t load_u32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+static void round_trip(ArrowIPCCompression compression) {
+    static TestBatch b;
+    test_batch_init(&b, ROWS, 9);
+
+    uint8_t* plain = NULL;
+    size_t plain_size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch(&b.schema, &b.array, &plain, &plain_size), ARROW_IPC_OK);
+
+    ArrowIPCWriteOptions options;
+    arrow_ipc_write_options_init(&options);
+    options.compression = compression;
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch_with_options(&b.schema, &b.array, &options, &data, &size),
+             ARROW_IPC_OK);
+    CHECK_EQ(load_u32(data + 4), ARROW_IPC_VERSION_COMPRESSED);
+    CHECK_EQ(load_u32(data + 8), (uint32_t)compression);
+    CHECK(size < plain_size * 3 / 4);
+
+    struct ArrowSchema schema;
+    struct ArrowArray array;
+    CHECK_EQ(arrow_ipc_deserialize_batch(data, size, &schema, &array), ARROW_IPC_OK);
+    test_batch_check(&schema, &array, 9, ROWS);
+    array.release(&array);
+    schema.release(&schema);
+    free(data);
+    free(plain);
+}
+
+static void test_lz4_frame(void) {
+    round_trip(ARROW_IPC_COMPRESSION_LZ4_FRAME);
+}
+
+static void test_zstd(void) {
+    round_trip(ARROW_IPC_COMPRESSION_ZSTD);
+}
+
+// Without a codec the output is the plain version 2 blob
+static void test_no_compression(void) {
+    static TestBatch b;
+    test_batch_init(&b, 100, 2);
+    uint8_t* plain = NULL;
+    size_t plain_size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch(&b.schema, &b.array, &plain, &plain_size), ARROW_IPC_OK);
+
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch_with_options(&b.schema, &b.array, NULL, &data, &size),
+             ARROW_IPC_OK);
+    CHECK_EQ(size, plain_size);
+    CHECK(memcmp(data, plain, size) == 0);
+    free(data);
+    free(plain);
+}
+
+// Buffers under the threshold, and random bytes that do not shrink, are
+// stored as is and still read back
+static void test_stored_uncompressed(void) {
+    enum { N = 2048 };
+    static int64_t noise[N];
+    uint64_t x = 88172645463325252ULL;
+    for (int i = 0; i < N; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        noise[i] = (int64_t)x;
+    }
+    int64_t small[] = {1, 2, 3};
+    const void* noise_buffers[] = {NULL, noise};
+    const void* small_buffers[] = {NULL, small};
+    struct ArrowSchema field = test_schema("l", "v", 0, NULL);
+
+    ArrowIPCWriteOptions options;
+    arrow_ipc_write_options_init(&options);
+    options.compression = ARROW_IPC_COMPRESSION_ZSTD;
+
+    const void** inputs[] = {noise_buffers, small_buffers};
+    int64_t lengths[] = {N, 3};
+    for (int t = 0; t < 2; t++) {
+        struct ArrowArray column = test_array(lengths[t], 2, inputs[t], 0, NULL);
+        struct ArrowArray* columns[] = {&column};
+        const void* batch_buffers[] = {NULL};
+        struct ArrowArray batch = test_array(lengths[t], 1, batch_buffers, 1, columns);
+        struct ArrowSchema* fields[] = {&field};
+        struct ArrowSchema schema = test_schema("+s", "", 1, fields);
+
+        uint8_t* data = NULL;
+        size_t size = 0;
+        CHECK_EQ(arrow_ipc_serialize_batch_with_options(&schema, &batch, &options, &data, &size),
+                 ARROW_IPC_OK);
+        CHECK(size >= (size_t)lengths[t] * 8);
+
+        struct ArrowSchema out_schema;
+        struct ArrowArray out;
+        CHECK_EQ(arrow_ipc_deserialize_batch(data, size, &out_schema, &out), ARROW_IPC_OK);
+        CHECK(memcmp(out.children[0]->buffers[1], inputs[t][1], (size_t)lengths[t] * 8) == 0);
+        out.release(&out);
+        out_schema.release(&out_schema);
+        free(data);
+    }
+}
+
+// The codec API on its own; a wrong expected size is rejected
+static void test_codec(void) {
+    static char text[10000];
+    for (size_t i = 0; i < sizeof(text); i++) text[i] = "arrow ipc "[i % 10];
+
+    ArrowIPCCompression codecs[] = {ARROW_IPC_COMPRESSION_LZ4_FRAME, ARROW_IPC_COMPRESSION_ZSTD};
+    for (int c = 0; c < 2; c++) {
+        ArrowIPCCodec codec;
+        CHECK_EQ(arrow_ipc_codec_init(&codec, codecs[c], 0), ARROW_IPC_OK);
+        size_t capacity = arrow_ipc_codec_bound(&codec, sizeof(text));
+        uint8_t* packed = malloc(capacity);
+        CHECK(packed != NULL);
+        size_t packed_size = 0;
+        CHECK_EQ(arrow_ipc_codec_compress(&codec, text, sizeof(text), packed, capacity, &packed_size),
+                 ARROW_IPC_OK);
+        CHECK(packed_size < sizeof(text) / 10);
+
+        void* unpacked = NULL;
+        CHECK_EQ(arrow_ipc_decompress(codecs[c], packed, packed_size, sizeof(text), &unpacked),
+                 ARROW_IPC_OK);
+        CHECK(memcmp(unpacked, text, sizeof(text)) == 0);
+        arrow_mem_free(unpacked);
+        CHECK_EQ(arrow_ipc_decompress(codecs[c], packed, packed_size, sizeof(text) + 1, &unpacked),
+                 ARROW_IPC_ERR_FORMAT);
+        free(packed);
+        arrow_ipc_codec_free(&codec);
+    }
+
+    ArrowIPCCodec codec;
+    CHECK_EQ(arrow_ipc_codec_init(&codec, (ArrowIPCCompression)99, 0), ARROW_IPC_ERR_UNSUPPORTED);
+}
+
+int main(void) {
+    printf("test_ipc_compression\n");
+    RUN_TEST(test_lz4_frame);
+    RUN_TEST(test_zstd);
+    RUN_TEST(test_no_compression);
+    RUN_TEST(test_stored_uncompressed);
+    RUN_TEST(test_codec);
+    return 0;
+}
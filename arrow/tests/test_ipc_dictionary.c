@@ -0,0 +1,241 @@
+/**
+ * test_ipc_dictionary.c - Schema-reference batches and delta dictionaries
+ */
+
+#include "test_batch.h"
+#include "arrow_ipc.h"
+#include "arrow_ipc_stream.h"
+
+static uint32_t load_u32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+// ============================================================================
+// Schema references
+// ============================================================================
+
+static void test_schema_ref(void) {
+    static TestBatch b;
+    test_batch_init(&b, 3, 8);
+
+    uint8_t* full = NULL;
+    size_t full_size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch(&b.schema, &b.array, &full, &full_size), ARROW_IPC_OK);
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch_ref(&b.schema, &b.array, NULL, &data, &size), ARROW_IPC_OK);
+    CHECK_EQ(load_u32(data + 4), ARROW_IPC_VERSION_SCHEMA_REF);
+    CHECK(size < full_size);
+
+    // The schema is stored once, under its fingerprint
+    uint8_t* schema_blob = NULL;
+    size_t schema_size = 0;
+    CHECK_EQ(arrow_ipc_serialize_schema(&b.schema, &schema_blob, &schema_size), ARROW_IPC_OK);
+    struct ArrowSchema stored;
+    size_t bytes_read = 0;
+    CHECK_EQ(arrow_ipc_deserialize_schema(schema_blob, schema_size, &stored, &bytes_read), ARROW_IPC_OK);
+    CHECK_EQ(bytes_read, schema_size);
+
+    uint64_t fingerprint = 0;
+    CHECK_EQ(arrow_ipc_batch_ref_fingerprint(data, size, &fingerprint), ARROW_IPC_OK);
+    CHECK_EQ(fingerprint, arrow_ipc_schema_fingerprint(&b.schema));
+    CHECK_EQ(fingerprint, arrow_ipc_schema_fingerprint(&stored));
+    CHECK_EQ(arrow_ipc_batch_ref_fingerprint(full, full_size, &fingerprint), ARROW_IPC_ERR_VERSION);
+
+    struct ArrowArray array;
+    CHECK_EQ(arrow_ipc_deserialize_batch_ref(data, size, &stored, &array), ARROW_IPC_OK);
+    test_batch_check(&stored, &array, 8, 3);
+    array.release(&array);
+
+    // A blob without its schema cannot be read as a self-describing batch
+    struct ArrowSchema schema;
+    CHECK_EQ(arrow_ipc_deserialize_batch(data, size, &schema, &array), ARROW_IPC_ERR_SCHEMA);
+
+    stored.release(&stored);
+    free(schema_blob);
+    free(data);
+    free(full);
+}
+
+// A different schema (one renamed field) is refused
+static void test_schema_ref_mismatch(void) {
+    static TestBatch b;
+    test_batch_init(&b, 50, 1);
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch_ref(&b.schema, &b.array, NULL, &data, &size), ARROW_IPC_OK);
+
+    uint64_t before = arrow_ipc_schema_fingerprint(&b.schema);
+    b.fields[1].name = "rating";
+    CHECK(arrow_ipc_schema_fingerprint(&b.schema) != before);
+    struct ArrowArray array;
+    CHECK_EQ(arrow_ipc_deserialize_batch_ref(data, size, &b.schema, &array), ARROW_IPC_ERR_SCHEMA);
+    b.fields[1].name = "score";
+    CHECK_EQ(arrow_ipc_deserialize_batch_ref(data, size, &b.schema, &array), ARROW_IPC_OK);
+    test_batch_check(NULL, &array, 1, 50);
+    array.release(&array);
+    free(data);
+}
+
+static void test_schema_ref_compressed_zero_copy(void) {
+    static TestBatch b;
+    test_batch_init(&b, 2000, 5);
+    ArrowIPCWriteOptions options;
+    arrow_ipc_write_options_init(&options);
+    options.compression = ARROW_IPC_COMPRESSION_LZ4_FRAME;
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch_ref(&b.schema, &b.array, &options, &data, &size), ARROW_IPC_OK);
+
+    struct ArrowArray array;
+    CHECK_EQ(arrow_ipc_deserialize_batch_ref_zero_copy(data, size, &b.schema, free, data, &array),
+             ARROW_IPC_OK);
+    test_batch_check(NULL, &array, 5, 2000);
+    array.release(&array);
+}
+
+// ============================================================================
+// Delta dictionaries
+// ============================================================================
+
+#define WORDS 1500
+#define DICT_ROWS 64
+
+typedef struct {
+    uint8_t* data;
+    size_t size;
+} Output;
+
+static int output_write(void* ctx, const void* data, size_t len) {
+    Output* out = (Output*)ctx;
+    uint8_t* grown = realloc(out->data, out->size + len);
+    if (!grown) return -1;
+    memcpy(grown + out->size, data, len);
+    out->data = grown;
+    out->size += len;
+    return 0;
+}
+
+static char words[WORDS * 8];
+static int32_t word_offsets[WORDS + 1];
+
+static void init_words(void) {
+    int32_t pos = 0;
+    for (int i = 0; i < WORDS; i++) {
+        word_offsets[i] = pos;
+        pos += sprintf(words + pos, "w%d", i);
+    }
+    word_offsets[WORDS] = pos;
+}
+
+static int32_t word_index(int64_t batch, int64_t row) {
+    return (int32_t)((row * 37 + batch) % ((batch + 1) * 500));
+}
+
+/*
+ * Three batches of a dictionary-encoded utf8 column whose dictionary grows
+ * from 500 to 1000 to 1500 words; earlier words keep their indices.
+ */
+static int write_dictionary_batches(ArrowIPCFormat format, int deltas, Output* out) {
+    static int32_t indices[DICT_ROWS];
+    const void* dict_buffers[] = {NULL, word_offsets, words};
+    struct ArrowArray dictionary = test_array(0, 3, dict_buffers, 0, NULL);
+    const void* index_buffers[] = {NULL, indices};
+    struct ArrowArray column = test_array(DICT_ROWS, 2, index_buffers, 0, NULL);
+    column.dictionary = &dictionary;
+    struct ArrowArray* columns[] = {&column};
+    const void* batch_buffers[] = {NULL};
+    struct ArrowArray batch = test_array(DICT_ROWS, 1, batch_buffers, 1, columns);
+
+    struct ArrowSchema value_schema = test_schema("u", "", 0, NULL);
+    struct ArrowSchema field = test_schema("i", "word", 0, NULL);
+    field.dictionary = &value_schema;
+    struct ArrowSchema* fields[] = {&field};
+    struct ArrowSchema schema = test_schema("+s", "", 1, fields);
+
+    ArrowIPCWriteOptions options;
+    arrow_ipc_write_options_init(&options);
+    options.emit_dictionary_deltas = deltas;
+    ArrowIPCStreamWriter* writer = NULL;
+    int rc = arrow_ipc_stream_writer_create(&schema, format, &options, output_write, out, &writer);
+    for (int64_t i = 0; i < 3 && rc == ARROW_IPC_OK; i++) {
+        dictionary.length = (i + 1) * 500;
+        for (int64_t r = 0; r < DICT_ROWS; r++) indices[r] = word_index(i, r);
+        rc = arrow_ipc_stream_writer_write_batch(writer, &batch);
+    }
+    if (rc == ARROW_IPC_OK) rc = arrow_ipc_stream_writer_finish(writer);
+    arrow_ipc_stream_writer_free(writer);
+    return rc;
+}
+
+// The stream format shows each batch the dictionary as of that batch; the
+// file format reads every dictionary batch up front
+static void check_dictionary_batches(const Output* out, int exact) {
+    struct ArrowArrayStream stream;
+    CHECK_EQ(arrow_ipc_read_array_stream(out->data, out->size, NULL, NULL, &stream), ARROW_IPC_OK);
+    for (int64_t i = 0; i < 3; i++) {
+        struct ArrowArray batch;
+        CHECK_EQ(stream.get_next(&stream, &batch), 0);
+        CHECK(batch.release != NULL);
+        const struct ArrowArray* column = batch.children[0];
+        const struct ArrowArray* dictionary = column->dictionary;
+        CHECK(dictionary != NULL);
+        if (exact) {
+            CHECK_EQ(dictionary->length, (i + 1) * 500);
+        } else {
+            CHECK(dictionary->length >= (i + 1) * 500);
+        }
+        const int32_t* indices = (const int32_t*)column->buffers[1];
+        const int32_t* offsets = (const int32_t*)dictionary->buffers[1];
+        const char* chars = (const char*)dictionary->buffers[2];
+        for (int64_t r = 0; r < DICT_ROWS; r++) {
+            int32_t k = indices[column->offset + r];
+            CHECK_EQ(k, word_index(i, r));
+            int32_t start = offsets[dictionary->offset + k];
+            int32_t len = offsets[dictionary->offset + k + 1] - start;
+            CHECK_EQ(len, word_offsets[k + 1] - word_offsets[k]);
+            CHECK(memcmp(chars + start, words + word_offsets[k], (size_t)len) == 0);
+        }
+        batch.release(&batch);
+    }
+    stream.release(&stream);
+}
+
+// Deltas carry only the new words, and the reader appends them
+static void test_stream_deltas(void) {
+    init_words();
+    Output replaced = {0};
+    Output deltas = {0};
+    CHECK_EQ(write_dictionary_batches(ARROW_IPC_FORMAT_STREAM, 0, &replaced), ARROW_IPC_OK);
+    CHECK_EQ(write_dictionary_batches(ARROW_IPC_FORMAT_STREAM, 1, &deltas), ARROW_IPC_OK);
+    CHECK(deltas.size + 1000 * 4 < replaced.size);
+    check_dictionary_batches(&replaced, 1);
+    check_dictionary_batches(&deltas, 1);
+    free(replaced.data);
+    free(deltas.data);
+}
+
+// The file format cannot replace a dictionary, but it can extend one
+static void test_file_deltas(void) {
+    init_words();
+    Output out = {0};
+    CHECK_EQ(write_dictionary_batches(ARROW_IPC_FORMAT_FILE, 0, &out), ARROW_IPC_ERR_UNSUPPORTED);
+    free(out.data);
+    out.data = NULL;
+    out.size = 0;
+    CHECK_EQ(write_dictionary_batches(ARROW_IPC_FORMAT_FILE, 1, &out), ARROW_IPC_OK);
+    check_dictionary_batches(&out, 0);
+    free(out.data);
+}
+
+int main(void) {
+    printf("test_ipc_dictionary\n");
+    RUN_TEST(test_schema_ref);
+    RUN_TEST(test_schema_ref_mismatch);
+    RUN_TEST(test_schema_ref_compressed_zero_copy);
+    RUN_TEST(test_stream_deltas);
+    RUN_TEST(test_file_deltas);
+    return 0;
+}
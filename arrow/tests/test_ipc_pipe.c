@@ -0,0 +1,136 @@
+/**
+ * test_ipc_pipe.c - Incremental IPC streams over pipes and file descriptors
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "test_batch.h"
+#include "arrow_ipc_stream.h"
+
+#define BATCHES 20
+#define ROWS 2000
+
+typedef struct {
+    int fd;
+    ArrowIPCFormat format;
+    const ArrowIPCWriteOptions* options;
+} Producer;
+
+// Write BATCHES batches, each larger than the pipe buffer, then close the fd
+static void* produce(void* arg) {
+    Producer* p = (Producer*)arg;
+    static TestBatch b;
+    test_batch_init(&b, 1, 0);
+    ArrowIPCStreamWriter* writer = NULL;
+    CHECK_EQ(arrow_ipc_stream_writer_create_fd(&b.schema, p->format, p->options, p->fd, &writer),
+             ARROW_IPC_OK);
+    for (int64_t seed = 1; seed <= BATCHES; seed++) {
+        test_batch_init(&b, ROWS, seed);
+        CHECK_EQ(arrow_ipc_stream_writer_write_batch(writer, &b.array), ARROW_IPC_OK);
+    }
+    CHECK_EQ(arrow_ipc_stream_writer_finish(writer), ARROW_IPC_OK);
+    arrow_ipc_stream_writer_free(writer);
+    if (p->format == ARROW_IPC_FORMAT_STREAM) close(p->fd);
+    return NULL;
+}
+
+static void consume(int fd) {
+    struct ArrowArrayStream stream;
+    CHECK_EQ(arrow_ipc_read_array_stream_from_fd(fd, &stream), ARROW_IPC_OK);
+    struct ArrowSchema schema;
+    CHECK_EQ(stream.get_schema(&stream, &schema), 0);
+
+    // Keep one batch alive across the next read
+    struct ArrowArray previous = {0};
+    for (int64_t seed = 1; seed <= BATCHES; seed++) {
+        struct ArrowArray batch;
+        CHECK_EQ(stream.get_next(&stream, &batch), 0);
+        CHECK(batch.release != NULL);
+        test_batch_check(&schema, &batch, seed, ROWS);
+        if (previous.release) {
+            test_batch_check(&schema, &previous, seed - 1, ROWS);
+            previous.release(&previous);
+        }
+        previous = batch;
+    }
+    struct ArrowArray end;
+    CHECK_EQ(stream.get_next(&stream, &end), 0);
+    CHECK(end.release == NULL);
+    stream.release(&stream);
+    previous.release(&previous);
+    schema.release(&schema);
+}
+
+static void pipe_round_trip(const ArrowIPCWriteOptions* options) {
+    int fds[2];
+    CHECK_EQ(pipe(fds), 0);
+    Producer producer = {fds[1], ARROW_IPC_FORMAT_STREAM, options};
+    pthread_t thread;
+    CHECK_EQ(pthread_create(&thread, NULL, produce, &producer), 0);
+    consume(fds[0]);
+    pthread_join(thread, NULL);
+    close(fds[0]);
+}
+
+static void test_pipe(void) {
+    pipe_round_trip(NULL);
+}
+
+static void test_compressed_pipe(void) {
+    ArrowIPCWriteOptions options;
+    arrow_ipc_write_options_init(&options);
+    options.compression = ARROW_IPC_COMPRESSION_ZSTD;
+    pipe_round_trip(&options);
+}
+
+// A file format written to a descriptor reads back through the fd reader
+// (embedded stream) and through the in-memory reader (footer)
+static void test_file_descriptor(void) {
+    char path[512];
+    const char* dir = getenv("TMPDIR");
+    snprintf(path, sizeof(path), "%s/arrow_lean_ipc_fd.arrow", dir && dir[0] ? dir : "/tmp");
+    int fd = open(path, O_CREAT | O_TRUNC | O_WRONLY, 0644);
+    CHECK(fd >= 0);
+    Producer producer = {fd, ARROW_IPC_FORMAT_FILE, NULL};
+    produce(&producer);
+    close(fd);
+
+    fd = open(path, O_RDONLY);
+    CHECK(fd >= 0);
+    consume(fd);
+    close(fd);
+
+    struct ArrowArrayStream stream;
+    CHECK_EQ(arrow_ipc_read_array_stream_from_path(path, &stream), ARROW_IPC_OK);
+    struct ArrowArray batch;
+    CHECK_EQ(stream.get_next(&stream, &batch), 0);
+    test_batch_check(NULL, &batch, 1, ROWS);
+    batch.release(&batch);
+    stream.release(&stream);
+    remove(path);
+}
+
+// A writer that cannot write reports an I/O error
+static void test_closed_pipe(void) {
+    int fds[2];
+    CHECK_EQ(pipe(fds), 0);
+    close(fds[0]);
+    close(fds[1]);
+    static TestBatch b;
+    test_batch_init(&b, 10, 1);
+    ArrowIPCStreamWriter* writer = NULL;
+    CHECK_EQ(arrow_ipc_stream_writer_create_fd(&b.schema, ARROW_IPC_FORMAT_STREAM, NULL, fds[1], &writer),
+             ARROW_IPC_ERR_IO);
+}
+
+int main(void) {
+    printf("test_ipc_pipe\n");
+    RUN_TEST(test_pipe);
+    RUN_TEST(test_compressed_pipe);
+    RUN_TEST(test_file_descriptor);
+    RUN_TEST(test_closed_pipe);
+    return 0;
+}
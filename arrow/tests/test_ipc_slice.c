@@ -0,0 +1,172 @@
+/**
+ * test_ipc_slice.c - Round trips of sliced arrays through IPC serialization
+ *
+ * A slice is written compacted: offsets are re-based to 0 and children only
+ * carry the values the slice references.
+ */
+
+#include "test_util.h"
+#include "arrow_ipc.h"
+
+// Serialize `array` and read it back against the same schema
+static struct ArrowArray round_trip(const struct ArrowArray* array, const struct ArrowSchema* schema) {
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_array(array, schema, &data, &size), ARROW_IPC_OK);
+
+    struct ArrowArray out;
+    size_t bytes_read = 0;
+    CHECK_EQ(arrow_ipc_deserialize_array(data, size, schema, &out, &bytes_read), ARROW_IPC_OK);
+    CHECK_EQ(bytes_read, size);
+    free(data);
+    return out;
+}
+
+static void test_utf8_slice(void) {
+    int32_t offsets[] = {0, 1, 3, 6, 10};
+    const char chars[] = "abbcccdddd";
+    uint8_t validity[] = {0x0B};  // element 2 is null
+    const void* buffers[] = {validity, offsets, chars};
+    struct ArrowArray array = test_array(4, 3, buffers, 0, NULL);
+    struct ArrowSchema schema = test_schema("u", "s", 0, NULL);
+
+    array.offset = 1;
+    array.length = 3;
+    struct ArrowArray out = round_trip(&array, &schema);
+
+    CHECK_EQ(out.length, 3);
+    CHECK_EQ(out.offset, 0);
+    CHECK_EQ(out.null_count, 1);
+    const int32_t* o = (const int32_t*)out.buffers[1];
+    CHECK(o[0] == 0 && o[1] == 2 && o[2] == 5 && o[3] == 9);
+    CHECK(memcmp(out.buffers[2], "bbcccdddd", 9) == 0);
+    CHECK(test_bit(out.buffers[0], 0) && !test_bit(out.buffers[0], 1) && test_bit(out.buffers[0], 2));
+    out.release(&out);
+}
+
+// map<int32, int64> with entries {1:10, 2:20}, {3:30}, {4:40, 5:50}
+static void test_map(int64_t offset, int64_t length) {
+    int32_t map_offsets[] = {0, 2, 3, 5};
+    int32_t keys[] = {1, 2, 3, 4, 5};
+    int64_t values[] = {10, 20, 30, 40, 50};
+
+    const void* key_buffers[] = {NULL, keys};
+    const void* value_buffers[] = {NULL, values};
+    struct ArrowArray key = test_array(5, 2, key_buffers, 0, NULL);
+    struct ArrowArray value = test_array(5, 2, value_buffers, 0, NULL);
+    struct ArrowArray* entry_children[] = {&key, &value};
+    const void* entry_buffers[] = {NULL};
+    struct ArrowArray entries = test_array(5, 1, entry_buffers, 2, entry_children);
+    struct ArrowArray* map_children[] = {&entries};
+    const void* map_buffers[] = {NULL, map_offsets};
+    struct ArrowArray map = test_array(3, 2, map_buffers, 1, map_children);
+    map.offset = offset;
+    map.length = length;
+
+    struct ArrowSchema key_schema = test_schema("i", "key", 0, NULL);
+    struct ArrowSchema value_schema = test_schema("l", "value", 0, NULL);
+    struct ArrowSchema* entry_fields[] = {&key_schema, &value_schema};
+    struct ArrowSchema entries_schema = test_schema("+s", "entries", 2, entry_fields);
+    struct ArrowSchema* map_fields[] = {&entries_schema};
+    struct ArrowSchema map_schema = test_schema("+m", "m", 1, map_fields);
+
+    struct ArrowArray out = round_trip(&map, &map_schema);
+    CHECK_EQ(out.length, length);
+    CHECK_EQ(out.n_children, 1);
+
+    const int32_t* o = (const int32_t*)out.buffers[1];
+    CHECK(o != NULL);
+    int32_t base = map_offsets[offset];
+    for (int64_t i = 0; i <= length; i++) {
+        CHECK_EQ(o[i], map_offsets[offset + i] - base);
+    }
+
+    int64_t n_entries = map_offsets[offset + length] - base;
+    const struct ArrowArray* e = out.children[0];
+    CHECK_EQ(e->length, n_entries);
+    CHECK_EQ(e->children[0]->length, n_entries);
+    const int32_t* k = (const int32_t*)e->children[0]->buffers[1];
+    const int64_t* v = (const int64_t*)e->children[1]->buffers[1];
+    for (int64_t j = 0; j < n_entries; j++) {
+        CHECK_EQ(k[j], keys[base + j]);
+        CHECK_EQ(v[j], values[base + j]);
+    }
+    out.release(&out);
+}
+
+static void test_map_whole(void) {
+    test_map(0, 3);
+}
+
+static void test_map_sliced(void) {
+    test_map(1, 2);
+}
+
+// fixed_size_list<int16>[3] of 4 lists, sliced to lists 1..2
+static void test_fixed_size_list_slice(void) {
+    int16_t items[12];
+    for (int i = 0; i < 12; i++) items[i] = (int16_t)(i * 7);
+
+    const void* item_buffers[] = {NULL, items};
+    struct ArrowArray item = test_array(12, 2, item_buffers, 0, NULL);
+    struct ArrowArray* children[] = {&item};
+    const void* list_buffers[] = {NULL};
+    struct ArrowArray list = test_array(4, 1, list_buffers, 1, children);
+    list.offset = 1;
+    list.length = 2;
+
+    struct ArrowSchema item_schema = test_schema("s", "item", 0, NULL);
+    struct ArrowSchema* fields[] = {&item_schema};
+    struct ArrowSchema schema = test_schema("+w:3", "fl", 1, fields);
+
+    struct ArrowArray out = round_trip(&list, &schema);
+    CHECK_EQ(out.length, 2);
+    CHECK_EQ(out.children[0]->length, 6);
+    const int16_t* got = (const int16_t*)out.children[0]->buffers[1];
+    for (int i = 0; i < 6; i++) {
+        CHECK_EQ(got[i], items[3 + i]);
+    }
+    out.release(&out);
+}
+
+// fixed_size_binary[4], whole and sliced
+static void test_fixed_size_binary(void) {
+    const char bytes[] = "aaaabbbbccccdddd";
+    const void* buffers[] = {NULL, bytes};
+    struct ArrowArray array = test_array(4, 2, buffers, 0, NULL);
+    struct ArrowSchema schema = test_schema("w:4", "fb", 0, NULL);
+
+    CHECK_EQ(arrow_ipc_get_buffer_count("w:4"), 2);
+    CHECK_EQ(arrow_ipc_get_element_size("w:4"), 4);
+
+    struct ArrowArray out = round_trip(&array, &schema);
+    CHECK_EQ(out.length, 4);
+    CHECK(out.buffers[1] != NULL);
+    CHECK(memcmp(out.buffers[1], bytes, 16) == 0);
+    out.release(&out);
+
+    array.offset = 2;
+    array.length = 1;
+    out = round_trip(&array, &schema);
+    CHECK_EQ(out.length, 1);
+    CHECK(memcmp(out.buffers[1], "cccc", 4) == 0);
+    out.release(&out);
+}
+
+static void test_buffer_counts(void) {
+    CHECK_EQ(arrow_ipc_get_buffer_count("+l"), 2);
+    CHECK_EQ(arrow_ipc_get_buffer_count("+L"), 2);
+    CHECK_EQ(arrow_ipc_get_buffer_count("+m"), 2);
+    CHECK_EQ(arrow_ipc_get_buffer_count("+w:3"), 1);
+}
+
+int main(void) {
+    printf("test_ipc_slice\n");
+    RUN_TEST(test_utf8_slice);
+    RUN_TEST(test_map_whole);
+    RUN_TEST(test_map_sliced);
+    RUN_TEST(test_fixed_size_list_slice);
+    RUN_TEST(test_fixed_size_binary);
+    RUN_TEST(test_buffer_counts);
+    return 0;
+}
@@ -0,0 +1,147 @@
+/**
+ * test_ipc_stream.c - Standard Arrow IPC stream and file format round trips
+ */
+
+#include "test_batch.h"
+#include "arrow_ipc_stream.h"
+
+typedef struct {
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+} MemoryOutput;
+
+static int memory_write(void* ctx, const void* data, size_t len) {
+    MemoryOutput* out = (MemoryOutput*)ctx;
+    if (out->size + len > out->capacity) {
+        size_t capacity = out->capacity ? out->capacity * 2 : 4096;
+        while (capacity < out->size + len) capacity *= 2;
+        uint8_t* grown = realloc(out->data, capacity);
+        if (!grown) return -1;
+        out->data = grown;
+        out->capacity = capacity;
+    }
+    memcpy(out->data + out->size, data, len);
+    out->size += len;
+    return 0;
+}
+
+static int owner_releases;
+
+static void count_release(void* owner) {
+    owner_releases++;
+    free(owner);
+}
+
+static uint32_t load_u32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+}
+
+// Three batches of different sizes and seeds, written one at a time
+static void write_batches(ArrowIPCFormat format, MemoryOutput* out) {
+    static TestBatch b;
+    test_batch_init(&b, 1, 0);
+    ArrowIPCStreamWriter* writer = NULL;
+    CHECK_EQ(arrow_ipc_stream_writer_create(&b.schema, format, NULL, memory_write, out, &writer),
+             ARROW_IPC_OK);
+    for (int64_t seed = 1; seed <= 3; seed++) {
+        test_batch_init(&b, seed * 300 + 7, seed);
+        CHECK_EQ(arrow_ipc_stream_writer_write_batch(writer, &b.array), ARROW_IPC_OK);
+    }
+    CHECK_EQ(arrow_ipc_stream_writer_finish(writer), ARROW_IPC_OK);
+    arrow_ipc_stream_writer_free(writer);
+}
+
+static void read_batches(uint8_t* data, size_t size) {
+    owner_releases = 0;
+    struct ArrowArrayStream stream;
+    CHECK_EQ(arrow_ipc_read_array_stream(data, size, count_release, data, &stream), ARROW_IPC_OK);
+
+    struct ArrowSchema schema;
+    CHECK_EQ(stream.get_schema(&stream, &schema), 0);
+
+    struct ArrowArray batches[3];
+    for (int64_t seed = 1; seed <= 3; seed++) {
+        CHECK_EQ(stream.get_next(&stream, &batches[seed - 1]), 0);
+        CHECK(batches[seed - 1].release != NULL);
+        test_batch_check(&schema, &batches[seed - 1], seed, seed * 300 + 7);
+    }
+    struct ArrowArray end;
+    CHECK_EQ(stream.get_next(&stream, &end), 0);
+    CHECK(end.release == NULL);
+
+    // The input stays alive until the last batch is gone
+    stream.release(&stream);
+    schema.release(&schema);
+    for (int i = 0; i < 3; i++) {
+        CHECK_EQ(owner_releases, 0);
+        batches[i].release(&batches[i]);
+    }
+    CHECK_EQ(owner_releases, 1);
+}
+
+static void test_stream_format(void) {
+    MemoryOutput out = {0};
+    write_batches(ARROW_IPC_FORMAT_STREAM, &out);
+    CHECK(out.size > 16);
+    CHECK_EQ(load_u32(out.data), ARROW_IPC_CONTINUATION);
+    CHECK_EQ(load_u32(out.data + out.size - 8), ARROW_IPC_CONTINUATION);
+    CHECK_EQ(load_u32(out.data + out.size - 4), 0);
+    read_batches(out.data, out.size);
+}
+
+static void test_file_format(void) {
+    MemoryOutput out = {0};
+    write_batches(ARROW_IPC_FORMAT_FILE, &out);
+    CHECK(memcmp(out.data, ARROW_IPC_FILE_MAGIC, ARROW_IPC_FILE_MAGIC_SIZE) == 0);
+    CHECK(memcmp(out.data + out.size - ARROW_IPC_FILE_MAGIC_SIZE, ARROW_IPC_FILE_MAGIC,
+                 ARROW_IPC_FILE_MAGIC_SIZE) == 0);
+    read_batches(out.data, out.size);
+}
+
+// Body buffers of a batch read back alias the input on 64-byte boundaries
+static void test_aligned_bodies(void) {
+    MemoryOutput out = {0};
+    write_batches(ARROW_IPC_FORMAT_STREAM, &out);
+
+    struct ArrowArrayStream stream;
+    CHECK_EQ(arrow_ipc_read_array_stream(out.data, out.size, NULL, NULL, &stream), ARROW_IPC_OK);
+    struct ArrowArray batch;
+    CHECK_EQ(stream.get_next(&stream, &batch), 0);
+    const uint8_t* ids = (const uint8_t*)batch.children[0]->buffers[1];
+    CHECK(ids >= out.data && ids < out.data + out.size);
+    CHECK_EQ((size_t)(ids - out.data) % ARROW_IPC_STREAM_ALIGNMENT, 0);
+    batch.release(&batch);
+    stream.release(&stream);
+    free(out.data);
+}
+
+// A stream cut short is reported as an error, not as a short read
+static void test_truncated_stream(void) {
+    MemoryOutput out = {0};
+    write_batches(ARROW_IPC_FORMAT_STREAM, &out);
+
+    struct ArrowArrayStream stream;
+    int rc = arrow_ipc_read_array_stream(out.data, out.size / 2, NULL, NULL, &stream);
+    if (rc == ARROW_IPC_OK) {
+        struct ArrowArray batch;
+        int status = 0;
+        while ((status = stream.get_next(&stream, &batch)) == 0 && batch.release) {
+            batch.release(&batch);
+        }
+        CHECK(status != 0);
+        stream.release(&stream);
+    }
+    free(out.data);
+}
+
+int main(void) {
+    printf("test_ipc_stream\n");
+    RUN_TEST(test_stream_format);
+    RUN_TEST(test_file_format);
+    RUN_TEST(test_aligned_bodies);
+    RUN_TEST(test_truncated_stream);
+    return 0;
+}
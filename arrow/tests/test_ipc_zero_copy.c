@@ -0,0 +1,123 @@
+/**
+ * test_ipc_zero_copy.c - Zero-copy IPC deserialization that aliases the
+ * input buffer
+ */
+
+#include "test_batch.h"
+#include "arrow_ipc.h"
+
+static int owner_releases;
+
+static void count_release(void* owner) {
+    owner_releases++;
+    free(owner);
+}
+
+static int points_into(const void* p, const uint8_t* data, size_t size) {
+    return (const uint8_t*)p >= data && (const uint8_t*)p < data + size;
+}
+
+static void test_batch_zero_copy(void) {
+    static TestBatch b;
+    test_batch_init(&b, 1000, 3);
+
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch(&b.schema, &b.array, &data, &size), ARROW_IPC_OK);
+
+    owner_releases = 0;
+    struct ArrowSchema schema;
+    struct ArrowArray array;
+    CHECK_EQ(arrow_ipc_deserialize_batch_zero_copy(data, size, count_release, data, &schema, &array),
+             ARROW_IPC_OK);
+    test_batch_check(&schema, &array, 3, 1000);
+
+    // Aligned buffers alias the input
+    CHECK(points_into(array.children[0]->buffers[1], data, size));
+    CHECK(points_into(array.children[2]->buffers[2], data, size));
+    CHECK(points_into(array.children[3]->children[0]->buffers[1], data, size));
+
+    // A child moved out of the batch keeps the input alive on its own
+    struct ArrowArray name = *array.children[2];
+    array.children[2]->release = NULL;
+    array.release(&array);
+    CHECK_EQ(owner_releases, 0);
+    CHECK(memcmp((const char*)name.buffers[2], "n23757", 6) == 0);
+    name.release(&name);
+    CHECK_EQ(owner_releases, 1);
+
+    schema.release(&schema);
+}
+
+// Input that is not 8-byte aligned: buffers are copied where needed and the
+// result is still correct
+static void test_misaligned_input(void) {
+    static TestBatch b;
+    test_batch_init(&b, 257, 5);
+
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch(&b.schema, &b.array, &data, &size), ARROW_IPC_OK);
+    uint8_t* shifted = malloc(size + 1);
+    CHECK(shifted != NULL);
+    memcpy(shifted + 1, data, size);
+    free(data);
+
+    owner_releases = 0;
+    struct ArrowSchema schema;
+    struct ArrowArray array;
+    CHECK_EQ(arrow_ipc_deserialize_batch_zero_copy(shifted + 1, size, count_release, shifted,
+                                                   &schema, &array), ARROW_IPC_OK);
+    test_batch_check(&schema, &array, 5, 257);
+    CHECK_EQ((uintptr_t)array.children[0]->buffers[1] % 8, 0);
+    array.release(&array);
+    schema.release(&schema);
+    CHECK_EQ(owner_releases, 1);
+}
+
+static void test_array_zero_copy(void) {
+    int64_t values[] = {10, 20, 30, 40};
+    const void* buffers[] = {NULL, values};
+    struct ArrowArray input = test_array(4, 2, buffers, 0, NULL);
+    struct ArrowSchema schema = test_schema("l", "v", 0, NULL);
+
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_array(&input, &schema, &data, &size), ARROW_IPC_OK);
+
+    struct ArrowArray out;
+    size_t bytes_read = 0;
+    CHECK_EQ(arrow_ipc_deserialize_array_zero_copy(data, size, &schema, NULL, NULL, &out, &bytes_read),
+             ARROW_IPC_OK);
+    CHECK_EQ(bytes_read, size);
+    CHECK(points_into(out.buffers[1], data, size));
+    CHECK_EQ(((const int64_t*)out.buffers[1])[3], 40);
+    out.release(&out);
+    free(data);
+}
+
+// Truncated input fails without calling the owner release
+static void test_truncated_input(void) {
+    static TestBatch b;
+    test_batch_init(&b, 64, 1);
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch(&b.schema, &b.array, &data, &size), ARROW_IPC_OK);
+
+    owner_releases = 0;
+    struct ArrowSchema schema;
+    struct ArrowArray array;
+    CHECK(arrow_ipc_deserialize_batch_zero_copy(data, size - 16, count_release, data, &schema, &array)
+          != ARROW_IPC_OK);
+    CHECK_EQ(owner_releases, 0);
+    free(data);
+}
+
+int main(void) {
+    printf("test_ipc_zero_copy\n");
+    RUN_TEST(test_batch_zero_copy);
+    RUN_TEST(test_misaligned_input);
+    RUN_TEST(test_array_zero_copy);
+    RUN_TEST(test_truncated_input);
+    return 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * test_memory_pool.c - Memory pools: selection, block reuse and buffers of
+ * builders and kernels returned to the pool they came from
+ */
+
+#include "test_util.h"
+#include "arrow_builders.h"
+#include "arrow_compute.h"
+#include "arrow_memory.h"
+
+#define ROWS 5000
+
+static int64_t pool_live(const ArrowMemoryPool* pool) {
+    ArrowMemoryStats stats;
+    arrow_memory_pool_stats(pool, &stats);
+    return stats.live_allocations;
+}
+
+// A released block of the same size class is handed out again
+static void test_size_class_reuse(void) {
+    ArrowMemoryPool* pool = arrow_size_class_memory_pool_create(0);
+    CHECK(pool != NULL);
+    CHECK(arrow_memory_pool_set_thread(pool) == NULL);
+
+    uint8_t* a = arrow_mem_alloc(1000);
+    CHECK(a != NULL);
+    memset(a, 0xAB, 1000);
+    arrow_mem_free(a);
+    uint8_t* b = arrow_mem_alloc(1020);
+    CHECK(b == a);
+
+    // Growing within the class keeps the block and the contents
+    memset(b, 0x5A, 1020);
+    uint8_t* c = arrow_mem_realloc(b, 1500);
+    CHECK(c == b);
+    CHECK(c[0] == 0x5A && c[1019] == 0x5A);
+    arrow_mem_free(c);
+    CHECK_EQ(pool_live(pool), 0);
+
+    CHECK(arrow_memory_pool_set_thread(NULL) == pool);
+    arrow_memory_pool_destroy(pool);
+}
+
+// Arena buffers are bump-allocated; the most recent one grows in place
+static void test_arena(void) {
+    ArrowMemoryPool* pool = arrow_arena_memory_pool_create(1 << 16);
+    CHECK(pool != NULL);
+    arrow_memory_pool_set_thread(pool);
+
+    uint8_t* a = arrow_mem_alloc(100);
+    uint8_t* b = arrow_mem_alloc(100);
+    CHECK(a != NULL && b != NULL);
+    CHECK(b > a && b - a < 1024);
+    for (int i = 0; i < 100; i++) b[i] = (uint8_t)i;
+    uint8_t* grown = arrow_mem_realloc(b, 5000);
+    CHECK(grown == b);
+    CHECK(grown[99] == 99);
+
+    // Resizing an older buffer copies it
+    memset(a, 7, 100);
+    uint8_t* moved = arrow_mem_realloc(a, 5000);
+    CHECK(moved != a && moved[0] == 7 && moved[99] == 7);
+
+    // Blocks larger than the arena block size still work
+    uint8_t* big = arrow_mem_calloc(1, 1 << 20);
+    CHECK(big != NULL && big[(1 << 20) - 1] == 0);
+
+    arrow_mem_free(moved);
+    arrow_mem_free(grown);
+    arrow_mem_free(big);
+    CHECK_EQ(pool_live(pool), 0);
+
+    arrow_memory_pool_set_thread(NULL);
+    arrow_memory_pool_destroy(pool);
+}
+
+// The thread pool overrides the default, and scopes nest
+static void test_selection(void) {
+    ArrowMemoryPool* outer = arrow_size_class_memory_pool_create(0);
+    ArrowMemoryPool* inner = arrow_arena_memory_pool_create(0);
+    CHECK(arrow_memory_pool_current() == arrow_system_memory_pool());
+
+    arrow_memory_pool_set_default(outer);
+    CHECK(arrow_memory_pool_current() == outer);
+    void* from_outer = arrow_mem_alloc(64);
+
+    ArrowMemoryPool* previous = arrow_memory_pool_set_thread(inner);
+    CHECK(arrow_memory_pool_current() == inner);
+    void* from_inner = arrow_mem_alloc(64);
+    CHECK_EQ(pool_live(inner), 1);
+    CHECK_EQ(pool_live(outer), 1);
+    arrow_memory_pool_set_thread(previous);
+
+    // Freeing goes back to the owning pool whatever the current pool is
+    arrow_mem_free(from_inner);
+    CHECK_EQ(pool_live(inner), 0);
+    arrow_memory_pool_set_default(NULL);
+    CHECK(arrow_memory_pool_current() == arrow_system_memory_pool());
+    arrow_mem_free(from_outer);
+    CHECK_EQ(pool_live(outer), 0);
+
+    arrow_memory_pool_destroy(inner);
+    arrow_memory_pool_destroy(outer);
+}
+
+// Builder and kernel results live in the current pool, and releasing them
+// returns every buffer
+static void test_arrays_in_pool(ArrowMemoryPool* pool) {
+    arrow_memory_pool_set_thread(pool);
+
+    Int64Builder* builder = int64_builder_create(16);
+    CHECK(builder != NULL);
+    for (int64_t i = 0; i < ROWS; i++) {
+        CHECK_EQ(i % 7 == 3 ? int64_builder_append_null(builder) : int64_builder_append(builder, i), 0);
+    }
+    struct ArrowArray* values = int64_builder_finish(builder);
+    int64_builder_free(builder);
+    CHECK(values != NULL);
+    CHECK(pool_live(pool) > 0);
+
+    struct ArrowArray* sum = arrow_add_int64(values, values);
+    CHECK(sum != NULL);
+    CHECK_EQ(sum->length, ROWS);
+    const int64_t* got = (const int64_t*)sum->buffers[1];
+    for (int64_t i = 0; i < ROWS; i++) {
+        CHECK_EQ(test_bit(sum->buffers[0], i), i % 7 != 3);
+        if (i % 7 != 3) CHECK_EQ(got[i], 2 * i);
+    }
+
+    // Nothing leaks out of the pool once both arrays are released
+    arrow_memory_pool_set_thread(NULL);
+    sum->release(sum);
+    free(sum);
+    values->release(values);
+    free(values);
+    CHECK_EQ(pool_live(pool), 0);
+    arrow_memory_pool_destroy(pool);
+}
+
+static void test_arrays_in_size_class_pool(void) {
+    test_arrays_in_pool(arrow_size_class_memory_pool_create(1 << 20));
+}
+
+static void test_arrays_in_arena(void) {
+    test_arrays_in_pool(arrow_arena_memory_pool_create(4096));
+}
+
+int main(void) {
+    printf("test_memory_pool\n");
+    RUN_TEST(test_size_class_reuse);
+    RUN_TEST(test_arena);
+    RUN_TEST(test_selection);
+    RUN_TEST(test_arrays_in_size_class_pool);
+    RUN_TEST(test_arrays_in_arena);
+    return 0;
+}
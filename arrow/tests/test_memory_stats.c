@@ -0,0 +1,152 @@
+/**
+ * test_memory_stats.c - Allocation counters, globally and per pool, broken
+ * down by subsystem
+ */
+
+#include "test_parquet_util.h"
+#include "arrow_builders.h"
+#include "arrow_compute.h"
+#include "arrow_ipc.h"
+#include "arrow_memory.h"
+
+#define ROWS 4000
+
+static ArrowMemoryStats global(void) {
+    ArrowMemoryStats stats;
+    arrow_memory_stats(&stats);
+    return stats;
+}
+
+static int64_t live_in(ArrowMemorySubsystem subsystem) {
+    return global().subsystems[subsystem].bytes_live;
+}
+
+static struct ArrowArray* build_int64(void) {
+    Int64Builder* builder = int64_builder_create(8);
+    for (int64_t i = 0; i < ROWS; i++) CHECK_EQ(int64_builder_append(builder, i), 0);
+    struct ArrowArray* array = int64_builder_finish(builder);
+    int64_builder_free(builder);
+    CHECK(array != NULL);
+    return array;
+}
+
+static void release(struct ArrowArray* array) {
+    array->release(array);
+    free(array);
+}
+
+static void test_counters(void) {
+    ArrowMemoryPool* pool = arrow_size_class_memory_pool_create(0);
+    arrow_memory_pool_set_thread(pool);
+    ArrowMemoryStats before = global();
+
+    void* a = arrow_mem_alloc_in(ARROW_MEMORY_OTHER, 100);    // 128 bytes padded
+    void* b = arrow_mem_alloc_in(ARROW_MEMORY_OTHER, 1000);   // 1024
+    ArrowMemoryStats stats;
+    arrow_memory_pool_stats(pool, &stats);
+    CHECK_EQ(stats.allocations, 2);
+    CHECK_EQ(stats.live_allocations, 2);
+    CHECK_EQ(stats.bytes_live, 128 + 1024);
+    CHECK_EQ(stats.bytes_allocated, 128 + 1024);
+    CHECK_EQ(stats.subsystems[ARROW_MEMORY_OTHER].allocations, 2);
+
+    // A resize is not a new allocation; growth adds to the allocated total
+    b = arrow_mem_realloc_in(ARROW_MEMORY_COMPUTE, b, 3000);   // 3008
+    arrow_memory_pool_stats(pool, &stats);
+    CHECK_EQ(stats.allocations, 2);
+    CHECK_EQ(stats.bytes_live, 128 + 3008);
+    CHECK_EQ(stats.bytes_allocated, 128 + 3008);
+    CHECK_EQ(stats.subsystems[ARROW_MEMORY_OTHER].bytes_live, 128 + 3008);
+    CHECK_EQ(stats.subsystems[ARROW_MEMORY_COMPUTE].bytes_live, 0);
+
+    // Shrinking lowers the live bytes but not the peak or the total
+    b = arrow_mem_realloc(b, 10);
+    arrow_mem_free(a);
+    arrow_memory_pool_stats(pool, &stats);
+    CHECK_EQ(stats.bytes_live, 64);
+    CHECK_EQ(stats.peak_bytes_live, 128 + 3008);
+    CHECK_EQ(stats.bytes_allocated, 128 + 3008);
+    CHECK_EQ(stats.live_allocations, 1);
+    arrow_mem_free(b);
+
+    // The global counters saw the same traffic
+    ArrowMemoryStats after = global();
+    CHECK_EQ(after.allocations - before.allocations, 2);
+    CHECK_EQ(after.bytes_allocated - before.bytes_allocated, 128 + 3008);
+    CHECK_EQ(after.bytes_live, before.bytes_live);
+    CHECK_EQ(after.live_allocations, before.live_allocations);
+    CHECK(after.peak_bytes_live >= before.bytes_live + 128 + 3008);
+
+    arrow_memory_pool_set_thread(NULL);
+    arrow_memory_pool_destroy(pool);
+}
+
+// Each layer charges its buffers to its own subsystem, and releasing the
+// arrays brings every subsystem back to where it started
+static void test_subsystems(void) {
+    int64_t base[ARROW_MEMORY_SUBSYSTEM_COUNT];
+    for (int s = 0; s < ARROW_MEMORY_SUBSYSTEM_COUNT; s++) base[s] = live_in((ArrowMemorySubsystem)s);
+
+    struct ArrowArray* values = build_int64();
+    CHECK(live_in(ARROW_MEMORY_BUILDERS) - base[ARROW_MEMORY_BUILDERS] >= ROWS * 8);
+
+    struct ArrowArray* doubled = arrow_multiply_scalar_int64(values, 2);
+    CHECK(doubled != NULL);
+    CHECK(live_in(ARROW_MEMORY_COMPUTE) - base[ARROW_MEMORY_COMPUTE] >= ROWS * 8);
+
+    struct ArrowArray* column_ptrs[] = {doubled};
+    const void* batch_buffers[] = {NULL};
+    struct ArrowArray batch = test_array(ROWS, 1, batch_buffers, 1, column_ptrs);
+    struct ArrowSchema field = test_schema("l", "v", 0, NULL);
+    struct ArrowSchema* fields[] = {&field};
+    struct ArrowSchema schema = test_schema("+s", "", 1, fields);
+
+    uint8_t* data = NULL;
+    size_t size = 0;
+    CHECK_EQ(arrow_ipc_serialize_batch(&schema, &batch, &data, &size), ARROW_IPC_OK);
+    int64_t ipc_before = live_in(ARROW_MEMORY_IPC);
+    struct ArrowSchema ipc_schema;
+    struct ArrowArray ipc_batch;
+    CHECK_EQ(arrow_ipc_deserialize_batch(data, size, &ipc_schema, &ipc_batch), ARROW_IPC_OK);
+    CHECK(live_in(ARROW_MEMORY_IPC) - ipc_before >= ROWS * 8);
+    ipc_batch.release(&ipc_batch);
+    ipc_schema.release(&ipc_schema);
+    CHECK_EQ(live_in(ARROW_MEMORY_IPC), ipc_before);
+    free(data);
+
+    // Parquet stream batches stay counted until the batch is released
+    const char* path = test_parquet_path("memory_stats");
+    test_parquet_write(parquet_file_writer_create(path), &batch, &schema);
+    ParquetFileReader* reader = parquet_file_reader_open(path);
+    struct ArrowSchema pq_schema;
+    struct ArrowArray pq_batch;
+    test_parquet_read(reader, &pq_schema, &pq_batch);
+    CHECK(live_in(ARROW_MEMORY_PARQUET) - base[ARROW_MEMORY_PARQUET] >= ROWS * 8);
+    CHECK_EQ(((const int64_t*)pq_batch.children[0]->buffers[1])[ROWS - 1], 2 * (ROWS - 1));
+    test_parquet_release(&pq_schema, &pq_batch);
+    parquet_file_reader_close(reader);
+    remove(path);
+
+    release(doubled);
+    release(values);
+    for (int s = 0; s < ARROW_MEMORY_SUBSYSTEM_COUNT; s++) {
+        CHECK_EQ(live_in((ArrowMemorySubsystem)s), base[s]);
+    }
+}
+
+static void test_subsystem_names(void) {
+    CHECK(strcmp(arrow_memory_subsystem_name(ARROW_MEMORY_BUILDERS), "builders") == 0);
+    CHECK(strcmp(arrow_memory_subsystem_name(ARROW_MEMORY_COMPUTE), "compute") == 0);
+    CHECK(strcmp(arrow_memory_subsystem_name(ARROW_MEMORY_PARQUET), "parquet") == 0);
+    CHECK(strcmp(arrow_memory_subsystem_name(ARROW_MEMORY_IPC), "ipc") == 0);
+    CHECK(strcmp(arrow_memory_subsystem_name(ARROW_MEMORY_OTHER), "other") == 0);
+    CHECK(strcmp(arrow_memory_subsystem_name(ARROW_MEMORY_SUBSYSTEM_COUNT), "unknown") == 0);
+}
+
+int main(void) {
+    printf("test_memory_stats\n");
+    RUN_TEST(test_counters);
+    RUN_TEST(test_subsystems);
+    RUN_TEST(test_subsystem_names);
+    return 0;
+}
@@ -0,0 +1,133 @@
+/**
+ * test_parquet_bloom.c - Split-block Bloom filters written by the Parquet
+ * writer and probed by the reader
+ */
+
+#include "test_parquet_util.h"
+
+#define ROWS 4096
+
+static void test_xxhash64(void) {
+    // Reference values of XXH64 with seed 0
+    CHECK_EQ(parquet_xxhash64("", 0, 0), 0xEF46DB3751D8E999ULL);
+    CHECK_EQ(parquet_xxhash64("abc", 3, 0), 0x44BC2CF5AD770999ULL);
+}
+
+static void test_bitset(void) {
+    size_t num_bytes = parquet_bloom_optimal_bytes(1000, 0.01);
+    CHECK(num_bytes >= PARQUET_BLOOM_MIN_BYTES && num_bytes <= PARQUET_BLOOM_MAX_BYTES);
+    CHECK_EQ(num_bytes & (num_bytes - 1), 0);  // Power of two
+    CHECK_EQ(num_bytes % PARQUET_BLOOM_BLOCK_BYTES, 0);
+
+    uint8_t* bitset = calloc(1, num_bytes);
+    CHECK(bitset != NULL);
+    for (int64_t v = 0; v < 1000; v++) {
+        parquet_bloom_insert(bitset, num_bytes, parquet_xxhash64(&v, 8, 0));
+    }
+    int false_positives = 0;
+    for (int64_t v = 0; v < 10000; v++) {
+        bool hit = parquet_bloom_check(bitset, num_bytes, parquet_xxhash64(&v, 8, 0));
+        if (v < 1000) CHECK(hit);
+        else false_positives += hit;
+    }
+    CHECK(false_positives < 9000 / 20);
+    free(bitset);
+}
+
+// id: int64 with even values 0, 2, ..., name: "k<id>"
+static void test_filters_in_file(void) {
+    static int64_t ids[ROWS];
+    static int32_t offsets[ROWS + 1];
+    static char chars[ROWS * 8];
+    int32_t pos = 0;
+    for (int i = 0; i < ROWS; i++) {
+        ids[i] = 2 * i;
+        offsets[i] = pos;
+        pos += sprintf(chars + pos, "k%d", 2 * i);
+    }
+    offsets[ROWS] = pos;
+
+    const void* id_buffers[] = {NULL, ids};
+    const void* name_buffers[] = {NULL, offsets, chars};
+    struct ArrowArray columns[] = {
+        test_array(ROWS, 2, id_buffers, 0, NULL),
+        test_array(ROWS, 3, name_buffers, 0, NULL)
+    };
+    struct ArrowArray* column_ptrs[] = {&columns[0], &columns[1]};
+    const void* batch_buffers[] = {NULL};
+    struct ArrowArray batch = test_array(ROWS, 1, batch_buffers, 2, column_ptrs);
+
+    struct ArrowSchema id = test_schema("l", "id", 0, NULL);
+    struct ArrowSchema name = test_schema("u", "name", 0, NULL);
+    struct ArrowSchema* fields[] = {&id, &name};
+    struct ArrowSchema schema = test_schema("+s", "", 2, fields);
+
+    const char* path = test_parquet_path("bloom");
+    ParquetFileWriter* writer = parquet_file_writer_create(path);
+    CHECK(writer != NULL);
+    CHECK_EQ(parquet_file_writer_enable_bloom_filter(writer, "id", 0.01), 0);
+    CHECK_EQ(parquet_file_writer_enable_bloom_filter(writer, "name", 0.01), 0);
+    test_parquet_write(writer, &batch, &schema);
+
+    ParquetFileReader* reader = parquet_file_reader_open(path);
+    CHECK(reader != NULL);
+    const ParquetRowGroupMeta* rg = parquet_file_reader_get_row_group(reader, 0);
+    CHECK(rg->columns[0].bloom_filter_offset > 0);
+    CHECK(rg->columns[1].bloom_filter_offset > 0);
+
+    // Every written value is found
+    char key[16];
+    for (int i = 0; i < ROWS; i++) {
+        CHECK_EQ(parquet_file_reader_bloom_filter_check(reader, 0, 0, &ids[i], 8), 1);
+        int len = sprintf(key, "k%d", 2 * i);
+        CHECK_EQ(parquet_file_reader_bloom_filter_check(reader, 0, 1, key, (size_t)len), 1);
+    }
+
+    // Odd values lie within min/max, so only the filter can rule them out
+    int skipped = 0;
+    for (int64_t v = 1; v < 2 * ROWS; v += 2) {
+        skipped += !parquet_file_reader_might_contain(reader, "id", &v, 8);
+    }
+    CHECK(skipped > ROWS * 9 / 10);
+
+    // Out of range values are rejected by the statistics alone
+    int64_t big = 1 << 30;
+    CHECK(!parquet_file_reader_might_contain(reader, "id", &big, 8));
+    CHECK(parquet_file_reader_might_contain(reader, "name", "k42", 3));
+
+    parquet_file_reader_close(reader);
+    remove(path);
+}
+
+// A column without a filter reports -1
+static void test_no_filter(void) {
+    int64_t values[] = {1, 2, 3};
+    const void* buffers[] = {NULL, values};
+    struct ArrowArray column = test_array(3, 2, buffers, 0, NULL);
+    struct ArrowArray* column_ptrs[] = {&column};
+    const void* batch_buffers[] = {NULL};
+    struct ArrowArray batch = test_array(3, 1, batch_buffers, 1, column_ptrs);
+    struct ArrowSchema field = test_schema("l", "x", 0, NULL);
+    struct ArrowSchema* fields[] = {&field};
+    struct ArrowSchema schema = test_schema("+s", "", 1, fields);
+
+    const char* path = test_parquet_path("no_bloom");
+    test_parquet_write(parquet_file_writer_create(path), &batch, &schema);
+
+    ParquetFileReader* reader = parquet_file_reader_open(path);
+    CHECK(reader != NULL);
+    int64_t probe = 2;
+    CHECK_EQ(parquet_file_reader_bloom_filter_check(reader, 0, 0, &probe, 8), -1);
+    CHECK(parquet_file_reader_might_contain(reader, "x", &probe, 8));
+    parquet_file_reader_close(reader);
+    remove(path);
+}
+
+int main(void) {
+    printf("test_parquet_bloom\n");
+    RUN_TEST(test_xxhash64);
+    RUN_TEST(test_bitset);
+    RUN_TEST(test_filters_in_file);
+    RUN_TEST(test_no_filter);
+    return 0;
+}
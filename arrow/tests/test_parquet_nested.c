@@ -0,0 +1,221 @@
+/**
+ * test_parquet_nested.c - List and struct columns through the native Parquet
+ * writer and reader (Dremel levels shredded and reassembled)
+ */
+
+#include "test_parquet_util.h"
+
+#define ROWS 4
+
+static int valid(const struct ArrowArray* array, int64_t i) {
+    return !array->buffers[0] || test_bit(array->buffers[0], array->offset + i);
+}
+
+static int32_t list_start(const struct ArrowArray* list, int64_t i) {
+    return ((const int32_t*)list->buffers[1])[list->offset + i];
+}
+
+static int32_t list_length(const struct ArrowArray* list, int64_t i) {
+    return list_start(list, i + 1) - list_start(list, i);
+}
+
+static int string_equals(const struct ArrowArray* s, int64_t i, const char* expected) {
+    const int32_t* offsets = (const int32_t*)s->buffers[1];
+    int32_t start = offsets[s->offset + i];
+    size_t len = (size_t)(offsets[s->offset + i + 1] - start);
+    return len == strlen(expected) && memcmp((const char*)s->buffers[2] + start, expected, len) == 0;
+}
+
+/*
+ * tags:   list<utf8>            [["a", null], null, [], ["c"]]
+ * point:  struct<x: int64, y: double>  [{1, 1.5}, null, {3, null}, {4, 4.5}]
+ * matrix: list<list<int64>>     [[[1, 2], [3]], [[]], null, [[4]]]
+ */
+static void test_nested_round_trip(void) {
+    // tags
+    const char tag_chars[] = "ac";
+    int32_t tag_offsets[] = {0, 1, 1, 2};
+    uint8_t tag_validity[] = {0x05};
+    const void* tag_buffers[] = {tag_validity, tag_offsets, tag_chars};
+    struct ArrowArray tag_values = test_array(3, 3, tag_buffers, 0, NULL);
+    struct ArrowArray* tag_children[] = {&tag_values};
+    int32_t tags_offsets[] = {0, 2, 2, 2, 3};
+    uint8_t tags_validity[] = {0x0D};
+    const void* tags_buffers[] = {tags_validity, tags_offsets};
+    struct ArrowArray tags = test_array(ROWS, 2, tags_buffers, 1, tag_children);
+
+    // point
+    int64_t xs[] = {1, 0, 3, 4};
+    double ys[] = {1.5, 0, 0, 4.5};
+    uint8_t y_validity[] = {0x09};
+    uint8_t point_validity[] = {0x0D};
+    const void* x_buffers[] = {NULL, xs};
+    const void* y_buffers[] = {y_validity, ys};
+    struct ArrowArray x = test_array(ROWS, 2, x_buffers, 0, NULL);
+    struct ArrowArray y = test_array(ROWS, 2, y_buffers, 0, NULL);
+    struct ArrowArray* point_children[] = {&x, &y};
+    const void* point_buffers[] = {point_validity};
+    struct ArrowArray point = test_array(ROWS, 1, point_buffers, 2, point_children);
+
+    // matrix
+    int64_t cells[] = {1, 2, 3, 4};
+    const void* cell_buffers[] = {NULL, cells};
+    struct ArrowArray cell_values = test_array(4, 2, cell_buffers, 0, NULL);
+    struct ArrowArray* row_children[] = {&cell_values};
+    int32_t row_offsets[] = {0, 2, 3, 3, 4};
+    const void* row_buffers[] = {NULL, row_offsets};
+    struct ArrowArray rows = test_array(4, 2, row_buffers, 1, row_children);
+    struct ArrowArray* matrix_children[] = {&rows};
+    int32_t matrix_offsets[] = {0, 2, 3, 3, 4};
+    uint8_t matrix_validity[] = {0x0B};
+    const void* matrix_buffers[] = {matrix_validity, matrix_offsets};
+    struct ArrowArray matrix = test_array(ROWS, 2, matrix_buffers, 1, matrix_children);
+
+    struct ArrowArray* columns[] = {&tags, &point, &matrix};
+    const void* batch_buffers[] = {NULL};
+    struct ArrowArray batch = test_array(ROWS, 1, batch_buffers, 3, columns);
+
+    struct ArrowSchema tag_item = test_schema("u", "item", 0, NULL);
+    struct ArrowSchema* tag_fields[] = {&tag_item};
+    struct ArrowSchema tags_schema = test_schema("+l", "tags", 1, tag_fields);
+    struct ArrowSchema x_schema = test_schema("l", "x", 0, NULL);
+    x_schema.flags = 0;
+    struct ArrowSchema y_schema = test_schema("g", "y", 0, NULL);
+    struct ArrowSchema* point_fields[] = {&x_schema, &y_schema};
+    struct ArrowSchema point_schema = test_schema("+s", "point", 2, point_fields);
+    struct ArrowSchema cell_schema = test_schema("l", "item", 0, NULL);
+    cell_schema.flags = 0;
+    struct ArrowSchema* row_fields[] = {&cell_schema};
+    struct ArrowSchema row_schema = test_schema("+l", "item", 1, row_fields);
+    row_schema.flags = 0;
+    struct ArrowSchema* matrix_fields[] = {&row_schema};
+    struct ArrowSchema matrix_schema = test_schema("+l", "matrix", 1, matrix_fields);
+    struct ArrowSchema* fields[] = {&tags_schema, &point_schema, &matrix_schema};
+    struct ArrowSchema schema = test_schema("+s", "", 3, fields);
+
+    const char* path = test_parquet_path("nested");
+    test_parquet_write(parquet_file_writer_create(path), &batch, &schema);
+
+    ParquetFileReader* reader = parquet_file_reader_open(path);
+    CHECK(reader != NULL);
+    CHECK_EQ(parquet_file_reader_get_row_group(reader, 0)->num_columns, 4);  // One per leaf
+
+    struct ArrowSchema out_schema;
+    struct ArrowArray out;
+    test_parquet_read(reader, &out_schema, &out);
+    CHECK_EQ(out.length, ROWS);
+    CHECK_EQ(out_schema.n_children, 3);
+    CHECK(strcmp(out_schema.children[0]->format, "+l") == 0);
+    CHECK(strcmp(out_schema.children[1]->format, "+s") == 0);
+    CHECK(strcmp(out_schema.children[2]->format, "+l") == 0);
+    CHECK(strcmp(out_schema.children[2]->children[0]->format, "+l") == 0);
+
+    const struct ArrowArray* t = out.children[0];
+    const struct ArrowArray* tv = t->children[0];
+    CHECK(valid(t, 0) && !valid(t, 1) && valid(t, 2) && valid(t, 3));
+    CHECK(list_length(t, 0) == 2 && list_length(t, 1) == 0 && list_length(t, 2) == 0 && list_length(t, 3) == 1);
+    CHECK(valid(tv, list_start(t, 0)) && string_equals(tv, list_start(t, 0), "a"));
+    CHECK(!valid(tv, list_start(t, 0) + 1));
+    CHECK(string_equals(tv, list_start(t, 3), "c"));
+
+    const struct ArrowArray* p = out.children[1];
+    const struct ArrowArray* px = p->children[0];
+    const struct ArrowArray* py = p->children[1];
+    CHECK(valid(p, 0) && !valid(p, 1) && valid(p, 2) && valid(p, 3));
+    const int64_t* got_x = (const int64_t*)px->buffers[1];
+    const double* got_y = (const double*)py->buffers[1];
+    CHECK(got_x[px->offset + 0] == 1 && got_x[px->offset + 2] == 3 && got_x[px->offset + 3] == 4);
+    CHECK(valid(py, 0) && got_y[py->offset + 0] == 1.5);
+    CHECK(!valid(py, 2));
+    CHECK(valid(py, 3) && got_y[py->offset + 3] == 4.5);
+
+    const struct ArrowArray* m = out.children[2];
+    const struct ArrowArray* mr = m->children[0];
+    const struct ArrowArray* mc = mr->children[0];
+    const int64_t* got_cells = (const int64_t*)mc->buffers[1];
+    CHECK(valid(m, 0) && valid(m, 1) && !valid(m, 2) && valid(m, 3));
+    CHECK(list_length(m, 0) == 2 && list_length(m, 1) == 1 && list_length(m, 2) == 0 && list_length(m, 3) == 1);
+    int32_t r = list_start(m, 0);
+    CHECK(list_length(mr, r) == 2 && list_length(mr, r + 1) == 1);
+    CHECK(got_cells[mc->offset + list_start(mr, r)] == 1 && got_cells[mc->offset + list_start(mr, r) + 1] == 2);
+    CHECK(got_cells[mc->offset + list_start(mr, r + 1)] == 3);
+    CHECK_EQ(list_length(mr, list_start(m, 1)), 0);
+    CHECK_EQ(got_cells[mc->offset + list_start(mr, list_start(m, 3))], 4);
+
+    test_parquet_release(&out_schema, &out);
+    parquet_file_reader_close(reader);
+    remove(path);
+}
+
+// Empty strings and all-null pages decode without touching value buffers
+static void test_empty_values(void) {
+    int32_t offsets[] = {0, 0, 0, 1};
+    const void* string_buffers[] = {NULL, offsets, "z"};
+    int64_t ints[] = {0, 0, 0};
+    uint8_t none[] = {0x00};
+    const void* int_buffers[] = {none, ints};
+    struct ArrowArray columns[] = {
+        test_array(3, 3, string_buffers, 0, NULL),
+        test_array(3, 2, int_buffers, 0, NULL)
+    };
+    columns[1].null_count = 3;
+    struct ArrowArray* column_ptrs[] = {&columns[0], &columns[1]};
+    const void* batch_buffers[] = {NULL};
+    struct ArrowArray batch = test_array(3, 1, batch_buffers, 2, column_ptrs);
+    struct ArrowSchema s = test_schema("u", "s", 0, NULL);
+    struct ArrowSchema n = test_schema("l", "n", 0, NULL);
+    struct ArrowSchema* fields[] = {&s, &n};
+    struct ArrowSchema schema = test_schema("+s", "", 2, fields);
+
+    const char* path = test_parquet_path("empty_values");
+    test_parquet_write(parquet_file_writer_create(path), &batch, &schema);
+
+    ParquetFileReader* reader = parquet_file_reader_open(path);
+    struct ArrowSchema out_schema;
+    struct ArrowArray out;
+    test_parquet_read(reader, &out_schema, &out);
+    CHECK(string_equals(out.children[0], 0, "") && string_equals(out.children[0], 2, "z"));
+    CHECK(!valid(out.children[1], 0) && !valid(out.children[1], 2));
+    test_parquet_release(&out_schema, &out);
+    parquet_file_reader_close(reader);
+    remove(path);
+}
+
+// A ZSTD page is decompressed even when its PLAIN data would start with the
+// ZSTD frame magic (28 B5 2F FD) had it been stored raw
+static void test_zstd_page_with_frame_magic(void) {
+    int64_t values[] = {0xFD2FB528LL, 1, 2};
+    const void* buffers[] = {NULL, values};
+    struct ArrowArray column = test_array(3, 2, buffers, 0, NULL);
+    struct ArrowArray* column_ptrs[] = {&column};
+    const void* batch_buffers[] = {NULL};
+    struct ArrowArray batch = test_array(3, 1, batch_buffers, 1, column_ptrs);
+    struct ArrowSchema field = test_schema("l", "v", 0, NULL);
+    field.flags = 0;
+    struct ArrowSchema* fields[] = {&field};
+    struct ArrowSchema schema = test_schema("+s", "", 1, fields);
+
+    const char* path = test_parquet_path("zstd_magic");
+    ParquetFileWriter* writer = parquet_file_writer_create(path);
+    CHECK(writer != NULL);
+    parquet_file_writer_set_compression(writer, PARQUET_CODEC_ZSTD);
+    test_parquet_write(writer, &batch, &schema);
+
+    ParquetFileReader* reader = parquet_file_reader_open(path);
+    struct ArrowSchema out_schema;
+    struct ArrowArray out;
+    test_parquet_read(reader, &out_schema, &out);
+    const int64_t* got = (const int64_t*)out.children[0]->buffers[1];
+    CHECK(got[0] == values[0] && got[1] == 1 && got[2] == 2);
+    test_parquet_release(&out_schema, &out);
+    parquet_file_reader_close(reader);
+    remove(path);
+}
+
+int main(void) {
+    printf("test_parquet_nested\n");
+    RUN_TEST(test_nested_round_trip);
+    RUN_TEST(test_empty_values);
+    RUN_TEST(test_zstd_page_with_frame_magic);
+    return 0;
+}
@@ -0,0 +1,142 @@
+/**
+ * test_parquet_sink.c - The buffered, asynchronous Parquet output sink
+ */
+
+#include "test_parquet_util.h"
+#include "parquet_sink.h"
+
+#define TOTAL_BYTES (1 << 20)
+
+static uint8_t pattern(size_t i) {
+    return (uint8_t)(i * 131 + (i >> 9));
+}
+
+// Append TOTAL_BYTES in odd-sized pieces and compare the file contents
+static void write_and_verify(const ParquetWriteOptions* options, const char* name) {
+    const char* path = test_parquet_path(name);
+    ParquetSink* sink = parquet_sink_open(path, options);
+    CHECK(sink != NULL);
+
+    uint8_t piece[7919];
+    size_t written = 0;
+    for (size_t step = 1; written < TOTAL_BYTES; step = step * 7 % sizeof(piece) + 1) {
+        size_t n = step < TOTAL_BYTES - written ? step : TOTAL_BYTES - written;
+        for (size_t k = 0; k < n; k++) piece[k] = pattern(written + k);
+        CHECK_EQ(parquet_sink_write(sink, piece, n), 0);
+        written += n;
+        CHECK_EQ(parquet_sink_offset(sink), (int64_t)written);
+        if (written > TOTAL_BYTES / 2 && written - n <= TOTAL_BYTES / 2) {
+            CHECK_EQ(parquet_sink_sync(sink), 0);
+        }
+    }
+    CHECK_EQ(parquet_sink_close(sink), 0);
+
+    FILE* file = fopen(path, "rb");
+    CHECK(file != NULL);
+    uint8_t* contents = malloc(TOTAL_BYTES + 1);
+    CHECK(contents != NULL);
+    CHECK_EQ(fread(contents, 1, TOTAL_BYTES + 1, file), (size_t)TOTAL_BYTES);
+    fclose(file);
+    for (size_t i = 0; i < TOTAL_BYTES; i++) {
+        CHECK_EQ(contents[i], pattern(i));
+    }
+    free(contents);
+    remove(path);
+}
+
+static void test_background_writes(void) {
+    ParquetWriteOptions options;
+    parquet_write_options_init(&options);
+    options.buffer_size = 3 * PARQUET_SINK_ALIGNMENT;
+    options.queue_depth = 2;
+    write_and_verify(&options, "sink_async");
+}
+
+static void test_synchronous_writes(void) {
+    ParquetWriteOptions options;
+    parquet_write_options_init(&options);
+    options.buffer_size = PARQUET_SINK_ALIGNMENT;
+    options.queue_depth = 0;
+    options.fsync_policy = PARQUET_FSYNC_ON_CLOSE;
+    write_and_verify(&options, "sink_sync");
+}
+
+// Direct I/O falls back to buffered writes where the file system refuses it;
+// either way the unaligned tail must reach the file
+static void test_direct_io(void) {
+    ParquetWriteOptions options;
+    parquet_write_options_init(&options);
+    options.buffer_size = 2 * PARQUET_SINK_ALIGNMENT;
+    options.direct_io = true;
+    write_and_verify(&options, "sink_direct");
+}
+
+static void test_abort(void) {
+    const char* path = test_parquet_path("sink_abort");
+    ParquetSink* sink = parquet_sink_open(path, NULL);
+    CHECK(sink != NULL);
+    uint8_t data[1000] = {0};
+    CHECK_EQ(parquet_sink_write(sink, data, sizeof(data)), 0);
+    parquet_sink_abort(sink);
+    remove(path);
+}
+
+// A multi-row-group file written through a small asynchronous sink
+static void test_writer_with_options(void) {
+    enum { ROWS = 20000, GROUPS = 3 };
+    static int64_t values[ROWS];
+    const void* buffers[] = {NULL, values};
+    struct ArrowArray column = test_array(ROWS, 2, buffers, 0, NULL);
+    struct ArrowArray* column_ptrs[] = {&column};
+    const void* batch_buffers[] = {NULL};
+    struct ArrowArray batch = test_array(ROWS, 1, batch_buffers, 1, column_ptrs);
+    struct ArrowSchema field = test_schema("l", "v", 0, NULL);
+    field.flags = 0;
+    struct ArrowSchema* fields[] = {&field};
+    struct ArrowSchema schema = test_schema("+s", "", 1, fields);
+
+    ParquetWriteOptions options;
+    parquet_write_options_init(&options);
+    options.buffer_size = 4 * PARQUET_SINK_ALIGNMENT;
+    options.fsync_policy = PARQUET_FSYNC_ROW_GROUP;
+
+    const char* path = test_parquet_path("sink_writer");
+    ParquetFileWriter* writer = parquet_file_writer_create_with_options(path, &options);
+    CHECK(writer != NULL);
+    for (int g = 0; g < GROUPS; g++) {
+        for (int i = 0; i < ROWS; i++) values[i] = (int64_t)g * ROWS + i;
+        CHECK_EQ(parquet_file_writer_write_batch(writer, &batch, &schema), 0);
+    }
+    CHECK_EQ(parquet_file_writer_close(writer), 0);
+    parquet_file_writer_free(writer);
+
+    ParquetFileReader* reader = parquet_file_reader_open(path);
+    CHECK(reader != NULL);
+    CHECK_EQ(parquet_file_reader_num_row_groups(reader), GROUPS);
+    struct ArrowArrayStream* stream = parquet_file_reader_read_all(reader);
+    CHECK(stream != NULL);
+    for (int g = 0; g < GROUPS; g++) {
+        struct ArrowArray out;
+        CHECK_EQ(stream->get_next(stream, &out), 0);
+        CHECK(out.release != NULL && out.length == ROWS);
+        const int64_t* got = (const int64_t*)out.children[0]->buffers[1];
+        for (int i = 0; i < ROWS; i++) {
+            CHECK_EQ(got[i], (int64_t)g * ROWS + i);
+        }
+        out.release(&out);
+    }
+    stream->release(stream);
+    free(stream);
+    parquet_file_reader_close(reader);
+    remove(path);
+}
+
+int main(void) {
+    printf("test_parquet_sink\n");
+    RUN_TEST(test_background_writes);
+    RUN_TEST(test_synchronous_writes);
+    RUN_TEST(test_direct_io);
+    RUN_TEST(test_abort);
+    RUN_TEST(test_writer_with_options);
+    return 0;
+}
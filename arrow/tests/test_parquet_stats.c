@@ -0,0 +1,155 @@
+/**
+ * test_parquet_stats.c - Column chunk statistics written by the Parquet
+ * writer and read back from the footer
+ */
+
+#include "test_parquet_util.h"
+#include <math.h>
+
+#define ROWS 10
+
+static int64_t load_i64(const uint8_t* p) {
+    int64_t v;
+    memcpy(&v, p, 8);
+    return v;
+}
+
+static double load_f64(const uint8_t* p) {
+    double v;
+    memcpy(&v, p, 8);
+    return v;
+}
+
+static void test_statistics(void) {
+    // i: int64 with nulls at 3 and 7
+    int64_t ints[ROWS] = {5, -3, 9, 1000, 4, 4, 0, -1000, 7, 2};
+    uint8_t int_validity[] = {0x77, 0x03};
+    // d: NaN and -0.0 are not bounds
+    double doubles[ROWS] = {1.5, NAN, -0.0, 2.5, 0.25, NAN, 3.0, -1.25, 0.0, 1.0};
+    // s: strings compare as unsigned bytes, so U+4E00 is the maximum
+    const char* words[ROWS] = {"pear", "fig", "kiwi", "be", "plum", "lime", "yuzu", "\xe4\xb8\x80", "fig", "pear"};
+    int32_t offsets[ROWS + 1];
+    char chars[64];
+    offsets[0] = 0;
+    for (int k = 0; k < ROWS; k++) {
+        size_t len = strlen(words[k]);
+        memcpy(chars + offsets[k], words[k], len);
+        offsets[k + 1] = offsets[k] + (int32_t)len;
+    }
+    // b: booleans, all true
+    uint8_t bools[] = {0xFF, 0x03};
+
+    const void* int_buffers[] = {int_validity, ints};
+    const void* double_buffers[] = {NULL, doubles};
+    const void* string_buffers[] = {NULL, offsets, chars};
+    const void* bool_buffers[] = {NULL, bools};
+    struct ArrowArray columns[] = {
+        test_array(ROWS, 2, int_buffers, 0, NULL),
+        test_array(ROWS, 2, double_buffers, 0, NULL),
+        test_array(ROWS, 3, string_buffers, 0, NULL),
+        test_array(ROWS, 2, bool_buffers, 0, NULL)
+    };
+    columns[0].null_count = 2;
+    struct ArrowArray* column_ptrs[] = {&columns[0], &columns[1], &columns[2], &columns[3]};
+    const void* batch_buffers[] = {NULL};
+    struct ArrowArray batch = test_array(ROWS, 1, batch_buffers, 4, column_ptrs);
+
+    struct ArrowSchema i = test_schema("l", "i", 0, NULL);
+    struct ArrowSchema d = test_schema("g", "d", 0, NULL);
+    struct ArrowSchema s = test_schema("u", "s", 0, NULL);
+    struct ArrowSchema b = test_schema("b", "b", 0, NULL);
+    struct ArrowSchema* fields[] = {&i, &d, &s, &b};
+    struct ArrowSchema schema = test_schema("+s", "", 4, fields);
+
+    const char* path = test_parquet_path("stats");
+    test_parquet_write(parquet_file_writer_create(path), &batch, &schema);
+
+    ParquetFileReader* reader = parquet_file_reader_open(path);
+    CHECK(reader != NULL);
+    const ParquetRowGroupMeta* rg = parquet_file_reader_get_row_group(reader, 0);
+    CHECK_EQ(rg->num_columns, 4);
+    for (int c = 0; c < 4; c++) {
+        CHECK(rg->columns[c].has_statistics);
+        CHECK(rg->columns[c].has_min_max);
+        // distinct_count is exact by spec and is not written
+        CHECK_EQ(rg->columns[c].distinct_count, -1);
+    }
+
+    const ParquetColumnChunkMeta* ci = &rg->columns[0];
+    CHECK_EQ(ci->null_count, 2);
+    CHECK(ci->min_value_len == 8 && ci->max_value_len == 8);
+    CHECK_EQ(load_i64(ci->min_value), -3);  // -1000 is at a null slot
+    CHECK_EQ(load_i64(ci->max_value), 9);
+
+    const ParquetColumnChunkMeta* cd = &rg->columns[1];
+    CHECK_EQ(cd->null_count, 0);
+    CHECK_EQ(load_f64(cd->min_value), -1.25);
+    CHECK_EQ(load_f64(cd->max_value), 3.0);
+
+    const ParquetColumnChunkMeta* cs = &rg->columns[2];
+    CHECK(cs->min_value_len == 2 && memcmp(cs->min_value, "be", 2) == 0);
+    CHECK(cs->max_value_len == 3 && memcmp(cs->max_value, "\xe4\xb8\x80", 3) == 0);
+
+    const ParquetColumnChunkMeta* cb = &rg->columns[3];
+    CHECK(cb->min_value_len == 1 && cb->min_value[0] == 1);
+    CHECK(cb->max_value_len == 1 && cb->max_value[0] == 1);
+
+    parquet_file_reader_close(reader);
+    remove(path);
+}
+
+// Zero bounds are widened to [-0.0, +0.0]
+static void test_signed_zero_bounds(void) {
+    double doubles[] = {0.0, 0.0};
+    const void* buffers[] = {NULL, doubles};
+    struct ArrowArray column = test_array(2, 2, buffers, 0, NULL);
+    struct ArrowArray* column_ptrs[] = {&column};
+    const void* batch_buffers[] = {NULL};
+    struct ArrowArray batch = test_array(2, 1, batch_buffers, 1, column_ptrs);
+    struct ArrowSchema field = test_schema("g", "z", 0, NULL);
+    struct ArrowSchema* fields[] = {&field};
+    struct ArrowSchema schema = test_schema("+s", "", 1, fields);
+
+    const char* path = test_parquet_path("stats_zero");
+    test_parquet_write(parquet_file_writer_create(path), &batch, &schema);
+
+    ParquetFileReader* reader = parquet_file_reader_open(path);
+    CHECK(reader != NULL);
+    const ParquetColumnChunkMeta* c = &parquet_file_reader_get_row_group(reader, 0)->columns[0];
+    CHECK(signbit(load_f64(c->min_value)));
+    CHECK(!signbit(load_f64(c->max_value)));
+    parquet_file_reader_close(reader);
+    remove(path);
+}
+
+static void test_statistics_disabled(void) {
+    int64_t values[] = {1, 2, 3};
+    const void* buffers[] = {NULL, values};
+    struct ArrowArray column = test_array(3, 2, buffers, 0, NULL);
+    struct ArrowArray* column_ptrs[] = {&column};
+    const void* batch_buffers[] = {NULL};
+    struct ArrowArray batch = test_array(3, 1, batch_buffers, 1, column_ptrs);
+    struct ArrowSchema field = test_schema("l", "x", 0, NULL);
+    struct ArrowSchema* fields[] = {&field};
+    struct ArrowSchema schema = test_schema("+s", "", 1, fields);
+
+    const char* path = test_parquet_path("no_stats");
+    ParquetFileWriter* writer = parquet_file_writer_create(path);
+    CHECK(writer != NULL);
+    parquet_file_writer_set_write_statistics(writer, false);
+    test_parquet_write(writer, &batch, &schema);
+
+    ParquetFileReader* reader = parquet_file_reader_open(path);
+    CHECK(reader != NULL);
+    CHECK(!parquet_file_reader_get_row_group(reader, 0)->columns[0].has_statistics);
+    parquet_file_reader_close(reader);
+    remove(path);
+}
+
+int main(void) {
+    printf("test_parquet_stats\n");
+    RUN_TEST(test_statistics);
+    RUN_TEST(test_signed_zero_bounds);
+    RUN_TEST(test_statistics_disabled);
+    return 0;
+}
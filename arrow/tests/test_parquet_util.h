@@ -0,0 +1,48 @@
+/**
+ * test_parquet_util.h - Helpers for Parquet write/read round trips
+ */
+
+#ifndef ARROW_TEST_PARQUET_UTIL_H
+#define ARROW_TEST_PARQUET_UTIL_H
+
+#include "test_util.h"
+#include "parquet_writer_impl.h"
+#include "parquet_reader_impl.h"
+
+// Scratch file for a test, under $TMPDIR (default /tmp)
+static inline const char* test_parquet_path(const char* name) {
+    static char path[512];
+    const char* dir = getenv("TMPDIR");
+    snprintf(path, sizeof(path), "%s/arrow_lean_%s.parquet", dir && dir[0] ? dir : "/tmp", name);
+    return path;
+}
+
+// Write one batch with a writer configured by the caller, then close it
+static inline void test_parquet_write(ParquetFileWriter* writer, struct ArrowArray* batch,
+                                      struct ArrowSchema* schema) {
+    CHECK(writer != NULL);
+    CHECK_EQ(parquet_file_writer_write_batch(writer, batch, schema), 0);
+    CHECK_EQ(parquet_file_writer_close(writer), 0);
+    parquet_file_writer_free(writer);
+}
+
+// Read every row group of `reader` as a single batch (the file must hold one
+// row group). The schema and array are owned by the caller.
+static inline void test_parquet_read(ParquetFileReader* reader, struct ArrowSchema* out_schema,
+                                     struct ArrowArray* out_batch) {
+    CHECK(reader != NULL);
+    struct ArrowArrayStream* stream = parquet_file_reader_read_all(reader);
+    CHECK(stream != NULL);
+    CHECK_EQ(stream->get_schema(stream, out_schema), 0);
+    CHECK_EQ(stream->get_next(stream, out_batch), 0);
+    CHECK(out_batch->release != NULL);
+    stream->release(stream);
+    free(stream);
+}
+
+static inline void test_parquet_release(struct ArrowSchema* schema, struct ArrowArray* batch) {
+    if (batch->release) batch->release(batch);
+    if (schema->release) schema->release(schema);
+}
+
+#endif // ARROW_TEST_PARQUET_UTIL_H
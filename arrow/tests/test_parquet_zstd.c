@@ -0,0 +1,164 @@
+/**
+ * test_parquet_zstd.c - ZSTD-compressed Parquet round trips, with and
+ * without a trained dictionary
+ */
+
+#include "test_parquet_util.h"
+
+#define ROWS 512
+
+static int64_t ids[ROWS];
+static int32_t name_offsets[ROWS + 1];
+static char names[ROWS * 16];
+
+// Two columns, id: int64 (required) and name: utf8 (nullable)
+static void make_batch(int64_t seed, struct ArrowArray* batch, struct ArrowArray* columns,
+                       struct ArrowArray** column_ptrs, const void** id_buffers,
+                       const void** name_buffers, const void** batch_buffers) {
+    int32_t pos = 0;
+    for (int i = 0; i < ROWS; i++) {
+        ids[i] = seed * ROWS + i;
+        name_offsets[i] = pos;
+        pos += snprintf(names + pos, 16, "user-%05d", (int)((seed * 31 + i) % 20000));
+    }
+    name_offsets[ROWS] = pos;
+
+    id_buffers[0] = NULL;
+    id_buffers[1] = ids;
+    name_buffers[0] = NULL;
+    name_buffers[1] = name_offsets;
+    name_buffers[2] = names;
+    columns[0] = test_array(ROWS, 2, id_buffers, 0, NULL);
+    columns[1] = test_array(ROWS, 3, name_buffers, 0, NULL);
+    column_ptrs[0] = &columns[0];
+    column_ptrs[1] = &columns[1];
+    batch_buffers[0] = NULL;
+    *batch = test_array(ROWS, 1, batch_buffers, 2, column_ptrs);
+}
+
+typedef struct {
+    struct ArrowSchema id, name, root;
+    struct ArrowSchema* fields[2];
+} TestSchema;
+
+static void make_schema(TestSchema* s) {
+    s->id = test_schema("l", "id", 0, NULL);
+    s->id.flags = 0;
+    s->name = test_schema("u", "name", 0, NULL);
+    s->fields[0] = &s->id;
+    s->fields[1] = &s->name;
+    s->root = test_schema("+s", "", 2, s->fields);
+}
+
+static void check_batch(const struct ArrowArray* batch, int64_t seed) {
+    CHECK_EQ(batch->length, ROWS);
+    CHECK_EQ(batch->n_children, 2);
+    const struct ArrowArray* id = batch->children[0];
+    const struct ArrowArray* name = batch->children[1];
+    const int64_t* id_values = (const int64_t*)id->buffers[1];
+    const int32_t* offsets = (const int32_t*)name->buffers[1];
+    const char* chars = (const char*)name->buffers[2];
+    char expected[16];
+    for (int i = 0; i < ROWS; i++) {
+        CHECK_EQ(id_values[id->offset + i], seed * ROWS + i);
+        int len = snprintf(expected, sizeof(expected), "user-%05d", (int)((seed * 31 + i) % 20000));
+        int32_t start = offsets[name->offset + i];
+        CHECK_EQ(offsets[name->offset + i + 1] - start, len);
+        CHECK(memcmp(chars + start, expected, (size_t)len) == 0);
+    }
+}
+
+static void test_zstd_round_trip(void) {
+    const char* path = test_parquet_path("zstd");
+    TestSchema schema;
+    make_schema(&schema);
+    struct ArrowArray batch, columns[2], *column_ptrs[2];
+    const void *id_buffers[2], *name_buffers[3], *batch_buffers[1];
+    make_batch(7, &batch, columns, column_ptrs, id_buffers, name_buffers, batch_buffers);
+
+    ParquetFileWriter* writer = parquet_file_writer_create(path);
+    parquet_file_writer_set_compression(writer, PARQUET_CODEC_ZSTD);
+    parquet_file_writer_set_compression_level(writer, 5);
+    test_parquet_write(writer, &batch, &schema.root);
+
+    ParquetFileReader* reader = parquet_file_reader_open(path);
+    CHECK(reader != NULL);
+    const ParquetRowGroupMeta* rg = parquet_file_reader_get_row_group(reader, 0);
+    for (int c = 0; c < rg->num_columns; c++) {
+        CHECK_EQ(rg->columns[c].codec, PARQUET_CODEC_ZSTD);
+        CHECK(rg->columns[c].total_compressed_size < rg->columns[c].total_uncompressed_size);
+    }
+
+    struct ArrowSchema out_schema;
+    struct ArrowArray out;
+    test_parquet_read(reader, &out_schema, &out);
+    check_batch(&out, 7);
+    test_parquet_release(&out_schema, &out);
+    parquet_file_reader_close(reader);
+    remove(path);
+}
+
+// Train on pages captured from one writer, then write and read a file with
+// the dictionary
+static void test_zstd_dictionary(void) {
+    const char* train_path = test_parquet_path("zstd_train");
+    const char* path = test_parquet_path("zstd_dict");
+    TestSchema schema;
+    make_schema(&schema);
+    struct ArrowArray batch, columns[2], *column_ptrs[2];
+    const void *id_buffers[2], *name_buffers[3], *batch_buffers[1];
+
+    ParquetFileWriter* writer = parquet_file_writer_create(train_path);
+    CHECK(writer != NULL);
+    parquet_file_writer_set_compression(writer, PARQUET_CODEC_ZSTD);
+    parquet_file_writer_capture_samples(writer, 1 << 20);
+    for (int64_t seed = 0; seed < 64; seed++) {
+        make_batch(seed, &batch, columns, column_ptrs, id_buffers, name_buffers, batch_buffers);
+        CHECK_EQ(parquet_file_writer_write_batch(writer, &batch, &schema.root), 0);
+    }
+    uint8_t* dict = NULL;
+    size_t dict_size = 0;
+    CHECK_EQ(parquet_file_writer_train_zstd_dictionary(writer, 4096, &dict, &dict_size), 0);
+    CHECK(dict_size > 0 && dict_size <= 4096);
+    CHECK_EQ(parquet_file_writer_close(writer), 0);
+    parquet_file_writer_free(writer);
+    remove(train_path);
+
+    writer = parquet_file_writer_create(path);
+    CHECK(writer != NULL);
+    parquet_file_writer_set_compression(writer, PARQUET_CODEC_ZSTD);
+    CHECK_EQ(parquet_file_writer_set_zstd_dictionary(writer, dict, dict_size), 0);
+    make_batch(99, &batch, columns, column_ptrs, id_buffers, name_buffers, batch_buffers);
+    test_parquet_write(writer, &batch, &schema.root);
+
+    // The dictionary ID is recorded in the footer
+    ParquetFileReader* reader = parquet_file_reader_open(path);
+    CHECK(reader != NULL);
+    const ParquetFileMeta* meta = parquet_file_reader_get_metadata(reader);
+    bool found = false;
+    for (int i = 0; i < meta->num_kv; i++) {
+        found = found || strcmp(meta->kv_keys[i], PARQUET_ZSTD_DICT_ID_KEY) == 0;
+    }
+    CHECK(found);
+
+    // Pages cannot be decoded without the dictionary
+    struct ArrowArrayStream* stream = parquet_file_reader_read_all(reader);
+    CHECK(stream == NULL);
+
+    CHECK_EQ(parquet_file_reader_set_zstd_dictionary(reader, dict, dict_size), 0);
+    struct ArrowSchema out_schema;
+    struct ArrowArray out;
+    test_parquet_read(reader, &out_schema, &out);
+    check_batch(&out, 99);
+    test_parquet_release(&out_schema, &out);
+    parquet_file_reader_close(reader);
+    free(dict);
+    remove(path);
+}
+
+int main(void) {
+    printf("test_parquet_zstd\n");
+    RUN_TEST(test_zstd_round_trip);
+    RUN_TEST(test_zstd_dictionary);
+    return 0;
+}
@@ -0,0 +1,263 @@
+/**
+ * test_string_layouts.c - Large strings ("U") and string views ("vu") in
+ * builders, compute, IPC and Parquet
+ */
+
+#include "test_parquet_util.h"
+#include "arrow_builders.h"
+#include "arrow_compute.h"
+#include "arrow_ipc.h"
+
+#define COUNT 300
+
+// Row i: null every 7th row, otherwise a short (inline) or long string
+static int expected_string(int64_t i, char* out) {
+    if (i % 7 == 0) return -1;
+    return i % 2 ? sprintf(out, "id%lld", (long long)(i % 50))
+                 : sprintf(out, "a-long-identifier-%lld", (long long)(i % 50));
+}
+
+// Read row i of a "u", "U" or "vu" array; returns NULL for nulls
+static const char* get_string(const struct ArrowArray* a, const char* format, int64_t i, int64_t* len) {
+    int64_t j = a->offset + i;
+    if (a->buffers[0] && !test_bit(a->buffers[0], j)) return NULL;
+    if (strcmp(format, "u") == 0) {
+        const int32_t* offsets = (const int32_t*)a->buffers[1];
+        *len = offsets[j + 1] - offsets[j];
+        return (const char*)a->buffers[2] + offsets[j];
+    }
+    if (strcmp(format, "U") == 0) {
+        const int64_t* offsets = (const int64_t*)a->buffers[1];
+        *len = offsets[j + 1] - offsets[j];
+        return (const char*)a->buffers[2] + offsets[j];
+    }
+    const uint8_t* view = (const uint8_t*)a->buffers[1] + j * STRING_VIEW_SIZE;
+    int32_t length, index, offset;
+    memcpy(&length, view, 4);
+    *len = length;
+    if (length <= STRING_VIEW_INLINE_MAX) return (const char*)view + 4;
+    memcpy(&index, view + 8, 4);
+    memcpy(&offset, view + 12, 4);
+    return (const char*)a->buffers[2 + index] + offset;
+}
+
+static void check_strings(const struct ArrowArray* a, const char* format, const int64_t* rows, int64_t count) {
+    CHECK_EQ(a->length, count);
+    char expected[64];
+    for (int64_t k = 0; k < count; k++) {
+        int64_t i = rows ? rows[k] : k;
+        int len = expected_string(i, expected);
+        int64_t got_len = 0;
+        const char* got = get_string(a, format, k, &got_len);
+        if (len < 0) {
+            CHECK(got == NULL);
+        } else {
+            CHECK(got != NULL);
+            CHECK_EQ(got_len, len);
+            CHECK(memcmp(got, expected, (size_t)len) == 0);
+        }
+    }
+}
+
+static struct ArrowArray* build(const char* format) {
+    char value[64];
+    if (strcmp(format, "u") == 0) {
+        StringBuilder* b = string_builder_create(0, 0);
+        for (int64_t i = 0; i < COUNT; i++) {
+            int len = expected_string(i, value);
+            CHECK_EQ(len < 0 ? string_builder_append_null(b) : string_builder_append(b, value, (size_t)len), 0);
+        }
+        struct ArrowArray* out = string_builder_finish(b);
+        string_builder_free(b);
+        return out;
+    }
+    if (strcmp(format, "U") == 0) {
+        LargeStringBuilder* b = large_string_builder_create(0, 0);
+        for (int64_t i = 0; i < COUNT; i++) {
+            int len = expected_string(i, value);
+            CHECK_EQ(len < 0 ? large_string_builder_append_null(b)
+                             : large_string_builder_append(b, value, (size_t)len), 0);
+        }
+        struct ArrowArray* out = large_string_builder_finish(b);
+        large_string_builder_free(b);
+        return out;
+    }
+    // A small first block, so the data buffer has to grow
+    StringViewBuilder* b = string_view_builder_create(0, 64);
+    for (int64_t i = 0; i < COUNT; i++) {
+        int len = expected_string(i, value);
+        CHECK_EQ(len < 0 ? string_view_builder_append_null(b)
+                         : string_view_builder_append(b, value, (size_t)len), 0);
+    }
+    struct ArrowArray* out = string_view_builder_finish(b);
+    CHECK_EQ(out->n_buffers, 4);  // Validity, views, one data buffer, sizes
+    string_view_builder_free(b);
+    return out;
+}
+
+static void free_array(struct ArrowArray* a) {
+    a->release(a);
+    free(a);
+}
+
+static void test_builders(void) {
+    const char* formats[] = {"u", "U", "vu"};
+    for (int f = 0; f < 3; f++) {
+        struct ArrowArray* a = build(formats[f]);
+        CHECK_EQ(a->null_count, (COUNT + 6) / 7);
+        check_strings(a, formats[f], NULL, COUNT);
+        free_array(a);
+    }
+}
+
+// Every kernel gives the same answer for the three layouts
+static void test_compute(void) {
+    struct ArrowArray* utf8 = build("u");
+    struct ArrowArray* large = build("U");
+    struct ArrowArray* view = build("vu");
+    struct ArrowArray* view2 = build("vu");
+
+    int64_t distinct = arrow_count_distinct_string(utf8);
+    CHECK_EQ(arrow_count_distinct_large_string(large), distinct);
+    CHECK_EQ(arrow_count_distinct_string_view(view), distinct);
+
+    struct ArrowArray* len32 = arrow_string_length(utf8);
+    struct ArrowArray* len64 = arrow_large_string_length(large);
+    struct ArrowArray* len_view = arrow_string_view_length(view);
+    struct ArrowArray* starts[] = {
+        arrow_string_starts_with(utf8, "a-long"),
+        arrow_large_string_starts_with(large, "a-long"),
+        arrow_string_view_starts_with(view, "a-long")
+    };
+    struct ArrowArray* contains[] = {
+        arrow_string_contains(utf8, "d4"),
+        arrow_large_string_contains(large, "d4"),
+        arrow_string_view_contains(view, "d4")
+    };
+    struct ArrowArray* ends[] = {
+        arrow_string_ends_with(utf8, "-7"),
+        arrow_large_string_ends_with(large, "-7"),
+        arrow_string_view_ends_with(view, "-7")
+    };
+    struct ArrowArray* eq = arrow_eq_string_view(view, view2);
+    char value[64];
+    for (int64_t i = 0; i < COUNT; i++) {
+        int len = expected_string(i, value);
+        if (len < 0) continue;
+        CHECK_EQ(((const int32_t*)len32->buffers[1])[i], len);
+        CHECK_EQ(((const int64_t*)len64->buffers[1])[i], len);
+        CHECK_EQ(((const int32_t*)len_view->buffers[1])[i], len);
+        for (int k = 0; k < 3; k++) {
+            CHECK_EQ(test_bit(starts[k]->buffers[1], i), strncmp(value, "a-long", 6) == 0);
+            CHECK_EQ(test_bit(contains[k]->buffers[1], i), strstr(value, "d4") != NULL);
+            CHECK_EQ(test_bit(ends[k]->buffers[1], i), len >= 2 && strcmp(value + len - 2, "-7") == 0);
+        }
+        CHECK(test_bit(eq->buffers[1], i));
+    }
+
+    // Filtering keeps every third row
+    uint8_t mask_bits[(COUNT + 7) / 8] = {0};
+    int64_t kept[COUNT];
+    int64_t n_kept = 0;
+    for (int64_t i = 0; i < COUNT; i++) {
+        if (i % 3 == 0) {
+            mask_bits[i / 8] |= (uint8_t)(1u << (i % 8));
+            kept[n_kept++] = i;
+        }
+    }
+    const void* mask_buffers[] = {NULL, mask_bits};
+    struct ArrowArray mask = test_array(COUNT, 2, mask_buffers, 0, NULL);
+    struct ArrowArray* filtered[] = {
+        arrow_filter_string(utf8, &mask),
+        arrow_filter_large_string(large, &mask),
+        arrow_filter_string_view(view, &mask)
+    };
+    const char* formats[] = {"u", "U", "vu"};
+    for (int k = 0; k < 3; k++) {
+        CHECK(filtered[k] != NULL);
+        check_strings(filtered[k], formats[k], kept, n_kept);
+        arrow_compute_array_free(filtered[k]);
+        arrow_compute_array_free(starts[k]);
+        arrow_compute_array_free(contains[k]);
+        arrow_compute_array_free(ends[k]);
+    }
+    arrow_compute_array_free(eq);
+    arrow_compute_array_free(len32);
+    arrow_compute_array_free(len64);
+    arrow_compute_array_free(len_view);
+    free_array(utf8);
+    free_array(large);
+    free_array(view);
+    free_array(view2);
+}
+
+// Compact IPC, whole and sliced
+static void test_ipc(void) {
+    const char* formats[] = {"U", "vu"};
+    for (int f = 0; f < 2; f++) {
+        struct ArrowArray* a = build(formats[f]);
+        struct ArrowSchema schema = test_schema(formats[f], "s", 0, NULL);
+        for (int sliced = 0; sliced < 2; sliced++) {
+            struct ArrowArray input = *a;
+            if (sliced) {
+                input.offset = 101;
+                input.length = 77;
+                input.null_count = -1;
+            }
+            uint8_t* data = NULL;
+            size_t size = 0;
+            CHECK_EQ(arrow_ipc_serialize_array(&input, &schema, &data, &size), ARROW_IPC_OK);
+            struct ArrowArray out;
+            size_t bytes_read = 0;
+            CHECK_EQ(arrow_ipc_deserialize_array(data, size, &schema, &out, &bytes_read), ARROW_IPC_OK);
+            int64_t rows[COUNT];
+            for (int64_t k = 0; k < input.length; k++) rows[k] = input.offset + k;
+            check_strings(&out, formats[f], rows, input.length);
+            out.release(&out);
+            free(data);
+        }
+        free_array(a);
+    }
+}
+
+// Parquet writes every layout and reads back the one asked for
+static void test_parquet(void) {
+    const char* formats[] = {"u", "U", "vu"};
+    ParquetBytesLayout layouts[] = {PARQUET_BYTES_OFFSETS32, PARQUET_BYTES_OFFSETS64, PARQUET_BYTES_VIEW};
+    for (int w = 0; w < 3; w++) {
+        struct ArrowArray* column = build(formats[w]);
+        struct ArrowArray* columns[] = {column};
+        const void* batch_buffers[] = {NULL};
+        struct ArrowArray batch = test_array(COUNT, 1, batch_buffers, 1, columns);
+        struct ArrowSchema field = test_schema(formats[w], "s", 0, NULL);
+        struct ArrowSchema* fields[] = {&field};
+        struct ArrowSchema schema = test_schema("+s", "", 1, fields);
+
+        const char* path = test_parquet_path("string_layouts");
+        test_parquet_write(parquet_file_writer_create(path), &batch, &schema);
+        free_array(column);
+
+        for (int r = 0; r < 3; r++) {
+            ParquetFileReader* reader = parquet_file_reader_open(path);
+            CHECK(reader != NULL);
+            CHECK_EQ(parquet_file_reader_set_bytes_layout(reader, layouts[r]), 0);
+            struct ArrowSchema out_schema;
+            struct ArrowArray out;
+            test_parquet_read(reader, &out_schema, &out);
+            CHECK(strcmp(out_schema.children[0]->format, formats[r]) == 0);
+            check_strings(out.children[0], formats[r], NULL, COUNT);
+            test_parquet_release(&out_schema, &out);
+            parquet_file_reader_close(reader);
+        }
+        remove(path);
+    }
+}
+
+int main(void) {
+    printf("test_string_layouts\n");
+    RUN_TEST(test_builders);
+    RUN_TEST(test_compute);
+    RUN_TEST(test_ipc);
+    RUN_TEST(test_parquet);
+    return 0;
+}
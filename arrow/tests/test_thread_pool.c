@@ -0,0 +1,196 @@
+// Enable POSIX extensions for nanosleep
+#define _POSIX_C_SOURCE 200809L
+
+/**
+ * test_thread_pool.c - The work-stealing pool: loop coverage, worker hooks,
+ * parallel stable sorts and thread-count independent results
+ */
+
+#include "test_util.h"
+#include "arrow_chunked_compute.h"
+#include "arrow_memory.h"
+#include "arrow_thread_pool.h"
+#include <time.h>
+
+#define ROWS 200003
+
+static int hits[100000];
+
+static void count_hits(void* ctx, size_t begin, size_t end) {
+    (void)ctx;
+    CHECK(begin < end);
+    for (size_t i = begin; i < end; i++) __atomic_fetch_add(&hits[i], 1, __ATOMIC_RELAXED);
+}
+
+// Every index runs exactly once, whatever the count and grain
+static void test_coverage(void) {
+    size_t counts[] = {0, 1, 7, 1000, 100000};
+    size_t grains[] = {0, 1, 3, 64, 100000};
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        for (size_t g = 0; g < sizeof(grains) / sizeof(grains[0]); g++) {
+            memset(hits, 0, sizeof(hits));
+            arrow_parallel_for(counts[c], grains[g], count_hits, NULL);
+            for (size_t i = 0; i < counts[c]; i++) CHECK_EQ(hits[i], 1);
+            CHECK_EQ(hits[counts[c] < 100000 ? counts[c] : 0], counts[c] < 100000 ? 0 : 1);
+        }
+    }
+}
+
+// A loop body may run a loop of its own
+static void inner_loop(void* ctx, size_t begin, size_t end) {
+    (void)ctx;
+    for (size_t i = begin; i < end; i++) arrow_parallel_for(100, 7, count_hits, NULL);
+}
+
+static void test_nested(void) {
+    memset(hits, 0, sizeof(hits));
+    arrow_parallel_for(40, 1, inner_loop, NULL);
+    for (size_t i = 0; i < 100; i++) CHECK_EQ(hits[i], 40);
+}
+
+static int starts;
+static int exits;
+
+static void on_start(void) {
+    __atomic_fetch_add(&starts, 1, __ATOMIC_RELAXED);
+}
+
+static void on_exit_hook(void) {
+    __atomic_fetch_add(&exits, 1, __ATOMIC_RELAXED);
+}
+
+static void slow_piece(void* ctx, size_t begin, size_t end) {
+    (void)ctx;
+    (void)begin;
+    (void)end;
+    struct timespec pause = {0, 1000000};
+    nanosleep(&pause, NULL);
+}
+
+// Workers run the start hook before their first task and the exit hook when
+// the pool stops
+static void test_hooks(void) {
+    CHECK_EQ(arrow_thread_pool_set_threads(4), 0);
+    CHECK_EQ(arrow_thread_pool_threads(), 4);
+    arrow_thread_pool_set_hooks(on_start, on_exit_hook);
+    arrow_parallel_for(64, 1, slow_piece, NULL);
+    CHECK(starts >= 1 && starts <= 3);
+    CHECK_EQ(arrow_thread_pool_set_threads(1), 0);
+    CHECK_EQ(exits, starts);
+    arrow_thread_pool_set_hooks(NULL, NULL);
+
+    // One thread: the loop runs on the caller
+    arrow_parallel_for(64, 1, count_hits, NULL);
+    CHECK_EQ(starts, exits);
+    CHECK_EQ(arrow_thread_pool_set_threads(4), 0);
+}
+
+static int64_t ints[ROWS];
+static double floats[ROWS];
+
+static struct ArrowArray array_of(const void* values, const void** buffers) {
+    buffers[0] = NULL;
+    buffers[1] = values;
+    return test_array(ROWS, 2, buffers, 0, NULL);
+}
+
+// Sorted, and equal values keep their input order
+static void check_sorted(struct ArrowArray* indices, const void* values, int is_float, int ascending) {
+    CHECK(indices != NULL);
+    CHECK_EQ(indices->length, ROWS);
+    const int32_t* idx = (const int32_t*)indices->buffers[1];
+    static uint8_t seen[ROWS];
+    memset(seen, 0, sizeof(seen));
+    for (int64_t i = 0; i < ROWS; i++) {
+        CHECK(idx[i] >= 0 && idx[i] < ROWS && !seen[idx[i]]);
+        seen[idx[i]] = 1;
+        if (i == 0) continue;
+        int32_t p = idx[i - 1], q = idx[i];
+        int cmp;
+        if (is_float) {
+            double a = ((const double*)values)[p], b = ((const double*)values)[q];
+            cmp = a != a ? (b != b ? 0 : 1) : b != b ? -1 : (a > b) - (a < b);
+            if (!ascending && a == a && b == b) cmp = -cmp;
+        } else {
+            int64_t a = ((const int64_t*)values)[p], b = ((const int64_t*)values)[q];
+            cmp = ascending ? (a > b) - (a < b) : (a < b) - (a > b);
+        }
+        CHECK(cmp < 0 || (cmp == 0 && p < q));
+    }
+    indices->release(indices);
+    free(indices);
+}
+
+static void test_stable_sort(void) {
+    for (int64_t i = 0; i < ROWS; i++) {
+        ints[i] = (i * 7919) % 1009 - 500;
+        floats[i] = i % 101 == 0 ? 0.0 / 0.0 : (double)((i * 31) % 997) * 0.5;
+    }
+    const void* int_buffers[2];
+    const void* float_buffers[2];
+    struct ArrowArray int_array = array_of(ints, int_buffers);
+    struct ArrowArray float_array = array_of(floats, float_buffers);
+
+    check_sorted(arrow_sort_indices_int64(&int_array, true), ints, 0, 1);
+    check_sorted(arrow_sort_indices_int64(&int_array, false), ints, 0, 0);
+    check_sorted(arrow_sort_indices_float64(&float_array, true), floats, 1, 1);
+    check_sorted(arrow_sort_indices_float64(&float_array, false), floats, 1, 0);
+}
+
+// Partials combine in morsel order, so floating-point results are the same
+// bits for every thread count
+static void test_deterministic_floats(void) {
+    for (int64_t i = 0; i < ROWS; i++) floats[i] = 1.0 / (double)(i + 1) * (i % 2 ? 1e10 : 1e-3);
+    const void* buffers[2];
+    struct ArrowArray array = array_of(floats, buffers);
+
+    double sums[3], variances[3];
+    int threads[] = {1, 2, 4};
+    for (int t = 0; t < 3; t++) {
+        CHECK_EQ(arrow_thread_pool_set_threads(threads[t]), 0);
+        sums[t] = arrow_parallel_sum_float64(&array).f64_value;
+        variances[t] = arrow_parallel_variance_float64(&array).f64_value;
+    }
+    CHECK(memcmp(&sums[0], &sums[1], sizeof(double)) == 0 && memcmp(&sums[0], &sums[2], sizeof(double)) == 0);
+    CHECK(memcmp(&variances[0], &variances[1], sizeof(double)) == 0);
+    CHECK(memcmp(&variances[0], &variances[2], sizeof(double)) == 0);
+}
+
+// Pieces allocate from the pool of the thread that started the loop
+static void test_caller_pool(void) {
+    for (int64_t i = 0; i < ROWS; i++) ints[i] = i;
+    const void* buffers[2];
+    struct ArrowArray array = array_of(ints, buffers);
+
+    ArrowMemoryPool* pool = arrow_size_class_memory_pool_create(0);
+    arrow_memory_pool_set_thread(pool);
+    ChunkedArray* sums = arrow_parallel_binary(&array, &array, arrow_add_int64, "l");
+    arrow_memory_pool_set_thread(NULL);
+    CHECK(sums != NULL);
+    CHECK_EQ(chunked_array_num_chunks(sums), (ROWS + ARROW_MORSEL_ROWS - 1) / ARROW_MORSEL_ROWS);
+
+    ArrowMemoryStats stats;
+    arrow_memory_pool_stats(pool, &stats);
+    CHECK(stats.subsystems[ARROW_MEMORY_COMPUTE].bytes_live >= ROWS * 8);
+    struct ArrowArray* last = chunked_array_get_chunk(sums, chunked_array_num_chunks(sums) - 1);
+    CHECK_EQ(((const int64_t*)last->buffers[1])[last->length - 1], 2 * (ROWS - 1));
+
+    // The input became a shared reference for the morsel slices
+    chunked_array_free(sums);
+    array.release(&array);
+    arrow_memory_pool_stats(pool, &stats);
+    CHECK_EQ(stats.live_allocations, 0);
+    arrow_memory_pool_destroy(pool);
+}
+
+int main(void) {
+    printf("test_thread_pool\n");
+    CHECK_EQ(arrow_thread_pool_set_threads(4), 0);
+    RUN_TEST(test_coverage);
+    RUN_TEST(test_nested);
+    RUN_TEST(test_hooks);
+    RUN_TEST(test_stable_sort);
+    RUN_TEST(test_deterministic_floats);
+    RUN_TEST(test_caller_pool);
+    return 0;
+}
@@ -0,0 +1,72 @@
+/**
+ * test_util.h - Minimal helpers shared by the C round-trip tests
+ *
+ * Each test is a standalone program: a failed CHECK prints its location and
+ * exits with status 1, so `make check` stops at the first failing test.
+ */
+
+#ifndef ARROW_TEST_UTIL_H
+#define ARROW_TEST_UTIL_H
+
+#include "arrow_c_abi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        exit(1); \
+    } \
+} while (0)
+
+#define CHECK_EQ(a, b) CHECK((a) == (b))
+
+#define RUN_TEST(fn) do { \
+    fn(); \
+    printf("  ok  %s\n", #fn); \
+} while (0)
+
+// Release callbacks for arrays and schemas built on the stack in a test
+static inline void test_release_array(struct ArrowArray* array) {
+    array->release = NULL;
+}
+
+static inline void test_release_schema(struct ArrowSchema* schema) {
+    schema->release = NULL;
+}
+
+// A borrowed array over caller-owned buffers and children
+static inline struct ArrowArray test_array(int64_t length, int64_t n_buffers, const void** buffers,
+                                           int64_t n_children, struct ArrowArray** children) {
+    struct ArrowArray array;
+    memset(&array, 0, sizeof(array));
+    array.length = length;
+    array.null_count = buffers && buffers[0] ? -1 : 0;
+    array.n_buffers = n_buffers;
+    array.buffers = buffers;
+    array.n_children = n_children;
+    array.children = children;
+    array.release = test_release_array;
+    return array;
+}
+
+// A borrowed schema node
+static inline struct ArrowSchema test_schema(const char* format, const char* name,
+                                             int64_t n_children, struct ArrowSchema** children) {
+    struct ArrowSchema schema;
+    memset(&schema, 0, sizeof(schema));
+    schema.format = format;
+    schema.name = name;
+    schema.flags = ARROW_FLAG_NULLABLE;
+    schema.n_children = n_children;
+    schema.children = children;
+    schema.release = test_release_schema;
+    return schema;
+}
+
+static inline int test_bit(const void* bitmap, int64_t i) {
+    return (((const uint8_t*)bitmap)[i / 8] >> (i % 8)) & 1;
+}
+
+#endif // ARROW_TEST_UTIL_H
@@ -58,6 +58,9 @@
             pkgs.clang
             pkgs.lld
             pkgs.gcc
+            pkgs.gnumake
+            pkgs.zstd
+            pkgs.lz4
           ];
 
           LD_LIBRARY_PATH = pkgs.lib.makeLibraryPath (nativeDeps ++ [ pkgs.stdenv.cc.cc.lib ]);
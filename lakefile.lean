@@ -9,7 +9,9 @@ package arrowLean where
     "-Wl,-rpath,/usr/local/lib",
     "-Wl,--allow-shlib-undefined",
     "-lzlog",
-    "-lzstd"
+    "-lzstd",
+    "-llz4",
+    "-lpthread"
   ]
 
 @[default_target]
@@ -18,6 +20,9 @@ lean_lib ArrowLean
 lean_lib Examples where
   globs := #[.submodules `Examples]
 
+lean_lib Tests where
+  globs := #[.submodules `Tests]
+
 target arrow_schema_o pkg : FilePath := do
   let oFile := pkg.buildDir / "arrow" / "arrow_schema.o"
   IO.FS.createDirAll oFile.parent.get!
@@ -32,6 +37,14 @@ target arrow_array_o pkg : FilePath := do
   compileO oFile (pkg.dir / "arrow" / "arrow_array.c") flags
   return .pure oFile
 
+-- Memory pools for Arrow buffers
+target arrow_memory_o pkg : FilePath := do
+  let oFile := pkg.buildDir / "arrow" / "arrow_memory.o"
+  IO.FS.createDirAll oFile.parent.get!
+  let flags := #["-fPIC", "-O2", "-std=c99", "-I", (← getLeanIncludeDir).toString, "-I", (pkg.dir / "arrow").toString]
+  compileO oFile (pkg.dir / "arrow" / "arrow_memory.c") flags
+  return .pure oFile
+
 target arrow_stream_o pkg : FilePath := do
   let oFile := pkg.buildDir / "arrow" / "arrow_stream.o"
   IO.FS.createDirAll oFile.parent.get!
@@ -89,6 +102,14 @@ target parquet_writer_impl_o pkg : FilePath := do
   compileO oFile (pkg.dir / "arrow" / "parquet_writer_impl.c") flags
   return .pure oFile
 
+-- Buffered, asynchronous output sink for the Parquet writer (pthreads)
+target parquet_sink_o pkg : FilePath := do
+  let oFile := pkg.buildDir / "arrow" / "parquet_sink.o"
+  IO.FS.createDirAll oFile.parent.get!
+  let flags := #["-fPIC", "-O2", "-std=c99", "-I", (← getLeanIncludeDir).toString, "-I", (pkg.dir / "arrow").toString]
+  compileO oFile (pkg.dir / "arrow" / "parquet_sink.c") flags
+  return .pure oFile
+
 -- Pure C Parquet reader implementation (Thrift decoding, page reading)
 target parquet_reader_impl_o pkg : FilePath := do
   let oFile := pkg.buildDir / "arrow" / "parquet_reader_impl.o"
@@ -104,6 +125,20 @@ target arrow_ipc_o pkg : FilePath := do
   compileO oFile (pkg.dir / "arrow" / "arrow_ipc.c") flags
   return .pure oFile
 
+target arrow_ipc_stream_o pkg : FilePath := do
+  let oFile := pkg.buildDir / "arrow" / "arrow_ipc_stream.o"
+  IO.FS.createDirAll oFile.parent.get!
+  let flags := #["-fPIC", "-O2", "-std=c99", "-I", (← getLeanIncludeDir).toString, "-I", (pkg.dir / "arrow").toString]
+  compileO oFile (pkg.dir / "arrow" / "arrow_ipc_stream.c") flags
+  return .pure oFile
+
+target arrow_ipc_batch_file_o pkg : FilePath := do
+  let oFile := pkg.buildDir / "arrow" / "arrow_ipc_batch_file.o"
+  IO.FS.createDirAll oFile.parent.get!
+  let flags := #["-fPIC", "-O2", "-std=c99", "-I", (← getLeanIncludeDir).toString, "-I", (pkg.dir / "arrow").toString]
+  compileO oFile (pkg.dir / "arrow" / "arrow_ipc_batch_file.c") flags
+  return .pure oFile
+
 target lean_arrow_ipc_o pkg : FilePath := do
   let oFile := pkg.buildDir / "arrow" / "lean_arrow_ipc.o"
   IO.FS.createDirAll oFile.parent.get!
@@ -159,6 +194,38 @@ target arrow_chunked_o pkg : FilePath := do
   compileO oFile (pkg.dir / "arrow" / "arrow_chunked.c") flags
   return .pure oFile
 
+-- Work-stealing thread pool for parallel kernels
+target arrow_thread_pool_o pkg : FilePath := do
+  let oFile := pkg.buildDir / "arrow" / "arrow_thread_pool.o"
+  IO.FS.createDirAll oFile.parent.get!
+  let flags := #["-fPIC", "-O2", "-std=c99", "-I", (← getLeanIncludeDir).toString, "-I", (pkg.dir / "arrow").toString]
+  compileO oFile (pkg.dir / "arrow" / "arrow_thread_pool.c") flags
+  return .pure oFile
+
+-- Compute kernels over ChunkedArrays (chunk-wise, optionally threaded)
+target arrow_chunked_compute_o pkg : FilePath := do
+  let oFile := pkg.buildDir / "arrow" / "arrow_chunked_compute.o"
+  IO.FS.createDirAll oFile.parent.get!
+  let flags := #["-fPIC", "-O2", "-std=c99", "-I", (← getLeanIncludeDir).toString, "-I", (pkg.dir / "arrow").toString]
+  compileO oFile (pkg.dir / "arrow" / "arrow_chunked_compute.c") flags
+  return .pure oFile
+
+-- Fused block-wise expression evaluation over record batches
+target arrow_expression_o pkg : FilePath := do
+  let oFile := pkg.buildDir / "arrow" / "arrow_expression.o"
+  IO.FS.createDirAll oFile.parent.get!
+  let flags := #["-fPIC", "-O2", "-std=c99", "-I", (← getLeanIncludeDir).toString, "-I", (pkg.dir / "arrow").toString]
+  compileO oFile (pkg.dir / "arrow" / "arrow_expression.c") flags
+  return .pure oFile
+
+-- Lean FFI wrappers for expression evaluation
+target lean_arrow_expression_o pkg : FilePath := do
+  let oFile := pkg.buildDir / "arrow" / "lean_arrow_expression.o"
+  IO.FS.createDirAll oFile.parent.get!
+  let flags := #["-fPIC", "-O2", "-std=c99", "-I", (← getLeanIncludeDir).toString, "-I", (pkg.dir / "arrow").toString]
+  compileO oFile (pkg.dir / "arrow" / "lean_arrow_expression.c") flags
+  return .pure oFile
+
 -- Lean FFI wrappers for ChunkedArray and Table
 target lean_arrow_chunked_o pkg : FilePath := do
   let oFile := pkg.buildDir / "arrow" / "lean_arrow_chunked.o"
@@ -212,15 +279,19 @@ extern_lib libarrow_wrapper pkg := do
   let streamObj ← arrow_stream_o.fetch
   let dataAccessObj ← arrow_data_access_o.fetch
   let bufferObj ← arrow_buffer_o.fetch
+  let memoryObj ← arrow_memory_o.fetch
   let wrapperObj ← lean_arrow_wrapper_o.fetch
   let finalizersObj ← lean_arrow_finalizers_o.fetch
   -- Pure C Parquet implementation
   let parquetWrapperObj ← lean_parquet_wrapper_o.fetch
   let parquetReaderWriterObj ← parquet_reader_writer_o.fetch
   let parquetWriterImplObj ← parquet_writer_impl_o.fetch
+  let parquetSinkObj ← parquet_sink_o.fetch
   let parquetReaderImplObj ← parquet_reader_impl_o.fetch
   -- IPC serialization (pure C)
   let ipcObj ← arrow_ipc_o.fetch
+  let ipcStreamObj ← arrow_ipc_stream_o.fetch
+  let ipcBatchFileObj ← arrow_ipc_batch_file_o.fetch
   let ipcWrapperObj ← lean_arrow_ipc_o.fetch
   -- Typed builders for direct Arrow array construction (pure C)
   let buildersObj ← arrow_builders_o.fetch
@@ -230,16 +301,22 @@ extern_lib libarrow_wrapper pkg := do
   -- Arrow compute functions (arithmetic, comparisons, aggregations)
   let computeObj ← arrow_compute_o.fetch
   let computeWrapperObj ← lean_arrow_compute_o.fetch
+  let threadPoolObj ← arrow_thread_pool_o.fetch
+  -- Expression evaluation
+  let expressionObj ← arrow_expression_o.fetch
+  let expressionWrapperObj ← lean_arrow_expression_o.fetch
   -- ChunkedArray and Table
   let chunkedObj ← arrow_chunked_o.fetch
+  let chunkedComputeObj ← arrow_chunked_compute_o.fetch
   let chunkedWrapperObj ← lean_arrow_chunked_o.fetch
   -- CSV/Parquet stub (no C++ dependencies)
   let csvParquetStubObj ← csv_parquet_stub_o.fetch
   buildStaticLib (pkg.staticLibDir / nameToStaticLib "arrow_wrapper")
-    #[schemaObj, arrayObj, streamObj, dataAccessObj, bufferObj, wrapperObj, finalizersObj,
-      parquetWrapperObj, parquetReaderWriterObj, parquetWriterImplObj, parquetReaderImplObj,
-      ipcObj, ipcWrapperObj, buildersObj, builderWrapperObj, nestedBuildersObj, computeObj, computeWrapperObj,
-      chunkedObj, chunkedWrapperObj, csvParquetStubObj]
+    #[schemaObj, arrayObj, streamObj, dataAccessObj, bufferObj, memoryObj, wrapperObj, finalizersObj,
+      parquetWrapperObj, parquetReaderWriterObj, parquetWriterImplObj, parquetSinkObj, parquetReaderImplObj,
+      ipcObj, ipcStreamObj, ipcBatchFileObj, ipcWrapperObj, buildersObj, builderWrapperObj, nestedBuildersObj, computeObj, computeWrapperObj, threadPoolObj,
+      expressionObj, expressionWrapperObj,
+      chunkedObj, chunkedComputeObj, chunkedWrapperObj, csvParquetStubObj]
 
 require Cli from git
   "https://github.com/leanprover/lean4-cli.git" @ "v4.27.0"
@@ -249,3 +326,14 @@ require zlogLean from git
 
 lean_exe examples where
   root := `Examples.Main
+
+lean_exe tests where
+  root := `Tests.Main
+
+-- C round-trip tests (arrow/tests), then the Lean tests; `lake script run test`
+script test do
+  let child ← IO.Process.spawn { cmd := "make", args := #["-C", "arrow/tests", "check"] }
+  let rc ← child.wait
+  if rc != 0 then return rc
+  let lean ← IO.Process.spawn { cmd := "lake", args := #["exe", "tests"] }
+  lean.wait